@@ -0,0 +1,132 @@
+#include <benchmark/benchmark.h>
+#include <opal.h>
+
+#include <cassert>
+
+// note: this benchmark runs on the null backend, so it measures only the cost of getting
+// from an opal* entry point to the backend function. Build it once as usual and once with
+// -DOPAL_SINGLE_BACKEND=null to compare vtable dispatch against direct calls.
+class DispatchBench : public benchmark::Fixture
+{
+public:
+	void SetUp(benchmark::State &state)
+	{
+		static Opal_InstanceDesc instance_desc =
+		{
+			"dispatch benchmark",
+			"Opal",
+			0,
+			0,
+			OPAL_DEFAULT_HEAP_SIZE,
+			OPAL_DEFAULT_HEAP_ALLOCATIONS,
+			OPAL_DEFAULT_HEAPS,
+			(Opal_InstanceCreationFlags)0,
+			0,
+			nullptr,
+		};
+
+		Opal_Result result = opalCreateInstance(OPAL_API_NULL, &instance_desc, &instance);
+		assert(result == OPAL_SUCCESS);
+
+		result = opalCreateDefaultDevice(instance, OPAL_DEVICE_HINT_DEFAULT, &device);
+		assert(result == OPAL_SUCCESS);
+
+		result = opalGetDeviceQueue(device, OPAL_DEVICE_ENGINE_TYPE_MAIN, 0, &queue);
+		assert(result == OPAL_SUCCESS);
+
+		result = opalCreateCommandAllocator(device, queue, &command_allocator);
+		assert(result == OPAL_SUCCESS);
+
+		result = opalCreateCommandBuffer(device, command_allocator, &command_buffer);
+		assert(result == OPAL_SUCCESS);
+
+		result = opalBeginCommandBuffer(device, command_buffer);
+		assert(result == OPAL_SUCCESS);
+	}
+
+	void TearDown(benchmark::State &state)
+	{
+		Opal_Result result = opalEndCommandBuffer(device, command_buffer);
+		assert(result == OPAL_SUCCESS);
+
+		result = opalDestroyCommandBuffer(device, command_buffer);
+		assert(result == OPAL_SUCCESS);
+
+		result = opalDestroyCommandAllocator(device, command_allocator);
+		assert(result == OPAL_SUCCESS);
+
+		result = opalDestroyDevice(device);
+		assert(result == OPAL_SUCCESS);
+
+		result = opalDestroyInstance(instance);
+		assert(result == OPAL_SUCCESS);
+	}
+
+protected:
+	Opal_Instance instance {OPAL_NULL_HANDLE};
+	Opal_Device device {OPAL_NULL_HANDLE};
+	Opal_Queue queue {OPAL_NULL_HANDLE};
+	Opal_CommandAllocator command_allocator {OPAL_NULL_HANDLE};
+	Opal_CommandBuffer command_buffer {OPAL_NULL_HANDLE};
+};
+
+BENCHMARK_DEFINE_F(DispatchBench, ComputeDispatch)(benchmark::State &state)
+{
+	for (auto _ : state)
+	{
+		for (int64_t i = 0; i < state.range(0); ++i)
+		{
+			Opal_Result result = opalCmdComputeDispatch(device, command_buffer, 1, 1, 1);
+			benchmark::DoNotOptimize(result);
+		}
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_DEFINE_F(DispatchBench, GraphicsSetViewport)(benchmark::State &state)
+{
+	Opal_Viewport viewport = {0.0f, 0.0f, 1920.0f, 1080.0f, 0.0f, 1.0f};
+
+	for (auto _ : state)
+	{
+		for (int64_t i = 0; i < state.range(0); ++i)
+		{
+			Opal_Result result = opalCmdGraphicsSetViewport(device, command_buffer, viewport);
+			benchmark::DoNotOptimize(result);
+		}
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_DEFINE_F(DispatchBench, GraphicsDrawSequence)(benchmark::State &state)
+{
+	Opal_Viewport viewport = {0.0f, 0.0f, 1920.0f, 1080.0f, 0.0f, 1.0f};
+
+	for (auto _ : state)
+	{
+		for (int64_t i = 0; i < state.range(0); ++i)
+		{
+			benchmark::DoNotOptimize(opalCmdGraphicsSetViewport(device, command_buffer, viewport));
+			benchmark::DoNotOptimize(opalCmdGraphicsSetScissor(device, command_buffer, 0, 0, 1920, 1080));
+			benchmark::DoNotOptimize(opalCmdGraphicsDraw(device, command_buffer, 3, 1, 0, 0));
+		}
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0) * 3);
+}
+
+BENCHMARK_REGISTER_F(DispatchBench, ComputeDispatch)
+	->Name("ComputeDispatch")
+	->RangeMultiplier(8)->Range(1, 4096);
+
+BENCHMARK_REGISTER_F(DispatchBench, GraphicsSetViewport)
+	->Name("GraphicsSetViewport")
+	->RangeMultiplier(8)->Range(1, 4096);
+
+BENCHMARK_REGISTER_F(DispatchBench, GraphicsDrawSequence)
+	->Name("GraphicsDrawSequence")
+	->RangeMultiplier(8)->Range(1, 4096);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,194 @@
+#include <benchmark/benchmark.h>
+
+#include <cassert>
+#include <cstring>
+#include <vector>
+
+extern "C"
+{
+#include "instances.h"
+#include "pool.h"
+}
+
+// note: this benchmark packs instances into host memory with the common packer that Vulkan and
+// DirectX 12 use, so it runs without a GPU. Blases live in a pool the size of a backend one and
+// instances reference them in a scattered order, like a scene with many unique meshes. Baseline
+// is the per instance loop the backends used before the packer.
+struct Blas
+{
+	uint64_t device_address;
+	uint8_t payload[56];
+};
+
+struct NativeInstance
+{
+	float transform[12];
+	uint32_t custom_index : 24;
+	uint32_t mask : 8;
+	uint32_t offset : 24;
+	uint32_t flags : 8;
+	uint64_t address;
+};
+
+static const uint32_t num_blases = 4096;
+
+static uint64_t resolveAddress(void *device, Opal_AccelerationStructure blas)
+{
+	const Opal_Pool *pool = (const Opal_Pool *)device;
+
+	const Blas *blas_ptr = (const Blas *)opal_poolGetElement(pool, (Opal_PoolHandle)blas);
+	assert(blas_ptr);
+
+	return blas_ptr->device_address;
+}
+
+class InstancesBench : public benchmark::Fixture
+{
+public:
+	void SetUp(benchmark::State &state)
+	{
+		uint32_t num_instances = (uint32_t)state.range(0);
+
+		opal_poolInitialize(&pool, sizeof(Blas), num_blases);
+
+		std::vector<Opal_AccelerationStructure> blases(num_blases);
+		for (uint32_t i = 0; i < num_blases; ++i)
+		{
+			Blas blas = {};
+			blas.device_address = 0x100000000ull + i * 0x10000ull;
+			blases[i] = (Opal_AccelerationStructure)opal_poolAddElement(&pool, &blas);
+		}
+
+		instances.resize(num_instances);
+		addresses.resize(num_instances);
+
+		uint32_t seed = 1;
+		for (uint32_t i = 0; i < num_instances; ++i)
+		{
+			seed = seed * 1664525u + 1013904223u;
+
+			Opal_AccelerationStructureInstance &instance = instances[i];
+			for (uint32_t row = 0; row < 3; ++row)
+				for (uint32_t column = 0; column < 4; ++column)
+					instance.transform[row][column] = (row == column) ? 1.0f : (float)(i % 100);
+
+			instance.custom_index = i & 0xFFFFFF;
+			instance.mask = 0xFF;
+			instance.intersection_index_offset = 0;
+			instance.flags = OPAL_ACCELERATION_STRUCTURE_INSTANCE_FLAGS_FORCE_OPAQUE;
+			instance.blas = blases[(seed >> 8) % num_blases];
+
+			addresses[i] = resolveAddress(&pool, instance.blas);
+		}
+
+		storage.resize(num_instances * sizeof(NativeInstance) + 64);
+
+		uintptr_t ptr = (uintptr_t)storage.data();
+		dst = (uint8_t *)((ptr + 63) & ~(uintptr_t)63);
+
+		opal_instancePackerInitialize(&packer, &pool, 0);
+	}
+
+	void TearDown(benchmark::State &state)
+	{
+		opal_instancePackerShutdown(&packer);
+		opal_poolShutdown(&pool);
+	}
+
+protected:
+	Opal_Pool pool;
+	Opal_InstancePacker packer;
+	std::vector<Opal_AccelerationStructureInstance> instances;
+	std::vector<uint64_t> addresses;
+	std::vector<uint8_t> storage;
+	uint8_t *dst {nullptr};
+};
+
+BENCHMARK_DEFINE_F(InstancesBench, Baseline)(benchmark::State &state)
+{
+	for (auto _ : state)
+	{
+		uint8_t *dst_data = dst;
+
+		for (size_t i = 0; i < instances.size(); ++i)
+		{
+			const Opal_AccelerationStructureInstance *opal_instance = &instances[i];
+			NativeInstance *native_instance = (NativeInstance *)dst_data;
+
+			const Blas *blas_ptr = (const Blas *)opal_poolGetElement(&pool, (Opal_PoolHandle)opal_instance->blas);
+			assert(blas_ptr);
+
+			memcpy(native_instance->transform, opal_instance->transform, sizeof(float) * 12);
+			native_instance->custom_index = opal_instance->custom_index;
+			native_instance->mask = opal_instance->mask;
+			native_instance->offset = opal_instance->intersection_index_offset;
+			native_instance->flags = opal_instance->flags;
+			native_instance->address = blas_ptr->device_address;
+
+			dst_data += sizeof(NativeInstance);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(NativeInstance));
+}
+
+BENCHMARK_DEFINE_F(InstancesBench, Pack)(benchmark::State &state)
+{
+	for (auto _ : state)
+	{
+		opal_instancesPack(dst, (uint32_t)instances.size(), instances.data(), addresses.data());
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(NativeInstance));
+}
+
+BENCHMARK_DEFINE_F(InstancesBench, PackerResolved)(benchmark::State &state)
+{
+	for (auto _ : state)
+	{
+		opal_instancePackerRun(&packer, dst, (uint32_t)instances.size(), instances.data(), nullptr, resolveAddress);
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(NativeInstance));
+}
+
+BENCHMARK_DEFINE_F(InstancesBench, PackerPreResolved)(benchmark::State &state)
+{
+	for (auto _ : state)
+	{
+		opal_instancePackerRun(&packer, dst, (uint32_t)instances.size(), instances.data(), addresses.data(), nullptr);
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(NativeInstance));
+}
+
+BENCHMARK_REGISTER_F(InstancesBench, Baseline)
+	->Name("Baseline")
+	->Arg(100000)->Arg(250000)->Arg(500000)->Arg(1000000)
+	->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_REGISTER_F(InstancesBench, Pack)
+	->Name("Pack")
+	->Arg(100000)->Arg(250000)->Arg(500000)->Arg(1000000)
+	->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_REGISTER_F(InstancesBench, PackerResolved)
+	->Name("PackerResolved")
+	->Arg(100000)->Arg(250000)->Arg(500000)->Arg(1000000)
+	->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+BENCHMARK_REGISTER_F(InstancesBench, PackerPreResolved)
+	->Name("PackerPreResolved")
+	->Arg(100000)->Arg(250000)->Arg(500000)->Arg(1000000)
+	->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+BENCHMARK_MAIN();
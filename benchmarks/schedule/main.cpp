@@ -0,0 +1,199 @@
+#include <benchmark/benchmark.h>
+#include <opal.h>
+
+#include <algorithm>
+#include <cassert>
+
+// note: this benchmark runs on the null backend, which completes work at submit time, so GPU
+// execution is simulated: every job has a fixed cost and starts once its queue is free and its
+// dependencies are done. Jobs are placed on the queues returned by the scheduler, so the
+// simulated frame time shows how much of the frame overlaps across queues, while the measured
+// time is the CPU cost of scheduling.
+struct Job
+{
+	Opal_DeviceEngineType engine_type;
+	double cost;
+	int dependencies[3];
+	int num_dependencies;
+	bool previous_frame;
+};
+
+// note: previous_frame makes the first dependency refer to the job of the previous frame, e.g. the
+// upload can't overwrite simulation inputs before the previous simulation has consumed them
+static const Job frame_jobs[] =
+{
+	{OPAL_DEVICE_ENGINE_TYPE_COPY, 1500.0, {2}, 1, true},     // 0: stream
+	{OPAL_DEVICE_ENGINE_TYPE_MAIN, 2000.0, {}, 0, false},     // 1: shadows
+	{OPAL_DEVICE_ENGINE_TYPE_COMPUTE, 3000.0, {0}, 1, false}, // 2: simulate
+	{OPAL_DEVICE_ENGINE_TYPE_MAIN, 3000.0, {}, 0, false},     // 3: gbuffer
+	{OPAL_DEVICE_ENGINE_TYPE_MAIN, 2500.0, {1, 2, 3}, 3, false}, // 4: lighting
+	{OPAL_DEVICE_ENGINE_TYPE_MAIN, 1000.0, {4}, 1, false},    // 5: post
+};
+
+static const int num_frame_jobs = sizeof(frame_jobs) / sizeof(Job);
+
+class ScheduleBench : public benchmark::Fixture
+{
+public:
+	void SetUp(benchmark::State &state)
+	{
+		static Opal_InstanceDesc instance_desc =
+		{
+			"schedule benchmark",
+			"Opal",
+			0,
+			0,
+			OPAL_DEFAULT_HEAP_SIZE,
+			OPAL_DEFAULT_HEAP_ALLOCATIONS,
+			OPAL_DEFAULT_HEAPS,
+			(Opal_InstanceCreationFlags)0,
+			0,
+			nullptr,
+		};
+
+		Opal_Result result = opalCreateInstance(OPAL_API_NULL, &instance_desc, &instance);
+		assert(result == OPAL_SUCCESS);
+
+		result = opalCreateDefaultDevice(instance, OPAL_DEVICE_HINT_DEFAULT, &device);
+		assert(result == OPAL_SUCCESS);
+
+		result = opalCreateScheduler(device, &scheduler);
+		assert(result == OPAL_SUCCESS);
+
+		for (uint32_t i = 0; i < OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX; ++i)
+		{
+			Opal_Queue queue = OPAL_NULL_HANDLE;
+			result = opalGetSchedulerQueue(scheduler, (Opal_DeviceEngineType)i, &queue);
+			assert(result == OPAL_SUCCESS);
+
+			result = opalCreateCommandAllocator(device, queue, &command_allocators[i]);
+			assert(result == OPAL_SUCCESS);
+
+			result = opalCreateCommandBuffer(device, command_allocators[i], &command_buffers[i]);
+			assert(result == OPAL_SUCCESS);
+
+			result = opalBeginCommandBuffer(device, command_buffers[i]);
+			assert(result == OPAL_SUCCESS);
+
+			result = opalEndCommandBuffer(device, command_buffers[i]);
+			assert(result == OPAL_SUCCESS);
+		}
+	}
+
+	void TearDown(benchmark::State &state)
+	{
+		Opal_Result result = opalDestroyScheduler(scheduler);
+		assert(result == OPAL_SUCCESS);
+
+		for (uint32_t i = 0; i < OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX; ++i)
+		{
+			result = opalDestroyCommandBuffer(device, command_buffers[i]);
+			assert(result == OPAL_SUCCESS);
+
+			result = opalDestroyCommandAllocator(device, command_allocators[i]);
+			assert(result == OPAL_SUCCESS);
+		}
+
+		result = opalDestroyDevice(device);
+		assert(result == OPAL_SUCCESS);
+
+		result = opalDestroyInstance(instance);
+		assert(result == OPAL_SUCCESS);
+	}
+
+	void Run(benchmark::State &state, bool async)
+	{
+		Opal_Semaphore semaphores[2][num_frame_jobs] = {};
+		uint64_t values[2][num_frame_jobs] = {};
+		double finish[2][num_frame_jobs] = {};
+
+		Opal_Semaphore queue_semaphores[OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX] = {};
+		double queue_free[OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX] = {};
+
+		double gpu_time = 0.0;
+		double total_cost = 0.0;
+		int64_t frames = 0;
+
+		for (auto _ : state)
+		{
+			int current = frames & 1;
+			int previous = current ^ 1;
+
+			for (int i = 0; i < num_frame_jobs; ++i)
+			{
+				const Job &job = frame_jobs[i];
+
+				Opal_Semaphore dependency_semaphores[3] = {};
+				uint64_t dependency_values[3] = {};
+				uint32_t num_dependencies = 0;
+				double start = 0.0;
+
+				for (int j = 0; j < job.num_dependencies; ++j)
+				{
+					int frame = (job.previous_frame && j == 0) ? previous : current;
+					if (frame == previous && frames == 0)
+						continue;
+
+					dependency_semaphores[num_dependencies] = semaphores[frame][job.dependencies[j]];
+					dependency_values[num_dependencies] = values[frame][job.dependencies[j]];
+					num_dependencies++;
+
+					start = std::max(start, finish[frame][job.dependencies[j]]);
+				}
+
+				Opal_ScheduleDesc desc = {};
+				desc.engine_type = (async) ? job.engine_type : OPAL_DEVICE_ENGINE_TYPE_MAIN;
+				desc.num_dependencies = num_dependencies;
+				desc.dependency_semaphores = dependency_semaphores;
+				desc.dependency_values = dependency_values;
+				desc.num_command_buffers = 1;
+				desc.command_buffers = &command_buffers[desc.engine_type];
+
+				Opal_Result result = opalSchedule(scheduler, &desc, &semaphores[current][i], &values[current][i]);
+				assert(result == OPAL_SUCCESS);
+
+				// note: simulated queues are identified by the semaphore the scheduler signals for them
+				uint32_t queue = 0;
+				while (queue_semaphores[queue] != OPAL_NULL_HANDLE && queue_semaphores[queue] != semaphores[current][i])
+					queue++;
+
+				queue_semaphores[queue] = semaphores[current][i];
+
+				start = std::max(start, queue_free[queue]);
+				finish[current][i] = start + job.cost;
+				queue_free[queue] = finish[current][i];
+
+				gpu_time = std::max(gpu_time, finish[current][i]);
+				total_cost += job.cost;
+			}
+
+			frames++;
+		}
+
+		state.counters["gpu_us_per_frame"] = benchmark::Counter(gpu_time / static_cast<double>(frames));
+		state.counters["overlap"] = benchmark::Counter(total_cost / gpu_time);
+		state.SetItemsProcessed(frames * num_frame_jobs);
+	}
+
+protected:
+	Opal_Instance instance {OPAL_NULL_HANDLE};
+	Opal_Device device {OPAL_NULL_HANDLE};
+	Opal_Scheduler scheduler {OPAL_NULL_HANDLE};
+	Opal_CommandAllocator command_allocators[OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX] {};
+	Opal_CommandBuffer command_buffers[OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX] {};
+};
+
+BENCHMARK_DEFINE_F(ScheduleBench, Serial)(benchmark::State &state)
+{
+	Run(state, false);
+}
+
+BENCHMARK_DEFINE_F(ScheduleBench, Async)(benchmark::State &state)
+{
+	Run(state, true);
+}
+
+BENCHMARK_REGISTER_F(ScheduleBench, Serial)->Name("Serial");
+BENCHMARK_REGISTER_F(ScheduleBench, Async)->Name("Async");
+
+BENCHMARK_MAIN();
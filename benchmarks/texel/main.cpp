@@ -0,0 +1,334 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+extern "C"
+{
+#include "texel.h"
+}
+
+// note: this benchmark runs the host side texel conversions that upload paths use on staging
+// memory. Byte counts are source bytes, so GB/s can be compared against memcpy bandwidth of
+// the same machine. Baselines are the naive per texel loops upload code usually starts with.
+static uint32_t naiveFloatToHalf(float value)
+{
+	uint32_t bits = 0;
+	memcpy(&bits, &value, sizeof(float));
+
+	uint32_t sign = (bits >> 16) & 0x8000;
+	int32_t exponent = (int32_t)((bits >> 23) & 0xFF) - 127 + 15;
+	uint32_t mantissa = bits & 0x7FFFFF;
+
+	if (exponent <= 0)
+		return sign;
+
+	if (exponent >= 31)
+		return sign | 0x7C00;
+
+	return sign | ((uint32_t)exponent << 10) | (mantissa >> 13);
+}
+
+class TexelBench : public benchmark::Fixture
+{
+public:
+	void SetUp(benchmark::State &state)
+	{
+		num_values = (uint32_t)state.range(0);
+
+		bytes.resize(num_values);
+		floats.resize(num_values);
+		halfs.resize(num_values);
+		texels.resize(num_values / 4);
+
+		for (uint32_t i = 0; i < num_values; ++i)
+		{
+			bytes[i] = (uint8_t)(i * 31);
+			floats[i] = (float)(i % 4096) / 4095.0f;
+			halfs[i] = (uint16_t)(i % 0x7C00);
+		}
+
+		for (uint32_t i = 0; i < num_values / 4; ++i)
+			texels[i] = 0x80402010u + i;
+
+		dst_bytes.resize(num_values);
+		dst_floats.resize(num_values);
+		dst_halfs.resize(num_values);
+		dst_texels.resize(num_values / 4);
+	}
+
+	void TearDown(benchmark::State &state)
+	{
+		bytes.clear();
+		floats.clear();
+		halfs.clear();
+		texels.clear();
+		dst_bytes.clear();
+		dst_floats.clear();
+		dst_halfs.clear();
+		dst_texels.clear();
+	}
+
+protected:
+	uint32_t num_values {0};
+
+	std::vector<uint8_t> bytes;
+	std::vector<float> floats;
+	std::vector<uint16_t> halfs;
+	std::vector<uint32_t> texels;
+
+	std::vector<uint8_t> dst_bytes;
+	std::vector<float> dst_floats;
+	std::vector<uint16_t> dst_halfs;
+	std::vector<uint32_t> dst_texels;
+};
+
+BENCHMARK_DEFINE_F(TexelBench, SwizzleBaseline)(benchmark::State &state)
+{
+	for (auto _ : state)
+	{
+		const uint8_t *src = (const uint8_t *)texels.data();
+		uint8_t *dst = (uint8_t *)dst_texels.data();
+
+		for (uint32_t i = 0; i < num_values / 4; ++i)
+		{
+			dst[i * 4 + 0] = src[i * 4 + 2];
+			dst[i * 4 + 1] = src[i * 4 + 1];
+			dst[i * 4 + 2] = src[i * 4 + 0];
+			dst[i * 4 + 3] = src[i * 4 + 3];
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetBytesProcessed(state.iterations() * (num_values / 4) * sizeof(uint32_t));
+}
+
+BENCHMARK_DEFINE_F(TexelBench, Swizzle)(benchmark::State &state)
+{
+	for (auto _ : state)
+	{
+		opal_texelSwizzleRB(dst_texels.data(), texels.data(), num_values / 4);
+		benchmark::ClobberMemory();
+	}
+
+	state.SetBytesProcessed(state.iterations() * (num_values / 4) * sizeof(uint32_t));
+}
+
+BENCHMARK_DEFINE_F(TexelBench, SrgbToLinear)(benchmark::State &state)
+{
+	for (auto _ : state)
+	{
+		opal_texelSrgbToLinear(dst_floats.data(), bytes.data(), num_values);
+		benchmark::ClobberMemory();
+	}
+
+	state.SetBytesProcessed(state.iterations() * num_values * sizeof(uint8_t));
+}
+
+BENCHMARK_DEFINE_F(TexelBench, LinearToSrgbBaseline)(benchmark::State &state)
+{
+	for (auto _ : state)
+	{
+		for (uint32_t i = 0; i < num_values; ++i)
+		{
+			float value = floats[i];
+			float encoded = (value <= 0.0031308f) ? value * 12.92f : 1.055f * powf(value, 1.0f / 2.4f) - 0.055f;
+			dst_bytes[i] = (uint8_t)(encoded * 255.0f + 0.5f);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetBytesProcessed(state.iterations() * num_values * sizeof(float));
+}
+
+BENCHMARK_DEFINE_F(TexelBench, LinearToSrgb)(benchmark::State &state)
+{
+	for (auto _ : state)
+	{
+		opal_texelLinearToSrgb(dst_bytes.data(), floats.data(), num_values);
+		benchmark::ClobberMemory();
+	}
+
+	state.SetBytesProcessed(state.iterations() * num_values * sizeof(float));
+}
+
+BENCHMARK_DEFINE_F(TexelBench, FloatToHalfBaseline)(benchmark::State &state)
+{
+	for (auto _ : state)
+	{
+		for (uint32_t i = 0; i < num_values; ++i)
+			dst_halfs[i] = (uint16_t)naiveFloatToHalf(floats[i]);
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetBytesProcessed(state.iterations() * num_values * sizeof(float));
+}
+
+BENCHMARK_DEFINE_F(TexelBench, FloatToHalf)(benchmark::State &state)
+{
+	for (auto _ : state)
+	{
+		opal_texelFloatToHalf(dst_halfs.data(), floats.data(), num_values);
+		benchmark::ClobberMemory();
+	}
+
+	state.SetBytesProcessed(state.iterations() * num_values * sizeof(float));
+}
+
+BENCHMARK_DEFINE_F(TexelBench, HalfToFloat)(benchmark::State &state)
+{
+	for (auto _ : state)
+	{
+		opal_texelHalfToFloat(dst_floats.data(), halfs.data(), num_values);
+		benchmark::ClobberMemory();
+	}
+
+	state.SetBytesProcessed(state.iterations() * num_values * sizeof(uint16_t));
+}
+
+BENCHMARK_DEFINE_F(TexelBench, PackRG11B10)(benchmark::State &state)
+{
+	for (auto _ : state)
+	{
+		opal_texelPackRG11B10(dst_texels.data(), floats.data(), num_values / 4);
+		benchmark::ClobberMemory();
+	}
+
+	state.SetBytesProcessed(state.iterations() * num_values * sizeof(float));
+}
+
+BENCHMARK_DEFINE_F(TexelBench, PackRGB9E5)(benchmark::State &state)
+{
+	for (auto _ : state)
+	{
+		opal_texelPackRGB9E5(dst_texels.data(), floats.data(), num_values / 4);
+		benchmark::ClobberMemory();
+	}
+
+	state.SetBytesProcessed(state.iterations() * num_values * sizeof(float));
+}
+
+// note: one mip step of a square RGBA8 image, range is the source width
+class DownsampleBench : public benchmark::Fixture
+{
+public:
+	void SetUp(benchmark::State &state)
+	{
+		size = (uint32_t)state.range(0);
+
+		src.resize((size_t)size * size * 4);
+		dst.resize((size_t)size * size);
+
+		for (size_t i = 0; i < src.size(); ++i)
+			src[i] = (uint8_t)(i * 13 + (i >> 9));
+	}
+
+	void TearDown(benchmark::State &state)
+	{
+		src.clear();
+		dst.clear();
+	}
+
+protected:
+	void run(benchmark::State &state, Opal_TextureFormat format, Opal_TexelFilter filter)
+	{
+		for (auto _ : state)
+		{
+			Opal_Result result = opal_texelDownsample(format, filter, size, size, size * 4, src.data(), size * 2, dst.data());
+			benchmark::DoNotOptimize(result);
+			benchmark::ClobberMemory();
+		}
+
+		state.SetBytesProcessed(state.iterations() * src.size());
+	}
+
+	uint32_t size {0};
+	std::vector<uint8_t> src;
+	std::vector<uint8_t> dst;
+};
+
+BENCHMARK_DEFINE_F(DownsampleBench, BoxRGBA8)(benchmark::State &state)
+{
+	run(state, OPAL_TEXTURE_FORMAT_RGBA8_UNORM, OPAL_TEXEL_FILTER_BOX);
+}
+
+BENCHMARK_DEFINE_F(DownsampleBench, BoxSrgb)(benchmark::State &state)
+{
+	run(state, OPAL_TEXTURE_FORMAT_RGBA8_UNORM_SRGB, OPAL_TEXEL_FILTER_BOX);
+}
+
+BENCHMARK_DEFINE_F(DownsampleBench, KaiserRGBA8)(benchmark::State &state)
+{
+	run(state, OPAL_TEXTURE_FORMAT_RGBA8_UNORM, OPAL_TEXEL_FILTER_KAISER);
+}
+
+BENCHMARK_REGISTER_F(TexelBench, SwizzleBaseline)
+	->Name("SwizzleBaseline")
+	->Arg(1 << 16)->Arg(1 << 20)->Arg(1 << 24)
+	->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_REGISTER_F(TexelBench, Swizzle)
+	->Name("Swizzle")
+	->Arg(1 << 16)->Arg(1 << 20)->Arg(1 << 24)
+	->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_REGISTER_F(TexelBench, SrgbToLinear)
+	->Name("SrgbToLinear")
+	->Arg(1 << 16)->Arg(1 << 20)->Arg(1 << 24)
+	->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_REGISTER_F(TexelBench, LinearToSrgbBaseline)
+	->Name("LinearToSrgbBaseline")
+	->Arg(1 << 16)->Arg(1 << 20)->Arg(1 << 24)
+	->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_REGISTER_F(TexelBench, LinearToSrgb)
+	->Name("LinearToSrgb")
+	->Arg(1 << 16)->Arg(1 << 20)->Arg(1 << 24)
+	->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_REGISTER_F(TexelBench, FloatToHalfBaseline)
+	->Name("FloatToHalfBaseline")
+	->Arg(1 << 16)->Arg(1 << 20)->Arg(1 << 24)
+	->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_REGISTER_F(TexelBench, FloatToHalf)
+	->Name("FloatToHalf")
+	->Arg(1 << 16)->Arg(1 << 20)->Arg(1 << 24)
+	->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_REGISTER_F(TexelBench, HalfToFloat)
+	->Name("HalfToFloat")
+	->Arg(1 << 16)->Arg(1 << 20)->Arg(1 << 24)
+	->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_REGISTER_F(TexelBench, PackRG11B10)
+	->Name("PackRG11B10")
+	->Arg(1 << 16)->Arg(1 << 20)->Arg(1 << 24)
+	->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_REGISTER_F(TexelBench, PackRGB9E5)
+	->Name("PackRGB9E5")
+	->Arg(1 << 16)->Arg(1 << 20)->Arg(1 << 24)
+	->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_REGISTER_F(DownsampleBench, BoxRGBA8)
+	->Name("DownsampleBoxRGBA8")
+	->Arg(256)->Arg(1024)->Arg(4096)
+	->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_REGISTER_F(DownsampleBench, BoxSrgb)
+	->Name("DownsampleBoxSrgb")
+	->Arg(256)->Arg(1024)->Arg(4096)
+	->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_REGISTER_F(DownsampleBench, KaiserRGBA8)
+	->Name("DownsampleKaiserRGBA8")
+	->Arg(256)->Arg(1024)->Arg(4096)
+	->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
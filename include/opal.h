@@ -23,6 +23,8 @@
 
 #if defined(OPAL_SHARED_LIBRARY)
 	#define OPAL_APIENTRY extern OPAL_EXPORT
+#elif defined(OPAL_STATIC_LIBRARY)
+	#define OPAL_APIENTRY extern
 #else
 	#define OPAL_APIENTRY extern OPAL_IMPORT
 #endif
@@ -41,6 +43,7 @@ extern "C" {
 #define OPAL_DEFAULT_HEAP_SIZE 0x10000000
 #define OPAL_DEFAULT_HEAP_ALLOCATIONS 1000000
 #define OPAL_DEFAULT_HEAPS 64
+#define OPAL_MAX_UPDATE_BUFFER_SIZE 65536
 
 // Opaque handles
 OPAL_DEFINE_HANDLE(Opal_Instance);
@@ -66,6 +69,15 @@ OPAL_DEFINE_HANDLE(Opal_GraphicsPipeline);
 OPAL_DEFINE_HANDLE(Opal_ComputePipeline);
 OPAL_DEFINE_HANDLE(Opal_RaytracePipeline);
 OPAL_DEFINE_HANDLE(Opal_Swapchain);
+OPAL_DEFINE_HANDLE(Opal_Profiler);
+OPAL_DEFINE_HANDLE(Opal_PipelineTask);
+OPAL_DEFINE_HANDLE(Opal_Uploader);
+OPAL_DEFINE_HANDLE(Opal_TransientAllocator);
+OPAL_DEFINE_HANDLE(Opal_Readback);
+OPAL_DEFINE_HANDLE(Opal_Compactor);
+OPAL_DEFINE_HANDLE(Opal_Graph);
+OPAL_DEFINE_HANDLE(Opal_GraphResource);
+OPAL_DEFINE_HANDLE(Opal_Scheduler);
 
 // Enums
 typedef enum Opal_Result_t
@@ -93,6 +105,20 @@ typedef enum Opal_Result_t
 	OPAL_BUFFER_NONMAPPABLE,
 	OPAL_TEXTURE_FORMAT_NOT_SUPPORTED,
 	OPAL_SHADER_SOURCE_NOT_SUPPORTED,
+	OPAL_INVALID_LAYER,
+	OPAL_INVALID_PROFILER,
+	OPAL_INVALID_PIPELINE_TASK,
+	OPAL_INVALID_UPLOADER,
+	OPAL_INVALID_TRANSIENT_ALLOCATOR,
+	OPAL_INVALID_READBACK,
+	OPAL_INVALID_GRAPH,
+	OPAL_INVALID_SCHEDULER,
+	OPAL_INVALID_COMPACTOR,
+	OPAL_INVALID_SEMAPHORE,
+	OPAL_INVALID_ARGUMENT,
+	OPAL_INVALID_TEXTURE_VIEW,
+	OPAL_INVALID_COMMAND_BUFFER,
+	OPAL_INVALID_SWAPCHAIN,
 
 	// FIXME: add more error codes for internal errors
 	OPAL_INTERNAL_ERROR,
@@ -262,6 +288,16 @@ typedef enum Opal_AccelerationStructureInstanceFlags_t
 	OPAL_ACCELERATION_STRUCTURE_INSTANCE_FLAGS_ENUM_FORCE32 = 0x7FFFFFFF,
 } Opal_AccelerationStructureInstanceFlags;
 
+typedef enum Opal_AccelerationStructureInstanceLayout_t
+{
+	OPAL_ACCELERATION_STRUCTURE_INSTANCE_LAYOUT_NONE = 0,
+	OPAL_ACCELERATION_STRUCTURE_INSTANCE_LAYOUT_ROW_MAJOR,
+	OPAL_ACCELERATION_STRUCTURE_INSTANCE_LAYOUT_COLUMN_MAJOR,
+
+	OPAL_ACCELERATION_STRUCTURE_INSTANCE_LAYOUT_ENUM_MAX,
+	OPAL_ACCELERATION_STRUCTURE_INSTANCE_LAYOUT_ENUM_FORCE32 = 0x7FFFFFFF,
+} Opal_AccelerationStructureInstanceLayout;
+
 typedef enum Opal_AccelerationStructureBuildFlags_t
 {
 	OPAL_ACCELERATION_STRUCTURE_BUILD_FLAGS_NONE = 0x00000000,
@@ -589,6 +625,15 @@ typedef enum Opal_SamplerFilterMode_t
 	OPAL_SAMPLER_FILTER_MODE_ENUM_FORCE32 = 0x7FFFFFFF,
 } Opal_SamplerFilterMode;
 
+typedef enum Opal_TexelFilter_t
+{
+	OPAL_TEXEL_FILTER_BOX = 0,
+	OPAL_TEXEL_FILTER_KAISER,
+
+	OPAL_TEXEL_FILTER_ENUM_MAX,
+	OPAL_TEXEL_FILTER_ENUM_FORCE32 = 0x7FFFFFFF,
+} Opal_TexelFilter;
+
 typedef enum Opal_SamplerAddressMode_t
 {
 	OPAL_SAMPLER_ADDRESS_MODE_REPEAT = 0,
@@ -777,6 +822,25 @@ typedef enum Opal_FrontFace_t {
 	OPAL_FRONT_FACE_ENUM_FORCE32 = 0x7FFFFFFF,
 } Opal_FrontFace;
 
+typedef enum Opal_GraphPassType_t
+{
+	OPAL_GRAPH_PASS_TYPE_GRAPHICS = 0,
+	OPAL_GRAPH_PASS_TYPE_COMPUTE,
+	OPAL_GRAPH_PASS_TYPE_RAYTRACE,
+	OPAL_GRAPH_PASS_TYPE_COPY,
+	OPAL_GRAPH_PASS_TYPE_ACCELERATION_STRUCTURE,
+
+	OPAL_GRAPH_PASS_TYPE_ENUM_MAX,
+	OPAL_GRAPH_PASS_TYPE_ENUM_FORCE32 = 0x7FFFFFFF,
+} Opal_GraphPassType;
+
+typedef enum Opal_GraphPassFlags_t
+{
+	OPAL_GRAPH_PASS_FLAGS_NEVER_CULL = 0x00000001,
+
+	OPAL_GRAPH_PASS_FLAGS_ENUM_FORCE32 = 0x7FFFFFFF,
+} Opal_GraphPassFlags;
+
 // Structs
 typedef struct Opal_DeviceLimits_t
 {
@@ -787,6 +851,8 @@ typedef struct Opal_DeviceLimits_t
 	uint64_t max_buffer_size;
 	uint64_t min_uniform_buffer_offset_alignment;
 	uint64_t min_storage_buffer_offset_alignment;
+	uint32_t min_texture_copy_row_alignment;
+	uint64_t min_texture_copy_offset_alignment;
 	uint32_t max_descriptor_sets;
 	uint64_t max_uniform_buffer_binding_size;
 	uint64_t max_storage_buffer_binding_size;
@@ -804,12 +870,14 @@ typedef struct Opal_DeviceLimits_t
 	uint32_t max_compute_workgroup_local_size_z;
 	uint32_t max_raytrace_recursion_depth;
 	uint32_t max_raytrace_hit_attribute_size;
+	uint64_t min_acceleration_structure_scratch_offset_alignment;
 } Opal_DeviceLimits;
 
 typedef struct Opal_DeviceFeatures_t
 {
 	uint32_t queue_count[OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX];
 	uint32_t acceleration_structure_instance_size;
+	Opal_AccelerationStructureInstanceLayout acceleration_structure_instance_layout;
 	uint8_t tessellation_shader;
 	uint8_t geometry_shader;
 	uint8_t compute_pipeline;
@@ -863,6 +931,16 @@ typedef struct Opal_IndexBufferView_t
 	Opal_IndexFormat format;
 } Opal_IndexBufferView;
 
+struct Opal_InstanceDesc_t;
+
+typedef Opal_Result (*PFN_opalLayerWrapInstance)(void *user_data, Opal_Api api, const struct Opal_InstanceDesc_t *desc, Opal_Instance next_instance, Opal_Instance *instance);
+
+typedef struct Opal_LayerDesc_t
+{
+	PFN_opalLayerWrapInstance wrapInstance;
+	void *user_data;
+} Opal_LayerDesc;
+
 typedef struct Opal_InstanceDesc_t
 {
 	const char *application_name;
@@ -873,14 +951,69 @@ typedef struct Opal_InstanceDesc_t
 	uint32_t max_heap_allocations;
 	uint32_t max_heaps;
 	Opal_InstanceCreationFlags flags;
+	uint32_t num_layers;
+	const Opal_LayerDesc *layers;
 } Opal_InstanceDesc;
 
+typedef struct Opal_ProfilerDesc_t
+{
+	const char *trace_path;
+	uint32_t num_frames;
+} Opal_ProfilerDesc;
+
+typedef struct Opal_UploaderDesc_t
+{
+	uint64_t ring_size;
+	uint32_t num_batches;
+} Opal_UploaderDesc;
+
+typedef struct Opal_TransientAllocatorDesc_t
+{
+	uint64_t frame_size;
+	uint32_t num_frames;
+	Opal_BufferUsageFlags usage;
+} Opal_TransientAllocatorDesc;
+
+typedef struct Opal_TransientAllocation_t
+{
+	Opal_Buffer buffer;
+	uint64_t offset;
+	void *ptr;
+} Opal_TransientAllocation;
+
+typedef void (*PFN_opalReadbackCallback)(void *user_data, const void *data, uint64_t size);
+
+typedef struct Opal_ReadbackDesc_t
+{
+	uint64_t ring_size;
+} Opal_ReadbackDesc;
+
+typedef void (*PFN_opalCompactionCallback)(void *user_data, Opal_AccelerationStructure src, Opal_AccelerationStructure dst);
+
+typedef struct Opal_CompactorDesc_t
+{
+	uint32_t max_pending_sizes;
+	Opal_AccelerationStructureType type;
+} Opal_CompactorDesc;
+
+typedef struct Opal_ProfilerCallStats_t
+{
+	const char *name;
+	uint64_t count;
+	uint64_t total_ns;
+	uint64_t p50_ns;
+	uint64_t p99_ns;
+	uint64_t max_ns;
+} Opal_ProfilerCallStats;
+
 typedef struct Opal_SemaphoreDesc_t
 {
 	uint64_t initial_value;
 	Opal_SemaphoreCreationFlags flags;
 } Opal_SemaphoreDesc;
 
+typedef void (*PFN_opalSemaphoreCallback)(void *user_data, Opal_Semaphore semaphore, uint64_t value);
+
 typedef struct Opal_BufferTransitionDesc_t
 {
 	Opal_Buffer buffer;
@@ -1051,6 +1184,18 @@ typedef struct Opal_TextureRegion_t
 	Opal_Offset3D offset;
 } Opal_TextureRegion;
 
+typedef struct Opal_BufferTextureCopyRegion_t
+{
+	uint64_t buffer_offset;
+	uint32_t row_size;
+	uint32_t num_rows;
+	uint32_t mip;
+	uint32_t base_layer;
+	uint32_t layer_count;
+	Opal_Offset3D texture_offset;
+	Opal_Extent3D size;
+} Opal_BufferTextureCopyRegion;
+
 typedef struct Opal_VertexAttribute_t
 {
 	Opal_VertexFormat format;
@@ -1222,6 +1367,7 @@ typedef struct Opal_AccelerationStructureInstanceBufferBuildDesc_t
 	Opal_BufferView buffer;
 	uint32_t num_instances;
 	const Opal_AccelerationStructureInstance *instances;
+	const uint64_t *blas_addresses;
 } Opal_AccelerationStructureInstanceBufferBuildDesc;
 
 typedef struct Opal_ShaderBindingTableBuildDesc_t
@@ -1351,8 +1497,19 @@ typedef struct Opal_SwapchainDesc_t
 	Opal_TextureUsageFlags usage;
 	Opal_Surface surface;
 	Opal_Queue queue;
+	uint32_t max_frames_in_flight; // 0 means backend default
 } Opal_SwapchainDesc;
 
+// timestamps are cpu monotonic nanoseconds, zero if unknown
+typedef struct Opal_FrameTiming_t
+{
+	uint64_t frame_id;
+	uint64_t acquire_time;
+	uint64_t submit_time;
+	uint64_t present_time;
+	uint64_t display_time;
+} Opal_FrameTiming;
+
 typedef struct Opal_SubmitDesc_t
 {
 	uint32_t num_wait_semaphores;
@@ -1373,10 +1530,69 @@ typedef struct Opal_SubmitDesc_t
 	const Opal_Swapchain *signal_swapchains;
 } Opal_SubmitDesc;
 
+typedef void (*PFN_opalGraphPassCallback)(void *user_data, Opal_Graph graph, Opal_CommandBuffer command_buffer);
+
+typedef struct Opal_GraphBufferAccess_t
+{
+	Opal_GraphResource buffer;
+	Opal_BufferState state;
+	Opal_BarrierStageFlags stages;
+} Opal_GraphBufferAccess;
+
+typedef struct Opal_GraphTextureAccess_t
+{
+	Opal_GraphResource texture;
+	Opal_TextureState state;
+	Opal_BarrierStageFlags stages;
+} Opal_GraphTextureAccess;
+
+typedef struct Opal_GraphAttachment_t
+{
+	Opal_GraphResource texture;
+	Opal_GraphResource resolve_texture;
+	Opal_LoadOp load_op;
+	Opal_StoreOp store_op;
+	Opal_ClearValue clear_value;
+} Opal_GraphAttachment;
+
+typedef struct Opal_GraphPassDesc_t
+{
+	Opal_GraphPassType type;
+	Opal_GraphPassFlags flags;
+	uint32_t num_buffer_accesses;
+	const Opal_GraphBufferAccess *buffer_accesses;
+	uint32_t num_texture_accesses;
+	const Opal_GraphTextureAccess *texture_accesses;
+	uint32_t num_color_attachments;
+	const Opal_GraphAttachment *color_attachments;
+	const Opal_GraphAttachment *depth_stencil_attachment;
+	PFN_opalGraphPassCallback callback;
+	void *user_data;
+} Opal_GraphPassDesc;
+
+typedef struct Opal_ScheduleDesc_t
+{
+	Opal_DeviceEngineType engine_type;
+
+	uint32_t num_dependencies;
+	const Opal_Semaphore *dependency_semaphores;
+	const uint64_t *dependency_values;
+
+	uint32_t num_wait_swapchains;
+	const Opal_Swapchain *wait_swapchains;
+
+	uint32_t num_command_buffers;
+	const Opal_CommandBuffer *command_buffers;
+
+	uint32_t num_signal_swapchains;
+	const Opal_Swapchain *signal_swapchains;
+} Opal_ScheduleDesc;
+
 // Function pointers
 typedef Opal_Result (*PFN_opalEnumerateDevices)(Opal_Instance instance, uint32_t *device_count, Opal_DeviceInfo *infos);
 
 typedef Opal_Result (*PFN_opalCreateSurface)(Opal_Instance instance, void *handle, Opal_Surface *surface);
+typedef Opal_Result (*PFN_opalCreateHeadlessSurface)(Opal_Instance instance, uint32_t width, uint32_t height, Opal_Surface *surface);
 typedef Opal_Result (*PFN_opalCreateDevice)(Opal_Instance instance, uint32_t index, Opal_Device *device);
 typedef Opal_Result (*PFN_opalCreateDefaultDevice)(Opal_Instance instance, Opal_DeviceHint hint, Opal_Device *device);
 
@@ -1386,6 +1602,7 @@ typedef Opal_Result (*PFN_opalDestroyInstance)(Opal_Instance instance);
 typedef Opal_Result (*PFN_opalGetDeviceInfo)(Opal_Device device, Opal_DeviceInfo *info);
 typedef Opal_Result (*PFN_opalGetDeviceQueue)(Opal_Device device, Opal_DeviceEngineType engine_type, uint32_t index, Opal_Queue *queue);
 typedef Opal_Result (*PFN_opalGetAccelerationStructurePrebuildInfo)(Opal_Device device, const Opal_AccelerationStructureBuildDesc *desc, Opal_AccelerationStructurePrebuildInfo *info);
+typedef Opal_Result (*PFN_opalGetAccelerationStructureAddress)(Opal_Device device, Opal_AccelerationStructure acceleration_structure, uint64_t *address);
 typedef Opal_Result (*PFN_opalGetSupportedSurfaceFormats)(Opal_Device device, Opal_Surface surface, uint32_t *num_formats, Opal_SurfaceFormat *formats);
 typedef Opal_Result (*PFN_opalGetSupportedPresentModes)(Opal_Device device, Opal_Surface surface, uint32_t *num_present_modes, Opal_PresentMode *present_modes);
 typedef Opal_Result (*PFN_opalGetPreferredSurfaceFormat)(Opal_Device device, Opal_Surface surface, Opal_SurfaceFormat *format);
@@ -1409,6 +1626,12 @@ typedef Opal_Result (*PFN_opalCreateGraphicsPipeline)(Opal_Device device, const
 typedef Opal_Result (*PFN_opalCreateMeshletPipeline)(Opal_Device device, const Opal_MeshletPipelineDesc *desc, Opal_GraphicsPipeline *pipeline);
 typedef Opal_Result (*PFN_opalCreateComputePipeline)(Opal_Device device, const Opal_ComputePipelineDesc *desc, Opal_ComputePipeline *pipeline);
 typedef Opal_Result (*PFN_opalCreateRaytracePipeline)(Opal_Device device, const Opal_RaytracePipelineDesc *desc, Opal_RaytracePipeline *pipeline);
+typedef Opal_Result (*PFN_opalCreateGraphicsPipelines)(Opal_Device device, uint32_t num_pipelines, const Opal_GraphicsPipelineDesc *descs, Opal_GraphicsPipeline *pipelines);
+typedef Opal_Result (*PFN_opalCreateComputePipelines)(Opal_Device device, uint32_t num_pipelines, const Opal_ComputePipelineDesc *descs, Opal_ComputePipeline *pipelines);
+typedef Opal_Result (*PFN_opalCreateRaytracePipelines)(Opal_Device device, uint32_t num_pipelines, const Opal_RaytracePipelineDesc *descs, Opal_RaytracePipeline *pipelines);
+typedef Opal_Result (*PFN_opalCreateGraphicsPipelinesAsync)(Opal_Device device, uint32_t num_pipelines, const Opal_GraphicsPipelineDesc *descs, Opal_GraphicsPipeline *pipelines, Opal_PipelineTask *task);
+typedef Opal_Result (*PFN_opalCreateComputePipelinesAsync)(Opal_Device device, uint32_t num_pipelines, const Opal_ComputePipelineDesc *descs, Opal_ComputePipeline *pipelines, Opal_PipelineTask *task);
+typedef Opal_Result (*PFN_opalCreateRaytracePipelinesAsync)(Opal_Device device, uint32_t num_pipelines, const Opal_RaytracePipelineDesc *descs, Opal_RaytracePipeline *pipelines, Opal_PipelineTask *task);
 typedef Opal_Result (*PFN_opalCreateSwapchain)(Opal_Device device, const Opal_SwapchainDesc *desc, Opal_Swapchain *swapchain);
 
 typedef Opal_Result (*PFN_opalDestroySemaphore)(Opal_Device device, Opal_Semaphore semaphore);
@@ -1445,11 +1668,16 @@ typedef Opal_Result (*PFN_opalEndCommandBuffer)(Opal_Device device, Opal_Command
 typedef Opal_Result (*PFN_opalQuerySemaphore)(Opal_Device device, Opal_Semaphore semaphore, uint64_t *value);
 typedef Opal_Result (*PFN_opalSignalSemaphore)(Opal_Device device, Opal_Semaphore semaphore, uint64_t value);
 typedef Opal_Result (*PFN_opalWaitSemaphore)(Opal_Device device, Opal_Semaphore semaphore, uint64_t value, uint64_t timeout_milliseconds);
+typedef Opal_Result (*PFN_opalWaitSemaphores)(Opal_Device device, uint32_t num_semaphores, const Opal_Semaphore *semaphores, const uint64_t *values, uint32_t wait_any, uint64_t timeout_milliseconds);
+typedef Opal_Result (*PFN_opalRegisterSemaphoreCallback)(Opal_Device device, Opal_Semaphore semaphore, uint64_t value, PFN_opalSemaphoreCallback callback, void *user_data);
+typedef Opal_Result (*PFN_opalWaitPipelineTask)(Opal_Device device, Opal_PipelineTask task, uint64_t timeout_milliseconds);
 typedef Opal_Result (*PFN_opalWaitQueue)(Opal_Device device, Opal_Queue queue);
 typedef Opal_Result (*PFN_opalWaitIdle)(Opal_Device device);
 typedef Opal_Result (*PFN_opalSubmit)(Opal_Device device, Opal_Queue queue, const Opal_SubmitDesc *desc);
 typedef Opal_Result (*PFN_opalAcquire)(Opal_Device device, Opal_Swapchain swapchain, Opal_TextureView *texture_view);
 typedef Opal_Result (*PFN_opalPresent)(Opal_Device device, Opal_Swapchain swapchain);
+typedef Opal_Result (*PFN_opalWaitPresent)(Opal_Device device, Opal_Swapchain swapchain, uint64_t frame_id, uint64_t timeout_milliseconds);
+typedef Opal_Result (*PFN_opalGetSwapchainFrameTiming)(Opal_Device device, Opal_Swapchain swapchain, Opal_FrameTiming *timing);
 
 typedef Opal_Result (*PFN_opalCmdSetDescriptorHeap)(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_DescriptorHeap descriptor_heap);
 
@@ -1487,12 +1715,21 @@ typedef Opal_Result (*PFN_opalCmdBeginCopyPass)(Opal_Device device, Opal_Command
 typedef Opal_Result (*PFN_opalCmdCopyBufferToBuffer)(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_Buffer src_buffer, uint64_t src_offset, Opal_Buffer dst_buffer, uint64_t dst_offset, uint64_t size);
 typedef Opal_Result (*PFN_opalCmdCopyBufferToTexture)(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_BufferTextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size);
 typedef Opal_Result (*PFN_opalCmdCopyTextureToBuffer)(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_BufferTextureRegion dst, Opal_Extent3D size);
+typedef Opal_Result (*PFN_opalCmdCopyBufferToTextureRegions)(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_Buffer src_buffer, Opal_Texture dst_texture, uint32_t num_regions, const Opal_BufferTextureCopyRegion *regions);
+typedef Opal_Result (*PFN_opalCmdCopyTextureToBufferRegions)(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_Texture src_texture, Opal_Buffer dst_buffer, uint32_t num_regions, const Opal_BufferTextureCopyRegion *regions);
 typedef Opal_Result (*PFN_opalCmdCopyTextureToTexture)(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size);
+typedef Opal_Result (*PFN_opalCmdFillBuffer)(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_Buffer buffer, uint64_t offset, uint64_t size, uint32_t value);
+typedef Opal_Result (*PFN_opalCmdUpdateBuffer)(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_Buffer buffer, uint64_t offset, uint64_t size, const void *data);
+typedef Opal_Result (*PFN_opalCmdClearTexture)(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_TextureView texture_view, Opal_ClearValue clear_value);
+typedef Opal_Result (*PFN_opalCmdBlitTexture)(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_Extent3D src_size, Opal_TextureRegion dst, Opal_Extent3D dst_size, Opal_SamplerFilterMode filter);
+typedef Opal_Result (*PFN_opalCmdGenerateMips)(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_TextureView texture_view);
 typedef Opal_Result (*PFN_opalCmdEndCopyPass)(Opal_Device device, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers);
 
 typedef Opal_Result (*PFN_opalCmdBeginAccelerationStructurePass)(Opal_Device device, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers);
 typedef Opal_Result (*PFN_opalCmdAccelerationStructureBuild)(Opal_Device device, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureBuildDesc *desc);
+typedef Opal_Result (*PFN_opalCmdAccelerationStructureBuildBatch)(Opal_Device device, Opal_CommandBuffer command_buffer, uint32_t num_descs, const Opal_AccelerationStructureBuildDesc *descs);
 typedef Opal_Result (*PFN_opalCmdAccelerationStructureCopy)(Opal_Device device, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureCopyDesc *desc);
+typedef Opal_Result (*PFN_opalCmdAccelerationStructureWriteCompactedSizes)(Opal_Device device, Opal_CommandBuffer command_buffer, uint32_t num_acceleration_structures, const Opal_AccelerationStructure *acceleration_structures, Opal_BufferView dst);
 typedef Opal_Result (*PFN_opalCmdEndAccelerationStructurePass)(Opal_Device device, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers);
 
 typedef struct Opal_InstanceTable_t
@@ -1500,6 +1737,7 @@ typedef struct Opal_InstanceTable_t
 	PFN_opalEnumerateDevices enumerateDevices;
 
 	PFN_opalCreateSurface createSurface;
+	PFN_opalCreateHeadlessSurface createHeadlessSurface;
 	PFN_opalCreateDevice createDevice;
 	PFN_opalCreateDefaultDevice createDefaultDevice;
 
@@ -1512,6 +1750,7 @@ typedef struct Opal_DeviceTable_t
 	PFN_opalGetDeviceInfo getDeviceInfo;
 	PFN_opalGetDeviceQueue getDeviceQueue;
 	PFN_opalGetAccelerationStructurePrebuildInfo getAccelerationStructurePrebuildInfo;
+	PFN_opalGetAccelerationStructureAddress getAccelerationStructureAddress;
 	PFN_opalGetSupportedSurfaceFormats getSupportedSurfaceFormats;
 	PFN_opalGetSupportedPresentModes getSupportedPresentModes;
 	PFN_opalGetPreferredSurfaceFormat getPreferredSurfaceFormat;
@@ -1535,6 +1774,12 @@ typedef struct Opal_DeviceTable_t
 	PFN_opalCreateMeshletPipeline createMeshletPipeline;
 	PFN_opalCreateComputePipeline createComputePipeline;
 	PFN_opalCreateRaytracePipeline createRaytracePipeline;
+	PFN_opalCreateGraphicsPipelines createGraphicsPipelines;
+	PFN_opalCreateComputePipelines createComputePipelines;
+	PFN_opalCreateRaytracePipelines createRaytracePipelines;
+	PFN_opalCreateGraphicsPipelinesAsync createGraphicsPipelinesAsync;
+	PFN_opalCreateComputePipelinesAsync createComputePipelinesAsync;
+	PFN_opalCreateRaytracePipelinesAsync createRaytracePipelinesAsync;
 	PFN_opalCreateSwapchain createSwapchain;
 
 	PFN_opalDestroySemaphore destroySemaphore;
@@ -1571,11 +1816,16 @@ typedef struct Opal_DeviceTable_t
 	PFN_opalQuerySemaphore querySemaphore;
 	PFN_opalSignalSemaphore signalSemaphore;
 	PFN_opalWaitSemaphore waitSemaphore;
+	PFN_opalWaitSemaphores waitSemaphores;
+	PFN_opalRegisterSemaphoreCallback registerSemaphoreCallback;
+	PFN_opalWaitPipelineTask waitPipelineTask;
 	PFN_opalWaitQueue waitQueue;
 	PFN_opalWaitIdle waitIdle;
 	PFN_opalSubmit submit;
 	PFN_opalAcquire acquire;
 	PFN_opalPresent present;
+	PFN_opalWaitPresent waitPresent;
+	PFN_opalGetSwapchainFrameTiming getSwapchainFrameTiming;
 
 	PFN_opalCmdSetDescriptorHeap cmdSetDescriptorHeap;
 
@@ -1613,12 +1863,21 @@ typedef struct Opal_DeviceTable_t
 	PFN_opalCmdCopyBufferToBuffer cmdCopyBufferToBuffer;
 	PFN_opalCmdCopyBufferToTexture cmdCopyBufferToTexture;
 	PFN_opalCmdCopyTextureToBuffer cmdCopyTextureToBuffer;
+	PFN_opalCmdCopyBufferToTextureRegions cmdCopyBufferToTextureRegions;
+	PFN_opalCmdCopyTextureToBufferRegions cmdCopyTextureToBufferRegions;
 	PFN_opalCmdCopyTextureToTexture cmdCopyTextureToTexture;
+	PFN_opalCmdFillBuffer cmdFillBuffer;
+	PFN_opalCmdUpdateBuffer cmdUpdateBuffer;
+	PFN_opalCmdClearTexture cmdClearTexture;
+	PFN_opalCmdBlitTexture cmdBlitTexture;
+	PFN_opalCmdGenerateMips cmdGenerateMips;
 	PFN_opalCmdEndCopyPass cmdEndCopyPass;
 
 	PFN_opalCmdBeginAccelerationStructurePass cmdBeginAccelerationStructurePass;
 	PFN_opalCmdAccelerationStructureBuild cmdAccelerationStructureBuild;
+	PFN_opalCmdAccelerationStructureBuildBatch cmdAccelerationStructureBuildBatch;
 	PFN_opalCmdAccelerationStructureCopy cmdAccelerationStructureCopy;
+	PFN_opalCmdAccelerationStructureWriteCompactedSizes cmdAccelerationStructureWriteCompactedSizes;
 	PFN_opalCmdEndAccelerationStructurePass cmdEndAccelerationStructurePass;
 } Opal_DeviceTable;
 
@@ -1627,10 +1886,75 @@ typedef struct Opal_DeviceTable_t
 OPAL_APIENTRY Opal_Result opalCreateInstance(Opal_Api api, const Opal_InstanceDesc *desc, Opal_Instance *instance);
 OPAL_APIENTRY Opal_Result opalGetInstanceTable(Opal_Instance instance, Opal_InstanceTable *instance_table);
 OPAL_APIENTRY Opal_Result opalGetDeviceTable(Opal_Device device, Opal_DeviceTable *device_table);
+OPAL_APIENTRY Opal_Result opalGetCaptureLayer(const char *path, Opal_LayerDesc *layer);
+OPAL_APIENTRY Opal_Result opalGetStateTrackingLayer(Opal_LayerDesc *layer);
+OPAL_APIENTRY Opal_Result opalGetTextureCopyLayout(const Opal_TextureDesc *desc, uint32_t row_alignment, uint64_t offset_alignment, uint32_t *num_regions, Opal_BufferTextureCopyRegion *regions, uint64_t *size);
+
+// host side texel helpers for staging data, packed formats use 4 floats per texel
+OPAL_APIENTRY Opal_Result opalTexelSwizzleRB(void *dst, const void *src, uint32_t num_texels);
+OPAL_APIENTRY Opal_Result opalTexelSrgbToLinear(float *dst, const uint8_t *src, uint32_t num_values);
+OPAL_APIENTRY Opal_Result opalTexelLinearToSrgb(uint8_t *dst, const float *src, uint32_t num_values);
+OPAL_APIENTRY Opal_Result opalTexelFloatToHalf(uint16_t *dst, const float *src, uint32_t num_values);
+OPAL_APIENTRY Opal_Result opalTexelHalfToFloat(float *dst, const uint16_t *src, uint32_t num_values);
+OPAL_APIENTRY Opal_Result opalTexelPackRG11B10(uint32_t *dst, const float *src, uint32_t num_texels);
+OPAL_APIENTRY Opal_Result opalTexelUnpackRG11B10(float *dst, const uint32_t *src, uint32_t num_texels);
+OPAL_APIENTRY Opal_Result opalTexelPackRGB9E5(uint32_t *dst, const float *src, uint32_t num_texels);
+OPAL_APIENTRY Opal_Result opalTexelUnpackRGB9E5(float *dst, const uint32_t *src, uint32_t num_texels);
+OPAL_APIENTRY Opal_Result opalTexelDownsample(Opal_TextureFormat format, Opal_TexelFilter filter, uint32_t src_width, uint32_t src_height, uint32_t src_row_size, const void *src, uint32_t dst_row_size, void *dst);
+
+OPAL_APIENTRY Opal_Result opalCreateProfiler(const Opal_ProfilerDesc *desc, Opal_Profiler *profiler);
+OPAL_APIENTRY Opal_Result opalGetProfilerLayer(Opal_Profiler profiler, Opal_LayerDesc *layer);
+OPAL_APIENTRY Opal_Result opalGetProfilerStats(Opal_Profiler profiler, uint32_t *num_stats, Opal_ProfilerCallStats *stats);
+OPAL_APIENTRY Opal_Result opalResetProfilerStats(Opal_Profiler profiler);
+OPAL_APIENTRY Opal_Result opalWriteProfilerFrames(Opal_Profiler profiler, const char *path);
+OPAL_APIENTRY Opal_Result opalDestroyProfiler(Opal_Profiler profiler);
+
+OPAL_APIENTRY Opal_Result opalCreateUploader(Opal_Device device, const Opal_UploaderDesc *desc, Opal_Uploader *uploader);
+OPAL_APIENTRY Opal_Result opalUploadBuffer(Opal_Uploader uploader, Opal_Buffer buffer, uint64_t offset, const void *data, uint64_t size);
+OPAL_APIENTRY Opal_Result opalUploadTexture(Opal_Uploader uploader, Opal_TextureRegion dst, Opal_Extent3D size, const void *data, uint32_t row_size, uint32_t num_rows);
+OPAL_APIENTRY Opal_Result opalFlushUploads(Opal_Uploader uploader, Opal_Semaphore *semaphore, uint64_t *value);
+OPAL_APIENTRY Opal_Result opalDestroyUploader(Opal_Uploader uploader);
+
+OPAL_APIENTRY Opal_Result opalCreateTransientAllocator(Opal_Device device, const Opal_TransientAllocatorDesc *desc, Opal_TransientAllocator *allocator);
+OPAL_APIENTRY Opal_Result opalGetTransientBuffer(Opal_TransientAllocator allocator, Opal_Buffer *buffer);
+OPAL_APIENTRY Opal_Result opalAllocateTransient(Opal_TransientAllocator allocator, uint64_t size, uint64_t alignment, Opal_TransientAllocation *allocation);
+OPAL_APIENTRY Opal_Result opalEndTransientFrame(Opal_TransientAllocator allocator, Opal_Semaphore semaphore, uint64_t value);
+OPAL_APIENTRY Opal_Result opalDestroyTransientAllocator(Opal_TransientAllocator allocator);
+
+OPAL_APIENTRY Opal_Result opalCreateReadback(Opal_Device device, const Opal_ReadbackDesc *desc, Opal_Readback *readback);
+OPAL_APIENTRY Opal_Result opalReadbackAsync(Opal_Readback readback, Opal_CommandBuffer command_buffer, Opal_Buffer buffer, uint64_t offset, uint64_t size, PFN_opalReadbackCallback callback, void *user_data);
+OPAL_APIENTRY Opal_Result opalReadbackTextureAsync(Opal_Readback readback, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_Extent3D size, uint32_t row_size, uint32_t num_rows, PFN_opalReadbackCallback callback, void *user_data);
+OPAL_APIENTRY Opal_Result opalFlushReadbacks(Opal_Readback readback, Opal_Semaphore semaphore, uint64_t value);
+OPAL_APIENTRY Opal_Result opalPollReadbacks(Opal_Readback readback);
+OPAL_APIENTRY Opal_Result opalDestroyReadback(Opal_Readback readback);
+
+OPAL_APIENTRY Opal_Result opalCreateCompactor(Opal_Device device, const Opal_CompactorDesc *desc, Opal_Compactor *compactor);
+OPAL_APIENTRY Opal_Result opalCompactAccelerationStructures(Opal_Compactor compactor, Opal_CommandBuffer command_buffer, uint32_t num_acceleration_structures, const Opal_AccelerationStructure *acceleration_structures, PFN_opalCompactionCallback callback, void *user_data);
+OPAL_APIENTRY Opal_Result opalFlushCompactions(Opal_Compactor compactor, Opal_Semaphore semaphore, uint64_t value);
+OPAL_APIENTRY Opal_Result opalPollCompactions(Opal_Compactor compactor, Opal_CommandBuffer command_buffer);
+OPAL_APIENTRY Opal_Result opalDestroyCompactor(Opal_Compactor compactor);
+
+OPAL_APIENTRY Opal_Result opalCreateGraph(Opal_Device device, Opal_Graph *graph);
+OPAL_APIENTRY Opal_Result opalResetGraph(Opal_Graph graph);
+OPAL_APIENTRY Opal_Result opalImportGraphBuffer(Opal_Graph graph, Opal_Buffer buffer, Opal_BufferState initial_state, Opal_BufferState final_state, Opal_GraphResource *resource);
+OPAL_APIENTRY Opal_Result opalImportGraphTexture(Opal_Graph graph, Opal_TextureView texture_view, Opal_TextureState initial_state, Opal_TextureState final_state, Opal_GraphResource *resource);
+OPAL_APIENTRY Opal_Result opalCreateGraphBuffer(Opal_Graph graph, const Opal_BufferDesc *desc, Opal_GraphResource *resource);
+OPAL_APIENTRY Opal_Result opalCreateGraphTexture(Opal_Graph graph, const Opal_TextureDesc *desc, Opal_GraphResource *resource);
+OPAL_APIENTRY Opal_Result opalAddGraphPass(Opal_Graph graph, const Opal_GraphPassDesc *desc);
+OPAL_APIENTRY Opal_Result opalGetGraphBuffer(Opal_Graph graph, Opal_GraphResource resource, Opal_Buffer *buffer);
+OPAL_APIENTRY Opal_Result opalGetGraphTextureView(Opal_Graph graph, Opal_GraphResource resource, Opal_TextureView *texture_view);
+OPAL_APIENTRY Opal_Result opalExecuteGraph(Opal_Graph graph, Opal_CommandBuffer command_buffer);
+OPAL_APIENTRY Opal_Result opalDestroyGraph(Opal_Graph graph);
+
+OPAL_APIENTRY Opal_Result opalCreateScheduler(Opal_Device device, Opal_Scheduler *scheduler);
+OPAL_APIENTRY Opal_Result opalGetSchedulerQueue(Opal_Scheduler scheduler, Opal_DeviceEngineType engine_type, Opal_Queue *queue);
+OPAL_APIENTRY Opal_Result opalSchedule(Opal_Scheduler scheduler, const Opal_ScheduleDesc *desc, Opal_Semaphore *semaphore, uint64_t *value);
+OPAL_APIENTRY Opal_Result opalDestroyScheduler(Opal_Scheduler scheduler);
 
 OPAL_APIENTRY Opal_Result opalEnumerateDevices(Opal_Instance instance, uint32_t *device_count, Opal_DeviceInfo *infos);
 
 OPAL_APIENTRY Opal_Result opalCreateSurface(Opal_Instance instance, void *handle, Opal_Surface *surface);
+OPAL_APIENTRY Opal_Result opalCreateHeadlessSurface(Opal_Instance instance, uint32_t width, uint32_t height, Opal_Surface *surface);
 OPAL_APIENTRY Opal_Result opalCreateDevice(Opal_Instance instance, uint32_t index, Opal_Device *device);
 OPAL_APIENTRY Opal_Result opalCreateDefaultDevice(Opal_Instance instance, Opal_DeviceHint hint, Opal_Device *device);
 
@@ -1640,6 +1964,7 @@ OPAL_APIENTRY Opal_Result opalDestroyInstance(Opal_Instance instance);
 OPAL_APIENTRY Opal_Result opalGetDeviceInfo(Opal_Device device, Opal_DeviceInfo *info);
 OPAL_APIENTRY Opal_Result opalGetDeviceQueue(Opal_Device device, Opal_DeviceEngineType engine_type, uint32_t index, Opal_Queue *queue);
 OPAL_APIENTRY Opal_Result opalGetAccelerationStructurePrebuildInfo(Opal_Device device, const Opal_AccelerationStructureBuildDesc *desc, Opal_AccelerationStructurePrebuildInfo *info);
+OPAL_APIENTRY Opal_Result opalGetAccelerationStructureAddress(Opal_Device device, Opal_AccelerationStructure acceleration_structure, uint64_t *address);
 OPAL_APIENTRY Opal_Result opalGetSupportedSurfaceFormats(Opal_Device device, Opal_Surface surface, uint32_t *num_formats, Opal_SurfaceFormat *formats);
 OPAL_APIENTRY Opal_Result opalGetSupportedPresentModes(Opal_Device device, Opal_Surface surface, uint32_t *num_present_modes, Opal_PresentMode *present_modes);
 OPAL_APIENTRY Opal_Result opalGetPreferredSurfaceFormat(Opal_Device device, Opal_Surface surface, Opal_SurfaceFormat *format);
@@ -1663,6 +1988,12 @@ OPAL_APIENTRY Opal_Result opalCreateGraphicsPipeline(Opal_Device device, const O
 OPAL_APIENTRY Opal_Result opalCreateMeshletPipeline(Opal_Device device, const Opal_MeshletPipelineDesc *desc, Opal_GraphicsPipeline *pipeline);
 OPAL_APIENTRY Opal_Result opalCreateComputePipeline(Opal_Device device, const Opal_ComputePipelineDesc *desc, Opal_ComputePipeline *pipeline);
 OPAL_APIENTRY Opal_Result opalCreateRaytracePipeline(Opal_Device device, const Opal_RaytracePipelineDesc *desc, Opal_RaytracePipeline *pipeline);
+OPAL_APIENTRY Opal_Result opalCreateGraphicsPipelines(Opal_Device device, uint32_t num_pipelines, const Opal_GraphicsPipelineDesc *descs, Opal_GraphicsPipeline *pipelines);
+OPAL_APIENTRY Opal_Result opalCreateComputePipelines(Opal_Device device, uint32_t num_pipelines, const Opal_ComputePipelineDesc *descs, Opal_ComputePipeline *pipelines);
+OPAL_APIENTRY Opal_Result opalCreateRaytracePipelines(Opal_Device device, uint32_t num_pipelines, const Opal_RaytracePipelineDesc *descs, Opal_RaytracePipeline *pipelines);
+OPAL_APIENTRY Opal_Result opalCreateGraphicsPipelinesAsync(Opal_Device device, uint32_t num_pipelines, const Opal_GraphicsPipelineDesc *descs, Opal_GraphicsPipeline *pipelines, Opal_PipelineTask *task);
+OPAL_APIENTRY Opal_Result opalCreateComputePipelinesAsync(Opal_Device device, uint32_t num_pipelines, const Opal_ComputePipelineDesc *descs, Opal_ComputePipeline *pipelines, Opal_PipelineTask *task);
+OPAL_APIENTRY Opal_Result opalCreateRaytracePipelinesAsync(Opal_Device device, uint32_t num_pipelines, const Opal_RaytracePipelineDesc *descs, Opal_RaytracePipeline *pipelines, Opal_PipelineTask *task);
 OPAL_APIENTRY Opal_Result opalCreateSwapchain(Opal_Device device, const Opal_SwapchainDesc *desc, Opal_Swapchain *swapchain);
 
 OPAL_APIENTRY Opal_Result opalDestroySemaphore(Opal_Device device, Opal_Semaphore semaphore);
@@ -1699,11 +2030,16 @@ OPAL_APIENTRY Opal_Result opalEndCommandBuffer(Opal_Device device, Opal_CommandB
 OPAL_APIENTRY Opal_Result opalQuerySemaphore(Opal_Device device, Opal_Semaphore semaphore, uint64_t *value);
 OPAL_APIENTRY Opal_Result opalSignalSemaphore(Opal_Device device, Opal_Semaphore semaphore, uint64_t value);
 OPAL_APIENTRY Opal_Result opalWaitSemaphore(Opal_Device device, Opal_Semaphore semaphore, uint64_t value, uint64_t timeout_milliseconds);
+OPAL_APIENTRY Opal_Result opalWaitSemaphores(Opal_Device device, uint32_t num_semaphores, const Opal_Semaphore *semaphores, const uint64_t *values, uint32_t wait_any, uint64_t timeout_milliseconds);
+OPAL_APIENTRY Opal_Result opalRegisterSemaphoreCallback(Opal_Device device, Opal_Semaphore semaphore, uint64_t value, PFN_opalSemaphoreCallback callback, void *user_data);
+OPAL_APIENTRY Opal_Result opalWaitPipelineTask(Opal_Device device, Opal_PipelineTask task, uint64_t timeout_milliseconds);
 OPAL_APIENTRY Opal_Result opalWaitQueue(Opal_Device device, Opal_Queue queue);
 OPAL_APIENTRY Opal_Result opalWaitIdle(Opal_Device device);
 OPAL_APIENTRY Opal_Result opalSubmit(Opal_Device device, Opal_Queue queue, const Opal_SubmitDesc *desc);
 OPAL_APIENTRY Opal_Result opalAcquire(Opal_Device device, Opal_Swapchain swapchain, Opal_TextureView *texture_view);
 OPAL_APIENTRY Opal_Result opalPresent(Opal_Device device, Opal_Swapchain swapchain);
+OPAL_APIENTRY Opal_Result opalWaitPresent(Opal_Device device, Opal_Swapchain swapchain, uint64_t frame_id, uint64_t timeout_milliseconds);
+OPAL_APIENTRY Opal_Result opalGetSwapchainFrameTiming(Opal_Device device, Opal_Swapchain swapchain, Opal_FrameTiming *timing);
 
 OPAL_APIENTRY Opal_Result opalCmdSetDescriptorHeap(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_DescriptorHeap descriptor_heap);
 
@@ -1741,12 +2077,23 @@ OPAL_APIENTRY Opal_Result opalCmdBeginCopyPass(Opal_Device device, Opal_CommandB
 OPAL_APIENTRY Opal_Result opalCmdCopyBufferToBuffer(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_Buffer src_buffer, uint64_t src_offset, Opal_Buffer dst_buffer, uint64_t dst_offset, uint64_t size);
 OPAL_APIENTRY Opal_Result opalCmdCopyBufferToTexture(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_BufferTextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size);
 OPAL_APIENTRY Opal_Result opalCmdCopyTextureToBuffer(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_BufferTextureRegion dst, Opal_Extent3D size);
+OPAL_APIENTRY Opal_Result opalCmdCopyBufferToTextureRegions(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_Buffer src_buffer, Opal_Texture dst_texture, uint32_t num_regions, const Opal_BufferTextureCopyRegion *regions);
+OPAL_APIENTRY Opal_Result opalCmdCopyTextureToBufferRegions(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_Texture src_texture, Opal_Buffer dst_buffer, uint32_t num_regions, const Opal_BufferTextureCopyRegion *regions);
 OPAL_APIENTRY Opal_Result opalCmdCopyTextureToTexture(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size);
+OPAL_APIENTRY Opal_Result opalCmdFillBuffer(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_Buffer buffer, uint64_t offset, uint64_t size, uint32_t value);
+OPAL_APIENTRY Opal_Result opalCmdUpdateBuffer(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_Buffer buffer, uint64_t offset, uint64_t size, const void *data);
+// texture clears need a command buffer from the main engine, copy engines return OPAL_NOT_SUPPORTED
+OPAL_APIENTRY Opal_Result opalCmdClearTexture(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_TextureView texture_view, Opal_ClearValue clear_value);
+// blits and mip generation need a command buffer from the main engine, directx 12, metal and webgpu only blit unscaled with nearest filtering
+OPAL_APIENTRY Opal_Result opalCmdBlitTexture(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_Extent3D src_size, Opal_TextureRegion dst, Opal_Extent3D dst_size, Opal_SamplerFilterMode filter);
+OPAL_APIENTRY Opal_Result opalCmdGenerateMips(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_TextureView texture_view);
 OPAL_APIENTRY Opal_Result opalCmdEndCopyPass(Opal_Device device, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers);
 
 OPAL_APIENTRY Opal_Result opalCmdBeginAccelerationStructurePass(Opal_Device device, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers);
 OPAL_APIENTRY Opal_Result opalCmdAccelerationStructureBuild(Opal_Device device, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureBuildDesc *desc);
+OPAL_APIENTRY Opal_Result opalCmdAccelerationStructureBuildBatch(Opal_Device device, Opal_CommandBuffer command_buffer, uint32_t num_descs, const Opal_AccelerationStructureBuildDesc *descs);
 OPAL_APIENTRY Opal_Result opalCmdAccelerationStructureCopy(Opal_Device device, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureCopyDesc *desc);
+OPAL_APIENTRY Opal_Result opalCmdAccelerationStructureWriteCompactedSizes(Opal_Device device, Opal_CommandBuffer command_buffer, uint32_t num_acceleration_structures, const Opal_AccelerationStructure *acceleration_structures, Opal_BufferView dst);
 OPAL_APIENTRY Opal_Result opalCmdEndAccelerationStructurePass(Opal_Device device, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers);
 #endif
 
@@ -0,0 +1,1798 @@
+#include "capture_codec.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ */
+static const char *call_names[CAPTURE_CALL_ENUM_MAX] =
+{
+	"opalCreateInstance",
+
+	"opalEnumerateDevices",
+	"opalCreateSurface",
+	"opalCreateDevice",
+	"opalCreateDefaultDevice",
+	"opalDestroySurface",
+	"opalDestroyInstance",
+
+	"opalGetDeviceInfo",
+	"opalGetDeviceQueue",
+	"opalGetAccelerationStructurePrebuildInfo",
+	"opalGetSupportedSurfaceFormats",
+	"opalGetSupportedPresentModes",
+	"opalGetPreferredSurfaceFormat",
+	"opalGetPreferredSurfacePresentMode",
+
+	"opalCreateSemaphore",
+	"opalCreateFence",
+	"opalCreateBuffer",
+	"opalCreateTexture",
+	"opalCreateTextureView",
+	"opalCreateSampler",
+	"opalCreateAccelerationStructure",
+	"opalCreateShaderBindingTable",
+	"opalCreateCommandAllocator",
+	"opalCreateCommandBuffer",
+	"opalCreateShader",
+	"opalCreateDescriptorHeap",
+	"opalCreateDescriptorSetLayout",
+	"opalCreatePipelineLayout",
+	"opalCreateGraphicsPipeline",
+	"opalCreateMeshletPipeline",
+	"opalCreateComputePipeline",
+	"opalCreateRaytracePipeline",
+	"opalCreateSwapchain",
+
+	"opalDestroySemaphore",
+	"opalDestroyFence",
+	"opalDestroyBuffer",
+	"opalDestroyTexture",
+	"opalDestroyTextureView",
+	"opalDestroySampler",
+	"opalDestroyAccelerationStructure",
+	"opalDestroyShaderBindingTable",
+	"opalDestroyCommandAllocator",
+	"opalDestroyCommandBuffer",
+	"opalDestroyShader",
+	"opalDestroyDescriptorHeap",
+	"opalDestroyDescriptorSetLayout",
+	"opalDestroyPipelineLayout",
+	"opalDestroyGraphicsPipeline",
+	"opalDestroyComputePipeline",
+	"opalDestroyRaytracePipeline",
+	"opalDestroySwapchain",
+	"opalDestroyDevice",
+
+	"opalBuildShaderBindingTable",
+	"opalBuildAccelerationStructureInstanceBuffer",
+	"opalResetCommandAllocator",
+	"opalAllocateDescriptorSet",
+	"opalFreeDescriptorSet",
+	"opalMapBuffer",
+	"opalUnmapBuffer",
+	"opalWriteBuffer",
+	"opalUpdateDescriptorSet",
+	"opalBeginCommandBuffer",
+	"opalEndCommandBuffer",
+	"opalQuerySemaphore",
+	"opalSignalSemaphore",
+	"opalWaitSemaphore",
+	"opalWaitQueue",
+	"opalWaitIdle",
+	"opalSubmit",
+	"opalAcquire",
+	"opalPresent",
+
+	"opalCmdSetDescriptorHeap",
+
+	"opalCmdBeginGraphicsPass",
+	"opalCmdGraphicsSetPipelineLayout",
+	"opalCmdGraphicsSetPipeline",
+	"opalCmdGraphicsSetDescriptorSet",
+	"opalCmdGraphicsSetVertexBuffers",
+	"opalCmdGraphicsSetIndexBuffer",
+	"opalCmdGraphicsSetViewport",
+	"opalCmdGraphicsSetScissor",
+	"opalCmdGraphicsDraw",
+	"opalCmdGraphicsDrawIndexed",
+	"opalCmdGraphicsMeshletDispatch",
+	"opalCmdEndGraphicsPass",
+
+	"opalCmdBeginComputePass",
+	"opalCmdComputeSetPipelineLayout",
+	"opalCmdComputeSetPipeline",
+	"opalCmdComputeSetDescriptorSet",
+	"opalCmdComputeMemoryBarrier",
+	"opalCmdComputeDispatch",
+	"opalCmdEndComputePass",
+
+	"opalCmdBeginRaytracePass",
+	"opalCmdRaytraceSetPipelineLayout",
+	"opalCmdRaytraceSetPipeline",
+	"opalCmdRaytraceSetDescriptorSet",
+	"opalCmdRaytraceSetShaderBindingTable",
+	"opalCmdRaytraceMemoryBarrier",
+	"opalCmdRaytraceDispatch",
+	"opalCmdEndRaytracePass",
+
+	"opalCmdBeginCopyPass",
+	"opalCmdCopyBufferToBuffer",
+	"opalCmdCopyBufferToTexture",
+	"opalCmdCopyTextureToBuffer",
+	"opalCmdCopyTextureToTexture",
+	"opalCmdEndCopyPass",
+
+	"opalCmdBeginAccelerationStructurePass",
+	"opalCmdAccelerationStructureBuild",
+	"opalCmdAccelerationStructureCopy",
+	"opalCmdEndAccelerationStructurePass",
+
+	"<buffer data>",
+
+	"opalCreateGraphicsPipelines",
+	"opalCreateComputePipelines",
+	"opalCreateRaytracePipelines",
+	"opalCreateGraphicsPipelinesAsync",
+	"opalCreateComputePipelinesAsync",
+	"opalCreateRaytracePipelinesAsync",
+	"opalWaitPipelineTask",
+	"opalWaitSemaphores",
+	"opalRegisterSemaphoreCallback",
+	"opalCmdAccelerationStructureBuildBatch",
+	"opalCmdAccelerationStructureWriteCompactedSizes",
+	"opalGetAccelerationStructureAddress",
+	"opalCmdCopyBufferToTextureRegions",
+	"opalCmdCopyTextureToBufferRegions",
+	"opalCmdFillBuffer",
+	"opalCmdUpdateBuffer",
+	"opalCmdClearTexture",
+	"opalCmdBlitTexture",
+	"opalCmdGenerateMips",
+	"opalWaitPresent",
+	"opalGetSwapchainFrameTiming",
+	"opalCreateHeadlessSurface",
+};
+
+/*
+ */
+static void capture_bytes(Capture_Stream *stream, void *data, uint32_t size)
+{
+	assert(stream);
+
+	if (size == 0)
+		return;
+
+	assert(data);
+
+	if (stream->mode == CAPTURE_STREAM_MODE_WRITE)
+	{
+		uint32_t offset = opal_bumpAlloc(&stream->record, size);
+		memcpy(stream->record.data + offset, data, size);
+		return;
+	}
+
+	if (stream->offset + size > stream->record.size)
+	{
+		stream->overflow = 1;
+		memset(data, 0, size);
+		return;
+	}
+
+	memcpy(data, stream->record.data + stream->offset, size);
+	stream->offset += size;
+}
+
+static const void *capture_view(Capture_Stream *stream, uint32_t size)
+{
+	assert(stream);
+	assert(stream->mode == CAPTURE_STREAM_MODE_READ);
+
+	if (stream->offset + size > stream->record.size)
+	{
+		stream->overflow = 1;
+		return NULL;
+	}
+
+	const void *result = stream->record.data + stream->offset;
+	stream->offset += size;
+
+	return result;
+}
+
+static void *capture_allocate(Capture_Stream *stream, uint32_t size)
+{
+	assert(stream);
+
+	if (stream->num_allocations == stream->allocations_capacity)
+	{
+		stream->allocations_capacity = (stream->allocations_capacity == 0) ? 16 : stream->allocations_capacity * 2;
+		stream->allocations = (void **)realloc(stream->allocations, sizeof(void *) * stream->allocations_capacity);
+	}
+
+	void *ptr = calloc(1, size);
+	stream->allocations[stream->num_allocations++] = ptr;
+
+	return ptr;
+}
+
+static void capture_releaseAllocations(Capture_Stream *stream)
+{
+	assert(stream);
+
+	for (uint32_t i = 0; i < stream->num_allocations; ++i)
+		free(stream->allocations[i]);
+
+	stream->num_allocations = 0;
+}
+
+/*
+ */
+Opal_Result capture_streamOpenWrite(Capture_Stream *stream, const char *path, Opal_Api api)
+{
+	assert(stream);
+	assert(path);
+
+	memset(stream, 0, sizeof(Capture_Stream));
+
+	FILE *file = fopen(path, "wb");
+	if (file == NULL)
+		return OPAL_INVALID_OUTPUT_ARGUMENT;
+
+	Capture_FileHeader header = {0};
+	header.magic = CAPTURE_FILE_MAGIC;
+	header.version = CAPTURE_FILE_VERSION;
+	header.api = (uint32_t)api;
+
+	if (fwrite(&header, sizeof(Capture_FileHeader), 1, file) != 1)
+	{
+		fclose(file);
+		return OPAL_INTERNAL_ERROR;
+	}
+
+	stream->file = file;
+	stream->mode = CAPTURE_STREAM_MODE_WRITE;
+
+	opal_bumpInitialize(&stream->record, 4096);
+	return OPAL_SUCCESS;
+}
+
+Opal_Result capture_streamOpenRead(Capture_Stream *stream, const char *path, Capture_FileHeader *header, PFN_captureRemapHandle remap, void *user_data)
+{
+	assert(stream);
+	assert(path);
+	assert(header);
+
+	memset(stream, 0, sizeof(Capture_Stream));
+
+	FILE *file = fopen(path, "rb");
+	if (file == NULL)
+		return OPAL_INVALID_OUTPUT_ARGUMENT;
+
+	if (fread(header, sizeof(Capture_FileHeader), 1, file) != 1 || header->magic != CAPTURE_FILE_MAGIC || header->version != CAPTURE_FILE_VERSION)
+	{
+		fclose(file);
+		return OPAL_NOT_SUPPORTED;
+	}
+
+	stream->file = file;
+	stream->mode = CAPTURE_STREAM_MODE_READ;
+	stream->remap = remap;
+	stream->user_data = user_data;
+
+	opal_bumpInitialize(&stream->record, 4096);
+	return OPAL_SUCCESS;
+}
+
+Opal_Result capture_streamClose(Capture_Stream *stream)
+{
+	assert(stream);
+
+	if (stream->file)
+		fclose(stream->file);
+
+	capture_releaseAllocations(stream);
+	free(stream->allocations);
+
+	if (stream->record.data)
+		opal_bumpShutdown(&stream->record);
+
+	memset(stream, 0, sizeof(Capture_Stream));
+	return OPAL_SUCCESS;
+}
+
+/*
+ */
+void capture_beginRecord(Capture_Stream *stream)
+{
+	assert(stream);
+	assert(stream->mode == CAPTURE_STREAM_MODE_WRITE);
+
+	opal_bumpReset(&stream->record);
+}
+
+Opal_Result capture_endRecord(Capture_Stream *stream, Capture_Call call, Opal_Result result)
+{
+	assert(stream);
+	assert(stream->mode == CAPTURE_STREAM_MODE_WRITE);
+	assert(call < CAPTURE_CALL_ENUM_MAX);
+
+	Capture_RecordHeader header = {0};
+	header.call = (uint32_t)call;
+	header.result = (uint32_t)result;
+	header.size = stream->record.size;
+
+	if (fwrite(&header, sizeof(Capture_RecordHeader), 1, stream->file) != 1)
+		return OPAL_INTERNAL_ERROR;
+
+	if (header.size > 0 && fwrite(stream->record.data, header.size, 1, stream->file) != 1)
+		return OPAL_INTERNAL_ERROR;
+
+	return OPAL_SUCCESS;
+}
+
+Opal_Result capture_readRecord(Capture_Stream *stream, Capture_Call *call, Opal_Result *result)
+{
+	assert(stream);
+	assert(stream->mode == CAPTURE_STREAM_MODE_READ);
+	assert(call);
+	assert(result);
+
+	capture_releaseAllocations(stream);
+	opal_bumpReset(&stream->record);
+
+	stream->offset = 0;
+	stream->overflow = 0;
+
+	Capture_RecordHeader header = {0};
+	if (fread(&header, sizeof(Capture_RecordHeader), 1, stream->file) != 1)
+		return OPAL_NOT_SUPPORTED;
+
+	if (header.call >= CAPTURE_CALL_ENUM_MAX || header.size > 0xFFFFFFFF)
+		return OPAL_INTERNAL_ERROR;
+
+	if (header.size > 0)
+	{
+		opal_bumpAlloc(&stream->record, (uint32_t)header.size);
+
+		if (fread(stream->record.data, header.size, 1, stream->file) != 1)
+			return OPAL_INTERNAL_ERROR;
+	}
+
+	*call = (Capture_Call)header.call;
+	*result = (Opal_Result)header.result;
+
+	return OPAL_SUCCESS;
+}
+
+/*
+ */
+const char *capture_getCallName(Capture_Call call)
+{
+	if (call >= CAPTURE_CALL_ENUM_MAX)
+		return "<unknown>";
+
+	assert(call_names[call]);
+	return call_names[call];
+}
+
+Capture_DescriptorEntryType capture_getDescriptorEntryType(Opal_DescriptorType type)
+{
+	switch (type)
+	{
+		case OPAL_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+		case OPAL_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+		case OPAL_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+		case OPAL_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+		case OPAL_DESCRIPTOR_TYPE_STORAGE_BUFFER_READONLY:
+		case OPAL_DESCRIPTOR_TYPE_STORAGE_BUFFER_READONLY_DYNAMIC:
+			return CAPTURE_DESCRIPTOR_ENTRY_TYPE_BUFFER;
+
+		case OPAL_DESCRIPTOR_TYPE_SAMPLED_TEXTURE_1D:
+		case OPAL_DESCRIPTOR_TYPE_SAMPLED_TEXTURE_2D:
+		case OPAL_DESCRIPTOR_TYPE_SAMPLED_TEXTURE_2D_ARRAY:
+		case OPAL_DESCRIPTOR_TYPE_SAMPLED_TEXTURE_CUBE:
+		case OPAL_DESCRIPTOR_TYPE_SAMPLED_TEXTURE_CUBE_ARRAY:
+		case OPAL_DESCRIPTOR_TYPE_SAMPLED_TEXTURE_3D:
+		case OPAL_DESCRIPTOR_TYPE_MULTISAMPLED_TEXTURE_2D:
+		case OPAL_DESCRIPTOR_TYPE_STORAGE_TEXTURE_1D:
+		case OPAL_DESCRIPTOR_TYPE_STORAGE_TEXTURE_2D:
+		case OPAL_DESCRIPTOR_TYPE_STORAGE_TEXTURE_2D_ARRAY:
+		case OPAL_DESCRIPTOR_TYPE_STORAGE_TEXTURE_3D:
+			return CAPTURE_DESCRIPTOR_ENTRY_TYPE_TEXTURE_VIEW;
+
+		case OPAL_DESCRIPTOR_TYPE_SAMPLER:
+		case OPAL_DESCRIPTOR_TYPE_COMPARE_SAMPLER:
+			return CAPTURE_DESCRIPTOR_ENTRY_TYPE_SAMPLER;
+
+		case OPAL_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE:
+			return CAPTURE_DESCRIPTOR_ENTRY_TYPE_ACCELERATION_STRUCTURE;
+
+		default: return CAPTURE_DESCRIPTOR_ENTRY_TYPE_UNKNOWN;
+	}
+}
+
+/*
+ */
+void capture_u32(Capture_Stream *stream, uint32_t *value)
+{
+	capture_bytes(stream, value, sizeof(uint32_t));
+}
+
+void capture_u64(Capture_Stream *stream, uint64_t *value)
+{
+	capture_bytes(stream, value, sizeof(uint64_t));
+}
+
+void capture_f32(Capture_Stream *stream, float *value)
+{
+	capture_bytes(stream, value, sizeof(float));
+}
+
+void capture_handle(Capture_Stream *stream, Capture_HandleType type, uint64_t *handle)
+{
+	assert(stream);
+	assert(handle);
+
+	capture_bytes(stream, handle, sizeof(uint64_t));
+
+	if (stream->mode == CAPTURE_STREAM_MODE_READ && stream->remap && *handle != OPAL_NULL_HANDLE)
+		*handle = stream->remap(stream->user_data, type, *handle);
+}
+
+void capture_string(Capture_Stream *stream, const char **string)
+{
+	assert(stream);
+	assert(string);
+
+	uint32_t size = 0;
+
+	if (stream->mode == CAPTURE_STREAM_MODE_WRITE)
+	{
+		if (*string)
+			size = (uint32_t)strlen(*string) + 1;
+
+		capture_u32(stream, &size);
+		capture_bytes(stream, (void *)*string, size);
+		return;
+	}
+
+	capture_u32(stream, &size);
+	*string = (size > 0) ? (const char *)capture_view(stream, size) : NULL;
+}
+
+void capture_data(Capture_Stream *stream, const void **data, uint64_t size)
+{
+	assert(stream);
+	assert(data);
+
+	uint32_t present = 0;
+
+	if (stream->mode == CAPTURE_STREAM_MODE_WRITE)
+	{
+		present = (*data != NULL && size > 0);
+
+		capture_u32(stream, &present);
+		if (present)
+			capture_bytes(stream, (void *)*data, (uint32_t)size);
+		return;
+	}
+
+	capture_u32(stream, &present);
+	*data = (present) ? capture_view(stream, (uint32_t)size) : NULL;
+}
+
+void *capture_array(Capture_Stream *stream, const void **array, uint32_t count, uint32_t element_size)
+{
+	assert(stream);
+	assert(array);
+
+	uint32_t present = 0;
+
+	if (stream->mode == CAPTURE_STREAM_MODE_WRITE)
+	{
+		present = (*array != NULL && count > 0);
+
+		capture_u32(stream, &present);
+		return (present) ? (void *)*array : NULL;
+	}
+
+	capture_u32(stream, &present);
+
+	if (!present || stream->overflow)
+	{
+		*array = NULL;
+		return NULL;
+	}
+
+	void *result = capture_allocate(stream, count * element_size);
+	*array = result;
+
+	return result;
+}
+
+/*
+ */
+static void capture_handles(Capture_Stream *stream, Capture_HandleType type, const uint64_t **handles, uint32_t count)
+{
+	uint64_t *ptr = (uint64_t *)capture_array(stream, (const void **)handles, count, sizeof(uint64_t));
+	if (ptr == NULL)
+		return;
+
+	for (uint32_t i = 0; i < count; ++i)
+		capture_handle(stream, type, &ptr[i]);
+}
+
+static void capture_u32s(Capture_Stream *stream, const uint32_t **values, uint32_t count)
+{
+	uint32_t *ptr = (uint32_t *)capture_array(stream, (const void **)values, count, sizeof(uint32_t));
+	if (ptr == NULL)
+		return;
+
+	for (uint32_t i = 0; i < count; ++i)
+		capture_u32(stream, &ptr[i]);
+}
+
+static void capture_u64s(Capture_Stream *stream, const uint64_t **values, uint32_t count)
+{
+	uint64_t *ptr = (uint64_t *)capture_array(stream, (const void **)values, count, sizeof(uint64_t));
+	if (ptr == NULL)
+		return;
+
+	for (uint32_t i = 0; i < count; ++i)
+		capture_u64(stream, &ptr[i]);
+}
+
+/*
+ */
+static void capture_codecInstanceDesc(Capture_Stream *stream, Opal_InstanceDesc *desc)
+{
+	capture_string(stream, &desc->application_name);
+	capture_string(stream, &desc->engine_name);
+	capture_u32(stream, &desc->application_version);
+	capture_u32(stream, &desc->engine_version);
+	capture_u32(stream, &desc->heap_size);
+	capture_u32(stream, &desc->max_heap_allocations);
+	capture_u32(stream, &desc->max_heaps);
+	capture_u32(stream, (uint32_t *)&desc->flags);
+
+	// note: layers are process local and are never recorded, replay decides on its own layer stack
+}
+
+static void capture_codecBufferView(Capture_Stream *stream, Opal_BufferView *view)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_BUFFER, &view->buffer);
+	capture_u64(stream, &view->offset);
+	capture_u64(stream, &view->size);
+}
+
+static void capture_codecVertexBufferView(Capture_Stream *stream, Opal_VertexBufferView *view)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_BUFFER, &view->buffer);
+	capture_u64(stream, &view->offset);
+	capture_u32(stream, &view->size);
+	capture_u32(stream, &view->stride);
+}
+
+static void capture_codecIndexBufferView(Capture_Stream *stream, Opal_IndexBufferView *view)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_BUFFER, &view->buffer);
+	capture_u64(stream, &view->offset);
+	capture_u32(stream, &view->size);
+	capture_u32(stream, (uint32_t *)&view->format);
+}
+
+static void capture_codecSemaphoreDesc(Capture_Stream *stream, Opal_SemaphoreDesc *desc)
+{
+	capture_u64(stream, &desc->initial_value);
+	capture_u32(stream, (uint32_t *)&desc->flags);
+}
+
+static void capture_codecMemoryBarrierDesc(Capture_Stream *stream, Opal_MemoryBarrierDesc *desc)
+{
+	capture_u32(stream, &desc->num_buffers);
+	capture_handles(stream, CAPTURE_HANDLE_TYPE_BUFFER, &desc->buffers, desc->num_buffers);
+	capture_u32(stream, &desc->num_textures);
+	capture_handles(stream, CAPTURE_HANDLE_TYPE_TEXTURE_VIEW, &desc->textures, desc->num_textures);
+}
+
+static void capture_codecBarrierDesc(Capture_Stream *stream, Opal_BarrierDesc *desc)
+{
+	capture_u32(stream, (uint32_t *)&desc->wait_stages);
+	capture_u32(stream, (uint32_t *)&desc->block_stages);
+
+	capture_u32(stream, &desc->num_buffer_transitions);
+	Opal_BufferTransitionDesc *buffer_transitions = (Opal_BufferTransitionDesc *)capture_array(stream, (const void **)&desc->buffer_transitions, desc->num_buffer_transitions, sizeof(Opal_BufferTransitionDesc));
+	for (uint32_t i = 0; buffer_transitions && i < desc->num_buffer_transitions; ++i)
+	{
+		capture_handle(stream, CAPTURE_HANDLE_TYPE_BUFFER, &buffer_transitions[i].buffer);
+		capture_u32(stream, (uint32_t *)&buffer_transitions[i].state_before);
+		capture_u32(stream, (uint32_t *)&buffer_transitions[i].state_after);
+	}
+
+	capture_u32(stream, &desc->num_texture_transitions);
+	Opal_TextureTransitionDesc *texture_transitions = (Opal_TextureTransitionDesc *)capture_array(stream, (const void **)&desc->texture_transitions, desc->num_texture_transitions, sizeof(Opal_TextureTransitionDesc));
+	for (uint32_t i = 0; texture_transitions && i < desc->num_texture_transitions; ++i)
+	{
+		capture_handle(stream, CAPTURE_HANDLE_TYPE_TEXTURE_VIEW, &texture_transitions[i].texture_view);
+		capture_u32(stream, (uint32_t *)&texture_transitions[i].state_before);
+		capture_u32(stream, (uint32_t *)&texture_transitions[i].state_after);
+	}
+
+	capture_u32(stream, (uint32_t *)&desc->fence_op);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_FENCE, &desc->fence);
+}
+
+static void capture_codecPassBarriersDesc(Capture_Stream *stream, Opal_PassBarriersDesc *desc)
+{
+	capture_u32(stream, &desc->num_barriers);
+
+	Opal_BarrierDesc *barriers = (Opal_BarrierDesc *)capture_array(stream, (const void **)&desc->barriers, desc->num_barriers, sizeof(Opal_BarrierDesc));
+	for (uint32_t i = 0; barriers && i < desc->num_barriers; ++i)
+		capture_codecBarrierDesc(stream, &barriers[i]);
+}
+
+static void capture_codecBufferDesc(Capture_Stream *stream, Opal_BufferDesc *desc)
+{
+	capture_u64(stream, &desc->size);
+	capture_u32(stream, (uint32_t *)&desc->memory_type);
+	capture_u32(stream, (uint32_t *)&desc->hint);
+	capture_u32(stream, (uint32_t *)&desc->usage);
+	capture_u32(stream, (uint32_t *)&desc->initial_state);
+}
+
+static void capture_codecTextureDesc(Capture_Stream *stream, Opal_TextureDesc *desc)
+{
+	capture_u32(stream, (uint32_t *)&desc->type);
+	capture_u32(stream, (uint32_t *)&desc->format);
+	capture_u32(stream, &desc->width);
+	capture_u32(stream, &desc->height);
+	capture_u32(stream, &desc->depth);
+	capture_u32(stream, &desc->mip_count);
+	capture_u32(stream, &desc->layer_count);
+	capture_u32(stream, (uint32_t *)&desc->samples);
+	capture_u32(stream, (uint32_t *)&desc->hint);
+	capture_u32(stream, (uint32_t *)&desc->usage);
+}
+
+static void capture_codecTextureViewDesc(Capture_Stream *stream, Opal_TextureViewDesc *desc)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_TEXTURE, &desc->texture);
+	capture_u32(stream, (uint32_t *)&desc->type);
+	capture_u32(stream, &desc->base_mip);
+	capture_u32(stream, &desc->mip_count);
+	capture_u32(stream, &desc->base_layer);
+	capture_u32(stream, &desc->layer_count);
+}
+
+static void capture_codecSamplerDesc(Capture_Stream *stream, Opal_SamplerDesc *desc)
+{
+	capture_u32(stream, (uint32_t *)&desc->mag_filter);
+	capture_u32(stream, (uint32_t *)&desc->min_filter);
+	capture_u32(stream, (uint32_t *)&desc->mip_filter);
+	capture_u32(stream, (uint32_t *)&desc->address_mode_u);
+	capture_u32(stream, (uint32_t *)&desc->address_mode_v);
+	capture_u32(stream, (uint32_t *)&desc->address_mode_w);
+	capture_f32(stream, &desc->min_lod);
+	capture_f32(stream, &desc->max_lod);
+	capture_u32(stream, &desc->max_anisotropy);
+	capture_u32(stream, &desc->compare_enable);
+	capture_u32(stream, (uint32_t *)&desc->compare_op);
+}
+
+static void capture_codecShaderDesc(Capture_Stream *stream, Opal_ShaderDesc *desc)
+{
+	capture_u32(stream, (uint32_t *)&desc->type);
+	capture_u64(stream, &desc->size);
+	capture_data(stream, &desc->data, desc->size);
+}
+
+static void capture_codecShaderFunction(Capture_Stream *stream, Opal_ShaderFunction *function)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_SHADER, &function->shader);
+	capture_string(stream, &function->name);
+}
+
+static void capture_codecFramebufferAttachment(Capture_Stream *stream, Opal_FramebufferAttachment *attachment)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_TEXTURE_VIEW, &attachment->texture_view);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_TEXTURE_VIEW, &attachment->resolve_texture_view);
+	capture_u32(stream, (uint32_t *)&attachment->load_op);
+	capture_u32(stream, (uint32_t *)&attachment->store_op);
+
+	// note: clear value is a union of 32-bit scalars, store raw bits
+	for (uint32_t i = 0; i < 4; ++i)
+		capture_u32(stream, &attachment->clear_value.color.u[i]);
+}
+
+static void capture_codecFramebufferDesc(Capture_Stream *stream, Opal_FramebufferDesc *desc)
+{
+	capture_u32(stream, &desc->num_color_attachments);
+
+	Opal_FramebufferAttachment *color_attachments = (Opal_FramebufferAttachment *)capture_array(stream, (const void **)&desc->color_attachments, desc->num_color_attachments, sizeof(Opal_FramebufferAttachment));
+	for (uint32_t i = 0; color_attachments && i < desc->num_color_attachments; ++i)
+		capture_codecFramebufferAttachment(stream, &color_attachments[i]);
+
+	Opal_FramebufferAttachment *depth_stencil_attachment = (Opal_FramebufferAttachment *)capture_array(stream, (const void **)&desc->depth_stencil_attachment, 1, sizeof(Opal_FramebufferAttachment));
+	if (depth_stencil_attachment)
+		capture_codecFramebufferAttachment(stream, depth_stencil_attachment);
+}
+
+static void capture_codecBufferTextureRegion(Capture_Stream *stream, Opal_BufferTextureRegion *region)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_BUFFER, &region->buffer);
+	capture_u64(stream, &region->offset);
+	capture_u32(stream, &region->row_size);
+	capture_u32(stream, &region->num_rows);
+}
+
+static void capture_codecTextureRegion(Capture_Stream *stream, Opal_TextureRegion *region)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_TEXTURE_VIEW, &region->texture_view);
+	capture_u32(stream, (uint32_t *)&region->offset.x);
+	capture_u32(stream, (uint32_t *)&region->offset.y);
+	capture_u32(stream, (uint32_t *)&region->offset.z);
+}
+
+static void capture_codecExtent3D(Capture_Stream *stream, Opal_Extent3D *extent)
+{
+	capture_u32(stream, &extent->width);
+	capture_u32(stream, &extent->height);
+	capture_u32(stream, &extent->depth);
+}
+
+static void capture_codecBufferTextureCopyRegions(Capture_Stream *stream, uint32_t num_regions, const Opal_BufferTextureCopyRegion **regions)
+{
+	Opal_BufferTextureCopyRegion *ptr = (Opal_BufferTextureCopyRegion *)capture_array(stream, (const void **)regions, num_regions, sizeof(Opal_BufferTextureCopyRegion));
+	for (uint32_t i = 0; ptr && i < num_regions; ++i)
+	{
+		Opal_BufferTextureCopyRegion *region = &ptr[i];
+
+		capture_u64(stream, &region->buffer_offset);
+		capture_u32(stream, &region->row_size);
+		capture_u32(stream, &region->num_rows);
+		capture_u32(stream, &region->mip);
+		capture_u32(stream, &region->base_layer);
+		capture_u32(stream, &region->layer_count);
+		capture_u32(stream, (uint32_t *)&region->texture_offset.x);
+		capture_u32(stream, (uint32_t *)&region->texture_offset.y);
+		capture_u32(stream, (uint32_t *)&region->texture_offset.z);
+		capture_codecExtent3D(stream, &region->size);
+	}
+}
+
+static void capture_codecVertexStream(Capture_Stream *stream, Opal_VertexStream *vertex_stream)
+{
+	capture_u32(stream, &vertex_stream->stride);
+	capture_u32(stream, &vertex_stream->num_vertex_attributes);
+
+	Opal_VertexAttribute *attributes = (Opal_VertexAttribute *)capture_array(stream, (const void **)&vertex_stream->attributes, vertex_stream->num_vertex_attributes, sizeof(Opal_VertexAttribute));
+	for (uint32_t i = 0; attributes && i < vertex_stream->num_vertex_attributes; ++i)
+	{
+		capture_u32(stream, (uint32_t *)&attributes[i].format);
+		capture_u32(stream, &attributes[i].offset);
+	}
+
+	capture_u32(stream, (uint32_t *)&vertex_stream->rate);
+}
+
+static void capture_codecDescriptorSetEntry(Capture_Stream *stream, Opal_DescriptorSetEntry *entry, Capture_DescriptorEntryType entry_type)
+{
+	// note: the tag is written by the capture layer and decoded before the payload on replay
+	capture_u32(stream, &entry->binding);
+	capture_u32(stream, (uint32_t *)&entry_type);
+
+	switch (entry_type)
+	{
+		case CAPTURE_DESCRIPTOR_ENTRY_TYPE_BUFFER:
+		{
+			// note: storage buffer views share the layout of buffer views
+			capture_codecBufferView(stream, &entry->data.buffer_view);
+		}
+		break;
+
+		case CAPTURE_DESCRIPTOR_ENTRY_TYPE_TEXTURE_VIEW: capture_handle(stream, CAPTURE_HANDLE_TYPE_TEXTURE_VIEW, &entry->data.texture_view); break;
+		case CAPTURE_DESCRIPTOR_ENTRY_TYPE_SAMPLER: capture_handle(stream, CAPTURE_HANDLE_TYPE_SAMPLER, &entry->data.sampler); break;
+		case CAPTURE_DESCRIPTOR_ENTRY_TYPE_ACCELERATION_STRUCTURE: capture_handle(stream, CAPTURE_HANDLE_TYPE_ACCELERATION_STRUCTURE, &entry->data.acceleration_structure); break;
+		default: capture_bytes(stream, &entry->data, sizeof(Opal_DescriptorSetEntryData)); break;
+	}
+}
+
+static void capture_codecDescriptorSetEntries(Capture_Stream *stream, uint32_t num_entries, const Opal_DescriptorSetEntry **entries, const Capture_DescriptorEntryType *entry_types)
+{
+	Opal_DescriptorSetEntry *ptr = (Opal_DescriptorSetEntry *)capture_array(stream, (const void **)entries, num_entries, sizeof(Opal_DescriptorSetEntry));
+	if (ptr == NULL)
+		return;
+
+	for (uint32_t i = 0; i < num_entries; ++i)
+	{
+		Capture_DescriptorEntryType entry_type = CAPTURE_DESCRIPTOR_ENTRY_TYPE_UNKNOWN;
+		if (stream->mode == CAPTURE_STREAM_MODE_WRITE && entry_types)
+			entry_type = entry_types[i];
+
+		capture_codecDescriptorSetEntry(stream, &ptr[i], entry_type);
+	}
+}
+
+static void capture_codecStencilFaceState(Capture_Stream *stream, Opal_StencilFaceState *state)
+{
+	capture_u32(stream, (uint32_t *)&state->pass_op);
+	capture_u32(stream, (uint32_t *)&state->depth_fail_op);
+	capture_u32(stream, (uint32_t *)&state->fail_op);
+	capture_u32(stream, (uint32_t *)&state->compare_op);
+}
+
+static void capture_codecBlendState(Capture_Stream *stream, Opal_BlendState *state)
+{
+	capture_u32(stream, &state->enable);
+	capture_u32(stream, (uint32_t *)&state->src_color);
+	capture_u32(stream, (uint32_t *)&state->dst_color);
+	capture_u32(stream, (uint32_t *)&state->color_op);
+	capture_u32(stream, (uint32_t *)&state->src_alpha);
+	capture_u32(stream, (uint32_t *)&state->dst_alpha);
+	capture_u32(stream, (uint32_t *)&state->alpha_op);
+}
+
+static void capture_codecAccelerationStructureGeometry(Capture_Stream *stream, Opal_AccelerationStructureGeometry *geometry)
+{
+	capture_u32(stream, (uint32_t *)&geometry->type);
+	capture_u32(stream, (uint32_t *)&geometry->flags);
+
+	if (geometry->type == OPAL_ACCELERATION_STRUCTURE_GEOMETRY_TYPE_TRIANGLES)
+	{
+		Opal_AccelerationStructureGeometryDataTriangles *triangles = &geometry->data.triangles;
+
+		capture_u32(stream, &triangles->num_vertices);
+		capture_u32(stream, &triangles->num_indices);
+		capture_u32(stream, (uint32_t *)&triangles->vertex_format);
+		capture_u32(stream, (uint32_t *)&triangles->index_format);
+		capture_u32(stream, &triangles->vertex_stride);
+		capture_codecBufferView(stream, &triangles->vertex_buffer);
+		capture_codecBufferView(stream, &triangles->index_buffer);
+	}
+	else
+	{
+		Opal_AccelerationStructureGeometryDataAABBs *aabbs = &geometry->data.aabbs;
+
+		capture_u32(stream, &aabbs->num_entries);
+		capture_u32(stream, &aabbs->stride);
+		capture_codecBufferView(stream, &aabbs->entries_buffer);
+	}
+}
+
+static void capture_codecAccelerationStructureBuildDesc(Capture_Stream *stream, Opal_AccelerationStructureBuildDesc *desc)
+{
+	capture_u32(stream, (uint32_t *)&desc->type);
+	capture_u32(stream, (uint32_t *)&desc->build_flags);
+	capture_u32(stream, (uint32_t *)&desc->build_mode);
+
+	if (desc->type == OPAL_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL)
+	{
+		Opal_AccelerationStructureBuildInputBottomLevel *bottom_level = &desc->input.bottom_level;
+		capture_u32(stream, &bottom_level->num_geometries);
+
+		Opal_AccelerationStructureGeometry *geometries = (Opal_AccelerationStructureGeometry *)capture_array(stream, (const void **)&bottom_level->geometries, bottom_level->num_geometries, sizeof(Opal_AccelerationStructureGeometry));
+		for (uint32_t i = 0; geometries && i < bottom_level->num_geometries; ++i)
+			capture_codecAccelerationStructureGeometry(stream, &geometries[i]);
+	}
+	else
+	{
+		Opal_AccelerationStructureBuildInputTopLevel *top_level = &desc->input.top_level;
+		capture_u32(stream, &top_level->num_instances);
+		capture_codecBufferView(stream, &top_level->instance_buffer);
+	}
+
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_ACCELERATION_STRUCTURE, &desc->src_acceleration_structure);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_ACCELERATION_STRUCTURE, &desc->dst_acceleration_structure);
+	capture_codecBufferView(stream, &desc->scratch_buffer);
+}
+
+static void capture_codecAccelerationStructureInstance(Capture_Stream *stream, Opal_AccelerationStructureInstance *instance)
+{
+	for (uint32_t row = 0; row < 3; ++row)
+		for (uint32_t column = 0; column < 4; ++column)
+			capture_f32(stream, &instance->transform[row][column]);
+
+	// note: bitfields can't be addressed, go through temporaries
+	uint32_t custom_index = instance->custom_index;
+	uint32_t mask = instance->mask;
+	uint32_t intersection_index_offset = instance->intersection_index_offset;
+	uint32_t flags = instance->flags;
+
+	capture_u32(stream, &custom_index);
+	capture_u32(stream, &mask);
+	capture_u32(stream, &intersection_index_offset);
+	capture_u32(stream, &flags);
+
+	if (stream->mode == CAPTURE_STREAM_MODE_READ)
+	{
+		instance->custom_index = custom_index;
+		instance->mask = mask;
+		instance->intersection_index_offset = intersection_index_offset;
+		instance->flags = (Opal_AccelerationStructureInstanceFlags)flags;
+	}
+
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_ACCELERATION_STRUCTURE, &instance->blas);
+}
+
+static void capture_codecPipelineState(Capture_Stream *stream, Opal_PrimitiveType *primitive_type, Opal_CullMode *cull_mode, Opal_FrontFace *front_face, Opal_Samples *rasterization_samples)
+{
+	capture_u32(stream, (uint32_t *)primitive_type);
+	capture_u32(stream, (uint32_t *)cull_mode);
+	capture_u32(stream, (uint32_t *)front_face);
+	capture_u32(stream, (uint32_t *)rasterization_samples);
+}
+
+static void capture_codecGraphicsPipelineDesc(Capture_Stream *stream, Opal_GraphicsPipelineDesc *desc)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_PIPELINE_LAYOUT, &desc->pipeline_layout);
+	capture_codecShaderFunction(stream, &desc->vertex_function);
+	capture_codecShaderFunction(stream, &desc->tessellation_control_function);
+	capture_codecShaderFunction(stream, &desc->tessellation_evaluation_function);
+	capture_codecShaderFunction(stream, &desc->geometry_function);
+	capture_codecShaderFunction(stream, &desc->fragment_function);
+
+	capture_u32(stream, &desc->num_vertex_streams);
+	Opal_VertexStream *vertex_streams = (Opal_VertexStream *)capture_array(stream, (const void **)&desc->vertex_streams, desc->num_vertex_streams, sizeof(Opal_VertexStream));
+	for (uint32_t i = 0; vertex_streams && i < desc->num_vertex_streams; ++i)
+		capture_codecVertexStream(stream, &vertex_streams[i]);
+
+	capture_u32(stream, (uint32_t *)&desc->strip_index_format);
+	capture_codecPipelineState(stream, &desc->primitive_type, &desc->cull_mode, &desc->front_face, &desc->rasterization_samples);
+
+	capture_u32(stream, &desc->depth_enable);
+	capture_u32(stream, &desc->depth_write);
+	capture_u32(stream, (uint32_t *)&desc->depth_compare_op);
+	capture_u32(stream, &desc->stencil_enable);
+	capture_codecStencilFaceState(stream, &desc->stencil_front);
+	capture_codecStencilFaceState(stream, &desc->stencil_back);
+	capture_u32(stream, &desc->stencil_read_mask);
+	capture_u32(stream, &desc->stencil_write_mask);
+
+	capture_u32(stream, &desc->num_color_attachments);
+	for (uint32_t i = 0; i < 8; ++i)
+	{
+		capture_u32(stream, (uint32_t *)&desc->color_attachment_formats[i]);
+		capture_codecBlendState(stream, &desc->color_blend_states[i]);
+	}
+
+	Opal_TextureFormat *depth_stencil_attachment_format = (Opal_TextureFormat *)capture_array(stream, (const void **)&desc->depth_stencil_attachment_format, 1, sizeof(Opal_TextureFormat));
+	if (depth_stencil_attachment_format)
+		capture_u32(stream, (uint32_t *)depth_stencil_attachment_format);
+}
+
+static void capture_codecMeshletPipelineDesc(Capture_Stream *stream, Opal_MeshletPipelineDesc *desc)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_PIPELINE_LAYOUT, &desc->pipeline_layout);
+	capture_codecShaderFunction(stream, &desc->task_function);
+	capture_codecShaderFunction(stream, &desc->mesh_function);
+	capture_codecShaderFunction(stream, &desc->fragment_function);
+
+	capture_codecPipelineState(stream, &desc->primitive_type, &desc->cull_mode, &desc->front_face, &desc->rasterization_samples);
+
+	capture_u32(stream, &desc->depth_enable);
+	capture_u32(stream, &desc->depth_write);
+	capture_u32(stream, (uint32_t *)&desc->depth_compare_op);
+	capture_u32(stream, &desc->stencil_enable);
+	capture_codecStencilFaceState(stream, &desc->stencil_front);
+	capture_codecStencilFaceState(stream, &desc->stencil_back);
+	capture_u32(stream, &desc->stencil_read_mask);
+	capture_u32(stream, &desc->stencil_write_mask);
+
+	capture_u32(stream, &desc->num_color_attachments);
+	for (uint32_t i = 0; i < 8; ++i)
+	{
+		capture_u32(stream, (uint32_t *)&desc->color_attachment_formats[i]);
+		capture_codecBlendState(stream, &desc->color_blend_states[i]);
+	}
+
+	Opal_TextureFormat *depth_stencil_attachment_format = (Opal_TextureFormat *)capture_array(stream, (const void **)&desc->depth_stencil_attachment_format, 1, sizeof(Opal_TextureFormat));
+	if (depth_stencil_attachment_format)
+		capture_u32(stream, (uint32_t *)depth_stencil_attachment_format);
+}
+
+static void capture_codecComputePipelineDesc(Capture_Stream *stream, Opal_ComputePipelineDesc *desc)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_PIPELINE_LAYOUT, &desc->pipeline_layout);
+	capture_codecShaderFunction(stream, &desc->compute_function);
+	capture_u32(stream, &desc->threadgroup_size_x);
+	capture_u32(stream, &desc->threadgroup_size_y);
+	capture_u32(stream, &desc->threadgroup_size_z);
+}
+
+static void capture_codecShaderFunctions(Capture_Stream *stream, const Opal_ShaderFunction **functions, uint32_t count)
+{
+	Opal_ShaderFunction *ptr = (Opal_ShaderFunction *)capture_array(stream, (const void **)functions, count, sizeof(Opal_ShaderFunction));
+	for (uint32_t i = 0; ptr && i < count; ++i)
+		capture_codecShaderFunction(stream, &ptr[i]);
+}
+
+static void capture_codecRaytracePipelineDesc(Capture_Stream *stream, Opal_RaytracePipelineDesc *desc)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_PIPELINE_LAYOUT, &desc->pipeline_layout);
+
+	capture_u32(stream, &desc->num_raygen_functions);
+	capture_codecShaderFunctions(stream, &desc->raygen_functions, desc->num_raygen_functions);
+
+	capture_u32(stream, &desc->num_miss_functions);
+	capture_codecShaderFunctions(stream, &desc->miss_functions, desc->num_miss_functions);
+
+	capture_u32(stream, &desc->num_intersection_functions);
+	Opal_ShaderIntersectionGroup *groups = (Opal_ShaderIntersectionGroup *)capture_array(stream, (const void **)&desc->intersection_functions, desc->num_intersection_functions, sizeof(Opal_ShaderIntersectionGroup));
+	for (uint32_t i = 0; groups && i < desc->num_intersection_functions; ++i)
+	{
+		capture_codecShaderFunction(stream, &groups[i].intersection_function);
+		capture_codecShaderFunction(stream, &groups[i].anyhit_function);
+		capture_codecShaderFunction(stream, &groups[i].closesthit_function);
+	}
+
+	capture_u32(stream, &desc->max_recursion_depth);
+	capture_u32(stream, &desc->max_ray_payload_size);
+	capture_u32(stream, &desc->max_hit_attribute_size);
+}
+
+static void capture_codecSwapchainDesc(Capture_Stream *stream, Opal_SwapchainDesc *desc)
+{
+	capture_u32(stream, (uint32_t *)&desc->mode);
+	capture_u32(stream, (uint32_t *)&desc->format.texture_format);
+	capture_u32(stream, (uint32_t *)&desc->format.color_space);
+	capture_u32(stream, (uint32_t *)&desc->usage);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_SURFACE, &desc->surface);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_QUEUE, &desc->queue);
+	capture_u32(stream, &desc->max_frames_in_flight);
+}
+
+static void capture_codecSubmitDesc(Capture_Stream *stream, Opal_SubmitDesc *desc)
+{
+	capture_u32(stream, &desc->num_wait_semaphores);
+	capture_handles(stream, CAPTURE_HANDLE_TYPE_SEMAPHORE, &desc->wait_semaphores, desc->num_wait_semaphores);
+	capture_u64s(stream, &desc->wait_values, desc->num_wait_semaphores);
+
+	capture_u32(stream, &desc->num_wait_swapchains);
+	capture_handles(stream, CAPTURE_HANDLE_TYPE_SWAPCHAIN, &desc->wait_swapchains, desc->num_wait_swapchains);
+
+	capture_u32(stream, &desc->num_command_buffers);
+	capture_handles(stream, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, &desc->command_buffers, desc->num_command_buffers);
+
+	capture_u32(stream, &desc->num_signal_semaphores);
+	capture_handles(stream, CAPTURE_HANDLE_TYPE_SEMAPHORE, &desc->signal_semaphores, desc->num_signal_semaphores);
+	capture_u64s(stream, &desc->signal_values, desc->num_signal_semaphores);
+
+	capture_u32(stream, &desc->num_signal_swapchains);
+	capture_handles(stream, CAPTURE_HANDLE_TYPE_SWAPCHAIN, &desc->signal_swapchains, desc->num_signal_swapchains);
+}
+
+/*
+ */
+#define CAPTURE_DESC(TYPE, CODEC) \
+	TYPE *ptr = (TYPE *)capture_array(stream, (const void **)desc, 1, sizeof(TYPE)); \
+	if (ptr) \
+		CODEC(stream, ptr);
+
+/*
+ */
+void capture_callCreateInstance(Capture_Stream *stream, Opal_Api *api, const Opal_InstanceDesc **desc, Opal_Instance *instance)
+{
+	capture_u32(stream, (uint32_t *)api);
+	CAPTURE_DESC(Opal_InstanceDesc, capture_codecInstanceDesc);
+	capture_u64(stream, instance);
+}
+
+void capture_callEnumerateDevices(Capture_Stream *stream, Opal_Instance *instance)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_INSTANCE, instance);
+}
+
+void capture_callCreateSurface(Capture_Stream *stream, Opal_Instance *instance, Opal_Surface *surface)
+{
+	// note: native window handles can't be replayed, only the resulting surface is recorded
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_INSTANCE, instance);
+	capture_u64(stream, surface);
+}
+
+void capture_callCreateHeadlessSurface(Capture_Stream *stream, Opal_Instance *instance, uint32_t *width, uint32_t *height, Opal_Surface *surface)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_INSTANCE, instance);
+	capture_u32(stream, width);
+	capture_u32(stream, height);
+	capture_u64(stream, surface);
+}
+
+void capture_callCreateDevice(Capture_Stream *stream, Opal_Instance *instance, uint32_t *index, Opal_Device *device)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_INSTANCE, instance);
+	capture_u32(stream, index);
+	capture_u64(stream, device);
+}
+
+void capture_callCreateDefaultDevice(Capture_Stream *stream, Opal_Instance *instance, Opal_DeviceHint *hint, Opal_Device *device)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_INSTANCE, instance);
+	capture_u32(stream, (uint32_t *)hint);
+	capture_u64(stream, device);
+}
+
+void capture_callDestroySurface(Capture_Stream *stream, Opal_Instance *instance, Opal_Surface *surface)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_INSTANCE, instance);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_SURFACE, surface);
+}
+
+void capture_callDestroyInstance(Capture_Stream *stream, Opal_Instance *instance)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_INSTANCE, instance);
+}
+
+/*
+ */
+void capture_callGetDeviceInfo(Capture_Stream *stream, Opal_Device *device)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+}
+
+void capture_callGetDeviceQueue(Capture_Stream *stream, Opal_Device *device, Opal_DeviceEngineType *engine_type, uint32_t *index, Opal_Queue *queue)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_u32(stream, (uint32_t *)engine_type);
+	capture_u32(stream, index);
+	capture_u64(stream, queue);
+}
+
+void capture_callGetAccelerationStructurePrebuildInfo(Capture_Stream *stream, Opal_Device *device, const Opal_AccelerationStructureBuildDesc **desc)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	CAPTURE_DESC(Opal_AccelerationStructureBuildDesc, capture_codecAccelerationStructureBuildDesc);
+}
+
+void capture_callGetAccelerationStructureAddress(Capture_Stream *stream, Opal_Device *device, Opal_AccelerationStructure *acceleration_structure)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_ACCELERATION_STRUCTURE, acceleration_structure);
+}
+
+void capture_callCmdAccelerationStructureBuildBatch(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, uint32_t *num_descs, const Opal_AccelerationStructureBuildDesc **descs)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, command_buffer);
+	capture_u32(stream, num_descs);
+
+	Opal_AccelerationStructureBuildDesc *ptr = (Opal_AccelerationStructureBuildDesc *)capture_array(stream, (const void **)descs, *num_descs, sizeof(Opal_AccelerationStructureBuildDesc));
+	for (uint32_t i = 0; ptr && i < *num_descs; ++i)
+		capture_codecAccelerationStructureBuildDesc(stream, &ptr[i]);
+}
+
+void capture_callGetSurfaceQuery(Capture_Stream *stream, Opal_Device *device, Opal_Surface *surface)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_SURFACE, surface);
+}
+
+/*
+ */
+void capture_callCreateSemaphore(Capture_Stream *stream, Opal_Device *device, const Opal_SemaphoreDesc **desc, Opal_Semaphore *semaphore)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	CAPTURE_DESC(Opal_SemaphoreDesc, capture_codecSemaphoreDesc);
+	capture_u64(stream, semaphore);
+}
+
+void capture_callCreateFence(Capture_Stream *stream, Opal_Device *device, Opal_Fence *fence)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_u64(stream, fence);
+}
+
+void capture_callCreateBuffer(Capture_Stream *stream, Opal_Device *device, const Opal_BufferDesc **desc, Opal_Buffer *buffer)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	CAPTURE_DESC(Opal_BufferDesc, capture_codecBufferDesc);
+	capture_u64(stream, buffer);
+}
+
+void capture_callCreateTexture(Capture_Stream *stream, Opal_Device *device, const Opal_TextureDesc **desc, Opal_Texture *texture)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	CAPTURE_DESC(Opal_TextureDesc, capture_codecTextureDesc);
+	capture_u64(stream, texture);
+}
+
+void capture_callCreateTextureView(Capture_Stream *stream, Opal_Device *device, const Opal_TextureViewDesc **desc, Opal_TextureView *texture_view)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	CAPTURE_DESC(Opal_TextureViewDesc, capture_codecTextureViewDesc);
+	capture_u64(stream, texture_view);
+}
+
+void capture_callCreateSampler(Capture_Stream *stream, Opal_Device *device, const Opal_SamplerDesc **desc, Opal_Sampler *sampler)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	CAPTURE_DESC(Opal_SamplerDesc, capture_codecSamplerDesc);
+	capture_u64(stream, sampler);
+}
+
+static void capture_codecAccelerationStructureDesc(Capture_Stream *stream, Opal_AccelerationStructureDesc *desc)
+{
+	capture_u32(stream, (uint32_t *)&desc->type);
+	capture_u64(stream, &desc->size);
+}
+
+void capture_callCreateAccelerationStructure(Capture_Stream *stream, Opal_Device *device, const Opal_AccelerationStructureDesc **desc, Opal_AccelerationStructure *acceleration_structure)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	CAPTURE_DESC(Opal_AccelerationStructureDesc, capture_codecAccelerationStructureDesc);
+	capture_u64(stream, acceleration_structure);
+}
+
+void capture_callCreateShaderBindingTable(Capture_Stream *stream, Opal_Device *device, Opal_RaytracePipeline *pipeline, Opal_ShaderBindingTable *shader_binding_table)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_RAYTRACE_PIPELINE, pipeline);
+	capture_u64(stream, shader_binding_table);
+}
+
+void capture_callCreateCommandAllocator(Capture_Stream *stream, Opal_Device *device, Opal_Queue *queue, Opal_CommandAllocator *command_allocator)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_QUEUE, queue);
+	capture_u64(stream, command_allocator);
+}
+
+void capture_callCreateCommandBuffer(Capture_Stream *stream, Opal_Device *device, Opal_CommandAllocator *command_allocator, Opal_CommandBuffer *command_buffer)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_ALLOCATOR, command_allocator);
+	capture_u64(stream, command_buffer);
+}
+
+void capture_callCreateShader(Capture_Stream *stream, Opal_Device *device, const Opal_ShaderDesc **desc, Opal_Shader *shader)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	CAPTURE_DESC(Opal_ShaderDesc, capture_codecShaderDesc);
+	capture_u64(stream, shader);
+}
+
+static void capture_codecDescriptorHeapDesc(Capture_Stream *stream, Opal_DescriptorHeapDesc *desc)
+{
+	capture_u32(stream, &desc->num_resource_descriptors);
+	capture_u32(stream, &desc->num_sampler_descriptors);
+}
+
+void capture_callCreateDescriptorHeap(Capture_Stream *stream, Opal_Device *device, const Opal_DescriptorHeapDesc **desc, Opal_DescriptorHeap *descriptor_heap)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	CAPTURE_DESC(Opal_DescriptorHeapDesc, capture_codecDescriptorHeapDesc);
+	capture_u64(stream, descriptor_heap);
+}
+
+void capture_callCreateDescriptorSetLayout(Capture_Stream *stream, Opal_Device *device, uint32_t *num_entries, const Opal_DescriptorSetLayoutEntry **entries, Opal_DescriptorSetLayout *descriptor_set_layout)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_u32(stream, num_entries);
+
+	Opal_DescriptorSetLayoutEntry *ptr = (Opal_DescriptorSetLayoutEntry *)capture_array(stream, (const void **)entries, *num_entries, sizeof(Opal_DescriptorSetLayoutEntry));
+	for (uint32_t i = 0; ptr && i < *num_entries; ++i)
+	{
+		capture_u32(stream, &ptr[i].binding);
+		capture_u32(stream, (uint32_t *)&ptr[i].type);
+		capture_u32(stream, (uint32_t *)&ptr[i].visibility);
+		capture_u32(stream, (uint32_t *)&ptr[i].texture_format);
+	}
+
+	capture_u64(stream, descriptor_set_layout);
+}
+
+void capture_callCreatePipelineLayout(Capture_Stream *stream, Opal_Device *device, uint32_t *num_descriptor_set_layouts, const Opal_DescriptorSetLayout **descriptor_set_layouts, Opal_PipelineLayout *pipeline_layout)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_u32(stream, num_descriptor_set_layouts);
+	capture_handles(stream, CAPTURE_HANDLE_TYPE_DESCRIPTOR_SET_LAYOUT, descriptor_set_layouts, *num_descriptor_set_layouts);
+	capture_u64(stream, pipeline_layout);
+}
+
+void capture_callCreateGraphicsPipeline(Capture_Stream *stream, Opal_Device *device, const Opal_GraphicsPipelineDesc **desc, Opal_GraphicsPipeline *pipeline)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	CAPTURE_DESC(Opal_GraphicsPipelineDesc, capture_codecGraphicsPipelineDesc);
+	capture_u64(stream, pipeline);
+}
+
+void capture_callCreateMeshletPipeline(Capture_Stream *stream, Opal_Device *device, const Opal_MeshletPipelineDesc **desc, Opal_GraphicsPipeline *pipeline)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	CAPTURE_DESC(Opal_MeshletPipelineDesc, capture_codecMeshletPipelineDesc);
+	capture_u64(stream, pipeline);
+}
+
+void capture_callCreateComputePipeline(Capture_Stream *stream, Opal_Device *device, const Opal_ComputePipelineDesc **desc, Opal_ComputePipeline *pipeline)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	CAPTURE_DESC(Opal_ComputePipelineDesc, capture_codecComputePipelineDesc);
+	capture_u64(stream, pipeline);
+}
+
+void capture_callCreateRaytracePipeline(Capture_Stream *stream, Opal_Device *device, const Opal_RaytracePipelineDesc **desc, Opal_RaytracePipeline *pipeline)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	CAPTURE_DESC(Opal_RaytracePipelineDesc, capture_codecRaytracePipelineDesc);
+	capture_u64(stream, pipeline);
+}
+
+void capture_callCreateSwapchain(Capture_Stream *stream, Opal_Device *device, const Opal_SwapchainDesc **desc, Opal_Swapchain *swapchain)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	CAPTURE_DESC(Opal_SwapchainDesc, capture_codecSwapchainDesc);
+	capture_u64(stream, swapchain);
+}
+
+/*
+ */
+void capture_callDestroyObject(Capture_Stream *stream, Opal_Device *device, Capture_HandleType type, uint64_t *handle)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, type, handle);
+}
+
+void capture_callDestroyDevice(Capture_Stream *stream, Opal_Device *device)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+}
+
+/*
+ */
+static void capture_codecShaderBindingTableBuildDesc(Capture_Stream *stream, Opal_ShaderBindingTableBuildDesc *desc)
+{
+	capture_u32(stream, &desc->num_raygen_indices);
+	capture_u32s(stream, &desc->raygen_indices, desc->num_raygen_indices);
+	capture_u32(stream, &desc->num_miss_indices);
+	capture_u32s(stream, &desc->miss_indices, desc->num_miss_indices);
+	capture_u32(stream, &desc->num_intersection_indices);
+	capture_u32s(stream, &desc->intersection_indices, desc->num_intersection_indices);
+}
+
+void capture_callBuildShaderBindingTable(Capture_Stream *stream, Opal_Device *device, Opal_ShaderBindingTable *shader_binding_table, const Opal_ShaderBindingTableBuildDesc **desc)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_SHADER_BINDING_TABLE, shader_binding_table);
+	CAPTURE_DESC(Opal_ShaderBindingTableBuildDesc, capture_codecShaderBindingTableBuildDesc);
+}
+
+static void capture_codecAccelerationStructureInstanceBufferBuildDesc(Capture_Stream *stream, Opal_AccelerationStructureInstanceBufferBuildDesc *desc)
+{
+	capture_codecBufferView(stream, &desc->buffer);
+	capture_u32(stream, &desc->num_instances);
+
+	Opal_AccelerationStructureInstance *instances = (Opal_AccelerationStructureInstance *)capture_array(stream, (const void **)&desc->instances, desc->num_instances, sizeof(Opal_AccelerationStructureInstance));
+	for (uint32_t i = 0; instances && i < desc->num_instances; ++i)
+		capture_codecAccelerationStructureInstance(stream, &instances[i]);
+
+	// note: blas addresses are device specific and not recorded, replay resolves the blas handles
+}
+
+void capture_callBuildAccelerationStructureInstanceBuffer(Capture_Stream *stream, Opal_Device *device, const Opal_AccelerationStructureInstanceBufferBuildDesc **desc)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	CAPTURE_DESC(Opal_AccelerationStructureInstanceBufferBuildDesc, capture_codecAccelerationStructureInstanceBufferBuildDesc);
+}
+
+void capture_callResetCommandAllocator(Capture_Stream *stream, Opal_Device *device, Opal_CommandAllocator *command_allocator)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_ALLOCATOR, command_allocator);
+}
+
+void capture_callAllocateDescriptorSet(Capture_Stream *stream, Opal_Device *device, const Opal_DescriptorSetAllocationDesc **desc, const Capture_DescriptorEntryType *entry_types, Opal_DescriptorSet *descriptor_set)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+
+	Opal_DescriptorSetAllocationDesc *ptr = (Opal_DescriptorSetAllocationDesc *)capture_array(stream, (const void **)desc, 1, sizeof(Opal_DescriptorSetAllocationDesc));
+	if (ptr)
+	{
+		capture_handle(stream, CAPTURE_HANDLE_TYPE_DESCRIPTOR_SET_LAYOUT, &ptr->layout);
+		capture_handle(stream, CAPTURE_HANDLE_TYPE_DESCRIPTOR_HEAP, &ptr->heap);
+		capture_u32(stream, &ptr->num_entries);
+		capture_codecDescriptorSetEntries(stream, ptr->num_entries, &ptr->entries, entry_types);
+	}
+
+	capture_u64(stream, descriptor_set);
+}
+
+void capture_callFreeDescriptorSet(Capture_Stream *stream, Opal_Device *device, Opal_DescriptorSet *descriptor_set)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DESCRIPTOR_SET, descriptor_set);
+}
+
+void capture_callMapBuffer(Capture_Stream *stream, Opal_Device *device, Opal_Buffer *buffer)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_BUFFER, buffer);
+}
+
+void capture_callUnmapBuffer(Capture_Stream *stream, Opal_Device *device, Opal_Buffer *buffer)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_BUFFER, buffer);
+}
+
+void capture_callWriteBuffer(Capture_Stream *stream, Opal_Device *device, Opal_Buffer *buffer, uint64_t *offset, const void **data, uint64_t *size)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_BUFFER, buffer);
+	capture_u64(stream, offset);
+	capture_u64(stream, size);
+	capture_data(stream, data, *size);
+}
+
+void capture_callUpdateDescriptorSet(Capture_Stream *stream, Opal_Device *device, Opal_DescriptorSet *descriptor_set, uint32_t *num_entries, const Opal_DescriptorSetEntry **entries, const Capture_DescriptorEntryType *entry_types)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DESCRIPTOR_SET, descriptor_set);
+	capture_u32(stream, num_entries);
+	capture_codecDescriptorSetEntries(stream, *num_entries, entries, entry_types);
+}
+
+void capture_callBeginCommandBuffer(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, command_buffer);
+}
+
+void capture_callEndCommandBuffer(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, command_buffer);
+}
+
+void capture_callQuerySemaphore(Capture_Stream *stream, Opal_Device *device, Opal_Semaphore *semaphore)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_SEMAPHORE, semaphore);
+}
+
+void capture_callSignalSemaphore(Capture_Stream *stream, Opal_Device *device, Opal_Semaphore *semaphore, uint64_t *value)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_SEMAPHORE, semaphore);
+	capture_u64(stream, value);
+}
+
+void capture_callWaitSemaphore(Capture_Stream *stream, Opal_Device *device, Opal_Semaphore *semaphore, uint64_t *value, uint64_t *timeout_milliseconds)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_SEMAPHORE, semaphore);
+	capture_u64(stream, value);
+	capture_u64(stream, timeout_milliseconds);
+}
+
+void capture_callWaitSemaphores(Capture_Stream *stream, Opal_Device *device, uint32_t *num_semaphores, const Opal_Semaphore **semaphores, const uint64_t **values, uint32_t *wait_any, uint64_t *timeout_milliseconds)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_u32(stream, num_semaphores);
+	capture_handles(stream, CAPTURE_HANDLE_TYPE_SEMAPHORE, semaphores, *num_semaphores);
+	capture_u64s(stream, values, *num_semaphores);
+	capture_u32(stream, wait_any);
+	capture_u64(stream, timeout_milliseconds);
+}
+
+void capture_callWaitQueue(Capture_Stream *stream, Opal_Device *device, Opal_Queue *queue)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_QUEUE, queue);
+}
+
+void capture_callWaitIdle(Capture_Stream *stream, Opal_Device *device)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+}
+
+void capture_callSubmit(Capture_Stream *stream, Opal_Device *device, Opal_Queue *queue, const Opal_SubmitDesc **desc)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_QUEUE, queue);
+	CAPTURE_DESC(Opal_SubmitDesc, capture_codecSubmitDesc);
+}
+
+void capture_callAcquire(Capture_Stream *stream, Opal_Device *device, Opal_Swapchain *swapchain, Opal_TextureView *texture_view)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_SWAPCHAIN, swapchain);
+	capture_u64(stream, texture_view);
+}
+
+void capture_callPresent(Capture_Stream *stream, Opal_Device *device, Opal_Swapchain *swapchain)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_SWAPCHAIN, swapchain);
+}
+
+void capture_callWaitPresent(Capture_Stream *stream, Opal_Device *device, Opal_Swapchain *swapchain, uint64_t *frame_id, uint64_t *timeout_milliseconds)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_SWAPCHAIN, swapchain);
+	capture_u64(stream, frame_id);
+	capture_u64(stream, timeout_milliseconds);
+}
+
+void capture_callGetSwapchainFrameTiming(Capture_Stream *stream, Opal_Device *device, Opal_Swapchain *swapchain)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_SWAPCHAIN, swapchain);
+}
+
+/*
+ */
+void capture_callCmdSetDescriptorHeap(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, Opal_DescriptorHeap *descriptor_heap)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, command_buffer);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DESCRIPTOR_HEAP, descriptor_heap);
+}
+
+void capture_callCmdBeginPass(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, const Opal_PassBarriersDesc **barriers)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, command_buffer);
+
+	Opal_PassBarriersDesc *ptr = (Opal_PassBarriersDesc *)capture_array(stream, (const void **)barriers, 1, sizeof(Opal_PassBarriersDesc));
+	if (ptr)
+		capture_codecPassBarriersDesc(stream, ptr);
+}
+
+void capture_callCmdBeginGraphicsPass(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, const Opal_FramebufferDesc **desc, const Opal_PassBarriersDesc **barriers)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, command_buffer);
+
+	CAPTURE_DESC(Opal_FramebufferDesc, capture_codecFramebufferDesc);
+
+	Opal_PassBarriersDesc *barriers_ptr = (Opal_PassBarriersDesc *)capture_array(stream, (const void **)barriers, 1, sizeof(Opal_PassBarriersDesc));
+	if (barriers_ptr)
+		capture_codecPassBarriersDesc(stream, barriers_ptr);
+}
+
+void capture_callCmdSetObject(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, Capture_HandleType type, uint64_t *handle)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, command_buffer);
+	capture_handle(stream, type, handle);
+}
+
+void capture_callCmdSetDescriptorSet(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, uint32_t *index, Opal_DescriptorSet *descriptor_set, uint32_t *num_dynamic_offsets, const uint32_t **dynamic_offsets)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, command_buffer);
+	capture_u32(stream, index);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DESCRIPTOR_SET, descriptor_set);
+	capture_u32(stream, num_dynamic_offsets);
+	capture_u32s(stream, dynamic_offsets, *num_dynamic_offsets);
+}
+
+void capture_callCmdGraphicsSetVertexBuffers(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, uint32_t *first_index, uint32_t *num_vertex_buffers, const Opal_VertexBufferView **vertex_buffers)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, command_buffer);
+	capture_u32(stream, first_index);
+	capture_u32(stream, num_vertex_buffers);
+
+	Opal_VertexBufferView *ptr = (Opal_VertexBufferView *)capture_array(stream, (const void **)vertex_buffers, *num_vertex_buffers, sizeof(Opal_VertexBufferView));
+	for (uint32_t i = 0; ptr && i < *num_vertex_buffers; ++i)
+		capture_codecVertexBufferView(stream, &ptr[i]);
+}
+
+void capture_callCmdGraphicsSetIndexBuffer(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, Opal_IndexBufferView *index_buffer)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, command_buffer);
+	capture_codecIndexBufferView(stream, index_buffer);
+}
+
+void capture_callCmdGraphicsSetViewport(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, Opal_Viewport *viewport)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, command_buffer);
+	capture_f32(stream, &viewport->x);
+	capture_f32(stream, &viewport->y);
+	capture_f32(stream, &viewport->width);
+	capture_f32(stream, &viewport->height);
+	capture_f32(stream, &viewport->min_depth);
+	capture_f32(stream, &viewport->max_depth);
+}
+
+void capture_callCmdGraphicsSetScissor(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, uint32_t *x, uint32_t *y, uint32_t *width, uint32_t *height)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, command_buffer);
+	capture_u32(stream, x);
+	capture_u32(stream, y);
+	capture_u32(stream, width);
+	capture_u32(stream, height);
+}
+
+void capture_callCmdGraphicsDraw(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, uint32_t *num_vertices, uint32_t *num_instances, uint32_t *base_vertex, uint32_t *base_instance)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, command_buffer);
+	capture_u32(stream, num_vertices);
+	capture_u32(stream, num_instances);
+	capture_u32(stream, base_vertex);
+	capture_u32(stream, base_instance);
+}
+
+void capture_callCmdGraphicsDrawIndexed(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, uint32_t *num_indices, uint32_t *num_instances, uint32_t *base_index, int32_t *vertex_offset, uint32_t *base_instance)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, command_buffer);
+	capture_u32(stream, num_indices);
+	capture_u32(stream, num_instances);
+	capture_u32(stream, base_index);
+	capture_u32(stream, (uint32_t *)vertex_offset);
+	capture_u32(stream, base_instance);
+}
+
+void capture_callCmdDispatch(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, uint32_t *x, uint32_t *y, uint32_t *z)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, command_buffer);
+	capture_u32(stream, x);
+	capture_u32(stream, y);
+	capture_u32(stream, z);
+}
+
+void capture_callCmdMemoryBarrier(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, const Opal_MemoryBarrierDesc **barriers)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, command_buffer);
+
+	Opal_MemoryBarrierDesc *ptr = (Opal_MemoryBarrierDesc *)capture_array(stream, (const void **)barriers, 1, sizeof(Opal_MemoryBarrierDesc));
+	if (ptr)
+		capture_codecMemoryBarrierDesc(stream, ptr);
+}
+
+void capture_callCmdCopyBufferToBuffer(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, Opal_Buffer *src_buffer, uint64_t *src_offset, Opal_Buffer *dst_buffer, uint64_t *dst_offset, uint64_t *size)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, command_buffer);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_BUFFER, src_buffer);
+	capture_u64(stream, src_offset);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_BUFFER, dst_buffer);
+	capture_u64(stream, dst_offset);
+	capture_u64(stream, size);
+}
+
+void capture_callCmdCopyBufferToTexture(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, Opal_BufferTextureRegion *src, Opal_TextureRegion *dst, Opal_Extent3D *size)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, command_buffer);
+	capture_codecBufferTextureRegion(stream, src);
+	capture_codecTextureRegion(stream, dst);
+	capture_codecExtent3D(stream, size);
+}
+
+void capture_callCmdCopyTextureToBuffer(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, Opal_TextureRegion *src, Opal_BufferTextureRegion *dst, Opal_Extent3D *size)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, command_buffer);
+	capture_codecTextureRegion(stream, src);
+	capture_codecBufferTextureRegion(stream, dst);
+	capture_codecExtent3D(stream, size);
+}
+
+void capture_callCmdCopyBufferToTextureRegions(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, Opal_Buffer *src_buffer, Opal_Texture *dst_texture, uint32_t *num_regions, const Opal_BufferTextureCopyRegion **regions)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, command_buffer);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_BUFFER, src_buffer);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_TEXTURE, dst_texture);
+	capture_u32(stream, num_regions);
+	capture_codecBufferTextureCopyRegions(stream, *num_regions, regions);
+}
+
+void capture_callCmdCopyTextureToBufferRegions(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, Opal_Texture *src_texture, Opal_Buffer *dst_buffer, uint32_t *num_regions, const Opal_BufferTextureCopyRegion **regions)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, command_buffer);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_TEXTURE, src_texture);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_BUFFER, dst_buffer);
+	capture_u32(stream, num_regions);
+	capture_codecBufferTextureCopyRegions(stream, *num_regions, regions);
+}
+
+void capture_callCmdCopyTextureToTexture(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, Opal_TextureRegion *src, Opal_TextureRegion *dst, Opal_Extent3D *size)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, command_buffer);
+	capture_codecTextureRegion(stream, src);
+	capture_codecTextureRegion(stream, dst);
+	capture_codecExtent3D(stream, size);
+}
+
+void capture_callCmdFillBuffer(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, Opal_Buffer *buffer, uint64_t *offset, uint64_t *size, uint32_t *value)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, command_buffer);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_BUFFER, buffer);
+	capture_u64(stream, offset);
+	capture_u64(stream, size);
+	capture_u32(stream, value);
+}
+
+void capture_callCmdUpdateBuffer(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, Opal_Buffer *buffer, uint64_t *offset, uint64_t *size, const void **data)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, command_buffer);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_BUFFER, buffer);
+	capture_u64(stream, offset);
+	capture_u64(stream, size);
+	capture_data(stream, data, *size);
+}
+
+void capture_callCmdClearTexture(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, Opal_TextureView *texture_view, Opal_ClearValue *clear_value)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, command_buffer);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_TEXTURE_VIEW, texture_view);
+
+	// note: clear value is a union of 32-bit scalars, store raw bits
+	for (uint32_t i = 0; i < 4; ++i)
+		capture_u32(stream, &clear_value->color.u[i]);
+}
+
+void capture_callCmdBlitTexture(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, Opal_TextureRegion *src, Opal_Extent3D *src_size, Opal_TextureRegion *dst, Opal_Extent3D *dst_size, Opal_SamplerFilterMode *filter)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, command_buffer);
+	capture_codecTextureRegion(stream, src);
+	capture_codecExtent3D(stream, src_size);
+	capture_codecTextureRegion(stream, dst);
+	capture_codecExtent3D(stream, dst_size);
+	capture_u32(stream, (uint32_t *)filter);
+}
+
+void capture_callCmdGenerateMips(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, Opal_TextureView *texture_view)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, command_buffer);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_TEXTURE_VIEW, texture_view);
+}
+
+void capture_callCmdAccelerationStructureBuild(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, const Opal_AccelerationStructureBuildDesc **desc)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, command_buffer);
+	CAPTURE_DESC(Opal_AccelerationStructureBuildDesc, capture_codecAccelerationStructureBuildDesc);
+}
+
+static void capture_codecAccelerationStructureCopyDesc(Capture_Stream *stream, Opal_AccelerationStructureCopyDesc *desc)
+{
+	capture_u32(stream, (uint32_t *)&desc->copy_mode);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_ACCELERATION_STRUCTURE, &desc->src_acceleration_structure);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_ACCELERATION_STRUCTURE, &desc->dst_acceleration_structure);
+}
+
+void capture_callCmdAccelerationStructureCopy(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, const Opal_AccelerationStructureCopyDesc **desc)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, command_buffer);
+	CAPTURE_DESC(Opal_AccelerationStructureCopyDesc, capture_codecAccelerationStructureCopyDesc);
+}
+
+void capture_callCmdAccelerationStructureWriteCompactedSizes(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, uint32_t *num_acceleration_structures, const Opal_AccelerationStructure **acceleration_structures, Opal_BufferView *dst)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, command_buffer);
+	capture_u32(stream, num_acceleration_structures);
+	capture_handles(stream, CAPTURE_HANDLE_TYPE_ACCELERATION_STRUCTURE, acceleration_structures, *num_acceleration_structures);
+	capture_codecBufferView(stream, dst);
+}
+
+/*
+ */
+void capture_callBufferData(Capture_Stream *stream, Opal_Device *device, Opal_Buffer *buffer, uint64_t *offset, uint64_t *size, const void **data)
+{
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_DEVICE, device);
+	capture_handle(stream, CAPTURE_HANDLE_TYPE_BUFFER, buffer);
+	capture_u64(stream, offset);
+	capture_u64(stream, size);
+	capture_data(stream, data, *size);
+}
@@ -0,0 +1,367 @@
+#pragma once
+
+#include <opal.h>
+#include <stdio.h>
+
+#include "common/bump.h"
+
+#define CAPTURE_FILE_MAGIC 0x4C41504F // 'OPAL'
+#define CAPTURE_FILE_VERSION 2
+
+typedef enum Capture_Call_t
+{
+	CAPTURE_CALL_CREATE_INSTANCE = 0,
+
+	CAPTURE_CALL_ENUMERATE_DEVICES,
+	CAPTURE_CALL_CREATE_SURFACE,
+	CAPTURE_CALL_CREATE_DEVICE,
+	CAPTURE_CALL_CREATE_DEFAULT_DEVICE,
+	CAPTURE_CALL_DESTROY_SURFACE,
+	CAPTURE_CALL_DESTROY_INSTANCE,
+
+	CAPTURE_CALL_GET_DEVICE_INFO,
+	CAPTURE_CALL_GET_DEVICE_QUEUE,
+	CAPTURE_CALL_GET_ACCELERATION_STRUCTURE_PREBUILD_INFO,
+	CAPTURE_CALL_GET_SUPPORTED_SURFACE_FORMATS,
+	CAPTURE_CALL_GET_SUPPORTED_PRESENT_MODES,
+	CAPTURE_CALL_GET_PREFERRED_SURFACE_FORMAT,
+	CAPTURE_CALL_GET_PREFERRED_SURFACE_PRESENT_MODE,
+
+	CAPTURE_CALL_CREATE_SEMAPHORE,
+	CAPTURE_CALL_CREATE_FENCE,
+	CAPTURE_CALL_CREATE_BUFFER,
+	CAPTURE_CALL_CREATE_TEXTURE,
+	CAPTURE_CALL_CREATE_TEXTURE_VIEW,
+	CAPTURE_CALL_CREATE_SAMPLER,
+	CAPTURE_CALL_CREATE_ACCELERATION_STRUCTURE,
+	CAPTURE_CALL_CREATE_SHADER_BINDING_TABLE,
+	CAPTURE_CALL_CREATE_COMMAND_ALLOCATOR,
+	CAPTURE_CALL_CREATE_COMMAND_BUFFER,
+	CAPTURE_CALL_CREATE_SHADER,
+	CAPTURE_CALL_CREATE_DESCRIPTOR_HEAP,
+	CAPTURE_CALL_CREATE_DESCRIPTOR_SET_LAYOUT,
+	CAPTURE_CALL_CREATE_PIPELINE_LAYOUT,
+	CAPTURE_CALL_CREATE_GRAPHICS_PIPELINE,
+	CAPTURE_CALL_CREATE_MESHLET_PIPELINE,
+	CAPTURE_CALL_CREATE_COMPUTE_PIPELINE,
+	CAPTURE_CALL_CREATE_RAYTRACE_PIPELINE,
+	CAPTURE_CALL_CREATE_SWAPCHAIN,
+
+	CAPTURE_CALL_DESTROY_SEMAPHORE,
+	CAPTURE_CALL_DESTROY_FENCE,
+	CAPTURE_CALL_DESTROY_BUFFER,
+	CAPTURE_CALL_DESTROY_TEXTURE,
+	CAPTURE_CALL_DESTROY_TEXTURE_VIEW,
+	CAPTURE_CALL_DESTROY_SAMPLER,
+	CAPTURE_CALL_DESTROY_ACCELERATION_STRUCTURE,
+	CAPTURE_CALL_DESTROY_SHADER_BINDING_TABLE,
+	CAPTURE_CALL_DESTROY_COMMAND_ALLOCATOR,
+	CAPTURE_CALL_DESTROY_COMMAND_BUFFER,
+	CAPTURE_CALL_DESTROY_SHADER,
+	CAPTURE_CALL_DESTROY_DESCRIPTOR_HEAP,
+	CAPTURE_CALL_DESTROY_DESCRIPTOR_SET_LAYOUT,
+	CAPTURE_CALL_DESTROY_PIPELINE_LAYOUT,
+	CAPTURE_CALL_DESTROY_GRAPHICS_PIPELINE,
+	CAPTURE_CALL_DESTROY_COMPUTE_PIPELINE,
+	CAPTURE_CALL_DESTROY_RAYTRACE_PIPELINE,
+	CAPTURE_CALL_DESTROY_SWAPCHAIN,
+	CAPTURE_CALL_DESTROY_DEVICE,
+
+	CAPTURE_CALL_BUILD_SHADER_BINDING_TABLE,
+	CAPTURE_CALL_BUILD_ACCELERATION_STRUCTURE_INSTANCE_BUFFER,
+	CAPTURE_CALL_RESET_COMMAND_ALLOCATOR,
+	CAPTURE_CALL_ALLOCATE_DESCRIPTOR_SET,
+	CAPTURE_CALL_FREE_DESCRIPTOR_SET,
+	CAPTURE_CALL_MAP_BUFFER,
+	CAPTURE_CALL_UNMAP_BUFFER,
+	CAPTURE_CALL_WRITE_BUFFER,
+	CAPTURE_CALL_UPDATE_DESCRIPTOR_SET,
+	CAPTURE_CALL_BEGIN_COMMAND_BUFFER,
+	CAPTURE_CALL_END_COMMAND_BUFFER,
+	CAPTURE_CALL_QUERY_SEMAPHORE,
+	CAPTURE_CALL_SIGNAL_SEMAPHORE,
+	CAPTURE_CALL_WAIT_SEMAPHORE,
+	CAPTURE_CALL_WAIT_QUEUE,
+	CAPTURE_CALL_WAIT_IDLE,
+	CAPTURE_CALL_SUBMIT,
+	CAPTURE_CALL_ACQUIRE,
+	CAPTURE_CALL_PRESENT,
+
+	CAPTURE_CALL_CMD_SET_DESCRIPTOR_HEAP,
+
+	CAPTURE_CALL_CMD_BEGIN_GRAPHICS_PASS,
+	CAPTURE_CALL_CMD_GRAPHICS_SET_PIPELINE_LAYOUT,
+	CAPTURE_CALL_CMD_GRAPHICS_SET_PIPELINE,
+	CAPTURE_CALL_CMD_GRAPHICS_SET_DESCRIPTOR_SET,
+	CAPTURE_CALL_CMD_GRAPHICS_SET_VERTEX_BUFFERS,
+	CAPTURE_CALL_CMD_GRAPHICS_SET_INDEX_BUFFER,
+	CAPTURE_CALL_CMD_GRAPHICS_SET_VIEWPORT,
+	CAPTURE_CALL_CMD_GRAPHICS_SET_SCISSOR,
+	CAPTURE_CALL_CMD_GRAPHICS_DRAW,
+	CAPTURE_CALL_CMD_GRAPHICS_DRAW_INDEXED,
+	CAPTURE_CALL_CMD_GRAPHICS_MESHLET_DISPATCH,
+	CAPTURE_CALL_CMD_END_GRAPHICS_PASS,
+
+	CAPTURE_CALL_CMD_BEGIN_COMPUTE_PASS,
+	CAPTURE_CALL_CMD_COMPUTE_SET_PIPELINE_LAYOUT,
+	CAPTURE_CALL_CMD_COMPUTE_SET_PIPELINE,
+	CAPTURE_CALL_CMD_COMPUTE_SET_DESCRIPTOR_SET,
+	CAPTURE_CALL_CMD_COMPUTE_MEMORY_BARRIER,
+	CAPTURE_CALL_CMD_COMPUTE_DISPATCH,
+	CAPTURE_CALL_CMD_END_COMPUTE_PASS,
+
+	CAPTURE_CALL_CMD_BEGIN_RAYTRACE_PASS,
+	CAPTURE_CALL_CMD_RAYTRACE_SET_PIPELINE_LAYOUT,
+	CAPTURE_CALL_CMD_RAYTRACE_SET_PIPELINE,
+	CAPTURE_CALL_CMD_RAYTRACE_SET_DESCRIPTOR_SET,
+	CAPTURE_CALL_CMD_RAYTRACE_SET_SHADER_BINDING_TABLE,
+	CAPTURE_CALL_CMD_RAYTRACE_MEMORY_BARRIER,
+	CAPTURE_CALL_CMD_RAYTRACE_DISPATCH,
+	CAPTURE_CALL_CMD_END_RAYTRACE_PASS,
+
+	CAPTURE_CALL_CMD_BEGIN_COPY_PASS,
+	CAPTURE_CALL_CMD_COPY_BUFFER_TO_BUFFER,
+	CAPTURE_CALL_CMD_COPY_BUFFER_TO_TEXTURE,
+	CAPTURE_CALL_CMD_COPY_TEXTURE_TO_BUFFER,
+	CAPTURE_CALL_CMD_COPY_TEXTURE_TO_TEXTURE,
+	CAPTURE_CALL_CMD_END_COPY_PASS,
+
+	CAPTURE_CALL_CMD_BEGIN_ACCELERATION_STRUCTURE_PASS,
+	CAPTURE_CALL_CMD_ACCELERATION_STRUCTURE_BUILD,
+	CAPTURE_CALL_CMD_ACCELERATION_STRUCTURE_COPY,
+	CAPTURE_CALL_CMD_END_ACCELERATION_STRUCTURE_PASS,
+
+	// note: not an API call, contents of mapped memory written by the application since the last flush
+	CAPTURE_CALL_BUFFER_DATA,
+
+	// note: never written to the stream, batch & async pipeline creation is recorded as individual
+	//       create calls; the ids exist so the profiler can report these calls by name
+	CAPTURE_CALL_CREATE_GRAPHICS_PIPELINES,
+	CAPTURE_CALL_CREATE_COMPUTE_PIPELINES,
+	CAPTURE_CALL_CREATE_RAYTRACE_PIPELINES,
+	CAPTURE_CALL_CREATE_GRAPHICS_PIPELINES_ASYNC,
+	CAPTURE_CALL_CREATE_COMPUTE_PIPELINES_ASYNC,
+	CAPTURE_CALL_CREATE_RAYTRACE_PIPELINES_ASYNC,
+	CAPTURE_CALL_WAIT_PIPELINE_TASK,
+
+	// note: appended after the other calls so ids stored in existing captures stay valid
+	CAPTURE_CALL_WAIT_SEMAPHORES,
+
+	// note: never written to the stream, callbacks can't be replayed
+	CAPTURE_CALL_REGISTER_SEMAPHORE_CALLBACK,
+
+	CAPTURE_CALL_CMD_ACCELERATION_STRUCTURE_BUILD_BATCH,
+	CAPTURE_CALL_CMD_ACCELERATION_STRUCTURE_WRITE_COMPACTED_SIZES,
+	CAPTURE_CALL_GET_ACCELERATION_STRUCTURE_ADDRESS,
+	CAPTURE_CALL_CMD_COPY_BUFFER_TO_TEXTURE_REGIONS,
+	CAPTURE_CALL_CMD_COPY_TEXTURE_TO_BUFFER_REGIONS,
+	CAPTURE_CALL_CMD_FILL_BUFFER,
+	CAPTURE_CALL_CMD_UPDATE_BUFFER,
+	CAPTURE_CALL_CMD_CLEAR_TEXTURE,
+	CAPTURE_CALL_CMD_BLIT_TEXTURE,
+	CAPTURE_CALL_CMD_GENERATE_MIPS,
+	CAPTURE_CALL_WAIT_PRESENT,
+	CAPTURE_CALL_GET_SWAPCHAIN_FRAME_TIMING,
+	CAPTURE_CALL_CREATE_HEADLESS_SURFACE,
+
+	CAPTURE_CALL_ENUM_MAX,
+	CAPTURE_CALL_ENUM_FORCE32 = 0x7FFFFFFF,
+} Capture_Call;
+
+typedef enum Capture_HandleType_t
+{
+	CAPTURE_HANDLE_TYPE_INSTANCE = 0,
+	CAPTURE_HANDLE_TYPE_SURFACE,
+	CAPTURE_HANDLE_TYPE_DEVICE,
+	CAPTURE_HANDLE_TYPE_QUEUE,
+	CAPTURE_HANDLE_TYPE_SEMAPHORE,
+	CAPTURE_HANDLE_TYPE_FENCE,
+	CAPTURE_HANDLE_TYPE_BUFFER,
+	CAPTURE_HANDLE_TYPE_TEXTURE,
+	CAPTURE_HANDLE_TYPE_TEXTURE_VIEW,
+	CAPTURE_HANDLE_TYPE_SAMPLER,
+	CAPTURE_HANDLE_TYPE_ACCELERATION_STRUCTURE,
+	CAPTURE_HANDLE_TYPE_SHADER_BINDING_TABLE,
+	CAPTURE_HANDLE_TYPE_COMMAND_ALLOCATOR,
+	CAPTURE_HANDLE_TYPE_COMMAND_BUFFER,
+	CAPTURE_HANDLE_TYPE_SHADER,
+	CAPTURE_HANDLE_TYPE_DESCRIPTOR_HEAP,
+	CAPTURE_HANDLE_TYPE_DESCRIPTOR_SET_LAYOUT,
+	CAPTURE_HANDLE_TYPE_DESCRIPTOR_SET,
+	CAPTURE_HANDLE_TYPE_PIPELINE_LAYOUT,
+	CAPTURE_HANDLE_TYPE_GRAPHICS_PIPELINE,
+	CAPTURE_HANDLE_TYPE_COMPUTE_PIPELINE,
+	CAPTURE_HANDLE_TYPE_RAYTRACE_PIPELINE,
+	CAPTURE_HANDLE_TYPE_SWAPCHAIN,
+
+	CAPTURE_HANDLE_TYPE_ENUM_MAX,
+	CAPTURE_HANDLE_TYPE_ENUM_FORCE32 = 0x7FFFFFFF,
+} Capture_HandleType;
+
+typedef enum Capture_DescriptorEntryType_t
+{
+	CAPTURE_DESCRIPTOR_ENTRY_TYPE_UNKNOWN = 0,
+	CAPTURE_DESCRIPTOR_ENTRY_TYPE_BUFFER,
+	CAPTURE_DESCRIPTOR_ENTRY_TYPE_TEXTURE_VIEW,
+	CAPTURE_DESCRIPTOR_ENTRY_TYPE_SAMPLER,
+	CAPTURE_DESCRIPTOR_ENTRY_TYPE_ACCELERATION_STRUCTURE,
+
+	CAPTURE_DESCRIPTOR_ENTRY_TYPE_ENUM_MAX,
+	CAPTURE_DESCRIPTOR_ENTRY_TYPE_ENUM_FORCE32 = 0x7FFFFFFF,
+} Capture_DescriptorEntryType;
+
+typedef enum Capture_StreamMode_t
+{
+	CAPTURE_STREAM_MODE_WRITE = 0,
+	CAPTURE_STREAM_MODE_READ,
+
+	CAPTURE_STREAM_MODE_ENUM_MAX,
+	CAPTURE_STREAM_MODE_ENUM_FORCE32 = 0x7FFFFFFF,
+} Capture_StreamMode;
+
+typedef struct Capture_FileHeader_t
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t api;
+	uint32_t reserved;
+} Capture_FileHeader;
+
+typedef struct Capture_RecordHeader_t
+{
+	uint32_t call;
+	uint32_t result;
+	uint64_t size;
+} Capture_RecordHeader;
+
+typedef uint64_t (*PFN_captureRemapHandle)(void *user_data, Capture_HandleType type, uint64_t handle);
+
+typedef struct Capture_Stream_t
+{
+	FILE *file;
+	Capture_StreamMode mode;
+	Opal_Bump record;
+	uint32_t offset;
+	uint32_t overflow;
+	void **allocations;
+	uint32_t num_allocations;
+	uint32_t allocations_capacity;
+	PFN_captureRemapHandle remap;
+	void *user_data;
+} Capture_Stream;
+
+Opal_Result capture_streamOpenWrite(Capture_Stream *stream, const char *path, Opal_Api api);
+Opal_Result capture_streamOpenRead(Capture_Stream *stream, const char *path, Capture_FileHeader *header, PFN_captureRemapHandle remap, void *user_data);
+Opal_Result capture_streamClose(Capture_Stream *stream);
+
+void capture_beginRecord(Capture_Stream *stream);
+Opal_Result capture_endRecord(Capture_Stream *stream, Capture_Call call, Opal_Result result);
+Opal_Result capture_readRecord(Capture_Stream *stream, Capture_Call *call, Opal_Result *result);
+
+const char *capture_getCallName(Capture_Call call);
+Capture_DescriptorEntryType capture_getDescriptorEntryType(Opal_DescriptorType type);
+
+/*
+ */
+void capture_u32(Capture_Stream *stream, uint32_t *value);
+void capture_u64(Capture_Stream *stream, uint64_t *value);
+void capture_f32(Capture_Stream *stream, float *value);
+void capture_handle(Capture_Stream *stream, Capture_HandleType type, uint64_t *handle);
+void capture_string(Capture_Stream *stream, const char **string);
+void capture_data(Capture_Stream *stream, const void **data, uint64_t size);
+void *capture_array(Capture_Stream *stream, const void **array, uint32_t count, uint32_t element_size);
+
+/*
+ */
+void capture_callCreateInstance(Capture_Stream *stream, Opal_Api *api, const Opal_InstanceDesc **desc, Opal_Instance *instance);
+
+void capture_callEnumerateDevices(Capture_Stream *stream, Opal_Instance *instance);
+void capture_callCreateSurface(Capture_Stream *stream, Opal_Instance *instance, Opal_Surface *surface);
+void capture_callCreateHeadlessSurface(Capture_Stream *stream, Opal_Instance *instance, uint32_t *width, uint32_t *height, Opal_Surface *surface);
+void capture_callCreateDevice(Capture_Stream *stream, Opal_Instance *instance, uint32_t *index, Opal_Device *device);
+void capture_callCreateDefaultDevice(Capture_Stream *stream, Opal_Instance *instance, Opal_DeviceHint *hint, Opal_Device *device);
+void capture_callDestroySurface(Capture_Stream *stream, Opal_Instance *instance, Opal_Surface *surface);
+void capture_callDestroyInstance(Capture_Stream *stream, Opal_Instance *instance);
+
+void capture_callGetDeviceInfo(Capture_Stream *stream, Opal_Device *device);
+void capture_callGetDeviceQueue(Capture_Stream *stream, Opal_Device *device, Opal_DeviceEngineType *engine_type, uint32_t *index, Opal_Queue *queue);
+void capture_callGetAccelerationStructurePrebuildInfo(Capture_Stream *stream, Opal_Device *device, const Opal_AccelerationStructureBuildDesc **desc);
+void capture_callGetAccelerationStructureAddress(Capture_Stream *stream, Opal_Device *device, Opal_AccelerationStructure *acceleration_structure);
+void capture_callGetSurfaceQuery(Capture_Stream *stream, Opal_Device *device, Opal_Surface *surface);
+
+void capture_callCreateSemaphore(Capture_Stream *stream, Opal_Device *device, const Opal_SemaphoreDesc **desc, Opal_Semaphore *semaphore);
+void capture_callCreateFence(Capture_Stream *stream, Opal_Device *device, Opal_Fence *fence);
+void capture_callCreateBuffer(Capture_Stream *stream, Opal_Device *device, const Opal_BufferDesc **desc, Opal_Buffer *buffer);
+void capture_callCreateTexture(Capture_Stream *stream, Opal_Device *device, const Opal_TextureDesc **desc, Opal_Texture *texture);
+void capture_callCreateTextureView(Capture_Stream *stream, Opal_Device *device, const Opal_TextureViewDesc **desc, Opal_TextureView *texture_view);
+void capture_callCreateSampler(Capture_Stream *stream, Opal_Device *device, const Opal_SamplerDesc **desc, Opal_Sampler *sampler);
+void capture_callCreateAccelerationStructure(Capture_Stream *stream, Opal_Device *device, const Opal_AccelerationStructureDesc **desc, Opal_AccelerationStructure *acceleration_structure);
+void capture_callCreateShaderBindingTable(Capture_Stream *stream, Opal_Device *device, Opal_RaytracePipeline *pipeline, Opal_ShaderBindingTable *shader_binding_table);
+void capture_callCreateCommandAllocator(Capture_Stream *stream, Opal_Device *device, Opal_Queue *queue, Opal_CommandAllocator *command_allocator);
+void capture_callCreateCommandBuffer(Capture_Stream *stream, Opal_Device *device, Opal_CommandAllocator *command_allocator, Opal_CommandBuffer *command_buffer);
+void capture_callCreateShader(Capture_Stream *stream, Opal_Device *device, const Opal_ShaderDesc **desc, Opal_Shader *shader);
+void capture_callCreateDescriptorHeap(Capture_Stream *stream, Opal_Device *device, const Opal_DescriptorHeapDesc **desc, Opal_DescriptorHeap *descriptor_heap);
+void capture_callCreateDescriptorSetLayout(Capture_Stream *stream, Opal_Device *device, uint32_t *num_entries, const Opal_DescriptorSetLayoutEntry **entries, Opal_DescriptorSetLayout *descriptor_set_layout);
+void capture_callCreatePipelineLayout(Capture_Stream *stream, Opal_Device *device, uint32_t *num_descriptor_set_layouts, const Opal_DescriptorSetLayout **descriptor_set_layouts, Opal_PipelineLayout *pipeline_layout);
+void capture_callCreateGraphicsPipeline(Capture_Stream *stream, Opal_Device *device, const Opal_GraphicsPipelineDesc **desc, Opal_GraphicsPipeline *pipeline);
+void capture_callCreateMeshletPipeline(Capture_Stream *stream, Opal_Device *device, const Opal_MeshletPipelineDesc **desc, Opal_GraphicsPipeline *pipeline);
+void capture_callCreateComputePipeline(Capture_Stream *stream, Opal_Device *device, const Opal_ComputePipelineDesc **desc, Opal_ComputePipeline *pipeline);
+void capture_callCreateRaytracePipeline(Capture_Stream *stream, Opal_Device *device, const Opal_RaytracePipelineDesc **desc, Opal_RaytracePipeline *pipeline);
+void capture_callCreateSwapchain(Capture_Stream *stream, Opal_Device *device, const Opal_SwapchainDesc **desc, Opal_Swapchain *swapchain);
+
+void capture_callDestroyObject(Capture_Stream *stream, Opal_Device *device, Capture_HandleType type, uint64_t *handle);
+void capture_callDestroyDevice(Capture_Stream *stream, Opal_Device *device);
+
+void capture_callBuildShaderBindingTable(Capture_Stream *stream, Opal_Device *device, Opal_ShaderBindingTable *shader_binding_table, const Opal_ShaderBindingTableBuildDesc **desc);
+void capture_callBuildAccelerationStructureInstanceBuffer(Capture_Stream *stream, Opal_Device *device, const Opal_AccelerationStructureInstanceBufferBuildDesc **desc);
+void capture_callResetCommandAllocator(Capture_Stream *stream, Opal_Device *device, Opal_CommandAllocator *command_allocator);
+void capture_callAllocateDescriptorSet(Capture_Stream *stream, Opal_Device *device, const Opal_DescriptorSetAllocationDesc **desc, const Capture_DescriptorEntryType *entry_types, Opal_DescriptorSet *descriptor_set);
+void capture_callFreeDescriptorSet(Capture_Stream *stream, Opal_Device *device, Opal_DescriptorSet *descriptor_set);
+void capture_callMapBuffer(Capture_Stream *stream, Opal_Device *device, Opal_Buffer *buffer);
+void capture_callUnmapBuffer(Capture_Stream *stream, Opal_Device *device, Opal_Buffer *buffer);
+void capture_callWriteBuffer(Capture_Stream *stream, Opal_Device *device, Opal_Buffer *buffer, uint64_t *offset, const void **data, uint64_t *size);
+void capture_callUpdateDescriptorSet(Capture_Stream *stream, Opal_Device *device, Opal_DescriptorSet *descriptor_set, uint32_t *num_entries, const Opal_DescriptorSetEntry **entries, const Capture_DescriptorEntryType *entry_types);
+void capture_callBeginCommandBuffer(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer);
+void capture_callEndCommandBuffer(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer);
+void capture_callQuerySemaphore(Capture_Stream *stream, Opal_Device *device, Opal_Semaphore *semaphore);
+void capture_callSignalSemaphore(Capture_Stream *stream, Opal_Device *device, Opal_Semaphore *semaphore, uint64_t *value);
+void capture_callWaitSemaphore(Capture_Stream *stream, Opal_Device *device, Opal_Semaphore *semaphore, uint64_t *value, uint64_t *timeout_milliseconds);
+void capture_callWaitSemaphores(Capture_Stream *stream, Opal_Device *device, uint32_t *num_semaphores, const Opal_Semaphore **semaphores, const uint64_t **values, uint32_t *wait_any, uint64_t *timeout_milliseconds);
+void capture_callWaitQueue(Capture_Stream *stream, Opal_Device *device, Opal_Queue *queue);
+void capture_callWaitIdle(Capture_Stream *stream, Opal_Device *device);
+void capture_callSubmit(Capture_Stream *stream, Opal_Device *device, Opal_Queue *queue, const Opal_SubmitDesc **desc);
+void capture_callAcquire(Capture_Stream *stream, Opal_Device *device, Opal_Swapchain *swapchain, Opal_TextureView *texture_view);
+void capture_callPresent(Capture_Stream *stream, Opal_Device *device, Opal_Swapchain *swapchain);
+void capture_callWaitPresent(Capture_Stream *stream, Opal_Device *device, Opal_Swapchain *swapchain, uint64_t *frame_id, uint64_t *timeout_milliseconds);
+void capture_callGetSwapchainFrameTiming(Capture_Stream *stream, Opal_Device *device, Opal_Swapchain *swapchain);
+
+void capture_callCmdSetDescriptorHeap(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, Opal_DescriptorHeap *descriptor_heap);
+void capture_callCmdBeginPass(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, const Opal_PassBarriersDesc **barriers);
+void capture_callCmdBeginGraphicsPass(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, const Opal_FramebufferDesc **desc, const Opal_PassBarriersDesc **barriers);
+void capture_callCmdSetObject(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, Capture_HandleType type, uint64_t *handle);
+void capture_callCmdSetDescriptorSet(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, uint32_t *index, Opal_DescriptorSet *descriptor_set, uint32_t *num_dynamic_offsets, const uint32_t **dynamic_offsets);
+void capture_callCmdGraphicsSetVertexBuffers(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, uint32_t *first_index, uint32_t *num_vertex_buffers, const Opal_VertexBufferView **vertex_buffers);
+void capture_callCmdGraphicsSetIndexBuffer(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, Opal_IndexBufferView *index_buffer);
+void capture_callCmdGraphicsSetViewport(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, Opal_Viewport *viewport);
+void capture_callCmdGraphicsSetScissor(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, uint32_t *x, uint32_t *y, uint32_t *width, uint32_t *height);
+void capture_callCmdGraphicsDraw(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, uint32_t *num_vertices, uint32_t *num_instances, uint32_t *base_vertex, uint32_t *base_instance);
+void capture_callCmdGraphicsDrawIndexed(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, uint32_t *num_indices, uint32_t *num_instances, uint32_t *base_index, int32_t *vertex_offset, uint32_t *base_instance);
+void capture_callCmdDispatch(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, uint32_t *x, uint32_t *y, uint32_t *z);
+void capture_callCmdMemoryBarrier(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, const Opal_MemoryBarrierDesc **barriers);
+void capture_callCmdCopyBufferToBuffer(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, Opal_Buffer *src_buffer, uint64_t *src_offset, Opal_Buffer *dst_buffer, uint64_t *dst_offset, uint64_t *size);
+void capture_callCmdCopyBufferToTexture(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, Opal_BufferTextureRegion *src, Opal_TextureRegion *dst, Opal_Extent3D *size);
+void capture_callCmdCopyTextureToBuffer(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, Opal_TextureRegion *src, Opal_BufferTextureRegion *dst, Opal_Extent3D *size);
+void capture_callCmdCopyBufferToTextureRegions(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, Opal_Buffer *src_buffer, Opal_Texture *dst_texture, uint32_t *num_regions, const Opal_BufferTextureCopyRegion **regions);
+void capture_callCmdCopyTextureToBufferRegions(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, Opal_Texture *src_texture, Opal_Buffer *dst_buffer, uint32_t *num_regions, const Opal_BufferTextureCopyRegion **regions);
+void capture_callCmdCopyTextureToTexture(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, Opal_TextureRegion *src, Opal_TextureRegion *dst, Opal_Extent3D *size);
+void capture_callCmdFillBuffer(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, Opal_Buffer *buffer, uint64_t *offset, uint64_t *size, uint32_t *value);
+void capture_callCmdUpdateBuffer(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, Opal_Buffer *buffer, uint64_t *offset, uint64_t *size, const void **data);
+void capture_callCmdClearTexture(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, Opal_TextureView *texture_view, Opal_ClearValue *clear_value);
+void capture_callCmdBlitTexture(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, Opal_TextureRegion *src, Opal_Extent3D *src_size, Opal_TextureRegion *dst, Opal_Extent3D *dst_size, Opal_SamplerFilterMode *filter);
+void capture_callCmdGenerateMips(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, Opal_TextureView *texture_view);
+void capture_callCmdAccelerationStructureBuild(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, const Opal_AccelerationStructureBuildDesc **desc);
+void capture_callCmdAccelerationStructureBuildBatch(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, uint32_t *num_descs, const Opal_AccelerationStructureBuildDesc **descs);
+void capture_callCmdAccelerationStructureCopy(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, const Opal_AccelerationStructureCopyDesc **desc);
+void capture_callCmdAccelerationStructureWriteCompactedSizes(Capture_Stream *stream, Opal_Device *device, Opal_CommandBuffer *command_buffer, uint32_t *num_acceleration_structures, const Opal_AccelerationStructure **acceleration_structures, Opal_BufferView *dst);
+
+void capture_callBufferData(Capture_Stream *stream, Opal_Device *device, Opal_Buffer *buffer, uint64_t *offset, uint64_t *size, const void **data);
@@ -0,0 +1,2477 @@
+#include "capture_internal.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CAPTURE_FLUSH_BLOCK_SIZE 64
+
+/*
+ */
+static void capture_deviceWriteBufferData(Capture_Device *device_ptr, Opal_Buffer buffer, uint64_t offset, uint64_t size, const void *data)
+{
+	assert(device_ptr);
+
+	Capture_Stream *stream = &device_ptr->instance->stream;
+	Opal_Device this = (Opal_Device)device_ptr;
+
+	capture_beginRecord(stream);
+	capture_callBufferData(stream, &this, &buffer, &offset, &size, &data);
+	capture_endRecord(stream, CAPTURE_CALL_BUFFER_DATA, OPAL_SUCCESS);
+}
+
+static void capture_deviceFlushBuffer(Capture_Device *device_ptr, Opal_Buffer buffer, Capture_Buffer *buffer_ptr)
+{
+	assert(device_ptr);
+	assert(buffer_ptr);
+
+	if (buffer_ptr->mapped_ptr == NULL)
+		return;
+
+	assert(buffer_ptr->shadow);
+
+	// note: only the range between the first and the last modified block is written to the stream
+	uint64_t size = buffer_ptr->size;
+	uint64_t begin = 0;
+	uint64_t end = size;
+
+	while (begin < end)
+	{
+		uint64_t block_size = (end - begin < CAPTURE_FLUSH_BLOCK_SIZE) ? end - begin : CAPTURE_FLUSH_BLOCK_SIZE;
+		if (memcmp(buffer_ptr->mapped_ptr + begin, buffer_ptr->shadow + begin, block_size) != 0)
+			break;
+
+		begin += block_size;
+	}
+
+	if (begin == end)
+		return;
+
+	while (end > begin)
+	{
+		uint64_t block_begin = (end - begin > CAPTURE_FLUSH_BLOCK_SIZE) ? end - CAPTURE_FLUSH_BLOCK_SIZE : begin;
+		if (memcmp(buffer_ptr->mapped_ptr + block_begin, buffer_ptr->shadow + block_begin, end - block_begin) != 0)
+			break;
+
+		end = block_begin;
+	}
+
+	capture_deviceWriteBufferData(device_ptr, buffer, begin, end - begin, buffer_ptr->mapped_ptr + begin);
+	memcpy(buffer_ptr->shadow + begin, buffer_ptr->mapped_ptr + begin, end - begin);
+}
+
+static void capture_deviceFlushMappedBuffer(Capture_Device *device_ptr, Opal_Buffer buffer)
+{
+	assert(device_ptr);
+
+	Capture_Buffer *buffer_ptr = (Capture_Buffer *)opal_mapFind(&device_ptr->buffers, buffer);
+	if (buffer_ptr == NULL)
+		return;
+
+	capture_deviceFlushBuffer(device_ptr, buffer, buffer_ptr);
+}
+
+static void capture_deviceFlushMappedBuffers(Capture_Device *device_ptr)
+{
+	assert(device_ptr);
+
+	uint32_t index = opal_mapGetFirstIndex(&device_ptr->buffers);
+	while (index != OPAL_MAP_INDEX_NULL)
+	{
+		Opal_Buffer buffer = (Opal_Buffer)opal_mapGetKeyByIndex(&device_ptr->buffers, index);
+		Capture_Buffer *buffer_ptr = (Capture_Buffer *)opal_mapGetElementByIndex(&device_ptr->buffers, index);
+
+		capture_deviceFlushBuffer(device_ptr, buffer, buffer_ptr);
+
+		index = opal_mapGetNextIndex(&device_ptr->buffers, index);
+	}
+}
+
+static void capture_deviceRecordPipelines(Capture_Device *device_ptr, Capture_Call call, uint32_t num_pipelines, const void *descs, uint64_t *pipelines, Opal_Result result)
+{
+	assert(device_ptr);
+	assert(num_pipelines == 0 || descs);
+	assert(num_pipelines == 0 || pipelines);
+
+	Capture_Stream *stream = &device_ptr->instance->stream;
+	Opal_Device this = (Opal_Device)device_ptr;
+
+	// note: replay has no batch calls, every pipeline is recorded as a separate create call
+	for (uint32_t i = 0; i < num_pipelines; ++i)
+	{
+		Opal_Result pipeline_result = (pipelines[i] != OPAL_NULL_HANDLE) ? OPAL_SUCCESS : result;
+
+		capture_beginRecord(stream);
+
+		switch (call)
+		{
+			case CAPTURE_CALL_CREATE_GRAPHICS_PIPELINE:
+			{
+				const Opal_GraphicsPipelineDesc *desc = (const Opal_GraphicsPipelineDesc *)descs + i;
+				capture_callCreateGraphicsPipeline(stream, &this, &desc, &pipelines[i]);
+			}
+			break;
+
+			case CAPTURE_CALL_CREATE_COMPUTE_PIPELINE:
+			{
+				const Opal_ComputePipelineDesc *desc = (const Opal_ComputePipelineDesc *)descs + i;
+				capture_callCreateComputePipeline(stream, &this, &desc, &pipelines[i]);
+			}
+			break;
+
+			case CAPTURE_CALL_CREATE_RAYTRACE_PIPELINE:
+			{
+				const Opal_RaytracePipelineDesc *desc = (const Opal_RaytracePipelineDesc *)descs + i;
+				capture_callCreateRaytracePipeline(stream, &this, &desc, &pipelines[i]);
+			}
+			break;
+
+			default: assert(0); break;
+		}
+
+		capture_endRecord(stream, call, pipeline_result);
+	}
+}
+
+/*
+ */
+static void capture_deviceTrackBuffer(Capture_Device *device_ptr, Opal_Buffer buffer, uint64_t size)
+{
+	assert(device_ptr);
+
+	Capture_Buffer data = {0};
+	data.size = size;
+
+	opal_mapInsert(&device_ptr->buffers, buffer, &data);
+}
+
+static void capture_deviceUntrackBuffer(Capture_Device *device_ptr, Opal_Buffer buffer)
+{
+	assert(device_ptr);
+
+	Capture_Buffer *buffer_ptr = (Capture_Buffer *)opal_mapFind(&device_ptr->buffers, buffer);
+	if (buffer_ptr == NULL)
+		return;
+
+	free(buffer_ptr->shadow);
+	opal_mapRemove(&device_ptr->buffers, buffer);
+}
+
+static void capture_deviceTrackMappedBuffer(Capture_Device *device_ptr, Opal_Buffer buffer, void *ptr)
+{
+	assert(device_ptr);
+	assert(ptr);
+
+	Capture_Buffer *buffer_ptr = (Capture_Buffer *)opal_mapFind(&device_ptr->buffers, buffer);
+	if (buffer_ptr == NULL || buffer_ptr->mapped_ptr != NULL)
+		return;
+
+	// note: the shadow starts as a copy of what the memory holds now, so only application writes end up in the stream
+	buffer_ptr->mapped_ptr = (uint8_t *)ptr;
+	buffer_ptr->shadow = (uint8_t *)malloc(buffer_ptr->size);
+	memcpy(buffer_ptr->shadow, buffer_ptr->mapped_ptr, buffer_ptr->size);
+}
+
+static void capture_deviceUntrackMappedBuffer(Capture_Device *device_ptr, Opal_Buffer buffer)
+{
+	assert(device_ptr);
+
+	Capture_Buffer *buffer_ptr = (Capture_Buffer *)opal_mapFind(&device_ptr->buffers, buffer);
+	if (buffer_ptr == NULL)
+		return;
+
+	free(buffer_ptr->shadow);
+
+	buffer_ptr->mapped_ptr = NULL;
+	buffer_ptr->shadow = NULL;
+}
+
+/*
+ */
+static void capture_deviceTrackDescriptorSetLayout(Capture_Device *device_ptr, Opal_DescriptorSetLayout descriptor_set_layout, uint32_t num_entries, const Opal_DescriptorSetLayoutEntry *entries)
+{
+	assert(device_ptr);
+
+	// note: backends hand out the same handle for identical layouts, keep the first copy
+	Capture_DescriptorSetLayout *layout_ptr = (Capture_DescriptorSetLayout *)opal_mapFind(&device_ptr->descriptor_set_layouts, descriptor_set_layout);
+	if (layout_ptr != NULL)
+	{
+		layout_ptr->refcount++;
+		return;
+	}
+
+	Capture_DescriptorSetLayout data = {0};
+	data.refcount = 1;
+	data.num_entries = num_entries;
+
+	if (num_entries > 0)
+	{
+		data.entries = (Opal_DescriptorSetLayoutEntry *)malloc(sizeof(Opal_DescriptorSetLayoutEntry) * num_entries);
+		memcpy(data.entries, entries, sizeof(Opal_DescriptorSetLayoutEntry) * num_entries);
+	}
+
+	opal_mapInsert(&device_ptr->descriptor_set_layouts, descriptor_set_layout, &data);
+}
+
+static void capture_deviceUntrackDescriptorSetLayout(Capture_Device *device_ptr, Opal_DescriptorSetLayout descriptor_set_layout)
+{
+	assert(device_ptr);
+
+	Capture_DescriptorSetLayout *layout_ptr = (Capture_DescriptorSetLayout *)opal_mapFind(&device_ptr->descriptor_set_layouts, descriptor_set_layout);
+	if (layout_ptr == NULL)
+		return;
+
+	layout_ptr->refcount--;
+	if (layout_ptr->refcount > 0)
+		return;
+
+	free(layout_ptr->entries);
+	opal_mapRemove(&device_ptr->descriptor_set_layouts, descriptor_set_layout);
+}
+
+static const Capture_DescriptorEntryType *capture_deviceGetEntryTypes(Capture_Device *device_ptr, Opal_DescriptorSetLayout descriptor_set_layout, uint32_t num_entries, const Opal_DescriptorSetEntry *entries)
+{
+	assert(device_ptr);
+
+	if (num_entries == 0 || entries == NULL)
+		return NULL;
+
+	if (device_ptr->entry_types_capacity < num_entries)
+	{
+		device_ptr->entry_types = (Capture_DescriptorEntryType *)realloc(device_ptr->entry_types, sizeof(Capture_DescriptorEntryType) * num_entries);
+		device_ptr->entry_types_capacity = num_entries;
+	}
+
+	const Capture_DescriptorSetLayout *layout_ptr = (const Capture_DescriptorSetLayout *)opal_mapFind(&device_ptr->descriptor_set_layouts, descriptor_set_layout);
+
+	for (uint32_t i = 0; i < num_entries; ++i)
+	{
+		device_ptr->entry_types[i] = CAPTURE_DESCRIPTOR_ENTRY_TYPE_UNKNOWN;
+
+		for (uint32_t j = 0; layout_ptr && j < layout_ptr->num_entries; ++j)
+		{
+			if (layout_ptr->entries[j].binding != entries[i].binding)
+				continue;
+
+			device_ptr->entry_types[i] = capture_getDescriptorEntryType(layout_ptr->entries[j].type);
+			break;
+		}
+	}
+
+	return device_ptr->entry_types;
+}
+
+/*
+ */
+static Opal_Result capture_deviceGetDeviceInfo(Opal_Device this, Opal_DeviceInfo *info)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.getDeviceInfo(device_ptr->next_device, info);
+
+	capture_beginRecord(stream);
+	capture_callGetDeviceInfo(stream, &this);
+	capture_endRecord(stream, CAPTURE_CALL_GET_DEVICE_INFO, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceGetDeviceQueue(Opal_Device this, Opal_DeviceEngineType engine_type, uint32_t index, Opal_Queue *queue)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.getDeviceQueue(device_ptr->next_device, engine_type, index, queue);
+
+	capture_beginRecord(stream);
+	capture_callGetDeviceQueue(stream, &this, &engine_type, &index, queue);
+	capture_endRecord(stream, CAPTURE_CALL_GET_DEVICE_QUEUE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceGetAccelerationStructurePrebuildInfo(Opal_Device this, const Opal_AccelerationStructureBuildDesc *desc, Opal_AccelerationStructurePrebuildInfo *info)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.getAccelerationStructurePrebuildInfo(device_ptr->next_device, desc, info);
+
+	capture_beginRecord(stream);
+	capture_callGetAccelerationStructurePrebuildInfo(stream, &this, &desc);
+	capture_endRecord(stream, CAPTURE_CALL_GET_ACCELERATION_STRUCTURE_PREBUILD_INFO, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceGetAccelerationStructureAddress(Opal_Device this, Opal_AccelerationStructure acceleration_structure, uint64_t *address)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.getAccelerationStructureAddress(device_ptr->next_device, acceleration_structure, address);
+
+	capture_beginRecord(stream);
+	capture_callGetAccelerationStructureAddress(stream, &this, &acceleration_structure);
+	capture_endRecord(stream, CAPTURE_CALL_GET_ACCELERATION_STRUCTURE_ADDRESS, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceGetSupportedSurfaceFormats(Opal_Device this, Opal_Surface surface, uint32_t *num_formats, Opal_SurfaceFormat *formats)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.getSupportedSurfaceFormats(device_ptr->next_device, surface, num_formats, formats);
+
+	capture_beginRecord(stream);
+	capture_callGetSurfaceQuery(stream, &this, &surface);
+	capture_endRecord(stream, CAPTURE_CALL_GET_SUPPORTED_SURFACE_FORMATS, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceGetSupportedPresentModes(Opal_Device this, Opal_Surface surface, uint32_t *num_present_modes, Opal_PresentMode *present_modes)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.getSupportedPresentModes(device_ptr->next_device, surface, num_present_modes, present_modes);
+
+	capture_beginRecord(stream);
+	capture_callGetSurfaceQuery(stream, &this, &surface);
+	capture_endRecord(stream, CAPTURE_CALL_GET_SUPPORTED_PRESENT_MODES, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceGetPreferredSurfaceFormat(Opal_Device this, Opal_Surface surface, Opal_SurfaceFormat *format)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.getPreferredSurfaceFormat(device_ptr->next_device, surface, format);
+
+	capture_beginRecord(stream);
+	capture_callGetSurfaceQuery(stream, &this, &surface);
+	capture_endRecord(stream, CAPTURE_CALL_GET_PREFERRED_SURFACE_FORMAT, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceGetPreferredSurfacePresentMode(Opal_Device this, Opal_Surface surface, Opal_PresentMode *present_mode)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.getPreferredSurfacePresentMode(device_ptr->next_device, surface, present_mode);
+
+	capture_beginRecord(stream);
+	capture_callGetSurfaceQuery(stream, &this, &surface);
+	capture_endRecord(stream, CAPTURE_CALL_GET_PREFERRED_SURFACE_PRESENT_MODE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCreateSemaphore(Opal_Device this, const Opal_SemaphoreDesc *desc, Opal_Semaphore *semaphore)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.createSemaphore(device_ptr->next_device, desc, semaphore);
+
+	capture_beginRecord(stream);
+	capture_callCreateSemaphore(stream, &this, &desc, semaphore);
+	capture_endRecord(stream, CAPTURE_CALL_CREATE_SEMAPHORE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCreateFence(Opal_Device this, Opal_Fence *fence)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.createFence(device_ptr->next_device, fence);
+
+	capture_beginRecord(stream);
+	capture_callCreateFence(stream, &this, fence);
+	capture_endRecord(stream, CAPTURE_CALL_CREATE_FENCE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCreateBuffer(Opal_Device this, const Opal_BufferDesc *desc, Opal_Buffer *buffer)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.createBuffer(device_ptr->next_device, desc, buffer);
+
+	if (result == OPAL_SUCCESS)
+		capture_deviceTrackBuffer(device_ptr, *buffer, desc->size);
+
+	capture_beginRecord(stream);
+	capture_callCreateBuffer(stream, &this, &desc, buffer);
+	capture_endRecord(stream, CAPTURE_CALL_CREATE_BUFFER, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCreateTexture(Opal_Device this, const Opal_TextureDesc *desc, Opal_Texture *texture)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.createTexture(device_ptr->next_device, desc, texture);
+
+	capture_beginRecord(stream);
+	capture_callCreateTexture(stream, &this, &desc, texture);
+	capture_endRecord(stream, CAPTURE_CALL_CREATE_TEXTURE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCreateTextureView(Opal_Device this, const Opal_TextureViewDesc *desc, Opal_TextureView *texture_view)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.createTextureView(device_ptr->next_device, desc, texture_view);
+
+	capture_beginRecord(stream);
+	capture_callCreateTextureView(stream, &this, &desc, texture_view);
+	capture_endRecord(stream, CAPTURE_CALL_CREATE_TEXTURE_VIEW, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCreateSampler(Opal_Device this, const Opal_SamplerDesc *desc, Opal_Sampler *sampler)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.createSampler(device_ptr->next_device, desc, sampler);
+
+	capture_beginRecord(stream);
+	capture_callCreateSampler(stream, &this, &desc, sampler);
+	capture_endRecord(stream, CAPTURE_CALL_CREATE_SAMPLER, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCreateAccelerationStructure(Opal_Device this, const Opal_AccelerationStructureDesc *desc, Opal_AccelerationStructure *acceleration_structure)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.createAccelerationStructure(device_ptr->next_device, desc, acceleration_structure);
+
+	capture_beginRecord(stream);
+	capture_callCreateAccelerationStructure(stream, &this, &desc, acceleration_structure);
+	capture_endRecord(stream, CAPTURE_CALL_CREATE_ACCELERATION_STRUCTURE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCreateShaderBindingTable(Opal_Device this, Opal_RaytracePipeline pipeline, Opal_ShaderBindingTable *shader_binding_table)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.createShaderBindingTable(device_ptr->next_device, pipeline, shader_binding_table);
+
+	capture_beginRecord(stream);
+	capture_callCreateShaderBindingTable(stream, &this, &pipeline, shader_binding_table);
+	capture_endRecord(stream, CAPTURE_CALL_CREATE_SHADER_BINDING_TABLE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCreateCommandAllocator(Opal_Device this, Opal_Queue queue, Opal_CommandAllocator *command_allocator)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.createCommandAllocator(device_ptr->next_device, queue, command_allocator);
+
+	capture_beginRecord(stream);
+	capture_callCreateCommandAllocator(stream, &this, &queue, command_allocator);
+	capture_endRecord(stream, CAPTURE_CALL_CREATE_COMMAND_ALLOCATOR, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCreateCommandBuffer(Opal_Device this, Opal_CommandAllocator command_allocator, Opal_CommandBuffer *command_buffer)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.createCommandBuffer(device_ptr->next_device, command_allocator, command_buffer);
+
+	capture_beginRecord(stream);
+	capture_callCreateCommandBuffer(stream, &this, &command_allocator, command_buffer);
+	capture_endRecord(stream, CAPTURE_CALL_CREATE_COMMAND_BUFFER, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCreateShader(Opal_Device this, const Opal_ShaderDesc *desc, Opal_Shader *shader)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.createShader(device_ptr->next_device, desc, shader);
+
+	capture_beginRecord(stream);
+	capture_callCreateShader(stream, &this, &desc, shader);
+	capture_endRecord(stream, CAPTURE_CALL_CREATE_SHADER, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCreateDescriptorHeap(Opal_Device this, const Opal_DescriptorHeapDesc *desc, Opal_DescriptorHeap *descriptor_heap)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.createDescriptorHeap(device_ptr->next_device, desc, descriptor_heap);
+
+	capture_beginRecord(stream);
+	capture_callCreateDescriptorHeap(stream, &this, &desc, descriptor_heap);
+	capture_endRecord(stream, CAPTURE_CALL_CREATE_DESCRIPTOR_HEAP, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCreateDescriptorSetLayout(Opal_Device this, uint32_t num_entries, const Opal_DescriptorSetLayoutEntry *entries, Opal_DescriptorSetLayout *descriptor_set_layout)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.createDescriptorSetLayout(device_ptr->next_device, num_entries, entries, descriptor_set_layout);
+
+	if (result == OPAL_SUCCESS)
+		capture_deviceTrackDescriptorSetLayout(device_ptr, *descriptor_set_layout, num_entries, entries);
+
+	capture_beginRecord(stream);
+	capture_callCreateDescriptorSetLayout(stream, &this, &num_entries, &entries, descriptor_set_layout);
+	capture_endRecord(stream, CAPTURE_CALL_CREATE_DESCRIPTOR_SET_LAYOUT, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCreatePipelineLayout(Opal_Device this, uint32_t num_descriptor_setlayouts, const Opal_DescriptorSetLayout *descriptor_set_layouts, Opal_PipelineLayout *pipeline_layout)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.createPipelineLayout(device_ptr->next_device, num_descriptor_setlayouts, descriptor_set_layouts, pipeline_layout);
+
+	capture_beginRecord(stream);
+	capture_callCreatePipelineLayout(stream, &this, &num_descriptor_setlayouts, &descriptor_set_layouts, pipeline_layout);
+	capture_endRecord(stream, CAPTURE_CALL_CREATE_PIPELINE_LAYOUT, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCreateGraphicsPipeline(Opal_Device this, const Opal_GraphicsPipelineDesc *desc, Opal_GraphicsPipeline *pipeline)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.createGraphicsPipeline(device_ptr->next_device, desc, pipeline);
+
+	capture_beginRecord(stream);
+	capture_callCreateGraphicsPipeline(stream, &this, &desc, pipeline);
+	capture_endRecord(stream, CAPTURE_CALL_CREATE_GRAPHICS_PIPELINE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCreateMeshletPipeline(Opal_Device this, const Opal_MeshletPipelineDesc *desc, Opal_GraphicsPipeline *pipeline)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.createMeshletPipeline(device_ptr->next_device, desc, pipeline);
+
+	capture_beginRecord(stream);
+	capture_callCreateMeshletPipeline(stream, &this, &desc, pipeline);
+	capture_endRecord(stream, CAPTURE_CALL_CREATE_MESHLET_PIPELINE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCreateComputePipeline(Opal_Device this, const Opal_ComputePipelineDesc *desc, Opal_ComputePipeline *pipeline)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.createComputePipeline(device_ptr->next_device, desc, pipeline);
+
+	capture_beginRecord(stream);
+	capture_callCreateComputePipeline(stream, &this, &desc, pipeline);
+	capture_endRecord(stream, CAPTURE_CALL_CREATE_COMPUTE_PIPELINE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCreateRaytracePipeline(Opal_Device this, const Opal_RaytracePipelineDesc *desc, Opal_RaytracePipeline *pipeline)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.createRaytracePipeline(device_ptr->next_device, desc, pipeline);
+
+	capture_beginRecord(stream);
+	capture_callCreateRaytracePipeline(stream, &this, &desc, pipeline);
+	capture_endRecord(stream, CAPTURE_CALL_CREATE_RAYTRACE_PIPELINE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCreateGraphicsPipelines(Opal_Device this, uint32_t num_pipelines, const Opal_GraphicsPipelineDesc *descs, Opal_GraphicsPipeline *pipelines)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+
+	Opal_Result result = device_ptr->next.createGraphicsPipelines(device_ptr->next_device, num_pipelines, descs, pipelines);
+
+	capture_deviceRecordPipelines(device_ptr, CAPTURE_CALL_CREATE_GRAPHICS_PIPELINE, num_pipelines, descs, pipelines, result);
+	return result;
+}
+
+static Opal_Result capture_deviceCreateComputePipelines(Opal_Device this, uint32_t num_pipelines, const Opal_ComputePipelineDesc *descs, Opal_ComputePipeline *pipelines)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+
+	Opal_Result result = device_ptr->next.createComputePipelines(device_ptr->next_device, num_pipelines, descs, pipelines);
+
+	capture_deviceRecordPipelines(device_ptr, CAPTURE_CALL_CREATE_COMPUTE_PIPELINE, num_pipelines, descs, pipelines, result);
+	return result;
+}
+
+static Opal_Result capture_deviceCreateRaytracePipelines(Opal_Device this, uint32_t num_pipelines, const Opal_RaytracePipelineDesc *descs, Opal_RaytracePipeline *pipelines)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+
+	Opal_Result result = device_ptr->next.createRaytracePipelines(device_ptr->next_device, num_pipelines, descs, pipelines);
+
+	capture_deviceRecordPipelines(device_ptr, CAPTURE_CALL_CREATE_RAYTRACE_PIPELINE, num_pipelines, descs, pipelines, result);
+	return result;
+}
+
+static Opal_Result capture_deviceCreateGraphicsPipelinesAsync(Opal_Device this, uint32_t num_pipelines, const Opal_GraphicsPipelineDesc *descs, Opal_GraphicsPipeline *pipelines, Opal_PipelineTask *task)
+{
+	assert(this);
+	assert(task);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+
+	Opal_Result result = device_ptr->next.createGraphicsPipelinesAsync(device_ptr->next_device, num_pipelines, descs, pipelines, task);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	// note: handles are only known once the task is waited on, recording happens there
+	Capture_PipelineTask data = {0};
+	data.call = CAPTURE_CALL_CREATE_GRAPHICS_PIPELINE;
+	data.num_pipelines = num_pipelines;
+	data.descs = descs;
+	data.pipelines = pipelines;
+
+	opal_mapInsert(&device_ptr->pipeline_tasks, *task, &data);
+	return result;
+}
+
+static Opal_Result capture_deviceCreateComputePipelinesAsync(Opal_Device this, uint32_t num_pipelines, const Opal_ComputePipelineDesc *descs, Opal_ComputePipeline *pipelines, Opal_PipelineTask *task)
+{
+	assert(this);
+	assert(task);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+
+	Opal_Result result = device_ptr->next.createComputePipelinesAsync(device_ptr->next_device, num_pipelines, descs, pipelines, task);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	// note: handles are only known once the task is waited on, recording happens there
+	Capture_PipelineTask data = {0};
+	data.call = CAPTURE_CALL_CREATE_COMPUTE_PIPELINE;
+	data.num_pipelines = num_pipelines;
+	data.descs = descs;
+	data.pipelines = pipelines;
+
+	opal_mapInsert(&device_ptr->pipeline_tasks, *task, &data);
+	return result;
+}
+
+static Opal_Result capture_deviceCreateRaytracePipelinesAsync(Opal_Device this, uint32_t num_pipelines, const Opal_RaytracePipelineDesc *descs, Opal_RaytracePipeline *pipelines, Opal_PipelineTask *task)
+{
+	assert(this);
+	assert(task);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+
+	Opal_Result result = device_ptr->next.createRaytracePipelinesAsync(device_ptr->next_device, num_pipelines, descs, pipelines, task);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	// note: handles are only known once the task is waited on, recording happens there
+	Capture_PipelineTask data = {0};
+	data.call = CAPTURE_CALL_CREATE_RAYTRACE_PIPELINE;
+	data.num_pipelines = num_pipelines;
+	data.descs = descs;
+	data.pipelines = pipelines;
+
+	opal_mapInsert(&device_ptr->pipeline_tasks, *task, &data);
+	return result;
+}
+
+static Opal_Result capture_deviceCreateSwapchain(Opal_Device this, const Opal_SwapchainDesc *desc, Opal_Swapchain *swapchain)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.createSwapchain(device_ptr->next_device, desc, swapchain);
+
+	capture_beginRecord(stream);
+	capture_callCreateSwapchain(stream, &this, &desc, swapchain);
+	capture_endRecord(stream, CAPTURE_CALL_CREATE_SWAPCHAIN, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceDestroySemaphore(Opal_Device this, Opal_Semaphore semaphore)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.destroySemaphore(device_ptr->next_device, semaphore);
+
+	capture_beginRecord(stream);
+	capture_callDestroyObject(stream, &this, CAPTURE_HANDLE_TYPE_SEMAPHORE, &semaphore);
+	capture_endRecord(stream, CAPTURE_CALL_DESTROY_SEMAPHORE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceDestroyFence(Opal_Device this, Opal_Fence fence)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.destroyFence(device_ptr->next_device, fence);
+
+	capture_beginRecord(stream);
+	capture_callDestroyObject(stream, &this, CAPTURE_HANDLE_TYPE_FENCE, &fence);
+	capture_endRecord(stream, CAPTURE_CALL_DESTROY_FENCE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceDestroyBuffer(Opal_Device this, Opal_Buffer buffer)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	capture_deviceFlushMappedBuffer(device_ptr, buffer);
+
+	Opal_Result result = device_ptr->next.destroyBuffer(device_ptr->next_device, buffer);
+
+	if (result == OPAL_SUCCESS)
+		capture_deviceUntrackBuffer(device_ptr, buffer);
+
+	capture_beginRecord(stream);
+	capture_callDestroyObject(stream, &this, CAPTURE_HANDLE_TYPE_BUFFER, &buffer);
+	capture_endRecord(stream, CAPTURE_CALL_DESTROY_BUFFER, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceDestroyTexture(Opal_Device this, Opal_Texture texture)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.destroyTexture(device_ptr->next_device, texture);
+
+	capture_beginRecord(stream);
+	capture_callDestroyObject(stream, &this, CAPTURE_HANDLE_TYPE_TEXTURE, &texture);
+	capture_endRecord(stream, CAPTURE_CALL_DESTROY_TEXTURE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceDestroyTextureView(Opal_Device this, Opal_TextureView texture_view)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.destroyTextureView(device_ptr->next_device, texture_view);
+
+	capture_beginRecord(stream);
+	capture_callDestroyObject(stream, &this, CAPTURE_HANDLE_TYPE_TEXTURE_VIEW, &texture_view);
+	capture_endRecord(stream, CAPTURE_CALL_DESTROY_TEXTURE_VIEW, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceDestroySampler(Opal_Device this, Opal_Sampler sampler)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.destroySampler(device_ptr->next_device, sampler);
+
+	capture_beginRecord(stream);
+	capture_callDestroyObject(stream, &this, CAPTURE_HANDLE_TYPE_SAMPLER, &sampler);
+	capture_endRecord(stream, CAPTURE_CALL_DESTROY_SAMPLER, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceDestroyAccelerationStructure(Opal_Device this, Opal_AccelerationStructure acceleration_structure)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.destroyAccelerationStructure(device_ptr->next_device, acceleration_structure);
+
+	capture_beginRecord(stream);
+	capture_callDestroyObject(stream, &this, CAPTURE_HANDLE_TYPE_ACCELERATION_STRUCTURE, &acceleration_structure);
+	capture_endRecord(stream, CAPTURE_CALL_DESTROY_ACCELERATION_STRUCTURE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceDestroyShaderBindingTable(Opal_Device this, Opal_ShaderBindingTable shader_binding_table)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.destroyShaderBindingTable(device_ptr->next_device, shader_binding_table);
+
+	capture_beginRecord(stream);
+	capture_callDestroyObject(stream, &this, CAPTURE_HANDLE_TYPE_SHADER_BINDING_TABLE, &shader_binding_table);
+	capture_endRecord(stream, CAPTURE_CALL_DESTROY_SHADER_BINDING_TABLE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceDestroyCommandAllocator(Opal_Device this, Opal_CommandAllocator command_allocator)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.destroyCommandAllocator(device_ptr->next_device, command_allocator);
+
+	capture_beginRecord(stream);
+	capture_callDestroyObject(stream, &this, CAPTURE_HANDLE_TYPE_COMMAND_ALLOCATOR, &command_allocator);
+	capture_endRecord(stream, CAPTURE_CALL_DESTROY_COMMAND_ALLOCATOR, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceDestroyCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.destroyCommandBuffer(device_ptr->next_device, command_buffer);
+
+	capture_beginRecord(stream);
+	capture_callDestroyObject(stream, &this, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, &command_buffer);
+	capture_endRecord(stream, CAPTURE_CALL_DESTROY_COMMAND_BUFFER, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceDestroyShader(Opal_Device this, Opal_Shader shader)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.destroyShader(device_ptr->next_device, shader);
+
+	capture_beginRecord(stream);
+	capture_callDestroyObject(stream, &this, CAPTURE_HANDLE_TYPE_SHADER, &shader);
+	capture_endRecord(stream, CAPTURE_CALL_DESTROY_SHADER, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceDestroyDescriptorHeap(Opal_Device this, Opal_DescriptorHeap descriptor_heap)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.destroyDescriptorHeap(device_ptr->next_device, descriptor_heap);
+
+	capture_beginRecord(stream);
+	capture_callDestroyObject(stream, &this, CAPTURE_HANDLE_TYPE_DESCRIPTOR_HEAP, &descriptor_heap);
+	capture_endRecord(stream, CAPTURE_CALL_DESTROY_DESCRIPTOR_HEAP, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceDestroyDescriptorSetLayout(Opal_Device this, Opal_DescriptorSetLayout descriptor_set_layout)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.destroyDescriptorSetLayout(device_ptr->next_device, descriptor_set_layout);
+
+	if (result == OPAL_SUCCESS)
+		capture_deviceUntrackDescriptorSetLayout(device_ptr, descriptor_set_layout);
+
+	capture_beginRecord(stream);
+	capture_callDestroyObject(stream, &this, CAPTURE_HANDLE_TYPE_DESCRIPTOR_SET_LAYOUT, &descriptor_set_layout);
+	capture_endRecord(stream, CAPTURE_CALL_DESTROY_DESCRIPTOR_SET_LAYOUT, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceDestroyPipelineLayout(Opal_Device this, Opal_PipelineLayout pipeline_layout)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.destroyPipelineLayout(device_ptr->next_device, pipeline_layout);
+
+	capture_beginRecord(stream);
+	capture_callDestroyObject(stream, &this, CAPTURE_HANDLE_TYPE_PIPELINE_LAYOUT, &pipeline_layout);
+	capture_endRecord(stream, CAPTURE_CALL_DESTROY_PIPELINE_LAYOUT, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceDestroyGraphicsPipeline(Opal_Device this, Opal_GraphicsPipeline pipeline)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.destroyGraphicsPipeline(device_ptr->next_device, pipeline);
+
+	capture_beginRecord(stream);
+	capture_callDestroyObject(stream, &this, CAPTURE_HANDLE_TYPE_GRAPHICS_PIPELINE, &pipeline);
+	capture_endRecord(stream, CAPTURE_CALL_DESTROY_GRAPHICS_PIPELINE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceDestroyComputePipeline(Opal_Device this, Opal_ComputePipeline pipeline)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.destroyComputePipeline(device_ptr->next_device, pipeline);
+
+	capture_beginRecord(stream);
+	capture_callDestroyObject(stream, &this, CAPTURE_HANDLE_TYPE_COMPUTE_PIPELINE, &pipeline);
+	capture_endRecord(stream, CAPTURE_CALL_DESTROY_COMPUTE_PIPELINE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceDestroyRaytracePipeline(Opal_Device this, Opal_RaytracePipeline pipeline)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.destroyRaytracePipeline(device_ptr->next_device, pipeline);
+
+	capture_beginRecord(stream);
+	capture_callDestroyObject(stream, &this, CAPTURE_HANDLE_TYPE_RAYTRACE_PIPELINE, &pipeline);
+	capture_endRecord(stream, CAPTURE_CALL_DESTROY_RAYTRACE_PIPELINE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceDestroySwapchain(Opal_Device this, Opal_Swapchain swapchain)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.destroySwapchain(device_ptr->next_device, swapchain);
+
+	capture_beginRecord(stream);
+	capture_callDestroyObject(stream, &this, CAPTURE_HANDLE_TYPE_SWAPCHAIN, &swapchain);
+	capture_endRecord(stream, CAPTURE_CALL_DESTROY_SWAPCHAIN, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceDestroyDevice(Opal_Device this)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	capture_deviceFlushMappedBuffers(device_ptr);
+
+	Opal_Result result = device_ptr->next.destroyDevice(device_ptr->next_device);
+
+	capture_beginRecord(stream);
+	capture_callDestroyDevice(stream, &this);
+	capture_endRecord(stream, CAPTURE_CALL_DESTROY_DEVICE, result);
+
+	{
+		uint32_t index = opal_mapGetFirstIndex(&device_ptr->buffers);
+		while (index != OPAL_MAP_INDEX_NULL)
+		{
+			Capture_Buffer *buffer_ptr = (Capture_Buffer *)opal_mapGetElementByIndex(&device_ptr->buffers, index);
+			free(buffer_ptr->shadow);
+
+			index = opal_mapGetNextIndex(&device_ptr->buffers, index);
+		}
+
+		opal_mapShutdown(&device_ptr->buffers);
+	}
+
+	{
+		uint32_t index = opal_mapGetFirstIndex(&device_ptr->descriptor_set_layouts);
+		while (index != OPAL_MAP_INDEX_NULL)
+		{
+			Capture_DescriptorSetLayout *layout_ptr = (Capture_DescriptorSetLayout *)opal_mapGetElementByIndex(&device_ptr->descriptor_set_layouts, index);
+			free(layout_ptr->entries);
+
+			index = opal_mapGetNextIndex(&device_ptr->descriptor_set_layouts, index);
+		}
+
+		opal_mapShutdown(&device_ptr->descriptor_set_layouts);
+	}
+
+	opal_mapShutdown(&device_ptr->pipeline_tasks);
+	opal_mapShutdown(&device_ptr->descriptor_sets);
+	free(device_ptr->entry_types);
+
+	free(device_ptr);
+	return result;
+}
+
+static Opal_Result capture_deviceBuildShaderBindingTable(Opal_Device this, Opal_ShaderBindingTable shader_binding_table, const Opal_ShaderBindingTableBuildDesc *desc)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.buildShaderBindingTable(device_ptr->next_device, shader_binding_table, desc);
+
+	capture_beginRecord(stream);
+	capture_callBuildShaderBindingTable(stream, &this, &shader_binding_table, &desc);
+	capture_endRecord(stream, CAPTURE_CALL_BUILD_SHADER_BINDING_TABLE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceBuildAccelerationStructureInstanceBuffer(Opal_Device this, const Opal_AccelerationStructureInstanceBufferBuildDesc *desc)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.buildAccelerationStructureInstanceBuffer(device_ptr->next_device, desc);
+
+	capture_beginRecord(stream);
+	capture_callBuildAccelerationStructureInstanceBuffer(stream, &this, &desc);
+	capture_endRecord(stream, CAPTURE_CALL_BUILD_ACCELERATION_STRUCTURE_INSTANCE_BUFFER, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceResetCommandAllocator(Opal_Device this, Opal_CommandAllocator command_allocator)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.resetCommandAllocator(device_ptr->next_device, command_allocator);
+
+	capture_beginRecord(stream);
+	capture_callResetCommandAllocator(stream, &this, &command_allocator);
+	capture_endRecord(stream, CAPTURE_CALL_RESET_COMMAND_ALLOCATOR, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceAllocateDescriptorSet(Opal_Device this, const Opal_DescriptorSetAllocationDesc *desc, Opal_DescriptorSet *descriptor_set)
+{
+	assert(this);
+	assert(desc);
+	assert(descriptor_set);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.allocateDescriptorSet(device_ptr->next_device, desc, descriptor_set);
+
+	if (result == OPAL_SUCCESS)
+		opal_mapInsert(&device_ptr->descriptor_sets, *descriptor_set, &desc->layout);
+
+	const Capture_DescriptorEntryType *entry_types = capture_deviceGetEntryTypes(device_ptr, desc->layout, desc->num_entries, desc->entries);
+
+	capture_beginRecord(stream);
+	capture_callAllocateDescriptorSet(stream, &this, &desc, entry_types, descriptor_set);
+	capture_endRecord(stream, CAPTURE_CALL_ALLOCATE_DESCRIPTOR_SET, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceFreeDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.freeDescriptorSet(device_ptr->next_device, descriptor_set);
+
+	if (result == OPAL_SUCCESS)
+		opal_mapRemove(&device_ptr->descriptor_sets, descriptor_set);
+
+	capture_beginRecord(stream);
+	capture_callFreeDescriptorSet(stream, &this, &descriptor_set);
+	capture_endRecord(stream, CAPTURE_CALL_FREE_DESCRIPTOR_SET, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceMapBuffer(Opal_Device this, Opal_Buffer buffer, void **ptr)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.mapBuffer(device_ptr->next_device, buffer, ptr);
+
+	if (result == OPAL_SUCCESS)
+		capture_deviceTrackMappedBuffer(device_ptr, buffer, *ptr);
+
+	capture_beginRecord(stream);
+	capture_callMapBuffer(stream, &this, &buffer);
+	capture_endRecord(stream, CAPTURE_CALL_MAP_BUFFER, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceUnmapBuffer(Opal_Device this, Opal_Buffer buffer)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	capture_deviceFlushMappedBuffer(device_ptr, buffer);
+
+	Opal_Result result = device_ptr->next.unmapBuffer(device_ptr->next_device, buffer);
+
+	if (result == OPAL_SUCCESS)
+		capture_deviceUntrackMappedBuffer(device_ptr, buffer);
+
+	capture_beginRecord(stream);
+	capture_callUnmapBuffer(stream, &this, &buffer);
+	capture_endRecord(stream, CAPTURE_CALL_UNMAP_BUFFER, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceWriteBuffer(Opal_Device this, Opal_Buffer buffer, uint64_t offset, const void *data, uint64_t size)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.writeBuffer(device_ptr->next_device, buffer, offset, data, size);
+
+	capture_beginRecord(stream);
+	capture_callWriteBuffer(stream, &this, &buffer, &offset, &data, &size);
+	capture_endRecord(stream, CAPTURE_CALL_WRITE_BUFFER, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceUpdateDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set, uint32_t num_entries, const Opal_DescriptorSetEntry *entries)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.updateDescriptorSet(device_ptr->next_device, descriptor_set, num_entries, entries);
+
+	Opal_DescriptorSetLayout descriptor_set_layout = OPAL_NULL_HANDLE;
+
+	const Opal_DescriptorSetLayout *layout_ptr = (const Opal_DescriptorSetLayout *)opal_mapFind(&device_ptr->descriptor_sets, descriptor_set);
+	if (layout_ptr)
+		descriptor_set_layout = *layout_ptr;
+
+	const Capture_DescriptorEntryType *entry_types = capture_deviceGetEntryTypes(device_ptr, descriptor_set_layout, num_entries, entries);
+
+	capture_beginRecord(stream);
+	capture_callUpdateDescriptorSet(stream, &this, &descriptor_set, &num_entries, &entries, entry_types);
+	capture_endRecord(stream, CAPTURE_CALL_UPDATE_DESCRIPTOR_SET, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceBeginCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.beginCommandBuffer(device_ptr->next_device, command_buffer);
+
+	capture_beginRecord(stream);
+	capture_callBeginCommandBuffer(stream, &this, &command_buffer);
+	capture_endRecord(stream, CAPTURE_CALL_BEGIN_COMMAND_BUFFER, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceEndCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.endCommandBuffer(device_ptr->next_device, command_buffer);
+
+	capture_beginRecord(stream);
+	capture_callEndCommandBuffer(stream, &this, &command_buffer);
+	capture_endRecord(stream, CAPTURE_CALL_END_COMMAND_BUFFER, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceQuerySemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t *value)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.querySemaphore(device_ptr->next_device, semaphore, value);
+
+	capture_beginRecord(stream);
+	capture_callQuerySemaphore(stream, &this, &semaphore);
+	capture_endRecord(stream, CAPTURE_CALL_QUERY_SEMAPHORE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceSignalSemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t value)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.signalSemaphore(device_ptr->next_device, semaphore, value);
+
+	capture_beginRecord(stream);
+	capture_callSignalSemaphore(stream, &this, &semaphore, &value);
+	capture_endRecord(stream, CAPTURE_CALL_SIGNAL_SEMAPHORE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceWaitSemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t value, uint64_t timeout_milliseconds)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.waitSemaphore(device_ptr->next_device, semaphore, value, timeout_milliseconds);
+
+	capture_beginRecord(stream);
+	capture_callWaitSemaphore(stream, &this, &semaphore, &value, &timeout_milliseconds);
+	capture_endRecord(stream, CAPTURE_CALL_WAIT_SEMAPHORE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceWaitSemaphores(Opal_Device this, uint32_t num_semaphores, const Opal_Semaphore *semaphores, const uint64_t *values, uint32_t wait_any, uint64_t timeout_milliseconds)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.waitSemaphores(device_ptr->next_device, num_semaphores, semaphores, values, wait_any, timeout_milliseconds);
+
+	capture_beginRecord(stream);
+	capture_callWaitSemaphores(stream, &this, &num_semaphores, &semaphores, &values, &wait_any, &timeout_milliseconds);
+	capture_endRecord(stream, CAPTURE_CALL_WAIT_SEMAPHORES, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceRegisterSemaphoreCallback(Opal_Device this, Opal_Semaphore semaphore, uint64_t value, PFN_opalSemaphoreCallback callback, void *user_data)
+{
+	assert(this);
+
+	// note: not recorded, callbacks are application code and can't be replayed
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	return device_ptr->next.registerSemaphoreCallback(device_ptr->next_device, semaphore, value, callback, user_data);
+}
+
+static Opal_Result capture_deviceWaitPipelineTask(Opal_Device this, Opal_PipelineTask task, uint64_t timeout_milliseconds)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+
+	Opal_Result result = device_ptr->next.waitPipelineTask(device_ptr->next_device, task, timeout_milliseconds);
+	if (result == OPAL_WAIT_TIMEOUT || result == OPAL_INVALID_PIPELINE_TASK)
+		return result;
+
+	Capture_PipelineTask *task_ptr = (Capture_PipelineTask *)opal_mapFind(&device_ptr->pipeline_tasks, task);
+	if (task_ptr == NULL)
+		return result;
+
+	capture_deviceRecordPipelines(device_ptr, task_ptr->call, task_ptr->num_pipelines, task_ptr->descs, task_ptr->pipelines, result);
+	opal_mapRemove(&device_ptr->pipeline_tasks, task);
+
+	return result;
+}
+
+static Opal_Result capture_deviceWaitQueue(Opal_Device this, Opal_Queue queue)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.waitQueue(device_ptr->next_device, queue);
+
+	capture_beginRecord(stream);
+	capture_callWaitQueue(stream, &this, &queue);
+	capture_endRecord(stream, CAPTURE_CALL_WAIT_QUEUE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceWaitIdle(Opal_Device this)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.waitIdle(device_ptr->next_device);
+
+	capture_beginRecord(stream);
+	capture_callWaitIdle(stream, &this);
+	capture_endRecord(stream, CAPTURE_CALL_WAIT_IDLE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceSubmit(Opal_Device this, Opal_Queue queue, const Opal_SubmitDesc *desc)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	capture_deviceFlushMappedBuffers(device_ptr);
+
+	Opal_Result result = device_ptr->next.submit(device_ptr->next_device, queue, desc);
+
+	capture_beginRecord(stream);
+	capture_callSubmit(stream, &this, &queue, &desc);
+	capture_endRecord(stream, CAPTURE_CALL_SUBMIT, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceAcquire(Opal_Device this, Opal_Swapchain swapchain, Opal_TextureView *texture_view)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.acquire(device_ptr->next_device, swapchain, texture_view);
+
+	capture_beginRecord(stream);
+	capture_callAcquire(stream, &this, &swapchain, texture_view);
+	capture_endRecord(stream, CAPTURE_CALL_ACQUIRE, result);
+
+	return result;
+}
+
+static Opal_Result capture_devicePresent(Opal_Device this, Opal_Swapchain swapchain)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.present(device_ptr->next_device, swapchain);
+
+	capture_beginRecord(stream);
+	capture_callPresent(stream, &this, &swapchain);
+	capture_endRecord(stream, CAPTURE_CALL_PRESENT, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceWaitPresent(Opal_Device this, Opal_Swapchain swapchain, uint64_t frame_id, uint64_t timeout_milliseconds)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.waitPresent(device_ptr->next_device, swapchain, frame_id, timeout_milliseconds);
+
+	capture_beginRecord(stream);
+	capture_callWaitPresent(stream, &this, &swapchain, &frame_id, &timeout_milliseconds);
+	capture_endRecord(stream, CAPTURE_CALL_WAIT_PRESENT, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceGetSwapchainFrameTiming(Opal_Device this, Opal_Swapchain swapchain, Opal_FrameTiming *timing)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.getSwapchainFrameTiming(device_ptr->next_device, swapchain, timing);
+
+	capture_beginRecord(stream);
+	capture_callGetSwapchainFrameTiming(stream, &this, &swapchain);
+	capture_endRecord(stream, CAPTURE_CALL_GET_SWAPCHAIN_FRAME_TIMING, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdSetDescriptorHeap(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_DescriptorHeap descriptor_heap)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdSetDescriptorHeap(device_ptr->next_device, command_buffer, descriptor_heap);
+
+	capture_beginRecord(stream);
+	capture_callCmdSetDescriptorHeap(stream, &this, &command_buffer, &descriptor_heap);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_SET_DESCRIPTOR_HEAP, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdBeginGraphicsPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_FramebufferDesc *desc, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdBeginGraphicsPass(device_ptr->next_device, command_buffer, desc, barriers);
+
+	capture_beginRecord(stream);
+	capture_callCmdBeginGraphicsPass(stream, &this, &command_buffer, &desc, &barriers);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_BEGIN_GRAPHICS_PASS, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdGraphicsSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdGraphicsSetPipelineLayout(device_ptr->next_device, command_buffer, pipeline_layout);
+
+	capture_beginRecord(stream);
+	capture_callCmdSetObject(stream, &this, &command_buffer, CAPTURE_HANDLE_TYPE_PIPELINE_LAYOUT, &pipeline_layout);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_GRAPHICS_SET_PIPELINE_LAYOUT, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdGraphicsSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_GraphicsPipeline pipeline)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdGraphicsSetPipeline(device_ptr->next_device, command_buffer, pipeline);
+
+	capture_beginRecord(stream);
+	capture_callCmdSetObject(stream, &this, &command_buffer, CAPTURE_HANDLE_TYPE_GRAPHICS_PIPELINE, &pipeline);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_GRAPHICS_SET_PIPELINE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdGraphicsSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdGraphicsSetDescriptorSet(device_ptr->next_device, command_buffer, index, descriptor_set, num_dynamic_offsets, dynamic_offsets);
+
+	capture_beginRecord(stream);
+	capture_callCmdSetDescriptorSet(stream, &this, &command_buffer, &index, &descriptor_set, &num_dynamic_offsets, &dynamic_offsets);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_GRAPHICS_SET_DESCRIPTOR_SET, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdGraphicsSetVertexBuffers(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t first_index, uint32_t num_vertex_buffers, const Opal_VertexBufferView *vertex_buffers)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdGraphicsSetVertexBuffers(device_ptr->next_device, command_buffer, first_index, num_vertex_buffers, vertex_buffers);
+
+	capture_beginRecord(stream);
+	capture_callCmdGraphicsSetVertexBuffers(stream, &this, &command_buffer, &first_index, &num_vertex_buffers, &vertex_buffers);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_GRAPHICS_SET_VERTEX_BUFFERS, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdGraphicsSetIndexBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_IndexBufferView index_buffer)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdGraphicsSetIndexBuffer(device_ptr->next_device, command_buffer, index_buffer);
+
+	capture_beginRecord(stream);
+	capture_callCmdGraphicsSetIndexBuffer(stream, &this, &command_buffer, &index_buffer);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_GRAPHICS_SET_INDEX_BUFFER, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdGraphicsSetViewport(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Viewport viewport)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdGraphicsSetViewport(device_ptr->next_device, command_buffer, viewport);
+
+	capture_beginRecord(stream);
+	capture_callCmdGraphicsSetViewport(stream, &this, &command_buffer, &viewport);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_GRAPHICS_SET_VIEWPORT, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdGraphicsSetScissor(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdGraphicsSetScissor(device_ptr->next_device, command_buffer, x, y, width, height);
+
+	capture_beginRecord(stream);
+	capture_callCmdGraphicsSetScissor(stream, &this, &command_buffer, &x, &y, &width, &height);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_GRAPHICS_SET_SCISSOR, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdGraphicsDraw(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_vertices, uint32_t num_instances, uint32_t base_vertex, uint32_t base_instance)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdGraphicsDraw(device_ptr->next_device, command_buffer, num_vertices, num_instances, base_vertex, base_instance);
+
+	capture_beginRecord(stream);
+	capture_callCmdGraphicsDraw(stream, &this, &command_buffer, &num_vertices, &num_instances, &base_vertex, &base_instance);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_GRAPHICS_DRAW, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdGraphicsDrawIndexed(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_indices, uint32_t num_instances, uint32_t base_index, int32_t vertex_offset, uint32_t base_instance)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdGraphicsDrawIndexed(device_ptr->next_device, command_buffer, num_indices, num_instances, base_index, vertex_offset, base_instance);
+
+	capture_beginRecord(stream);
+	capture_callCmdGraphicsDrawIndexed(stream, &this, &command_buffer, &num_indices, &num_instances, &base_index, &vertex_offset, &base_instance);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_GRAPHICS_DRAW_INDEXED, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdGraphicsMeshletDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_threadgroups_x, uint32_t num_threadgroups_y, uint32_t num_threadgroups_z)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdGraphicsMeshletDispatch(device_ptr->next_device, command_buffer, num_threadgroups_x, num_threadgroups_y, num_threadgroups_z);
+
+	capture_beginRecord(stream);
+	capture_callCmdDispatch(stream, &this, &command_buffer, &num_threadgroups_x, &num_threadgroups_y, &num_threadgroups_z);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_GRAPHICS_MESHLET_DISPATCH, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdEndGraphicsPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdEndGraphicsPass(device_ptr->next_device, command_buffer, barriers);
+
+	capture_beginRecord(stream);
+	capture_callCmdBeginPass(stream, &this, &command_buffer, &barriers);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_END_GRAPHICS_PASS, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdBeginComputePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdBeginComputePass(device_ptr->next_device, command_buffer, barriers);
+
+	capture_beginRecord(stream);
+	capture_callCmdBeginPass(stream, &this, &command_buffer, &barriers);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_BEGIN_COMPUTE_PASS, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdComputeSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdComputeSetPipelineLayout(device_ptr->next_device, command_buffer, pipeline_layout);
+
+	capture_beginRecord(stream);
+	capture_callCmdSetObject(stream, &this, &command_buffer, CAPTURE_HANDLE_TYPE_PIPELINE_LAYOUT, &pipeline_layout);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_COMPUTE_SET_PIPELINE_LAYOUT, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdComputeSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_ComputePipeline pipeline)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdComputeSetPipeline(device_ptr->next_device, command_buffer, pipeline);
+
+	capture_beginRecord(stream);
+	capture_callCmdSetObject(stream, &this, &command_buffer, CAPTURE_HANDLE_TYPE_COMPUTE_PIPELINE, &pipeline);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_COMPUTE_SET_PIPELINE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdComputeSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdComputeSetDescriptorSet(device_ptr->next_device, command_buffer, index, descriptor_set, num_dynamic_offsets, dynamic_offsets);
+
+	capture_beginRecord(stream);
+	capture_callCmdSetDescriptorSet(stream, &this, &command_buffer, &index, &descriptor_set, &num_dynamic_offsets, &dynamic_offsets);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_COMPUTE_SET_DESCRIPTOR_SET, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdComputeMemoryBarrier(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_MemoryBarrierDesc *barriers)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdComputeMemoryBarrier(device_ptr->next_device, command_buffer, barriers);
+
+	capture_beginRecord(stream);
+	capture_callCmdMemoryBarrier(stream, &this, &command_buffer, &barriers);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_COMPUTE_MEMORY_BARRIER, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdComputeDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_threadgroups_x, uint32_t num_threadgroups_y, uint32_t num_threadgroups_z)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdComputeDispatch(device_ptr->next_device, command_buffer, num_threadgroups_x, num_threadgroups_y, num_threadgroups_z);
+
+	capture_beginRecord(stream);
+	capture_callCmdDispatch(stream, &this, &command_buffer, &num_threadgroups_x, &num_threadgroups_y, &num_threadgroups_z);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_COMPUTE_DISPATCH, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdEndComputePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdEndComputePass(device_ptr->next_device, command_buffer, barriers);
+
+	capture_beginRecord(stream);
+	capture_callCmdBeginPass(stream, &this, &command_buffer, &barriers);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_END_COMPUTE_PASS, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdBeginRaytracePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdBeginRaytracePass(device_ptr->next_device, command_buffer, barriers);
+
+	capture_beginRecord(stream);
+	capture_callCmdBeginPass(stream, &this, &command_buffer, &barriers);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_BEGIN_RAYTRACE_PASS, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdRaytraceSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdRaytraceSetPipelineLayout(device_ptr->next_device, command_buffer, pipeline_layout);
+
+	capture_beginRecord(stream);
+	capture_callCmdSetObject(stream, &this, &command_buffer, CAPTURE_HANDLE_TYPE_PIPELINE_LAYOUT, &pipeline_layout);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_RAYTRACE_SET_PIPELINE_LAYOUT, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdRaytraceSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_ComputePipeline pipeline)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdRaytraceSetPipeline(device_ptr->next_device, command_buffer, pipeline);
+
+	capture_beginRecord(stream);
+	capture_callCmdSetObject(stream, &this, &command_buffer, CAPTURE_HANDLE_TYPE_RAYTRACE_PIPELINE, &pipeline);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_RAYTRACE_SET_PIPELINE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdRaytraceSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdRaytraceSetDescriptorSet(device_ptr->next_device, command_buffer, index, descriptor_set, num_dynamic_offsets, dynamic_offsets);
+
+	capture_beginRecord(stream);
+	capture_callCmdSetDescriptorSet(stream, &this, &command_buffer, &index, &descriptor_set, &num_dynamic_offsets, &dynamic_offsets);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_RAYTRACE_SET_DESCRIPTOR_SET, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdRaytraceSetShaderBindingTable(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_ShaderBindingTable shader_binding_table)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdRaytraceSetShaderBindingTable(device_ptr->next_device, command_buffer, shader_binding_table);
+
+	capture_beginRecord(stream);
+	capture_callCmdSetObject(stream, &this, &command_buffer, CAPTURE_HANDLE_TYPE_SHADER_BINDING_TABLE, &shader_binding_table);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_RAYTRACE_SET_SHADER_BINDING_TABLE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdRaytraceMemoryBarrier(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_MemoryBarrierDesc *barriers)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdRaytraceMemoryBarrier(device_ptr->next_device, command_buffer, barriers);
+
+	capture_beginRecord(stream);
+	capture_callCmdMemoryBarrier(stream, &this, &command_buffer, &barriers);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_RAYTRACE_MEMORY_BARRIER, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdRaytraceDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t width, uint32_t height, uint32_t depth)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdRaytraceDispatch(device_ptr->next_device, command_buffer, width, height, depth);
+
+	capture_beginRecord(stream);
+	capture_callCmdDispatch(stream, &this, &command_buffer, &width, &height, &depth);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_RAYTRACE_DISPATCH, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdEndRaytracePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdEndRaytracePass(device_ptr->next_device, command_buffer, barriers);
+
+	capture_beginRecord(stream);
+	capture_callCmdBeginPass(stream, &this, &command_buffer, &barriers);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_END_RAYTRACE_PASS, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdBeginCopyPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdBeginCopyPass(device_ptr->next_device, command_buffer, barriers);
+
+	capture_beginRecord(stream);
+	capture_callCmdBeginPass(stream, &this, &command_buffer, &barriers);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_BEGIN_COPY_PASS, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdCopyBufferToBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer src_buffer, uint64_t src_offset, Opal_Buffer dst_buffer, uint64_t dst_offset, uint64_t size)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdCopyBufferToBuffer(device_ptr->next_device, command_buffer, src_buffer, src_offset, dst_buffer, dst_offset, size);
+
+	capture_beginRecord(stream);
+	capture_callCmdCopyBufferToBuffer(stream, &this, &command_buffer, &src_buffer, &src_offset, &dst_buffer, &dst_offset, &size);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_COPY_BUFFER_TO_BUFFER, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdCopyBufferToTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_BufferTextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdCopyBufferToTexture(device_ptr->next_device, command_buffer, src, dst, size);
+
+	capture_beginRecord(stream);
+	capture_callCmdCopyBufferToTexture(stream, &this, &command_buffer, &src, &dst, &size);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_COPY_BUFFER_TO_TEXTURE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdCopyTextureToBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_BufferTextureRegion dst, Opal_Extent3D size)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdCopyTextureToBuffer(device_ptr->next_device, command_buffer, src, dst, size);
+
+	capture_beginRecord(stream);
+	capture_callCmdCopyTextureToBuffer(stream, &this, &command_buffer, &src, &dst, &size);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_COPY_TEXTURE_TO_BUFFER, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdCopyBufferToTextureRegions(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer src_buffer, Opal_Texture dst_texture, uint32_t num_regions, const Opal_BufferTextureCopyRegion *regions)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdCopyBufferToTextureRegions(device_ptr->next_device, command_buffer, src_buffer, dst_texture, num_regions, regions);
+
+	capture_beginRecord(stream);
+	capture_callCmdCopyBufferToTextureRegions(stream, &this, &command_buffer, &src_buffer, &dst_texture, &num_regions, &regions);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_COPY_BUFFER_TO_TEXTURE_REGIONS, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdCopyTextureToBufferRegions(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Texture src_texture, Opal_Buffer dst_buffer, uint32_t num_regions, const Opal_BufferTextureCopyRegion *regions)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdCopyTextureToBufferRegions(device_ptr->next_device, command_buffer, src_texture, dst_buffer, num_regions, regions);
+
+	capture_beginRecord(stream);
+	capture_callCmdCopyTextureToBufferRegions(stream, &this, &command_buffer, &src_texture, &dst_buffer, &num_regions, &regions);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_COPY_TEXTURE_TO_BUFFER_REGIONS, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdCopyTextureToTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdCopyTextureToTexture(device_ptr->next_device, command_buffer, src, dst, size);
+
+	capture_beginRecord(stream);
+	capture_callCmdCopyTextureToTexture(stream, &this, &command_buffer, &src, &dst, &size);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_COPY_TEXTURE_TO_TEXTURE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdFillBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer buffer, uint64_t offset, uint64_t size, uint32_t value)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdFillBuffer(device_ptr->next_device, command_buffer, buffer, offset, size, value);
+
+	capture_beginRecord(stream);
+	capture_callCmdFillBuffer(stream, &this, &command_buffer, &buffer, &offset, &size, &value);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_FILL_BUFFER, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdUpdateBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer buffer, uint64_t offset, uint64_t size, const void *data)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdUpdateBuffer(device_ptr->next_device, command_buffer, buffer, offset, size, data);
+
+	capture_beginRecord(stream);
+	capture_callCmdUpdateBuffer(stream, &this, &command_buffer, &buffer, &offset, &size, &data);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_UPDATE_BUFFER, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdClearTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureView texture_view, Opal_ClearValue clear_value)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdClearTexture(device_ptr->next_device, command_buffer, texture_view, clear_value);
+
+	capture_beginRecord(stream);
+	capture_callCmdClearTexture(stream, &this, &command_buffer, &texture_view, &clear_value);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_CLEAR_TEXTURE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdBlitTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_Extent3D src_size, Opal_TextureRegion dst, Opal_Extent3D dst_size, Opal_SamplerFilterMode filter)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdBlitTexture(device_ptr->next_device, command_buffer, src, src_size, dst, dst_size, filter);
+
+	capture_beginRecord(stream);
+	capture_callCmdBlitTexture(stream, &this, &command_buffer, &src, &src_size, &dst, &dst_size, &filter);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_BLIT_TEXTURE, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdGenerateMips(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureView texture_view)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdGenerateMips(device_ptr->next_device, command_buffer, texture_view);
+
+	capture_beginRecord(stream);
+	capture_callCmdGenerateMips(stream, &this, &command_buffer, &texture_view);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_GENERATE_MIPS, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdEndCopyPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdEndCopyPass(device_ptr->next_device, command_buffer, barriers);
+
+	capture_beginRecord(stream);
+	capture_callCmdBeginPass(stream, &this, &command_buffer, &barriers);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_END_COPY_PASS, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdBeginAccelerationStructurePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdBeginAccelerationStructurePass(device_ptr->next_device, command_buffer, barriers);
+
+	capture_beginRecord(stream);
+	capture_callCmdBeginPass(stream, &this, &command_buffer, &barriers);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_BEGIN_ACCELERATION_STRUCTURE_PASS, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdAccelerationStructureBuild(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureBuildDesc *desc)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdAccelerationStructureBuild(device_ptr->next_device, command_buffer, desc);
+
+	capture_beginRecord(stream);
+	capture_callCmdAccelerationStructureBuild(stream, &this, &command_buffer, &desc);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_ACCELERATION_STRUCTURE_BUILD, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdAccelerationStructureBuildBatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_descs, const Opal_AccelerationStructureBuildDesc *descs)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdAccelerationStructureBuildBatch(device_ptr->next_device, command_buffer, num_descs, descs);
+
+	capture_beginRecord(stream);
+	capture_callCmdAccelerationStructureBuildBatch(stream, &this, &command_buffer, &num_descs, &descs);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_ACCELERATION_STRUCTURE_BUILD_BATCH, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdAccelerationStructureCopy(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureCopyDesc *desc)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdAccelerationStructureCopy(device_ptr->next_device, command_buffer, desc);
+
+	capture_beginRecord(stream);
+	capture_callCmdAccelerationStructureCopy(stream, &this, &command_buffer, &desc);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_ACCELERATION_STRUCTURE_COPY, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdAccelerationStructureWriteCompactedSizes(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_acceleration_structures, const Opal_AccelerationStructure *acceleration_structures, Opal_BufferView dst)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdAccelerationStructureWriteCompactedSizes(device_ptr->next_device, command_buffer, num_acceleration_structures, acceleration_structures, dst);
+
+	capture_beginRecord(stream);
+	capture_callCmdAccelerationStructureWriteCompactedSizes(stream, &this, &command_buffer, &num_acceleration_structures, &acceleration_structures, &dst);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_ACCELERATION_STRUCTURE_WRITE_COMPACTED_SIZES, result);
+
+	return result;
+}
+
+static Opal_Result capture_deviceCmdEndAccelerationStructurePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+
+	Capture_Device *device_ptr = (Capture_Device *)this;
+	Capture_Stream *stream = &device_ptr->instance->stream;
+
+	Opal_Result result = device_ptr->next.cmdEndAccelerationStructurePass(device_ptr->next_device, command_buffer, barriers);
+
+	capture_beginRecord(stream);
+	capture_callCmdBeginPass(stream, &this, &command_buffer, &barriers);
+	capture_endRecord(stream, CAPTURE_CALL_CMD_END_ACCELERATION_STRUCTURE_PASS, result);
+
+	return result;
+}
+
+/*
+ */
+static Opal_DeviceTable device_vtbl =
+{
+	capture_deviceGetDeviceInfo,
+	capture_deviceGetDeviceQueue,
+	capture_deviceGetAccelerationStructurePrebuildInfo,
+	capture_deviceGetAccelerationStructureAddress,
+	capture_deviceGetSupportedSurfaceFormats,
+	capture_deviceGetSupportedPresentModes,
+	capture_deviceGetPreferredSurfaceFormat,
+	capture_deviceGetPreferredSurfacePresentMode,
+
+	capture_deviceCreateSemaphore,
+	capture_deviceCreateFence,
+	capture_deviceCreateBuffer,
+	capture_deviceCreateTexture,
+	capture_deviceCreateTextureView,
+	capture_deviceCreateSampler,
+	capture_deviceCreateAccelerationStructure,
+	capture_deviceCreateShaderBindingTable,
+	capture_deviceCreateCommandAllocator,
+	capture_deviceCreateCommandBuffer,
+	capture_deviceCreateShader,
+	capture_deviceCreateDescriptorHeap,
+	capture_deviceCreateDescriptorSetLayout,
+	capture_deviceCreatePipelineLayout,
+	capture_deviceCreateGraphicsPipeline,
+	capture_deviceCreateMeshletPipeline,
+	capture_deviceCreateComputePipeline,
+	capture_deviceCreateRaytracePipeline,
+	capture_deviceCreateGraphicsPipelines,
+	capture_deviceCreateComputePipelines,
+	capture_deviceCreateRaytracePipelines,
+	capture_deviceCreateGraphicsPipelinesAsync,
+	capture_deviceCreateComputePipelinesAsync,
+	capture_deviceCreateRaytracePipelinesAsync,
+	capture_deviceCreateSwapchain,
+
+	capture_deviceDestroySemaphore,
+	capture_deviceDestroyFence,
+	capture_deviceDestroyBuffer,
+	capture_deviceDestroyTexture,
+	capture_deviceDestroyTextureView,
+	capture_deviceDestroySampler,
+	capture_deviceDestroyAccelerationStructure,
+	capture_deviceDestroyShaderBindingTable,
+	capture_deviceDestroyCommandAllocator,
+	capture_deviceDestroyCommandBuffer,
+	capture_deviceDestroyShader,
+	capture_deviceDestroyDescriptorHeap,
+	capture_deviceDestroyDescriptorSetLayout,
+	capture_deviceDestroyPipelineLayout,
+	capture_deviceDestroyGraphicsPipeline,
+	capture_deviceDestroyComputePipeline,
+	capture_deviceDestroyRaytracePipeline,
+	capture_deviceDestroySwapchain,
+	capture_deviceDestroyDevice,
+
+	capture_deviceBuildShaderBindingTable,
+	capture_deviceBuildAccelerationStructureInstanceBuffer,
+	capture_deviceResetCommandAllocator,
+	capture_deviceAllocateDescriptorSet,
+	capture_deviceFreeDescriptorSet,
+	capture_deviceMapBuffer,
+	capture_deviceUnmapBuffer,
+	capture_deviceWriteBuffer,
+	capture_deviceUpdateDescriptorSet,
+	capture_deviceBeginCommandBuffer,
+	capture_deviceEndCommandBuffer,
+	capture_deviceQuerySemaphore,
+	capture_deviceSignalSemaphore,
+	capture_deviceWaitSemaphore,
+	capture_deviceWaitSemaphores,
+	capture_deviceRegisterSemaphoreCallback,
+	capture_deviceWaitPipelineTask,
+	capture_deviceWaitQueue,
+	capture_deviceWaitIdle,
+	capture_deviceSubmit,
+	capture_deviceAcquire,
+	capture_devicePresent,
+	capture_deviceWaitPresent,
+	capture_deviceGetSwapchainFrameTiming,
+
+	capture_deviceCmdSetDescriptorHeap,
+
+	capture_deviceCmdBeginGraphicsPass,
+	capture_deviceCmdGraphicsSetPipelineLayout,
+	capture_deviceCmdGraphicsSetPipeline,
+	capture_deviceCmdGraphicsSetDescriptorSet,
+	capture_deviceCmdGraphicsSetVertexBuffers,
+	capture_deviceCmdGraphicsSetIndexBuffer,
+	capture_deviceCmdGraphicsSetViewport,
+	capture_deviceCmdGraphicsSetScissor,
+	capture_deviceCmdGraphicsDraw,
+	capture_deviceCmdGraphicsDrawIndexed,
+	capture_deviceCmdGraphicsMeshletDispatch,
+	capture_deviceCmdEndGraphicsPass,
+
+	capture_deviceCmdBeginComputePass,
+	capture_deviceCmdComputeSetPipelineLayout,
+	capture_deviceCmdComputeSetPipeline,
+	capture_deviceCmdComputeSetDescriptorSet,
+	capture_deviceCmdComputeMemoryBarrier,
+	capture_deviceCmdComputeDispatch,
+	capture_deviceCmdEndComputePass,
+
+	capture_deviceCmdBeginRaytracePass,
+	capture_deviceCmdRaytraceSetPipelineLayout,
+	capture_deviceCmdRaytraceSetPipeline,
+	capture_deviceCmdRaytraceSetDescriptorSet,
+	capture_deviceCmdRaytraceSetShaderBindingTable,
+	capture_deviceCmdRaytraceMemoryBarrier,
+	capture_deviceCmdRaytraceDispatch,
+	capture_deviceCmdEndRaytracePass,
+
+	capture_deviceCmdBeginCopyPass,
+	capture_deviceCmdCopyBufferToBuffer,
+	capture_deviceCmdCopyBufferToTexture,
+	capture_deviceCmdCopyTextureToBuffer,
+	capture_deviceCmdCopyBufferToTextureRegions,
+	capture_deviceCmdCopyTextureToBufferRegions,
+	capture_deviceCmdCopyTextureToTexture,
+	capture_deviceCmdFillBuffer,
+	capture_deviceCmdUpdateBuffer,
+	capture_deviceCmdClearTexture,
+	capture_deviceCmdBlitTexture,
+	capture_deviceCmdGenerateMips,
+	capture_deviceCmdEndCopyPass,
+
+	capture_deviceCmdBeginAccelerationStructurePass,
+	capture_deviceCmdAccelerationStructureBuild,
+	capture_deviceCmdAccelerationStructureBuildBatch,
+	capture_deviceCmdAccelerationStructureCopy,
+	capture_deviceCmdAccelerationStructureWriteCompactedSizes,
+	capture_deviceCmdEndAccelerationStructurePass,
+};
+
+/*
+ */
+Opal_Result capture_deviceInitialize(Capture_Device *device_ptr, Capture_Instance *instance_ptr, Opal_Device next_device)
+{
+	assert(device_ptr);
+	assert(instance_ptr);
+	assert(next_device != OPAL_NULL_HANDLE);
+
+	memset(device_ptr, 0, sizeof(Capture_Device));
+
+	// vtable
+	device_ptr->vtbl = &device_vtbl;
+
+	// data
+	device_ptr->instance = instance_ptr;
+	device_ptr->next_device = next_device;
+
+	Opal_Result result = opalGetDeviceTable(next_device, &device_ptr->next);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	opal_mapInitialize(&device_ptr->buffers, sizeof(Capture_Buffer), 64);
+	opal_mapInitialize(&device_ptr->descriptor_set_layouts, sizeof(Capture_DescriptorSetLayout), 16);
+	opal_mapInitialize(&device_ptr->descriptor_sets, sizeof(Opal_DescriptorSetLayout), 64);
+	opal_mapInitialize(&device_ptr->pipeline_tasks, sizeof(Capture_PipelineTask), 16);
+
+	return OPAL_SUCCESS;
+}
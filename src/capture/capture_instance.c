@@ -0,0 +1,211 @@
+#include "capture_internal.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ */
+static Opal_Result capture_instanceEnumerateDevices(Opal_Instance this, uint32_t *device_count, Opal_DeviceInfo *infos)
+{
+	assert(this);
+
+	Capture_Instance *instance_ptr = (Capture_Instance *)this;
+	Capture_Stream *stream = &instance_ptr->stream;
+
+	Opal_Result result = instance_ptr->next.enumerateDevices(instance_ptr->next_instance, device_count, infos);
+
+	capture_beginRecord(stream);
+	capture_callEnumerateDevices(stream, &this);
+	capture_endRecord(stream, CAPTURE_CALL_ENUMERATE_DEVICES, result);
+
+	return result;
+}
+
+static Opal_Result capture_instanceCreateSurface(Opal_Instance this, void *handle, Opal_Surface *surface)
+{
+	assert(this);
+	assert(surface);
+
+	Capture_Instance *instance_ptr = (Capture_Instance *)this;
+	Capture_Stream *stream = &instance_ptr->stream;
+
+	Opal_Result result = instance_ptr->next.createSurface(instance_ptr->next_instance, handle, surface);
+
+	capture_beginRecord(stream);
+	capture_callCreateSurface(stream, &this, surface);
+	capture_endRecord(stream, CAPTURE_CALL_CREATE_SURFACE, result);
+
+	return result;
+}
+
+static Opal_Result capture_instanceCreateHeadlessSurface(Opal_Instance this, uint32_t width, uint32_t height, Opal_Surface *surface)
+{
+	assert(this);
+	assert(surface);
+
+	Capture_Instance *instance_ptr = (Capture_Instance *)this;
+	Capture_Stream *stream = &instance_ptr->stream;
+
+	Opal_Result result = instance_ptr->next.createHeadlessSurface(instance_ptr->next_instance, width, height, surface);
+
+	capture_beginRecord(stream);
+	capture_callCreateHeadlessSurface(stream, &this, &width, &height, surface);
+	capture_endRecord(stream, CAPTURE_CALL_CREATE_HEADLESS_SURFACE, result);
+
+	return result;
+}
+
+static Opal_Result capture_instanceWrapDevice(Capture_Instance *instance_ptr, Opal_Device next_device, Opal_Device *device)
+{
+	assert(instance_ptr);
+	assert(device);
+
+	Capture_Device *device_ptr = (Capture_Device *)malloc(sizeof(Capture_Device));
+	assert(device_ptr);
+
+	Opal_Result result = capture_deviceInitialize(device_ptr, instance_ptr, next_device);
+	if (result != OPAL_SUCCESS)
+	{
+		// note: the next layer already created its device, so it has to go as well
+		if (device_ptr->next.destroyDevice)
+			device_ptr->next.destroyDevice(next_device);
+
+		free(device_ptr);
+		return result;
+	}
+
+	*device = (Opal_Device)device_ptr;
+	return OPAL_SUCCESS;
+}
+
+static Opal_Result capture_instanceCreateDevice(Opal_Instance this, uint32_t index, Opal_Device *device)
+{
+	assert(this);
+	assert(device);
+
+	Capture_Instance *instance_ptr = (Capture_Instance *)this;
+	Capture_Stream *stream = &instance_ptr->stream;
+
+	Opal_Device next_device = OPAL_NULL_HANDLE;
+	Opal_Result result = instance_ptr->next.createDevice(instance_ptr->next_instance, index, &next_device);
+
+	if (result == OPAL_SUCCESS)
+		result = capture_instanceWrapDevice(instance_ptr, next_device, device);
+
+	capture_beginRecord(stream);
+	capture_callCreateDevice(stream, &this, &index, device);
+	capture_endRecord(stream, CAPTURE_CALL_CREATE_DEVICE, result);
+
+	return result;
+}
+
+static Opal_Result capture_instanceCreateDefaultDevice(Opal_Instance this, Opal_DeviceHint hint, Opal_Device *device)
+{
+	assert(this);
+	assert(device);
+
+	Capture_Instance *instance_ptr = (Capture_Instance *)this;
+	Capture_Stream *stream = &instance_ptr->stream;
+
+	Opal_Device next_device = OPAL_NULL_HANDLE;
+	Opal_Result result = instance_ptr->next.createDefaultDevice(instance_ptr->next_instance, hint, &next_device);
+
+	if (result == OPAL_SUCCESS)
+		result = capture_instanceWrapDevice(instance_ptr, next_device, device);
+
+	capture_beginRecord(stream);
+	capture_callCreateDefaultDevice(stream, &this, &hint, device);
+	capture_endRecord(stream, CAPTURE_CALL_CREATE_DEFAULT_DEVICE, result);
+
+	return result;
+}
+
+static Opal_Result capture_instanceDestroySurface(Opal_Instance this, Opal_Surface surface)
+{
+	assert(this);
+
+	Capture_Instance *instance_ptr = (Capture_Instance *)this;
+	Capture_Stream *stream = &instance_ptr->stream;
+
+	Opal_Result result = instance_ptr->next.destroySurface(instance_ptr->next_instance, surface);
+
+	capture_beginRecord(stream);
+	capture_callDestroySurface(stream, &this, &surface);
+	capture_endRecord(stream, CAPTURE_CALL_DESTROY_SURFACE, result);
+
+	return result;
+}
+
+static Opal_Result capture_instanceDestroy(Opal_Instance this)
+{
+	assert(this);
+
+	Capture_Instance *instance_ptr = (Capture_Instance *)this;
+	Capture_Stream *stream = &instance_ptr->stream;
+
+	Opal_Result result = instance_ptr->next.destroyInstance(instance_ptr->next_instance);
+
+	capture_beginRecord(stream);
+	capture_callDestroyInstance(stream, &this);
+	capture_endRecord(stream, CAPTURE_CALL_DESTROY_INSTANCE, result);
+
+	capture_streamClose(stream);
+
+	free(instance_ptr);
+	return result;
+}
+
+/*
+ */
+static Opal_InstanceTable instance_vtbl =
+{
+	capture_instanceEnumerateDevices,
+
+	capture_instanceCreateSurface,
+	capture_instanceCreateHeadlessSurface,
+	capture_instanceCreateDevice,
+	capture_instanceCreateDefaultDevice,
+
+	capture_instanceDestroySurface,
+	capture_instanceDestroy,
+};
+
+/*
+ */
+Opal_Result capture_opalWrapInstance(void *user_data, Opal_Api api, const Opal_InstanceDesc *desc, Opal_Instance next_instance, Opal_Instance *instance)
+{
+	assert(user_data);
+	assert(next_instance != OPAL_NULL_HANDLE);
+	assert(instance);
+
+	const char *path = (const char *)user_data;
+
+	Capture_Instance *ptr = (Capture_Instance *)malloc(sizeof(Capture_Instance));
+	assert(ptr);
+
+	memset(ptr, 0, sizeof(Capture_Instance));
+
+	Opal_Result result = capture_streamOpenWrite(&ptr->stream, path, api);
+	if (result != OPAL_SUCCESS)
+	{
+		free(ptr);
+		return result;
+	}
+
+	// vtable
+	ptr->vtbl = &instance_vtbl;
+
+	// data
+	ptr->next_instance = next_instance;
+	opalGetInstanceTable(next_instance, &ptr->next);
+
+	Opal_Instance handle = (Opal_Instance)ptr;
+
+	capture_beginRecord(&ptr->stream);
+	capture_callCreateInstance(&ptr->stream, &api, &desc, &handle);
+	capture_endRecord(&ptr->stream, CAPTURE_CALL_CREATE_INSTANCE, OPAL_SUCCESS);
+
+	*instance = handle;
+	return OPAL_SUCCESS;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "opal_internal.h"
+
+#include "capture/capture_codec.h"
+#include "common/map.h"
+
+typedef struct Capture_Instance_t
+{
+	Opal_InstanceTable *vtbl;
+	Opal_Instance next_instance;
+	Opal_InstanceTable next;
+	Capture_Stream stream;
+} Capture_Instance;
+
+typedef struct Capture_Buffer_t
+{
+	uint64_t size;
+	uint8_t *mapped_ptr;
+	uint8_t *shadow;
+} Capture_Buffer;
+
+typedef struct Capture_DescriptorSetLayout_t
+{
+	uint32_t refcount;
+	uint32_t num_entries;
+	Opal_DescriptorSetLayoutEntry *entries;
+} Capture_DescriptorSetLayout;
+
+typedef struct Capture_PipelineTask_t
+{
+	Capture_Call call;
+	uint32_t num_pipelines;
+	const void *descs;
+	uint64_t *pipelines;
+} Capture_PipelineTask;
+
+typedef struct Capture_Device_t
+{
+	Opal_DeviceTable *vtbl;
+	Opal_Device next_device;
+	Opal_DeviceTable next;
+	Capture_Instance *instance;
+	Opal_Map buffers;
+	Opal_Map descriptor_set_layouts;
+	Opal_Map descriptor_sets;
+	Opal_Map pipeline_tasks;
+	Capture_DescriptorEntryType *entry_types;
+	uint32_t entry_types_capacity;
+} Capture_Device;
+
+Opal_Result capture_deviceInitialize(Capture_Device *device_ptr, Capture_Instance *instance_ptr, Opal_Device next_device);
@@ -0,0 +1,131 @@
+#include "batch.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+/*
+ */
+static uint32_t opal_buildBatchAddScratch(Opal_BuildBatch *batch, const Opal_BufferView *view)
+{
+	assert(batch);
+	assert(view);
+
+	// note: zero sized views cover the rest of the buffer
+	uint64_t begin = view->offset;
+	uint64_t end = (view->size > 0) ? view->offset + view->size : UINT64_MAX;
+
+	Opal_BuildBatchScratch *scratch = (Opal_BuildBatchScratch *)opal_mapFind(&batch->scratches, view->buffer);
+
+	if (scratch == NULL)
+	{
+		Opal_BuildBatchScratch new_scratch = {begin, end};
+		opal_mapInsert(&batch->scratches, view->buffer, &new_scratch);
+	}
+	else
+	{
+		// note: scratch is usually sub-allocated in order, so ranges outside of the span
+		//       used so far skip the per range checks
+		if (end > scratch->begin && begin < scratch->end)
+		{
+			for (uint32_t i = 0; i < batch->num_ranges; ++i)
+			{
+				const Opal_BuildBatchRange *range = &batch->ranges[i];
+
+				if (range->buffer == view->buffer && begin < range->end && range->begin < end)
+					return 0;
+			}
+		}
+
+		if (scratch->begin > begin)
+			scratch->begin = begin;
+
+		if (scratch->end < end)
+			scratch->end = end;
+	}
+
+	if (batch->ranges_capacity == batch->num_ranges)
+	{
+		batch->ranges_capacity = (batch->ranges_capacity == 0) ? 64 : batch->ranges_capacity * 2;
+		batch->ranges = (Opal_BuildBatchRange *)realloc(batch->ranges, sizeof(Opal_BuildBatchRange) * batch->ranges_capacity);
+		assert(batch->ranges);
+	}
+
+	Opal_BuildBatchRange *range = &batch->ranges[batch->num_ranges++];
+	range->buffer = view->buffer;
+	range->begin = begin;
+	range->end = end;
+
+	return 1;
+}
+
+/*
+ */
+Opal_Result opal_buildBatchInitialize(Opal_BuildBatch *batch)
+{
+	assert(batch);
+
+	memset(batch, 0, sizeof(Opal_BuildBatch));
+
+	opal_mapInitialize(&batch->targets, sizeof(uint8_t), 64);
+	opal_mapInitialize(&batch->scratches, sizeof(Opal_BuildBatchScratch), 4);
+
+	return OPAL_SUCCESS;
+}
+
+Opal_Result opal_buildBatchShutdown(Opal_BuildBatch *batch)
+{
+	assert(batch);
+
+	opal_mapShutdown(&batch->targets);
+	opal_mapShutdown(&batch->scratches);
+	free(batch->ranges);
+
+	memset(batch, 0, sizeof(Opal_BuildBatch));
+	return OPAL_SUCCESS;
+}
+
+/*
+ */
+uint32_t opal_buildBatchGetRun(Opal_BuildBatch *batch, uint32_t num_descs, const Opal_AccelerationStructureBuildDesc *descs)
+{
+	assert(batch);
+	assert(num_descs == 0 || descs);
+
+	opal_mapClear(&batch->targets);
+	opal_mapClear(&batch->scratches);
+	batch->num_ranges = 0;
+
+	uint32_t count = 0;
+	for (; count < num_descs; ++count)
+	{
+		const Opal_AccelerationStructureBuildDesc *desc = &descs[count];
+
+		if (desc->type != descs[0].type)
+			break;
+
+		// note: targets holds every acceleration structure the run reads or writes, the value tells which one;
+		//       writing over a source of the run is a hazard as much as writing over a destination
+		if (opal_mapFind(&batch->targets, desc->dst_acceleration_structure) != NULL)
+			break;
+
+		const uint8_t *src_written = NULL;
+		if (desc->src_acceleration_structure != OPAL_NULL_HANDLE)
+			src_written = (const uint8_t *)opal_mapFind(&batch->targets, desc->src_acceleration_structure);
+
+		if (src_written && *src_written)
+			break;
+
+		if (!opal_buildBatchAddScratch(batch, &desc->scratch_buffer))
+			break;
+
+		uint8_t written = 0;
+		if (desc->src_acceleration_structure != OPAL_NULL_HANDLE && src_written == NULL)
+			opal_mapInsert(&batch->targets, desc->src_acceleration_structure, &written);
+
+		written = 1;
+		opal_mapInsert(&batch->targets, desc->dst_acceleration_structure, &written);
+	}
+
+	return count;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <opal.h>
+
+#include "map.h"
+
+// note: splits acceleration structure builds into runs that can be encoded without barriers in between.
+//       A build starts a new run if its scratch range overlaps scratch of a build in the current run,
+//       if it reads or writes an acceleration structure written in the current run, if it writes an
+//       acceleration structure read in the current run, or if the run has builds of the other level,
+//       instance buffers can't be checked for the blases they reference
+typedef struct Opal_BuildBatchScratch_t
+{
+	uint64_t begin;
+	uint64_t end;
+} Opal_BuildBatchScratch;
+
+typedef struct Opal_BuildBatchRange_t
+{
+	uint64_t buffer;
+	uint64_t begin;
+	uint64_t end;
+} Opal_BuildBatchRange;
+
+typedef struct Opal_BuildBatch_t
+{
+	Opal_Map targets;
+	Opal_Map scratches;
+	Opal_BuildBatchRange *ranges;
+	uint32_t num_ranges;
+	uint32_t ranges_capacity;
+} Opal_BuildBatch;
+
+Opal_Result opal_buildBatchInitialize(Opal_BuildBatch *batch);
+Opal_Result opal_buildBatchShutdown(Opal_BuildBatch *batch);
+
+uint32_t opal_buildBatchGetRun(Opal_BuildBatch *batch, uint32_t num_descs, const Opal_AccelerationStructureBuildDesc *descs);
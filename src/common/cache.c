@@ -0,0 +1,250 @@
+#include "cache.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+/*
+ */
+Opal_Result opal_cacheInitialize(Opal_Cache *cache, uint32_t capacity)
+{
+	assert(cache);
+
+	Opal_Result result = opal_mapInitialize(&cache->entries, sizeof(Opal_CacheEntry), capacity);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	return opal_mapInitialize(&cache->handles, sizeof(uint64_t), capacity);
+}
+
+Opal_Result opal_cacheShutdown(Opal_Cache *cache)
+{
+	assert(cache);
+
+	uint32_t index = opal_mapGetFirstIndex(&cache->entries);
+	while (index != OPAL_MAP_INDEX_NULL)
+	{
+		Opal_CacheEntry *entry = (Opal_CacheEntry *)opal_mapGetElementByIndex(&cache->entries, index);
+		free(entry->data);
+
+		index = opal_mapGetNextIndex(&cache->entries, index);
+	}
+
+	opal_mapShutdown(&cache->entries);
+	opal_mapShutdown(&cache->handles);
+
+	return OPAL_SUCCESS;
+}
+
+/*
+ */
+uint64_t opal_cacheHash(const void *data, uint32_t size)
+{
+	assert(data || size == 0);
+
+	const uint8_t *bytes = (const uint8_t *)data;
+	uint64_t hash = 0xCBF29CE484222325ULL;
+
+	// note: FNV-1a, descriptions are short so there's no need for anything wider
+	for (uint32_t i = 0; i < size; ++i)
+	{
+		hash ^= bytes[i];
+		hash *= 0x100000001B3ULL;
+	}
+
+	return hash;
+}
+
+static OPAL_INLINE uint64_t opal_cacheRotl(uint64_t value, uint32_t shift)
+{
+	return (value << shift) | (value >> (64 - shift));
+}
+
+static OPAL_INLINE uint64_t opal_cacheMix(uint64_t value)
+{
+	value ^= value >> 33;
+	value *= 0xFF51AFD7ED558CCDULL;
+	value ^= value >> 33;
+	value *= 0xC4CEB9FE1A85EC53ULL;
+	value ^= value >> 33;
+
+	return value;
+}
+
+void opal_cacheDigest(Opal_CacheDigest *digest, uint32_t tag, const void *data, uint64_t size)
+{
+	assert(digest);
+	assert(data || size == 0);
+
+	const uint64_t c1 = 0x87C37B91114253D5ULL;
+	const uint64_t c2 = 0x4CF5AD432745937FULL;
+
+	const uint8_t *bytes = (const uint8_t *)data;
+	uint64_t h1 = tag;
+	uint64_t h2 = tag;
+
+	// note: MurmurHash3 x64 128, consumes 16 bytes per iteration which keeps large
+	//       SPIR-V / DXIL blobs well below the cost of creating the shader module
+	uint64_t num_blocks = size / 16;
+	for (uint64_t i = 0; i < num_blocks; ++i)
+	{
+		uint64_t k1 = 0;
+		uint64_t k2 = 0;
+		memcpy(&k1, bytes + i * 16, sizeof(uint64_t));
+		memcpy(&k2, bytes + i * 16 + 8, sizeof(uint64_t));
+
+		k1 *= c1; k1 = opal_cacheRotl(k1, 31); k1 *= c2; h1 ^= k1;
+		h1 = opal_cacheRotl(h1, 27); h1 += h2; h1 = h1 * 5 + 0x52DCE729;
+
+		k2 *= c2; k2 = opal_cacheRotl(k2, 33); k2 *= c1; h2 ^= k2;
+		h2 = opal_cacheRotl(h2, 31); h2 += h1; h2 = h2 * 5 + 0x38495AB5;
+	}
+
+	uint8_t tail[16] = {0};
+	uint64_t tail_size = size & 15;
+	if (tail_size > 0)
+	{
+		memcpy(tail, bytes + num_blocks * 16, tail_size);
+
+		uint64_t k1 = 0;
+		uint64_t k2 = 0;
+		memcpy(&k1, tail, sizeof(uint64_t));
+		memcpy(&k2, tail + 8, sizeof(uint64_t));
+
+		k2 *= c2; k2 = opal_cacheRotl(k2, 33); k2 *= c1; h2 ^= k2;
+		k1 *= c1; k1 = opal_cacheRotl(k1, 31); k1 *= c2; h1 ^= k1;
+	}
+
+	h1 ^= size;
+	h2 ^= size;
+
+	h1 += h2;
+	h2 += h1;
+
+	h1 = opal_cacheMix(h1);
+	h2 = opal_cacheMix(h2);
+
+	h1 += h2;
+	h2 += h1;
+
+	digest->hash[0] = h1;
+	digest->hash[1] = h2;
+	digest->size = size;
+	digest->tag = tag;
+	digest->padding = 0;
+}
+
+/*
+ */
+uint64_t opal_cacheAcquire(Opal_Cache *cache, const void *data, uint32_t size)
+{
+	assert(cache);
+
+	uint64_t hash = opal_cacheHash(data, size);
+
+	Opal_CacheEntry *entry = (Opal_CacheEntry *)opal_mapFind(&cache->entries, hash);
+	if (entry == NULL)
+		return OPAL_NULL_HANDLE;
+
+	if (entry->size != size || (size > 0 && memcmp(entry->data, data, size) != 0))
+		return OPAL_NULL_HANDLE;
+
+	entry->refcount++;
+	return entry->handle;
+}
+
+Opal_Result opal_cacheInsert(Opal_Cache *cache, const void *data, uint32_t size, uint64_t handle)
+{
+	assert(cache);
+	assert(handle != OPAL_NULL_HANDLE);
+
+	uint64_t hash = opal_cacheHash(data, size);
+
+	if (opal_mapFind(&cache->entries, hash) != NULL)
+		return OPAL_INTERNAL_ERROR;
+
+	Opal_CacheEntry entry = {0};
+	entry.handle = handle;
+	entry.refcount = 1;
+	entry.size = size;
+
+	if (size > 0)
+	{
+		entry.data = (uint8_t *)malloc(size);
+		memcpy(entry.data, data, size);
+	}
+
+	opal_mapInsert(&cache->entries, hash, &entry);
+	opal_mapInsert(&cache->handles, handle, &hash);
+
+	return OPAL_SUCCESS;
+}
+
+uint32_t opal_cacheRelease(Opal_Cache *cache, uint64_t handle)
+{
+	assert(cache);
+
+	const uint64_t *hash_ptr = (const uint64_t *)opal_mapFind(&cache->handles, handle);
+	if (hash_ptr == NULL)
+		return 0;
+
+	uint64_t hash = *hash_ptr;
+
+	Opal_CacheEntry *entry = (Opal_CacheEntry *)opal_mapFind(&cache->entries, hash);
+	assert(entry);
+	assert(entry->refcount > 0);
+
+	entry->refcount--;
+	if (entry->refcount > 0)
+		return entry->refcount;
+
+	free(entry->data);
+
+	opal_mapRemove(&cache->entries, hash);
+	opal_mapRemove(&cache->handles, handle);
+
+	return 0;
+}
+
+void opal_cacheEvict(Opal_Cache *cache, uint64_t handle)
+{
+	assert(cache);
+	assert(handle != OPAL_NULL_HANDLE);
+
+	uint32_t index = opal_mapGetFirstIndex(&cache->entries);
+	while (index != OPAL_MAP_INDEX_NULL)
+	{
+		Opal_CacheEntry *entry = (Opal_CacheEntry *)opal_mapGetElementByIndex(&cache->entries, index);
+		index = opal_mapGetNextIndex(&cache->entries, index);
+
+		if (entry->data == NULL)
+			continue;
+
+		uint32_t num_handles = entry->size / sizeof(uint64_t);
+		uint32_t found = 0;
+
+		for (uint32_t i = 0; i < num_handles && !found; ++i)
+		{
+			uint64_t value = 0;
+			memcpy(&value, entry->data + i * sizeof(uint64_t), sizeof(uint64_t));
+			found = (value == handle);
+		}
+
+		if (!found)
+			continue;
+
+		// note: the entry stays in the map until its last release, but no description can match it anymore
+		free(entry->data);
+		entry->data = NULL;
+		entry->size = UINT32_MAX;
+	}
+}
+
+/*
+ */
+uint32_t opal_cacheGetSize(const Opal_Cache *cache)
+{
+	assert(cache);
+
+	return opal_mapGetSize(&cache->entries);
+}
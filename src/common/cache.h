@@ -0,0 +1,49 @@
+#pragma once
+
+#include <opal.h>
+
+#include "map.h"
+
+// note: hash-consing cache for immutable objects, maps description bytes to a reference counted
+//       handle. On a hash collision between different descriptions the new object is simply not
+//       cached, release of an unknown handle returns zero so the caller destroys it as usual
+typedef struct Opal_CacheEntry_t
+{
+	uint64_t handle;
+	uint32_t refcount;
+	uint32_t size;
+	uint8_t *data;
+} Opal_CacheEntry;
+
+// note: shader blobs are too large to keep a copy of, so they are cached by a 128-bit digest of
+//       their contents instead of the bytes themselves
+typedef struct Opal_CacheDigest_t
+{
+	uint64_t hash[2];
+	uint64_t size;
+	uint32_t tag;
+	uint32_t padding;
+} Opal_CacheDigest;
+
+typedef struct Opal_Cache_t
+{
+	Opal_Map entries;
+	Opal_Map handles;
+} Opal_Cache;
+
+Opal_Result opal_cacheInitialize(Opal_Cache *cache, uint32_t capacity);
+Opal_Result opal_cacheShutdown(Opal_Cache *cache);
+
+uint64_t opal_cacheHash(const void *data, uint32_t size);
+void opal_cacheDigest(Opal_CacheDigest *digest, uint32_t tag, const void *data, uint64_t size);
+
+uint64_t opal_cacheAcquire(Opal_Cache *cache, const void *data, uint32_t size);
+Opal_Result opal_cacheInsert(Opal_Cache *cache, const void *data, uint32_t size, uint64_t handle);
+uint32_t opal_cacheRelease(Opal_Cache *cache, uint64_t handle);
+
+// note: for descriptions made of other handles, stops every entry whose description contains the handle
+//       from being acquired once that handle is destroyed and may be reused. Handed out objects keep
+//       their refcount, so releasing them works as before
+void opal_cacheEvict(Opal_Cache *cache, uint64_t handle);
+
+uint32_t opal_cacheGetSize(const Opal_Cache *cache);
@@ -0,0 +1,413 @@
+#include "compiler.h"
+#include "timer.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+/*
+ */
+static void opal_compilerPushQueue(Opal_Compiler *compiler, Opal_PoolHandle handle)
+{
+	assert(compiler);
+
+	if (compiler->queue_size == compiler->queue_capacity)
+	{
+		compiler->queue_capacity = (compiler->queue_capacity == 0) ? 16 : compiler->queue_capacity * 2;
+		compiler->queue = (Opal_PoolHandle *)realloc(compiler->queue, sizeof(Opal_PoolHandle) * compiler->queue_capacity);
+		assert(compiler->queue);
+	}
+
+	compiler->queue[compiler->queue_size++] = handle;
+}
+
+static void opal_compilerRemoveQueue(Opal_Compiler *compiler, Opal_PoolHandle handle)
+{
+	assert(compiler);
+
+	for (uint32_t i = 0; i < compiler->queue_size; ++i)
+	{
+		if (compiler->queue[i] != handle)
+			continue;
+
+		memmove(compiler->queue + i, compiler->queue + i + 1, sizeof(Opal_PoolHandle) * (compiler->queue_size - i - 1));
+		compiler->queue_size--;
+		return;
+	}
+}
+
+static void opal_compilerExecute(Opal_Compiler *compiler, Opal_PoolHandle handle, Opal_Bump *scratch)
+{
+	assert(compiler);
+	assert(scratch);
+
+	// note: must be called with the mutex held, the lock is released while the backend compiles
+	Opal_CompilerTask *task_ptr = (Opal_CompilerTask *)opal_poolGetElement(&compiler->tasks, handle);
+	assert(task_ptr);
+	assert(task_ptr->num_started < task_ptr->num_pipelines);
+
+	uint32_t index = task_ptr->num_started++;
+	if (task_ptr->num_started == task_ptr->num_pipelines)
+		opal_compilerRemoveQueue(compiler, handle);
+
+	Opal_CompileFunction function = task_ptr->function;
+	const void *desc = task_ptr->descs + index * task_ptr->desc_size;
+	void *result = task_ptr->results + index * task_ptr->pipelines->element_size;
+
+	compiler->num_running++;
+	opal_mutexUnlock(&compiler->mutex);
+
+	Opal_Result status = function(compiler->device, desc, scratch, result);
+
+	opal_mutexLock(&compiler->mutex);
+	compiler->num_running--;
+
+	task_ptr = (Opal_CompilerTask *)opal_poolGetElement(&compiler->tasks, handle);
+	assert(task_ptr);
+
+	task_ptr->statuses[index] = status;
+	task_ptr->num_completed++;
+
+	if (task_ptr->num_completed == task_ptr->num_pipelines || compiler->num_running == 0)
+		opal_conditionBroadcast(&compiler->done_condition);
+}
+
+static void opal_compilerWorker(void *user_data)
+{
+	Opal_CompilerWorker *worker = (Opal_CompilerWorker *)user_data;
+	assert(worker);
+
+	Opal_Compiler *compiler = worker->compiler;
+	assert(compiler);
+
+	opal_mutexLock(&compiler->mutex);
+
+	while (1)
+	{
+		while (!compiler->shutdown && (compiler->queue_size == 0 || compiler->paused > 0))
+			opal_conditionWait(&compiler->job_condition, &compiler->mutex);
+
+		// note: drain the queue on shutdown so every submitted pipeline ends up in a backend pool
+		if (compiler->queue_size == 0)
+			break;
+
+		opal_compilerExecute(compiler, compiler->queue[0], &worker->scratch);
+	}
+
+	opal_mutexUnlock(&compiler->mutex);
+}
+
+static void opal_compilerStart(Opal_Compiler *compiler)
+{
+	assert(compiler);
+
+	// note: must be called with the mutex held, so concurrent submits don't both spawn workers;
+	//       new workers block on the mutex until the caller releases it
+	if (compiler->started)
+		return;
+
+	compiler->started = 1;
+
+	uint32_t num_cores = opal_threadGetNumCores();
+	uint32_t num_threads = compiler->num_threads;
+
+	if (num_threads == 0)
+		num_threads = (num_cores > 1) ? num_cores - 1 : 1;
+
+	compiler->workers = (Opal_CompilerWorker *)malloc(sizeof(Opal_CompilerWorker) * num_threads);
+	assert(compiler->workers);
+
+	compiler->num_threads = 0;
+
+	for (uint32_t i = 0; i < num_threads; ++i)
+	{
+		Opal_CompilerWorker *worker = &compiler->workers[i];
+		worker->compiler = compiler;
+		opal_bumpInitialize(&worker->scratch, 256);
+
+		if (opal_threadCreate(&worker->thread, opal_compilerWorker, worker) != OPAL_SUCCESS)
+		{
+			opal_bumpShutdown(&worker->scratch);
+			break;
+		}
+
+		compiler->num_threads++;
+	}
+}
+
+static Opal_Result opal_compilerRegister(Opal_CompilerTask *task_ptr)
+{
+	assert(task_ptr);
+	assert(task_ptr->num_completed == task_ptr->num_pipelines);
+
+	Opal_Result result = OPAL_SUCCESS;
+
+	for (uint32_t i = 0; i < task_ptr->num_pipelines; ++i)
+	{
+		uint64_t handle = OPAL_NULL_HANDLE;
+
+		if (task_ptr->statuses[i] == OPAL_SUCCESS)
+			handle = (uint64_t)opal_poolAddElement(task_ptr->pipelines, task_ptr->results + i * task_ptr->pipelines->element_size);
+		else if (result == OPAL_SUCCESS)
+			result = task_ptr->statuses[i];
+
+		if (task_ptr->handles)
+			task_ptr->handles[i] = handle;
+	}
+
+	free(task_ptr->results);
+	free(task_ptr->statuses);
+
+	return result;
+}
+
+/*
+ */
+Opal_Result opal_compilerInitialize(Opal_Compiler *compiler, void *device, uint32_t num_threads)
+{
+	assert(compiler);
+
+	memset(compiler, 0, sizeof(Opal_Compiler));
+
+	compiler->device = device;
+	compiler->num_threads = num_threads;
+
+	opal_mutexInitialize(&compiler->mutex);
+	opal_conditionInitialize(&compiler->job_condition);
+	opal_conditionInitialize(&compiler->done_condition);
+	opal_poolInitialize(&compiler->tasks, sizeof(Opal_CompilerTask), 8);
+
+	return OPAL_SUCCESS;
+}
+
+Opal_Result opal_compilerShutdown(Opal_Compiler *compiler)
+{
+	assert(compiler);
+
+	if (compiler->started)
+	{
+		opal_mutexLock(&compiler->mutex);
+		compiler->shutdown = 1;
+		opal_conditionBroadcast(&compiler->job_condition);
+		opal_mutexUnlock(&compiler->mutex);
+
+		for (uint32_t i = 0; i < compiler->num_threads; ++i)
+		{
+			opal_threadJoin(&compiler->workers[i].thread);
+			opal_bumpShutdown(&compiler->workers[i].scratch);
+		}
+
+		free(compiler->workers);
+	}
+
+	// note: pipelines of tasks nobody waited for go to backend pools and are destroyed with the device
+	uint32_t head = opal_poolGetHeadIndex(&compiler->tasks);
+	while (head != OPAL_POOL_HANDLE_NULL)
+	{
+		Opal_CompilerTask *task_ptr = (Opal_CompilerTask *)opal_poolGetElementByIndex(&compiler->tasks, head);
+		task_ptr->handles = NULL;
+
+		opal_compilerRegister(task_ptr);
+
+		head = opal_poolGetNextIndex(&compiler->tasks, head);
+	}
+
+	opal_poolShutdown(&compiler->tasks);
+
+	opal_conditionShutdown(&compiler->done_condition);
+	opal_conditionShutdown(&compiler->job_condition);
+	opal_mutexShutdown(&compiler->mutex);
+
+	free(compiler->queue);
+
+	memset(compiler, 0, sizeof(Opal_Compiler));
+	return OPAL_SUCCESS;
+}
+
+/*
+ */
+Opal_Result opal_compilerSubmit(Opal_Compiler *compiler, Opal_CompileFunction function, Opal_Pool *pipelines, uint32_t num_pipelines, const void *descs, uint32_t desc_size, uint64_t *handles, Opal_PipelineTask *task)
+{
+	assert(compiler);
+	assert(function);
+	assert(pipelines);
+	assert(num_pipelines == 0 || descs);
+	assert(num_pipelines == 0 || handles);
+	assert(task);
+
+	opal_mutexLock(&compiler->mutex);
+	opal_compilerStart(compiler);
+	uint32_t num_threads = compiler->num_threads;
+	opal_mutexUnlock(&compiler->mutex);
+
+	Opal_CompilerTask data = {0};
+	data.function = function;
+	data.pipelines = pipelines;
+	data.descs = (const uint8_t *)descs;
+	data.desc_size = desc_size;
+	data.handles = handles;
+	data.num_pipelines = num_pipelines;
+
+	if (num_pipelines > 0)
+	{
+		data.results = (uint8_t *)malloc(pipelines->element_size * num_pipelines);
+		data.statuses = (Opal_Result *)malloc(sizeof(Opal_Result) * num_pipelines);
+		assert(data.results);
+		assert(data.statuses);
+
+		memset(data.results, 0, pipelines->element_size * num_pipelines);
+	}
+
+	// note: no worker threads on this platform, compile right away and let wait do the rest;
+	//       several threads may get here at once, so each call brings its own scratch
+	if (num_threads == 0)
+	{
+		Opal_Bump scratch = {0};
+		opal_bumpInitialize(&scratch, 256);
+
+		for (uint32_t i = 0; i < num_pipelines; ++i)
+			data.statuses[i] = function(compiler->device, data.descs + i * desc_size, &scratch, data.results + i * pipelines->element_size);
+
+		opal_bumpShutdown(&scratch);
+
+		data.num_started = num_pipelines;
+		data.num_completed = num_pipelines;
+	}
+
+	opal_mutexLock(&compiler->mutex);
+
+	Opal_PoolHandle handle = opal_poolAddElement(&compiler->tasks, &data);
+
+	if (data.num_started < num_pipelines)
+	{
+		opal_compilerPushQueue(compiler, handle);
+		opal_conditionBroadcast(&compiler->job_condition);
+	}
+
+	opal_mutexUnlock(&compiler->mutex);
+
+	*task = (Opal_PipelineTask)handle;
+	return OPAL_SUCCESS;
+}
+
+Opal_Result opal_compilerWait(Opal_Compiler *compiler, Opal_PipelineTask task, uint64_t timeout_milliseconds)
+{
+	assert(compiler);
+
+	Opal_PoolHandle handle = (Opal_PoolHandle)task;
+	uint64_t deadline = UINT64_MAX;
+
+	if (timeout_milliseconds != UINT64_MAX)
+		deadline = opal_timerGetNanoseconds() + timeout_milliseconds * 1000000ULL;
+
+	opal_mutexLock(&compiler->mutex);
+
+	Opal_CompilerTask *task_ptr = NULL;
+	if (compiler->tasks.size > 0)
+		task_ptr = (Opal_CompilerTask *)opal_poolGetElement(&compiler->tasks, handle);
+
+	if (task_ptr == NULL)
+	{
+		opal_mutexUnlock(&compiler->mutex);
+		return OPAL_INVALID_PIPELINE_TASK;
+	}
+
+	while (task_ptr->num_completed < task_ptr->num_pipelines)
+	{
+		if (timeout_milliseconds == UINT64_MAX)
+		{
+			opal_conditionWait(&compiler->done_condition, &compiler->mutex);
+		}
+		else
+		{
+			uint64_t now = opal_timerGetNanoseconds();
+			if (now >= deadline)
+			{
+				opal_mutexUnlock(&compiler->mutex);
+				return OPAL_WAIT_TIMEOUT;
+			}
+
+			opal_conditionWaitTimeout(&compiler->done_condition, &compiler->mutex, (deadline - now + 999999ULL) / 1000000ULL);
+		}
+
+		task_ptr = (Opal_CompilerTask *)opal_poolGetElement(&compiler->tasks, handle);
+		assert(task_ptr);
+	}
+
+	Opal_CompilerTask data = *task_ptr;
+	opal_poolRemoveElement(&compiler->tasks, handle);
+
+	opal_mutexUnlock(&compiler->mutex);
+
+	return opal_compilerRegister(&data);
+}
+
+Opal_Result opal_compilerRun(Opal_Compiler *compiler, Opal_CompileFunction function, Opal_Pool *pipelines, uint32_t num_pipelines, const void *descs, uint32_t desc_size, uint64_t *handles)
+{
+	assert(compiler);
+
+	Opal_PipelineTask task = OPAL_NULL_HANDLE;
+
+	Opal_Result result = opal_compilerSubmit(compiler, function, pipelines, num_pipelines, descs, desc_size, handles, &task);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	// note: the calling thread would idle otherwise, so it picks up pipelines of its own task as well;
+	//       concurrent runs compile at the same time, so the scratch can't be shared between them
+	Opal_Bump scratch = {0};
+	opal_bumpInitialize(&scratch, 256);
+
+	opal_mutexLock(&compiler->mutex);
+
+	while (1)
+	{
+		Opal_CompilerTask *task_ptr = (Opal_CompilerTask *)opal_poolGetElement(&compiler->tasks, (Opal_PoolHandle)task);
+		assert(task_ptr);
+
+		if (task_ptr->num_started == task_ptr->num_pipelines)
+			break;
+
+		opal_compilerExecute(compiler, (Opal_PoolHandle)task, &scratch);
+	}
+
+	opal_mutexUnlock(&compiler->mutex);
+	opal_bumpShutdown(&scratch);
+
+	return opal_compilerWait(compiler, task, UINT64_MAX);
+}
+
+/*
+ */
+void opal_compilerPause(Opal_Compiler *compiler)
+{
+	assert(compiler);
+
+	if (compiler->num_threads == 0)
+		return;
+
+	opal_mutexLock(&compiler->mutex);
+
+	compiler->paused++;
+	while (compiler->num_running > 0)
+		opal_conditionWait(&compiler->done_condition, &compiler->mutex);
+
+	opal_mutexUnlock(&compiler->mutex);
+}
+
+void opal_compilerResume(Opal_Compiler *compiler)
+{
+	assert(compiler);
+
+	if (compiler->num_threads == 0)
+		return;
+
+	opal_mutexLock(&compiler->mutex);
+
+	assert(compiler->paused > 0);
+	compiler->paused--;
+
+	if (compiler->paused == 0)
+		opal_conditionBroadcast(&compiler->job_condition);
+
+	opal_mutexUnlock(&compiler->mutex);
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <opal.h>
+
+#include "bump.h"
+#include "pool.h"
+#include "thread.h"
+
+// note: compiles pipelines on worker threads, compile functions must be reentrant and
+//       only read backend pools. Compiled objects are added to the backend pool on the
+//       calling thread when the task is waited on, so command recording never races
+//       with pool growth
+typedef Opal_Result (*Opal_CompileFunction)(void *device, const void *desc, Opal_Bump *scratch, void *pipeline);
+
+typedef struct Opal_CompilerTask_t
+{
+	Opal_CompileFunction function;
+	Opal_Pool *pipelines;
+	const uint8_t *descs;
+	uint32_t desc_size;
+	uint8_t *results;
+	Opal_Result *statuses;
+	uint64_t *handles;
+	uint32_t num_pipelines;
+	uint32_t num_started;
+	uint32_t num_completed;
+} Opal_CompilerTask;
+
+typedef struct Opal_CompilerWorker_t
+{
+	struct Opal_Compiler_t *compiler;
+	Opal_Thread thread;
+	Opal_Bump scratch;
+} Opal_CompilerWorker;
+
+typedef struct Opal_Compiler_t
+{
+	void *device;
+	Opal_Mutex mutex;
+	Opal_Condition job_condition;
+	Opal_Condition done_condition;
+	Opal_CompilerWorker *workers;
+	uint32_t num_threads;
+	uint32_t num_running;
+	uint32_t paused;
+	uint32_t started;
+	uint32_t shutdown;
+	Opal_Pool tasks;
+	Opal_PoolHandle *queue;
+	uint32_t queue_size;
+	uint32_t queue_capacity;
+} Opal_Compiler;
+
+Opal_Result opal_compilerInitialize(Opal_Compiler *compiler, void *device, uint32_t num_threads);
+Opal_Result opal_compilerShutdown(Opal_Compiler *compiler);
+
+Opal_Result opal_compilerSubmit(Opal_Compiler *compiler, Opal_CompileFunction function, Opal_Pool *pipelines, uint32_t num_pipelines, const void *descs, uint32_t desc_size, uint64_t *handles, Opal_PipelineTask *task);
+Opal_Result opal_compilerWait(Opal_Compiler *compiler, Opal_PipelineTask task, uint64_t timeout_milliseconds);
+Opal_Result opal_compilerRun(Opal_Compiler *compiler, Opal_CompileFunction function, Opal_Pool *pipelines, uint32_t num_pipelines, const void *descs, uint32_t desc_size, uint64_t *handles);
+
+void opal_compilerPause(Opal_Compiler *compiler);
+void opal_compilerResume(Opal_Compiler *compiler);
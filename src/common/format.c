@@ -0,0 +1,146 @@
+#include "format.h"
+#include "intrinsics.h"
+
+#include <assert.h>
+
+/*
+ */
+Opal_FormatBlockInfo opal_formatGetBlockInfo(Opal_TextureFormat format)
+{
+	static Opal_FormatBlockInfo block_infos[] =
+	{
+		{0, 0, 0},
+
+		// 8-bit formats
+		{1, 1, 1}, {1, 1, 1}, {1, 1, 1}, {1, 1, 1},
+		{2, 1, 1}, {2, 1, 1}, {2, 1, 1}, {2, 1, 1},
+		{4, 1, 1}, {4, 1, 1}, {4, 1, 1}, {4, 1, 1},
+
+		// 16-bit formats
+		{2, 1, 1}, {2, 1, 1}, {2, 1, 1},
+		{4, 1, 1}, {4, 1, 1}, {4, 1, 1},
+		{8, 1, 1}, {8, 1, 1}, {8, 1, 1},
+
+		// 32-bit formats
+		{4, 1, 1}, {4, 1, 1}, {4, 1, 1},
+		{8, 1, 1}, {8, 1, 1}, {8, 1, 1},
+		{16, 1, 1}, {16, 1, 1}, {16, 1, 1},
+
+		// special 4-channel formats
+		{4, 1, 1},
+		{4, 1, 1},
+		{4, 1, 1},
+
+		// hdr 32-bit formats
+		{4, 1, 1},
+		{4, 1, 1},
+
+		// bc formats
+		{8, 4, 4}, {8, 4, 4}, {8, 4, 4}, {8, 4, 4},
+		{16, 4, 4}, {16, 4, 4},
+		{16, 4, 4}, {16, 4, 4},
+		{8, 4, 4}, {8, 4, 4},
+		{16, 4, 4}, {16, 4, 4},
+		{16, 4, 4}, {16, 4, 4},
+		{16, 4, 4}, {16, 4, 4},
+
+		// etc formats
+		{8, 4, 4}, {8, 4, 4},
+		{8, 4, 4}, {8, 4, 4},
+		{16, 4, 4}, {16, 4, 4},
+		{8, 4, 4}, {8, 4, 4},
+		{16, 4, 4}, {16, 4, 4},
+
+		// astc formats
+		{16, 4, 4}, {16, 4, 4},
+		{16, 5, 4}, {16, 5, 4},
+		{16, 5, 5}, {16, 5, 5},
+		{16, 6, 5}, {16, 6, 5},
+		{16, 6, 6}, {16, 6, 6},
+		{16, 8, 5}, {16, 8, 5},
+		{16, 8, 6}, {16, 8, 6},
+		{16, 8, 8}, {16, 8, 8},
+		{16, 10, 5}, {16, 10, 5},
+		{16, 10, 6}, {16, 10, 6},
+		{16, 10, 8}, {16, 10, 8},
+		{16, 10, 10}, {16, 10, 10},
+		{16, 12, 10}, {16, 12, 10},
+		{16, 12, 12}, {16, 12, 12},
+
+		// depth_stencil formats
+		{2, 1, 1},
+		{4, 1, 1},
+		{2, 1, 1},
+		{4, 1, 1},
+		{4, 1, 1},
+	};
+
+	assert(format < sizeof(block_infos) / sizeof(Opal_FormatBlockInfo));
+
+	return block_infos[format];
+}
+
+Opal_Result opal_formatGetCopyLayout(const Opal_TextureDesc *desc, uint32_t row_alignment, uint64_t offset_alignment, uint32_t *num_regions, Opal_BufferTextureCopyRegion *regions, uint64_t *size)
+{
+	assert(desc);
+	assert(num_regions);
+
+	if (desc->format <= OPAL_TEXTURE_FORMAT_UNDEFINED || desc->format >= OPAL_TEXTURE_FORMAT_ENUM_MAX)
+		return OPAL_TEXTURE_FORMAT_NOT_SUPPORTED;
+
+	Opal_FormatBlockInfo block = opal_formatGetBlockInfo(desc->format);
+
+	uint32_t mip_count = (desc->mip_count > 0) ? desc->mip_count : 1;
+	uint32_t layer_count = (desc->layer_count > 0 && desc->type != OPAL_TEXTURE_TYPE_3D) ? desc->layer_count : 1;
+
+	if (row_alignment == 0)
+		row_alignment = 1;
+
+	// note: every region starts on a whole block, Vulkan also wants multiples of 4
+	uint64_t region_alignment = max(block.size, 4);
+	if (offset_alignment > region_alignment)
+		region_alignment = offset_alignment;
+
+	*num_regions = mip_count * layer_count;
+
+	uint64_t offset = 0;
+	for (uint32_t layer = 0; layer < layer_count; ++layer)
+	{
+		for (uint32_t mip = 0; mip < mip_count; ++mip)
+		{
+			uint32_t width = max(desc->width >> mip, 1);
+			uint32_t height = max(desc->height >> mip, 1);
+			uint32_t depth = (desc->type == OPAL_TEXTURE_TYPE_3D) ? max(desc->depth >> mip, 1) : 1;
+
+			uint32_t num_columns = (width + block.width - 1) / block.width;
+			uint32_t num_rows = (height + block.height - 1) / block.height;
+			uint32_t row_size = alignUp(num_columns * block.size, row_alignment);
+
+			offset = alignUpul(offset, region_alignment);
+
+			if (regions)
+			{
+				Opal_BufferTextureCopyRegion *region = &regions[layer * mip_count + mip];
+				region->buffer_offset = offset;
+				region->row_size = row_size;
+				region->num_rows = num_rows;
+				region->mip = mip;
+				region->base_layer = layer;
+				region->layer_count = 1;
+				region->texture_offset.x = 0;
+				region->texture_offset.y = 0;
+				region->texture_offset.z = 0;
+				region->size.width = width;
+				region->size.height = height;
+				region->size.depth = depth;
+			}
+
+			offset += (uint64_t)row_size * num_rows * depth;
+		}
+	}
+
+	if (size)
+		*size = offset;
+
+	return OPAL_SUCCESS;
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <opal.h>
+
+// note: block size is in bytes, uncompressed formats use 1x1 blocks. Depth stencil formats
+//       report the depth aspect only since buffer copies move one aspect at a time
+typedef struct Opal_FormatBlockInfo_t
+{
+	uint32_t size;
+	uint32_t width;
+	uint32_t height;
+} Opal_FormatBlockInfo;
+
+Opal_FormatBlockInfo opal_formatGetBlockInfo(Opal_TextureFormat format);
+
+Opal_Result opal_formatGetCopyLayout(const Opal_TextureDesc *desc, uint32_t row_alignment, uint64_t offset_alignment, uint32_t *num_regions, Opal_BufferTextureCopyRegion *regions, uint64_t *size);
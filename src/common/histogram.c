@@ -0,0 +1,113 @@
+#include "histogram.h"
+
+#include <assert.h>
+#include <string.h>
+
+/*
+ */
+static uint32_t opal_histogramGetExponent(uint64_t value)
+{
+	assert(value != 0);
+
+#ifdef _MSC_VER
+	unsigned long result = 0;
+	_BitScanReverse64(&result, value);
+	return (uint32_t)result;
+#else
+	return 63 - (uint32_t)__builtin_clzll(value);
+#endif
+}
+
+static uint32_t opal_histogramGetBucket(uint64_t value)
+{
+	if (value < OPAL_HISTOGRAM_LINEAR_BUCKETS)
+		return (uint32_t)value;
+
+	uint32_t exponent = opal_histogramGetExponent(value);
+	if (exponent >= OPAL_HISTOGRAM_MAX_EXPONENT)
+		return OPAL_HISTOGRAM_NUM_BUCKETS - 1;
+
+	uint32_t shift = exponent - OPAL_HISTOGRAM_SUB_BUCKET_BITS;
+	uint32_t sub_bucket = (uint32_t)(value >> shift) & ((1 << OPAL_HISTOGRAM_SUB_BUCKET_BITS) - 1);
+
+	return OPAL_HISTOGRAM_LINEAR_BUCKETS + ((exponent - 4) << OPAL_HISTOGRAM_SUB_BUCKET_BITS) + sub_bucket;
+}
+
+static uint64_t opal_histogramGetBucketValue(uint32_t bucket)
+{
+	if (bucket < OPAL_HISTOGRAM_LINEAR_BUCKETS)
+		return bucket;
+
+	uint32_t index = bucket - OPAL_HISTOGRAM_LINEAR_BUCKETS;
+	uint32_t exponent = (index >> OPAL_HISTOGRAM_SUB_BUCKET_BITS) + 4;
+	uint64_t sub_bucket = index & ((1 << OPAL_HISTOGRAM_SUB_BUCKET_BITS) - 1);
+
+	uint32_t shift = exponent - OPAL_HISTOGRAM_SUB_BUCKET_BITS;
+	uint64_t begin = (((uint64_t)1 << OPAL_HISTOGRAM_SUB_BUCKET_BITS) | sub_bucket) << shift;
+
+	// note: middle of the bucket range
+	return begin + (((uint64_t)1 << shift) >> 1);
+}
+
+/*
+ */
+void opal_histogramReset(Opal_Histogram *histogram)
+{
+	assert(histogram);
+
+	memset(histogram, 0, sizeof(Opal_Histogram));
+	histogram->min = UINT64_MAX;
+}
+
+void opal_histogramAdd(Opal_Histogram *histogram, uint64_t value)
+{
+	assert(histogram);
+
+	uint32_t bucket = opal_histogramGetBucket(value);
+	assert(bucket < OPAL_HISTOGRAM_NUM_BUCKETS);
+
+	histogram->buckets[bucket]++;
+	histogram->count++;
+	histogram->sum += value;
+
+	if (histogram->min > value)
+		histogram->min = value;
+
+	if (histogram->max < value)
+		histogram->max = value;
+}
+
+uint64_t opal_histogramGetPercentile(const Opal_Histogram *histogram, double percentile)
+{
+	assert(histogram);
+	assert(percentile >= 0.0 && percentile <= 1.0);
+
+	if (histogram->count == 0)
+		return 0;
+
+	uint64_t rank = (uint64_t)(percentile * (double)(histogram->count - 1)) + 1;
+	uint64_t accumulated = 0;
+
+	for (uint32_t i = 0; i < OPAL_HISTOGRAM_NUM_BUCKETS; ++i)
+	{
+		accumulated += histogram->buckets[i];
+		if (accumulated < rank)
+			continue;
+
+		// note: overflow bucket has no meaningful midpoint
+		if (i == OPAL_HISTOGRAM_NUM_BUCKETS - 1)
+			return histogram->max;
+
+		uint64_t value = opal_histogramGetBucketValue(i);
+
+		if (value < histogram->min)
+			value = histogram->min;
+
+		if (value > histogram->max)
+			value = histogram->max;
+
+		return value;
+	}
+
+	return histogram->max;
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <opal.h>
+
+// note: log-linear buckets, values below 16 are exact, above that every power of two
+//       is split into 8 sub-buckets which keeps relative error under 12.5%
+#define OPAL_HISTOGRAM_LINEAR_BUCKETS	16
+#define OPAL_HISTOGRAM_SUB_BUCKET_BITS	3
+#define OPAL_HISTOGRAM_MAX_EXPONENT	47
+#define OPAL_HISTOGRAM_NUM_BUCKETS	(OPAL_HISTOGRAM_LINEAR_BUCKETS + ((OPAL_HISTOGRAM_MAX_EXPONENT - 4) << OPAL_HISTOGRAM_SUB_BUCKET_BITS) + 1)
+
+typedef struct Opal_Histogram_t
+{
+	uint32_t buckets[OPAL_HISTOGRAM_NUM_BUCKETS];
+	uint64_t count;
+	uint64_t sum;
+	uint64_t min;
+	uint64_t max;
+} Opal_Histogram;
+
+void opal_histogramReset(Opal_Histogram *histogram);
+void opal_histogramAdd(Opal_Histogram *histogram, uint64_t value);
+
+uint64_t opal_histogramGetPercentile(const Opal_Histogram *histogram, double percentile);
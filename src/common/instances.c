@@ -0,0 +1,353 @@
+#include "instances.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#if defined(__AVX2__)
+#define OPAL_INSTANCES_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OPAL_INSTANCES_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define OPAL_INSTANCES_NEON
+#include <arm_neon.h>
+#endif
+
+/*
+ */
+#if defined(OPAL_INSTANCES_AVX2)
+static void opal_instancesPackRange(uint8_t *dst, uint32_t num_instances, const uint8_t *src, const uint64_t *addresses)
+{
+	// note: instance buffers are write combined memory on most hosts, full line non-temporal
+	//       stores skip the read for ownership and don't evict anything the cpu still needs
+	const __m256i *src_vectors = (const __m256i *)src;
+	__m256i *dst_vectors = (__m256i *)dst;
+
+	if (((uintptr_t)dst & 31) == 0)
+	{
+		for (uint32_t i = 0; i < num_instances; ++i)
+		{
+			__m256i low = _mm256_loadu_si256(src_vectors + i * 2 + 0);
+			__m256i high = _mm256_loadu_si256(src_vectors + i * 2 + 1);
+
+			high = _mm256_blend_epi32(high, _mm256_set1_epi64x((long long)addresses[i]), 0xC0);
+
+			_mm256_stream_si256(dst_vectors + i * 2 + 0, low);
+			_mm256_stream_si256(dst_vectors + i * 2 + 1, high);
+		}
+
+		_mm_sfence();
+		return;
+	}
+
+	for (uint32_t i = 0; i < num_instances; ++i)
+	{
+		__m256i low = _mm256_loadu_si256(src_vectors + i * 2 + 0);
+		__m256i high = _mm256_loadu_si256(src_vectors + i * 2 + 1);
+
+		high = _mm256_blend_epi32(high, _mm256_set1_epi64x((long long)addresses[i]), 0xC0);
+
+		_mm256_storeu_si256(dst_vectors + i * 2 + 0, low);
+		_mm256_storeu_si256(dst_vectors + i * 2 + 1, high);
+	}
+}
+#elif defined(OPAL_INSTANCES_SSE2)
+static void opal_instancesPackRange(uint8_t *dst, uint32_t num_instances, const uint8_t *src, const uint64_t *addresses)
+{
+	// note: instance buffers are write combined memory on most hosts, full line non-temporal
+	//       stores skip the read for ownership and don't evict anything the cpu still needs
+	const __m128i *src_vectors = (const __m128i *)src;
+	__m128i *dst_vectors = (__m128i *)dst;
+
+	if (((uintptr_t)dst & 15) == 0)
+	{
+		for (uint32_t i = 0; i < num_instances; ++i)
+		{
+			__m128i r0 = _mm_loadu_si128(src_vectors + i * 4 + 0);
+			__m128i r1 = _mm_loadu_si128(src_vectors + i * 4 + 1);
+			__m128i r2 = _mm_loadu_si128(src_vectors + i * 4 + 2);
+			__m128i r3 = _mm_loadu_si128(src_vectors + i * 4 + 3);
+
+			r3 = _mm_unpacklo_epi64(r3, _mm_loadl_epi64((const __m128i *)(addresses + i)));
+
+			_mm_stream_si128(dst_vectors + i * 4 + 0, r0);
+			_mm_stream_si128(dst_vectors + i * 4 + 1, r1);
+			_mm_stream_si128(dst_vectors + i * 4 + 2, r2);
+			_mm_stream_si128(dst_vectors + i * 4 + 3, r3);
+		}
+
+		_mm_sfence();
+		return;
+	}
+
+	for (uint32_t i = 0; i < num_instances; ++i)
+	{
+		__m128i r0 = _mm_loadu_si128(src_vectors + i * 4 + 0);
+		__m128i r1 = _mm_loadu_si128(src_vectors + i * 4 + 1);
+		__m128i r2 = _mm_loadu_si128(src_vectors + i * 4 + 2);
+		__m128i r3 = _mm_loadu_si128(src_vectors + i * 4 + 3);
+
+		r3 = _mm_unpacklo_epi64(r3, _mm_loadl_epi64((const __m128i *)(addresses + i)));
+
+		_mm_storeu_si128(dst_vectors + i * 4 + 0, r0);
+		_mm_storeu_si128(dst_vectors + i * 4 + 1, r1);
+		_mm_storeu_si128(dst_vectors + i * 4 + 2, r2);
+		_mm_storeu_si128(dst_vectors + i * 4 + 3, r3);
+	}
+}
+#elif defined(OPAL_INSTANCES_NEON)
+static void opal_instancesPackRange(uint8_t *dst, uint32_t num_instances, const uint8_t *src, const uint64_t *addresses)
+{
+	for (uint32_t i = 0; i < num_instances; ++i)
+	{
+		const uint64_t *src_words = (const uint64_t *)(src + i * 64);
+		uint64_t *dst_words = (uint64_t *)(dst + i * 64);
+
+		uint64x2_t r0 = vld1q_u64(src_words + 0);
+		uint64x2_t r1 = vld1q_u64(src_words + 2);
+		uint64x2_t r2 = vld1q_u64(src_words + 4);
+		uint64x2_t r3 = vld1q_u64(src_words + 6);
+
+		r3 = vsetq_lane_u64(addresses[i], r3, 1);
+
+		vst1q_u64(dst_words + 0, r0);
+		vst1q_u64(dst_words + 2, r1);
+		vst1q_u64(dst_words + 4, r2);
+		vst1q_u64(dst_words + 6, r3);
+	}
+}
+#else
+static void opal_instancesPackRange(uint8_t *dst, uint32_t num_instances, const uint8_t *src, const uint64_t *addresses)
+{
+	for (uint32_t i = 0; i < num_instances; ++i)
+	{
+		memcpy(dst + i * 64, src + i * 64, 56);
+		memcpy(dst + i * 64 + 56, addresses + i, sizeof(uint64_t));
+	}
+}
+#endif
+
+static void opal_instancesPackResolved(void *device, uint8_t *dst, uint32_t num_instances, const Opal_AccelerationStructureInstance *instances, Opal_InstanceResolveFunction resolve)
+{
+	assert(resolve);
+
+	// note: addresses are resolved in small batches so they stay in cache until packed
+	uint64_t addresses[OPAL_INSTANCE_PACKER_RESOLVE_BATCH];
+
+	for (uint32_t first = 0; first < num_instances; first += OPAL_INSTANCE_PACKER_RESOLVE_BATCH)
+	{
+		uint32_t count = num_instances - first;
+		if (count > OPAL_INSTANCE_PACKER_RESOLVE_BATCH)
+			count = OPAL_INSTANCE_PACKER_RESOLVE_BATCH;
+
+		for (uint32_t i = 0; i < count; ++i)
+			addresses[i] = resolve(device, instances[first + i].blas);
+
+		opal_instancesPackRange(dst + first * sizeof(Opal_AccelerationStructureInstance), count, (const uint8_t *)(instances + first), addresses);
+	}
+}
+
+static void opal_instancePackerExecute(Opal_InstancePacker *packer, uint32_t chunk)
+{
+	assert(packer);
+
+	const Opal_InstancePackerJob *job = &packer->job;
+
+	uint32_t first = chunk * OPAL_INSTANCE_PACKER_CHUNK_SIZE;
+	uint32_t count = job->num_instances - first;
+	if (count > OPAL_INSTANCE_PACKER_CHUNK_SIZE)
+		count = OPAL_INSTANCE_PACKER_CHUNK_SIZE;
+
+	uint8_t *dst = job->dst + first * sizeof(Opal_AccelerationStructureInstance);
+	const Opal_AccelerationStructureInstance *instances = job->instances + first;
+
+	if (job->blas_addresses)
+		opal_instancesPackRange(dst, count, (const uint8_t *)instances, job->blas_addresses + first);
+	else
+		opal_instancesPackResolved(packer->device, dst, count, instances, job->resolve);
+}
+
+static void opal_instancePackerDrain(Opal_InstancePacker *packer)
+{
+	assert(packer);
+
+	// note: must be called with the mutex held, the lock is released while a chunk is packed
+	while (packer->job.next_chunk < packer->job.num_chunks)
+	{
+		uint32_t chunk = packer->job.next_chunk++;
+		opal_mutexUnlock(&packer->mutex);
+
+		opal_instancePackerExecute(packer, chunk);
+
+		opal_mutexLock(&packer->mutex);
+		packer->job.num_completed++;
+
+		if (packer->job.num_completed == packer->job.num_chunks)
+			opal_conditionSignal(&packer->done_condition);
+	}
+}
+
+static void opal_instancePackerWorker(void *user_data)
+{
+	Opal_InstancePacker *packer = (Opal_InstancePacker *)user_data;
+	assert(packer);
+
+	opal_mutexLock(&packer->mutex);
+
+	while (1)
+	{
+		while (!packer->shutdown && packer->job.next_chunk == packer->job.num_chunks)
+			opal_conditionWait(&packer->job_condition, &packer->mutex);
+
+		if (packer->shutdown)
+			break;
+
+		opal_instancePackerDrain(packer);
+	}
+
+	opal_mutexUnlock(&packer->mutex);
+}
+
+static void opal_instancePackerStart(Opal_InstancePacker *packer)
+{
+	assert(packer);
+
+	// note: must be called with the mutex held, so concurrent builds don't both spawn workers;
+	//       new workers block on the mutex until the caller releases it
+	if (packer->started)
+		return;
+
+	packer->started = 1;
+
+	uint32_t num_cores = opal_threadGetNumCores();
+	uint32_t num_threads = packer->num_threads;
+
+	if (num_threads == 0)
+		num_threads = (num_cores > 1) ? num_cores - 1 : 0;
+
+	packer->num_threads = 0;
+
+	if (num_threads == 0)
+		return;
+
+	packer->threads = (Opal_Thread *)malloc(sizeof(Opal_Thread) * num_threads);
+	assert(packer->threads);
+
+	for (uint32_t i = 0; i < num_threads; ++i)
+	{
+		if (opal_threadCreate(&packer->threads[i], opal_instancePackerWorker, packer) != OPAL_SUCCESS)
+			break;
+
+		packer->num_threads++;
+	}
+}
+
+/*
+ */
+void opal_instancesPack(void *dst, uint32_t num_instances, const Opal_AccelerationStructureInstance *instances, const uint64_t *blas_addresses)
+{
+	assert(num_instances == 0 || dst);
+	assert(num_instances == 0 || instances);
+	assert(num_instances == 0 || blas_addresses);
+
+	opal_instancesPackRange((uint8_t *)dst, num_instances, (const uint8_t *)instances, blas_addresses);
+}
+
+/*
+ */
+Opal_Result opal_instancePackerInitialize(Opal_InstancePacker *packer, void *device, uint32_t num_threads)
+{
+	assert(packer);
+
+	memset(packer, 0, sizeof(Opal_InstancePacker));
+
+	packer->device = device;
+	packer->num_threads = num_threads;
+
+	opal_mutexInitialize(&packer->mutex);
+	opal_conditionInitialize(&packer->job_condition);
+	opal_conditionInitialize(&packer->done_condition);
+
+	return OPAL_SUCCESS;
+}
+
+Opal_Result opal_instancePackerShutdown(Opal_InstancePacker *packer)
+{
+	assert(packer);
+
+	if (packer->started)
+	{
+		opal_mutexLock(&packer->mutex);
+		packer->shutdown = 1;
+		opal_conditionBroadcast(&packer->job_condition);
+		opal_mutexUnlock(&packer->mutex);
+
+		for (uint32_t i = 0; i < packer->num_threads; ++i)
+			opal_threadJoin(&packer->threads[i]);
+
+		free(packer->threads);
+	}
+
+	opal_conditionShutdown(&packer->done_condition);
+	opal_conditionShutdown(&packer->job_condition);
+	opal_mutexShutdown(&packer->mutex);
+
+	memset(packer, 0, sizeof(Opal_InstancePacker));
+	return OPAL_SUCCESS;
+}
+
+/*
+ */
+void opal_instancePackerRun(Opal_InstancePacker *packer, void *dst, uint32_t num_instances, const Opal_AccelerationStructureInstance *instances, const uint64_t *blas_addresses, Opal_InstanceResolveFunction resolve)
+{
+	assert(packer);
+	assert(num_instances == 0 || dst);
+	assert(num_instances == 0 || instances);
+	assert(blas_addresses || resolve);
+
+	// note: waking workers costs more than packing a couple of chunks on the calling thread
+	uint32_t inline_pack = (num_instances < OPAL_INSTANCE_PACKER_CHUNK_SIZE * 2);
+
+	if (!inline_pack)
+	{
+		opal_mutexLock(&packer->mutex);
+		opal_instancePackerStart(packer);
+
+		// note: workers serve one job at a time, concurrent builds pack on their own thread
+		inline_pack = (packer->num_threads == 0 || packer->job.num_completed < packer->job.num_chunks);
+
+		if (inline_pack)
+			opal_mutexUnlock(&packer->mutex);
+	}
+
+	if (inline_pack)
+	{
+		if (blas_addresses)
+			opal_instancesPackRange((uint8_t *)dst, num_instances, (const uint8_t *)instances, blas_addresses);
+		else if (num_instances > 0)
+			opal_instancesPackResolved(packer->device, (uint8_t *)dst, num_instances, instances, resolve);
+
+		return;
+	}
+
+	Opal_InstancePackerJob *job = &packer->job;
+	job->dst = (uint8_t *)dst;
+	job->instances = instances;
+	job->blas_addresses = blas_addresses;
+	job->resolve = resolve;
+	job->num_instances = num_instances;
+	job->num_chunks = (num_instances + OPAL_INSTANCE_PACKER_CHUNK_SIZE - 1) / OPAL_INSTANCE_PACKER_CHUNK_SIZE;
+	job->next_chunk = 0;
+	job->num_completed = 0;
+
+	opal_conditionBroadcast(&packer->job_condition);
+
+	opal_instancePackerDrain(packer);
+
+	while (job->num_completed < job->num_chunks)
+		opal_conditionWait(&packer->done_condition, &packer->mutex);
+
+	opal_mutexUnlock(&packer->mutex);
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <opal.h>
+
+#include "thread.h"
+
+// note: Vulkan and DirectX 12 instances match Opal_AccelerationStructureInstance byte for byte,
+//       flag values included, so packing is a 64 byte copy with the blas handle replaced by its
+//       address. Large buffers are split into chunks packed by worker threads and the calling
+//       thread together. Resolve functions run on workers while the calling thread waits inside
+//       the build call, so they may read backend pools but must not modify them
+#define OPAL_INSTANCE_PACKER_CHUNK_SIZE 16384
+#define OPAL_INSTANCE_PACKER_RESOLVE_BATCH 256
+
+typedef uint64_t (*Opal_InstanceResolveFunction)(void *device, Opal_AccelerationStructure blas);
+
+typedef struct Opal_InstancePackerJob_t
+{
+	uint8_t *dst;
+	const Opal_AccelerationStructureInstance *instances;
+	const uint64_t *blas_addresses;
+	Opal_InstanceResolveFunction resolve;
+	uint32_t num_instances;
+	uint32_t num_chunks;
+	uint32_t next_chunk;
+	uint32_t num_completed;
+} Opal_InstancePackerJob;
+
+typedef struct Opal_InstancePacker_t
+{
+	void *device;
+	Opal_Mutex mutex;
+	Opal_Condition job_condition;
+	Opal_Condition done_condition;
+	Opal_Thread *threads;
+	uint32_t num_threads;
+	uint32_t started;
+	uint32_t shutdown;
+	Opal_InstancePackerJob job;
+} Opal_InstancePacker;
+
+void opal_instancesPack(void *dst, uint32_t num_instances, const Opal_AccelerationStructureInstance *instances, const uint64_t *blas_addresses);
+
+Opal_Result opal_instancePackerInitialize(Opal_InstancePacker *packer, void *device, uint32_t num_threads);
+Opal_Result opal_instancePackerShutdown(Opal_InstancePacker *packer);
+
+void opal_instancePackerRun(Opal_InstancePacker *packer, void *dst, uint32_t num_instances, const Opal_AccelerationStructureInstance *instances, const uint64_t *blas_addresses, Opal_InstanceResolveFunction resolve);
@@ -0,0 +1,247 @@
+#include "map.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+/*
+ */
+static OPAL_INLINE uint32_t opal_mapHash(uint64_t key)
+{
+	key ^= key >> 33;
+	key *= 0xFF51AFD7ED558CCDULL;
+	key ^= key >> 33;
+	key *= 0xC4CEB9FE1A85EC53ULL;
+	key ^= key >> 33;
+
+	return (uint32_t)key;
+}
+
+static OPAL_INLINE uint32_t opal_mapFindIndex(const Opal_Map *map, uint64_t key)
+{
+	assert(map);
+
+	if (map->size == 0)
+		return OPAL_MAP_INDEX_NULL;
+
+	uint32_t mask = map->capacity - 1;
+	uint32_t index = opal_mapHash(key) & mask;
+
+	while (map->used[index])
+	{
+		if (map->keys[index] == key)
+			return index;
+
+		index = (index + 1) & mask;
+	}
+
+	return OPAL_MAP_INDEX_NULL;
+}
+
+static void opal_mapGrow(Opal_Map *map)
+{
+	assert(map);
+
+	uint64_t *old_keys = map->keys;
+	uint8_t *old_data = map->data;
+	uint8_t *old_used = map->used;
+	uint32_t old_capacity = map->capacity;
+
+	map->capacity = (map->capacity == 0) ? 16 : map->capacity * 2;
+	map->keys = (uint64_t *)malloc(sizeof(uint64_t) * map->capacity);
+	map->data = (uint8_t *)malloc(map->element_size * map->capacity);
+	map->used = (uint8_t *)malloc(sizeof(uint8_t) * map->capacity);
+	map->size = 0;
+
+	memset(map->used, 0, sizeof(uint8_t) * map->capacity);
+
+	for (uint32_t i = 0; i < old_capacity; ++i)
+		if (old_used[i])
+			opal_mapInsert(map, old_keys[i], old_data + i * map->element_size);
+
+	free(old_keys);
+	free(old_data);
+	free(old_used);
+}
+
+/*
+ */
+Opal_Result opal_mapInitialize(Opal_Map *map, uint32_t element_size, uint32_t capacity)
+{
+	assert(map);
+	assert(element_size > 0);
+
+	memset(map, 0, sizeof(Opal_Map));
+
+	map->element_size = element_size;
+
+	if (capacity > 0)
+	{
+		uint32_t aligned_capacity = 16;
+		while (aligned_capacity < capacity * 2)
+			aligned_capacity *= 2;
+
+		map->capacity = aligned_capacity;
+		map->keys = (uint64_t *)malloc(sizeof(uint64_t) * aligned_capacity);
+		map->data = (uint8_t *)malloc(element_size * aligned_capacity);
+		map->used = (uint8_t *)malloc(sizeof(uint8_t) * aligned_capacity);
+
+		memset(map->used, 0, sizeof(uint8_t) * aligned_capacity);
+	}
+
+	return OPAL_SUCCESS;
+}
+
+Opal_Result opal_mapShutdown(Opal_Map *map)
+{
+	assert(map);
+
+	free(map->keys);
+	free(map->data);
+	free(map->used);
+
+	memset(map, 0, sizeof(Opal_Map));
+
+	return OPAL_SUCCESS;
+}
+
+/*
+ */
+void *opal_mapInsert(Opal_Map *map, uint64_t key, const void *data)
+{
+	assert(map);
+	assert(data);
+
+	// note: keep load factor under 1/2 so probe sequences stay short
+	if ((map->size + 1) * 2 > map->capacity)
+		opal_mapGrow(map);
+
+	uint32_t mask = map->capacity - 1;
+	uint32_t index = opal_mapHash(key) & mask;
+
+	while (map->used[index])
+	{
+		if (map->keys[index] == key)
+			break;
+
+		index = (index + 1) & mask;
+	}
+
+	if (!map->used[index])
+	{
+		map->used[index] = 1;
+		map->keys[index] = key;
+		map->size++;
+	}
+
+	uint8_t *data_ptr = map->data + index * map->element_size;
+	memcpy(data_ptr, data, map->element_size);
+
+	return data_ptr;
+}
+
+Opal_Result opal_mapRemove(Opal_Map *map, uint64_t key)
+{
+	assert(map);
+
+	uint32_t index = opal_mapFindIndex(map, key);
+	if (index == OPAL_MAP_INDEX_NULL)
+		return OPAL_INTERNAL_ERROR;
+
+	uint32_t mask = map->capacity - 1;
+	uint32_t hole = index;
+	uint32_t next = (hole + 1) & mask;
+
+	// note: backward shift deletion, no tombstones
+	while (map->used[next])
+	{
+		uint32_t home = opal_mapHash(map->keys[next]) & mask;
+		uint32_t distance_to_home = (next - home) & mask;
+		uint32_t distance_to_hole = (next - hole) & mask;
+
+		if (distance_to_home >= distance_to_hole)
+		{
+			map->keys[hole] = map->keys[next];
+			memcpy(map->data + hole * map->element_size, map->data + next * map->element_size, map->element_size);
+			hole = next;
+		}
+
+		next = (next + 1) & mask;
+	}
+
+	map->used[hole] = 0;
+	map->size--;
+
+	return OPAL_SUCCESS;
+}
+
+void *opal_mapFind(const Opal_Map *map, uint64_t key)
+{
+	assert(map);
+
+	uint32_t index = opal_mapFindIndex(map, key);
+	if (index == OPAL_MAP_INDEX_NULL)
+		return NULL;
+
+	return map->data + index * map->element_size;
+}
+
+Opal_Result opal_mapClear(Opal_Map *map)
+{
+	assert(map);
+
+	if (map->capacity > 0)
+		memset(map->used, 0, sizeof(uint8_t) * map->capacity);
+
+	map->size = 0;
+	return OPAL_SUCCESS;
+}
+
+/*
+ */
+uint32_t opal_mapGetSize(const Opal_Map *map)
+{
+	assert(map);
+	return map->size;
+}
+
+uint32_t opal_mapGetFirstIndex(const Opal_Map *map)
+{
+	assert(map);
+
+	for (uint32_t i = 0; i < map->capacity; ++i)
+		if (map->used[i])
+			return i;
+
+	return OPAL_MAP_INDEX_NULL;
+}
+
+uint32_t opal_mapGetNextIndex(const Opal_Map *map, uint32_t index)
+{
+	assert(map);
+	assert(index < map->capacity);
+
+	for (uint32_t i = index + 1; i < map->capacity; ++i)
+		if (map->used[i])
+			return i;
+
+	return OPAL_MAP_INDEX_NULL;
+}
+
+uint64_t opal_mapGetKeyByIndex(const Opal_Map *map, uint32_t index)
+{
+	assert(map);
+	assert(index < map->capacity);
+	assert(map->used[index]);
+
+	return map->keys[index];
+}
+
+void *opal_mapGetElementByIndex(const Opal_Map *map, uint32_t index)
+{
+	assert(map);
+	assert(index < map->capacity);
+	assert(map->used[index]);
+
+	return map->data + index * map->element_size;
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <opal.h>
+
+#define OPAL_MAP_INDEX_NULL 0xFFFFFFFF
+
+typedef struct Opal_Map_t
+{
+	uint64_t *keys;
+	uint8_t *data;
+	uint8_t *used;
+
+	uint32_t element_size;
+	uint32_t size;
+	uint32_t capacity;
+} Opal_Map;
+
+Opal_Result opal_mapInitialize(Opal_Map *map, uint32_t element_size, uint32_t capacity);
+Opal_Result opal_mapShutdown(Opal_Map *map);
+
+void *opal_mapInsert(Opal_Map *map, uint64_t key, const void *data);
+Opal_Result opal_mapRemove(Opal_Map *map, uint64_t key);
+void *opal_mapFind(const Opal_Map *map, uint64_t key);
+Opal_Result opal_mapClear(Opal_Map *map);
+
+uint32_t opal_mapGetSize(const Opal_Map *map);
+uint32_t opal_mapGetFirstIndex(const Opal_Map *map);
+uint32_t opal_mapGetNextIndex(const Opal_Map *map, uint32_t index);
+uint64_t opal_mapGetKeyByIndex(const Opal_Map *map, uint32_t index);
+void *opal_mapGetElementByIndex(const Opal_Map *map, uint32_t index);
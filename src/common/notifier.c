@@ -0,0 +1,322 @@
+#include "notifier.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+/*
+ */
+static uint32_t opal_notifierCollect(Opal_Notifier *notifier)
+{
+	assert(notifier);
+
+	// note: must be called with the mutex held, ready entries keep their registration order
+	uint32_t num_ready = 0;
+	uint32_t num_pending = 0;
+
+	for (uint32_t i = 0; i < notifier->num_entries; ++i)
+	{
+		Opal_NotifierEntry *entry = &notifier->entries[i];
+
+		if (notifier->functions.query(notifier->device, entry->native) < entry->value)
+		{
+			notifier->entries[num_pending++] = *entry;
+			continue;
+		}
+
+		if (notifier->ready_capacity == num_ready)
+		{
+			notifier->ready_capacity = (notifier->ready_capacity == 0) ? 16 : notifier->ready_capacity * 2;
+			notifier->ready = (Opal_NotifierEntry *)realloc(notifier->ready, sizeof(Opal_NotifierEntry) * notifier->ready_capacity);
+			assert(notifier->ready);
+		}
+
+		notifier->ready[num_ready++] = *entry;
+	}
+
+	notifier->num_entries = num_pending;
+	return num_ready;
+}
+
+static void opal_notifierInvoke(Opal_Notifier *notifier, uint32_t num_ready)
+{
+	assert(notifier);
+
+	for (uint32_t i = 0; i < num_ready; ++i)
+	{
+		const Opal_NotifierEntry *entry = &notifier->ready[i];
+		entry->callback(entry->user_data, entry->semaphore, entry->value);
+	}
+}
+
+static uint32_t opal_notifierGatherWaits(Opal_Notifier *notifier)
+{
+	assert(notifier);
+
+	// note: must be called with the mutex held, callbacks usually share a few queue semaphores,
+	//       so only the smallest pending value of every semaphore is waited on
+	uint32_t capacity = notifier->num_entries + 1;
+	if (notifier->wait_capacity < capacity)
+	{
+		notifier->wait_semaphores = (uint64_t *)realloc(notifier->wait_semaphores, sizeof(uint64_t) * capacity);
+		assert(notifier->wait_semaphores);
+
+		notifier->wait_values = (uint64_t *)realloc(notifier->wait_values, sizeof(uint64_t) * capacity);
+		assert(notifier->wait_values);
+
+		notifier->wait_capacity = capacity;
+	}
+
+	notifier->wait_semaphores[0] = notifier->wake_semaphore;
+	notifier->wait_values[0] = notifier->wake_value + 1;
+
+	uint32_t num_waits = 1;
+
+	for (uint32_t i = 0; i < notifier->num_entries; ++i)
+	{
+		const Opal_NotifierEntry *entry = &notifier->entries[i];
+
+		uint32_t index = 1;
+		while (index < num_waits && notifier->wait_semaphores[index] != entry->native)
+			index++;
+
+		if (index == num_waits)
+		{
+			notifier->wait_semaphores[num_waits] = entry->native;
+			notifier->wait_values[num_waits] = entry->value;
+			num_waits++;
+		}
+		else if (notifier->wait_values[index] > entry->value)
+		{
+			notifier->wait_values[index] = entry->value;
+		}
+	}
+
+	return num_waits;
+}
+
+static void opal_notifierWake(Opal_Notifier *notifier)
+{
+	assert(notifier);
+
+	// note: must be called with the mutex held, the thread always waits for the next wake value
+	notifier->wake_value++;
+	notifier->functions.signal(notifier->device, notifier->wake_semaphore, notifier->wake_value);
+}
+
+static void opal_notifierThread(void *user_data)
+{
+	Opal_Notifier *notifier = (Opal_Notifier *)user_data;
+	assert(notifier);
+
+	opal_mutexLock(&notifier->mutex);
+
+	while (!notifier->shutdown)
+	{
+		uint32_t num_ready = opal_notifierCollect(notifier);
+		if (num_ready > 0)
+		{
+			opal_mutexUnlock(&notifier->mutex);
+			opal_notifierInvoke(notifier, num_ready);
+			opal_mutexLock(&notifier->mutex);
+			continue;
+		}
+
+		uint32_t num_waits = opal_notifierGatherWaits(notifier);
+		notifier->waiting = 1;
+		opal_mutexUnlock(&notifier->mutex);
+
+		opal_bumpReset(&notifier->scratch);
+		notifier->functions.wait(notifier->device, num_waits, notifier->wait_semaphores, notifier->wait_values, &notifier->scratch);
+
+		opal_mutexLock(&notifier->mutex);
+		notifier->waiting = 0;
+		notifier->wait_count++;
+		opal_conditionBroadcast(&notifier->wait_condition);
+	}
+
+	opal_mutexUnlock(&notifier->mutex);
+}
+
+static Opal_Result opal_notifierStart(Opal_Notifier *notifier)
+{
+	assert(notifier);
+
+	// note: must be called with the mutex held
+	if (notifier->started)
+		return OPAL_SUCCESS;
+
+	Opal_Result result = notifier->functions.create(notifier->device, &notifier->wake_semaphore);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	result = opal_threadCreate(&notifier->thread, opal_notifierThread, notifier);
+	if (result != OPAL_SUCCESS)
+	{
+		notifier->functions.destroy(notifier->device, notifier->wake_semaphore);
+		notifier->wake_semaphore = 0;
+		return result;
+	}
+
+	notifier->started = 1;
+	return OPAL_SUCCESS;
+}
+
+/*
+ */
+Opal_Result opal_notifierInitialize(Opal_Notifier *notifier, void *device, const Opal_NotifierFunctions *functions)
+{
+	assert(notifier);
+	assert(functions);
+	assert(functions->query);
+	assert(functions->wait == NULL || (functions->create && functions->destroy && functions->signal));
+
+	memset(notifier, 0, sizeof(Opal_Notifier));
+
+	notifier->device = device;
+	notifier->functions = *functions;
+
+	opal_mutexInitialize(&notifier->mutex);
+	opal_conditionInitialize(&notifier->wait_condition);
+	opal_bumpInitialize(&notifier->scratch, 256);
+
+	return OPAL_SUCCESS;
+}
+
+Opal_Result opal_notifierShutdown(Opal_Notifier *notifier)
+{
+	assert(notifier);
+
+	if (notifier->started)
+	{
+		opal_mutexLock(&notifier->mutex);
+		notifier->shutdown = 1;
+		opal_notifierWake(notifier);
+		opal_mutexUnlock(&notifier->mutex);
+
+		opal_threadJoin(&notifier->thread);
+	}
+
+	// note: callbacks of values that are already reached still run, the rest are dropped
+	opal_mutexLock(&notifier->mutex);
+	uint32_t num_ready = opal_notifierCollect(notifier);
+	opal_mutexUnlock(&notifier->mutex);
+
+	opal_notifierInvoke(notifier, num_ready);
+
+	if (notifier->started)
+		notifier->functions.destroy(notifier->device, notifier->wake_semaphore);
+
+	opal_bumpShutdown(&notifier->scratch);
+	opal_conditionShutdown(&notifier->wait_condition);
+	opal_mutexShutdown(&notifier->mutex);
+
+	free(notifier->entries);
+	free(notifier->ready);
+	free(notifier->wait_semaphores);
+	free(notifier->wait_values);
+
+	memset(notifier, 0, sizeof(Opal_Notifier));
+	return OPAL_SUCCESS;
+}
+
+/*
+ */
+Opal_Result opal_notifierRegister(Opal_Notifier *notifier, Opal_Semaphore semaphore, uint64_t native, uint64_t value, PFN_opalSemaphoreCallback callback, void *user_data)
+{
+	assert(notifier);
+	assert(callback);
+
+	uint32_t threaded = (notifier->functions.wait != NULL);
+
+	opal_mutexLock(&notifier->mutex);
+
+	if (threaded)
+	{
+		Opal_Result result = opal_notifierStart(notifier);
+		if (result != OPAL_SUCCESS)
+		{
+			opal_mutexUnlock(&notifier->mutex);
+			return result;
+		}
+	}
+
+	if (notifier->entries_capacity == notifier->num_entries)
+	{
+		notifier->entries_capacity = (notifier->entries_capacity == 0) ? 16 : notifier->entries_capacity * 2;
+		notifier->entries = (Opal_NotifierEntry *)realloc(notifier->entries, sizeof(Opal_NotifierEntry) * notifier->entries_capacity);
+		assert(notifier->entries);
+	}
+
+	Opal_NotifierEntry *entry = &notifier->entries[notifier->num_entries++];
+	entry->semaphore = semaphore;
+	entry->native = native;
+	entry->value = value;
+	entry->callback = callback;
+	entry->user_data = user_data;
+
+	if (threaded)
+		opal_notifierWake(notifier);
+
+	opal_mutexUnlock(&notifier->mutex);
+
+	// note: values that are already reached run right away
+	if (!threaded)
+		opal_notifierPoll(notifier);
+
+	return OPAL_SUCCESS;
+}
+
+void opal_notifierCancel(Opal_Notifier *notifier, uint64_t native)
+{
+	assert(notifier);
+
+	opal_mutexLock(&notifier->mutex);
+
+	uint32_t num_pending = 0;
+	for (uint32_t i = 0; i < notifier->num_entries; ++i)
+		if (notifier->entries[i].native != native)
+			notifier->entries[num_pending++] = notifier->entries[i];
+
+	uint32_t cancelled = (num_pending < notifier->num_entries);
+	notifier->num_entries = num_pending;
+
+	// note: the thread may be waiting on the semaphore that is about to be destroyed,
+	//       so it's woken up and the call returns once that wait is over
+	if (cancelled && notifier->waiting)
+	{
+		uint64_t wait_count = notifier->wait_count;
+		opal_notifierWake(notifier);
+
+		while (notifier->waiting && notifier->wait_count == wait_count)
+			opal_conditionWait(&notifier->wait_condition, &notifier->mutex);
+	}
+
+	opal_mutexUnlock(&notifier->mutex);
+}
+
+void opal_notifierPoll(Opal_Notifier *notifier)
+{
+	assert(notifier);
+	assert(notifier->functions.wait == NULL);
+
+	// note: callbacks may register new callbacks, the outer poll picks them up
+	if (notifier->polling)
+		return;
+
+	notifier->polling = 1;
+
+	while (1)
+	{
+		opal_mutexLock(&notifier->mutex);
+		uint32_t num_ready = opal_notifierCollect(notifier);
+		opal_mutexUnlock(&notifier->mutex);
+
+		if (num_ready == 0)
+			break;
+
+		opal_notifierInvoke(notifier, num_ready);
+	}
+
+	notifier->polling = 0;
+}
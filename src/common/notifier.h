@@ -0,0 +1,66 @@
+#pragma once
+
+#include <opal.h>
+
+#include "bump.h"
+#include "thread.h"
+
+// note: runs semaphore callbacks once their values are reached. Backends resolve semaphores to
+//       native handles on the registering thread, so the notifier thread never reads backend
+//       pools. Backends without a native multiple semaphore wait leave create, destroy, signal
+//       and wait empty and call opal_notifierPoll wherever semaphore values advance instead
+typedef Opal_Result (*Opal_NotifierCreateFunction)(void *device, uint64_t *semaphore);
+typedef void (*Opal_NotifierDestroyFunction)(void *device, uint64_t semaphore);
+typedef uint64_t (*Opal_NotifierQueryFunction)(void *device, uint64_t semaphore);
+typedef void (*Opal_NotifierSignalFunction)(void *device, uint64_t semaphore, uint64_t value);
+typedef void (*Opal_NotifierWaitFunction)(void *device, uint32_t num_semaphores, const uint64_t *semaphores, const uint64_t *values, Opal_Bump *scratch);
+
+typedef struct Opal_NotifierFunctions_t
+{
+	Opal_NotifierCreateFunction create;
+	Opal_NotifierDestroyFunction destroy;
+	Opal_NotifierQueryFunction query;
+	Opal_NotifierSignalFunction signal;
+	Opal_NotifierWaitFunction wait;
+} Opal_NotifierFunctions;
+
+typedef struct Opal_NotifierEntry_t
+{
+	Opal_Semaphore semaphore;
+	uint64_t native;
+	uint64_t value;
+	PFN_opalSemaphoreCallback callback;
+	void *user_data;
+} Opal_NotifierEntry;
+
+typedef struct Opal_Notifier_t
+{
+	void *device;
+	Opal_NotifierFunctions functions;
+	Opal_Mutex mutex;
+	Opal_Condition wait_condition;
+	Opal_Thread thread;
+	Opal_Bump scratch;
+	uint64_t wake_semaphore;
+	uint64_t wake_value;
+	uint32_t started;
+	uint32_t shutdown;
+	uint32_t polling;
+	uint32_t waiting;
+	uint64_t wait_count;
+	Opal_NotifierEntry *entries;
+	uint32_t num_entries;
+	uint32_t entries_capacity;
+	Opal_NotifierEntry *ready;
+	uint32_t ready_capacity;
+	uint64_t *wait_semaphores;
+	uint64_t *wait_values;
+	uint32_t wait_capacity;
+} Opal_Notifier;
+
+Opal_Result opal_notifierInitialize(Opal_Notifier *notifier, void *device, const Opal_NotifierFunctions *functions);
+Opal_Result opal_notifierShutdown(Opal_Notifier *notifier);
+
+Opal_Result opal_notifierRegister(Opal_Notifier *notifier, Opal_Semaphore semaphore, uint64_t native, uint64_t value, PFN_opalSemaphoreCallback callback, void *user_data);
+void opal_notifierCancel(Opal_Notifier *notifier, uint64_t native);
+void opal_notifierPoll(Opal_Notifier *notifier);
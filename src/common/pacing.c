@@ -0,0 +1,130 @@
+#include "pacing.h"
+
+#include <assert.h>
+#include <string.h>
+
+/*
+ */
+static Opal_FrameTiming *opal_pacingGetFrame(Opal_Pacing *pacing, uint64_t frame_id)
+{
+	assert(pacing);
+	assert(frame_id > 0);
+
+	return &pacing->frames[frame_id % OPAL_PACING_MAX_FRAMES];
+}
+
+static Opal_FrameTiming *opal_pacingGetPendingFrame(Opal_Pacing *pacing)
+{
+	assert(pacing);
+
+	uint64_t frame_id = pacing->last_presented_frame + 1;
+	Opal_FrameTiming *frame = opal_pacingGetFrame(pacing, frame_id);
+
+	// note: submits may come without a matching acquire (e.g. offscreen work signaling a swapchain),
+	//       so the slot is claimed by whichever call touches the pending frame first
+	if (frame->frame_id != frame_id)
+	{
+		memset(frame, 0, sizeof(Opal_FrameTiming));
+		frame->frame_id = frame_id;
+	}
+
+	return frame;
+}
+
+/*
+ */
+void opal_pacingInitialize(Opal_Pacing *pacing, uint32_t max_frames_in_flight)
+{
+	assert(pacing);
+
+	memset(pacing, 0, sizeof(Opal_Pacing));
+	pacing->max_frames_in_flight = max_frames_in_flight;
+}
+
+void opal_pacingAcquire(Opal_Pacing *pacing, uint64_t time)
+{
+	assert(pacing);
+
+	Opal_FrameTiming *frame = opal_pacingGetPendingFrame(pacing);
+	frame->acquire_time = time;
+}
+
+void opal_pacingSubmit(Opal_Pacing *pacing, uint64_t time)
+{
+	assert(pacing);
+
+	// note: last submit before present wins, it's the one the presented image depends on
+	Opal_FrameTiming *frame = opal_pacingGetPendingFrame(pacing);
+	frame->submit_time = time;
+}
+
+uint64_t opal_pacingPresent(Opal_Pacing *pacing, uint64_t time)
+{
+	assert(pacing);
+
+	Opal_FrameTiming *frame = opal_pacingGetPendingFrame(pacing);
+	frame->present_time = time;
+
+	pacing->last_presented_frame = frame->frame_id;
+	return frame->frame_id;
+}
+
+void opal_pacingDisplay(Opal_Pacing *pacing, uint64_t frame_id, uint64_t time)
+{
+	assert(pacing);
+
+	// note: presents complete in order, older frames without a timestamp were dropped or
+	//       not observed and keep zero display time
+	if (frame_id <= pacing->last_displayed_frame || frame_id > pacing->last_presented_frame)
+		return;
+
+	Opal_FrameTiming *frame = opal_pacingGetFrame(pacing, frame_id);
+	if (frame->frame_id == frame_id)
+		frame->display_time = time;
+
+	pacing->last_displayed_frame = frame_id;
+}
+
+uint64_t opal_pacingGetNextFrame(const Opal_Pacing *pacing)
+{
+	assert(pacing);
+
+	return pacing->last_presented_frame + 1;
+}
+
+uint64_t opal_pacingGetThrottleFrame(const Opal_Pacing *pacing)
+{
+	assert(pacing);
+
+	if (pacing->max_frames_in_flight == 0)
+		return 0;
+
+	uint64_t next_frame = pacing->last_presented_frame + 1;
+	if (next_frame <= pacing->max_frames_in_flight)
+		return 0;
+
+	uint64_t throttle_frame = next_frame - pacing->max_frames_in_flight;
+	if (throttle_frame <= pacing->last_displayed_frame)
+		return 0;
+
+	return throttle_frame;
+}
+
+void opal_pacingGetTiming(const Opal_Pacing *pacing, Opal_FrameTiming *timing)
+{
+	assert(pacing);
+	assert(timing);
+
+	memset(timing, 0, sizeof(Opal_FrameTiming));
+
+	uint64_t frame_id = pacing->last_displayed_frame;
+	if (frame_id == 0 || pacing->last_presented_frame - frame_id >= OPAL_PACING_MAX_FRAMES)
+		frame_id = pacing->last_presented_frame;
+
+	if (frame_id == 0)
+		return;
+
+	const Opal_FrameTiming *frame = &pacing->frames[frame_id % OPAL_PACING_MAX_FRAMES];
+	if (frame->frame_id == frame_id)
+		memcpy(timing, frame, sizeof(Opal_FrameTiming));
+}
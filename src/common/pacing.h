@@ -0,0 +1,26 @@
+#pragma once
+
+#include <opal.h>
+
+// note: per swapchain frame timing history, frame ids start at 1 and grow with every present.
+//       Backends pass timestamps in, so the bookkeeping stays the same for every api
+#define OPAL_PACING_MAX_FRAMES 16
+
+typedef struct Opal_Pacing_t
+{
+	Opal_FrameTiming frames[OPAL_PACING_MAX_FRAMES];
+	uint64_t last_presented_frame;
+	uint64_t last_displayed_frame;
+	uint32_t max_frames_in_flight;
+} Opal_Pacing;
+
+void opal_pacingInitialize(Opal_Pacing *pacing, uint32_t max_frames_in_flight);
+
+void opal_pacingAcquire(Opal_Pacing *pacing, uint64_t time);
+void opal_pacingSubmit(Opal_Pacing *pacing, uint64_t time);
+uint64_t opal_pacingPresent(Opal_Pacing *pacing, uint64_t time);
+void opal_pacingDisplay(Opal_Pacing *pacing, uint64_t frame_id, uint64_t time);
+
+uint64_t opal_pacingGetNextFrame(const Opal_Pacing *pacing);
+uint64_t opal_pacingGetThrottleFrame(const Opal_Pacing *pacing);
+void opal_pacingGetTiming(const Opal_Pacing *pacing, Opal_FrameTiming *timing);
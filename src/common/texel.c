@@ -0,0 +1,1101 @@
+#include "texel.h"
+#include "intrinsics.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#if defined(__AVX2__)
+#define OPAL_TEXEL_AVX2
+#define OPAL_TEXEL_SSE2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OPAL_TEXEL_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define OPAL_TEXEL_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define OPAL_TEXEL_F16C
+#include <immintrin.h>
+#endif
+
+#define OPAL_TEXEL_KAISER_WIDTH 3.0f
+#define OPAL_TEXEL_KAISER_ALPHA 4.0f
+#define OPAL_TEXEL_PI 3.14159265358979f
+#define OPAL_TEXEL_BATCH_SIZE 64
+#define OPAL_TEXEL_SRGB_BUCKET_MIN 1.220703125e-4f
+#define OPAL_TEXEL_SRGB_BUCKET_MAX 0.99999994f
+
+typedef enum Opal_TexelType_t
+{
+	OPAL_TEXEL_TYPE_UNORM8 = 0,
+	OPAL_TEXEL_TYPE_SNORM8,
+	OPAL_TEXEL_TYPE_SRGB8,
+	OPAL_TEXEL_TYPE_HALF,
+	OPAL_TEXEL_TYPE_FLOAT,
+	OPAL_TEXEL_TYPE_RG11B10,
+	OPAL_TEXEL_TYPE_RGB9E5,
+} Opal_TexelType;
+
+typedef struct Opal_TexelCodec_t
+{
+	Opal_TexelType type;
+	uint32_t num_channels;
+	uint32_t size;
+	uint32_t swap_rb;
+} Opal_TexelCodec;
+
+typedef union Opal_TexelBits_t
+{
+	float f;
+	uint32_t u;
+} Opal_TexelBits;
+
+/*
+ */
+static const float srgb_to_linear[256] =
+{
+	0.0f, 0.000303526991f, 0.000607053982f, 0.000910580973f, 0.00121410796f, 0.00151763496f, 0.00182116195f, 0.00212468882f,
+	0.00242821593f, 0.0027317428f, 0.00303526991f, 0.00334653584f, 0.00367650739f, 0.00402471703f, 0.00439144205f, 0.00477695325f,
+	0.00518151652f, 0.00560539169f, 0.00604883302f, 0.00651209056f, 0.00699541019f, 0.00749903219f, 0.00802319311f, 0.00856812578f,
+	0.00913405884f, 0.00972121768f, 0.010329823f, 0.0109600937f, 0.0116122449f, 0.012286488f, 0.0129830325f, 0.0137020834f,
+	0.0144438436f, 0.0152085144f, 0.0159962941f, 0.0168073755f, 0.0176419541f, 0.01850022f, 0.0193823613f, 0.0202885624f,
+	0.0212190095f, 0.0221738853f, 0.0231533665f, 0.0241576321f, 0.0251868591f, 0.0262412224f, 0.0273208916f, 0.02842604f,
+	0.0295568351f, 0.0307134446f, 0.0318960324f, 0.0331047662f, 0.0343398079f, 0.0356013142f, 0.0368894488f, 0.0382043719f,
+	0.0395462364f, 0.0409151986f, 0.0423114114f, 0.043735031f, 0.045186203f, 0.0466650873f, 0.0481718257f, 0.0497065671f,
+	0.0512694567f, 0.0528606474f, 0.054480277f, 0.0561284907f, 0.0578054301f, 0.0595112368f, 0.0612460524f, 0.0630100146f,
+	0.064803265f, 0.0666259378f, 0.0684781671f, 0.0703600943f, 0.0722718537f, 0.0742135718f, 0.0761853829f, 0.078187421f,
+	0.0802198201f, 0.0822827071f, 0.0843762085f, 0.0865004584f, 0.0886555836f, 0.0908417106f, 0.0930589661f, 0.0953074694f,
+	0.097587347f, 0.0998987257f, 0.102241732f, 0.104616486f, 0.107023105f, 0.10946171f, 0.111932427f, 0.114435375f,
+	0.116970666f, 0.119538426f, 0.122138776f, 0.124771819f, 0.127437681f, 0.130136475f, 0.13286832f, 0.135633335f,
+	0.138431609f, 0.141263291f, 0.144128472f, 0.147027269f, 0.149959788f, 0.152926147f, 0.155926466f, 0.158960834f,
+	0.162029371f, 0.165132195f, 0.168269396f, 0.171441108f, 0.174647406f, 0.177888423f, 0.18116425f, 0.18447499f,
+	0.187820777f, 0.191201687f, 0.194617838f, 0.198069319f, 0.20155625f, 0.205078736f, 0.208636865f, 0.212230757f,
+	0.215860501f, 0.219526201f, 0.223227963f, 0.226965874f, 0.230740055f, 0.23455058f, 0.238397568f, 0.242281124f,
+	0.246201321f, 0.25015828f, 0.254152089f, 0.258182853f, 0.262250662f, 0.266355604f, 0.270497799f, 0.274677306f,
+	0.278894275f, 0.283148736f, 0.287440836f, 0.291770637f, 0.296138257f, 0.300543785f, 0.304987311f, 0.309468925f,
+	0.313988715f, 0.318546772f, 0.323143214f, 0.327778101f, 0.332451522f, 0.337163627f, 0.341914415f, 0.346704066f,
+	0.351532608f, 0.356400132f, 0.361306787f, 0.366252601f, 0.371237695f, 0.376262128f, 0.38132602f, 0.386429429f,
+	0.391572475f, 0.396755219f, 0.401977777f, 0.407240212f, 0.412542611f, 0.417885065f, 0.423267663f, 0.428690493f,
+	0.434153646f, 0.439657182f, 0.445201188f, 0.450785786f, 0.456411034f, 0.462076992f, 0.467783809f, 0.473531485f,
+	0.479320168f, 0.48514995f, 0.491020858f, 0.496932983f, 0.502886474f, 0.50888133f, 0.514917672f, 0.520995557f,
+	0.527115107f, 0.533276379f, 0.539479494f, 0.545724452f, 0.55201143f, 0.558340371f, 0.564711511f, 0.571124852f,
+	0.577580452f, 0.584078431f, 0.590618849f, 0.597201765f, 0.603827357f, 0.610495567f, 0.617206573f, 0.623960376f,
+	0.630757153f, 0.637596846f, 0.644479692f, 0.651405632f, 0.658374846f, 0.665387273f, 0.672443151f, 0.679542482f,
+	0.686685324f, 0.693871737f, 0.701101899f, 0.708375752f, 0.715693474f, 0.723055124f, 0.730460763f, 0.73791039f,
+	0.745404184f, 0.752942204f, 0.760524511f, 0.768151164f, 0.775822222f, 0.783537805f, 0.791297913f, 0.799102724f,
+	0.806952238f, 0.814846575f, 0.822785735f, 0.830769897f, 0.838799f, 0.846873224f, 0.854992628f, 0.863157213f,
+	0.871367097f, 0.8796224f, 0.887923121f, 0.896269381f, 0.904661179f, 0.913098633f, 0.921581864f, 0.930110872f,
+	0.938685715f, 0.947306514f, 0.955973327f, 0.964686275f, 0.973445296f, 0.982250571f, 0.991102099f, 1.0f
+};
+
+// note: linear values halfway between two consecutive srgb codes, encoding picks the code
+//       from the tables below and fixes it up with one compare against these
+static const float srgb_thresholds[255] =
+{
+	0.000151763496f, 0.000455290487f, 0.000758817478f, 0.00106234441f, 0.0013658714f, 0.00166939839f, 0.00197292538f, 0.00227645249f,
+	0.00257997937f, 0.00288350624f, 0.00318830088f, 0.00350925932f, 0.00384831498f, 0.00420574797f, 0.00458183279f, 0.00497683743f,
+	0.00539102405f, 0.00582465064f, 0.00627796957f, 0.00675122766f, 0.00724466844f, 0.00775853032f, 0.00829304848f, 0.00884845294f,
+	0.00942497049f, 0.0100228256f, 0.010642237f, 0.011283421f, 0.0119465925f, 0.0126319602f, 0.0133397318f, 0.0140701123f,
+	0.0148233026f, 0.0155995032f, 0.0163989104f, 0.0172217153f, 0.0180681143f, 0.0189382937f, 0.0198324434f, 0.0207507443f,
+	0.0216933824f, 0.0226605386f, 0.0236523896f, 0.0246691145f, 0.0257108882f, 0.0267778821f, 0.0278702695f, 0.0289882198f,
+	0.0301319025f, 0.0313014798f, 0.0324971229f, 0.0337189883f, 0.0349672437f, 0.0362420455f, 0.0375435539f, 0.0388719253f,
+	0.04022732f, 0.041609887f, 0.0430197865f, 0.0444571637f, 0.0459221713f, 0.0474149622f, 0.0489356853f, 0.0504844859f,
+	0.0520615056f, 0.0536668971f, 0.055300802f, 0.0569633618f, 0.0586547181f, 0.0603750125f, 0.0621243827f, 0.0639029741f,
+	0.0657109171f, 0.0675483495f, 0.0694154128f, 0.0713122338f, 0.0732389539f, 0.0751957074f, 0.0771826133f, 0.0791998208f,
+	0.0812474415f, 0.0833256245f, 0.085434489f, 0.0875741541f, 0.089744769f, 0.091946438f, 0.0941793025f, 0.0964434743f,
+	0.098739095f, 0.101066269f, 0.10342513f, 0.105815805f, 0.108238399f, 0.110693045f, 0.113179862f, 0.115698971f,
+	0.118250482f, 0.120834522f, 0.123451203f, 0.126100644f, 0.128782958f, 0.131498262f, 0.134246677f, 0.137028307f,
+	0.13984327f, 0.142691687f, 0.145573661f, 0.148489311f, 0.151438728f, 0.15442206f, 0.157439381f, 0.160490826f,
+	0.163576499f, 0.166696489f, 0.169850931f, 0.173039913f, 0.176263571f, 0.179521978f, 0.182815254f, 0.186143503f,
+	0.189506829f, 0.192905352f, 0.196339145f, 0.199808344f, 0.203313038f, 0.206853345f, 0.210429341f, 0.214041144f,
+	0.217688844f, 0.22137256f, 0.225092396f, 0.228848428f, 0.232640758f, 0.236469507f, 0.240334779f, 0.244236633f,
+	0.248175204f, 0.252150565f, 0.256162852f, 0.260212123f, 0.264298469f, 0.268422037f, 0.272582889f, 0.276781112f,
+	0.281016797f, 0.285290092f, 0.289601028f, 0.293949723f, 0.298336297f, 0.30276081f, 0.30722335f, 0.311724037f,
+	0.31626296f, 0.32084018f, 0.325455844f, 0.330109984f, 0.334802747f, 0.339534163f, 0.344304383f, 0.349113464f,
+	0.353961498f, 0.358848572f, 0.363774776f, 0.368740231f, 0.373744965f, 0.378789127f, 0.383872777f, 0.388996005f,
+	0.3941589f, 0.399361521f, 0.404604018f, 0.40988642f, 0.415208817f, 0.420571357f, 0.425974041f, 0.431417018f,
+	0.436900347f, 0.442424119f, 0.447988421f, 0.453593314f, 0.459238917f, 0.464925289f, 0.470652521f, 0.476420701f,
+	0.482229918f, 0.488080233f, 0.493971765f, 0.499904543f, 0.505878687f, 0.511894286f, 0.517951429f, 0.524050117f,
+	0.530190527f, 0.536372721f, 0.542596757f, 0.548862696f, 0.555170655f, 0.561520696f, 0.567912877f, 0.574347317f,
+	0.580824137f, 0.587343335f, 0.593904972f, 0.600509226f, 0.607156098f, 0.613845706f, 0.62057811f, 0.62735337f,
+	0.634171605f, 0.641032875f, 0.647937238f, 0.654884815f, 0.661875665f, 0.668909788f, 0.675987363f, 0.683108449f,
+	0.690273106f, 0.697481334f, 0.704733372f, 0.712029159f, 0.719368815f, 0.72675246f, 0.734180033f, 0.741651773f,
+	0.749167681f, 0.756727815f, 0.764332294f, 0.77198112f, 0.779674411f, 0.787412286f, 0.795194745f, 0.803021908f,
+	0.810893834f, 0.818810523f, 0.826772213f, 0.834778786f, 0.842830479f, 0.850927293f, 0.859069228f, 0.867256522f,
+	0.875489056f, 0.883767068f, 0.892090559f, 0.900459588f, 0.908874214f, 0.917334557f, 0.925840616f, 0.934392571f,
+	0.942990363f, 0.951634169f, 0.960324049f, 0.969060004f, 0.977842152f, 0.986670554f, 0.995545268f
+};
+
+// note: piecewise linear estimate of the srgb code, 8 buckets per exponent from 2^-13 to 1,
+//       indexed by float bits. The estimate is never more than one code off
+static const float srgb_bucket_bases[104] =
+{
+	0.902172863f, 0.952444434f, 1.00271606f, 1.05298769f, 1.10325933f, 1.15353084f, 1.20380247f, 1.2540741f,
+	1.30434573f, 1.40488887f, 1.50543213f, 1.60597539f, 1.70651853f, 1.80706179f, 1.90760493f, 2.00814819f,
+	2.10869145f, 2.30977774f, 2.51086426f, 2.71195078f, 2.91303706f, 3.11412358f, 3.31520987f, 3.51629639f,
+	3.71738291f, 4.11955547f, 4.52172852f, 4.92390156f, 5.32607412f, 5.72824717f, 6.13041973f, 6.53259277f,
+	6.93476582f, 7.73911142f, 8.54345703f, 9.34780312f, 10.1521482f, 10.9535522f, 11.721199f, 12.4574852f,
+	13.1656609f, 14.508213f, 15.7662897f, 16.9529285f, 18.0781727f, 19.1499462f, 20.174633f, 21.1574574f,
+	22.1027565f, 23.8948498f, 25.5741806f, 27.1581535f, 28.6601734f, 30.0908222f, 31.4586143f, 32.7705269f,
+	34.0323486f, 36.4245071f, 38.6661453f, 40.7804947f, 42.78545f, 44.695137f, 46.5209198f, 48.2721138f,
+	49.9564476f, 53.1495934f, 56.141819f, 58.964138f, 61.6404343f, 64.1895599f, 66.6266861f, 68.9642487f,
+	71.2125626f, 75.4748993f, 79.4690475f, 83.2363892f, 86.808815f, 90.2114868f, 93.4646683f, 96.584938f,
+	99.5860825f, 105.27562f, 110.607162f, 115.635963f, 120.404579f, 124.946602f, 129.289078f, 133.454132f,
+	137.460175f, 145.054794f, 152.171555f, 158.884201f, 165.249542f, 171.312408f, 177.108917f, 182.668594f,
+	188.016037f, 198.153641f, 207.653366f, 216.613663f, 225.110382f, 233.203339f, 240.94075f, 248.362045f
+};
+
+static const float srgb_bucket_steps[104] =
+{
+	0.000196373468f, 0.000196373468f, 0.000196373468f, 0.000196373468f, 0.000196373468f, 0.000196373468f, 0.000196373468f, 0.000196373468f,
+	0.000392746937f, 0.000392746937f, 0.000392746937f, 0.000392746937f, 0.000392746937f, 0.000392746937f, 0.000392746937f, 0.000392746937f,
+	0.000785493874f, 0.000785493874f, 0.000785493874f, 0.000785493874f, 0.000785493874f, 0.000785493874f, 0.000785493874f, 0.000785493874f,
+	0.00157098775f, 0.00157098775f, 0.00157098775f, 0.00157098775f, 0.00157098775f, 0.00157098775f, 0.00157098775f, 0.00157098775f,
+	0.0031419755f, 0.0031419755f, 0.0031419755f, 0.0031419755f, 0.00313048298f, 0.00299862283f, 0.0028761155f, 0.00276631024f,
+	0.00524434447f, 0.00491436291f, 0.00463530794f, 0.00439548399f, 0.00418661954f, 0.00400268147f, 0.00383915356f, 0.00369258132f,
+	0.00700036017f, 0.00655988744f, 0.0061873938f, 0.00586726703f, 0.0055884663f, 0.00534293847f, 0.00512465509f, 0.0049290047f,
+	0.00934435986f, 0.00875639915f, 0.00825918f, 0.00783186127f, 0.00745970756f, 0.00713196723f, 0.00684059411f, 0.00657943171f,
+	0.0124732237f, 0.0116883907f, 0.0110246819f, 0.0104542812f, 0.0099575147f, 0.00952003431f, 0.00913109723f, 0.00878248736f,
+	0.0166497566f, 0.0156021304f, 0.0147161856f, 0.0139547912f, 0.0132916877f, 0.0127077205f, 0.0121885529f, 0.0117232148f,
+	0.0222247578f, 0.0208263453f, 0.01964375f, 0.0186274108f, 0.0177422743f, 0.0169627722f, 0.0162697658f, 0.0156486146f,
+	0.0296664927f, 0.0277998354f, 0.0262212604f, 0.0248646103f, 0.0236830954f, 0.0226425845f, 0.0217175316f, 0.0208883937f,
+	0.0396000184f, 0.0371083282f, 0.0350011848f, 0.0331902727f, 0.0316131413f, 0.0302242246f, 0.0289894268f, 0.0278826598f
+};
+
+/*
+ */
+static OPAL_INLINE uint32_t opal_texelFloatBits(float value)
+{
+	Opal_TexelBits bits;
+	bits.f = value;
+	return bits.u;
+}
+
+static OPAL_INLINE float opal_texelBitsFloat(uint32_t value)
+{
+	Opal_TexelBits bits;
+	bits.u = value;
+	return bits.f;
+}
+
+static OPAL_INLINE float opal_texelClamp(float value, float low, float high)
+{
+	// note: written so that NaN ends up as low
+	value = (value > low) ? value : low;
+	return (value < high) ? value : high;
+}
+
+// note: converts a positive float (sign already stripped) to an unsigned float with 5 exponent bits
+//       and the given mantissa bits, rounding to nearest even. Works for half, 11 and 10 bit floats
+static uint32_t opal_texelFloatToSmall(uint32_t bits, uint32_t mantissa_bits)
+{
+	uint32_t shift = 23 - mantissa_bits;
+	uint32_t infinity = 0x1Fu << mantissa_bits;
+
+	if (bits > 0x7F800000u)
+		return infinity | (1u << (mantissa_bits - 1));
+
+	if (bits >= (127u + 16u) << 23)
+		return infinity;
+
+	if (bits < (113u << 23))
+	{
+		uint32_t magic = ((127u - 15u) + shift + 1u) << 23;
+		float value = opal_texelBitsFloat(bits) + opal_texelBitsFloat(magic);
+		return opal_texelFloatBits(value) - magic;
+	}
+
+	uint32_t mantissa_odd = (bits >> shift) & 1;
+	bits += ((uint32_t)(15 - 127) << 23) + ((1u << (shift - 1)) - 1);
+	bits += mantissa_odd;
+
+	return bits >> shift;
+}
+
+static float opal_texelSmallToFloat(uint32_t value, uint32_t mantissa_bits)
+{
+	uint32_t shift = 23 - mantissa_bits;
+	uint32_t mantissa = value & ((1u << mantissa_bits) - 1);
+	uint32_t exponent = (value >> mantissa_bits) & 0x1F;
+
+	if (exponent == 0x1F)
+		return opal_texelBitsFloat(0x7F800000u | (mantissa << shift));
+
+	if (exponent == 0)
+		return (float)mantissa / (float)(1u << (14 + mantissa_bits));
+
+	return opal_texelBitsFloat(((exponent + 112u) << 23) | (mantissa << shift));
+}
+
+static OPAL_INLINE uint16_t opal_texelFloatToHalf1(float value)
+{
+	uint32_t bits = opal_texelFloatBits(value);
+	uint32_t sign = bits & 0x80000000u;
+
+	return (uint16_t)(opal_texelFloatToSmall(bits ^ sign, 10) | (sign >> 16));
+}
+
+static OPAL_INLINE float opal_texelHalfToFloat1(uint16_t value)
+{
+	uint32_t sign = (uint32_t)(value & 0x8000) << 16;
+	return opal_texelBitsFloat(opal_texelFloatBits(opal_texelSmallToFloat(value, 10)) | sign);
+}
+
+static OPAL_INLINE uint8_t opal_texelLinearToSrgb1(float value)
+{
+	value = opal_texelClamp(value, 0.0f, 1.0f);
+
+	float bucket_value = opal_texelClamp(value, OPAL_TEXEL_SRGB_BUCKET_MIN, OPAL_TEXEL_SRGB_BUCKET_MAX);
+	uint32_t bits = opal_texelFloatBits(bucket_value);
+	uint32_t bucket = (bits - opal_texelFloatBits(OPAL_TEXEL_SRGB_BUCKET_MIN)) >> 20;
+	uint32_t t = (bits >> 12) & 0xFF;
+
+	uint32_t code = (uint32_t)(srgb_bucket_bases[bucket] + srgb_bucket_steps[bucket] * (float)t);
+	code = (code < 255) ? code : 255;
+
+	if (code < 255 && value >= srgb_thresholds[code])
+		code++;
+	else if (code > 0 && value < srgb_thresholds[code - 1])
+		code--;
+
+	return (uint8_t)code;
+}
+
+static OPAL_INLINE uint32_t opal_texelSmallFromFloat(float value, uint32_t mantissa_bits)
+{
+	uint32_t bits = opal_texelFloatBits(value);
+
+	// note: unsigned floats can't hold negative values, NaN keeps its sign bit out of the way
+	if (bits > 0x7F800000u && bits < 0x80000000u)
+		return opal_texelFloatToSmall(bits, mantissa_bits);
+
+	if (bits & 0x80000000u)
+		return (bits > 0xFF800000u) ? opal_texelFloatToSmall(0x7FC00000u, mantissa_bits) : 0;
+
+	return opal_texelFloatToSmall(bits, mantissa_bits);
+}
+
+static uint32_t opal_texelPackRG11B10_1(const float *texel)
+{
+	uint32_t r = opal_texelSmallFromFloat(texel[0], 6);
+	uint32_t g = opal_texelSmallFromFloat(texel[1], 6);
+	uint32_t b = opal_texelSmallFromFloat(texel[2], 5);
+
+	return r | (g << 11) | (b << 22);
+}
+
+static void opal_texelUnpackRG11B10_1(float *texel, uint32_t value)
+{
+	texel[0] = opal_texelSmallToFloat(value & 0x7FF, 6);
+	texel[1] = opal_texelSmallToFloat((value >> 11) & 0x7FF, 6);
+	texel[2] = opal_texelSmallToFloat(value >> 22, 5);
+	texel[3] = 1.0f;
+}
+
+static uint32_t opal_texelPackRGB9E5_1(const float *texel)
+{
+	// note: shared exponent encoding from the D3D / GL specs, 9 bit mantissas with bias 15
+	const float max_value = 65408.0f;
+
+	float r = opal_texelClamp(texel[0], 0.0f, max_value);
+	float g = opal_texelClamp(texel[1], 0.0f, max_value);
+	float b = opal_texelClamp(texel[2], 0.0f, max_value);
+
+	float max_channel = (r > g) ? r : g;
+	max_channel = (max_channel > b) ? max_channel : b;
+
+	int exponent = 0;
+	frexpf(max_channel, &exponent);
+
+	int shared_exponent = ((exponent - 1 > -16) ? exponent - 1 : -16) + 1 + 15;
+	float scale = ldexpf(1.0f, 24 - shared_exponent);
+
+	if ((uint32_t)(max_channel * scale + 0.5f) == 512)
+	{
+		shared_exponent++;
+		scale *= 0.5f;
+	}
+
+	uint32_t rm = (uint32_t)(r * scale + 0.5f);
+	uint32_t gm = (uint32_t)(g * scale + 0.5f);
+	uint32_t bm = (uint32_t)(b * scale + 0.5f);
+
+	return rm | (gm << 9) | (bm << 18) | ((uint32_t)shared_exponent << 27);
+}
+
+static void opal_texelUnpackRGB9E5_1(float *texel, uint32_t value)
+{
+	float scale = ldexpf(1.0f, (int)(value >> 27) - 24);
+
+	texel[0] = (float)(value & 0x1FF) * scale;
+	texel[1] = (float)((value >> 9) & 0x1FF) * scale;
+	texel[2] = (float)((value >> 18) & 0x1FF) * scale;
+	texel[3] = 1.0f;
+}
+
+/*
+ */
+void opal_texelSwizzleRB(void *dst, const void *src, uint32_t num_texels)
+{
+	assert(num_texels == 0 || dst);
+	assert(num_texels == 0 || src);
+
+	const uint32_t *src_texels = (const uint32_t *)src;
+	uint32_t *dst_texels = (uint32_t *)dst;
+	uint32_t i = 0;
+
+#if defined(OPAL_TEXEL_AVX2)
+	const __m256i mask_ga = _mm256_set1_epi32((int)0xFF00FF00);
+	const __m256i mask_low = _mm256_set1_epi32(0xFF);
+
+	for (; i + 8 <= num_texels; i += 8)
+	{
+		__m256i texels = _mm256_loadu_si256((const __m256i *)(src_texels + i));
+		__m256i ga = _mm256_and_si256(texels, mask_ga);
+		__m256i r = _mm256_slli_epi32(_mm256_and_si256(texels, mask_low), 16);
+		__m256i b = _mm256_and_si256(_mm256_srli_epi32(texels, 16), mask_low);
+
+		_mm256_storeu_si256((__m256i *)(dst_texels + i), _mm256_or_si256(ga, _mm256_or_si256(r, b)));
+	}
+#elif defined(OPAL_TEXEL_SSE2)
+	const __m128i mask_ga = _mm_set1_epi32((int)0xFF00FF00);
+	const __m128i mask_low = _mm_set1_epi32(0xFF);
+
+	for (; i + 4 <= num_texels; i += 4)
+	{
+		__m128i texels = _mm_loadu_si128((const __m128i *)(src_texels + i));
+		__m128i ga = _mm_and_si128(texels, mask_ga);
+		__m128i r = _mm_slli_epi32(_mm_and_si128(texels, mask_low), 16);
+		__m128i b = _mm_and_si128(_mm_srli_epi32(texels, 16), mask_low);
+
+		_mm_storeu_si128((__m128i *)(dst_texels + i), _mm_or_si128(ga, _mm_or_si128(r, b)));
+	}
+#elif defined(OPAL_TEXEL_NEON)
+	for (; i + 16 <= num_texels; i += 16)
+	{
+		uint8x16x4_t texels = vld4q_u8((const uint8_t *)(src_texels + i));
+		uint8x16_t r = texels.val[0];
+		texels.val[0] = texels.val[2];
+		texels.val[2] = r;
+
+		vst4q_u8((uint8_t *)(dst_texels + i), texels);
+	}
+#endif
+
+	for (; i < num_texels; ++i)
+	{
+		uint32_t texel = src_texels[i];
+		dst_texels[i] = (texel & 0xFF00FF00u) | ((texel & 0xFFu) << 16) | ((texel >> 16) & 0xFFu);
+	}
+}
+
+void opal_texelSrgbToLinear(float *dst, const uint8_t *src, uint32_t num_values)
+{
+	assert(num_values == 0 || dst);
+	assert(num_values == 0 || src);
+
+	uint32_t i = 0;
+
+#if defined(OPAL_TEXEL_AVX2)
+	for (; i + 8 <= num_values; i += 8)
+	{
+		__m256i indices = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)(src + i)));
+		_mm256_storeu_ps(dst + i, _mm256_i32gather_ps(srgb_to_linear, indices, 4));
+	}
+#endif
+
+	for (; i < num_values; ++i)
+		dst[i] = srgb_to_linear[src[i]];
+}
+
+void opal_texelLinearToSrgb(uint8_t *dst, const float *src, uint32_t num_values)
+{
+	assert(num_values == 0 || dst);
+	assert(num_values == 0 || src);
+
+	uint32_t i = 0;
+
+#if defined(OPAL_TEXEL_AVX2)
+	// note: same estimate and fix up as the scalar path, with gathers for the table lookups
+	const __m256 zero = _mm256_setzero_ps();
+	const __m256 one = _mm256_set1_ps(1.0f);
+	const __m256 bucket_min = _mm256_set1_ps(OPAL_TEXEL_SRGB_BUCKET_MIN);
+	const __m256 bucket_max = _mm256_set1_ps(OPAL_TEXEL_SRGB_BUCKET_MAX);
+	const __m256i bucket_min_bits = _mm256_castps_si256(bucket_min);
+	const __m256i mask_t = _mm256_set1_epi32(0xFF);
+	const __m256i code_max = _mm256_set1_epi32(254);
+	const __m256i code_one = _mm256_set1_epi32(1);
+
+	for (; i + 8 <= num_values; i += 8)
+	{
+		__m256 values = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(src + i), zero), one);
+		__m256i bits = _mm256_castps_si256(_mm256_min_ps(_mm256_max_ps(values, bucket_min), bucket_max));
+
+		__m256i buckets = _mm256_srli_epi32(_mm256_sub_epi32(bits, bucket_min_bits), 20);
+		__m256 t = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(bits, 12), mask_t));
+
+		__m256 bases = _mm256_i32gather_ps(srgb_bucket_bases, buckets, 4);
+		__m256 steps = _mm256_i32gather_ps(srgb_bucket_steps, buckets, 4);
+		__m256i codes = _mm256_cvttps_epi32(_mm256_add_ps(bases, _mm256_mul_ps(steps, t)));
+
+		// note: compare against the threshold above and below, clamped so both lookups stay in range
+		__m256i upper_index = _mm256_min_epi32(codes, code_max);
+		__m256i lower_index = _mm256_max_epi32(_mm256_sub_epi32(codes, code_one), _mm256_setzero_si256());
+
+		__m256 upper = _mm256_i32gather_ps(srgb_thresholds, upper_index, 4);
+		__m256 lower = _mm256_i32gather_ps(srgb_thresholds, lower_index, 4);
+
+		__m256i is_above = _mm256_and_si256(_mm256_castps_si256(_mm256_cmp_ps(values, upper, _CMP_GE_OQ)), _mm256_cmpgt_epi32(_mm256_set1_epi32(255), codes));
+		__m256i is_below = _mm256_and_si256(_mm256_castps_si256(_mm256_cmp_ps(values, lower, _CMP_LT_OQ)), _mm256_cmpgt_epi32(codes, _mm256_setzero_si256()));
+
+		codes = _mm256_sub_epi32(codes, is_above);
+		codes = _mm256_add_epi32(codes, is_below);
+
+		__m128i words = _mm_packus_epi32(_mm256_castsi256_si128(codes), _mm256_extracti128_si256(codes, 1));
+		_mm_storel_epi64((__m128i *)(dst + i), _mm_packus_epi16(words, words));
+	}
+#endif
+
+	for (; i < num_values; ++i)
+		dst[i] = opal_texelLinearToSrgb1(src[i]);
+}
+
+void opal_texelFloatToHalf(uint16_t *dst, const float *src, uint32_t num_values)
+{
+	assert(num_values == 0 || dst);
+	assert(num_values == 0 || src);
+
+	uint32_t i = 0;
+
+#if defined(OPAL_TEXEL_F16C)
+	for (; i + 8 <= num_values; i += 8)
+	{
+		__m256 values = _mm256_loadu_ps(src + i);
+		_mm_storeu_si128((__m128i *)(dst + i), _mm256_cvtps_ph(values, _MM_FROUND_TO_NEAREST_INT));
+	}
+#elif defined(OPAL_TEXEL_SSE2)
+	// note: vector version of opal_texelFloatToSmall, every branch is computed and selected with masks
+	const __m128i sign_mask = _mm_set1_epi32((int)0x80000000u);
+	const __m128i infinity = _mm_set1_epi32(0x7F800000);
+	const __m128i overflow = _mm_set1_epi32(((127 + 16) << 23) - 1);
+	const __m128i normal_min = _mm_set1_epi32(113 << 23);
+	const __m128i denormal_magic = _mm_set1_epi32(((127 - 15) + 13 + 1) << 23);
+	const __m128i rebias = _mm_set1_epi32((int)(((uint32_t)(15 - 127) << 23) + 0xFFF));
+	const __m128i half_infinity = _mm_set1_epi32(0x7C00);
+	const __m128i half_nan = _mm_set1_epi32(0x0200);
+	const __m128i one = _mm_set1_epi32(1);
+
+	for (; i + 4 <= num_values; i += 4)
+	{
+		__m128i bits = _mm_castps_si128(_mm_loadu_ps(src + i));
+		__m128i sign = _mm_and_si128(bits, sign_mask);
+		bits = _mm_xor_si128(bits, sign);
+
+		__m128i is_nan = _mm_cmpgt_epi32(bits, infinity);
+		__m128i is_overflow = _mm_cmpgt_epi32(bits, overflow);
+		__m128i is_denormal = _mm_cmpgt_epi32(normal_min, bits);
+
+		__m128i special = _mm_or_si128(half_infinity, _mm_and_si128(is_nan, half_nan));
+
+		__m128 denormal_value = _mm_add_ps(_mm_castsi128_ps(bits), _mm_castsi128_ps(denormal_magic));
+		__m128i denormal = _mm_sub_epi32(_mm_castps_si128(denormal_value), denormal_magic);
+
+		__m128i mantissa_odd = _mm_and_si128(_mm_srli_epi32(bits, 13), one);
+		__m128i normal = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(bits, rebias), mantissa_odd), 13);
+
+		__m128i result = _mm_or_si128(_mm_and_si128(is_denormal, denormal), _mm_andnot_si128(is_denormal, normal));
+		result = _mm_or_si128(_mm_and_si128(is_overflow, special), _mm_andnot_si128(is_overflow, result));
+		result = _mm_or_si128(result, _mm_srli_epi32(sign, 16));
+
+		// note: sign extend so the signed saturating pack keeps all 16 bits
+		result = _mm_srai_epi32(_mm_slli_epi32(result, 16), 16);
+		_mm_storel_epi64((__m128i *)(dst + i), _mm_packs_epi32(result, result));
+	}
+#elif defined(OPAL_TEXEL_NEON)
+	for (; i + 4 <= num_values; i += 4)
+		vst1_u16(dst + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(src + i))));
+#endif
+
+	for (; i < num_values; ++i)
+		dst[i] = opal_texelFloatToHalf1(src[i]);
+}
+
+void opal_texelHalfToFloat(float *dst, const uint16_t *src, uint32_t num_values)
+{
+	assert(num_values == 0 || dst);
+	assert(num_values == 0 || src);
+
+	uint32_t i = 0;
+
+#if defined(OPAL_TEXEL_F16C)
+	for (; i + 8 <= num_values; i += 8)
+	{
+		__m128i values = _mm_loadu_si128((const __m128i *)(src + i));
+		_mm256_storeu_ps(dst + i, _mm256_cvtph_ps(values));
+	}
+#elif defined(OPAL_TEXEL_SSE2)
+	const __m128i magnitude_mask = _mm_set1_epi32(0x7FFF);
+	const __m128i sign_mask = _mm_set1_epi32(0x8000);
+	const __m128i exponent_mask = _mm_set1_epi32(0x7C00 << 13);
+	const __m128i rebias = _mm_set1_epi32((127 - 15) << 23);
+	const __m128i special_rebias = _mm_set1_epi32((128 - 16) << 23);
+	const __m128i denormal_rebias = _mm_set1_epi32(1 << 23);
+	const __m128 denormal_magic = _mm_castsi128_ps(_mm_set1_epi32(113 << 23));
+	const __m128i zero = _mm_setzero_si128();
+
+	for (; i + 4 <= num_values; i += 4)
+	{
+		__m128i values = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)(src + i)), zero);
+
+		__m128i bits = _mm_slli_epi32(_mm_and_si128(values, magnitude_mask), 13);
+		__m128i exponent = _mm_and_si128(bits, exponent_mask);
+		bits = _mm_add_epi32(bits, rebias);
+
+		__m128i is_special = _mm_cmpeq_epi32(exponent, exponent_mask);
+		__m128i is_denormal = _mm_cmpeq_epi32(exponent, zero);
+
+		bits = _mm_add_epi32(bits, _mm_and_si128(is_special, special_rebias));
+
+		__m128 denormal = _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(bits, denormal_rebias)), denormal_magic);
+		bits = _mm_or_si128(_mm_and_si128(is_denormal, _mm_castps_si128(denormal)), _mm_andnot_si128(is_denormal, bits));
+		bits = _mm_or_si128(bits, _mm_slli_epi32(_mm_and_si128(values, sign_mask), 16));
+
+		_mm_storeu_ps(dst + i, _mm_castsi128_ps(bits));
+	}
+#elif defined(OPAL_TEXEL_NEON)
+	for (; i + 4 <= num_values; i += 4)
+		vst1q_f32(dst + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(src + i))));
+#endif
+
+	for (; i < num_values; ++i)
+		dst[i] = opal_texelHalfToFloat1(src[i]);
+}
+
+void opal_texelPackRG11B10(uint32_t *dst, const float *src, uint32_t num_texels)
+{
+	assert(num_texels == 0 || dst);
+	assert(num_texels == 0 || src);
+
+	for (uint32_t i = 0; i < num_texels; ++i)
+		dst[i] = opal_texelPackRG11B10_1(src + i * 4);
+}
+
+void opal_texelUnpackRG11B10(float *dst, const uint32_t *src, uint32_t num_texels)
+{
+	assert(num_texels == 0 || dst);
+	assert(num_texels == 0 || src);
+
+	for (uint32_t i = 0; i < num_texels; ++i)
+		opal_texelUnpackRG11B10_1(dst + i * 4, src[i]);
+}
+
+void opal_texelPackRGB9E5(uint32_t *dst, const float *src, uint32_t num_texels)
+{
+	assert(num_texels == 0 || dst);
+	assert(num_texels == 0 || src);
+
+	for (uint32_t i = 0; i < num_texels; ++i)
+		dst[i] = opal_texelPackRGB9E5_1(src + i * 4);
+}
+
+void opal_texelUnpackRGB9E5(float *dst, const uint32_t *src, uint32_t num_texels)
+{
+	assert(num_texels == 0 || dst);
+	assert(num_texels == 0 || src);
+
+	for (uint32_t i = 0; i < num_texels; ++i)
+		opal_texelUnpackRGB9E5_1(dst + i * 4, src[i]);
+}
+
+/*
+ */
+static uint32_t opal_texelGetCodec(Opal_TextureFormat format, Opal_TexelCodec *codec)
+{
+	assert(codec);
+	memset(codec, 0, sizeof(Opal_TexelCodec));
+
+	switch (format)
+	{
+		case OPAL_TEXTURE_FORMAT_R8_UNORM: codec->type = OPAL_TEXEL_TYPE_UNORM8; codec->num_channels = 1; break;
+		case OPAL_TEXTURE_FORMAT_RG8_UNORM: codec->type = OPAL_TEXEL_TYPE_UNORM8; codec->num_channels = 2; break;
+		case OPAL_TEXTURE_FORMAT_RGBA8_UNORM: codec->type = OPAL_TEXEL_TYPE_UNORM8; codec->num_channels = 4; break;
+		case OPAL_TEXTURE_FORMAT_BGRA8_UNORM: codec->type = OPAL_TEXEL_TYPE_UNORM8; codec->num_channels = 4; codec->swap_rb = 1; break;
+		case OPAL_TEXTURE_FORMAT_R8_SNORM: codec->type = OPAL_TEXEL_TYPE_SNORM8; codec->num_channels = 1; break;
+		case OPAL_TEXTURE_FORMAT_RG8_SNORM: codec->type = OPAL_TEXEL_TYPE_SNORM8; codec->num_channels = 2; break;
+		case OPAL_TEXTURE_FORMAT_RGBA8_SNORM: codec->type = OPAL_TEXEL_TYPE_SNORM8; codec->num_channels = 4; break;
+		case OPAL_TEXTURE_FORMAT_RGBA8_UNORM_SRGB: codec->type = OPAL_TEXEL_TYPE_SRGB8; codec->num_channels = 4; break;
+		case OPAL_TEXTURE_FORMAT_BGRA8_UNORM_SRGB: codec->type = OPAL_TEXEL_TYPE_SRGB8; codec->num_channels = 4; codec->swap_rb = 1; break;
+		case OPAL_TEXTURE_FORMAT_R16_SFLOAT: codec->type = OPAL_TEXEL_TYPE_HALF; codec->num_channels = 1; break;
+		case OPAL_TEXTURE_FORMAT_RG16_SFLOAT: codec->type = OPAL_TEXEL_TYPE_HALF; codec->num_channels = 2; break;
+		case OPAL_TEXTURE_FORMAT_RGBA16_SFLOAT: codec->type = OPAL_TEXEL_TYPE_HALF; codec->num_channels = 4; break;
+		case OPAL_TEXTURE_FORMAT_R32_SFLOAT: codec->type = OPAL_TEXEL_TYPE_FLOAT; codec->num_channels = 1; break;
+		case OPAL_TEXTURE_FORMAT_RG32_SFLOAT: codec->type = OPAL_TEXEL_TYPE_FLOAT; codec->num_channels = 2; break;
+		case OPAL_TEXTURE_FORMAT_RGBA32_SFLOAT: codec->type = OPAL_TEXEL_TYPE_FLOAT; codec->num_channels = 4; break;
+		case OPAL_TEXTURE_FORMAT_RG11B10_UFLOAT: codec->type = OPAL_TEXEL_TYPE_RG11B10; codec->num_channels = 3; break;
+		case OPAL_TEXTURE_FORMAT_RGB9E5_UFLOAT: codec->type = OPAL_TEXEL_TYPE_RGB9E5; codec->num_channels = 3; break;
+		default: return 0;
+	}
+
+	switch (codec->type)
+	{
+		case OPAL_TEXEL_TYPE_UNORM8:
+		case OPAL_TEXEL_TYPE_SNORM8:
+		case OPAL_TEXEL_TYPE_SRGB8: codec->size = codec->num_channels; break;
+		case OPAL_TEXEL_TYPE_HALF: codec->size = codec->num_channels * sizeof(uint16_t); break;
+		case OPAL_TEXEL_TYPE_FLOAT: codec->size = codec->num_channels * sizeof(float); break;
+		case OPAL_TEXEL_TYPE_RG11B10:
+		case OPAL_TEXEL_TYPE_RGB9E5: codec->size = sizeof(uint32_t); break;
+	}
+
+	return 1;
+}
+
+static void opal_texelDecodeRow(const Opal_TexelCodec *codec, float *dst, const uint8_t *src, uint32_t num_texels)
+{
+	assert(codec);
+	assert(dst);
+	assert(src);
+
+	for (uint32_t i = 0; i < num_texels; ++i)
+	{
+		const uint8_t *src_texel = src + i * codec->size;
+		float *texel = dst + i * 4;
+
+		texel[0] = 0.0f;
+		texel[1] = 0.0f;
+		texel[2] = 0.0f;
+		texel[3] = 1.0f;
+
+		switch (codec->type)
+		{
+			case OPAL_TEXEL_TYPE_UNORM8:
+			{
+				for (uint32_t c = 0; c < codec->num_channels; ++c)
+					texel[c] = (float)src_texel[c] * (1.0f / 255.0f);
+			}
+			break;
+
+			case OPAL_TEXEL_TYPE_SNORM8:
+			{
+				for (uint32_t c = 0; c < codec->num_channels; ++c)
+				{
+					float value = (float)(int8_t)src_texel[c] * (1.0f / 127.0f);
+					texel[c] = (value > -1.0f) ? value : -1.0f;
+				}
+			}
+			break;
+
+			case OPAL_TEXEL_TYPE_SRGB8:
+			{
+				for (uint32_t c = 0; c < 3; ++c)
+					texel[c] = srgb_to_linear[src_texel[c]];
+
+				texel[3] = (float)src_texel[3] * (1.0f / 255.0f);
+			}
+			break;
+
+			case OPAL_TEXEL_TYPE_HALF:
+			{
+				uint16_t values[4] = {0};
+				memcpy(values, src_texel, codec->size);
+
+				for (uint32_t c = 0; c < codec->num_channels; ++c)
+					texel[c] = opal_texelHalfToFloat1(values[c]);
+			}
+			break;
+
+			case OPAL_TEXEL_TYPE_FLOAT:
+			{
+				memcpy(texel, src_texel, codec->size);
+			}
+			break;
+
+			case OPAL_TEXEL_TYPE_RG11B10:
+			case OPAL_TEXEL_TYPE_RGB9E5:
+			{
+				uint32_t value = 0;
+				memcpy(&value, src_texel, sizeof(uint32_t));
+
+				if (codec->type == OPAL_TEXEL_TYPE_RG11B10)
+					opal_texelUnpackRG11B10_1(texel, value);
+				else
+					opal_texelUnpackRGB9E5_1(texel, value);
+			}
+			break;
+		}
+
+		if (codec->swap_rb)
+		{
+			float r = texel[0];
+			texel[0] = texel[2];
+			texel[2] = r;
+		}
+	}
+}
+
+static void opal_texelEncodeRow(const Opal_TexelCodec *codec, uint8_t *dst, float *src, uint32_t num_texels)
+{
+	assert(codec);
+	assert(dst);
+	assert(src);
+
+	for (uint32_t i = 0; i < num_texels; ++i)
+	{
+		uint8_t *dst_texel = dst + i * codec->size;
+		float *texel = src + i * 4;
+
+		if (codec->swap_rb)
+		{
+			float r = texel[0];
+			texel[0] = texel[2];
+			texel[2] = r;
+		}
+
+		switch (codec->type)
+		{
+			case OPAL_TEXEL_TYPE_UNORM8:
+			{
+				for (uint32_t c = 0; c < codec->num_channels; ++c)
+					dst_texel[c] = (uint8_t)(opal_texelClamp(texel[c], 0.0f, 1.0f) * 255.0f + 0.5f);
+			}
+			break;
+
+			case OPAL_TEXEL_TYPE_SNORM8:
+			{
+				for (uint32_t c = 0; c < codec->num_channels; ++c)
+				{
+					float value = opal_texelClamp(texel[c], -1.0f, 1.0f) * 127.0f;
+					dst_texel[c] = (uint8_t)(int8_t)(value + ((value >= 0.0f) ? 0.5f : -0.5f));
+				}
+			}
+			break;
+
+			case OPAL_TEXEL_TYPE_SRGB8:
+			{
+				for (uint32_t c = 0; c < 3; ++c)
+					dst_texel[c] = opal_texelLinearToSrgb1(texel[c]);
+
+				dst_texel[3] = (uint8_t)(opal_texelClamp(texel[3], 0.0f, 1.0f) * 255.0f + 0.5f);
+			}
+			break;
+
+			case OPAL_TEXEL_TYPE_HALF:
+			{
+				uint16_t values[4] = {0};
+				for (uint32_t c = 0; c < codec->num_channels; ++c)
+					values[c] = opal_texelFloatToHalf1(texel[c]);
+
+				memcpy(dst_texel, values, codec->size);
+			}
+			break;
+
+			case OPAL_TEXEL_TYPE_FLOAT:
+			{
+				memcpy(dst_texel, texel, codec->size);
+			}
+			break;
+
+			case OPAL_TEXEL_TYPE_RG11B10:
+			case OPAL_TEXEL_TYPE_RGB9E5:
+			{
+				uint32_t value = (codec->type == OPAL_TEXEL_TYPE_RG11B10) ? opal_texelPackRG11B10_1(texel) : opal_texelPackRGB9E5_1(texel);
+				memcpy(dst_texel, &value, sizeof(uint32_t));
+			}
+			break;
+		}
+	}
+}
+
+/*
+ */
+static float opal_texelBessel0(float x)
+{
+	float sum = 1.0f;
+	float term = 1.0f;
+	float half_x = x * 0.5f;
+
+	for (uint32_t k = 1; k < 20; ++k)
+	{
+		term *= half_x / (float)k;
+		sum += term * term;
+	}
+
+	return sum;
+}
+
+static float opal_texelFilterWeight(Opal_TexelFilter filter, float x)
+{
+	x = fabsf(x);
+
+	if (filter == OPAL_TEXEL_FILTER_BOX)
+	{
+		// note: texels straddling the box edge get half the weight, so odd sizes stay area weighted
+		if (x < 0.5f)
+			return 1.0f;
+
+		return (x == 0.5f) ? 0.5f : 0.0f;
+	}
+
+	if (x >= OPAL_TEXEL_KAISER_WIDTH)
+		return 0.0f;
+
+	float t = x / OPAL_TEXEL_KAISER_WIDTH;
+	float window = opal_texelBessel0(OPAL_TEXEL_KAISER_ALPHA * sqrtf(1.0f - t * t)) / opal_texelBessel0(OPAL_TEXEL_KAISER_ALPHA);
+	float sinc = (x < 1e-6f) ? 1.0f : sinf(OPAL_TEXEL_PI * x) / (OPAL_TEXEL_PI * x);
+
+	return sinc * window;
+}
+
+static uint32_t opal_texelGetNumTaps(Opal_TexelFilter filter, uint32_t src_size, uint32_t dst_size)
+{
+	float scale = (float)src_size / (float)dst_size;
+	float radius = (filter == OPAL_TEXEL_FILTER_KAISER) ? OPAL_TEXEL_KAISER_WIDTH : 0.5f;
+
+	return (uint32_t)(2.0f * radius * scale) + 1;
+}
+
+static void opal_texelBuildWeights(Opal_TexelFilter filter, uint32_t src_size, uint32_t dst_size, uint32_t num_taps, int32_t *firsts, float *weights)
+{
+	assert(firsts);
+	assert(weights);
+
+	float scale = (float)src_size / (float)dst_size;
+	float radius = (filter == OPAL_TEXEL_FILTER_KAISER) ? OPAL_TEXEL_KAISER_WIDTH : 0.5f;
+
+	for (uint32_t i = 0; i < dst_size; ++i)
+	{
+		float center = ((float)i + 0.5f) * scale;
+		int32_t first = (int32_t)ceilf(center - radius * scale - 0.5f);
+
+		float *tap_weights = weights + i * num_taps;
+		float sum = 0.0f;
+
+		for (uint32_t t = 0; t < num_taps; ++t)
+		{
+			float x = ((float)(first + (int32_t)t) + 0.5f - center) / scale;
+			tap_weights[t] = opal_texelFilterWeight(filter, x);
+			sum += tap_weights[t];
+		}
+
+		assert(sum != 0.0f);
+
+		for (uint32_t t = 0; t < num_taps; ++t)
+			tap_weights[t] /= sum;
+
+		firsts[i] = first;
+	}
+}
+
+static OPAL_INLINE uint32_t opal_texelClampIndex(int32_t index, uint32_t size)
+{
+	if (index < 0)
+		return 0;
+
+	return ((uint32_t)index < size) ? (uint32_t)index : size - 1;
+}
+
+static void opal_texelBoxRGBA8(uint8_t *dst, const uint8_t *src_row0, const uint8_t *src_row1, uint32_t dst_width)
+{
+	uint32_t x = 0;
+
+#if defined(OPAL_TEXEL_SSE2)
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i two = _mm_set1_epi16(2);
+
+	for (; x + 2 <= dst_width; x += 2)
+	{
+		__m128i row0 = _mm_loadu_si128((const __m128i *)(src_row0 + x * 8));
+		__m128i row1 = _mm_loadu_si128((const __m128i *)(src_row1 + x * 8));
+
+		__m128i low = _mm_add_epi16(_mm_unpacklo_epi8(row0, zero), _mm_unpacklo_epi8(row1, zero));
+		__m128i high = _mm_add_epi16(_mm_unpackhi_epi8(row0, zero), _mm_unpackhi_epi8(row1, zero));
+
+		__m128i sum = _mm_add_epi16(_mm_unpacklo_epi64(low, high), _mm_unpackhi_epi64(low, high));
+		sum = _mm_srli_epi16(_mm_add_epi16(sum, two), 2);
+
+		_mm_storel_epi64((__m128i *)(dst + x * 4), _mm_packus_epi16(sum, sum));
+	}
+#elif defined(OPAL_TEXEL_NEON)
+	for (; x + 4 <= dst_width; x += 4)
+	{
+		uint32x4x2_t row0 = vld2q_u32((const uint32_t *)(src_row0 + x * 8));
+		uint32x4x2_t row1 = vld2q_u32((const uint32_t *)(src_row1 + x * 8));
+
+		uint8x16_t even0 = vreinterpretq_u8_u32(row0.val[0]);
+		uint8x16_t odd0 = vreinterpretq_u8_u32(row0.val[1]);
+		uint8x16_t even1 = vreinterpretq_u8_u32(row1.val[0]);
+		uint8x16_t odd1 = vreinterpretq_u8_u32(row1.val[1]);
+
+		uint16x8_t low = vaddq_u16(vaddl_u8(vget_low_u8(even0), vget_low_u8(odd0)), vaddl_u8(vget_low_u8(even1), vget_low_u8(odd1)));
+		uint16x8_t high = vaddq_u16(vaddl_u8(vget_high_u8(even0), vget_high_u8(odd0)), vaddl_u8(vget_high_u8(even1), vget_high_u8(odd1)));
+
+		vst1q_u8(dst + x * 4, vcombine_u8(vrshrn_n_u16(low, 2), vrshrn_n_u16(high, 2)));
+	}
+#endif
+
+	for (; x < dst_width; ++x)
+	{
+		const uint8_t *texel0 = src_row0 + x * 8;
+		const uint8_t *texel1 = src_row1 + x * 8;
+
+		for (uint32_t c = 0; c < 4; ++c)
+			dst[x * 4 + c] = (uint8_t)((texel0[c] + texel0[c + 4] + texel1[c] + texel1[c + 4] + 2) >> 2);
+	}
+}
+
+static void opal_texelBoxSrgb8(uint8_t *dst, const uint8_t *src_row0, const uint8_t *src_row1, uint32_t dst_width)
+{
+	// note: averages are gathered in small batches so encoding goes through the vector path
+	float linear[OPAL_TEXEL_BATCH_SIZE * 3];
+	uint8_t codes[OPAL_TEXEL_BATCH_SIZE * 3];
+
+	for (uint32_t x = 0; x < dst_width; x += OPAL_TEXEL_BATCH_SIZE)
+	{
+		uint32_t count = min(dst_width - x, OPAL_TEXEL_BATCH_SIZE);
+
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			const uint8_t *texel0 = src_row0 + (x + i) * 8;
+			const uint8_t *texel1 = src_row1 + (x + i) * 8;
+
+			for (uint32_t c = 0; c < 3; ++c)
+			{
+				float sum = srgb_to_linear[texel0[c]] + srgb_to_linear[texel0[c + 4]] + srgb_to_linear[texel1[c]] + srgb_to_linear[texel1[c + 4]];
+				linear[i * 3 + c] = sum * 0.25f;
+			}
+
+			dst[(x + i) * 4 + 3] = (uint8_t)((texel0[3] + texel0[7] + texel1[3] + texel1[7] + 2) >> 2);
+		}
+
+		opal_texelLinearToSrgb(codes, linear, count * 3);
+
+		for (uint32_t i = 0; i < count; ++i)
+			for (uint32_t c = 0; c < 3; ++c)
+				dst[(x + i) * 4 + c] = codes[i * 3 + c];
+	}
+}
+
+Opal_Result opal_texelDownsample(Opal_TextureFormat format, Opal_TexelFilter filter, uint32_t src_width, uint32_t src_height, uint32_t src_row_size, const void *src, uint32_t dst_row_size, void *dst)
+{
+	assert(src);
+	assert(dst);
+	assert(src_width > 0 && src_height > 0);
+	assert(filter < OPAL_TEXEL_FILTER_ENUM_MAX);
+
+	const uint8_t *src_data = (const uint8_t *)src;
+	uint8_t *dst_data = (uint8_t *)dst;
+
+	uint32_t dst_width = max(src_width >> 1, 1);
+	uint32_t dst_height = max(src_height >> 1, 1);
+
+	// note: exact 2x2 box on 8 bit 4 channel texels doesn't need the float path,
+	//       srgb ones still average in linear space through the lookup tables
+	uint32_t is_unorm8 = (format == OPAL_TEXTURE_FORMAT_RGBA8_UNORM || format == OPAL_TEXTURE_FORMAT_BGRA8_UNORM);
+	uint32_t is_srgb8 = (format == OPAL_TEXTURE_FORMAT_RGBA8_UNORM_SRGB || format == OPAL_TEXTURE_FORMAT_BGRA8_UNORM_SRGB);
+
+	if (filter == OPAL_TEXEL_FILTER_BOX && (is_unorm8 || is_srgb8) && src_width == dst_width * 2 && src_height == dst_height * 2)
+	{
+		for (uint32_t y = 0; y < dst_height; ++y)
+		{
+			const uint8_t *src_row0 = src_data + (uint64_t)(y * 2 + 0) * src_row_size;
+			const uint8_t *src_row1 = src_data + (uint64_t)(y * 2 + 1) * src_row_size;
+			uint8_t *dst_row = dst_data + (uint64_t)y * dst_row_size;
+
+			if (is_srgb8)
+				opal_texelBoxSrgb8(dst_row, src_row0, src_row1, dst_width);
+			else
+				opal_texelBoxRGBA8(dst_row, src_row0, src_row1, dst_width);
+		}
+
+		return OPAL_SUCCESS;
+	}
+
+	Opal_TexelCodec codec = {0};
+	if (!opal_texelGetCodec(format, &codec))
+		return OPAL_TEXTURE_FORMAT_NOT_SUPPORTED;
+
+	// note: separable filter, horizontally filtered source rows are kept in a ring
+	//       so every source row is decoded and filtered once
+	uint32_t num_taps_x = opal_texelGetNumTaps(filter, src_width, dst_width);
+	uint32_t num_taps_y = opal_texelGetNumTaps(filter, src_height, dst_height);
+
+	size_t num_floats = 0;
+	num_floats += (size_t)dst_width * num_taps_x;
+	num_floats += (size_t)dst_height * num_taps_y;
+	num_floats += (size_t)src_width * 4;
+	num_floats += (size_t)dst_width * 4 * num_taps_y;
+	num_floats += (size_t)dst_width * 4;
+
+	size_t num_ints = (size_t)dst_width + dst_height + num_taps_y;
+
+	uint8_t *memory = (uint8_t *)malloc(num_floats * sizeof(float) + num_ints * sizeof(int32_t));
+	if (memory == NULL)
+		return OPAL_NO_MEMORY;
+
+	float *weights_x = (float *)memory;
+	float *weights_y = weights_x + (size_t)dst_width * num_taps_x;
+	float *src_row = weights_y + (size_t)dst_height * num_taps_y;
+	float *ring = src_row + (size_t)src_width * 4;
+	float *dst_row = ring + (size_t)dst_width * 4 * num_taps_y;
+	int32_t *firsts_x = (int32_t *)(dst_row + (size_t)dst_width * 4);
+	int32_t *firsts_y = firsts_x + dst_width;
+	int32_t *ring_rows = firsts_y + dst_height;
+
+	opal_texelBuildWeights(filter, src_width, dst_width, num_taps_x, firsts_x, weights_x);
+	opal_texelBuildWeights(filter, src_height, dst_height, num_taps_y, firsts_y, weights_y);
+
+	for (uint32_t i = 0; i < num_taps_y; ++i)
+		ring_rows[i] = -1;
+
+	for (uint32_t y = 0; y < dst_height; ++y)
+	{
+		memset(dst_row, 0, sizeof(float) * dst_width * 4);
+
+		for (uint32_t ty = 0; ty < num_taps_y; ++ty)
+		{
+			float weight_y = weights_y[y * num_taps_y + ty];
+			if (weight_y == 0.0f)
+				continue;
+
+			uint32_t sy = opal_texelClampIndex(firsts_y[y] + (int32_t)ty, src_height);
+			uint32_t slot = sy % num_taps_y;
+			float *filtered_row = ring + (size_t)slot * dst_width * 4;
+
+			if (ring_rows[slot] != (int32_t)sy)
+			{
+				opal_texelDecodeRow(&codec, src_row, src_data + (uint64_t)sy * src_row_size, src_width);
+
+				for (uint32_t x = 0; x < dst_width; ++x)
+				{
+					const float *tap_weights = weights_x + x * num_taps_x;
+					float texel[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+
+					for (uint32_t tx = 0; tx < num_taps_x; ++tx)
+					{
+						const float *src_texel = src_row + opal_texelClampIndex(firsts_x[x] + (int32_t)tx, src_width) * 4;
+
+						for (uint32_t c = 0; c < 4; ++c)
+							texel[c] += src_texel[c] * tap_weights[tx];
+					}
+
+					memcpy(filtered_row + x * 4, texel, sizeof(texel));
+				}
+
+				ring_rows[slot] = (int32_t)sy;
+			}
+
+			for (uint32_t i = 0; i < dst_width * 4; ++i)
+				dst_row[i] += filtered_row[i] * weight_y;
+		}
+
+		opal_texelEncodeRow(&codec, dst_data + (uint64_t)y * dst_row_size, dst_row, dst_width);
+	}
+
+	free(memory);
+	return OPAL_SUCCESS;
+}
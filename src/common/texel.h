@@ -0,0 +1,25 @@
+#pragma once
+
+#include <opal.h>
+
+// note: host side texel work for upload paths. Conversions read and write tightly packed arrays,
+//       so they can target mapped staging memory directly. SIMD paths are picked at compile time
+//       (AVX2, F16C, SSE2 or NEON) and fall back to scalar code for tails and other targets.
+//       Exposed through the opalTexel* entry points in opal.h
+void opal_texelSwizzleRB(void *dst, const void *src, uint32_t num_texels);
+
+void opal_texelSrgbToLinear(float *dst, const uint8_t *src, uint32_t num_values);
+void opal_texelLinearToSrgb(uint8_t *dst, const float *src, uint32_t num_values);
+
+void opal_texelFloatToHalf(uint16_t *dst, const float *src, uint32_t num_values);
+void opal_texelHalfToFloat(float *dst, const uint16_t *src, uint32_t num_values);
+
+// note: packed formats read and write 4 floats per texel, alpha is ignored on pack and set to 1 on unpack
+void opal_texelPackRG11B10(uint32_t *dst, const float *src, uint32_t num_texels);
+void opal_texelUnpackRG11B10(float *dst, const uint32_t *src, uint32_t num_texels);
+void opal_texelPackRGB9E5(uint32_t *dst, const float *src, uint32_t num_texels);
+void opal_texelUnpackRGB9E5(float *dst, const uint32_t *src, uint32_t num_texels);
+
+// note: writes the next mip of a 2D image, max(size >> 1, 1) in each dimension. Unorm, snorm, srgb
+//       and float color formats are supported, srgb formats are filtered in linear space
+Opal_Result opal_texelDownsample(Opal_TextureFormat format, Opal_TexelFilter filter, uint32_t src_width, uint32_t src_height, uint32_t src_row_size, const void *src, uint32_t dst_row_size, void *dst);
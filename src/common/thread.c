@@ -0,0 +1,229 @@
+#include "thread.h"
+
+#include <assert.h>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+/*
+ */
+#if defined(_WIN32)
+static DWORD WINAPI opal_threadEntry(LPVOID parameter)
+{
+	Opal_Thread *thread = (Opal_Thread *)parameter;
+	thread->function(thread->user_data);
+
+	return 0;
+}
+#else
+static void *opal_threadEntry(void *parameter)
+{
+	Opal_Thread *thread = (Opal_Thread *)parameter;
+	thread->function(thread->user_data);
+
+	return NULL;
+}
+#endif
+
+/*
+ */
+Opal_Result opal_mutexInitialize(Opal_Mutex *mutex)
+{
+	assert(mutex);
+
+#if defined(_WIN32)
+	InitializeSRWLock((PSRWLOCK)&mutex->lock);
+#else
+	if (pthread_mutex_init(&mutex->mutex, NULL) != 0)
+		return OPAL_INTERNAL_ERROR;
+#endif
+
+	return OPAL_SUCCESS;
+}
+
+Opal_Result opal_mutexShutdown(Opal_Mutex *mutex)
+{
+	assert(mutex);
+
+#if !defined(_WIN32)
+	pthread_mutex_destroy(&mutex->mutex);
+#endif
+
+	return OPAL_SUCCESS;
+}
+
+void opal_mutexLock(Opal_Mutex *mutex)
+{
+	assert(mutex);
+
+#if defined(_WIN32)
+	AcquireSRWLockExclusive((PSRWLOCK)&mutex->lock);
+#else
+	pthread_mutex_lock(&mutex->mutex);
+#endif
+}
+
+void opal_mutexUnlock(Opal_Mutex *mutex)
+{
+	assert(mutex);
+
+#if defined(_WIN32)
+	ReleaseSRWLockExclusive((PSRWLOCK)&mutex->lock);
+#else
+	pthread_mutex_unlock(&mutex->mutex);
+#endif
+}
+
+/*
+ */
+Opal_Result opal_conditionInitialize(Opal_Condition *condition)
+{
+	assert(condition);
+
+#if defined(_WIN32)
+	InitializeConditionVariable((PCONDITION_VARIABLE)&condition->condition);
+#else
+	if (pthread_cond_init(&condition->condition, NULL) != 0)
+		return OPAL_INTERNAL_ERROR;
+#endif
+
+	return OPAL_SUCCESS;
+}
+
+Opal_Result opal_conditionShutdown(Opal_Condition *condition)
+{
+	assert(condition);
+
+#if !defined(_WIN32)
+	pthread_cond_destroy(&condition->condition);
+#endif
+
+	return OPAL_SUCCESS;
+}
+
+void opal_conditionWait(Opal_Condition *condition, Opal_Mutex *mutex)
+{
+	assert(condition);
+	assert(mutex);
+
+#if defined(_WIN32)
+	SleepConditionVariableSRW((PCONDITION_VARIABLE)&condition->condition, (PSRWLOCK)&mutex->lock, INFINITE, 0);
+#else
+	pthread_cond_wait(&condition->condition, &mutex->mutex);
+#endif
+}
+
+Opal_Result opal_conditionWaitTimeout(Opal_Condition *condition, Opal_Mutex *mutex, uint64_t timeout_milliseconds)
+{
+	assert(condition);
+	assert(mutex);
+
+#if defined(_WIN32)
+	DWORD milliseconds = (timeout_milliseconds >= INFINITE) ? INFINITE - 1 : (DWORD)timeout_milliseconds;
+	if (!SleepConditionVariableSRW((PCONDITION_VARIABLE)&condition->condition, (PSRWLOCK)&mutex->lock, milliseconds, 0))
+		return OPAL_WAIT_TIMEOUT;
+#else
+	struct timespec deadline;
+	clock_gettime(CLOCK_REALTIME, &deadline);
+
+	deadline.tv_sec += (time_t)(timeout_milliseconds / 1000);
+	deadline.tv_nsec += (long)(timeout_milliseconds % 1000) * 1000000L;
+
+	if (deadline.tv_nsec >= 1000000000L)
+	{
+		deadline.tv_sec++;
+		deadline.tv_nsec -= 1000000000L;
+	}
+
+	if (pthread_cond_timedwait(&condition->condition, &mutex->mutex, &deadline) == ETIMEDOUT)
+		return OPAL_WAIT_TIMEOUT;
+#endif
+
+	return OPAL_SUCCESS;
+}
+
+void opal_conditionSignal(Opal_Condition *condition)
+{
+	assert(condition);
+
+#if defined(_WIN32)
+	WakeConditionVariable((PCONDITION_VARIABLE)&condition->condition);
+#else
+	pthread_cond_signal(&condition->condition);
+#endif
+}
+
+void opal_conditionBroadcast(Opal_Condition *condition)
+{
+	assert(condition);
+
+#if defined(_WIN32)
+	WakeAllConditionVariable((PCONDITION_VARIABLE)&condition->condition);
+#else
+	pthread_cond_broadcast(&condition->condition);
+#endif
+}
+
+/*
+ */
+Opal_Result opal_threadCreate(Opal_Thread *thread, Opal_ThreadFunction function, void *user_data)
+{
+	assert(thread);
+	assert(function);
+
+	thread->function = function;
+	thread->user_data = user_data;
+
+#if defined(__EMSCRIPTEN__)
+	// note: threads need SharedArrayBuffer & -pthread, callers are expected to fall back to inline execution
+	return OPAL_NOT_SUPPORTED;
+#elif defined(_WIN32)
+	thread->handle = CreateThread(NULL, 0, opal_threadEntry, thread, 0, NULL);
+	if (thread->handle == NULL)
+		return OPAL_INTERNAL_ERROR;
+#else
+	if (pthread_create(&thread->thread, NULL, opal_threadEntry, thread) != 0)
+		return OPAL_INTERNAL_ERROR;
+#endif
+
+	return OPAL_SUCCESS;
+}
+
+Opal_Result opal_threadJoin(Opal_Thread *thread)
+{
+	assert(thread);
+
+#if defined(__EMSCRIPTEN__)
+	return OPAL_NOT_SUPPORTED;
+#elif defined(_WIN32)
+	WaitForSingleObject((HANDLE)thread->handle, INFINITE);
+	CloseHandle((HANDLE)thread->handle);
+#else
+	pthread_join(thread->thread, NULL);
+#endif
+
+	return OPAL_SUCCESS;
+}
+
+/*
+ */
+uint32_t opal_threadGetNumCores(void)
+{
+#if defined(__EMSCRIPTEN__)
+	return 1;
+#elif defined(_WIN32)
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+
+	return (uint32_t)info.dwNumberOfProcessors;
+#else
+	long count = sysconf(_SC_NPROCESSORS_ONLN);
+	return (count > 0) ? (uint32_t)count : 1;
+#endif
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <opal.h>
+
+#if !defined(_WIN32)
+#include <pthread.h>
+#endif
+
+typedef void (*Opal_ThreadFunction)(void *user_data);
+
+// note: on Windows these wrap SRWLOCK / CONDITION_VARIABLE / HANDLE which are all pointer sized,
+//       so windows.h doesn't leak into every file that includes this header
+typedef struct Opal_Mutex_t
+{
+#if defined(_WIN32)
+	void *lock;
+#else
+	pthread_mutex_t mutex;
+#endif
+} Opal_Mutex;
+
+typedef struct Opal_Condition_t
+{
+#if defined(_WIN32)
+	void *condition;
+#else
+	pthread_cond_t condition;
+#endif
+} Opal_Condition;
+
+typedef struct Opal_Thread_t
+{
+#if defined(_WIN32)
+	void *handle;
+#else
+	pthread_t thread;
+#endif
+	Opal_ThreadFunction function;
+	void *user_data;
+} Opal_Thread;
+
+Opal_Result opal_mutexInitialize(Opal_Mutex *mutex);
+Opal_Result opal_mutexShutdown(Opal_Mutex *mutex);
+void opal_mutexLock(Opal_Mutex *mutex);
+void opal_mutexUnlock(Opal_Mutex *mutex);
+
+Opal_Result opal_conditionInitialize(Opal_Condition *condition);
+Opal_Result opal_conditionShutdown(Opal_Condition *condition);
+void opal_conditionWait(Opal_Condition *condition, Opal_Mutex *mutex);
+Opal_Result opal_conditionWaitTimeout(Opal_Condition *condition, Opal_Mutex *mutex, uint64_t timeout_milliseconds);
+void opal_conditionSignal(Opal_Condition *condition);
+void opal_conditionBroadcast(Opal_Condition *condition);
+
+Opal_Result opal_threadCreate(Opal_Thread *thread, Opal_ThreadFunction function, void *user_data);
+Opal_Result opal_threadJoin(Opal_Thread *thread);
+
+uint32_t opal_threadGetNumCores(void);
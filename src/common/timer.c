@@ -0,0 +1,57 @@
+#include "timer.h"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#elif defined(__EMSCRIPTEN__)
+#include <emscripten.h>
+#else
+#include <time.h>
+#endif
+
+#define OPAL_TIMER_CALIBRATION_NANOSECONDS 2000000
+
+/*
+ */
+uint64_t opal_timerGetNanoseconds(void)
+{
+#if defined(_WIN32)
+	LARGE_INTEGER frequency;
+	LARGE_INTEGER counter;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&counter);
+
+	uint64_t seconds = counter.QuadPart / frequency.QuadPart;
+	uint64_t remainder = counter.QuadPart % frequency.QuadPart;
+
+	return seconds * 1000000000ULL + remainder * 1000000000ULL / frequency.QuadPart;
+#elif defined(__EMSCRIPTEN__)
+	return (uint64_t)(emscripten_get_now() * 1000000.0);
+#else
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+
+	return (uint64_t)time.tv_sec * 1000000000ULL + (uint64_t)time.tv_nsec;
+#endif
+}
+
+double opal_timerCalibrate(void)
+{
+	uint64_t begin_nanoseconds = opal_timerGetNanoseconds();
+	uint64_t begin_ticks = opal_timerGetTicks();
+
+	uint64_t end_nanoseconds = begin_nanoseconds;
+	uint64_t end_ticks = begin_ticks;
+
+	// note: busy wait is fine here, calibration happens once per profiler
+	while (end_nanoseconds - begin_nanoseconds < OPAL_TIMER_CALIBRATION_NANOSECONDS)
+	{
+		end_nanoseconds = opal_timerGetNanoseconds();
+		end_ticks = opal_timerGetTicks();
+	}
+
+	if (end_ticks == begin_ticks)
+		return 1.0;
+
+	return (double)(end_nanoseconds - begin_nanoseconds) / (double)(end_ticks - begin_ticks);
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <opal.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+uint64_t opal_timerGetNanoseconds(void);
+double opal_timerCalibrate(void);
+
+// note: raw cpu counter where available, falls back to the monotonic clock otherwise;
+//       use opal_timerCalibrate to convert ticks to nanoseconds
+static OPAL_INLINE uint64_t opal_timerGetTicks(void)
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	return __rdtsc();
+#elif defined(_MSC_VER) && defined(_M_ARM64)
+	return _ReadStatusReg(ARM64_CNTVCT);
+#elif defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#elif defined(__aarch64__)
+	uint64_t value = 0;
+	__asm__ volatile("mrs %0, cntvct_el0" : "=r"(value));
+	return value;
+#else
+	return opal_timerGetNanoseconds();
+#endif
+}
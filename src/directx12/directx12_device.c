@@ -1,16 +1,20 @@
 #include "directx12_internal.h"
 #include "common/intrinsics.h"
+#include "common/timer.h"
 
 #include <strsafe.h>
 #include <assert.h>
 
+#define DIRECTX12_COMPACTED_SIZES_PER_BUFFER 256
+
 /*
  */
-static Opal_Result directx12_deviceDestroyTextureView(Opal_Device this, Opal_TextureView texture_view);
-static Opal_Result directx12_deviceMapBuffer(Opal_Device this, Opal_Buffer buffer, void **ptr);
-static Opal_Result directx12_deviceUnmapBuffer(Opal_Device this, Opal_Buffer buffer);
-static Opal_Result directx12_deviceFreeDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set);
-static Opal_Result directx12_deviceUpdateDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set, uint32_t num_entries, const Opal_DescriptorSetEntry *entries);
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceDestroyTextureView(Opal_Device this, Opal_TextureView texture_view);
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceMapBuffer(Opal_Device this, Opal_Buffer buffer, void **ptr);
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceUnmapBuffer(Opal_Device this, Opal_Buffer buffer);
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceFreeDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set);
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceUpdateDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set, uint32_t num_entries, const Opal_DescriptorSetEntry *entries);
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdAccelerationStructureBuildBatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_descs, const Opal_AccelerationStructureBuildDesc *descs);
 
 /*
  */
@@ -283,6 +287,249 @@ static void directx12_destroyQueue(DirectX12_Device *device_ptr, DirectX12_Queue
 	ID3D12CommandQueue_Release(queue_ptr->queue);
 }
 
+static void directx12_cmdAccelerationStructureBuild(DirectX12_Device *device_ptr, DirectX12_CommandBuffer *command_buffer_ptr, const Opal_AccelerationStructureBuildDesc *desc)
+{
+	assert(device_ptr);
+	assert(command_buffer_ptr);
+	assert(desc);
+
+	DirectX12_AccelerationStructure *dst_acceleration_structure_ptr = (DirectX12_AccelerationStructure *)opal_poolGetElement(&device_ptr->acceleration_structures, (Opal_PoolHandle)desc->dst_acceleration_structure);
+	assert(dst_acceleration_structure_ptr);
+
+	dst_acceleration_structure_ptr->allow_compaction = (desc->build_flags & OPAL_ACCELERATION_STRUCTURE_BUILD_FLAGS_ALLOW_COMPACTION) != 0;
+
+	const DirectX12_AccelerationStructure *src_acceleration_structure_ptr = (DirectX12_AccelerationStructure *)opal_poolGetElement(&device_ptr->acceleration_structures, (Opal_PoolHandle)desc->src_acceleration_structure);
+
+	const DirectX12_Buffer *scratch_buffer_ptr = (DirectX12_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)desc->scratch_buffer.buffer);
+	assert(scratch_buffer_ptr);
+
+	D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_DESC build_desc = {0};
+
+	build_desc.Inputs.Type = directx12_helperToAccelerationStructureType(desc->type);
+	build_desc.Inputs.Flags = directx12_helperToAccelerationStructureBuildFlags(desc->build_flags);
+	build_desc.Inputs.DescsLayout = D3D12_ELEMENTS_LAYOUT_ARRAY;
+	build_desc.DestAccelerationStructureData = dst_acceleration_structure_ptr->address;
+	build_desc.ScratchAccelerationStructureData = scratch_buffer_ptr->address + desc->scratch_buffer.offset;
+
+	if (src_acceleration_structure_ptr)
+		build_desc.SourceAccelerationStructureData = src_acceleration_structure_ptr->address;
+
+	if (desc->type == OPAL_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL)
+	{
+		uint32_t num_geometries = desc->input.bottom_level.num_geometries;
+
+		opal_bumpReset(&device_ptr->bump);
+		uint32_t geometries_offset = opal_bumpAlloc(&device_ptr->bump, sizeof(D3D12_RAYTRACING_GEOMETRY_DESC) * num_geometries);
+
+		D3D12_RAYTRACING_GEOMETRY_DESC *geometries = (D3D12_RAYTRACING_GEOMETRY_DESC *)(device_ptr->bump.data + geometries_offset);
+		memset(geometries, 0, sizeof(D3D12_RAYTRACING_GEOMETRY_DESC) * num_geometries);
+
+		build_desc.Inputs.NumDescs = desc->input.bottom_level.num_geometries;
+		build_desc.Inputs.pGeometryDescs = geometries;
+
+		for (uint32_t j = 0; j < num_geometries; ++j)
+		{
+			const Opal_AccelerationStructureGeometry *opal_geometry = &desc->input.bottom_level.geometries[j];
+			D3D12_RAYTRACING_GEOMETRY_DESC *geometry = &geometries[j];
+
+			geometry->Type = directx12_helperToAccelerationStructureGeometryType(opal_geometry->type);
+			geometry->Flags = directx12_helperToAccelerationStructureGeometryFlags(opal_geometry->flags);
+
+			if (opal_geometry->type == OPAL_ACCELERATION_STRUCTURE_GEOMETRY_TYPE_TRIANGLES)
+			{
+				const Opal_AccelerationStructureGeometryDataTriangles *opal_triangles = &opal_geometry->data.triangles;
+				D3D12_RAYTRACING_GEOMETRY_TRIANGLES_DESC *triangles = &geometry->Triangles;
+
+				const DirectX12_Buffer *vertex_buffer_ptr = (DirectX12_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)opal_triangles->vertex_buffer.buffer);
+				assert(vertex_buffer_ptr);
+
+				const DirectX12_Buffer *index_buffer_ptr = (DirectX12_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)opal_triangles->index_buffer.buffer);
+
+				triangles->IndexFormat = directx12_helperToDXGIIndexFormat(opal_triangles->index_format);
+				triangles->VertexFormat = directx12_helperToDXGIVertexFormat(opal_triangles->vertex_format);
+				triangles->IndexCount = opal_triangles->num_indices;
+				triangles->VertexCount = opal_triangles->num_vertices;
+				triangles->VertexBuffer.StartAddress = vertex_buffer_ptr->address + opal_triangles->vertex_buffer.offset;
+				triangles->VertexBuffer.StrideInBytes = opal_triangles->vertex_stride;
+
+				if (index_buffer_ptr)
+					triangles->IndexBuffer = index_buffer_ptr->address + opal_triangles->index_buffer.offset;
+			}
+			else if (opal_geometry->type == OPAL_ACCELERATION_STRUCTURE_GEOMETRY_TYPE_AABBS)
+			{
+				const Opal_AccelerationStructureGeometryDataAABBs *opal_aabbs = &opal_geometry->data.aabbs;
+				D3D12_RAYTRACING_GEOMETRY_AABBS_DESC *aabbs = &geometry->AABBs;
+
+				const DirectX12_Buffer *entries_buffer_ptr = (DirectX12_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)opal_aabbs->entries_buffer.buffer);
+				assert(entries_buffer_ptr);
+
+				aabbs->AABBCount = opal_aabbs->num_entries;
+				aabbs->AABBs.StartAddress = entries_buffer_ptr->address + opal_aabbs->entries_buffer.offset;
+				aabbs->AABBs.StrideInBytes = opal_aabbs->stride;
+			}
+			else
+				assert(0);
+		}
+	}
+	else if (desc->type == OPAL_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL)
+	{
+		const Opal_AccelerationStructureBuildInputTopLevel *input = &desc->input.top_level;
+		const DirectX12_Buffer *instances_buffer_ptr = (DirectX12_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)input->instance_buffer.buffer);
+		assert(instances_buffer_ptr);
+
+		build_desc.Inputs.NumDescs = desc->input.top_level.num_instances;
+		build_desc.Inputs.InstanceDescs = instances_buffer_ptr->address + input->instance_buffer.offset;
+	}
+	else
+		assert(0);
+
+	ID3D12GraphicsCommandList6_BuildRaytracingAccelerationStructure(command_buffer_ptr->list, &build_desc, 0, NULL);
+}
+
+static uint64_t directx12_resolveInstanceAddress(void *device, Opal_AccelerationStructure blas)
+{
+	assert(device);
+
+	DirectX12_Device *device_ptr = (DirectX12_Device *)device;
+
+	DirectX12_AccelerationStructure *blas_ptr = (DirectX12_AccelerationStructure *)opal_poolGetElement(&device_ptr->acceleration_structures, (Opal_PoolHandle)blas);
+	assert(blas_ptr);
+
+	return blas_ptr->address;
+}
+
+static void directx12_cmdCopyBufferTextureRegions(DirectX12_CommandBuffer *command_buffer_ptr, DirectX12_Buffer *buffer_ptr, DirectX12_Texture *texture_ptr, uint32_t num_regions, const Opal_BufferTextureCopyRegion *regions, BOOL to_texture)
+{
+	assert(command_buffer_ptr);
+	assert(buffer_ptr);
+	assert(texture_ptr);
+	assert(num_regions == 0 || regions);
+
+	// note: D3D12 has no multi-region copy, so every layer of every region becomes one CopyTextureRegion call.
+	//       Footprints must cover whole blocks, hence the width and height round up
+	Opal_FormatBlockInfo block = opal_formatGetBlockInfo(texture_ptr->opal_format);
+
+	D3D12_TEXTURE_COPY_LOCATION buffer_location = {0};
+	buffer_location.pResource = buffer_ptr->buffer;
+	buffer_location.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
+	buffer_location.PlacedFootprint.Footprint.Format = texture_ptr->format;
+
+	D3D12_TEXTURE_COPY_LOCATION texture_location = {0};
+	texture_location.pResource = texture_ptr->texture;
+	texture_location.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+
+	for (uint32_t i = 0; i < num_regions; ++i)
+	{
+		const Opal_BufferTextureCopyRegion *region = &regions[i];
+		assert(region->layer_count > 0);
+
+		uint64_t slice_size = (uint64_t)region->row_size * region->num_rows * region->size.depth;
+
+		buffer_location.PlacedFootprint.Footprint.Width = (region->size.width + block.width - 1) / block.width * block.width;
+		buffer_location.PlacedFootprint.Footprint.Height = (region->size.height + block.height - 1) / block.height * block.height;
+		buffer_location.PlacedFootprint.Footprint.Depth = region->size.depth;
+		buffer_location.PlacedFootprint.Footprint.RowPitch = region->row_size;
+
+		for (uint32_t layer = 0; layer < region->layer_count; ++layer)
+		{
+			buffer_location.PlacedFootprint.Offset = region->buffer_offset + slice_size * layer;
+			texture_location.SubresourceIndex = region->mip + (region->base_layer + layer) * texture_ptr->mip_count;
+
+			if (to_texture)
+			{
+				ID3D12GraphicsCommandList6_CopyTextureRegion(
+					command_buffer_ptr->list,
+					&texture_location,
+					region->texture_offset.x,
+					region->texture_offset.y,
+					region->texture_offset.z,
+					&buffer_location,
+					NULL
+				);
+			}
+			else
+			{
+				D3D12_BOX texture_region = {0};
+				texture_region.left = region->texture_offset.x;
+				texture_region.top = region->texture_offset.y;
+				texture_region.front = region->texture_offset.z;
+				texture_region.right = texture_region.left + region->size.width;
+				texture_region.bottom = texture_region.top + region->size.height;
+				texture_region.back = texture_region.front + region->size.depth;
+
+				ID3D12GraphicsCommandList6_CopyTextureRegion(
+					command_buffer_ptr->list,
+					&buffer_location,
+					0,
+					0,
+					0,
+					&texture_location,
+					&texture_region
+				);
+			}
+		}
+	}
+}
+
+static void directx12_cmdWriteBufferImmediate(DirectX12_Device *device_ptr, DirectX12_CommandBuffer *command_buffer_ptr, D3D12_GPU_VIRTUAL_ADDRESS address, uint64_t size, uint32_t value, const uint32_t *data)
+{
+	assert(device_ptr);
+	assert(command_buffer_ptr);
+	assert((size & 3) == 0);
+
+	// note: every parameter writes a single dword, so large ranges are split into chunks to keep temp memory bounded
+	static const uint32_t max_parameters = 256;
+
+	uint32_t num_dwords = (uint32_t)(size / sizeof(uint32_t));
+	uint32_t chunk_size = min(num_dwords, max_parameters);
+
+	opal_bumpReset(&device_ptr->bump);
+	opal_bumpAlloc(&device_ptr->bump, sizeof(D3D12_WRITEBUFFERIMMEDIATE_PARAMETER) * chunk_size);
+
+	D3D12_WRITEBUFFERIMMEDIATE_PARAMETER *parameters = (D3D12_WRITEBUFFERIMMEDIATE_PARAMETER *)device_ptr->bump.data;
+
+	for (uint32_t offset = 0; offset < num_dwords; offset += chunk_size)
+	{
+		uint32_t count = min(num_dwords - offset, chunk_size);
+
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			parameters[i].Dest = address + (uint64_t)(offset + i) * sizeof(uint32_t);
+			parameters[i].Value = (data) ? data[offset + i] : value;
+		}
+
+		ID3D12GraphicsCommandList6_WriteBufferImmediate(command_buffer_ptr->list, count, parameters, NULL);
+	}
+}
+
+static void directx12_cmdTextureViewTransition(DirectX12_Device *device_ptr, DirectX12_CommandBuffer *command_buffer_ptr, const DirectX12_TextureView *texture_view_ptr, D3D12_RESOURCE_STATES state_before, D3D12_RESOURCE_STATES state_after)
+{
+	assert(device_ptr);
+	assert(command_buffer_ptr);
+	assert(texture_view_ptr);
+
+	if (state_before == state_after)
+		return;
+
+	opal_bumpReset(&device_ptr->bump);
+	opal_bumpAlloc(&device_ptr->bump, sizeof(D3D12_RESOURCE_BARRIER) * texture_view_ptr->num_subresources);
+
+	D3D12_RESOURCE_BARRIER *d3d12_barriers = (D3D12_RESOURCE_BARRIER *)(device_ptr->bump.data);
+	memset(d3d12_barriers, 0, sizeof(D3D12_RESOURCE_BARRIER) * texture_view_ptr->num_subresources);
+
+	for (uint32_t i = 0; i < texture_view_ptr->num_subresources; ++i)
+	{
+		D3D12_RESOURCE_BARRIER *d3d12_barrier = &d3d12_barriers[i];
+		d3d12_barrier->Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+		d3d12_barrier->Transition.StateBefore = state_before;
+		d3d12_barrier->Transition.StateAfter = state_after;
+		d3d12_barrier->Transition.pResource = texture_view_ptr->texture;
+		d3d12_barrier->Transition.Subresource = texture_view_ptr->subresource_index + i;
+	}
+
+	ID3D12GraphicsCommandList6_ResourceBarrier(command_buffer_ptr->list, texture_view_ptr->num_subresources, d3d12_barriers);
+}
+
 static void directx12_destroySemaphore(DirectX12_Device *device_ptr, DirectX12_Semaphore *semaphore_ptr)
 {
 	OPAL_UNUSED(device_ptr);
@@ -366,9 +613,13 @@ static void directx12_destroyCommandAllocator(DirectX12_Device *device_ptr, Dire
 
 static void directx12_destroyCommandBuffer(DirectX12_Device *device_ptr, DirectX12_CommandBuffer *command_buffer_ptr)
 {
-	OPAL_UNUSED(device_ptr);
+	assert(device_ptr);
 	assert(command_buffer_ptr);
 
+	for (uint32_t i = 0; i < command_buffer_ptr->num_compacted_size_buffers; ++i)
+		directx12_destroyBuffer(device_ptr, &command_buffer_ptr->compacted_size_buffers[i]);
+
+	free(command_buffer_ptr->compacted_size_buffers);
 	ID3D12GraphicsCommandList6_Release(command_buffer_ptr->list);
 }
 
@@ -486,12 +737,15 @@ static void directx12_destroySwapchain(DirectX12_Device *device_ptr, DirectX12_S
 
 	free(swapchain_ptr->texture_views);
 
+	if (swapchain_ptr->frame_latency_event)
+		CloseHandle(swapchain_ptr->frame_latency_event);
+
 	IDXGISwapChain3_Release(swapchain_ptr->swapchain);
 }
 
 /*
  */
-static Opal_Result directx12_deviceGetInfo(Opal_Device this, Opal_DeviceInfo *info)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceGetInfo(Opal_Device this, Opal_DeviceInfo *info)
 {
 	assert(this);
 	assert(info);
@@ -500,7 +754,7 @@ static Opal_Result directx12_deviceGetInfo(Opal_Device this, Opal_DeviceInfo *in
 	return directx12_helperFillDeviceInfo(ptr->adapter, ptr->device, info);
 }
 
-static Opal_Result directx12_deviceGetQueue(Opal_Device this, Opal_DeviceEngineType engine_type, uint32_t index, Opal_Queue *queue)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceGetQueue(Opal_Device this, Opal_DeviceEngineType engine_type, uint32_t index, Opal_Queue *queue)
 {
 	assert(this);
 	assert(queue);
@@ -519,7 +773,7 @@ static Opal_Result directx12_deviceGetQueue(Opal_Device this, Opal_DeviceEngineT
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceGetAccelerationStructurePrebuildInfo(Opal_Device this, const Opal_AccelerationStructureBuildDesc *desc, Opal_AccelerationStructurePrebuildInfo *info)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceGetAccelerationStructurePrebuildInfo(Opal_Device this, const Opal_AccelerationStructureBuildDesc *desc, Opal_AccelerationStructurePrebuildInfo *info)
 {
 	assert(this);
 	assert(desc);
@@ -600,7 +854,22 @@ static Opal_Result directx12_deviceGetAccelerationStructurePrebuildInfo(Opal_Dev
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceGetSupportedSurfaceFormats(Opal_Device this, Opal_Surface surface, uint32_t *num_formats, Opal_SurfaceFormat *formats)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceGetAccelerationStructureAddress(Opal_Device this, Opal_AccelerationStructure acceleration_structure, uint64_t *address)
+{
+	assert(this);
+	assert(acceleration_structure);
+	assert(address);
+
+	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
+
+	DirectX12_AccelerationStructure *acceleration_structure_ptr = (DirectX12_AccelerationStructure *)opal_poolGetElement(&device_ptr->acceleration_structures, (Opal_PoolHandle)acceleration_structure);
+	assert(acceleration_structure_ptr);
+
+	*address = acceleration_structure_ptr->address;
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceGetSupportedSurfaceFormats(Opal_Device this, Opal_Surface surface, uint32_t *num_formats, Opal_SurfaceFormat *formats)
 {
 	assert(this);
 	assert(surface);
@@ -624,7 +893,7 @@ static Opal_Result directx12_deviceGetSupportedSurfaceFormats(Opal_Device this,
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceGetSupportedPresentModes(Opal_Device this, Opal_Surface surface, uint32_t *num_present_modes, Opal_PresentMode *present_modes)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceGetSupportedPresentModes(Opal_Device this, Opal_Surface surface, uint32_t *num_present_modes, Opal_PresentMode *present_modes)
 {
 	assert(this);
 	assert(surface);
@@ -646,7 +915,7 @@ static Opal_Result directx12_deviceGetSupportedPresentModes(Opal_Device this, Op
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceGetPreferredSurfaceFormat(Opal_Device this, Opal_Surface surface, Opal_SurfaceFormat *format)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceGetPreferredSurfaceFormat(Opal_Device this, Opal_Surface surface, Opal_SurfaceFormat *format)
 {
 	assert(this);
 	assert(surface);
@@ -683,7 +952,7 @@ static Opal_Result directx12_deviceGetPreferredSurfaceFormat(Opal_Device this, O
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceGetPreferredSurfacePresentMode(Opal_Device this, Opal_Surface surface, Opal_PresentMode *present_mode)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceGetPreferredSurfacePresentMode(Opal_Device this, Opal_Surface surface, Opal_PresentMode *present_mode)
 {
 	assert(this);
 	assert(surface);
@@ -720,7 +989,7 @@ static Opal_Result directx12_deviceGetPreferredSurfacePresentMode(Opal_Device th
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCreateSemaphore(Opal_Device this, const Opal_SemaphoreDesc *desc, Opal_Semaphore *semaphore)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCreateSemaphore(Opal_Device this, const Opal_SemaphoreDesc *desc, Opal_Semaphore *semaphore)
 {
 	assert(this);
 	assert(desc);
@@ -744,7 +1013,7 @@ static Opal_Result directx12_deviceCreateSemaphore(Opal_Device this, const Opal_
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCreateFence(Opal_Device this, Opal_Fence *fence)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCreateFence(Opal_Device this, Opal_Fence *fence)
 {
 	assert(this);
 	assert(fence);
@@ -757,7 +1026,7 @@ static Opal_Result directx12_deviceCreateFence(Opal_Device this, Opal_Fence *fen
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCreateBuffer(Opal_Device this, const Opal_BufferDesc *desc, Opal_Buffer *buffer)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCreateBuffer(Opal_Device this, const Opal_BufferDesc *desc, Opal_Buffer *buffer)
 {
 	assert(this);
 	assert(desc);
@@ -798,7 +1067,7 @@ static Opal_Result directx12_deviceCreateBuffer(Opal_Device this, const Opal_Buf
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCreateTexture(Opal_Device this, const Opal_TextureDesc *desc, Opal_Texture *texture)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCreateTexture(Opal_Device this, const Opal_TextureDesc *desc, Opal_Texture *texture)
 {
 	assert(this);
 	assert(desc);
@@ -855,6 +1124,7 @@ static Opal_Result directx12_deviceCreateTexture(Opal_Device this, const Opal_Te
 	result.width = texture_info.Width;
 	result.height = texture_info.Height;
 	result.depth = (desc->type != OPAL_TEXTURE_TYPE_3D) ? texture_info.DepthOrArraySize : 1;
+	result.mip_count = texture_info.MipLevels;
 	result.samples = texture_info.SampleDesc.Count;
 	result.allocation = allocation;
 	result.usage = desc->usage;
@@ -864,7 +1134,7 @@ static Opal_Result directx12_deviceCreateTexture(Opal_Device this, const Opal_Te
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCreateTextureView(Opal_Device this, const Opal_TextureViewDesc *desc, Opal_TextureView *texture_view)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCreateTextureView(Opal_Device this, const Opal_TextureViewDesc *desc, Opal_TextureView *texture_view)
 {
 	assert(this);
 	assert(desc);
@@ -1046,7 +1316,7 @@ static Opal_Result directx12_deviceCreateTextureView(Opal_Device this, const Opa
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCreateSampler(Opal_Device this, const Opal_SamplerDesc *desc, Opal_Sampler *sampler)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCreateSampler(Opal_Device this, const Opal_SamplerDesc *desc, Opal_Sampler *sampler)
 {
 	assert(this);
 	assert(desc);
@@ -1054,6 +1324,13 @@ static Opal_Result directx12_deviceCreateSampler(Opal_Device this, const Opal_Sa
 
 	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
 
+	Opal_Sampler cached_sampler = (Opal_Sampler)opal_cacheAcquire(&device_ptr->sampler_cache, desc, sizeof(Opal_SamplerDesc));
+	if (cached_sampler != OPAL_NULL_HANDLE)
+	{
+		*sampler = cached_sampler;
+		return OPAL_SUCCESS;
+	}
+
 	// create opal struct
 	DirectX12_Sampler result = {0};
 	result.desc.Filter = directx12_helperToSamplerFilter(desc->min_filter, desc->mag_filter, desc->mip_filter);
@@ -1068,10 +1345,11 @@ static Opal_Result directx12_deviceCreateSampler(Opal_Device this, const Opal_Sa
 		result.desc.ComparisonFunc = directx12_helperToComparisonFunc(desc->compare_op);
 
 	*sampler = (Opal_Sampler)opal_poolAddElement(&device_ptr->samplers, &result);
+	opal_cacheInsert(&device_ptr->sampler_cache, desc, sizeof(Opal_SamplerDesc), *sampler);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCreateAccelerationStructure(Opal_Device this, const Opal_AccelerationStructureDesc *desc, Opal_AccelerationStructure *acceleration_structure)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCreateAccelerationStructure(Opal_Device this, const Opal_AccelerationStructureDesc *desc, Opal_AccelerationStructure *acceleration_structure)
 {
 	assert(this);
 	assert(desc);
@@ -1110,7 +1388,7 @@ static Opal_Result directx12_deviceCreateAccelerationStructure(Opal_Device this,
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCreateShaderBindingTable(Opal_Device this, Opal_RaytracePipeline pipeline, Opal_ShaderBindingTable *shader_binding_table)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCreateShaderBindingTable(Opal_Device this, Opal_RaytracePipeline pipeline, Opal_ShaderBindingTable *shader_binding_table)
 {
 	assert(this);
 	assert(pipeline);
@@ -1125,7 +1403,7 @@ static Opal_Result directx12_deviceCreateShaderBindingTable(Opal_Device this, Op
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCreateCommandAllocator(Opal_Device this, Opal_Queue queue, Opal_CommandAllocator *command_allocator)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCreateCommandAllocator(Opal_Device this, Opal_Queue queue, Opal_CommandAllocator *command_allocator)
 {
 	assert(this);
 	assert(queue);
@@ -1148,7 +1426,7 @@ static Opal_Result directx12_deviceCreateCommandAllocator(Opal_Device this, Opal
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCreateCommandBuffer(Opal_Device this, Opal_CommandAllocator command_allocator, Opal_CommandBuffer *command_buffer)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCreateCommandBuffer(Opal_Device this, Opal_CommandAllocator command_allocator, Opal_CommandBuffer *command_buffer)
 {
 	assert(this);
 	assert(command_allocator);
@@ -1178,6 +1456,7 @@ static Opal_Result directx12_deviceCreateCommandBuffer(Opal_Device this, Opal_Co
 	DirectX12_CommandBuffer result = {0};
 	result.list = d3d12_command_list;
 	result.allocator = command_allocator;
+	result.type = command_allocator_ptr->type;
 	result.recording = 0;
 
 	// TODO: add handle to DirectX12_CommandAllocator instance
@@ -1186,7 +1465,7 @@ static Opal_Result directx12_deviceCreateCommandBuffer(Opal_Device this, Opal_Co
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCreateShader(Opal_Device this, const Opal_ShaderDesc *desc, Opal_Shader *shader)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCreateShader(Opal_Device this, const Opal_ShaderDesc *desc, Opal_Shader *shader)
 {
 	assert(this);
 	assert(desc);
@@ -1195,17 +1474,30 @@ static Opal_Result directx12_deviceCreateShader(Opal_Device this, const Opal_Sha
 
 	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
 
+	Opal_CacheDigest digest = {0};
+	opal_cacheDigest(&digest, (uint32_t)desc->type, desc->data, desc->size);
+
+	Opal_Shader cached_shader = (Opal_Shader)opal_cacheAcquire(&device_ptr->shader_cache, &digest, sizeof(Opal_CacheDigest));
+	if (cached_shader != OPAL_NULL_HANDLE)
+	{
+		*shader = cached_shader;
+		return OPAL_SUCCESS;
+	}
+
 	DirectX12_Shader result = {0};
 	result.data = malloc(desc->size);
 	result.size = desc->size;
 
 	memcpy(result.data, desc->data, desc->size);
 
+	opal_compilerPause(&device_ptr->compiler);
 	*shader = (Opal_CommandAllocator)opal_poolAddElement(&device_ptr->shaders, &result);
+	opal_compilerResume(&device_ptr->compiler);
+	opal_cacheInsert(&device_ptr->shader_cache, &digest, sizeof(Opal_CacheDigest), *shader);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCreateDescriptorHeap(Opal_Device this, const Opal_DescriptorHeapDesc *desc, Opal_DescriptorHeap *descriptor_heap)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCreateDescriptorHeap(Opal_Device this, const Opal_DescriptorHeapDesc *desc, Opal_DescriptorHeap *descriptor_heap)
 {
 	assert(this);
 	assert(desc);
@@ -1258,7 +1550,7 @@ static Opal_Result directx12_deviceCreateDescriptorHeap(Opal_Device this, const
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCreateDescriptorSetLayout(Opal_Device this, uint32_t num_entries, const Opal_DescriptorSetLayoutEntry *entries, Opal_DescriptorSetLayout *descriptor_set_layout)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCreateDescriptorSetLayout(Opal_Device this, uint32_t num_entries, const Opal_DescriptorSetLayoutEntry *entries, Opal_DescriptorSetLayout *descriptor_set_layout)
 {
 	assert(this);
 	assert(num_entries == 0 || entries);
@@ -1267,6 +1559,15 @@ static Opal_Result directx12_deviceCreateDescriptorSetLayout(Opal_Device this, u
 	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
 	DirectX12_DescriptorSetLayout result = {0};
 
+	uint32_t entries_size = sizeof(Opal_DescriptorSetLayoutEntry) * num_entries;
+
+	Opal_DescriptorSetLayout cached_layout = (Opal_DescriptorSetLayout)opal_cacheAcquire(&device_ptr->descriptor_set_layout_cache, entries, entries_size);
+	if (cached_layout != OPAL_NULL_HANDLE)
+	{
+		*descriptor_set_layout = cached_layout;
+		return OPAL_SUCCESS;
+	}
+
 	for (uint32_t i = 0; i < num_entries; ++i)
 	{
 		switch (entries[i].type)
@@ -1421,11 +1722,14 @@ static Opal_Result directx12_deviceCreateDescriptorSetLayout(Opal_Device this, u
 	if (result.num_inline_descriptors > 0)
 		qsort(inline_descriptors, result.num_inline_descriptors, sizeof(DirectX12_DescriptorInfo), directx12_compareInlineDescriptors);
 
+	opal_compilerPause(&device_ptr->compiler);
 	*descriptor_set_layout = (Opal_DescriptorSetLayout)opal_poolAddElement(&device_ptr->descriptor_set_layouts, &result);
+	opal_compilerResume(&device_ptr->compiler);
+	opal_cacheInsert(&device_ptr->descriptor_set_layout_cache, entries, entries_size, *descriptor_set_layout);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCreatePipelineLayout(Opal_Device this, uint32_t num_descriptor_set_layouts, const Opal_DescriptorSetLayout *descriptor_set_layouts, Opal_PipelineLayout *pipeline_layout)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCreatePipelineLayout(Opal_Device this, uint32_t num_descriptor_set_layouts, const Opal_DescriptorSetLayout *descriptor_set_layouts, Opal_PipelineLayout *pipeline_layout)
 {
 	assert(this);
 	assert(pipeline_layout);
@@ -1434,6 +1738,15 @@ static Opal_Result directx12_deviceCreatePipelineLayout(Opal_Device this, uint32
 	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
 	ID3D12Device *d3d12_device = device_ptr->device;
 
+	uint32_t layouts_size = sizeof(Opal_DescriptorSetLayout) * num_descriptor_set_layouts;
+
+	Opal_PipelineLayout cached_layout = (Opal_PipelineLayout)opal_cacheAcquire(&device_ptr->pipeline_layout_cache, descriptor_set_layouts, layouts_size);
+	if (cached_layout != OPAL_NULL_HANDLE)
+	{
+		*pipeline_layout = cached_layout;
+		return OPAL_SUCCESS;
+	}
+
 	D3D12_ROOT_PARAMETER *parameters = NULL;
 	D3D12_DESCRIPTOR_RANGE *ranges = NULL;
 	uint32_t num_resource_descriptors = 0;
@@ -1688,17 +2001,23 @@ static Opal_Result directx12_deviceCreatePipelineLayout(Opal_Device this, uint32
 	result.num_inline_descriptors = num_inline_descriptors;
 	result.inline_offset = num_resource_tables + num_sampler_tables;
 
+	opal_compilerPause(&device_ptr->compiler);
 	*pipeline_layout = (Opal_DescriptorSetLayout)opal_poolAddElement(&device_ptr->pipeline_layouts, &result);
+	opal_compilerResume(&device_ptr->compiler);
+	opal_cacheInsert(&device_ptr->pipeline_layout_cache, descriptor_set_layouts, layouts_size, *pipeline_layout);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCreateGraphicsPipeline(Opal_Device this, const Opal_GraphicsPipelineDesc *desc, Opal_GraphicsPipeline *pipeline)
+static Opal_Result directx12_compileGraphicsPipeline(void *device, const void *data, Opal_Bump *bump, void *pipeline)
 {
-	assert(this);
-	assert(desc);
+	assert(device);
+	assert(data);
+	assert(bump);
 	assert(pipeline);
 
-	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
+	const Opal_GraphicsPipelineDesc *desc = (const Opal_GraphicsPipelineDesc *)data;
+
+	DirectX12_Device *device_ptr = (DirectX12_Device *)device;
 	ID3D12Device *d3d12_device = device_ptr->device;
 
 	D3D12_GRAPHICS_PIPELINE_STATE_DESC pipeline_info = {0};
@@ -1797,10 +2116,10 @@ static Opal_Result directx12_deviceCreateGraphicsPipeline(Opal_Device this, cons
 	for (uint32_t i = 0; i < desc->num_vertex_streams; ++i)
 		num_vertex_attributes += desc->vertex_streams[i].num_vertex_attributes;
 
-	opal_bumpReset(&device_ptr->bump);
-	uint32_t vertex_attributes_offset = opal_bumpAlloc(&device_ptr->bump, sizeof(D3D12_INPUT_ELEMENT_DESC) * num_vertex_attributes);
+	opal_bumpReset(bump);
+	uint32_t vertex_attributes_offset = opal_bumpAlloc(bump, sizeof(D3D12_INPUT_ELEMENT_DESC) * num_vertex_attributes);
 
-	D3D12_INPUT_ELEMENT_DESC *vertex_attributes = (D3D12_INPUT_ELEMENT_DESC *)(device_ptr->bump.data + vertex_attributes_offset);
+	D3D12_INPUT_ELEMENT_DESC *vertex_attributes = (D3D12_INPUT_ELEMENT_DESC *)(bump->data + vertex_attributes_offset);
 
 	uint32_t num_attributes = 0;
 	for (uint32_t i = 0; i < desc->num_vertex_streams; ++i)
@@ -1836,11 +2155,28 @@ static Opal_Result directx12_deviceCreateGraphicsPipeline(Opal_Device this, cons
 	result.pipeline_state = d3d12_pipeline_state;
 	result.primitive_topology = directx12_helperToPrimitiveTopology(desc->primitive_type);
 
-	*pipeline = (Opal_DescriptorSetLayout)opal_poolAddElement(&device_ptr->graphics_pipelines, &result);
+	*(DirectX12_GraphicsPipeline *)pipeline = result;
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCreateGraphicsPipeline(Opal_Device this, const Opal_GraphicsPipelineDesc *desc, Opal_GraphicsPipeline *pipeline)
+{
+	assert(this);
+	assert(desc);
+	assert(pipeline);
+
+	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
+	DirectX12_GraphicsPipeline result = {0};
+
+	Opal_Result opal_result = directx12_compileGraphicsPipeline(device_ptr, desc, &device_ptr->bump, &result);
+	if (opal_result != OPAL_SUCCESS)
+		return opal_result;
+
+	*pipeline = (Opal_GraphicsPipeline)opal_poolAddElement(&device_ptr->graphics_pipelines, &result);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCreateMeshletPipeline(Opal_Device this, const Opal_MeshletPipelineDesc *desc, Opal_GraphicsPipeline *pipeline)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCreateMeshletPipeline(Opal_Device this, const Opal_MeshletPipelineDesc *desc, Opal_GraphicsPipeline *pipeline)
 {
 	assert(this);
 	assert(desc);
@@ -2006,13 +2342,18 @@ static Opal_Result directx12_deviceCreateMeshletPipeline(Opal_Device this, const
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCreateComputePipeline(Opal_Device this, const Opal_ComputePipelineDesc *desc, Opal_ComputePipeline *pipeline)
+static Opal_Result directx12_compileComputePipeline(void *device, const void *data, Opal_Bump *bump, void *pipeline)
 {
-	assert(this);
-	assert(desc);
+	assert(device);
+	assert(data);
+	assert(bump);
 	assert(pipeline);
 
-	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
+	OPAL_UNUSED(bump);
+
+	const Opal_ComputePipelineDesc *desc = (const Opal_ComputePipelineDesc *)data;
+
+	DirectX12_Device *device_ptr = (DirectX12_Device *)device;
 	ID3D12Device *d3d12_device = device_ptr->device;
 
 	DirectX12_PipelineLayout *pipeline_layout_ptr = (DirectX12_PipelineLayout *)opal_poolGetElement(&device_ptr->pipeline_layouts, (Opal_PoolHandle)desc->pipeline_layout);
@@ -2034,17 +2375,37 @@ static Opal_Result directx12_deviceCreateComputePipeline(Opal_Device this, const
 	DirectX12_ComputePipeline result = {0};
 	result.pipeline_state = d3d12_pipeline_state;
 
-	*pipeline = (Opal_DescriptorSetLayout)opal_poolAddElement(&device_ptr->compute_pipelines, &result);
+	*(DirectX12_ComputePipeline *)pipeline = result;
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCreateRaytracePipeline(Opal_Device this, const Opal_RaytracePipelineDesc *desc, Opal_RaytracePipeline *pipeline)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCreateComputePipeline(Opal_Device this, const Opal_ComputePipelineDesc *desc, Opal_ComputePipeline *pipeline)
 {
 	assert(this);
 	assert(desc);
 	assert(pipeline);
 
 	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
+	DirectX12_ComputePipeline result = {0};
+
+	Opal_Result opal_result = directx12_compileComputePipeline(device_ptr, desc, &device_ptr->bump, &result);
+	if (opal_result != OPAL_SUCCESS)
+		return opal_result;
+
+	*pipeline = (Opal_ComputePipeline)opal_poolAddElement(&device_ptr->compute_pipelines, &result);
+	return OPAL_SUCCESS;
+}
+
+static Opal_Result directx12_compileRaytracePipeline(void *device, const void *data, Opal_Bump *bump, void *pipeline)
+{
+	assert(device);
+	assert(data);
+	assert(bump);
+	assert(pipeline);
+
+	const Opal_RaytracePipelineDesc *desc = (const Opal_RaytracePipelineDesc *)data;
+
+	DirectX12_Device *device_ptr = (DirectX12_Device *)device;
 	ID3D12Device *d3d12_device = device_ptr->device;
 
 	DirectX12_PipelineLayout *pipeline_layout_ptr = (DirectX12_PipelineLayout *)opal_poolGetElement(&device_ptr->pipeline_layouts, (Opal_PoolHandle)desc->pipeline_layout);
@@ -2072,9 +2433,9 @@ static Opal_Result directx12_deviceCreateRaytracePipeline(Opal_Device this, cons
 
 	uint32_t name_buffer_size = 0;
 
-	opal_bumpReset(&device_ptr->bump);
-	uint32_t name_lenghts_offset = opal_bumpAlloc(&device_ptr->bump, sizeof(int) * max_shaders);
-	int *name_lengths = (int *)(device_ptr->bump.data + name_lenghts_offset);
+	opal_bumpReset(bump);
+	uint32_t name_lenghts_offset = opal_bumpAlloc(bump, sizeof(int) * max_shaders);
+	int *name_lengths = (int *)(bump->data + name_lenghts_offset);
 
 	for (uint32_t i = 0; i < desc->num_raygen_functions; ++i)
 	{
@@ -2140,16 +2501,16 @@ static Opal_Result directx12_deviceCreateRaytracePipeline(Opal_Device this, cons
 		}
 	}
 
-	uint32_t names_offset = opal_bumpAlloc(&device_ptr->bump, sizeof(WCHAR) * name_buffer_size);
-	uint32_t subobjects_offset = opal_bumpAlloc(&device_ptr->bump, sizeof(D3D12_STATE_SUBOBJECT) * max_subobjects);
-	uint32_t shaders_offset = opal_bumpAlloc(&device_ptr->bump, sizeof(ShaderStage) * max_shaders);
-	uint32_t intersection_groups_offset = opal_bumpAlloc(&device_ptr->bump, sizeof(ShaderIntersectionGroupStage) * max_intersection_groups);
+	uint32_t names_offset = opal_bumpAlloc(bump, sizeof(WCHAR) * name_buffer_size);
+	uint32_t subobjects_offset = opal_bumpAlloc(bump, sizeof(D3D12_STATE_SUBOBJECT) * max_subobjects);
+	uint32_t shaders_offset = opal_bumpAlloc(bump, sizeof(ShaderStage) * max_shaders);
+	uint32_t intersection_groups_offset = opal_bumpAlloc(bump, sizeof(ShaderIntersectionGroupStage) * max_intersection_groups);
 
-	name_lengths = (int *)(device_ptr->bump.data + name_lenghts_offset);
-	WCHAR *names = (WCHAR *)(device_ptr->bump.data + names_offset);
-	D3D12_STATE_SUBOBJECT *subobjects = (D3D12_STATE_SUBOBJECT *)(device_ptr->bump.data + subobjects_offset);
-	ShaderStage *shaders = (ShaderStage *)(device_ptr->bump.data + shaders_offset);
-	ShaderIntersectionGroupStage *intersection_groups = (ShaderIntersectionGroupStage *)(device_ptr->bump.data + intersection_groups_offset);
+	name_lengths = (int *)(bump->data + name_lenghts_offset);
+	WCHAR *names = (WCHAR *)(bump->data + names_offset);
+	D3D12_STATE_SUBOBJECT *subobjects = (D3D12_STATE_SUBOBJECT *)(bump->data + subobjects_offset);
+	ShaderStage *shaders = (ShaderStage *)(bump->data + shaders_offset);
+	ShaderIntersectionGroupStage *intersection_groups = (ShaderIntersectionGroupStage *)(bump->data + intersection_groups_offset);
 
 	memset(names, 0, sizeof(WCHAR) * name_buffer_size);
 	memset(subobjects, 0, sizeof(D3D12_STATE_SUBOBJECT) * max_subobjects);
@@ -2393,28 +2754,96 @@ static Opal_Result directx12_deviceCreateRaytracePipeline(Opal_Device this, cons
 	result.num_miss_handles = desc->num_miss_functions;
 	result.shader_handles = handles;
 
-	*pipeline = (Opal_DescriptorSetLayout)opal_poolAddElement(&device_ptr->raytrace_pipelines, &result);
+	*(DirectX12_RaytracePipeline *)pipeline = result;
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCreateSwapchain(Opal_Device this, const Opal_SwapchainDesc *desc, Opal_Swapchain *swapchain)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCreateRaytracePipeline(Opal_Device this, const Opal_RaytracePipelineDesc *desc, Opal_RaytracePipeline *pipeline)
 {
 	assert(this);
 	assert(desc);
-	assert(desc->surface);
-	assert(swapchain);
+	assert(pipeline);
 
 	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
-	DirectX12_Instance *instance_ptr = device_ptr->instance;
+	DirectX12_RaytracePipeline result = {0};
 
-	IDXGIFactory2 *d3d12_factory = instance_ptr->factory;
+	Opal_Result opal_result = directx12_compileRaytracePipeline(device_ptr, desc, &device_ptr->bump, &result);
+	if (opal_result != OPAL_SUCCESS)
+		return opal_result;
 
-	// surface
-	DirectX12_Surface *surface_ptr = (DirectX12_Surface *)opal_poolGetElement(&instance_ptr->surfaces, (Opal_PoolHandle)desc->surface);
-	assert(surface_ptr);
+	*pipeline = (Opal_RaytracePipeline)opal_poolAddElement(&device_ptr->raytrace_pipelines, &result);
+	return OPAL_SUCCESS;
+}
 
-	// surface capabilities
-	uint32_t num_textures = (desc->mode == OPAL_PRESENT_MODE_MAILBOX) ? 3 : 2;
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCreateGraphicsPipelines(Opal_Device this, uint32_t num_pipelines, const Opal_GraphicsPipelineDesc *descs, Opal_GraphicsPipeline *pipelines)
+{
+	assert(this);
+
+	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
+	return opal_compilerRun(&device_ptr->compiler, directx12_compileGraphicsPipeline, &device_ptr->graphics_pipelines, num_pipelines, descs, sizeof(Opal_GraphicsPipelineDesc), pipelines);
+}
+
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCreateComputePipelines(Opal_Device this, uint32_t num_pipelines, const Opal_ComputePipelineDesc *descs, Opal_ComputePipeline *pipelines)
+{
+	assert(this);
+
+	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
+	return opal_compilerRun(&device_ptr->compiler, directx12_compileComputePipeline, &device_ptr->compute_pipelines, num_pipelines, descs, sizeof(Opal_ComputePipelineDesc), pipelines);
+}
+
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCreateRaytracePipelines(Opal_Device this, uint32_t num_pipelines, const Opal_RaytracePipelineDesc *descs, Opal_RaytracePipeline *pipelines)
+{
+	assert(this);
+
+	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
+	return opal_compilerRun(&device_ptr->compiler, directx12_compileRaytracePipeline, &device_ptr->raytrace_pipelines, num_pipelines, descs, sizeof(Opal_RaytracePipelineDesc), pipelines);
+}
+
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCreateGraphicsPipelinesAsync(Opal_Device this, uint32_t num_pipelines, const Opal_GraphicsPipelineDesc *descs, Opal_GraphicsPipeline *pipelines, Opal_PipelineTask *task)
+{
+	assert(this);
+	assert(task);
+
+	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
+	return opal_compilerSubmit(&device_ptr->compiler, directx12_compileGraphicsPipeline, &device_ptr->graphics_pipelines, num_pipelines, descs, sizeof(Opal_GraphicsPipelineDesc), pipelines, task);
+}
+
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCreateComputePipelinesAsync(Opal_Device this, uint32_t num_pipelines, const Opal_ComputePipelineDesc *descs, Opal_ComputePipeline *pipelines, Opal_PipelineTask *task)
+{
+	assert(this);
+	assert(task);
+
+	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
+	return opal_compilerSubmit(&device_ptr->compiler, directx12_compileComputePipeline, &device_ptr->compute_pipelines, num_pipelines, descs, sizeof(Opal_ComputePipelineDesc), pipelines, task);
+}
+
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCreateRaytracePipelinesAsync(Opal_Device this, uint32_t num_pipelines, const Opal_RaytracePipelineDesc *descs, Opal_RaytracePipeline *pipelines, Opal_PipelineTask *task)
+{
+	assert(this);
+	assert(task);
+
+	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
+	return opal_compilerSubmit(&device_ptr->compiler, directx12_compileRaytracePipeline, &device_ptr->raytrace_pipelines, num_pipelines, descs, sizeof(Opal_RaytracePipelineDesc), pipelines, task);
+}
+
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCreateSwapchain(Opal_Device this, const Opal_SwapchainDesc *desc, Opal_Swapchain *swapchain)
+{
+	assert(this);
+	assert(desc);
+	assert(desc->surface);
+	assert(swapchain);
+
+	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
+	DirectX12_Instance *instance_ptr = device_ptr->instance;
+
+	IDXGIFactory2 *d3d12_factory = instance_ptr->factory;
+
+	// surface
+	DirectX12_Surface *surface_ptr = (DirectX12_Surface *)opal_poolGetElement(&instance_ptr->surfaces, (Opal_PoolHandle)desc->surface);
+	assert(surface_ptr);
+
+	// surface capabilities
+	uint32_t num_textures = (desc->mode == OPAL_PRESENT_MODE_MAILBOX) ? 3 : 2;
 
 	// present queue
 	DirectX12_Queue *queue_ptr = (DirectX12_Queue *)opal_poolGetElement(&device_ptr->queues, (Opal_PoolHandle)desc->queue);
@@ -2425,6 +2854,10 @@ static Opal_Result directx12_deviceCreateSwapchain(Opal_Device this, const Opal_
 	if (desc->mode == OPAL_PRESENT_MODE_IMMEDIATE)
 		flags |= DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING;
 
+	// frame latency
+	if (desc->max_frames_in_flight > 0)
+		flags |= DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+
 	// surface format
 	DXGI_FORMAT format = directx12_helperToDXGITextureFormat(desc->format.texture_format);
 	if (format == DXGI_FORMAT_UNKNOWN)
@@ -2477,6 +2910,19 @@ static Opal_Result directx12_deviceCreateSwapchain(Opal_Device this, const Opal_
 		return OPAL_DIRECTX12_ERROR;
 	}
 
+	HANDLE frame_latency_event = NULL;
+	if (desc->max_frames_in_flight > 0)
+	{
+		hr = IDXGISwapChain3_SetMaximumFrameLatency(d3d12_swapchain3, min(desc->max_frames_in_flight, DXGI_MAX_SWAP_CHAIN_BUFFERS));
+		if (!SUCCEEDED(hr))
+		{
+			IDXGISwapChain3_Release(d3d12_swapchain3);
+			return OPAL_DIRECTX12_ERROR;
+		}
+
+		frame_latency_event = IDXGISwapChain3_GetFrameLatencyWaitableObject(d3d12_swapchain3);
+	}
+
 	Opal_TextureView *texture_views = (Opal_TextureView *)malloc(sizeof(Opal_TextureView) * num_textures);
 	memset(texture_views, OPAL_NULL_HANDLE, sizeof(Opal_PoolHandle) * num_textures);
 
@@ -2522,25 +2968,37 @@ static Opal_Result directx12_deviceCreateSwapchain(Opal_Device this, const Opal_
 			directx12_deviceDestroyTextureView(this, texture_views[i]);
 
 		free(texture_views);
+
+		if (frame_latency_event)
+			CloseHandle(frame_latency_event);
+
 		IDXGISwapChain3_Release(d3d12_swapchain3);
 		return OPAL_DIRECTX12_ERROR;
 	}
 
+	UINT present_count = 0;
+	IDXGISwapChain3_GetLastPresentCount(d3d12_swapchain3, &present_count);
+
 	// create opal struct
 	DirectX12_Swapchain result = {0};
 	result.swapchain = d3d12_swapchain3;
+	result.frame_latency_event = frame_latency_event;
 	result.texture_views = texture_views;
+	result.present_count_offset = present_count;
 	result.current_index = IDXGISwapChain3_GetCurrentBackBufferIndex(d3d12_swapchain3);
 	result.num_textures = num_textures;
 
 	if (desc->mode == OPAL_PRESENT_MODE_IMMEDIATE)
 		result.present_flags = DXGI_PRESENT_ALLOW_TEARING;
 
+	// note: dxgi throttles through the waitable object, so pacing only keeps the history
+	opal_pacingInitialize(&result.pacing, 0);
+
 	*swapchain = (Opal_Swapchain)opal_poolAddElement(&device_ptr->swapchains, &result);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceDestroySemaphore(Opal_Device this, Opal_Semaphore semaphore)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceDestroySemaphore(Opal_Device this, Opal_Semaphore semaphore)
 {
 	assert(this);
 	assert(semaphore);
@@ -2552,13 +3010,14 @@ static Opal_Result directx12_deviceDestroySemaphore(Opal_Device this, Opal_Semap
 	DirectX12_Semaphore *semaphore_ptr = (DirectX12_Semaphore *)opal_poolGetElement(&device_ptr->semaphores, handle);
 	assert(semaphore_ptr);
 
+	opal_notifierCancel(&device_ptr->notifier, (uint64_t)semaphore_ptr->fence);
 	opal_poolRemoveElement(&device_ptr->semaphores, handle);
 
 	directx12_destroySemaphore(device_ptr, semaphore_ptr);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceDestroyFence(Opal_Device this, Opal_Fence fence)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceDestroyFence(Opal_Device this, Opal_Fence fence)
 {
 	assert(this);
 	assert(fence);
@@ -2576,7 +3035,7 @@ static Opal_Result directx12_deviceDestroyFence(Opal_Device this, Opal_Fence fen
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceDestroyBuffer(Opal_Device this, Opal_Buffer buffer)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceDestroyBuffer(Opal_Device this, Opal_Buffer buffer)
 {
 	assert(this);
 	assert(buffer);
@@ -2594,7 +3053,7 @@ static Opal_Result directx12_deviceDestroyBuffer(Opal_Device this, Opal_Buffer b
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceDestroyTexture(Opal_Device this, Opal_Texture texture)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceDestroyTexture(Opal_Device this, Opal_Texture texture)
 {
 	assert(this);
 	assert(texture);
@@ -2612,7 +3071,7 @@ static Opal_Result directx12_deviceDestroyTexture(Opal_Device this, Opal_Texture
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceDestroyTextureView(Opal_Device this, Opal_TextureView texture_view)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceDestroyTextureView(Opal_Device this, Opal_TextureView texture_view)
 {
 	assert(this);
 	assert(texture_view);
@@ -2630,7 +3089,7 @@ static Opal_Result directx12_deviceDestroyTextureView(Opal_Device this, Opal_Tex
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceDestroySampler(Opal_Device this, Opal_Sampler sampler)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceDestroySampler(Opal_Device this, Opal_Sampler sampler)
 {
 	assert(this);
 	assert(sampler);
@@ -2639,6 +3098,9 @@ static Opal_Result directx12_deviceDestroySampler(Opal_Device this, Opal_Sampler
 	assert(handle != OPAL_POOL_HANDLE_NULL);
 
 	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
+	if (opal_cacheRelease(&device_ptr->sampler_cache, sampler) > 0)
+		return OPAL_SUCCESS;
+
 	DirectX12_Sampler *sampler_ptr = (DirectX12_Sampler *)opal_poolGetElement(&device_ptr->samplers, handle);
 	assert(sampler_ptr);
 
@@ -2648,7 +3110,7 @@ static Opal_Result directx12_deviceDestroySampler(Opal_Device this, Opal_Sampler
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceDestroyAccelerationStructure(Opal_Device this, Opal_AccelerationStructure acceleration_structure)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceDestroyAccelerationStructure(Opal_Device this, Opal_AccelerationStructure acceleration_structure)
 {
 	assert(this);
 	assert(acceleration_structure);
@@ -2666,7 +3128,7 @@ static Opal_Result directx12_deviceDestroyAccelerationStructure(Opal_Device this
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceDestroyShaderBindingTable(Opal_Device this, Opal_ShaderBindingTable shader_binding_table)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceDestroyShaderBindingTable(Opal_Device this, Opal_ShaderBindingTable shader_binding_table)
 {
 	assert(this);
 	assert(shader_binding_table);
@@ -2684,7 +3146,7 @@ static Opal_Result directx12_deviceDestroyShaderBindingTable(Opal_Device this, O
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceDestroyCommandAllocator(Opal_Device this, Opal_CommandAllocator command_allocator)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceDestroyCommandAllocator(Opal_Device this, Opal_CommandAllocator command_allocator)
 {
 	assert(this);
 	assert(command_allocator);
@@ -2704,7 +3166,7 @@ static Opal_Result directx12_deviceDestroyCommandAllocator(Opal_Device this, Opa
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceDestroyCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceDestroyCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
 {
 	assert(this);
 	assert(command_buffer);
@@ -2722,7 +3184,7 @@ static Opal_Result directx12_deviceDestroyCommandBuffer(Opal_Device this, Opal_C
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceDestroyShader(Opal_Device this, Opal_Shader shader)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceDestroyShader(Opal_Device this, Opal_Shader shader)
 {
 	assert(this);
 	assert(shader);
@@ -2731,6 +3193,9 @@ static Opal_Result directx12_deviceDestroyShader(Opal_Device this, Opal_Shader s
 	assert(handle != OPAL_POOL_HANDLE_NULL);
 
 	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
+	if (opal_cacheRelease(&device_ptr->shader_cache, shader) > 0)
+		return OPAL_SUCCESS;
+
 	DirectX12_Shader *shader_ptr = (DirectX12_Shader *)opal_poolGetElement(&device_ptr->shaders, handle);
 	assert(shader_ptr);
 
@@ -2740,7 +3205,7 @@ static Opal_Result directx12_deviceDestroyShader(Opal_Device this, Opal_Shader s
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceDestroyDescriptorHeap(Opal_Device this, Opal_DescriptorHeap descriptor_heap)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceDestroyDescriptorHeap(Opal_Device this, Opal_DescriptorHeap descriptor_heap)
 {
 	assert(this);
 	assert(descriptor_heap);
@@ -2758,7 +3223,7 @@ static Opal_Result directx12_deviceDestroyDescriptorHeap(Opal_Device this, Opal_
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceDestroyDescriptorSetLayout(Opal_Device this, Opal_DescriptorSetLayout descriptor_set_layout)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceDestroyDescriptorSetLayout(Opal_Device this, Opal_DescriptorSetLayout descriptor_set_layout)
 {
 	assert(this);
 	assert(descriptor_set_layout);
@@ -2767,6 +3232,12 @@ static Opal_Result directx12_deviceDestroyDescriptorSetLayout(Opal_Device this,
 	assert(handle != OPAL_POOL_HANDLE_NULL);
 
 	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
+	if (opal_cacheRelease(&device_ptr->descriptor_set_layout_cache, descriptor_set_layout) > 0)
+		return OPAL_SUCCESS;
+
+	// note: the handle can be reused for another layout from now on
+	opal_cacheEvict(&device_ptr->pipeline_layout_cache, descriptor_set_layout);
+
 	DirectX12_DescriptorSetLayout *descriptor_set_layout_ptr = (DirectX12_DescriptorSetLayout *)opal_poolGetElement(&device_ptr->descriptor_set_layouts, handle);
 	assert(descriptor_set_layout_ptr);
 
@@ -2776,7 +3247,7 @@ static Opal_Result directx12_deviceDestroyDescriptorSetLayout(Opal_Device this,
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceDestroyPipelineLayout(Opal_Device this, Opal_PipelineLayout pipeline_layout)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceDestroyPipelineLayout(Opal_Device this, Opal_PipelineLayout pipeline_layout)
 {
 	assert(this);
 	assert(pipeline_layout);
@@ -2785,6 +3256,9 @@ static Opal_Result directx12_deviceDestroyPipelineLayout(Opal_Device this, Opal_
 	assert(handle != OPAL_POOL_HANDLE_NULL);
 
 	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
+	if (opal_cacheRelease(&device_ptr->pipeline_layout_cache, pipeline_layout) > 0)
+		return OPAL_SUCCESS;
+
 	DirectX12_PipelineLayout *pipeline_layout_ptr = (DirectX12_PipelineLayout *)opal_poolGetElement(&device_ptr->pipeline_layouts, handle);
 	assert(pipeline_layout_ptr);
 
@@ -2794,7 +3268,7 @@ static Opal_Result directx12_deviceDestroyPipelineLayout(Opal_Device this, Opal_
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceDestroyGraphicsPipeline(Opal_Device this, Opal_GraphicsPipeline pipeline)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceDestroyGraphicsPipeline(Opal_Device this, Opal_GraphicsPipeline pipeline)
 {
 	assert(this);
 	assert(pipeline);
@@ -2812,7 +3286,7 @@ static Opal_Result directx12_deviceDestroyGraphicsPipeline(Opal_Device this, Opa
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceDestroyComputePipeline(Opal_Device this, Opal_ComputePipeline pipeline)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceDestroyComputePipeline(Opal_Device this, Opal_ComputePipeline pipeline)
 {
 	assert(this);
 	assert(pipeline);
@@ -2830,7 +3304,7 @@ static Opal_Result directx12_deviceDestroyComputePipeline(Opal_Device this, Opal
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceDestroyRaytracePipeline(Opal_Device this, Opal_RaytracePipeline pipeline)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceDestroyRaytracePipeline(Opal_Device this, Opal_RaytracePipeline pipeline)
 {
 	assert(this);
 	assert(pipeline);
@@ -2848,7 +3322,7 @@ static Opal_Result directx12_deviceDestroyRaytracePipeline(Opal_Device this, Opa
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceDestroySwapchain(Opal_Device this, Opal_Swapchain swapchain)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceDestroySwapchain(Opal_Device this, Opal_Swapchain swapchain)
 {
 	assert(this);
 	assert(swapchain);
@@ -2869,12 +3343,21 @@ static Opal_Result directx12_deviceDestroySwapchain(Opal_Device this, Opal_Swapc
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceDestroy(Opal_Device this)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceDestroy(Opal_Device this)
 {
 	assert(this);
 
 	DirectX12_Device *ptr = (DirectX12_Device *)this;
 
+	opal_instancePackerShutdown(&ptr->instance_packer);
+	opal_notifierShutdown(&ptr->notifier);
+	opal_compilerShutdown(&ptr->compiler);
+
+	opal_cacheShutdown(&ptr->pipeline_layout_cache);
+	opal_cacheShutdown(&ptr->descriptor_set_layout_cache);
+	opal_cacheShutdown(&ptr->sampler_cache);
+	opal_cacheShutdown(&ptr->shader_cache);
+
 	{
 		uint32_t head = opal_poolGetHeadIndex(&ptr->swapchains);
 		while (head != OPAL_POOL_HANDLE_NULL)
@@ -3139,6 +3622,7 @@ static Opal_Result directx12_deviceDestroy(Opal_Device this)
 		free(ptr->queue_handles[i]);
 
 	opal_bumpShutdown(&ptr->bump);
+	opal_buildBatchShutdown(&ptr->build_batch);
 
 	directx12_destroyFramebufferDescriptorHeap(ptr, &ptr->framebuffer_descriptor_heap);
 
@@ -3154,7 +3638,7 @@ static Opal_Result directx12_deviceDestroy(Opal_Device this)
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceBuildShaderBindingTable(Opal_Device this, Opal_ShaderBindingTable shader_binding_table, const Opal_ShaderBindingTableBuildDesc *desc)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceBuildShaderBindingTable(Opal_Device this, Opal_ShaderBindingTable shader_binding_table, const Opal_ShaderBindingTableBuildDesc *desc)
 {
 	assert(this);
 	assert(desc);
@@ -3276,7 +3760,7 @@ static Opal_Result directx12_deviceBuildShaderBindingTable(Opal_Device this, Opa
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceBuildAccelerationStructureInstanceBuffer(Opal_Device this, const Opal_AccelerationStructureInstanceBufferBuildDesc *desc)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceBuildAccelerationStructureInstanceBuffer(Opal_Device this, const Opal_AccelerationStructureInstanceBufferBuildDesc *desc)
 {
 	assert(this);
 	assert(desc);
@@ -3290,28 +3774,12 @@ static Opal_Result directx12_deviceBuildAccelerationStructureInstanceBuffer(Opal
 
 	uint8_t *dst_data = (uint8_t *)ptr + desc->buffer.offset;
 
-	for (uint32_t i = 0; i < desc->num_instances; ++i)
-	{
-		const Opal_AccelerationStructureInstance *opal_instance = &desc->instances[i];
-		D3D12_RAYTRACING_INSTANCE_DESC *d3d12_instance = (D3D12_RAYTRACING_INSTANCE_DESC *)dst_data;
-
-		DirectX12_AccelerationStructure *blas_ptr = (DirectX12_AccelerationStructure *)opal_poolGetElement(&device_ptr->acceleration_structures, (Opal_PoolHandle)opal_instance->blas);
-		assert(blas_ptr);
-
-		memcpy(&d3d12_instance->Transform, opal_instance->transform, sizeof(FLOAT) * 12);
-		d3d12_instance->InstanceID = opal_instance->custom_index;
-		d3d12_instance->InstanceMask = opal_instance->mask;
-		d3d12_instance->InstanceContributionToHitGroupIndex = opal_instance->intersection_index_offset;
-		d3d12_instance->Flags = directx12_helperToAccelerationStructureInstanceFlags(opal_instance->flags);
-		d3d12_instance->AccelerationStructure = blas_ptr->address;
-
-		dst_data += sizeof(D3D12_RAYTRACING_INSTANCE_DESC);
-	}
+	opal_instancePackerRun(&device_ptr->instance_packer, dst_data, desc->num_instances, desc->instances, desc->blas_addresses, directx12_resolveInstanceAddress);
 
 	return directx12_deviceUnmapBuffer(this, desc->buffer.buffer);
 }
 
-static Opal_Result directx12_deviceResetCommandAllocator(Opal_Device this, Opal_CommandAllocator command_allocator)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceResetCommandAllocator(Opal_Device this, Opal_CommandAllocator command_allocator)
 {
 	assert(this);
 	assert(command_allocator);
@@ -3330,7 +3798,7 @@ static Opal_Result directx12_deviceResetCommandAllocator(Opal_Device this, Opal_
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceAllocateDescriptorSet(Opal_Device this, const Opal_DescriptorSetAllocationDesc *desc, Opal_DescriptorSet *descriptor_set)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceAllocateDescriptorSet(Opal_Device this, const Opal_DescriptorSetAllocationDesc *desc, Opal_DescriptorSet *descriptor_set)
 {
 	assert(this);
 	assert(desc);
@@ -3405,7 +3873,7 @@ static Opal_Result directx12_deviceAllocateDescriptorSet(Opal_Device this, const
 	return opal_result;
 }
 
-static Opal_Result directx12_deviceFreeDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceFreeDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set)
 {
 	assert(this);
 	assert(descriptor_set);
@@ -3421,7 +3889,7 @@ static Opal_Result directx12_deviceFreeDescriptorSet(Opal_Device this, Opal_Desc
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceMapBuffer(Opal_Device this, Opal_Buffer buffer, void **ptr)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceMapBuffer(Opal_Device this, Opal_Buffer buffer, void **ptr)
 {
 	assert(this);
 	assert(buffer);
@@ -3438,7 +3906,7 @@ static Opal_Result directx12_deviceMapBuffer(Opal_Device this, Opal_Buffer buffe
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceUnmapBuffer(Opal_Device this, Opal_Buffer buffer)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceUnmapBuffer(Opal_Device this, Opal_Buffer buffer)
 {
 	assert(this);
 	assert(buffer);
@@ -3451,7 +3919,7 @@ static Opal_Result directx12_deviceUnmapBuffer(Opal_Device this, Opal_Buffer buf
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceWriteBuffer(Opal_Device this, Opal_Buffer buffer, uint64_t offset, const void *data, uint64_t size)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceWriteBuffer(Opal_Device this, Opal_Buffer buffer, uint64_t offset, const void *data, uint64_t size)
 {
 	assert(this);
 	assert(buffer);
@@ -3468,7 +3936,7 @@ static Opal_Result directx12_deviceWriteBuffer(Opal_Device this, Opal_Buffer buf
 	return directx12_deviceUnmapBuffer(this, buffer);
 }
 
-static Opal_Result directx12_deviceUpdateDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set, uint32_t num_entries, const Opal_DescriptorSetEntry *entries)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceUpdateDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set, uint32_t num_entries, const Opal_DescriptorSetEntry *entries)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(descriptor_set);
@@ -3724,7 +4192,7 @@ static Opal_Result directx12_deviceUpdateDescriptorSet(Opal_Device this, Opal_De
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceBeginCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceBeginCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
 {
 	assert(this);
 	assert(command_buffer);
@@ -3746,10 +4214,11 @@ static Opal_Result directx12_deviceBeginCommandBuffer(Opal_Device this, Opal_Com
 
 	command_buffer_ptr->recording = 1;
 	command_buffer_ptr->pipeline_layout = OPAL_NULL_HANDLE;
+	command_buffer_ptr->num_compacted_sizes = 0;
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceEndCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceEndCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
 {
 	assert(this);
 	assert(command_buffer);
@@ -3771,7 +4240,7 @@ static Opal_Result directx12_deviceEndCommandBuffer(Opal_Device this, Opal_Comma
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceQuerySemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t *value)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceQuerySemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t *value)
 {
 	assert(this);
 	assert(semaphore);
@@ -3786,7 +4255,7 @@ static Opal_Result directx12_deviceQuerySemaphore(Opal_Device this, Opal_Semapho
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceSignalSemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t value)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceSignalSemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t value)
 {
 	assert(this);
 	assert(semaphore);
@@ -3803,7 +4272,7 @@ static Opal_Result directx12_deviceSignalSemaphore(Opal_Device this, Opal_Semaph
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceWaitSemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t value, uint64_t timeout_milliseconds)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceWaitSemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t value, uint64_t timeout_milliseconds)
 {
 	assert(this);
 	assert(semaphore);
@@ -3827,7 +4296,83 @@ static Opal_Result directx12_deviceWaitSemaphore(Opal_Device this, Opal_Semaphor
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceWaitQueue(Opal_Device this, Opal_Queue queue)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceWaitSemaphores(Opal_Device this, uint32_t num_semaphores, const Opal_Semaphore *semaphores, const uint64_t *values, uint32_t wait_any, uint64_t timeout_milliseconds)
+{
+	assert(this);
+	assert(num_semaphores > 0);
+	assert(semaphores);
+	assert(values);
+
+	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
+	ID3D12Device *d3d12_device = device_ptr->device;
+
+	opal_bumpReset(&device_ptr->bump);
+	opal_bumpAlloc(&device_ptr->bump, sizeof(ID3D12Fence *) * num_semaphores);
+
+	ID3D12Fence **d3d12_fences = (ID3D12Fence **)(device_ptr->bump.data);
+
+	for (uint32_t i = 0; i < num_semaphores; ++i)
+	{
+		DirectX12_Semaphore *semaphore_ptr = (DirectX12_Semaphore *)opal_poolGetElement(&device_ptr->semaphores, (Opal_PoolHandle)semaphores[i]);
+		assert(semaphore_ptr);
+
+		d3d12_fences[i] = semaphore_ptr->fence;
+	}
+
+	ID3D12Device1 *d3d12_device1 = NULL;
+	HRESULT hr = ID3D12Device_QueryInterface(d3d12_device, &IID_ID3D12Device1, &d3d12_device1);
+	if (!SUCCEEDED(hr))
+		return OPAL_DIRECTX12_ERROR;
+
+	// note: per-semaphore events can't be used here, an event left signaled by a timed out
+	//       multiple fence wait would wake up the next single semaphore wait too early
+	HANDLE event = CreateEventEx(NULL, FALSE, FALSE, EVENT_ALL_ACCESS);
+	D3D12_MULTIPLE_FENCE_WAIT_FLAGS flags = (wait_any) ? D3D12_MULTIPLE_FENCE_WAIT_FLAG_ANY : D3D12_MULTIPLE_FENCE_WAIT_FLAG_ALL;
+
+	hr = ID3D12Device1_SetEventOnMultipleFenceCompletion(d3d12_device1, d3d12_fences, values, num_semaphores, flags, event);
+	ID3D12Device1_Release(d3d12_device1);
+
+	if (!SUCCEEDED(hr))
+	{
+		CloseHandle(event);
+		return OPAL_DIRECTX12_ERROR;
+	}
+
+	DWORD wait_result = WaitForSingleObjectEx(event, (DWORD)timeout_milliseconds, FALSE);
+	CloseHandle(event);
+
+	if (wait_result == WAIT_TIMEOUT)
+		return OPAL_WAIT_TIMEOUT;
+
+	if (wait_result != WAIT_OBJECT_0)
+		return OPAL_DIRECTX12_ERROR;
+
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceRegisterSemaphoreCallback(Opal_Device this, Opal_Semaphore semaphore, uint64_t value, PFN_opalSemaphoreCallback callback, void *user_data)
+{
+	assert(this);
+	assert(semaphore);
+	assert(callback);
+
+	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
+
+	DirectX12_Semaphore *semaphore_ptr = (DirectX12_Semaphore *)opal_poolGetElement(&device_ptr->semaphores, (Opal_PoolHandle)semaphore);
+	assert(semaphore_ptr);
+
+	return opal_notifierRegister(&device_ptr->notifier, semaphore, (uint64_t)semaphore_ptr->fence, value, callback, user_data);
+}
+
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceWaitPipelineTask(Opal_Device this, Opal_PipelineTask task, uint64_t timeout_milliseconds)
+{
+	assert(this);
+
+	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
+	return opal_compilerWait(&device_ptr->compiler, task, timeout_milliseconds);
+}
+
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceWaitQueue(Opal_Device this, Opal_Queue queue)
 {
 	assert(this);
 	assert(queue);
@@ -3845,7 +4390,7 @@ static Opal_Result directx12_deviceWaitQueue(Opal_Device this, Opal_Queue queue)
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceWaitIdle(Opal_Device this)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceWaitIdle(Opal_Device this)
 {
 	assert(this);
 	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
@@ -3862,7 +4407,7 @@ static Opal_Result directx12_deviceWaitIdle(Opal_Device this)
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceSubmit(Opal_Device this, Opal_Queue queue, const Opal_SubmitDesc *desc)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceSubmit(Opal_Device this, Opal_Queue queue, const Opal_SubmitDesc *desc)
 {
 	assert(this);
 	assert(queue);
@@ -3909,10 +4454,18 @@ static Opal_Result directx12_deviceSubmit(Opal_Device this, Opal_Queue queue, co
 		ID3D12CommandQueue_Signal(queue_ptr->queue, semaphore_ptr->fence, desc->signal_values[i]);
 	}
 
+	for (uint32_t i = 0; i < desc->num_signal_swapchains; ++i)
+	{
+		DirectX12_Swapchain *swapchain_ptr = (DirectX12_Swapchain *)opal_poolGetElement(&device_ptr->swapchains, (Opal_PoolHandle)desc->signal_swapchains[i]);
+		assert(swapchain_ptr);
+
+		opal_pacingSubmit(&swapchain_ptr->pacing, opal_timerGetNanoseconds());
+	}
+
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceAcquire(Opal_Device this, Opal_Swapchain swapchain, Opal_TextureView *texture_view)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceAcquire(Opal_Device this, Opal_Swapchain swapchain, Opal_TextureView *texture_view)
 {
 	assert(this);
 	assert(swapchain);
@@ -3924,11 +4477,21 @@ static Opal_Result directx12_deviceAcquire(Opal_Device this, Opal_Swapchain swap
 	assert(swapchain_ptr);
 	assert(swapchain_ptr->current_index < swapchain_ptr->num_textures);
 
+	// note: blocks until the number of queued presents drops below the frame latency limit
+	if (swapchain_ptr->frame_latency_event)
+	{
+		DWORD wait_result = WaitForSingleObjectEx(swapchain_ptr->frame_latency_event, INFINITE, FALSE);
+		if (wait_result != WAIT_OBJECT_0)
+			return OPAL_DIRECTX12_ERROR;
+	}
+
 	*texture_view = swapchain_ptr->texture_views[swapchain_ptr->current_index];
+
+	opal_pacingAcquire(&swapchain_ptr->pacing, opal_timerGetNanoseconds());
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_devicePresent(Opal_Device this, Opal_Swapchain swapchain)
+OPAL_BACKEND_STATIC Opal_Result directx12_devicePresent(Opal_Device this, Opal_Swapchain swapchain)
 {
 	assert(this);
 	assert(swapchain);
@@ -3944,10 +4507,53 @@ static Opal_Result directx12_devicePresent(Opal_Device this, Opal_Swapchain swap
 
 	swapchain_ptr->current_index = IDXGISwapChain3_GetCurrentBackBufferIndex(swapchain_ptr->swapchain);
 
+	opal_pacingPresent(&swapchain_ptr->pacing, opal_timerGetNanoseconds());
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceWaitPresent(Opal_Device this, Opal_Swapchain swapchain, uint64_t frame_id, uint64_t timeout_milliseconds)
+{
+	OPAL_UNUSED(this);
+	OPAL_UNUSED(swapchain);
+	OPAL_UNUSED(frame_id);
+	OPAL_UNUSED(timeout_milliseconds);
+
+	return OPAL_NOT_SUPPORTED;
+}
+
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceGetSwapchainFrameTiming(Opal_Device this, Opal_Swapchain swapchain, Opal_FrameTiming *timing)
+{
+	assert(this);
+	assert(swapchain);
+	assert(timing);
+
+	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
+
+	DirectX12_Swapchain *swapchain_ptr = (DirectX12_Swapchain *)opal_poolGetElement(&device_ptr->swapchains, (Opal_PoolHandle)swapchain);
+	assert(swapchain_ptr);
+
+	// note: statistics are unavailable for a while after creation or mode changes (disjoint),
+	//       timings simply stay without display time in that case
+	DXGI_FRAME_STATISTICS statistics = {0};
+	HRESULT hr = IDXGISwapChain3_GetFrameStatistics(swapchain_ptr->swapchain, &statistics);
+	if (SUCCEEDED(hr) && statistics.PresentCount > swapchain_ptr->present_count_offset && statistics.SyncQPCTime.QuadPart > 0)
+	{
+		LARGE_INTEGER frequency;
+		QueryPerformanceFrequency(&frequency);
+
+		uint64_t seconds = statistics.SyncQPCTime.QuadPart / frequency.QuadPart;
+		uint64_t remainder = statistics.SyncQPCTime.QuadPart % frequency.QuadPart;
+		uint64_t display_time = seconds * 1000000000ULL + remainder * 1000000000ULL / frequency.QuadPart;
+
+		uint64_t frame_id = statistics.PresentCount - swapchain_ptr->present_count_offset;
+		opal_pacingDisplay(&swapchain_ptr->pacing, frame_id, display_time);
+	}
+
+	opal_pacingGetTiming(&swapchain_ptr->pacing, timing);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdSetDescriptorHeap(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_DescriptorHeap descriptor_heap)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdSetDescriptorHeap(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_DescriptorHeap descriptor_heap)
 {
 	assert(this);
 	assert(command_buffer);
@@ -3972,7 +4578,7 @@ static Opal_Result directx12_deviceCmdSetDescriptorHeap(Opal_Device this, Opal_C
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdBeginGraphicsPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_FramebufferDesc *framebuffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdBeginGraphicsPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_FramebufferDesc *framebuffer, const Opal_PassBarriersDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4103,7 +4709,7 @@ static Opal_Result directx12_deviceCmdBeginGraphicsPass(Opal_Device this, Opal_C
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdGraphicsSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdGraphicsSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4125,7 +4731,7 @@ static Opal_Result directx12_deviceCmdGraphicsSetPipelineLayout(Opal_Device this
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdGraphicsSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_GraphicsPipeline pipeline)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdGraphicsSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_GraphicsPipeline pipeline)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4148,7 +4754,7 @@ static Opal_Result directx12_deviceCmdGraphicsSetPipeline(Opal_Device this, Opal
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdGraphicsSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdGraphicsSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4251,7 +4857,7 @@ static Opal_Result directx12_deviceCmdGraphicsSetDescriptorSet(Opal_Device this,
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdGraphicsSetVertexBuffers(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t first_index, uint32_t num_vertex_buffers, const Opal_VertexBufferView *vertex_buffers)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdGraphicsSetVertexBuffers(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t first_index, uint32_t num_vertex_buffers, const Opal_VertexBufferView *vertex_buffers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4283,7 +4889,7 @@ static Opal_Result directx12_deviceCmdGraphicsSetVertexBuffers(Opal_Device this,
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdGraphicsSetIndexBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_IndexBufferView index_buffer)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdGraphicsSetIndexBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_IndexBufferView index_buffer)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4307,7 +4913,7 @@ static Opal_Result directx12_deviceCmdGraphicsSetIndexBuffer(Opal_Device this, O
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdGraphicsSetViewport(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Viewport viewport)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdGraphicsSetViewport(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Viewport viewport)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4330,7 +4936,7 @@ static Opal_Result directx12_deviceCmdGraphicsSetViewport(Opal_Device this, Opal
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdGraphicsSetScissor(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdGraphicsSetScissor(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4351,7 +4957,7 @@ static Opal_Result directx12_deviceCmdGraphicsSetScissor(Opal_Device this, Opal_
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdGraphicsDraw(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_vertices, uint32_t num_instances, uint32_t base_vertex, uint32_t base_instance)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdGraphicsDraw(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_vertices, uint32_t num_instances, uint32_t base_vertex, uint32_t base_instance)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4366,7 +4972,7 @@ static Opal_Result directx12_deviceCmdGraphicsDraw(Opal_Device this, Opal_Comman
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdGraphicsDrawIndexed(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_indices, uint32_t num_instances, uint32_t base_index, int32_t vertex_offset, uint32_t base_instance)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdGraphicsDrawIndexed(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_indices, uint32_t num_instances, uint32_t base_index, int32_t vertex_offset, uint32_t base_instance)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4381,7 +4987,7 @@ static Opal_Result directx12_deviceCmdGraphicsDrawIndexed(Opal_Device this, Opal
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdGraphicsMeshletDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_threadgroups_x, uint32_t num_threadgroups_y, uint32_t num_threadgroups_z)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdGraphicsMeshletDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_threadgroups_x, uint32_t num_threadgroups_y, uint32_t num_threadgroups_z)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4395,7 +5001,7 @@ static Opal_Result directx12_deviceCmdGraphicsMeshletDispatch(Opal_Device this,
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdEndGraphicsPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdEndGraphicsPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4415,7 +5021,7 @@ static Opal_Result directx12_deviceCmdEndGraphicsPass(Opal_Device this, Opal_Com
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdBeginComputePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdBeginComputePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4432,7 +5038,7 @@ static Opal_Result directx12_deviceCmdBeginComputePass(Opal_Device this, Opal_Co
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdComputeSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdComputeSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4455,7 +5061,7 @@ static Opal_Result directx12_deviceCmdComputeSetPipelineLayout(Opal_Device this,
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdComputeSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_ComputePipeline pipeline)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdComputeSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_ComputePipeline pipeline)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4477,7 +5083,7 @@ static Opal_Result directx12_deviceCmdComputeSetPipeline(Opal_Device this, Opal_
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdComputeSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdComputeSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4580,7 +5186,7 @@ static Opal_Result directx12_deviceCmdComputeSetDescriptorSet(Opal_Device this,
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdComputeMemoryBarrier(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_MemoryBarrierDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdComputeMemoryBarrier(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_MemoryBarrierDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4595,7 +5201,7 @@ static Opal_Result directx12_deviceCmdComputeMemoryBarrier(Opal_Device this, Opa
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdComputeDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_threadgroups_x, uint32_t num_threadgroups_y, uint32_t num_threadgroups_z)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdComputeDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_threadgroups_x, uint32_t num_threadgroups_y, uint32_t num_threadgroups_z)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4610,7 +5216,7 @@ static Opal_Result directx12_deviceCmdComputeDispatch(Opal_Device this, Opal_Com
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdEndComputePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdEndComputePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4628,7 +5234,7 @@ static Opal_Result directx12_deviceCmdEndComputePass(Opal_Device this, Opal_Comm
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdBeginRaytracePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdBeginRaytracePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4645,7 +5251,7 @@ static Opal_Result directx12_deviceCmdBeginRaytracePass(Opal_Device this, Opal_C
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdRaytraceSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdRaytraceSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4668,7 +5274,7 @@ static Opal_Result directx12_deviceCmdRaytraceSetPipelineLayout(Opal_Device this
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdRaytraceSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_RaytracePipeline pipeline)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdRaytraceSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_RaytracePipeline pipeline)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4690,7 +5296,7 @@ static Opal_Result directx12_deviceCmdRaytraceSetPipeline(Opal_Device this, Opal
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdRaytraceSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdRaytraceSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4793,7 +5399,7 @@ static Opal_Result directx12_deviceCmdRaytraceSetDescriptorSet(Opal_Device this,
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdRaytraceSetShaderBindingTable(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_ShaderBindingTable shader_binding_table)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdRaytraceSetShaderBindingTable(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_ShaderBindingTable shader_binding_table)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4817,7 +5423,7 @@ static Opal_Result directx12_deviceCmdRaytraceSetShaderBindingTable(Opal_Device
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdRaytraceMemoryBarrier(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_MemoryBarrierDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdRaytraceMemoryBarrier(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_MemoryBarrierDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4832,7 +5438,7 @@ static Opal_Result directx12_deviceCmdRaytraceMemoryBarrier(Opal_Device this, Op
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdRaytraceDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t width, uint32_t height, uint32_t depth)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdRaytraceDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t width, uint32_t height, uint32_t depth)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4883,7 +5489,7 @@ static Opal_Result directx12_deviceCmdRaytraceDispatch(Opal_Device this, Opal_Co
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdEndRaytracePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdEndRaytracePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4901,7 +5507,7 @@ static Opal_Result directx12_deviceCmdEndRaytracePass(Opal_Device this, Opal_Com
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdBeginCopyPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdBeginCopyPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4918,7 +5524,7 @@ static Opal_Result directx12_deviceCmdBeginCopyPass(Opal_Device this, Opal_Comma
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdCopyBufferToBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer src_buffer, uint64_t src_offset, Opal_Buffer dst_buffer, uint64_t dst_offset, uint64_t size)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdCopyBufferToBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer src_buffer, uint64_t src_offset, Opal_Buffer dst_buffer, uint64_t dst_offset, uint64_t size)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4939,7 +5545,7 @@ static Opal_Result directx12_deviceCmdCopyBufferToBuffer(Opal_Device this, Opal_
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdCopyBufferToTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_BufferTextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdCopyBufferToTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_BufferTextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4984,7 +5590,7 @@ static Opal_Result directx12_deviceCmdCopyBufferToTexture(Opal_Device this, Opal
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdCopyTextureToBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_BufferTextureRegion dst, Opal_Extent3D size)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdCopyTextureToBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_BufferTextureRegion dst, Opal_Extent3D size)
 {
 	assert(this);
 	assert(command_buffer);
@@ -5037,7 +5643,49 @@ static Opal_Result directx12_deviceCmdCopyTextureToBuffer(Opal_Device this, Opal
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdCopyTextureToTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdCopyBufferToTextureRegions(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer src_buffer, Opal_Texture dst_texture, uint32_t num_regions, const Opal_BufferTextureCopyRegion *regions)
+{
+	assert(this);
+	assert(command_buffer);
+
+	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
+
+	DirectX12_CommandBuffer *command_buffer_ptr = (DirectX12_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->pass == DIRECTX12_PASS_TYPE_COPY);
+
+	DirectX12_Buffer *src_buffer_ptr = (DirectX12_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)src_buffer);
+	assert(src_buffer_ptr);
+
+	DirectX12_Texture *dst_texture_ptr = (DirectX12_Texture *)opal_poolGetElement(&device_ptr->textures, (Opal_PoolHandle)dst_texture);
+	assert(dst_texture_ptr);
+
+	directx12_cmdCopyBufferTextureRegions(command_buffer_ptr, src_buffer_ptr, dst_texture_ptr, num_regions, regions, TRUE);
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdCopyTextureToBufferRegions(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Texture src_texture, Opal_Buffer dst_buffer, uint32_t num_regions, const Opal_BufferTextureCopyRegion *regions)
+{
+	assert(this);
+	assert(command_buffer);
+
+	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
+
+	DirectX12_CommandBuffer *command_buffer_ptr = (DirectX12_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->pass == DIRECTX12_PASS_TYPE_COPY);
+
+	DirectX12_Texture *src_texture_ptr = (DirectX12_Texture *)opal_poolGetElement(&device_ptr->textures, (Opal_PoolHandle)src_texture);
+	assert(src_texture_ptr);
+
+	DirectX12_Buffer *dst_buffer_ptr = (DirectX12_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)dst_buffer);
+	assert(dst_buffer_ptr);
+
+	directx12_cmdCopyBufferTextureRegions(command_buffer_ptr, dst_buffer_ptr, src_texture_ptr, num_regions, regions, FALSE);
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdCopyTextureToTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size)
 {
 	assert(this);
 	assert(command_buffer);
@@ -5085,149 +5733,216 @@ static Opal_Result directx12_deviceCmdCopyTextureToTexture(Opal_Device this, Opa
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdEndCopyPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdFillBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer buffer, uint64_t offset, uint64_t size, uint32_t value)
 {
 	assert(this);
 	assert(command_buffer);
+	assert((offset & 3) == 0);
+	assert((size & 3) == 0);
 
 	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
+
 	DirectX12_CommandBuffer *command_buffer_ptr = (DirectX12_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
 	assert(command_buffer_ptr);
 	assert(command_buffer_ptr->pass == DIRECTX12_PASS_TYPE_COPY);
 
-	command_buffer_ptr->pass = DIRECTX12_PASS_TYPE_NONE;
+	DirectX12_Buffer *buffer_ptr = (DirectX12_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)buffer);
+	assert(buffer_ptr);
 
-	if (barriers != NULL)
-		directx12_cmdResourceBarrier(device_ptr, command_buffer_ptr, barriers);
+	if (size == 0)
+		return OPAL_SUCCESS;
 
+	directx12_cmdWriteBufferImmediate(device_ptr, command_buffer_ptr, buffer_ptr->address + offset, size, value, NULL);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdBeginAccelerationStructurePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdUpdateBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer buffer, uint64_t offset, uint64_t size, const void *data)
 {
 	assert(this);
 	assert(command_buffer);
+	assert(size == 0 || data);
+	assert((offset & 3) == 0);
+	assert((size & 3) == 0);
+
+	if (size > OPAL_MAX_UPDATE_BUFFER_SIZE)
+		return OPAL_NOT_SUPPORTED;
 
 	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
+
 	DirectX12_CommandBuffer *command_buffer_ptr = (DirectX12_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
 	assert(command_buffer_ptr);
-	assert(command_buffer_ptr->pass == DIRECTX12_PASS_TYPE_NONE);
+	assert(command_buffer_ptr->pass == DIRECTX12_PASS_TYPE_COPY);
 
-	if (barriers != NULL)
-		directx12_cmdResourceBarrier(device_ptr, command_buffer_ptr, barriers);
+	DirectX12_Buffer *buffer_ptr = (DirectX12_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)buffer);
+	assert(buffer_ptr);
 
-	command_buffer_ptr->pass = DIRECTX12_PASS_TYPE_ACCELERATION_STRUCTURE;
+	if (size == 0)
+		return OPAL_SUCCESS;
+
+	directx12_cmdWriteBufferImmediate(device_ptr, command_buffer_ptr, buffer_ptr->address + offset, size, 0, (const uint32_t *)data);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdAccelerationStructureBuild(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureBuildDesc *desc)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdClearTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureView texture_view, Opal_ClearValue clear_value)
 {
 	assert(this);
 	assert(command_buffer);
-	assert(desc);
 
 	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
+	ID3D12Device *d3d12_device = device_ptr->device;
 
 	DirectX12_CommandBuffer *command_buffer_ptr = (DirectX12_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
 	assert(command_buffer_ptr);
-	assert(command_buffer_ptr->pass == DIRECTX12_PASS_TYPE_ACCELERATION_STRUCTURE);
+	assert(command_buffer_ptr->pass == DIRECTX12_PASS_TYPE_COPY);
 
-	DirectX12_AccelerationStructure *dst_acceleration_structure_ptr = (DirectX12_AccelerationStructure *)opal_poolGetElement(&device_ptr->acceleration_structures, (Opal_PoolHandle)desc->dst_acceleration_structure);
-	assert(dst_acceleration_structure_ptr);
+	DirectX12_TextureView *texture_view_ptr = (DirectX12_TextureView *)opal_poolGetElement(&device_ptr->texture_views, (Opal_PoolHandle)texture_view);
+	assert(texture_view_ptr);
 
-	dst_acceleration_structure_ptr->allow_compaction = (desc->build_flags & OPAL_ACCELERATION_STRUCTURE_BUILD_FLAGS_ALLOW_COMPACTION) != 0;
+	// note: D3D12 has no copy queue clear, so the view goes through the framebuffer state and back,
+	//       which means the texture has to be created with the framebuffer attachment usage and
+	//       the command buffer has to come from the main engine, the only one that can clear views
+	if (command_buffer_ptr->type != D3D12_COMMAND_LIST_TYPE_DIRECT)
+		return OPAL_NOT_SUPPORTED;
 
-	const DirectX12_AccelerationStructure *src_acceleration_structure_ptr = (DirectX12_AccelerationStructure *)opal_poolGetElement(&device_ptr->acceleration_structures, (Opal_PoolHandle)desc->src_acceleration_structure);
+	if ((texture_view_ptr->usage & OPAL_TEXTURE_USAGE_FRAMEBUFFER_ATTACHMENT) == 0)
+		return OPAL_NOT_SUPPORTED;
 
-	const DirectX12_Buffer *scratch_buffer_ptr = (DirectX12_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)desc->scratch_buffer.buffer);
-	assert(scratch_buffer_ptr);
+	D3D12_RESOURCE_STATES copy_state = directx12_helperToTextureState(texture_view_ptr->opal_format, texture_view_ptr->usage, OPAL_TEXTURE_STATE_COPY_DST);
+	D3D12_RESOURCE_STATES clear_state = directx12_helperToTextureState(texture_view_ptr->opal_format, texture_view_ptr->usage, OPAL_TEXTURE_STATE_FRAMEBUFFER_ATTACHMENT);
 
-	D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_DESC build_desc = {0};
+	directx12_cmdTextureViewTransition(device_ptr, command_buffer_ptr, texture_view_ptr, copy_state, clear_state);
 
-	build_desc.Inputs.Type = directx12_helperToAccelerationStructureType(desc->type);
-	build_desc.Inputs.Flags = directx12_helperToAccelerationStructureBuildFlags(desc->build_flags);
-	build_desc.Inputs.DescsLayout = D3D12_ELEMENTS_LAYOUT_ARRAY;
-	build_desc.DestAccelerationStructureData = dst_acceleration_structure_ptr->address;
-	build_desc.ScratchAccelerationStructureData = scratch_buffer_ptr->address + desc->scratch_buffer.offset;
+	Opal_TextureFormat format = texture_view_ptr->opal_format;
+	if (format >= OPAL_TEXTURE_FORMAT_DEPTH_STENCIL_BEGIN && format <= OPAL_TEXTURE_FORMAT_DEPTH_STENCIL_END)
+	{
+		D3D12_CPU_DESCRIPTOR_HANDLE descriptor = {0};
+		ID3D12DescriptorHeap_GetCPUDescriptorHandleForHeapStart(device_ptr->framebuffer_descriptor_heap.dsv_heap, &descriptor);
+		ID3D12Device_CreateDepthStencilView(d3d12_device, texture_view_ptr->texture, &texture_view_ptr->dsv_desc, descriptor);
 
-	if (src_acceleration_structure_ptr)
-		build_desc.SourceAccelerationStructureData = src_acceleration_structure_ptr->address;
+		D3D12_CLEAR_FLAGS flags = D3D12_CLEAR_FLAG_DEPTH;
+		if (format >= OPAL_TEXTURE_FORMAT_D16_UNORM_S8_UINT)
+			flags |= D3D12_CLEAR_FLAG_STENCIL;
 
-	if (desc->type == OPAL_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL)
+		ID3D12GraphicsCommandList6_ClearDepthStencilView(command_buffer_ptr->list, descriptor, flags, clear_value.depth_stencil.depth, (UINT8)clear_value.depth_stencil.stencil, 0, NULL);
+	}
+	else
 	{
-		uint32_t num_geometries = desc->input.bottom_level.num_geometries;
+		D3D12_CPU_DESCRIPTOR_HANDLE descriptor = {0};
+		ID3D12DescriptorHeap_GetCPUDescriptorHandleForHeapStart(device_ptr->framebuffer_descriptor_heap.rtv_heap, &descriptor);
+		ID3D12Device_CreateRenderTargetView(d3d12_device, texture_view_ptr->texture, &texture_view_ptr->rtv_desc, descriptor);
 
-		opal_bumpReset(&device_ptr->bump);
-		uint32_t geometries_offset = opal_bumpAlloc(&device_ptr->bump, sizeof(D3D12_RAYTRACING_GEOMETRY_DESC) * num_geometries);
+		ID3D12GraphicsCommandList6_ClearRenderTargetView(command_buffer_ptr->list, descriptor, clear_value.color.f, 0, NULL);
+	}
 
-		D3D12_RAYTRACING_GEOMETRY_DESC *geometries = (D3D12_RAYTRACING_GEOMETRY_DESC *)(device_ptr->bump.data + geometries_offset);
-		memset(geometries, 0, sizeof(D3D12_RAYTRACING_GEOMETRY_DESC) * num_geometries);
+	directx12_cmdTextureViewTransition(device_ptr, command_buffer_ptr, texture_view_ptr, clear_state, copy_state);
 
-		build_desc.Inputs.NumDescs = desc->input.bottom_level.num_geometries;
-		build_desc.Inputs.pGeometryDescs = geometries;
+	return OPAL_SUCCESS;
+}
 
-		for (uint32_t j = 0; j < num_geometries; ++j)
-		{
-			const Opal_AccelerationStructureGeometry *opal_geometry = &desc->input.bottom_level.geometries[j];
-			D3D12_RAYTRACING_GEOMETRY_DESC *geometry = &geometries[j];
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdBlitTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_Extent3D src_size, Opal_TextureRegion dst, Opal_Extent3D dst_size, Opal_SamplerFilterMode filter)
+{
+	assert(this);
+	assert(command_buffer);
 
-			geometry->Type = directx12_helperToAccelerationStructureGeometryType(opal_geometry->type);
-			geometry->Flags = directx12_helperToAccelerationStructureGeometryFlags(opal_geometry->flags);
+	// note: there is no scaling blit in the API, so only unscaled nearest blits are supported and they're plain copies
+	if (filter != OPAL_SAMPLER_FILTER_MODE_NEAREST)
+		return OPAL_NOT_SUPPORTED;
 
-			if (opal_geometry->type == OPAL_ACCELERATION_STRUCTURE_GEOMETRY_TYPE_TRIANGLES)
-			{
-				const Opal_AccelerationStructureGeometryDataTriangles *opal_triangles = &opal_geometry->data.triangles;
-				D3D12_RAYTRACING_GEOMETRY_TRIANGLES_DESC *triangles = &geometry->Triangles;
+	if (src_size.width != dst_size.width || src_size.height != dst_size.height || src_size.depth != dst_size.depth)
+		return OPAL_NOT_SUPPORTED;
 
-				const DirectX12_Buffer *vertex_buffer_ptr = (DirectX12_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)opal_triangles->vertex_buffer.buffer);
-				assert(vertex_buffer_ptr);
+	return directx12_deviceCmdCopyTextureToTexture(this, command_buffer, src, dst, src_size);
+}
 
-				const DirectX12_Buffer *index_buffer_ptr = (DirectX12_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)opal_triangles->index_buffer.buffer);
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdGenerateMips(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureView texture_view)
+{
+	OPAL_UNUSED(this);
+	OPAL_UNUSED(command_buffer);
+	OPAL_UNUSED(texture_view);
 
-				triangles->IndexFormat = directx12_helperToDXGIIndexFormat(opal_triangles->index_format);
-				triangles->VertexFormat = directx12_helperToDXGIVertexFormat(opal_triangles->vertex_format);
-				triangles->IndexCount = opal_triangles->num_indices;
-				triangles->VertexCount = opal_triangles->num_vertices;
-				triangles->VertexBuffer.StartAddress = vertex_buffer_ptr->address + opal_triangles->vertex_buffer.offset;
-				triangles->VertexBuffer.StrideInBytes = opal_triangles->vertex_stride;
+	// note: mips have to be downsampled with shaders, which Opal doesn't ship for this backend
+	return OPAL_NOT_SUPPORTED;
+}
 
-				if (index_buffer_ptr)
-					triangles->IndexBuffer = index_buffer_ptr->address + opal_triangles->index_buffer.offset;
-			}
-			else if (opal_geometry->type == OPAL_ACCELERATION_STRUCTURE_GEOMETRY_TYPE_AABBS)
-			{
-				const Opal_AccelerationStructureGeometryDataAABBs *opal_aabbs = &opal_geometry->data.aabbs;
-				D3D12_RAYTRACING_GEOMETRY_AABBS_DESC *aabbs = &geometry->AABBs;
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdEndCopyPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+	assert(command_buffer);
 
-				const DirectX12_Buffer *entries_buffer_ptr = (DirectX12_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)opal_aabbs->entries_buffer.buffer);
-				assert(entries_buffer_ptr);
+	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
+	DirectX12_CommandBuffer *command_buffer_ptr = (DirectX12_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->pass == DIRECTX12_PASS_TYPE_COPY);
 
-				aabbs->AABBCount = opal_aabbs->num_entries;
-				aabbs->AABBs.StartAddress = entries_buffer_ptr->address + opal_aabbs->entries_buffer.offset;
-				aabbs->AABBs.StrideInBytes = opal_aabbs->stride;
-			}
-			else
-				assert(0);
-		}
-	}
-	else if (desc->type == OPAL_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL)
+	command_buffer_ptr->pass = DIRECTX12_PASS_TYPE_NONE;
+
+	if (barriers != NULL)
+		directx12_cmdResourceBarrier(device_ptr, command_buffer_ptr, barriers);
+
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdBeginAccelerationStructurePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+	assert(command_buffer);
+
+	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
+	DirectX12_CommandBuffer *command_buffer_ptr = (DirectX12_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->pass == DIRECTX12_PASS_TYPE_NONE);
+
+	if (barriers != NULL)
+		directx12_cmdResourceBarrier(device_ptr, command_buffer_ptr, barriers);
+
+	command_buffer_ptr->pass = DIRECTX12_PASS_TYPE_ACCELERATION_STRUCTURE;
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdAccelerationStructureBuild(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureBuildDesc *desc)
+{
+	assert(desc);
+	return directx12_deviceCmdAccelerationStructureBuildBatch(this, command_buffer, 1, desc);
+}
+
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdAccelerationStructureBuildBatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_descs, const Opal_AccelerationStructureBuildDesc *descs)
+{
+	assert(this);
+	assert(command_buffer);
+	assert(num_descs == 0 || descs);
+
+	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
+
+	DirectX12_CommandBuffer *command_buffer_ptr = (DirectX12_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->pass == DIRECTX12_PASS_TYPE_ACCELERATION_STRUCTURE);
+
+	// note: d3d12 has no multiple build call, builds of a run are recorded back to back so the gpu
+	//       can overlap them, runs are separated by a global uav barrier
+	uint32_t first_build = 0;
+	while (first_build < num_descs)
 	{
-		const Opal_AccelerationStructureBuildInputTopLevel *input = &desc->input.top_level;
-		const DirectX12_Buffer *instances_buffer_ptr = (DirectX12_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)input->instance_buffer.buffer);
-		assert(instances_buffer_ptr);
+		uint32_t num_builds = opal_buildBatchGetRun(&device_ptr->build_batch, num_descs - first_build, descs + first_build);
+		assert(num_builds > 0);
 
-		build_desc.Inputs.NumDescs = desc->input.top_level.num_instances;
-		build_desc.Inputs.InstanceDescs = instances_buffer_ptr->address + input->instance_buffer.offset;
-	}
-	else
-		assert(0);
+		if (first_build > 0)
+		{
+			D3D12_RESOURCE_BARRIER barrier = {0};
+			barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_UAV;
 
-	ID3D12GraphicsCommandList6_BuildRaytracingAccelerationStructure(command_buffer_ptr->list, &build_desc, 0, NULL);
+			ID3D12GraphicsCommandList6_ResourceBarrier(command_buffer_ptr->list, 1, &barrier);
+		}
+
+		for (uint32_t i = 0; i < num_builds; ++i)
+			directx12_cmdAccelerationStructureBuild(device_ptr, command_buffer_ptr, &descs[first_build + i]);
+
+		first_build += num_builds;
+	}
 
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdAccelerationStructureCopy(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureCopyDesc *desc)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdAccelerationStructureCopy(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureCopyDesc *desc)
 {
 	assert(this);
 	assert(command_buffer);
@@ -5253,7 +5968,118 @@ static Opal_Result directx12_deviceCmdAccelerationStructureCopy(Opal_Device this
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_deviceCmdEndAccelerationStructurePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdAccelerationStructureWriteCompactedSizes(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_acceleration_structures, const Opal_AccelerationStructure *acceleration_structures, Opal_BufferView dst)
+{
+	assert(this);
+	assert(command_buffer);
+	assert(num_acceleration_structures == 0 || acceleration_structures);
+
+	DirectX12_Device *device_ptr = (DirectX12_Device *)this;
+
+	DirectX12_CommandBuffer *command_buffer_ptr = (DirectX12_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->pass == DIRECTX12_PASS_TYPE_ACCELERATION_STRUCTURE);
+
+	DirectX12_Buffer *buffer_ptr = (DirectX12_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)dst.buffer);
+	assert(buffer_ptr);
+
+	ID3D12GraphicsCommandList6 *d3d12_command_list = command_buffer_ptr->list;
+
+	// note: postbuild info can only be written to buffers in unordered access state, so sizes go through
+	//       buffers owned by the command buffer and are copied to dst, which can then be a readback buffer
+	uint32_t num_sizes = command_buffer_ptr->num_compacted_sizes + num_acceleration_structures;
+	uint32_t num_buffers = (num_sizes + DIRECTX12_COMPACTED_SIZES_PER_BUFFER - 1) / DIRECTX12_COMPACTED_SIZES_PER_BUFFER;
+
+	if (num_buffers > command_buffer_ptr->num_compacted_size_buffers)
+	{
+		command_buffer_ptr->compacted_size_buffers = (DirectX12_Buffer *)realloc(command_buffer_ptr->compacted_size_buffers, sizeof(DirectX12_Buffer) * num_buffers);
+		assert(command_buffer_ptr->compacted_size_buffers);
+
+		D3D12_RESOURCE_DESC buffer_info = {0};
+		buffer_info.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
+		buffer_info.Alignment = 0;
+		buffer_info.Width = sizeof(uint64_t) * DIRECTX12_COMPACTED_SIZES_PER_BUFFER;
+		buffer_info.Height = 1;
+		buffer_info.DepthOrArraySize = 1;
+		buffer_info.MipLevels = 1;
+		buffer_info.Format = DXGI_FORMAT_UNKNOWN;
+		buffer_info.SampleDesc.Count = 1;
+		buffer_info.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+		buffer_info.Flags = D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
+
+		for (uint32_t i = command_buffer_ptr->num_compacted_size_buffers; i < num_buffers; ++i)
+		{
+			DirectX12_Buffer *compacted_size_buffer_ptr = &command_buffer_ptr->compacted_size_buffers[i];
+			memset(compacted_size_buffer_ptr, 0, sizeof(DirectX12_Buffer));
+
+			Opal_Result opal_result = directx12_createBuffer(device_ptr, &buffer_info, D3D12_RESOURCE_STATE_UNORDERED_ACCESS, OPAL_ALLOCATION_MEMORY_TYPE_DEVICE_LOCAL, OPAL_ALLOCATION_HINT_AUTO, &compacted_size_buffer_ptr->buffer, &compacted_size_buffer_ptr->allocation);
+			if (opal_result != OPAL_SUCCESS)
+				return opal_result;
+
+			compacted_size_buffer_ptr->address = ID3D12Resource_GetGPUVirtualAddress(compacted_size_buffer_ptr->buffer);
+			command_buffer_ptr->num_compacted_size_buffers++;
+		}
+	}
+
+	opal_bumpReset(&device_ptr->bump);
+	uint32_t addresses_offset = opal_bumpAlloc(&device_ptr->bump, sizeof(D3D12_GPU_VIRTUAL_ADDRESS) * num_acceleration_structures);
+	D3D12_GPU_VIRTUAL_ADDRESS *addresses = (D3D12_GPU_VIRTUAL_ADDRESS *)(device_ptr->bump.data + addresses_offset);
+
+	for (uint32_t i = 0; i < num_acceleration_structures; ++i)
+	{
+		const DirectX12_AccelerationStructure *acceleration_structure_ptr = (DirectX12_AccelerationStructure *)opal_poolGetElement(&device_ptr->acceleration_structures, (Opal_PoolHandle)acceleration_structures[i]);
+		assert(acceleration_structure_ptr);
+
+		addresses[i] = acceleration_structure_ptr->address;
+	}
+
+	// note: sizes are only known after the builds are done
+	D3D12_RESOURCE_BARRIER uav_barrier = {0};
+	uav_barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_UAV;
+
+	ID3D12GraphicsCommandList6_ResourceBarrier(d3d12_command_list, 1, &uav_barrier);
+
+	uint32_t written = 0;
+	while (written < num_acceleration_structures)
+	{
+		uint32_t index = command_buffer_ptr->num_compacted_sizes;
+		uint32_t first_size = index % DIRECTX12_COMPACTED_SIZES_PER_BUFFER;
+		uint32_t count = num_acceleration_structures - written;
+
+		if (count > DIRECTX12_COMPACTED_SIZES_PER_BUFFER - first_size)
+			count = DIRECTX12_COMPACTED_SIZES_PER_BUFFER - first_size;
+
+		const DirectX12_Buffer *compacted_size_buffer_ptr = &command_buffer_ptr->compacted_size_buffers[index / DIRECTX12_COMPACTED_SIZES_PER_BUFFER];
+
+		D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_DESC postbuild_info = {0};
+		postbuild_info.DestBuffer = compacted_size_buffer_ptr->address + sizeof(uint64_t) * first_size;
+		postbuild_info.InfoType = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_COMPACTED_SIZE;
+
+		ID3D12GraphicsCommandList6_EmitRaytracingAccelerationStructurePostbuildInfo(d3d12_command_list, &postbuild_info, count, &addresses[written]);
+
+		D3D12_RESOURCE_BARRIER barrier = {0};
+		barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+		barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+		barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_COPY_SOURCE;
+		barrier.Transition.pResource = compacted_size_buffer_ptr->buffer;
+		barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+
+		ID3D12GraphicsCommandList6_ResourceBarrier(d3d12_command_list, 1, &barrier);
+		ID3D12GraphicsCommandList6_CopyBufferRegion(d3d12_command_list, buffer_ptr->buffer, dst.offset + sizeof(uint64_t) * written, compacted_size_buffer_ptr->buffer, sizeof(uint64_t) * first_size, sizeof(uint64_t) * count);
+
+		barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_COPY_SOURCE;
+		barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+
+		ID3D12GraphicsCommandList6_ResourceBarrier(d3d12_command_list, 1, &barrier);
+
+		command_buffer_ptr->num_compacted_sizes += count;
+		written += count;
+	}
+
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result directx12_deviceCmdEndAccelerationStructurePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -5271,6 +6097,82 @@ static Opal_Result directx12_deviceCmdEndAccelerationStructurePass(Opal_Device t
 	return OPAL_SUCCESS;
 }
 
+/*
+ */
+static Opal_Result directx12_notifierCreateSemaphore(void *device, uint64_t *semaphore)
+{
+	DirectX12_Device *device_ptr = (DirectX12_Device *)device;
+	assert(device_ptr);
+	assert(semaphore);
+
+	ID3D12Fence *d3d12_fence = NULL;
+
+	HRESULT hr = ID3D12Device_CreateFence(device_ptr->device, 0, D3D12_FENCE_FLAG_NONE, &IID_ID3D12Fence, &d3d12_fence);
+	if (!SUCCEEDED(hr))
+		return OPAL_DIRECTX12_ERROR;
+
+	*semaphore = (uint64_t)d3d12_fence;
+	return OPAL_SUCCESS;
+}
+
+static void directx12_notifierDestroySemaphore(void *device, uint64_t semaphore)
+{
+	OPAL_UNUSED(device);
+
+	ID3D12Fence_Release((ID3D12Fence *)semaphore);
+}
+
+static uint64_t directx12_notifierQuerySemaphore(void *device, uint64_t semaphore)
+{
+	OPAL_UNUSED(device);
+
+	return ID3D12Fence_GetCompletedValue((ID3D12Fence *)semaphore);
+}
+
+static void directx12_notifierSignalSemaphore(void *device, uint64_t semaphore, uint64_t value)
+{
+	OPAL_UNUSED(device);
+
+	ID3D12Fence_Signal((ID3D12Fence *)semaphore, value);
+}
+
+static void directx12_notifierWaitSemaphores(void *device, uint32_t num_semaphores, const uint64_t *semaphores, const uint64_t *values, Opal_Bump *scratch)
+{
+	DirectX12_Device *device_ptr = (DirectX12_Device *)device;
+	assert(device_ptr);
+	assert(scratch);
+
+	uint32_t d3d12_fences_offset = opal_bumpAlloc(scratch, sizeof(ID3D12Fence *) * num_semaphores);
+	ID3D12Fence **d3d12_fences = (ID3D12Fence **)(scratch->data + d3d12_fences_offset);
+
+	for (uint32_t i = 0; i < num_semaphores; ++i)
+		d3d12_fences[i] = (ID3D12Fence *)semaphores[i];
+
+	ID3D12Device1 *d3d12_device1 = NULL;
+	HRESULT hr = ID3D12Device_QueryInterface(device_ptr->device, &IID_ID3D12Device1, &d3d12_device1);
+	if (!SUCCEEDED(hr))
+		return;
+
+	HANDLE event = CreateEventEx(NULL, FALSE, FALSE, EVENT_ALL_ACCESS);
+
+	hr = ID3D12Device1_SetEventOnMultipleFenceCompletion(d3d12_device1, d3d12_fences, values, num_semaphores, D3D12_MULTIPLE_FENCE_WAIT_FLAG_ANY, event);
+	ID3D12Device1_Release(d3d12_device1);
+
+	if (SUCCEEDED(hr))
+		WaitForSingleObjectEx(event, INFINITE, FALSE);
+
+	CloseHandle(event);
+}
+
+static Opal_NotifierFunctions directx12_notifier_functions =
+{
+	directx12_notifierCreateSemaphore,
+	directx12_notifierDestroySemaphore,
+	directx12_notifierQuerySemaphore,
+	directx12_notifierSignalSemaphore,
+	directx12_notifierWaitSemaphores,
+};
+
 /*
  */
 static Opal_DeviceTable device_vtbl =
@@ -5278,6 +6180,7 @@ static Opal_DeviceTable device_vtbl =
 	directx12_deviceGetInfo,
 	directx12_deviceGetQueue,
 	directx12_deviceGetAccelerationStructurePrebuildInfo,
+	directx12_deviceGetAccelerationStructureAddress,
 	directx12_deviceGetSupportedSurfaceFormats,
 	directx12_deviceGetSupportedPresentModes,
 	directx12_deviceGetPreferredSurfaceFormat,
@@ -5301,6 +6204,12 @@ static Opal_DeviceTable device_vtbl =
 	directx12_deviceCreateMeshletPipeline,
 	directx12_deviceCreateComputePipeline,
 	directx12_deviceCreateRaytracePipeline,
+	directx12_deviceCreateGraphicsPipelines,
+	directx12_deviceCreateComputePipelines,
+	directx12_deviceCreateRaytracePipelines,
+	directx12_deviceCreateGraphicsPipelinesAsync,
+	directx12_deviceCreateComputePipelinesAsync,
+	directx12_deviceCreateRaytracePipelinesAsync,
 	directx12_deviceCreateSwapchain,
 
 	directx12_deviceDestroySemaphore,
@@ -5337,11 +6246,16 @@ static Opal_DeviceTable device_vtbl =
 	directx12_deviceQuerySemaphore,
 	directx12_deviceSignalSemaphore,
 	directx12_deviceWaitSemaphore,
+	directx12_deviceWaitSemaphores,
+	directx12_deviceRegisterSemaphoreCallback,
+	directx12_deviceWaitPipelineTask,
 	directx12_deviceWaitQueue,
 	directx12_deviceWaitIdle,
 	directx12_deviceSubmit,
 	directx12_deviceAcquire,
 	directx12_devicePresent,
+	directx12_deviceWaitPresent,
+	directx12_deviceGetSwapchainFrameTiming,
 
 	directx12_deviceCmdSetDescriptorHeap,
 
@@ -5379,12 +6293,21 @@ static Opal_DeviceTable device_vtbl =
 	directx12_deviceCmdCopyBufferToBuffer,
 	directx12_deviceCmdCopyBufferToTexture,
 	directx12_deviceCmdCopyTextureToBuffer,
+	directx12_deviceCmdCopyBufferToTextureRegions,
+	directx12_deviceCmdCopyTextureToBufferRegions,
 	directx12_deviceCmdCopyTextureToTexture,
+	directx12_deviceCmdFillBuffer,
+	directx12_deviceCmdUpdateBuffer,
+	directx12_deviceCmdClearTexture,
+	directx12_deviceCmdBlitTexture,
+	directx12_deviceCmdGenerateMips,
 	directx12_deviceCmdEndCopyPass,
 
 	directx12_deviceCmdBeginAccelerationStructurePass,
 	directx12_deviceCmdAccelerationStructureBuild,
+	directx12_deviceCmdAccelerationStructureBuildBatch,
 	directx12_deviceCmdAccelerationStructureCopy,
+	directx12_deviceCmdAccelerationStructureWriteCompactedSizes,
 	directx12_deviceCmdEndAccelerationStructurePass,
 };
 
@@ -5422,6 +6345,9 @@ Opal_Result directx12_deviceInitialize(DirectX12_Device *device_ptr, DirectX12_I
 	// bump
 	opal_bumpInitialize(&device_ptr->bump, 256);
 
+	// build batch
+	opal_buildBatchInitialize(&device_ptr->build_batch);
+
 	// pools
 	opal_poolInitialize(&device_ptr->queues, sizeof(DirectX12_Queue), 32);
 	opal_poolInitialize(&device_ptr->semaphores, sizeof(DirectX12_Semaphore), 32);
@@ -5444,6 +6370,21 @@ Opal_Result directx12_deviceInitialize(DirectX12_Device *device_ptr, DirectX12_I
 	opal_poolInitialize(&device_ptr->raytrace_pipelines, sizeof(DirectX12_RaytracePipeline), 32);
 	opal_poolInitialize(&device_ptr->swapchains, sizeof(DirectX12_Swapchain), 32);
 
+	// caches
+	opal_cacheInitialize(&device_ptr->shader_cache, 64);
+	opal_cacheInitialize(&device_ptr->sampler_cache, 16);
+	opal_cacheInitialize(&device_ptr->descriptor_set_layout_cache, 16);
+	opal_cacheInitialize(&device_ptr->pipeline_layout_cache, 16);
+
+	// compiler
+	opal_compilerInitialize(&device_ptr->compiler, device_ptr, 0);
+
+	// instance packer
+	opal_instancePackerInitialize(&device_ptr->instance_packer, device_ptr, 0);
+
+	// notifier
+	opal_notifierInitialize(&device_ptr->notifier, device_ptr, &directx12_notifier_functions);
+
 	// queues
 	const DirectX12_DeviceEnginesInfo *engines_info = &device_ptr->device_engines_info;
 
@@ -39,7 +39,7 @@ static Opal_Result directx12_initialize()
 
 /*
  */
-static Opal_Result directx12_instanceEnumerateDevices(Opal_Instance this, uint32_t *device_count, Opal_DeviceInfo *infos)
+OPAL_BACKEND_STATIC Opal_Result directx12_instanceEnumerateDevices(Opal_Instance this, uint32_t *device_count, Opal_DeviceInfo *infos)
 {
 	assert(this);
 	assert(device_count);
@@ -81,7 +81,7 @@ static Opal_Result directx12_instanceEnumerateDevices(Opal_Instance this, uint32
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_instanceCreateSurface(Opal_Instance this, void *handle, Opal_Surface *surface)
+OPAL_BACKEND_STATIC Opal_Result directx12_instanceCreateSurface(Opal_Instance this, void *handle, Opal_Surface *surface)
 {
 	assert(this);
 	assert(handle);
@@ -96,7 +96,17 @@ static Opal_Result directx12_instanceCreateSurface(Opal_Instance this, void *han
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_instanceCreateDefaultDevice(Opal_Instance this, Opal_DeviceHint hint, Opal_Device *device)
+OPAL_BACKEND_STATIC Opal_Result directx12_instanceCreateHeadlessSurface(Opal_Instance this, uint32_t width, uint32_t height, Opal_Surface *surface)
+{
+	OPAL_UNUSED(this);
+	OPAL_UNUSED(width);
+	OPAL_UNUSED(height);
+	OPAL_UNUSED(surface);
+
+	return OPAL_NOT_SUPPORTED;
+}
+
+OPAL_BACKEND_STATIC Opal_Result directx12_instanceCreateDefaultDevice(Opal_Instance this, Opal_DeviceHint hint, Opal_Device *device)
 {
 	assert(this);
 	assert(device);
@@ -175,7 +185,7 @@ static Opal_Result directx12_instanceCreateDefaultDevice(Opal_Instance this, Opa
 	return result;
 }
 
-static Opal_Result directx12_instanceCreateDevice(Opal_Instance this, uint32_t index, Opal_Device *device)
+OPAL_BACKEND_STATIC Opal_Result directx12_instanceCreateDevice(Opal_Instance this, uint32_t index, Opal_Device *device)
 {
 	assert(this);
 	assert(device);
@@ -211,7 +221,7 @@ static Opal_Result directx12_instanceCreateDevice(Opal_Instance this, uint32_t i
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_instanceDestroySurface(Opal_Instance this, Opal_Surface surface)
+OPAL_BACKEND_STATIC Opal_Result directx12_instanceDestroySurface(Opal_Instance this, Opal_Surface surface)
 {
 	assert(this);
 	assert(surface);
@@ -225,7 +235,7 @@ static Opal_Result directx12_instanceDestroySurface(Opal_Instance this, Opal_Sur
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result directx12_instanceDestroy(Opal_Instance this)
+OPAL_BACKEND_STATIC Opal_Result directx12_instanceDestroy(Opal_Instance this)
 {
 	assert(this);
 
@@ -249,6 +259,7 @@ static Opal_InstanceTable instance_vtbl =
 	directx12_instanceEnumerateDevices,
 
 	directx12_instanceCreateSurface,
+	directx12_instanceCreateHeadlessSurface,
 	directx12_instanceCreateDevice,
 	directx12_instanceCreateDefaultDevice,
 
@@ -7,8 +7,15 @@
 #include <dxgi1_4.h>
 #include <d3d12.h>
 
+#include "common/batch.h"
 #include "common/bump.h"
+#include "common/cache.h"
+#include "common/compiler.h"
+#include "common/format.h"
 #include "common/heap.h"
+#include "common/instances.h"
+#include "common/notifier.h"
+#include "common/pacing.h"
 #include "common/pool.h"
 
 #define D3D12_MAX_MEMORY_TYPES 20U
@@ -117,6 +124,7 @@ typedef struct DirectX12_Device_t
 	DirectX12_DeviceEnginesInfo device_engines_info;
 	Opal_Queue *queue_handles[OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX];
 	Opal_Bump bump;
+	Opal_BuildBatch build_batch;
 	Opal_Pool queues;
 	Opal_Pool semaphores;
 	Opal_Pool fences;
@@ -137,6 +145,13 @@ typedef struct DirectX12_Device_t
 	Opal_Pool compute_pipelines;
 	Opal_Pool raytrace_pipelines;
 	Opal_Pool swapchains;
+	Opal_Cache shader_cache;
+	Opal_Cache sampler_cache;
+	Opal_Cache descriptor_set_layout_cache;
+	Opal_Cache pipeline_layout_cache;
+	Opal_Compiler compiler;
+	Opal_Notifier notifier;
+	Opal_InstancePacker instance_packer;
 
 	DirectX12_Allocator allocator;
 	DirectX12_FramebufferDescriptorHeap framebuffer_descriptor_heap;
@@ -177,6 +192,7 @@ typedef struct DirectX12_Texture_t
 	ID3D12Resource *texture;
 	DXGI_FORMAT format;
 	UINT16 depth;
+	UINT16 mip_count;
 	UINT64 width;
 	UINT64 height;
 	UINT samples;
@@ -240,12 +256,16 @@ typedef struct DirectX12_CommandBuffer_t
 	ID3D12GraphicsCommandList6 *list;
 	D3D12_RENDER_PASS_ENDING_ACCESS_RESOLVE_SUBRESOURCE_PARAMETERS resolve_parameters[9];
 	Opal_CommandAllocator allocator;
+	D3D12_COMMAND_LIST_TYPE type;
 	uint32_t recording;
 	DirectX12_PassType pass;
 	Opal_PipelineLayout pipeline_layout;
 	D3D12_GPU_VIRTUAL_ADDRESS raygen_entry;
 	D3D12_GPU_VIRTUAL_ADDRESS miss_entry;
 	D3D12_GPU_VIRTUAL_ADDRESS intersection_entry;
+	DirectX12_Buffer *compacted_size_buffers;
+	uint32_t num_compacted_size_buffers;
+	uint32_t num_compacted_sizes;
 } DirectX12_CommandBuffer;
 
 typedef struct DirectX12_Shader_t
@@ -330,10 +350,13 @@ typedef struct DirectX12_Surface_t
 typedef struct DirectX12_Swapchain_t
 {
 	IDXGISwapChain3 *swapchain;
+	HANDLE frame_latency_event;
 	Opal_TextureView *texture_views;
 	UINT present_flags;
+	UINT present_count_offset;
 	uint32_t current_index;
 	uint32_t num_textures;
+	Opal_Pacing pacing;
 } DirectX12_Swapchain;
 
 typedef HRESULT (WINAPI* PFN_DXGI_CREATE_FACTORY)(REFIID, _COM_Outptr_ void **);
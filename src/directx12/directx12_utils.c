@@ -38,7 +38,7 @@ D3D12_RESOURCE_STATES directx12_helperToBufferState(Opal_AllocationMemoryType ty
 				result |= D3D12_RESOURCE_STATE_COPY_SOURCE;
 
 			if (usage & OPAL_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT)
-				result |= D3D12_RESOURCE_STATE_COPY_SOURCE;
+				result |= D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE;
 
 			return result;
 		}
@@ -723,7 +723,6 @@ Opal_Result directx12_helperFillDeviceInfo(IDXGIAdapter1 *adapter, ID3D12Device
 
 	memcpy(info->features.queue_count, &device_engines_info.queue_counts, sizeof(uint32_t) * OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX);
 
-	info->features.acceleration_structure_instance_size = sizeof(D3D12_RAYTRACING_INSTANCE_DESC);
 	info->features.tessellation_shader = 1;
 	info->features.geometry_shader = 1;
 	info->features.compute_pipeline = 1;
@@ -734,6 +733,12 @@ Opal_Result directx12_helperFillDeviceInfo(IDXGIAdapter1 *adapter, ID3D12Device
 	if (SUCCEEDED(hr))
 		info->features.raytrace_pipeline = (raytracing_options.RaytracingTier != D3D12_RAYTRACING_TIER_NOT_SUPPORTED);
 
+	if (info->features.raytrace_pipeline)
+	{
+		info->features.acceleration_structure_instance_size = sizeof(D3D12_RAYTRACING_INSTANCE_DESC);
+		info->features.acceleration_structure_instance_layout = OPAL_ACCELERATION_STRUCTURE_INSTANCE_LAYOUT_ROW_MAJOR;
+	}
+
 	D3D12_FEATURE_DATA_D3D12_OPTIONS9 meshlet_options = {0};
 	hr = ID3D12Device_CheckFeatureSupport(device, D3D12_FEATURE_D3D12_OPTIONS9, &meshlet_options, sizeof(D3D12_FEATURE_DATA_D3D12_OPTIONS9));
 	if (SUCCEEDED(hr))
@@ -747,6 +752,8 @@ Opal_Result directx12_helperFillDeviceInfo(IDXGIAdapter1 *adapter, ID3D12Device
 	// info->limits.max_buffer_size = ?;
 	info->limits.min_uniform_buffer_offset_alignment = 0xFFFF;
 	info->limits.min_storage_buffer_offset_alignment = 0xFFFF;
+	info->limits.min_texture_copy_row_alignment = D3D12_TEXTURE_DATA_PITCH_ALIGNMENT;
+	info->limits.min_texture_copy_offset_alignment = D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT;
 	info->limits.max_descriptor_sets = 32;
 	info->limits.max_uniform_buffer_binding_size = 0xFFFFFFFF;
 	info->limits.max_storage_buffer_binding_size = 0xFFFFFFFF;
@@ -762,6 +769,7 @@ Opal_Result directx12_helperFillDeviceInfo(IDXGIAdapter1 *adapter, ID3D12Device
 	info->limits.max_compute_workgroup_local_size_x = 1024;
 	info->limits.max_compute_workgroup_local_size_y = 1024;
 	info->limits.max_compute_workgroup_local_size_z = 64;
+	info->limits.min_acceleration_structure_scratch_offset_alignment = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT;
 
 	return OPAL_SUCCESS;
 }
@@ -0,0 +1,533 @@
+#include "graph_internal.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ */
+static OPAL_INLINE Graph_Resource *graph_getResource(Graph_Graph *graph, Opal_GraphResource resource, Graph_ResourceType type)
+{
+	assert(graph);
+
+	if (resource == OPAL_NULL_HANDLE || resource > graph->num_resources)
+		return NULL;
+
+	Graph_Resource *resource_ptr = &graph->resources[resource - 1];
+	if (resource_ptr->type != type)
+		return NULL;
+
+	return resource_ptr;
+}
+
+static OPAL_INLINE Opal_BarrierStageFlags graph_getDefaultStages(Opal_GraphPassType type)
+{
+	switch (type)
+	{
+		case OPAL_GRAPH_PASS_TYPE_GRAPHICS: return (Opal_BarrierStageFlags)(OPAL_BARRIER_STAGE_GRAPHICS_VERTEX | OPAL_BARRIER_STAGE_GRAPHICS_FRAGMENT);
+		case OPAL_GRAPH_PASS_TYPE_COMPUTE: return OPAL_BARRIER_STAGE_COMPUTE;
+		case OPAL_GRAPH_PASS_TYPE_RAYTRACE: return OPAL_BARRIER_STAGE_RAYTRACE;
+		case OPAL_GRAPH_PASS_TYPE_COPY: return OPAL_BARRIER_STAGE_COPY;
+		case OPAL_GRAPH_PASS_TYPE_ACCELERATION_STRUCTURE: return OPAL_BARRIER_STAGE_ACCELERATION_STRUCTURE;
+		default: assert(0); break;
+	}
+
+	return OPAL_BARRIER_STAGE_NONE;
+}
+
+static Opal_Result graph_addResource(Graph_Graph *graph, Graph_ResourceType type, Opal_GraphResource *resource)
+{
+	assert(graph);
+	assert(resource);
+
+	graph_grow((void **)&graph->resources, &graph->resources_capacity, graph->num_resources + 1, sizeof(Graph_Resource));
+
+	Graph_Resource *resource_ptr = &graph->resources[graph->num_resources++];
+	memset(resource_ptr, 0, sizeof(Graph_Resource));
+
+	resource_ptr->type = type;
+	resource_ptr->physical = GRAPH_INVALID_INDEX;
+
+	*resource = (Opal_GraphResource)graph->num_resources;
+	return OPAL_SUCCESS;
+}
+
+static Opal_Result graph_addAccess(Graph_Graph *graph, const Graph_Pass *pass, uint32_t resource, uint32_t state, Opal_BarrierStageFlags stages, uint32_t read, uint32_t write)
+{
+	assert(graph);
+	assert(pass);
+
+	// note: the same resource can be used only in one state by a pass, repeated uses are merged
+	for (uint32_t i = 0; i < graph->num_accesses - pass->first_access; ++i)
+	{
+		Graph_Access *access = &graph->accesses[pass->first_access + i];
+		if (access->resource != resource)
+			continue;
+
+		if (access->state != state)
+			return OPAL_INVALID_GRAPH;
+
+		access->stages |= stages;
+		access->read |= read;
+		access->write |= write;
+		return OPAL_SUCCESS;
+	}
+
+	graph_grow((void **)&graph->accesses, &graph->accesses_capacity, graph->num_accesses + 1, sizeof(Graph_Access));
+
+	Graph_Access *access = &graph->accesses[graph->num_accesses++];
+	access->resource = resource;
+	access->state = state;
+	access->stages = stages;
+	access->read = read;
+	access->write = write;
+
+	return OPAL_SUCCESS;
+}
+
+static Opal_Result graph_addAttachment(Graph_Graph *graph, const Graph_Pass *pass, const Opal_GraphAttachment *attachment)
+{
+	assert(graph);
+	assert(pass);
+	assert(attachment);
+
+	Graph_Resource *texture = graph_getResource(graph, attachment->texture, GRAPH_RESOURCE_TYPE_TEXTURE);
+	if (texture == NULL)
+		return OPAL_INVALID_GRAPH;
+
+	uint32_t read = (attachment->load_op == OPAL_LOAD_OP_LOAD);
+
+	Opal_Result result = graph_addAccess(graph, pass, (uint32_t)(attachment->texture - 1), OPAL_TEXTURE_STATE_FRAMEBUFFER_ATTACHMENT, OPAL_BARRIER_STAGE_GRAPHICS_FRAGMENT, read, 1);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	if (attachment->resolve_texture != OPAL_NULL_HANDLE)
+	{
+		Graph_Resource *resolve_texture = graph_getResource(graph, attachment->resolve_texture, GRAPH_RESOURCE_TYPE_TEXTURE);
+		if (resolve_texture == NULL)
+			return OPAL_INVALID_GRAPH;
+
+		result = graph_addAccess(graph, pass, (uint32_t)(attachment->resolve_texture - 1), OPAL_TEXTURE_STATE_RESOLVE_DST, OPAL_BARRIER_STAGE_GRAPHICS_FRAGMENT, 0, 1);
+		if (result != OPAL_SUCCESS)
+			return result;
+	}
+
+	graph_grow((void **)&graph->attachments, &graph->attachments_capacity, graph->num_attachments + 1, sizeof(Opal_GraphAttachment));
+	graph->attachments[graph->num_attachments++] = *attachment;
+
+	return OPAL_SUCCESS;
+}
+
+static Opal_Result graph_addPassResources(Graph_Graph *graph, Graph_Pass *pass, const Opal_GraphPassDesc *desc)
+{
+	assert(graph);
+	assert(pass);
+	assert(desc);
+
+	Opal_BarrierStageFlags default_stages = graph_getDefaultStages(desc->type);
+
+	for (uint32_t i = 0; i < desc->num_buffer_accesses; ++i)
+	{
+		const Opal_GraphBufferAccess *access = &desc->buffer_accesses[i];
+
+		Graph_Resource *buffer = graph_getResource(graph, access->buffer, GRAPH_RESOURCE_TYPE_BUFFER);
+		if (buffer == NULL)
+			return OPAL_INVALID_GRAPH;
+
+		Opal_BarrierStageFlags stages = (access->stages != OPAL_BARRIER_STAGE_NONE) ? access->stages : default_stages;
+		uint32_t write = (access->state != OPAL_BUFFER_STATE_GENERIC_READ);
+		uint32_t read = (access->state != OPAL_BUFFER_STATE_COPY_DST);
+
+		Opal_Result result = graph_addAccess(graph, pass, (uint32_t)(access->buffer - 1), access->state, stages, read, write);
+		if (result != OPAL_SUCCESS)
+			return result;
+	}
+
+	for (uint32_t i = 0; i < desc->num_texture_accesses; ++i)
+	{
+		const Opal_GraphTextureAccess *access = &desc->texture_accesses[i];
+
+		Graph_Resource *texture = graph_getResource(graph, access->texture, GRAPH_RESOURCE_TYPE_TEXTURE);
+		if (texture == NULL || access->state == OPAL_TEXTURE_STATE_UNDEFINED)
+			return OPAL_INVALID_GRAPH;
+
+		Opal_BarrierStageFlags stages = (access->stages != OPAL_BARRIER_STAGE_NONE) ? access->stages : default_stages;
+		uint32_t write = 0;
+		uint32_t read = 0;
+
+		switch (access->state)
+		{
+			case OPAL_TEXTURE_STATE_UNORDERED_ACCESS: write = 1; read = 1; break;
+			case OPAL_TEXTURE_STATE_FRAMEBUFFER_ATTACHMENT:
+			case OPAL_TEXTURE_STATE_COPY_DST:
+			case OPAL_TEXTURE_STATE_RESOLVE_DST: write = 1; break;
+			default: read = 1; break;
+		}
+
+		Opal_Result result = graph_addAccess(graph, pass, (uint32_t)(access->texture - 1), access->state, stages, read, write);
+		if (result != OPAL_SUCCESS)
+			return result;
+	}
+
+	if (desc->type != OPAL_GRAPH_PASS_TYPE_GRAPHICS)
+		return OPAL_SUCCESS;
+
+	pass->first_attachment = graph->num_attachments;
+
+	for (uint32_t i = 0; i < desc->num_color_attachments; ++i)
+	{
+		Opal_Result result = graph_addAttachment(graph, pass, &desc->color_attachments[i]);
+		if (result != OPAL_SUCCESS)
+			return result;
+
+		pass->num_color_attachments++;
+	}
+
+	if (desc->depth_stencil_attachment)
+	{
+		Opal_Result result = graph_addAttachment(graph, pass, desc->depth_stencil_attachment);
+		if (result != OPAL_SUCCESS)
+			return result;
+
+		pass->has_depth_stencil_attachment = 1;
+	}
+
+	return OPAL_SUCCESS;
+}
+
+/*
+ */
+static void graph_fillFramebufferAttachment(const Graph_Graph *graph, const Opal_GraphAttachment *attachment, Opal_FramebufferAttachment *framebuffer_attachment)
+{
+	assert(graph);
+	assert(attachment);
+	assert(framebuffer_attachment);
+
+	memset(framebuffer_attachment, 0, sizeof(Opal_FramebufferAttachment));
+
+	framebuffer_attachment->texture_view = graph->resources[attachment->texture - 1].texture_view;
+	framebuffer_attachment->load_op = attachment->load_op;
+	framebuffer_attachment->store_op = attachment->store_op;
+	framebuffer_attachment->clear_value = attachment->clear_value;
+
+	if (attachment->resolve_texture != OPAL_NULL_HANDLE)
+		framebuffer_attachment->resolve_texture_view = graph->resources[attachment->resolve_texture - 1].texture_view;
+}
+
+static Opal_Result graph_beginPass(Graph_Graph *graph, const Graph_Pass *pass, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(graph);
+	assert(pass);
+
+	Opal_Device device = graph->device;
+
+	switch (pass->type)
+	{
+		case OPAL_GRAPH_PASS_TYPE_GRAPHICS:
+		{
+			uint32_t num_attachments = pass->num_color_attachments + pass->has_depth_stencil_attachment;
+			graph_grow((void **)&graph->framebuffer_attachments, &graph->framebuffer_attachments_capacity, (num_attachments > 0) ? num_attachments : 1, sizeof(Opal_FramebufferAttachment));
+
+			for (uint32_t i = 0; i < num_attachments; ++i)
+				graph_fillFramebufferAttachment(graph, &graph->attachments[pass->first_attachment + i], &graph->framebuffer_attachments[i]);
+
+			Opal_FramebufferDesc framebuffer = {0};
+			framebuffer.num_color_attachments = pass->num_color_attachments;
+			framebuffer.color_attachments = graph->framebuffer_attachments;
+
+			if (pass->has_depth_stencil_attachment)
+				framebuffer.depth_stencil_attachment = &graph->framebuffer_attachments[pass->num_color_attachments];
+
+			return opalCmdBeginGraphicsPass(device, command_buffer, &framebuffer, barriers);
+		}
+
+		case OPAL_GRAPH_PASS_TYPE_COMPUTE: return opalCmdBeginComputePass(device, command_buffer, barriers);
+		case OPAL_GRAPH_PASS_TYPE_RAYTRACE: return opalCmdBeginRaytracePass(device, command_buffer, barriers);
+		case OPAL_GRAPH_PASS_TYPE_COPY: return opalCmdBeginCopyPass(device, command_buffer, barriers);
+		case OPAL_GRAPH_PASS_TYPE_ACCELERATION_STRUCTURE: return opalCmdBeginAccelerationStructurePass(device, command_buffer, barriers);
+		default: assert(0); break;
+	}
+
+	return OPAL_INTERNAL_ERROR;
+}
+
+static Opal_Result graph_endPass(Graph_Graph *graph, const Graph_Pass *pass, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(graph);
+	assert(pass);
+
+	Opal_Device device = graph->device;
+
+	switch (pass->type)
+	{
+		case OPAL_GRAPH_PASS_TYPE_GRAPHICS: return opalCmdEndGraphicsPass(device, command_buffer, barriers);
+		case OPAL_GRAPH_PASS_TYPE_COMPUTE: return opalCmdEndComputePass(device, command_buffer, barriers);
+		case OPAL_GRAPH_PASS_TYPE_RAYTRACE: return opalCmdEndRaytracePass(device, command_buffer, barriers);
+		case OPAL_GRAPH_PASS_TYPE_COPY: return opalCmdEndCopyPass(device, command_buffer, barriers);
+		case OPAL_GRAPH_PASS_TYPE_ACCELERATION_STRUCTURE: return opalCmdEndAccelerationStructurePass(device, command_buffer, barriers);
+		default: assert(0); break;
+	}
+
+	return OPAL_INTERNAL_ERROR;
+}
+
+static Opal_Result graph_record(Graph_Graph *graph, Opal_CommandBuffer command_buffer)
+{
+	assert(graph);
+
+	for (uint32_t i = 0; i < graph->num_ordered; ++i)
+	{
+		const Graph_Pass *pass = &graph->passes[graph->order[i]];
+
+		Opal_PassBarriersDesc begin_barriers = {0};
+		begin_barriers.num_barriers = graph->begin_offsets[i + 1] - graph->begin_offsets[i];
+		begin_barriers.barriers = &graph->begin_barriers[graph->begin_offsets[i]];
+
+		Opal_PassBarriersDesc end_barriers = {0};
+		end_barriers.num_barriers = graph->end_offsets[i + 1] - graph->end_offsets[i];
+		end_barriers.barriers = &graph->end_barriers[graph->end_offsets[i]];
+
+		Opal_Result result = graph_beginPass(graph, pass, command_buffer, (begin_barriers.num_barriers > 0) ? &begin_barriers : NULL);
+		if (result != OPAL_SUCCESS)
+			return result;
+
+		if (pass->callback)
+			pass->callback(pass->user_data, (Opal_Graph)graph, command_buffer);
+
+		result = graph_endPass(graph, pass, command_buffer, (end_barriers.num_barriers > 0) ? &end_barriers : NULL);
+		if (result != OPAL_SUCCESS)
+			return result;
+	}
+
+	return OPAL_SUCCESS;
+}
+
+/*
+ */
+Opal_Result graph_opalCreateGraph(Opal_Device device, Opal_Graph *graph)
+{
+	assert(device);
+	assert(graph);
+
+	Graph_Graph *ptr = (Graph_Graph *)malloc(sizeof(Graph_Graph));
+	assert(ptr);
+
+	memset(ptr, 0, sizeof(Graph_Graph));
+	ptr->device = device;
+
+	*graph = (Opal_Graph)ptr;
+	return OPAL_SUCCESS;
+}
+
+Opal_Result graph_opalResetGraph(Opal_Graph graph)
+{
+	assert(graph);
+
+	Graph_Graph *ptr = (Graph_Graph *)graph;
+
+	ptr->num_passes = 0;
+	ptr->num_accesses = 0;
+	ptr->num_attachments = 0;
+	ptr->num_resources = 0;
+	ptr->num_ordered = 0;
+
+	return OPAL_SUCCESS;
+}
+
+Opal_Result graph_opalImportGraphBuffer(Opal_Graph graph, Opal_Buffer buffer, Opal_BufferState initial_state, Opal_BufferState final_state, Opal_GraphResource *resource)
+{
+	assert(graph);
+	assert(buffer);
+	assert(resource);
+
+	Graph_Graph *ptr = (Graph_Graph *)graph;
+
+	Opal_Result result = graph_addResource(ptr, GRAPH_RESOURCE_TYPE_BUFFER, resource);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	Graph_Resource *resource_ptr = &ptr->resources[*resource - 1];
+	resource_ptr->imported = 1;
+	resource_ptr->buffer = buffer;
+	resource_ptr->initial_state = initial_state;
+	resource_ptr->final_state = final_state;
+
+	return OPAL_SUCCESS;
+}
+
+Opal_Result graph_opalImportGraphTexture(Opal_Graph graph, Opal_TextureView texture_view, Opal_TextureState initial_state, Opal_TextureState final_state, Opal_GraphResource *resource)
+{
+	assert(graph);
+	assert(texture_view);
+	assert(resource);
+
+	Graph_Graph *ptr = (Graph_Graph *)graph;
+
+	Opal_Result result = graph_addResource(ptr, GRAPH_RESOURCE_TYPE_TEXTURE, resource);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	Graph_Resource *resource_ptr = &ptr->resources[*resource - 1];
+	resource_ptr->imported = 1;
+	resource_ptr->texture_view = texture_view;
+	resource_ptr->initial_state = initial_state;
+	resource_ptr->final_state = final_state;
+
+	return OPAL_SUCCESS;
+}
+
+Opal_Result graph_opalCreateGraphBuffer(Opal_Graph graph, const Opal_BufferDesc *desc, Opal_GraphResource *resource)
+{
+	assert(graph);
+	assert(desc);
+	assert(resource);
+
+	Graph_Graph *ptr = (Graph_Graph *)graph;
+
+	Opal_Result result = graph_addResource(ptr, GRAPH_RESOURCE_TYPE_BUFFER, resource);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	ptr->resources[*resource - 1].buffer_desc = *desc;
+	return OPAL_SUCCESS;
+}
+
+Opal_Result graph_opalCreateGraphTexture(Opal_Graph graph, const Opal_TextureDesc *desc, Opal_GraphResource *resource)
+{
+	assert(graph);
+	assert(desc);
+	assert(resource);
+
+	Graph_Graph *ptr = (Graph_Graph *)graph;
+
+	Opal_Result result = graph_addResource(ptr, GRAPH_RESOURCE_TYPE_TEXTURE, resource);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	ptr->resources[*resource - 1].texture_desc = *desc;
+	return OPAL_SUCCESS;
+}
+
+Opal_Result graph_opalAddGraphPass(Opal_Graph graph, const Opal_GraphPassDesc *desc)
+{
+	assert(graph);
+	assert(desc);
+
+	Graph_Graph *ptr = (Graph_Graph *)graph;
+
+	if (desc->type >= OPAL_GRAPH_PASS_TYPE_ENUM_MAX)
+		return OPAL_INVALID_GRAPH;
+
+	Graph_Pass pass = {0};
+	pass.type = desc->type;
+	pass.flags = desc->flags;
+	pass.first_access = ptr->num_accesses;
+	pass.callback = desc->callback;
+	pass.user_data = desc->user_data;
+
+	uint32_t num_attachments = ptr->num_attachments;
+
+	Opal_Result result = graph_addPassResources(ptr, &pass, desc);
+	if (result != OPAL_SUCCESS)
+	{
+		ptr->num_accesses = pass.first_access;
+		ptr->num_attachments = num_attachments;
+		return result;
+	}
+
+	pass.num_accesses = ptr->num_accesses - pass.first_access;
+
+	graph_grow((void **)&ptr->passes, &ptr->passes_capacity, ptr->num_passes + 1, sizeof(Graph_Pass));
+	ptr->passes[ptr->num_passes++] = pass;
+
+	return OPAL_SUCCESS;
+}
+
+Opal_Result graph_opalGetGraphBuffer(Opal_Graph graph, Opal_GraphResource resource, Opal_Buffer *buffer)
+{
+	assert(graph);
+	assert(buffer);
+
+	Graph_Graph *ptr = (Graph_Graph *)graph;
+
+	const Graph_Resource *resource_ptr = graph_getResource(ptr, resource, GRAPH_RESOURCE_TYPE_BUFFER);
+	if (resource_ptr == NULL || resource_ptr->buffer == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_GRAPH;
+
+	*buffer = resource_ptr->buffer;
+	return OPAL_SUCCESS;
+}
+
+Opal_Result graph_opalGetGraphTextureView(Opal_Graph graph, Opal_GraphResource resource, Opal_TextureView *texture_view)
+{
+	assert(graph);
+	assert(texture_view);
+
+	Graph_Graph *ptr = (Graph_Graph *)graph;
+
+	const Graph_Resource *resource_ptr = graph_getResource(ptr, resource, GRAPH_RESOURCE_TYPE_TEXTURE);
+	if (resource_ptr == NULL || resource_ptr->texture_view == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_GRAPH;
+
+	*texture_view = resource_ptr->texture_view;
+	return OPAL_SUCCESS;
+}
+
+Opal_Result graph_opalExecuteGraph(Opal_Graph graph, Opal_CommandBuffer command_buffer)
+{
+	assert(graph);
+	assert(command_buffer);
+
+	Graph_Graph *ptr = (Graph_Graph *)graph;
+
+	Opal_Result result = graph_compile(ptr);
+	if (result == OPAL_SUCCESS)
+		result = graph_record(ptr, command_buffer);
+
+	// note: the previous execution of this graph has finished on the GPU by the time it's rebuilt,
+	//       so physical resources no pass used this time can be released right away
+	graph_releaseUnusedPhysicals(ptr);
+
+	return result;
+}
+
+Opal_Result graph_opalDestroyGraph(Opal_Graph graph)
+{
+	assert(graph);
+
+	Graph_Graph *ptr = (Graph_Graph *)graph;
+
+	for (uint32_t i = 0; i < ptr->num_physicals; ++i)
+		ptr->physicals[i].used = 0;
+
+	graph_releaseUnusedPhysicals(ptr);
+
+	for (uint32_t i = 0; i < ptr->num_fences; ++i)
+		opalDestroyFence(ptr->device, ptr->fences[i]);
+
+	free(ptr->passes);
+	free(ptr->accesses);
+	free(ptr->attachments);
+	free(ptr->resources);
+	free(ptr->physicals);
+	free(ptr->fences);
+	free(ptr->order);
+	free(ptr->edges);
+	free(ptr->successors);
+	free(ptr->readers);
+	free(ptr->trackers);
+	free(ptr->groups);
+	free(ptr->group_stages);
+	free(ptr->barriers);
+	free(ptr->pending);
+	free(ptr->buffer_transitions);
+	free(ptr->texture_transitions);
+	free(ptr->begin_barriers);
+	free(ptr->end_barriers);
+	free(ptr->begin_offsets);
+	free(ptr->end_offsets);
+	free(ptr->framebuffer_attachments);
+	free(ptr);
+
+	return OPAL_SUCCESS;
+}
@@ -0,0 +1,839 @@
+#include "graph_internal.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define GRAPH_DEFAULT_CAPACITY 16
+
+/*
+ */
+static OPAL_INLINE Graph_Tracker *graph_getTracker(Graph_Graph *graph, uint32_t resource)
+{
+	assert(graph);
+	assert(resource < graph->num_resources);
+
+	const Graph_Resource *resource_ptr = &graph->resources[resource];
+	if (resource_ptr->imported)
+		return &graph->trackers[resource];
+
+	assert(resource_ptr->physical < graph->num_physicals);
+	return &graph->trackers[graph->num_resources + resource_ptr->physical];
+}
+
+static OPAL_INLINE void graph_addEdge(Graph_Graph *graph, uint32_t from, uint32_t to)
+{
+	assert(graph);
+	assert(from < to);
+
+	graph_grow((void **)&graph->edges, &graph->edges_capacity, graph->num_edges + 1, sizeof(Graph_Edge));
+
+	Graph_Edge *edge = &graph->edges[graph->num_edges++];
+	edge->from = from;
+	edge->to = to;
+}
+
+static OPAL_INLINE Graph_PendingTransition *graph_addPending(Graph_Graph *graph, uint32_t barrier, uint32_t position, const Graph_Tracker *tracker, uint32_t state_after)
+{
+	assert(graph);
+	assert(tracker);
+
+	graph_grow((void **)&graph->pending, &graph->pending_capacity, graph->num_pending + 1, sizeof(Graph_PendingTransition));
+
+	Graph_PendingTransition *pending = &graph->pending[graph->num_pending++];
+	pending->barrier = barrier;
+	pending->position = position;
+	pending->type = tracker->type;
+	pending->handle = tracker->handle;
+	pending->state_before = tracker->state;
+	pending->state_after = state_after;
+	pending->wait_stages = OPAL_BARRIER_STAGE_NONE;
+
+	return pending;
+}
+
+static void graph_appendTransition(Graph_Graph *graph, Graph_Barrier *barrier, const Graph_PendingTransition *pending)
+{
+	assert(graph);
+	assert(barrier);
+	assert(pending);
+
+	if (pending->type == GRAPH_RESOURCE_TYPE_BUFFER)
+	{
+		graph_grow((void **)&graph->buffer_transitions, &graph->buffer_transitions_capacity, graph->num_buffer_transitions + 1, sizeof(Opal_BufferTransitionDesc));
+
+		if (barrier->num_buffer_transitions == 0)
+			barrier->first_buffer_transition = graph->num_buffer_transitions;
+
+		Opal_BufferTransitionDesc *transition = &graph->buffer_transitions[graph->num_buffer_transitions++];
+		transition->buffer = (Opal_Buffer)pending->handle;
+		transition->state_before = (Opal_BufferState)pending->state_before;
+		transition->state_after = (Opal_BufferState)pending->state_after;
+
+		barrier->num_buffer_transitions++;
+	}
+	else
+	{
+		graph_grow((void **)&graph->texture_transitions, &graph->texture_transitions_capacity, graph->num_texture_transitions + 1, sizeof(Opal_TextureTransitionDesc));
+
+		if (barrier->num_texture_transitions == 0)
+			barrier->first_texture_transition = graph->num_texture_transitions;
+
+		Opal_TextureTransitionDesc *transition = &graph->texture_transitions[graph->num_texture_transitions++];
+		transition->texture_view = (Opal_TextureView)pending->handle;
+		transition->state_before = (Opal_TextureState)pending->state_before;
+		transition->state_after = (Opal_TextureState)pending->state_after;
+
+		barrier->num_texture_transitions++;
+	}
+}
+
+static uint32_t graph_addBarrier(Graph_Graph *graph, uint32_t signal_position, uint32_t wait_position)
+{
+	assert(graph);
+
+	graph_grow((void **)&graph->barriers, &graph->barriers_capacity, graph->num_barriers + 1, sizeof(Graph_Barrier));
+
+	Graph_Barrier *barrier = &graph->barriers[graph->num_barriers];
+	memset(barrier, 0, sizeof(Graph_Barrier));
+
+	barrier->signal_position = signal_position;
+	barrier->wait_position = wait_position;
+
+	return graph->num_barriers++;
+}
+
+static int graph_comparePending(const void *a, const void *b)
+{
+	const Graph_PendingTransition *pending_a = (const Graph_PendingTransition *)a;
+	const Graph_PendingTransition *pending_b = (const Graph_PendingTransition *)b;
+
+	if (pending_a->position != pending_b->position)
+		return (pending_a->position < pending_b->position) ? -1 : 1;
+
+	return 0;
+}
+
+/*
+ */
+static void graph_cull(Graph_Graph *graph)
+{
+	assert(graph);
+
+	for (uint32_t i = 0; i < graph->num_resources; ++i)
+		graph->resources[i].needed = graph->resources[i].imported;
+
+	// note: walk passes backwards, a pass survives if it writes something that is read later or is imported
+	for (uint32_t i = graph->num_passes; i-- > 0;)
+	{
+		Graph_Pass *pass = &graph->passes[i];
+		pass->alive = (pass->flags & OPAL_GRAPH_PASS_FLAGS_NEVER_CULL) != 0;
+
+		for (uint32_t j = 0; j < pass->num_accesses && !pass->alive; ++j)
+		{
+			const Graph_Access *access = &graph->accesses[pass->first_access + j];
+			pass->alive = access->write && graph->resources[access->resource].needed;
+		}
+
+		if (!pass->alive)
+			continue;
+
+		for (uint32_t j = 0; j < pass->num_accesses; ++j)
+		{
+			const Graph_Access *access = &graph->accesses[pass->first_access + j];
+			if (access->read)
+				graph->resources[access->resource].needed = 1;
+		}
+	}
+}
+
+static void graph_buildDependencies(Graph_Graph *graph)
+{
+	assert(graph);
+
+	graph->num_edges = 0;
+	graph->num_readers = 0;
+
+	for (uint32_t i = 0; i < graph->num_resources; ++i)
+	{
+		graph->resources[i].last_writer = GRAPH_INVALID_INDEX;
+		graph->resources[i].first_reader = GRAPH_INVALID_INDEX;
+	}
+
+	// note: declaration order defines the meaning of the graph, edges are read after write,
+	//       write after read and write after write hazards on virtual resources
+	for (uint32_t i = 0; i < graph->num_passes; ++i)
+	{
+		const Graph_Pass *pass = &graph->passes[i];
+		if (!pass->alive)
+			continue;
+
+		for (uint32_t j = 0; j < pass->num_accesses; ++j)
+		{
+			const Graph_Access *access = &graph->accesses[pass->first_access + j];
+			Graph_Resource *resource = &graph->resources[access->resource];
+
+			if (resource->last_writer != GRAPH_INVALID_INDEX)
+				graph_addEdge(graph, resource->last_writer, i);
+
+			if (access->write)
+			{
+				for (uint32_t reader = resource->first_reader; reader != GRAPH_INVALID_INDEX; reader = graph->readers[reader * 2 + 1])
+					graph_addEdge(graph, graph->readers[reader * 2], i);
+
+				resource->first_reader = GRAPH_INVALID_INDEX;
+				resource->last_writer = i;
+				continue;
+			}
+
+			graph_grow((void **)&graph->readers, &graph->readers_capacity, (graph->num_readers + 1) * 2, sizeof(uint32_t));
+
+			graph->readers[graph->num_readers * 2] = i;
+			graph->readers[graph->num_readers * 2 + 1] = resource->first_reader;
+			resource->first_reader = graph->num_readers++;
+		}
+	}
+
+	for (uint32_t i = 0; i < graph->num_passes; ++i)
+	{
+		Graph_Pass *pass = &graph->passes[i];
+		pass->num_dependencies = 0;
+		pass->num_successors = 0;
+		pass->first_successor = 0;
+	}
+
+	for (uint32_t i = 0; i < graph->num_edges; ++i)
+	{
+		graph->passes[graph->edges[i].from].num_successors++;
+		graph->passes[graph->edges[i].to].num_dependencies++;
+	}
+
+	uint32_t offset = 0;
+	for (uint32_t i = 0; i < graph->num_passes; ++i)
+	{
+		Graph_Pass *pass = &graph->passes[i];
+		pass->first_successor = offset;
+		offset += pass->num_successors;
+		pass->num_successors = 0;
+	}
+
+	graph_grow((void **)&graph->successors, &graph->successors_capacity, (offset > 0) ? offset : 1, sizeof(uint32_t));
+
+	for (uint32_t i = 0; i < graph->num_edges; ++i)
+	{
+		Graph_Pass *pass = &graph->passes[graph->edges[i].from];
+		graph->successors[pass->first_successor + pass->num_successors++] = graph->edges[i].to;
+	}
+}
+
+static void graph_sort(Graph_Graph *graph)
+{
+	assert(graph);
+
+	graph->num_ordered = 0;
+	graph_grow((void **)&graph->order, &graph->order_capacity, (graph->num_passes > 0) ? graph->num_passes : 1, sizeof(uint32_t));
+
+	for (uint32_t i = 0; i < graph->num_passes; ++i)
+	{
+		graph->passes[i].position = GRAPH_INVALID_INDEX;
+		graph->passes[i].ready_position = 0;
+	}
+
+	// note: among the passes that are ready, pick the one whose inputs were produced the earliest,
+	//       so freshly unblocked consumers are pushed back and split barriers get work to overlap with
+	for (;;)
+	{
+		uint32_t best = GRAPH_INVALID_INDEX;
+
+		for (uint32_t i = 0; i < graph->num_passes; ++i)
+		{
+			const Graph_Pass *pass = &graph->passes[i];
+			if (!pass->alive || pass->position != GRAPH_INVALID_INDEX || pass->num_dependencies > 0)
+				continue;
+
+			if (best == GRAPH_INVALID_INDEX || pass->ready_position < graph->passes[best].ready_position)
+				best = i;
+		}
+
+		if (best == GRAPH_INVALID_INDEX)
+			break;
+
+		Graph_Pass *pass = &graph->passes[best];
+		pass->position = graph->num_ordered;
+		graph->order[graph->num_ordered++] = best;
+
+		for (uint32_t i = 0; i < pass->num_successors; ++i)
+		{
+			Graph_Pass *successor = &graph->passes[graph->successors[pass->first_successor + i]];
+
+			assert(successor->num_dependencies > 0);
+			successor->num_dependencies--;
+
+			if (successor->ready_position < pass->position + 1)
+				successor->ready_position = pass->position + 1;
+		}
+	}
+}
+
+/*
+ */
+static Opal_Result graph_createPhysical(Graph_Graph *graph, const Graph_Resource *resource, uint32_t *index)
+{
+	assert(graph);
+	assert(resource);
+	assert(index);
+
+	graph_grow((void **)&graph->physicals, &graph->physicals_capacity, graph->num_physicals + 1, sizeof(Graph_Physical));
+
+	Graph_Physical *physical = &graph->physicals[graph->num_physicals];
+	memset(physical, 0, sizeof(Graph_Physical));
+
+	physical->type = resource->type;
+	physical->buffer_desc = resource->buffer_desc;
+	physical->texture_desc = resource->texture_desc;
+	physical->last_use = GRAPH_INVALID_INDEX;
+
+	if (resource->type == GRAPH_RESOURCE_TYPE_BUFFER)
+	{
+		Opal_Result result = opalCreateBuffer(graph->device, &physical->buffer_desc, &physical->buffer);
+		if (result != OPAL_SUCCESS)
+			return result;
+
+		physical->state = physical->buffer_desc.initial_state;
+	}
+	else
+	{
+		Opal_Result result = opalCreateTexture(graph->device, &physical->texture_desc, &physical->texture);
+		if (result != OPAL_SUCCESS)
+			return result;
+
+		Opal_TextureViewDesc view_desc = {0};
+		view_desc.texture = physical->texture;
+		view_desc.mip_count = physical->texture_desc.mip_count;
+		view_desc.layer_count = physical->texture_desc.layer_count;
+
+		switch (physical->texture_desc.type)
+		{
+			case OPAL_TEXTURE_TYPE_1D: view_desc.type = OPAL_TEXTURE_VIEW_TYPE_1D; break;
+			case OPAL_TEXTURE_TYPE_3D: view_desc.type = OPAL_TEXTURE_VIEW_TYPE_3D; break;
+			default: view_desc.type = (view_desc.layer_count > 1) ? OPAL_TEXTURE_VIEW_TYPE_2D_ARRAY : OPAL_TEXTURE_VIEW_TYPE_2D; break;
+		}
+
+		result = opalCreateTextureView(graph->device, &view_desc, &physical->texture_view);
+		if (result != OPAL_SUCCESS)
+		{
+			opalDestroyTexture(graph->device, physical->texture);
+			return result;
+		}
+
+		physical->state = OPAL_TEXTURE_STATE_UNDEFINED;
+	}
+
+	*index = graph->num_physicals++;
+	return OPAL_SUCCESS;
+}
+
+static OPAL_INLINE uint32_t graph_isCompatible(const Graph_Physical *physical, const Graph_Resource *resource)
+{
+	assert(physical);
+	assert(resource);
+
+	if (physical->type != resource->type)
+		return 0;
+
+	if (physical->type == GRAPH_RESOURCE_TYPE_BUFFER)
+		return memcmp(&physical->buffer_desc, &resource->buffer_desc, sizeof(Opal_BufferDesc)) == 0;
+
+	return memcmp(&physical->texture_desc, &resource->texture_desc, sizeof(Opal_TextureDesc)) == 0;
+}
+
+static Opal_Result graph_alias(Graph_Graph *graph)
+{
+	assert(graph);
+
+	for (uint32_t i = 0; i < graph->num_resources; ++i)
+	{
+		Graph_Resource *resource = &graph->resources[i];
+		resource->physical = GRAPH_INVALID_INDEX;
+		resource->first_use = GRAPH_INVALID_INDEX;
+		resource->last_use = 0;
+	}
+
+	for (uint32_t i = 0; i < graph->num_physicals; ++i)
+	{
+		graph->physicals[i].last_use = GRAPH_INVALID_INDEX;
+		graph->physicals[i].used = 0;
+	}
+
+	for (uint32_t i = 0; i < graph->num_ordered; ++i)
+	{
+		const Graph_Pass *pass = &graph->passes[graph->order[i]];
+
+		for (uint32_t j = 0; j < pass->num_accesses; ++j)
+		{
+			Graph_Resource *resource = &graph->resources[graph->accesses[pass->first_access + j].resource];
+
+			if (resource->first_use == GRAPH_INVALID_INDEX)
+				resource->first_use = i;
+
+			resource->last_use = i;
+		}
+	}
+
+	// note: transient resources are visited in order of their first use, a physical resource with the same desc
+	//       whose previous owner is no longer used by then is reused, so lifetimes that don't overlap share memory
+	for (uint32_t i = 0; i < graph->num_ordered; ++i)
+	{
+		const Graph_Pass *pass = &graph->passes[graph->order[i]];
+
+		for (uint32_t j = 0; j < pass->num_accesses; ++j)
+		{
+			Graph_Resource *resource = &graph->resources[graph->accesses[pass->first_access + j].resource];
+
+			if (resource->imported || resource->physical != GRAPH_INVALID_INDEX)
+				continue;
+
+			uint32_t index = GRAPH_INVALID_INDEX;
+			for (uint32_t k = 0; k < graph->num_physicals; ++k)
+			{
+				const Graph_Physical *physical = &graph->physicals[k];
+				if (!graph_isCompatible(physical, resource))
+					continue;
+
+				if (physical->last_use == GRAPH_INVALID_INDEX || physical->last_use < resource->first_use)
+				{
+					index = k;
+					break;
+				}
+			}
+
+			if (index == GRAPH_INVALID_INDEX)
+			{
+				Opal_Result result = graph_createPhysical(graph, resource, &index);
+				if (result != OPAL_SUCCESS)
+					return result;
+			}
+
+			Graph_Physical *physical = &graph->physicals[index];
+			physical->last_use = resource->last_use;
+			physical->used = 1;
+
+			resource->physical = index;
+			resource->buffer = physical->buffer;
+			resource->texture_view = physical->texture_view;
+		}
+	}
+
+	return OPAL_SUCCESS;
+}
+
+/*
+ */
+static void graph_resetTrackers(Graph_Graph *graph)
+{
+	assert(graph);
+
+	uint32_t num_trackers = graph->num_resources + graph->num_physicals;
+	graph_grow((void **)&graph->trackers, &graph->trackers_capacity, (num_trackers > 0) ? num_trackers : 1, sizeof(Graph_Tracker));
+
+	for (uint32_t i = 0; i < num_trackers; ++i)
+	{
+		Graph_Tracker *tracker = &graph->trackers[i];
+		memset(tracker, 0, sizeof(Graph_Tracker));
+
+		tracker->write_position = GRAPH_INVALID_INDEX;
+		tracker->read_position = GRAPH_INVALID_INDEX;
+		tracker->group = GRAPH_INVALID_INDEX;
+
+		if (i < graph->num_resources)
+		{
+			const Graph_Resource *resource = &graph->resources[i];
+			tracker->type = resource->type;
+			tracker->handle = (resource->type == GRAPH_RESOURCE_TYPE_BUFFER) ? resource->buffer : resource->texture_view;
+			tracker->state = resource->initial_state;
+		}
+		else
+		{
+			const Graph_Physical *physical = &graph->physicals[i - graph->num_resources];
+			tracker->type = physical->type;
+			tracker->handle = (physical->type == GRAPH_RESOURCE_TYPE_BUFFER) ? physical->buffer : physical->texture_view;
+			tracker->state = physical->state;
+		}
+	}
+}
+
+static void graph_buildReadGroups(Graph_Graph *graph)
+{
+	assert(graph);
+
+	uint32_t num_accesses = (graph->num_accesses > 0) ? graph->num_accesses : 1;
+	graph_grow((void **)&graph->groups, &graph->groups_capacity, num_accesses, sizeof(uint32_t));
+	graph_grow((void **)&graph->group_stages, &graph->group_stages_capacity, num_accesses, sizeof(Opal_BarrierStageFlags));
+
+	graph_resetTrackers(graph);
+
+	// note: consecutive reads in the same state form a group, the first one carries the barrier for all of them
+	for (uint32_t i = 0; i < graph->num_ordered; ++i)
+	{
+		const Graph_Pass *pass = &graph->passes[graph->order[i]];
+
+		for (uint32_t j = 0; j < pass->num_accesses; ++j)
+		{
+			uint32_t index = pass->first_access + j;
+			const Graph_Access *access = &graph->accesses[index];
+			Graph_Tracker *tracker = graph_getTracker(graph, access->resource);
+
+			if (!access->write && access->state == tracker->state && tracker->group != GRAPH_INVALID_INDEX)
+			{
+				graph->groups[index] = tracker->group;
+				graph->group_stages[tracker->group] |= access->stages;
+				continue;
+			}
+
+			graph->groups[index] = index;
+			graph->group_stages[index] = access->stages;
+
+			tracker->group = (access->write) ? GRAPH_INVALID_INDEX : index;
+			tracker->state = access->state;
+		}
+	}
+}
+
+static void graph_buildBarriers(Graph_Graph *graph)
+{
+	assert(graph);
+
+	graph->num_barriers = 0;
+	graph->num_pending = 0;
+	graph->num_buffer_transitions = 0;
+	graph->num_texture_transitions = 0;
+
+	graph_resetTrackers(graph);
+
+	for (uint32_t i = 0; i < graph->num_ordered; ++i)
+	{
+		const Graph_Pass *pass = &graph->passes[graph->order[i]];
+		uint32_t first_barrier = graph->num_barriers;
+
+		for (uint32_t j = 0; j < pass->num_accesses; ++j)
+		{
+			uint32_t index = pass->first_access + j;
+			const Graph_Access *access = &graph->accesses[index];
+			Graph_Tracker *tracker = graph_getTracker(graph, access->resource);
+
+			// note: already covered by the barrier of the first read in the group
+			if (graph->groups[index] != index)
+			{
+				tracker->read_position = i;
+				tracker->read_stages |= access->stages;
+				continue;
+			}
+
+			uint32_t signal_position = GRAPH_INVALID_INDEX;
+			Opal_BarrierStageFlags wait_stages = OPAL_BARRIER_STAGE_NONE;
+
+			if (tracker->read_position != GRAPH_INVALID_INDEX)
+			{
+				signal_position = tracker->read_position;
+				wait_stages = tracker->read_stages;
+			}
+			else if (tracker->write_position != GRAPH_INVALID_INDEX)
+			{
+				signal_position = tracker->write_position;
+				wait_stages = tracker->write_stages;
+			}
+
+			uint32_t transition = (access->state != tracker->state);
+
+			// note: reads in the same state as the previous reads don't need anything
+			if (!access->write && !transition)
+				signal_position = GRAPH_INVALID_INDEX;
+
+			if (transition || signal_position != GRAPH_INVALID_INDEX)
+			{
+				uint32_t barrier_index = GRAPH_INVALID_INDEX;
+				for (uint32_t k = first_barrier; k < graph->num_barriers; ++k)
+				{
+					if (graph->barriers[k].signal_position == signal_position)
+					{
+						barrier_index = k;
+						break;
+					}
+				}
+
+				if (barrier_index == GRAPH_INVALID_INDEX)
+					barrier_index = graph_addBarrier(graph, signal_position, i);
+
+				Graph_Barrier *barrier = &graph->barriers[barrier_index];
+				barrier->wait_stages |= wait_stages;
+				barrier->block_stages |= (access->write) ? access->stages : graph->group_stages[index];
+
+				graph_addPending(graph, barrier_index, i, tracker, access->state);
+			}
+
+			if (access->write)
+			{
+				tracker->write_position = i;
+				tracker->write_stages = access->stages;
+				tracker->read_position = GRAPH_INVALID_INDEX;
+				tracker->read_stages = OPAL_BARRIER_STAGE_NONE;
+			}
+			else
+			{
+				tracker->read_position = i;
+				tracker->read_stages = access->stages;
+			}
+
+			tracker->state = access->state;
+		}
+
+		// note: transitions of one barrier must be contiguous
+		for (uint32_t k = first_barrier; k < graph->num_barriers; ++k)
+		{
+			for (uint32_t l = 0; l < graph->num_pending; ++l)
+			{
+				if (graph->pending[l].barrier == k)
+					graph_appendTransition(graph, &graph->barriers[k], &graph->pending[l]);
+			}
+		}
+
+		graph->num_pending = 0;
+	}
+
+	// note: imported resources go to their final state right after the last pass that uses them
+	for (uint32_t i = 0; i < graph->num_resources; ++i)
+	{
+		const Graph_Resource *resource = &graph->resources[i];
+		if (!resource->imported)
+			continue;
+
+		const Graph_Tracker *tracker = &graph->trackers[i];
+		if (tracker->state == resource->final_state)
+			continue;
+
+		uint32_t position = tracker->read_position;
+		Opal_BarrierStageFlags wait_stages = tracker->read_stages;
+
+		if (position == GRAPH_INVALID_INDEX)
+		{
+			position = tracker->write_position;
+			wait_stages = tracker->write_stages;
+		}
+
+		if (position == GRAPH_INVALID_INDEX)
+			continue;
+
+		Graph_PendingTransition *pending = graph_addPending(graph, GRAPH_INVALID_INDEX, position, tracker, resource->final_state);
+		pending->wait_stages = wait_stages;
+	}
+
+	qsort(graph->pending, graph->num_pending, sizeof(Graph_PendingTransition), graph_comparePending);
+
+	for (uint32_t i = 0; i < graph->num_pending; ++i)
+	{
+		const Graph_PendingTransition *pending = &graph->pending[i];
+
+		if (i == 0 || graph->pending[i - 1].position != pending->position)
+			graph_addBarrier(graph, pending->position, GRAPH_INVALID_INDEX);
+
+		Graph_Barrier *barrier = &graph->barriers[graph->num_barriers - 1];
+		barrier->wait_stages |= pending->wait_stages;
+
+		graph_appendTransition(graph, barrier, pending);
+	}
+
+	graph->num_pending = 0;
+
+	for (uint32_t i = 0; i < graph->num_physicals; ++i)
+		graph->physicals[i].state = graph->trackers[graph->num_resources + i].state;
+}
+
+/*
+ */
+static Opal_Result graph_assignFences(Graph_Graph *graph)
+{
+	assert(graph);
+
+	uint32_t num_used_fences = 0;
+
+	for (uint32_t i = 0; i < graph->num_barriers; ++i)
+	{
+		Graph_Barrier *barrier = &graph->barriers[i];
+		barrier->fence = OPAL_NULL_HANDLE;
+
+		if (barrier->signal_position == GRAPH_INVALID_INDEX || barrier->wait_position == GRAPH_INVALID_INDEX)
+			continue;
+
+		if (num_used_fences == graph->num_fences)
+		{
+			graph_grow((void **)&graph->fences, &graph->fences_capacity, graph->num_fences + 1, sizeof(Opal_Fence));
+
+			Opal_Result result = opalCreateFence(graph->device, &graph->fences[graph->num_fences]);
+			if (result != OPAL_SUCCESS)
+				return result;
+
+			graph->num_fences++;
+		}
+
+		barrier->fence = graph->fences[num_used_fences++];
+	}
+
+	return OPAL_SUCCESS;
+}
+
+static void graph_fillBarrierDesc(const Graph_Graph *graph, const Graph_Barrier *barrier, Opal_FenceOp fence_op, Opal_BarrierDesc *desc)
+{
+	assert(graph);
+	assert(barrier);
+	assert(desc);
+
+	memset(desc, 0, sizeof(Opal_BarrierDesc));
+
+	desc->wait_stages = barrier->wait_stages;
+	desc->block_stages = barrier->block_stages;
+	desc->num_buffer_transitions = barrier->num_buffer_transitions;
+	desc->num_texture_transitions = barrier->num_texture_transitions;
+	desc->fence = barrier->fence;
+	desc->fence_op = fence_op;
+
+	if (barrier->num_buffer_transitions > 0)
+		desc->buffer_transitions = &graph->buffer_transitions[barrier->first_buffer_transition];
+
+	if (barrier->num_texture_transitions > 0)
+		desc->texture_transitions = &graph->texture_transitions[barrier->first_texture_transition];
+}
+
+static void graph_buildPassBarriers(Graph_Graph *graph)
+{
+	assert(graph);
+
+	uint32_t num_barriers = (graph->num_barriers > 0) ? graph->num_barriers : 1;
+	uint32_t num_offsets = graph->num_ordered + 1;
+
+	graph_grow((void **)&graph->begin_barriers, &graph->begin_barriers_capacity, num_barriers, sizeof(Opal_BarrierDesc));
+	graph_grow((void **)&graph->end_barriers, &graph->end_barriers_capacity, num_barriers, sizeof(Opal_BarrierDesc));
+	graph_grow((void **)&graph->begin_offsets, &graph->begin_offsets_capacity, num_offsets, sizeof(uint32_t));
+	graph_grow((void **)&graph->end_offsets, &graph->end_offsets_capacity, num_offsets, sizeof(uint32_t));
+
+	memset(graph->begin_offsets, 0, sizeof(uint32_t) * num_offsets);
+	memset(graph->end_offsets, 0, sizeof(uint32_t) * num_offsets);
+
+	for (uint32_t i = 0; i < graph->num_barriers; ++i)
+	{
+		const Graph_Barrier *barrier = &graph->barriers[i];
+
+		if (barrier->wait_position != GRAPH_INVALID_INDEX)
+			graph->begin_offsets[barrier->wait_position + 1]++;
+
+		if (barrier->signal_position != GRAPH_INVALID_INDEX)
+			graph->end_offsets[barrier->signal_position + 1]++;
+	}
+
+	for (uint32_t i = 1; i < num_offsets; ++i)
+	{
+		graph->begin_offsets[i] += graph->begin_offsets[i - 1];
+		graph->end_offsets[i] += graph->end_offsets[i - 1];
+	}
+
+	// note: fenced barriers are split, the fence is updated at the end of the producer pass
+	//       and waited on at the beginning of the consumer pass with the same transitions
+	for (uint32_t i = 0; i < graph->num_barriers; ++i)
+	{
+		const Graph_Barrier *barrier = &graph->barriers[i];
+
+		if (barrier->wait_position != GRAPH_INVALID_INDEX)
+		{
+			uint32_t offset = graph->begin_offsets[barrier->wait_position]++;
+			graph_fillBarrierDesc(graph, barrier, OPAL_FENCE_OP_END, &graph->begin_barriers[offset]);
+		}
+
+		if (barrier->signal_position != GRAPH_INVALID_INDEX)
+		{
+			uint32_t offset = graph->end_offsets[barrier->signal_position]++;
+			graph_fillBarrierDesc(graph, barrier, OPAL_FENCE_OP_BEGIN, &graph->end_barriers[offset]);
+		}
+	}
+
+	// note: offsets were advanced while filling, shift them back so [offsets[i], offsets[i + 1]) is the range of pass i
+	for (uint32_t i = num_offsets - 1; i > 0; --i)
+	{
+		graph->begin_offsets[i] = graph->begin_offsets[i - 1];
+		graph->end_offsets[i] = graph->end_offsets[i - 1];
+	}
+
+	graph->begin_offsets[0] = 0;
+	graph->end_offsets[0] = 0;
+}
+
+/*
+ */
+void graph_grow(void **data, uint32_t *capacity, uint32_t required, uint32_t element_size)
+{
+	assert(data);
+	assert(capacity);
+	assert(element_size > 0);
+
+	if (*capacity >= required)
+		return;
+
+	uint32_t new_capacity = (*capacity > 0) ? *capacity : GRAPH_DEFAULT_CAPACITY;
+	while (new_capacity < required)
+		new_capacity *= 2;
+
+	*data = realloc(*data, (size_t)new_capacity * element_size);
+	assert(*data);
+
+	*capacity = new_capacity;
+}
+
+Opal_Result graph_compile(Graph_Graph *graph)
+{
+	assert(graph);
+
+	graph_cull(graph);
+	graph_buildDependencies(graph);
+	graph_sort(graph);
+
+	Opal_Result result = graph_alias(graph);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	graph_buildReadGroups(graph);
+	graph_buildBarriers(graph);
+
+	result = graph_assignFences(graph);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	graph_buildPassBarriers(graph);
+	return OPAL_SUCCESS;
+}
+
+void graph_releaseUnusedPhysicals(Graph_Graph *graph)
+{
+	assert(graph);
+
+	uint32_t num_physicals = 0;
+
+	for (uint32_t i = 0; i < graph->num_physicals; ++i)
+	{
+		Graph_Physical *physical = &graph->physicals[i];
+
+		if (physical->used)
+		{
+			graph->physicals[num_physicals++] = *physical;
+			continue;
+		}
+
+		if (physical->texture_view != OPAL_NULL_HANDLE)
+			opalDestroyTextureView(graph->device, physical->texture_view);
+
+		if (physical->texture != OPAL_NULL_HANDLE)
+			opalDestroyTexture(graph->device, physical->texture);
+
+		if (physical->buffer != OPAL_NULL_HANDLE)
+			opalDestroyBuffer(graph->device, physical->buffer);
+	}
+
+	graph->num_physicals = num_physicals;
+}
@@ -0,0 +1,202 @@
+#pragma once
+
+#include "opal_internal.h"
+
+#define GRAPH_INVALID_INDEX 0xFFFFFFFF
+
+typedef enum Graph_ResourceType_t
+{
+	GRAPH_RESOURCE_TYPE_BUFFER = 0,
+	GRAPH_RESOURCE_TYPE_TEXTURE,
+} Graph_ResourceType;
+
+typedef struct Graph_Access_t
+{
+	uint32_t resource;
+	uint32_t state;
+	Opal_BarrierStageFlags stages;
+	uint32_t read;
+	uint32_t write;
+} Graph_Access;
+
+typedef struct Graph_Pass_t
+{
+	Opal_GraphPassType type;
+	Opal_GraphPassFlags flags;
+	uint32_t first_access;
+	uint32_t num_accesses;
+	uint32_t first_attachment;
+	uint32_t num_color_attachments;
+	uint32_t has_depth_stencil_attachment;
+	PFN_opalGraphPassCallback callback;
+	void *user_data;
+	uint32_t alive;
+	uint32_t position;
+	uint32_t ready_position;
+	uint32_t num_dependencies;
+	uint32_t first_successor;
+	uint32_t num_successors;
+} Graph_Pass;
+
+typedef struct Graph_Resource_t
+{
+	Graph_ResourceType type;
+	uint32_t imported;
+	Opal_BufferDesc buffer_desc;
+	Opal_TextureDesc texture_desc;
+	Opal_Buffer buffer;
+	Opal_TextureView texture_view;
+	uint32_t initial_state;
+	uint32_t final_state;
+	uint32_t needed;
+	uint32_t physical;
+	uint32_t first_use;
+	uint32_t last_use;
+	uint32_t last_writer;
+	uint32_t first_reader;
+} Graph_Resource;
+
+typedef struct Graph_Physical_t
+{
+	Graph_ResourceType type;
+	Opal_BufferDesc buffer_desc;
+	Opal_TextureDesc texture_desc;
+	Opal_Buffer buffer;
+	Opal_Texture texture;
+	Opal_TextureView texture_view;
+	uint32_t state;
+	uint32_t last_use;
+	uint32_t used;
+} Graph_Physical;
+
+typedef struct Graph_Tracker_t
+{
+	Graph_ResourceType type;
+	uint64_t handle;
+	uint32_t state;
+	uint32_t write_position;
+	Opal_BarrierStageFlags write_stages;
+	uint32_t read_position;
+	Opal_BarrierStageFlags read_stages;
+	uint32_t group;
+} Graph_Tracker;
+
+typedef struct Graph_Barrier_t
+{
+	uint32_t signal_position;
+	uint32_t wait_position;
+	Opal_BarrierStageFlags wait_stages;
+	Opal_BarrierStageFlags block_stages;
+	uint32_t first_buffer_transition;
+	uint32_t num_buffer_transitions;
+	uint32_t first_texture_transition;
+	uint32_t num_texture_transitions;
+	Opal_Fence fence;
+} Graph_Barrier;
+
+typedef struct Graph_PendingTransition_t
+{
+	uint32_t barrier;
+	uint32_t position;
+	Graph_ResourceType type;
+	uint64_t handle;
+	uint32_t state_before;
+	uint32_t state_after;
+	Opal_BarrierStageFlags wait_stages;
+} Graph_PendingTransition;
+
+typedef struct Graph_Edge_t
+{
+	uint32_t from;
+	uint32_t to;
+} Graph_Edge;
+
+typedef struct Graph_Graph_t
+{
+	Opal_Device device;
+
+	Graph_Pass *passes;
+	uint32_t num_passes;
+	uint32_t passes_capacity;
+
+	Graph_Access *accesses;
+	uint32_t num_accesses;
+	uint32_t accesses_capacity;
+
+	Opal_GraphAttachment *attachments;
+	uint32_t num_attachments;
+	uint32_t attachments_capacity;
+
+	Graph_Resource *resources;
+	uint32_t num_resources;
+	uint32_t resources_capacity;
+
+	Graph_Physical *physicals;
+	uint32_t num_physicals;
+	uint32_t physicals_capacity;
+
+	Opal_Fence *fences;
+	uint32_t num_fences;
+	uint32_t fences_capacity;
+
+	// compiled
+	uint32_t *order;
+	uint32_t num_ordered;
+	uint32_t order_capacity;
+
+	Graph_Edge *edges;
+	uint32_t num_edges;
+	uint32_t edges_capacity;
+
+	uint32_t *successors;
+	uint32_t successors_capacity;
+
+	uint32_t *readers;
+	uint32_t num_readers;
+	uint32_t readers_capacity;
+
+	Graph_Tracker *trackers;
+	uint32_t trackers_capacity;
+
+	uint32_t *groups;
+	uint32_t groups_capacity;
+
+	Opal_BarrierStageFlags *group_stages;
+	uint32_t group_stages_capacity;
+
+	Graph_Barrier *barriers;
+	uint32_t num_barriers;
+	uint32_t barriers_capacity;
+
+	Graph_PendingTransition *pending;
+	uint32_t num_pending;
+	uint32_t pending_capacity;
+
+	Opal_BufferTransitionDesc *buffer_transitions;
+	uint32_t num_buffer_transitions;
+	uint32_t buffer_transitions_capacity;
+
+	Opal_TextureTransitionDesc *texture_transitions;
+	uint32_t num_texture_transitions;
+	uint32_t texture_transitions_capacity;
+
+	Opal_BarrierDesc *begin_barriers;
+	uint32_t begin_barriers_capacity;
+
+	Opal_BarrierDesc *end_barriers;
+	uint32_t end_barriers_capacity;
+
+	uint32_t *begin_offsets;
+	uint32_t begin_offsets_capacity;
+
+	uint32_t *end_offsets;
+	uint32_t end_offsets_capacity;
+
+	Opal_FramebufferAttachment *framebuffer_attachments;
+	uint32_t framebuffer_attachments_capacity;
+} Graph_Graph;
+
+void graph_grow(void **data, uint32_t *capacity, uint32_t required, uint32_t element_size);
+
+Opal_Result graph_compile(Graph_Graph *graph);
+void graph_releaseUnusedPhysicals(Graph_Graph *graph);
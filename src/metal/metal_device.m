@@ -1,12 +1,13 @@
 #include "metal_internal.h"
 #include "common/intrinsics.h"
+#include "common/timer.h"
 
 /*
  */
-static Opal_Result metal_deviceMapBuffer(Opal_Device this, Opal_Buffer buffer, void **ptr);
-static Opal_Result metal_deviceUnmapBuffer(Opal_Device this, Opal_Buffer buffer);
-static Opal_Result metal_deviceFreeDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set);
-static Opal_Result metal_deviceUpdateDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set, uint32_t num_entries, const Opal_DescriptorSetEntry *entries);
+OPAL_BACKEND_STATIC Opal_Result metal_deviceMapBuffer(Opal_Device this, Opal_Buffer buffer, void **ptr);
+OPAL_BACKEND_STATIC Opal_Result metal_deviceUnmapBuffer(Opal_Device this, Opal_Buffer buffer);
+OPAL_BACKEND_STATIC Opal_Result metal_deviceFreeDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set);
+OPAL_BACKEND_STATIC Opal_Result metal_deviceUpdateDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set, uint32_t num_entries, const Opal_DescriptorSetEntry *entries);
 
 /*
  */
@@ -205,6 +206,132 @@ static void metal_cmdAccelerationStructurePassBarrier(Metal_Device *device_ptr,
 	}
 }
 
+static Opal_Result metal_cmdSplitAccelerationStructurePass(Metal_Device *device_ptr, Metal_CommandBuffer *command_buffer_ptr)
+{
+	assert(device_ptr);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->acceleration_structure_pass_encoder != nil);
+
+	// note: resources are not hazard tracked and acceleration structure encoders have no memory barriers,
+	//       so dependent work is encoded into a separate encoder chained with a fence
+	id<MTLAccelerationStructureCommandEncoder> metal_pass_encoder = command_buffer_ptr->acceleration_structure_pass_encoder;
+
+	[metal_pass_encoder updateFence: device_ptr->acceleration_structure_pass_fence];
+	[metal_pass_encoder endEncoding];
+
+	metal_pass_encoder = [command_buffer_ptr->command_buffer accelerationStructureCommandEncoder];
+	if (metal_pass_encoder == nil)
+		return OPAL_METAL_ERROR;
+
+	[metal_pass_encoder waitForFence: device_ptr->acceleration_structure_pass_fence];
+	command_buffer_ptr->acceleration_structure_pass_encoder = metal_pass_encoder;
+
+	return OPAL_SUCCESS;
+}
+
+static void metal_cmdReleaseOnCompletion(Metal_CommandBuffer *command_buffer_ptr, id<MTLBuffer> buffer)
+{
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->command_buffer);
+
+	// note: command buffers do not retain their resources, so temporary buffers live until the GPU is done with them
+	[command_buffer_ptr->command_buffer addCompletedHandler: ^(id<MTLCommandBuffer> metal_command_buffer)
+	{
+		OPAL_UNUSED(metal_command_buffer);
+		[buffer release];
+	}];
+}
+
+static Opal_Result metal_cmdClearTexture(Metal_Device *device_ptr, Metal_CommandBuffer *command_buffer_ptr, id<MTLTexture> texture, Opal_ClearValue clear_value)
+{
+	assert(device_ptr);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->copy_pass_encoder != nil);
+	assert(texture);
+
+	// note: blit encoders can't clear textures, so the copy pass is split around render passes
+	//       that only clear, fences keep them ordered since resources are not hazard tracked
+	BOOL has_depth = NO;
+	BOOL has_stencil = NO;
+
+	switch (texture.pixelFormat)
+	{
+		case MTLPixelFormatDepth16Unorm:
+		case MTLPixelFormatDepth32Float: has_depth = YES; break;
+		case MTLPixelFormatDepth24Unorm_Stencil8:
+		case MTLPixelFormatDepth32Float_Stencil8: has_depth = YES; has_stencil = YES; break;
+		default: break;
+	}
+
+	NSUInteger num_slices = texture.arrayLength;
+	if (texture.textureType == MTLTextureTypeCube || texture.textureType == MTLTextureTypeCubeArray)
+		num_slices *= 6;
+
+	NSUInteger num_planes = (texture.textureType == MTLTextureType3D) ? texture.depth : 1;
+
+	[command_buffer_ptr->copy_pass_encoder updateFence: device_ptr->copy_pass_fence];
+	[command_buffer_ptr->copy_pass_encoder endEncoding];
+	command_buffer_ptr->copy_pass_encoder = nil;
+
+	for (NSUInteger slice = 0; slice < num_slices; ++slice)
+	{
+		for (NSUInteger plane = 0; plane < num_planes; ++plane)
+		{
+			@autoreleasepool
+			{
+				MTLRenderPassDescriptor *pass_descriptor = [MTLRenderPassDescriptor renderPassDescriptor];
+
+				if (has_depth)
+				{
+					pass_descriptor.depthAttachment.texture = texture;
+					pass_descriptor.depthAttachment.slice = slice;
+					pass_descriptor.depthAttachment.loadAction = MTLLoadActionClear;
+					pass_descriptor.depthAttachment.storeAction = MTLStoreActionStore;
+					pass_descriptor.depthAttachment.clearDepth = clear_value.depth_stencil.depth;
+				}
+
+				if (has_stencil)
+				{
+					pass_descriptor.stencilAttachment.texture = texture;
+					pass_descriptor.stencilAttachment.slice = slice;
+					pass_descriptor.stencilAttachment.loadAction = MTLLoadActionClear;
+					pass_descriptor.stencilAttachment.storeAction = MTLStoreActionStore;
+					pass_descriptor.stencilAttachment.clearStencil = clear_value.depth_stencil.stencil;
+				}
+
+				if (!has_depth)
+				{
+					const float *color = clear_value.color.f;
+
+					pass_descriptor.colorAttachments[0].texture = texture;
+					pass_descriptor.colorAttachments[0].slice = slice;
+					pass_descriptor.colorAttachments[0].depthPlane = plane;
+					pass_descriptor.colorAttachments[0].loadAction = MTLLoadActionClear;
+					pass_descriptor.colorAttachments[0].storeAction = MTLStoreActionStore;
+					pass_descriptor.colorAttachments[0].clearColor = MTLClearColorMake(color[0], color[1], color[2], color[3]);
+				}
+
+				id<MTLRenderCommandEncoder> metal_pass_encoder = [command_buffer_ptr->command_buffer renderCommandEncoderWithDescriptor: pass_descriptor];
+				if (metal_pass_encoder == nil)
+					return OPAL_METAL_ERROR;
+
+				[metal_pass_encoder waitForFence: device_ptr->copy_pass_fence beforeStages: MTLRenderStageVertex];
+				[metal_pass_encoder updateFence: device_ptr->copy_pass_fence afterStages: MTLRenderStageFragment];
+				[metal_pass_encoder endEncoding];
+			}
+		}
+	}
+
+	id<MTLBlitCommandEncoder> metal_pass_encoder = [command_buffer_ptr->command_buffer blitCommandEncoder];
+	if (metal_pass_encoder == nil)
+		return OPAL_METAL_ERROR;
+
+	[metal_pass_encoder waitForFence: device_ptr->copy_pass_fence];
+	command_buffer_ptr->copy_pass_encoder = metal_pass_encoder;
+
+	return OPAL_SUCCESS;
+}
+
 /*
  */
 static void metal_destroyQueue(Metal_Device *device_ptr, Metal_Queue *queue_ptr)
@@ -476,12 +603,25 @@ static void metal_destroySwapchain(Metal_Device *device_ptr, Metal_Swapchain *sw
 	@autoreleasepool
 	{
 		CGColorSpaceRelease(swapchain_ptr->colorspace);
+
+		for (uint32_t i = 0; i < OPAL_PACING_MAX_FRAMES; ++i)
+			[swapchain_ptr->presented_drawables[i] release];
+
+		if (swapchain_ptr->frame_semaphore)
+		{
+			// note: libdispatch traps if a semaphore dies below its initial value,
+			//       so give back the slot of a drawable that was acquired but never presented
+			if (swapchain_ptr->current_drawable)
+				dispatch_semaphore_signal(swapchain_ptr->frame_semaphore);
+
+			dispatch_release(swapchain_ptr->frame_semaphore);
+		}
 	}
 }
 
 /*
  */
-static Opal_Result metal_deviceGetInfo(Opal_Device this, Opal_DeviceInfo *info)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceGetInfo(Opal_Device this, Opal_DeviceInfo *info)
 {
 	assert(this);
 	assert(info);
@@ -490,7 +630,7 @@ static Opal_Result metal_deviceGetInfo(Opal_Device this, Opal_DeviceInfo *info)
 	return metal_helperFillDeviceInfo(ptr->device, info);
 }
 
-static Opal_Result metal_deviceGetQueue(Opal_Device this, Opal_DeviceEngineType engine_type, uint32_t index, Opal_Queue *queue)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceGetQueue(Opal_Device this, Opal_DeviceEngineType engine_type, uint32_t index, Opal_Queue *queue)
 {
 	assert(this);
 	assert(queue);
@@ -509,7 +649,7 @@ static Opal_Result metal_deviceGetQueue(Opal_Device this, Opal_DeviceEngineType
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceGetAccelerationStructurePrebuildInfo(Opal_Device this, const Opal_AccelerationStructureBuildDesc *desc, Opal_AccelerationStructurePrebuildInfo *info)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceGetAccelerationStructurePrebuildInfo(Opal_Device this, const Opal_AccelerationStructureBuildDesc *desc, Opal_AccelerationStructurePrebuildInfo *info)
 {
 	assert(this);
 	assert(desc);
@@ -598,7 +738,25 @@ static Opal_Result metal_deviceGetAccelerationStructurePrebuildInfo(Opal_Device
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceGetSupportedSurfaceFormats(Opal_Device this, Opal_Surface surface, uint32_t *num_formats, Opal_SurfaceFormat *formats)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceGetAccelerationStructureAddress(Opal_Device this, Opal_AccelerationStructure acceleration_structure, uint64_t *address)
+{
+	assert(this);
+	assert(acceleration_structure);
+	assert(address);
+
+	Metal_Device *device_ptr = (Metal_Device *)this;
+
+	Metal_AccelerationStructure *acceleration_structure_ptr = (Metal_AccelerationStructure *)opal_poolGetElement(&device_ptr->acceleration_structures, (Opal_PoolHandle)acceleration_structure);
+	assert(acceleration_structure_ptr);
+
+	// note: instances reference blases by resource id on Metal, it fills the same 64 bits
+	MTLResourceID resource_id = acceleration_structure_ptr->acceleration_structure.gpuResourceID;
+	memcpy(address, &resource_id, sizeof(uint64_t));
+
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result metal_deviceGetSupportedSurfaceFormats(Opal_Device this, Opal_Surface surface, uint32_t *num_formats, Opal_SurfaceFormat *formats)
 {
 	assert(this);
 	assert(surface);
@@ -620,7 +778,7 @@ static Opal_Result metal_deviceGetSupportedSurfaceFormats(Opal_Device this, Opal
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceGetSupportedPresentModes(Opal_Device this, Opal_Surface surface, uint32_t *num_present_modes, Opal_PresentMode *present_modes)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceGetSupportedPresentModes(Opal_Device this, Opal_Surface surface, uint32_t *num_present_modes, Opal_PresentMode *present_modes)
 {
 	assert(this);
 	assert(surface);
@@ -641,7 +799,7 @@ static Opal_Result metal_deviceGetSupportedPresentModes(Opal_Device this, Opal_S
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceGetPreferredSurfaceFormat(Opal_Device this, Opal_Surface surface, Opal_SurfaceFormat *format)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceGetPreferredSurfaceFormat(Opal_Device this, Opal_Surface surface, Opal_SurfaceFormat *format)
 {
 	assert(this);
 	assert(surface);
@@ -678,7 +836,7 @@ static Opal_Result metal_deviceGetPreferredSurfaceFormat(Opal_Device this, Opal_
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceGetPreferredSurfacePresentMode(Opal_Device this, Opal_Surface surface, Opal_PresentMode *present_mode)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceGetPreferredSurfacePresentMode(Opal_Device this, Opal_Surface surface, Opal_PresentMode *present_mode)
 {
 	assert(this);
 	assert(surface);
@@ -713,7 +871,7 @@ static Opal_Result metal_deviceGetPreferredSurfacePresentMode(Opal_Device this,
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCreateSemaphore(Opal_Device this, const Opal_SemaphoreDesc *desc, Opal_Semaphore *semaphore)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCreateSemaphore(Opal_Device this, const Opal_SemaphoreDesc *desc, Opal_Semaphore *semaphore)
 {
 	assert(this);
 	assert(desc);
@@ -765,7 +923,7 @@ static Opal_Result metal_deviceCreateSemaphore(Opal_Device this, const Opal_Sema
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCreateFence(Opal_Device this, Opal_Fence *fence)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCreateFence(Opal_Device this, Opal_Fence *fence)
 {
 	assert(this);
 	assert(fence);
@@ -793,7 +951,7 @@ static Opal_Result metal_deviceCreateFence(Opal_Device this, Opal_Fence *fence)
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCreateBuffer(Opal_Device this, const Opal_BufferDesc *desc, Opal_Buffer *buffer)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCreateBuffer(Opal_Device this, const Opal_BufferDesc *desc, Opal_Buffer *buffer)
 {
 	assert(this);
 	assert(desc);
@@ -853,7 +1011,7 @@ static Opal_Result metal_deviceCreateBuffer(Opal_Device this, const Opal_BufferD
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCreateTexture(Opal_Device this, const Opal_TextureDesc *desc, Opal_Texture *texture)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCreateTexture(Opal_Device this, const Opal_TextureDesc *desc, Opal_Texture *texture)
 {
 	assert(this);
 	assert(desc);
@@ -919,7 +1077,7 @@ static Opal_Result metal_deviceCreateTexture(Opal_Device this, const Opal_Textur
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCreateTextureView(Opal_Device this, const Opal_TextureViewDesc *desc, Opal_TextureView *texture_view)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCreateTextureView(Opal_Device this, const Opal_TextureViewDesc *desc, Opal_TextureView *texture_view)
 {
 	assert(this);
 	assert(desc);
@@ -958,7 +1116,7 @@ static Opal_Result metal_deviceCreateTextureView(Opal_Device this, const Opal_Te
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCreateSampler(Opal_Device this, const Opal_SamplerDesc *desc, Opal_Sampler *sampler)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCreateSampler(Opal_Device this, const Opal_SamplerDesc *desc, Opal_Sampler *sampler)
 {
 	assert(this);
 	assert(desc);
@@ -967,6 +1125,13 @@ static Opal_Result metal_deviceCreateSampler(Opal_Device this, const Opal_Sample
 	Metal_Device *device_ptr = (Metal_Device *)this;
 	id<MTLDevice> metal_device = device_ptr->device;
 
+	Opal_Sampler cached_sampler = (Opal_Sampler)opal_cacheAcquire(&device_ptr->sampler_cache, desc, sizeof(Opal_SamplerDesc));
+	if (cached_sampler != OPAL_NULL_HANDLE)
+	{
+		*sampler = cached_sampler;
+		return OPAL_SUCCESS;
+	}
+
 	id<MTLSamplerState> metal_sampler = nil;
 
 	@autoreleasepool
@@ -999,10 +1164,11 @@ static Opal_Result metal_deviceCreateSampler(Opal_Device this, const Opal_Sample
 	result.sampler = metal_sampler;
 
 	*sampler = (Opal_Texture)opal_poolAddElement(&device_ptr->samplers, &result);
+	opal_cacheInsert(&device_ptr->sampler_cache, desc, sizeof(Opal_SamplerDesc), *sampler);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCreateAccelerationStructure(Opal_Device this, const Opal_AccelerationStructureDesc *desc, Opal_AccelerationStructure *acceleration_structure)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCreateAccelerationStructure(Opal_Device this, const Opal_AccelerationStructureDesc *desc, Opal_AccelerationStructure *acceleration_structure)
 {
 	assert(this);
 	assert(desc);
@@ -1051,7 +1217,7 @@ static Opal_Result metal_deviceCreateAccelerationStructure(Opal_Device this, con
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCreateShaderBindingTable(Opal_Device this, Opal_RaytracePipeline pipeline, Opal_ShaderBindingTable *shader_binding_table)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCreateShaderBindingTable(Opal_Device this, Opal_RaytracePipeline pipeline, Opal_ShaderBindingTable *shader_binding_table)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(pipeline);
@@ -1060,7 +1226,7 @@ static Opal_Result metal_deviceCreateShaderBindingTable(Opal_Device this, Opal_R
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result metal_deviceCreateCommandAllocator(Opal_Device this, Opal_Queue queue, Opal_CommandAllocator *command_allocator)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCreateCommandAllocator(Opal_Device this, Opal_Queue queue, Opal_CommandAllocator *command_allocator)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(queue);
@@ -1080,7 +1246,7 @@ static Opal_Result metal_deviceCreateCommandAllocator(Opal_Device this, Opal_Que
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCreateCommandBuffer(Opal_Device this, Opal_CommandAllocator command_allocator, Opal_CommandBuffer *command_buffer)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCreateCommandBuffer(Opal_Device this, Opal_CommandAllocator command_allocator, Opal_CommandBuffer *command_buffer)
 {
 	assert(this);
 	assert(command_allocator);
@@ -1104,7 +1270,7 @@ static Opal_Result metal_deviceCreateCommandBuffer(Opal_Device this, Opal_Comman
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCreateShader(Opal_Device this, const Opal_ShaderDesc *desc, Opal_Shader *shader)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCreateShader(Opal_Device this, const Opal_ShaderDesc *desc, Opal_Shader *shader)
 {
 	assert(this);
 	assert(desc);
@@ -1112,6 +1278,16 @@ static Opal_Result metal_deviceCreateShader(Opal_Device this, const Opal_ShaderD
 
 	Metal_Device *device_ptr = (Metal_Device *)this;
 
+	Opal_CacheDigest digest = {0};
+	opal_cacheDigest(&digest, (uint32_t)desc->type, desc->data, desc->size);
+
+	Opal_Shader cached_shader = (Opal_Shader)opal_cacheAcquire(&device_ptr->shader_cache, &digest, sizeof(Opal_CacheDigest));
+	if (cached_shader != OPAL_NULL_HANDLE)
+	{
+		*shader = cached_shader;
+		return OPAL_SUCCESS;
+	}
+
 	id<MTLLibrary> metal_library = nil;
 
 	@autoreleasepool
@@ -1132,11 +1308,14 @@ static Opal_Result metal_deviceCreateShader(Opal_Device this, const Opal_ShaderD
 	Metal_Shader result = {0};
 	result.library = metal_library;
 
+	opal_compilerPause(&device_ptr->compiler);
 	*shader = (Opal_Shader)opal_poolAddElement(&device_ptr->shaders, &result);
+	opal_compilerResume(&device_ptr->compiler);
+	opal_cacheInsert(&device_ptr->shader_cache, &digest, sizeof(Opal_CacheDigest), *shader);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCreateDescriptorHeap(Opal_Device this, const Opal_DescriptorHeapDesc *desc, Opal_DescriptorHeap *descriptor_heap)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCreateDescriptorHeap(Opal_Device this, const Opal_DescriptorHeapDesc *desc, Opal_DescriptorHeap *descriptor_heap)
 {
 	assert(this);
 	assert(desc);
@@ -1225,7 +1404,7 @@ static Opal_Result metal_deviceCreateDescriptorHeap(Opal_Device this, const Opal
 	return opal_result;
 }
 
-static Opal_Result metal_deviceCreateDescriptorSetLayout(Opal_Device this, uint32_t num_entries, const Opal_DescriptorSetLayoutEntry *entries, Opal_DescriptorSetLayout *descriptor_set_layout)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCreateDescriptorSetLayout(Opal_Device this, uint32_t num_entries, const Opal_DescriptorSetLayoutEntry *entries, Opal_DescriptorSetLayout *descriptor_set_layout)
 {
 	assert(this);
 	assert(num_entries == 0 || entries);
@@ -1234,6 +1413,15 @@ static Opal_Result metal_deviceCreateDescriptorSetLayout(Opal_Device this, uint3
 	Metal_Device *device_ptr = (Metal_Device *)this;
 	id<MTLDevice> metal_device = device_ptr->device;
 
+	uint32_t entries_size = sizeof(Opal_DescriptorSetLayoutEntry) * num_entries;
+
+	Opal_DescriptorSetLayout cached_layout = (Opal_DescriptorSetLayout)opal_cacheAcquire(&device_ptr->descriptor_set_layout_cache, entries, entries_size);
+	if (cached_layout != OPAL_NULL_HANDLE)
+	{
+		*descriptor_set_layout = cached_layout;
+		return OPAL_SUCCESS;
+	}
+
 	id<MTLArgumentEncoder> metal_encoder = nil;
 
 	uint32_t num_static_entries = 0;
@@ -1337,11 +1525,14 @@ static Opal_Result metal_deviceCreateDescriptorSetLayout(Opal_Device this, uint3
 	result.num_descriptors = num_entries;
 	result.descriptors = metal_entries;
 
+	opal_compilerPause(&device_ptr->compiler);
 	*descriptor_set_layout = (Opal_DescriptorSetLayout)opal_poolAddElement(&device_ptr->descriptor_set_layouts, &result);
+	opal_compilerResume(&device_ptr->compiler);
+	opal_cacheInsert(&device_ptr->descriptor_set_layout_cache, entries, entries_size, *descriptor_set_layout);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCreatePipelineLayout(Opal_Device this, uint32_t num_descriptor_set_layouts, const Opal_DescriptorSetLayout *descriptor_set_layouts, Opal_PipelineLayout *pipeline_layout)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCreatePipelineLayout(Opal_Device this, uint32_t num_descriptor_set_layouts, const Opal_DescriptorSetLayout *descriptor_set_layouts, Opal_PipelineLayout *pipeline_layout)
 {
 	assert(this);
 	assert(num_descriptor_set_layouts == 0 || descriptor_set_layouts);
@@ -1349,6 +1540,15 @@ static Opal_Result metal_deviceCreatePipelineLayout(Opal_Device this, uint32_t n
 
 	Metal_Device *device_ptr = (Metal_Device *)this;
 
+	uint32_t layouts_size = sizeof(Opal_DescriptorSetLayout) * num_descriptor_set_layouts;
+
+	Opal_PipelineLayout cached_layout = (Opal_PipelineLayout)opal_cacheAcquire(&device_ptr->pipeline_layout_cache, descriptor_set_layouts, layouts_size);
+	if (cached_layout != OPAL_NULL_HANDLE)
+	{
+		*pipeline_layout = cached_layout;
+		return OPAL_SUCCESS;
+	}
+
 	Metal_PipelineLayout result = {0};
 	result.num_layouts = num_descriptor_set_layouts;
 
@@ -1385,17 +1585,25 @@ static Opal_Result metal_deviceCreatePipelineLayout(Opal_Device this, uint32_t n
 		result.vertex_binding_offset = offset;
 	}
 
+	opal_compilerPause(&device_ptr->compiler);
 	*pipeline_layout = (Opal_PipelineLayout)opal_poolAddElement(&device_ptr->pipeline_layouts, &result);
+	opal_compilerResume(&device_ptr->compiler);
+	opal_cacheInsert(&device_ptr->pipeline_layout_cache, descriptor_set_layouts, layouts_size, *pipeline_layout);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCreateGraphicsPipeline(Opal_Device this, const Opal_GraphicsPipelineDesc *desc, Opal_GraphicsPipeline *pipeline)
+static Opal_Result metal_compileGraphicsPipeline(void *device, const void *data, Opal_Bump *bump, void *pipeline)
 {
-	assert(this);
-	assert(desc);
+	assert(device);
+	assert(data);
+	assert(bump);
 	assert(pipeline);
 
-	Metal_Device *device_ptr = (Metal_Device *)this;
+	OPAL_UNUSED(bump);
+
+	const Opal_GraphicsPipelineDesc *desc = (const Opal_GraphicsPipelineDesc *)data;
+
+	Metal_Device *device_ptr = (Metal_Device *)device;
 
 	Metal_PipelineLayout *pipeline_layout_ptr = (Metal_PipelineLayout *)opal_poolGetElement(&device_ptr->pipeline_layouts, (Opal_PoolHandle)desc->pipeline_layout);
 	assert(pipeline_layout_ptr);
@@ -1559,11 +1767,28 @@ static Opal_Result metal_deviceCreateGraphicsPipeline(Opal_Device this, const Op
 	result.winding = metal_helperToWinding(desc->front_face);
 	result.depth_stencil_state = metal_depth_stencil_state;
 
+	*(Metal_GraphicsPipeline *)pipeline = result;
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCreateGraphicsPipeline(Opal_Device this, const Opal_GraphicsPipelineDesc *desc, Opal_GraphicsPipeline *pipeline)
+{
+	assert(this);
+	assert(desc);
+	assert(pipeline);
+
+	Metal_Device *device_ptr = (Metal_Device *)this;
+	Metal_GraphicsPipeline result = {0};
+
+	Opal_Result opal_result = metal_compileGraphicsPipeline(device_ptr, desc, &device_ptr->bump, &result);
+	if (opal_result != OPAL_SUCCESS)
+		return opal_result;
+
 	*pipeline = (Opal_GraphicsPipeline)opal_poolAddElement(&device_ptr->graphics_pipelines, &result);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCreateMeshletPipeline(Opal_Device this, const Opal_MeshletPipelineDesc *desc, Opal_GraphicsPipeline *pipeline)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCreateMeshletPipeline(Opal_Device this, const Opal_MeshletPipelineDesc *desc, Opal_GraphicsPipeline *pipeline)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(desc);
@@ -1572,13 +1797,18 @@ static Opal_Result metal_deviceCreateMeshletPipeline(Opal_Device this, const Opa
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result metal_deviceCreateComputePipeline(Opal_Device this, const Opal_ComputePipelineDesc *desc, Opal_ComputePipeline *pipeline)
+static Opal_Result metal_compileComputePipeline(void *device, const void *data, Opal_Bump *bump, void *pipeline)
 {
-	assert(this);
-	assert(desc);
+	assert(device);
+	assert(data);
+	assert(bump);
 	assert(pipeline);
 
-	Metal_Device *device_ptr = (Metal_Device *)this;
+	OPAL_UNUSED(bump);
+
+	const Opal_ComputePipelineDesc *desc = (const Opal_ComputePipelineDesc *)data;
+
+	Metal_Device *device_ptr = (Metal_Device *)device;
 
 	Metal_PipelineLayout *pipeline_layout_ptr = (Metal_PipelineLayout *)opal_poolGetElement(&device_ptr->pipeline_layouts, (Opal_PoolHandle)desc->pipeline_layout);
 	assert(pipeline_layout_ptr);
@@ -1612,11 +1842,28 @@ static Opal_Result metal_deviceCreateComputePipeline(Opal_Device this, const Opa
 	result.threadgroup_size.height = desc->threadgroup_size_y;
 	result.threadgroup_size.depth = desc->threadgroup_size_z;
 
+	*(Metal_ComputePipeline *)pipeline = result;
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCreateComputePipeline(Opal_Device this, const Opal_ComputePipelineDesc *desc, Opal_ComputePipeline *pipeline)
+{
+	assert(this);
+	assert(desc);
+	assert(pipeline);
+
+	Metal_Device *device_ptr = (Metal_Device *)this;
+	Metal_ComputePipeline result = {0};
+
+	Opal_Result opal_result = metal_compileComputePipeline(device_ptr, desc, &device_ptr->bump, &result);
+	if (opal_result != OPAL_SUCCESS)
+		return opal_result;
+
 	*pipeline = (Opal_ComputePipeline)opal_poolAddElement(&device_ptr->compute_pipelines, &result);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCreateRaytracePipeline(Opal_Device this, const Opal_RaytracePipelineDesc *desc, Opal_RaytracePipeline *pipeline)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCreateRaytracePipeline(Opal_Device this, const Opal_RaytracePipelineDesc *desc, Opal_RaytracePipeline *pipeline)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(desc);
@@ -1625,7 +1872,62 @@ static Opal_Result metal_deviceCreateRaytracePipeline(Opal_Device this, const Op
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result metal_deviceCreateSwapchain(Opal_Device this, const Opal_SwapchainDesc *desc, Opal_Swapchain *swapchain)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCreateGraphicsPipelines(Opal_Device this, uint32_t num_pipelines, const Opal_GraphicsPipelineDesc *descs, Opal_GraphicsPipeline *pipelines)
+{
+	assert(this);
+
+	Metal_Device *device_ptr = (Metal_Device *)this;
+	return opal_compilerRun(&device_ptr->compiler, metal_compileGraphicsPipeline, &device_ptr->graphics_pipelines, num_pipelines, descs, sizeof(Opal_GraphicsPipelineDesc), pipelines);
+}
+
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCreateComputePipelines(Opal_Device this, uint32_t num_pipelines, const Opal_ComputePipelineDesc *descs, Opal_ComputePipeline *pipelines)
+{
+	assert(this);
+
+	Metal_Device *device_ptr = (Metal_Device *)this;
+	return opal_compilerRun(&device_ptr->compiler, metal_compileComputePipeline, &device_ptr->compute_pipelines, num_pipelines, descs, sizeof(Opal_ComputePipelineDesc), pipelines);
+}
+
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCreateRaytracePipelines(Opal_Device this, uint32_t num_pipelines, const Opal_RaytracePipelineDesc *descs, Opal_RaytracePipeline *pipelines)
+{
+	OPAL_UNUSED(this);
+	OPAL_UNUSED(num_pipelines);
+	OPAL_UNUSED(descs);
+	OPAL_UNUSED(pipelines);
+
+	return OPAL_NOT_SUPPORTED;
+}
+
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCreateGraphicsPipelinesAsync(Opal_Device this, uint32_t num_pipelines, const Opal_GraphicsPipelineDesc *descs, Opal_GraphicsPipeline *pipelines, Opal_PipelineTask *task)
+{
+	assert(this);
+	assert(task);
+
+	Metal_Device *device_ptr = (Metal_Device *)this;
+	return opal_compilerSubmit(&device_ptr->compiler, metal_compileGraphicsPipeline, &device_ptr->graphics_pipelines, num_pipelines, descs, sizeof(Opal_GraphicsPipelineDesc), pipelines, task);
+}
+
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCreateComputePipelinesAsync(Opal_Device this, uint32_t num_pipelines, const Opal_ComputePipelineDesc *descs, Opal_ComputePipeline *pipelines, Opal_PipelineTask *task)
+{
+	assert(this);
+	assert(task);
+
+	Metal_Device *device_ptr = (Metal_Device *)this;
+	return opal_compilerSubmit(&device_ptr->compiler, metal_compileComputePipeline, &device_ptr->compute_pipelines, num_pipelines, descs, sizeof(Opal_ComputePipelineDesc), pipelines, task);
+}
+
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCreateRaytracePipelinesAsync(Opal_Device this, uint32_t num_pipelines, const Opal_RaytracePipelineDesc *descs, Opal_RaytracePipeline *pipelines, Opal_PipelineTask *task)
+{
+	OPAL_UNUSED(this);
+	OPAL_UNUSED(num_pipelines);
+	OPAL_UNUSED(descs);
+	OPAL_UNUSED(pipelines);
+	OPAL_UNUSED(task);
+
+	return OPAL_NOT_SUPPORTED;
+}
+
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCreateSwapchain(Opal_Device this, const Opal_SwapchainDesc *desc, Opal_Swapchain *swapchain)
 {
 	assert(this);
 	assert(desc);
@@ -1671,6 +1973,10 @@ static Opal_Result metal_deviceCreateSwapchain(Opal_Device this, const Opal_Swap
 		layer_ptr.framebufferOnly = (desc->usage == OPAL_TEXTURE_USAGE_FRAMEBUFFER_ATTACHMENT);
 		layer_ptr.displaySyncEnabled = (desc->mode == OPAL_PRESENT_MODE_IMMEDIATE);
 		layer_ptr.maximumDrawableCount = num_textures;
+
+		// note: core animation only accepts 2 or 3 drawables, finer limits come from the frame semaphore
+		if (desc->max_frames_in_flight > 0)
+			layer_ptr.maximumDrawableCount = min(max(desc->max_frames_in_flight + 1, 2), 3);
 	}
 
 	// create opal struct
@@ -1679,11 +1985,16 @@ static Opal_Result metal_deviceCreateSwapchain(Opal_Device this, const Opal_Swap
 	result.queue = desc->queue;
 	result.colorspace = metal_colorspace;
 
+	if (desc->max_frames_in_flight > 0)
+		result.frame_semaphore = dispatch_semaphore_create(desc->max_frames_in_flight);
+
+	opal_pacingInitialize(&result.pacing, 0);
+
 	*swapchain = (Opal_Swapchain)opal_poolAddElement(&device_ptr->swapchains, &result);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceDestroySemaphore(Opal_Device this, Opal_Semaphore semaphore)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceDestroySemaphore(Opal_Device this, Opal_Semaphore semaphore)
 {
 	assert(this);
 	assert(semaphore);
@@ -1701,7 +2012,7 @@ static Opal_Result metal_deviceDestroySemaphore(Opal_Device this, Opal_Semaphore
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceDestroyFence(Opal_Device this, Opal_Fence fence)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceDestroyFence(Opal_Device this, Opal_Fence fence)
 {
 	assert(this);
 	assert(fence);
@@ -1719,7 +2030,7 @@ static Opal_Result metal_deviceDestroyFence(Opal_Device this, Opal_Fence fence)
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceDestroyBuffer(Opal_Device this, Opal_Buffer buffer)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceDestroyBuffer(Opal_Device this, Opal_Buffer buffer)
 {
 	assert(this);
 	assert(buffer);
@@ -1737,7 +2048,7 @@ static Opal_Result metal_deviceDestroyBuffer(Opal_Device this, Opal_Buffer buffe
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceDestroyTexture(Opal_Device this, Opal_Texture texture)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceDestroyTexture(Opal_Device this, Opal_Texture texture)
 {
 	assert(this);
 	assert(texture);
@@ -1755,7 +2066,7 @@ static Opal_Result metal_deviceDestroyTexture(Opal_Device this, Opal_Texture tex
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceDestroyTextureView(Opal_Device this, Opal_TextureView texture_view)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceDestroyTextureView(Opal_Device this, Opal_TextureView texture_view)
 {
 	assert(this);
 	assert(texture_view);
@@ -1773,7 +2084,7 @@ static Opal_Result metal_deviceDestroyTextureView(Opal_Device this, Opal_Texture
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceDestroySampler(Opal_Device this, Opal_Sampler sampler)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceDestroySampler(Opal_Device this, Opal_Sampler sampler)
 {
 	assert(this);
 	assert(sampler);
@@ -1782,6 +2093,9 @@ static Opal_Result metal_deviceDestroySampler(Opal_Device this, Opal_Sampler sam
 	assert(handle != OPAL_POOL_HANDLE_NULL);
 
 	Metal_Device *device_ptr = (Metal_Device *)this;
+	if (opal_cacheRelease(&device_ptr->sampler_cache, sampler) > 0)
+		return OPAL_SUCCESS;
+
 	Metal_Sampler *sampler_ptr = (Metal_Sampler *)opal_poolGetElement(&device_ptr->samplers, handle);
 	assert(sampler_ptr);
 
@@ -1791,7 +2105,7 @@ static Opal_Result metal_deviceDestroySampler(Opal_Device this, Opal_Sampler sam
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceDestroyAccelerationStructure(Opal_Device this, Opal_AccelerationStructure acceleration_structure)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceDestroyAccelerationStructure(Opal_Device this, Opal_AccelerationStructure acceleration_structure)
 {
 	assert(this);
 	assert(acceleration_structure);
@@ -1809,7 +2123,7 @@ static Opal_Result metal_deviceDestroyAccelerationStructure(Opal_Device this, Op
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceDestroyShaderBindingTable(Opal_Device this, Opal_ShaderBindingTable shader_binding_table)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceDestroyShaderBindingTable(Opal_Device this, Opal_ShaderBindingTable shader_binding_table)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(shader_binding_table);
@@ -1817,7 +2131,7 @@ static Opal_Result metal_deviceDestroyShaderBindingTable(Opal_Device this, Opal_
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result metal_deviceDestroyCommandAllocator(Opal_Device this, Opal_CommandAllocator command_allocator)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceDestroyCommandAllocator(Opal_Device this, Opal_CommandAllocator command_allocator)
 {
 	assert(this);
 	assert(command_allocator);
@@ -1836,7 +2150,7 @@ static Opal_Result metal_deviceDestroyCommandAllocator(Opal_Device this, Opal_Co
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceDestroyCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceDestroyCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
 {
 	assert(this);
 	assert(command_buffer);
@@ -1858,12 +2172,14 @@ static Opal_Result metal_deviceDestroyCommandBuffer(Opal_Device this, Opal_Comma
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceDestroyShader(Opal_Device this, Opal_Shader shader)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceDestroyShader(Opal_Device this, Opal_Shader shader)
 {
 	assert(this);
 	assert(shader);
 
 	Metal_Device *device_ptr = (Metal_Device *)this;
+	if (opal_cacheRelease(&device_ptr->shader_cache, shader) > 0)
+		return OPAL_SUCCESS;
 
 	Opal_PoolHandle handle = (Opal_PoolHandle)shader;
 	assert(handle != OPAL_POOL_HANDLE_NULL);
@@ -1877,7 +2193,7 @@ static Opal_Result metal_deviceDestroyShader(Opal_Device this, Opal_Shader shade
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceDestroyDescriptorHeap(Opal_Device this, Opal_DescriptorHeap descriptor_heap)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceDestroyDescriptorHeap(Opal_Device this, Opal_DescriptorHeap descriptor_heap)
 {
 	assert(this);
 	assert(descriptor_heap);
@@ -1896,12 +2212,18 @@ static Opal_Result metal_deviceDestroyDescriptorHeap(Opal_Device this, Opal_Desc
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceDestroyDescriptorSetLayout(Opal_Device this, Opal_DescriptorSetLayout descriptor_set_layout)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceDestroyDescriptorSetLayout(Opal_Device this, Opal_DescriptorSetLayout descriptor_set_layout)
 {
 	assert(this);
 	assert(descriptor_set_layout);
 
 	Metal_Device *device_ptr = (Metal_Device *)this;
+	if (opal_cacheRelease(&device_ptr->descriptor_set_layout_cache, descriptor_set_layout) > 0)
+		return OPAL_SUCCESS;
+
+	// note: the handle can be reused for another layout from now on
+	opal_cacheEvict(&device_ptr->pipeline_layout_cache, descriptor_set_layout);
+
 
 	Opal_PoolHandle handle = (Opal_PoolHandle)descriptor_set_layout;
 	assert(handle != OPAL_POOL_HANDLE_NULL);
@@ -1915,12 +2237,15 @@ static Opal_Result metal_deviceDestroyDescriptorSetLayout(Opal_Device this, Opal
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceDestroyPipelineLayout(Opal_Device this, Opal_PipelineLayout pipeline_layout)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceDestroyPipelineLayout(Opal_Device this, Opal_PipelineLayout pipeline_layout)
 {
 	assert(this);
 	assert(pipeline_layout);
 
 	Metal_Device *device_ptr = (Metal_Device *)this;
+	if (opal_cacheRelease(&device_ptr->pipeline_layout_cache, pipeline_layout) > 0)
+		return OPAL_SUCCESS;
+
 
 	Opal_PoolHandle handle = (Opal_PoolHandle)pipeline_layout;
 	assert(handle != OPAL_POOL_HANDLE_NULL);
@@ -1934,7 +2259,7 @@ static Opal_Result metal_deviceDestroyPipelineLayout(Opal_Device this, Opal_Pipe
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceDestroyGraphicsPipeline(Opal_Device this, Opal_GraphicsPipeline pipeline)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceDestroyGraphicsPipeline(Opal_Device this, Opal_GraphicsPipeline pipeline)
 {
 	assert(this);
 	assert(pipeline);
@@ -1953,7 +2278,7 @@ static Opal_Result metal_deviceDestroyGraphicsPipeline(Opal_Device this, Opal_Gr
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceDestroyComputePipeline(Opal_Device this, Opal_ComputePipeline pipeline)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceDestroyComputePipeline(Opal_Device this, Opal_ComputePipeline pipeline)
 {
 	assert(this);
 	assert(pipeline);
@@ -1972,7 +2297,7 @@ static Opal_Result metal_deviceDestroyComputePipeline(Opal_Device this, Opal_Com
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceDestroyRaytracePipeline(Opal_Device this, Opal_RaytracePipeline pipeline)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceDestroyRaytracePipeline(Opal_Device this, Opal_RaytracePipeline pipeline)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(pipeline);
@@ -1980,7 +2305,7 @@ static Opal_Result metal_deviceDestroyRaytracePipeline(Opal_Device this, Opal_Ra
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result metal_deviceDestroySwapchain(Opal_Device this, Opal_Swapchain swapchain)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceDestroySwapchain(Opal_Device this, Opal_Swapchain swapchain)
 {
 	assert(this);
 	assert(swapchain);
@@ -1998,12 +2323,19 @@ static Opal_Result metal_deviceDestroySwapchain(Opal_Device this, Opal_Swapchain
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceDestroy(Opal_Device this)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceDestroy(Opal_Device this)
 {
 	assert(this);
 
 	Metal_Device *ptr = (Metal_Device *)this;
 
+	opal_compilerShutdown(&ptr->compiler);
+
+	opal_cacheShutdown(&ptr->pipeline_layout_cache);
+	opal_cacheShutdown(&ptr->descriptor_set_layout_cache);
+	opal_cacheShutdown(&ptr->sampler_cache);
+	opal_cacheShutdown(&ptr->shader_cache);
+
 	{
 		uint32_t head = opal_poolGetHeadIndex(&ptr->swapchains);
 		while (head != OPAL_POOL_HANDLE_NULL)
@@ -2242,6 +2574,7 @@ static Opal_Result metal_deviceDestroy(Opal_Device this)
 		free(ptr->queue_handles[i]);
 
 	opal_bumpShutdown(&ptr->bump);
+	opal_buildBatchShutdown(&ptr->build_batch);
 
 	@autoreleasepool
 	{
@@ -2250,6 +2583,9 @@ static Opal_Result metal_deviceDestroy(Opal_Device this)
 
 		OPAL_UNUSED(result);
 
+		[ptr->acceleration_structure_pass_fence release];
+		[ptr->copy_pass_fence release];
+		[ptr->listener release];
 		[ptr->device release];
 	}
 
@@ -2257,7 +2593,7 @@ static Opal_Result metal_deviceDestroy(Opal_Device this)
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceBuildShaderBindingTable(Opal_Device this, Opal_ShaderBindingTable shader_binding_table, const Opal_ShaderBindingTableBuildDesc *desc)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceBuildShaderBindingTable(Opal_Device this, Opal_ShaderBindingTable shader_binding_table, const Opal_ShaderBindingTableBuildDesc *desc)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(shader_binding_table);
@@ -2266,7 +2602,7 @@ static Opal_Result metal_deviceBuildShaderBindingTable(Opal_Device this, Opal_Sh
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result metal_deviceBuildAccelerationStructureInstanceBuffer(Opal_Device this, const Opal_AccelerationStructureInstanceBufferBuildDesc *desc)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceBuildAccelerationStructureInstanceBuffer(Opal_Device this, const Opal_AccelerationStructureInstanceBufferBuildDesc *desc)
 {
 	assert(this);
 	assert(desc);
@@ -2285,9 +2621,6 @@ static Opal_Result metal_deviceBuildAccelerationStructureInstanceBuffer(Opal_Dev
 		const Opal_AccelerationStructureInstance *opal_instance = &desc->instances[i];
 		MTLIndirectAccelerationStructureInstanceDescriptor *metal_instance = (MTLIndirectAccelerationStructureInstanceDescriptor *)dst_data;
 
-		Metal_AccelerationStructure *blas_ptr = (Metal_AccelerationStructure *)opal_poolGetElement(&device_ptr->acceleration_structures, (Opal_PoolHandle)opal_instance->blas);
-		assert(blas_ptr);
-
 		for (uint32_t col = 0; col < 4; ++col)
 		{
 			metal_instance->transformationMatrix.columns[col].x = opal_instance->transform[0][col];
@@ -2299,7 +2632,18 @@ static Opal_Result metal_deviceBuildAccelerationStructureInstanceBuffer(Opal_Dev
 		metal_instance->mask = opal_instance->mask;
 		metal_instance->intersectionFunctionTableOffset = opal_instance->intersection_index_offset;
 		metal_instance->options = metal_helperToAccelerationStructureInstanceOptions(opal_instance->flags);
-		metal_instance->accelerationStructureID = blas_ptr->acceleration_structure.gpuResourceID;
+
+		if (desc->blas_addresses)
+		{
+			memcpy(&metal_instance->accelerationStructureID, &desc->blas_addresses[i], sizeof(uint64_t));
+		}
+		else
+		{
+			Metal_AccelerationStructure *blas_ptr = (Metal_AccelerationStructure *)opal_poolGetElement(&device_ptr->acceleration_structures, (Opal_PoolHandle)opal_instance->blas);
+			assert(blas_ptr);
+
+			metal_instance->accelerationStructureID = blas_ptr->acceleration_structure.gpuResourceID;
+		}
 
 		dst_data += sizeof(MTLIndirectAccelerationStructureInstanceDescriptor);
 	}
@@ -2307,7 +2651,7 @@ static Opal_Result metal_deviceBuildAccelerationStructureInstanceBuffer(Opal_Dev
 	return metal_deviceUnmapBuffer(this, desc->buffer.buffer);
 }
 
-static Opal_Result metal_deviceResetCommandAllocator(Opal_Device this, Opal_CommandAllocator command_allocator)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceResetCommandAllocator(Opal_Device this, Opal_CommandAllocator command_allocator)
 {
 	assert(this);
 	assert(command_allocator);
@@ -2323,7 +2667,7 @@ static Opal_Result metal_deviceResetCommandAllocator(Opal_Device this, Opal_Comm
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceAllocateDescriptorSet(Opal_Device this, const Opal_DescriptorSetAllocationDesc *desc, Opal_DescriptorSet *descriptor_set)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceAllocateDescriptorSet(Opal_Device this, const Opal_DescriptorSetAllocationDesc *desc, Opal_DescriptorSet *descriptor_set)
 {
 	assert(this);
 	assert(desc);
@@ -2380,7 +2724,7 @@ static Opal_Result metal_deviceAllocateDescriptorSet(Opal_Device this, const Opa
 	return opal_result;
 }
 
-static Opal_Result metal_deviceFreeDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceFreeDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set)
 {
 	assert(this);
 	assert(descriptor_set);
@@ -2396,7 +2740,7 @@ static Opal_Result metal_deviceFreeDescriptorSet(Opal_Device this, Opal_Descript
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceMapBuffer(Opal_Device this, Opal_Buffer buffer, void **ptr)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceMapBuffer(Opal_Device this, Opal_Buffer buffer, void **ptr)
 {
 	assert(this);
 	assert(buffer);
@@ -2414,7 +2758,7 @@ static Opal_Result metal_deviceMapBuffer(Opal_Device this, Opal_Buffer buffer, v
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceUnmapBuffer(Opal_Device this, Opal_Buffer buffer)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceUnmapBuffer(Opal_Device this, Opal_Buffer buffer)
 {
 	assert(this);
 	assert(buffer);
@@ -2428,7 +2772,7 @@ static Opal_Result metal_deviceUnmapBuffer(Opal_Device this, Opal_Buffer buffer)
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceWriteBuffer(Opal_Device this, Opal_Buffer buffer, uint64_t offset, const void *data, uint64_t size)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceWriteBuffer(Opal_Device this, Opal_Buffer buffer, uint64_t offset, const void *data, uint64_t size)
 {
 	assert(this);
 	assert(buffer);
@@ -2445,7 +2789,7 @@ static Opal_Result metal_deviceWriteBuffer(Opal_Device this, Opal_Buffer buffer,
 	return metal_deviceUnmapBuffer(this, buffer);
 }
 
-static Opal_Result metal_deviceUpdateDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set, uint32_t num_entries, const Opal_DescriptorSetEntry *entries)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceUpdateDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set, uint32_t num_entries, const Opal_DescriptorSetEntry *entries)
 {
 	assert(this);
 	assert(descriptor_set);
@@ -2613,7 +2957,7 @@ static Opal_Result metal_deviceUpdateDescriptorSet(Opal_Device this, Opal_Descri
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceBeginCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceBeginCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
 {
 	assert(this);
 	assert(command_buffer);
@@ -2649,7 +2993,7 @@ static Opal_Result metal_deviceBeginCommandBuffer(Opal_Device this, Opal_Command
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceEndCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceEndCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
 {
 	assert(this);
 	assert(command_buffer);
@@ -2671,7 +3015,7 @@ static Opal_Result metal_deviceEndCommandBuffer(Opal_Device this, Opal_CommandBu
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceQuerySemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t *value)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceQuerySemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t *value)
 {
 	assert(this);
 	assert(semaphore);
@@ -2689,7 +3033,7 @@ static Opal_Result metal_deviceQuerySemaphore(Opal_Device this, Opal_Semaphore s
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceSignalSemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t value)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceSignalSemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t value)
 {
 	assert(this);
 	assert(semaphore);
@@ -2706,7 +3050,7 @@ static Opal_Result metal_deviceSignalSemaphore(Opal_Device this, Opal_Semaphore
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceWaitSemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t value, uint64_t timeout_milliseconds)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceWaitSemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t value, uint64_t timeout_milliseconds)
 {
 	assert(this);
 	assert(semaphore);
@@ -2727,7 +3071,99 @@ static Opal_Result metal_deviceWaitSemaphore(Opal_Device this, Opal_Semaphore se
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceWaitQueue(Opal_Device this, Opal_Queue queue)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceWaitSemaphores(Opal_Device this, uint32_t num_semaphores, const Opal_Semaphore *semaphores, const uint64_t *values, uint32_t wait_any, uint64_t timeout_milliseconds)
+{
+	assert(this);
+	assert(num_semaphores > 0);
+	assert(semaphores);
+	assert(values);
+
+	Metal_Device *device_ptr = (Metal_Device *)this;
+
+	for (uint32_t i = 0; i < num_semaphores; ++i)
+	{
+		Metal_Semaphore *semaphore_ptr = (Metal_Semaphore *)opal_poolGetElement(&device_ptr->semaphores, (Opal_PoolHandle)semaphores[i]);
+		assert(semaphore_ptr);
+
+		if (!semaphore_ptr->shared_event)
+			return OPAL_METAL_ERROR;
+	}
+
+	// note: there's no native multiple event wait, so every semaphore notifies a dispatch semaphore
+	//       once its value is reached, and the thread sleeps until enough notifications arrive
+	dispatch_semaphore_t signal = dispatch_semaphore_create(0);
+
+	@autoreleasepool
+	{
+		MTLSharedEventListener *listener = [[MTLSharedEventListener alloc] init];
+
+		for (uint32_t i = 0; i < num_semaphores; ++i)
+		{
+			Metal_Semaphore *semaphore_ptr = (Metal_Semaphore *)opal_poolGetElement(&device_ptr->semaphores, (Opal_PoolHandle)semaphores[i]);
+
+			[semaphore_ptr->shared_event notifyListener: listener atValue: values[i] block: ^(id<MTLSharedEvent> event, uint64_t value)
+			{
+				dispatch_semaphore_signal(signal);
+			}];
+		}
+
+		[listener release];
+	}
+
+	dispatch_time_t deadline = DISPATCH_TIME_FOREVER;
+	if (timeout_milliseconds < UINT64_MAX / NSEC_PER_MSEC)
+		deadline = dispatch_time(DISPATCH_TIME_NOW, (int64_t)(timeout_milliseconds * NSEC_PER_MSEC));
+
+	uint32_t num_required = (wait_any) ? 1 : num_semaphores;
+	Opal_Result result = OPAL_SUCCESS;
+
+	for (uint32_t i = 0; i < num_required; ++i)
+	{
+		if (dispatch_semaphore_wait(signal, deadline) != 0)
+		{
+			result = OPAL_WAIT_TIMEOUT;
+			break;
+		}
+	}
+
+	dispatch_release(signal);
+	return result;
+}
+
+OPAL_BACKEND_STATIC Opal_Result metal_deviceRegisterSemaphoreCallback(Opal_Device this, Opal_Semaphore semaphore, uint64_t value, PFN_opalSemaphoreCallback callback, void *user_data)
+{
+	assert(this);
+	assert(semaphore);
+	assert(callback);
+
+	Metal_Device *device_ptr = (Metal_Device *)this;
+
+	Metal_Semaphore *semaphore_ptr = (Metal_Semaphore *)opal_poolGetElement(&device_ptr->semaphores, (Opal_PoolHandle)semaphore);
+	assert(semaphore_ptr);
+
+	if (!semaphore_ptr->shared_event)
+		return OPAL_METAL_ERROR;
+
+	@autoreleasepool
+	{
+		[semaphore_ptr->shared_event notifyListener: device_ptr->listener atValue: value block: ^(id<MTLSharedEvent> event, uint64_t signaled_value)
+		{
+			callback(user_data, semaphore, value);
+		}];
+	}
+
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result metal_deviceWaitPipelineTask(Opal_Device this, Opal_PipelineTask task, uint64_t timeout_milliseconds)
+{
+	assert(this);
+
+	Metal_Device *device_ptr = (Metal_Device *)this;
+	return opal_compilerWait(&device_ptr->compiler, task, timeout_milliseconds);
+}
+
+OPAL_BACKEND_STATIC Opal_Result metal_deviceWaitQueue(Opal_Device this, Opal_Queue queue)
 {
 	assert(this);
 	assert(queue);
@@ -2748,7 +3184,7 @@ static Opal_Result metal_deviceWaitQueue(Opal_Device this, Opal_Queue queue)
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceWaitIdle(Opal_Device this)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceWaitIdle(Opal_Device this)
 {
 	assert(this);
 	Metal_Device *device_ptr = (Metal_Device *)this;
@@ -2765,7 +3201,7 @@ static Opal_Result metal_deviceWaitIdle(Opal_Device this)
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceSubmit(Opal_Device this, Opal_Queue queue, const Opal_SubmitDesc *desc)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceSubmit(Opal_Device this, Opal_Queue queue, const Opal_SubmitDesc *desc)
 {
 	assert(this);
 	assert(queue);
@@ -2835,6 +3271,7 @@ static Opal_Result metal_deviceSubmit(Opal_Device this, Opal_Queue queue, const
 				assert(swapchain_ptr);
 
 				// TODO: encode signal command
+				opal_pacingSubmit(&swapchain_ptr->pacing, opal_timerGetNanoseconds());
 			}
 
 			[signal_command_buffer commit];
@@ -2844,7 +3281,7 @@ static Opal_Result metal_deviceSubmit(Opal_Device this, Opal_Queue queue, const
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceAcquire(Opal_Device this, Opal_Swapchain swapchain, Opal_TextureView *texture_view)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceAcquire(Opal_Device this, Opal_Swapchain swapchain, Opal_TextureView *texture_view)
 {
 	assert(this);
 	assert(swapchain);
@@ -2865,11 +3302,20 @@ static Opal_Result metal_deviceAcquire(Opal_Device this, Opal_Swapchain swapchai
 	assert(swapchain_ptr->current_texture_view == OPAL_NULL_HANDLE);
 	assert(swapchain_ptr->current_drawable == nil);
 
+	// note: the slot is given back by the presented handler of the drawable
+	if (swapchain_ptr->frame_semaphore)
+		dispatch_semaphore_wait(swapchain_ptr->frame_semaphore, DISPATCH_TIME_FOREVER);
+
 	@autoreleasepool
 	{
 		id<CAMetalDrawable> drawable = [surface_ptr->layer nextDrawable];
 		if (!drawable)
+		{
+			if (swapchain_ptr->frame_semaphore)
+				dispatch_semaphore_signal(swapchain_ptr->frame_semaphore);
+
 			return OPAL_METAL_ERROR;
+		}
 
 		Metal_TextureView result = {0};
 		result.texture_view = drawable.texture;
@@ -2882,10 +3328,12 @@ static Opal_Result metal_deviceAcquire(Opal_Device this, Opal_Swapchain swapchai
 	}
 
 	*texture_view = swapchain_ptr->current_texture_view;
+
+	opal_pacingAcquire(&swapchain_ptr->pacing, opal_timerGetNanoseconds());
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_devicePresent(Opal_Device this, Opal_Swapchain swapchain)
+OPAL_BACKEND_STATIC Opal_Result metal_devicePresent(Opal_Device this, Opal_Swapchain swapchain)
 {
 	assert(this);
 	assert(swapchain);
@@ -2904,10 +3352,26 @@ static Opal_Result metal_devicePresent(Opal_Device this, Opal_Swapchain swapchai
 		if (!present_command_buffer)
 			return OPAL_METAL_ERROR;
 
+		// note: the handler runs for dropped drawables too, so the slot always comes back
+		dispatch_semaphore_t frame_semaphore = swapchain_ptr->frame_semaphore;
+		if (frame_semaphore)
+		{
+			[swapchain_ptr->current_drawable addPresentedHandler: ^(id<MTLDrawable> drawable)
+			{
+				OPAL_UNUSED(drawable);
+				dispatch_semaphore_signal(frame_semaphore);
+			}];
+		}
+
 		[present_command_buffer presentDrawable: swapchain_ptr->current_drawable];
 		[present_command_buffer commit];
 
-		[swapchain_ptr->current_drawable release];
+		// note: keep the drawable around until its slot is reused to read back presentedTime
+		uint64_t frame_id = opal_pacingPresent(&swapchain_ptr->pacing, opal_timerGetNanoseconds());
+		uint32_t slot = (uint32_t)(frame_id % OPAL_PACING_MAX_FRAMES);
+
+		[swapchain_ptr->presented_drawables[slot] release];
+		swapchain_ptr->presented_drawables[slot] = swapchain_ptr->current_drawable;
 	}
 
 	Opal_Result opal_result = opal_poolRemoveElement(&device_ptr->texture_views, swapchain_ptr->current_texture_view);
@@ -2921,7 +3385,58 @@ static Opal_Result metal_devicePresent(Opal_Device this, Opal_Swapchain swapchai
 	return opal_result;
 }
 
-static Opal_Result metal_deviceCmdSetDescriptorHeap(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_DescriptorHeap descriptor_heap)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceWaitPresent(Opal_Device this, Opal_Swapchain swapchain, uint64_t frame_id, uint64_t timeout_milliseconds)
+{
+	OPAL_UNUSED(this);
+	OPAL_UNUSED(swapchain);
+	OPAL_UNUSED(frame_id);
+	OPAL_UNUSED(timeout_milliseconds);
+
+	return OPAL_NOT_SUPPORTED;
+}
+
+OPAL_BACKEND_STATIC Opal_Result metal_deviceGetSwapchainFrameTiming(Opal_Device this, Opal_Swapchain swapchain, Opal_FrameTiming *timing)
+{
+	assert(this);
+	assert(swapchain);
+	assert(timing);
+
+	Metal_Device *device_ptr = (Metal_Device *)this;
+
+	Metal_Swapchain *swapchain_ptr = (Metal_Swapchain *)opal_poolGetElement(&device_ptr->swapchains, (Opal_PoolHandle)swapchain);
+	assert(swapchain_ptr);
+
+	uint64_t last_frame = swapchain_ptr->pacing.last_presented_frame;
+	uint64_t first_frame = swapchain_ptr->pacing.last_displayed_frame + 1;
+
+	if (last_frame >= OPAL_PACING_MAX_FRAMES && first_frame < last_frame - OPAL_PACING_MAX_FRAMES + 1)
+		first_frame = last_frame - OPAL_PACING_MAX_FRAMES + 1;
+
+	// note: presentedTime is in CACurrentMediaTime seconds and stays zero until the drawable
+	//       is on screen (or forever if it was dropped), rebase it onto the opal timer
+	@autoreleasepool
+	{
+		for (uint64_t frame_id = last_frame; frame_id >= first_frame; --frame_id)
+		{
+			id<CAMetalDrawable> drawable = swapchain_ptr->presented_drawables[frame_id % OPAL_PACING_MAX_FRAMES];
+			CFTimeInterval presented_time = drawable.presentedTime;
+
+			if (presented_time <= 0.0)
+				continue;
+
+			uint64_t now = opal_timerGetNanoseconds();
+			uint64_t elapsed = (uint64_t)((CACurrentMediaTime() - presented_time) * 1000000000.0);
+
+			opal_pacingDisplay(&swapchain_ptr->pacing, frame_id, (now > elapsed) ? now - elapsed : 0);
+			break;
+		}
+	}
+
+	opal_pacingGetTiming(&swapchain_ptr->pacing, timing);
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdSetDescriptorHeap(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_DescriptorHeap descriptor_heap)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -2930,7 +3445,7 @@ static Opal_Result metal_deviceCmdSetDescriptorHeap(Opal_Device this, Opal_Comma
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCmdBeginGraphicsPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_FramebufferDesc *framebuffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdBeginGraphicsPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_FramebufferDesc *framebuffer, const Opal_PassBarriersDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -3030,7 +3545,7 @@ static Opal_Result metal_deviceCmdBeginGraphicsPass(Opal_Device this, Opal_Comma
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCmdGraphicsSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdGraphicsSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
 {
 	assert(this);
 	assert(command_buffer);
@@ -3055,7 +3570,7 @@ static Opal_Result metal_deviceCmdGraphicsSetPipelineLayout(Opal_Device this, Op
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCmdGraphicsSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_GraphicsPipeline pipeline)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdGraphicsSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_GraphicsPipeline pipeline)
 {
 	assert(this);
 	assert(command_buffer);
@@ -3085,7 +3600,7 @@ static Opal_Result metal_deviceCmdGraphicsSetPipeline(Opal_Device this, Opal_Com
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCmdGraphicsSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdGraphicsSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
 {
 	assert(this);
 	assert(command_buffer);
@@ -3185,7 +3700,7 @@ static Opal_Result metal_deviceCmdGraphicsSetDescriptorSet(Opal_Device this, Opa
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCmdGraphicsSetVertexBuffers(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t first_index, uint32_t num_vertex_buffers, const Opal_VertexBufferView *vertex_buffers)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdGraphicsSetVertexBuffers(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t first_index, uint32_t num_vertex_buffers, const Opal_VertexBufferView *vertex_buffers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -3217,7 +3732,7 @@ static Opal_Result metal_deviceCmdGraphicsSetVertexBuffers(Opal_Device this, Opa
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCmdGraphicsSetIndexBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_IndexBufferView index_buffer)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdGraphicsSetIndexBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_IndexBufferView index_buffer)
 {
 	assert(this);
 	assert(command_buffer);
@@ -3239,7 +3754,7 @@ static Opal_Result metal_deviceCmdGraphicsSetIndexBuffer(Opal_Device this, Opal_
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCmdGraphicsSetViewport(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Viewport viewport)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdGraphicsSetViewport(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Viewport viewport)
 {
 	assert(this);
 	assert(command_buffer);
@@ -3266,7 +3781,7 @@ static Opal_Result metal_deviceCmdGraphicsSetViewport(Opal_Device this, Opal_Com
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCmdGraphicsSetScissor(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdGraphicsSetScissor(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
 {
 	assert(this);
 	assert(command_buffer);
@@ -3291,7 +3806,7 @@ static Opal_Result metal_deviceCmdGraphicsSetScissor(Opal_Device this, Opal_Comm
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCmdGraphicsDraw(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_vertices, uint32_t num_instances, uint32_t base_vertex, uint32_t base_instance)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdGraphicsDraw(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_vertices, uint32_t num_instances, uint32_t base_vertex, uint32_t base_instance)
 {
 	assert(this);
 	assert(command_buffer);
@@ -3317,7 +3832,7 @@ static Opal_Result metal_deviceCmdGraphicsDraw(Opal_Device this, Opal_CommandBuf
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCmdGraphicsDrawIndexed(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_indices, uint32_t num_instances, uint32_t base_index, int32_t vertex_offset, uint32_t base_instance)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdGraphicsDrawIndexed(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_indices, uint32_t num_instances, uint32_t base_index, int32_t vertex_offset, uint32_t base_instance)
 {
 	assert(this);
 	assert(command_buffer);
@@ -3352,7 +3867,7 @@ static Opal_Result metal_deviceCmdGraphicsDrawIndexed(Opal_Device this, Opal_Com
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCmdGraphicsMeshletDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_threadgroups_x, uint32_t num_threadgroups_y, uint32_t num_threadgroups_z)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdGraphicsMeshletDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_threadgroups_x, uint32_t num_threadgroups_y, uint32_t num_threadgroups_z)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -3363,7 +3878,7 @@ static Opal_Result metal_deviceCmdGraphicsMeshletDispatch(Opal_Device this, Opal
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result metal_deviceCmdEndGraphicsPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdEndGraphicsPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -3387,7 +3902,7 @@ static Opal_Result metal_deviceCmdEndGraphicsPass(Opal_Device this, Opal_Command
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCmdBeginComputePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdBeginComputePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -3414,7 +3929,7 @@ static Opal_Result metal_deviceCmdBeginComputePass(Opal_Device this, Opal_Comman
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCmdComputeSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdComputeSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
 {
 	assert(this);
 	assert(command_buffer);
@@ -3438,7 +3953,7 @@ static Opal_Result metal_deviceCmdComputeSetPipelineLayout(Opal_Device this, Opa
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCmdComputeSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_ComputePipeline pipeline)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdComputeSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_ComputePipeline pipeline)
 {
 	assert(this);
 	assert(command_buffer);
@@ -3465,7 +3980,7 @@ static Opal_Result metal_deviceCmdComputeSetPipeline(Opal_Device this, Opal_Comm
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCmdComputeSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdComputeSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
 {
 	assert(this);
 	assert(command_buffer);
@@ -3563,7 +4078,7 @@ static Opal_Result metal_deviceCmdComputeSetDescriptorSet(Opal_Device this, Opal
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCmdComputeMemoryBarrier(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_MemoryBarrierDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdComputeMemoryBarrier(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_MemoryBarrierDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -3610,7 +4125,7 @@ static Opal_Result metal_deviceCmdComputeMemoryBarrier(Opal_Device this, Opal_Co
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCmdComputeDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_threadgroups_x, uint32_t num_threadgroups_y, uint32_t num_threadgroups_z)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdComputeDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_threadgroups_x, uint32_t num_threadgroups_y, uint32_t num_threadgroups_z)
 {
 	assert(this);
 	assert(command_buffer);
@@ -3640,7 +4155,7 @@ static Opal_Result metal_deviceCmdComputeDispatch(Opal_Device this, Opal_Command
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCmdEndComputePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdEndComputePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -3664,7 +4179,7 @@ static Opal_Result metal_deviceCmdEndComputePass(Opal_Device this, Opal_CommandB
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCmdBeginRaytracePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdBeginRaytracePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -3673,7 +4188,7 @@ static Opal_Result metal_deviceCmdBeginRaytracePass(Opal_Device this, Opal_Comma
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result metal_deviceCmdRaytraceSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdRaytraceSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -3682,7 +4197,7 @@ static Opal_Result metal_deviceCmdRaytraceSetPipelineLayout(Opal_Device this, Op
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result metal_deviceCmdRaytraceSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_RaytracePipeline pipeline)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdRaytraceSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_RaytracePipeline pipeline)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -3691,7 +4206,7 @@ static Opal_Result metal_deviceCmdRaytraceSetPipeline(Opal_Device this, Opal_Com
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result metal_deviceCmdRaytraceSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdRaytraceSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -3702,7 +4217,7 @@ static Opal_Result metal_deviceCmdRaytraceSetDescriptorSet(Opal_Device this, Opa
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result metal_deviceCmdRaytraceSetShaderBindingTable(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_ShaderBindingTable shader_binding_table)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdRaytraceSetShaderBindingTable(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_ShaderBindingTable shader_binding_table)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -3711,7 +4226,7 @@ static Opal_Result metal_deviceCmdRaytraceSetShaderBindingTable(Opal_Device this
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result metal_deviceCmdRaytraceMemoryBarrier(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_MemoryBarrierDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdRaytraceMemoryBarrier(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_MemoryBarrierDesc *barriers)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -3720,7 +4235,7 @@ static Opal_Result metal_deviceCmdRaytraceMemoryBarrier(Opal_Device this, Opal_C
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result metal_deviceCmdRaytraceDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t width, uint32_t height, uint32_t depth)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdRaytraceDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t width, uint32_t height, uint32_t depth)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -3731,7 +4246,7 @@ static Opal_Result metal_deviceCmdRaytraceDispatch(Opal_Device this, Opal_Comman
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result metal_deviceCmdEndRaytracePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdEndRaytracePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -3740,7 +4255,7 @@ static Opal_Result metal_deviceCmdEndRaytracePass(Opal_Device this, Opal_Command
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result metal_deviceCmdBeginCopyPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdBeginCopyPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -3767,7 +4282,7 @@ static Opal_Result metal_deviceCmdBeginCopyPass(Opal_Device this, Opal_CommandBu
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCmdCopyBufferToBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer src_buffer, uint64_t src_offset, Opal_Buffer dst_buffer, uint64_t dst_offset, uint64_t size)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdCopyBufferToBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer src_buffer, uint64_t src_offset, Opal_Buffer dst_buffer, uint64_t dst_offset, uint64_t size)
 {
 	assert(this);
 	assert(command_buffer);
@@ -3800,7 +4315,7 @@ static Opal_Result metal_deviceCmdCopyBufferToBuffer(Opal_Device this, Opal_Comm
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCmdCopyBufferToTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_BufferTextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdCopyBufferToTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_BufferTextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size)
 {
 	assert(this);
 	assert(command_buffer);
@@ -3847,7 +4362,7 @@ static Opal_Result metal_deviceCmdCopyBufferToTexture(Opal_Device this, Opal_Com
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCmdCopyTextureToBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_BufferTextureRegion dst, Opal_Extent3D size)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdCopyTextureToBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_BufferTextureRegion dst, Opal_Extent3D size)
 {
 	assert(this);
 	assert(command_buffer);
@@ -3894,7 +4409,125 @@ static Opal_Result metal_deviceCmdCopyTextureToBuffer(Opal_Device this, Opal_Com
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCmdCopyTextureToTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdCopyBufferToTextureRegions(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer src_buffer, Opal_Texture dst_texture, uint32_t num_regions, const Opal_BufferTextureCopyRegion *regions)
+{
+	assert(this);
+	assert(command_buffer);
+	assert(num_regions == 0 || regions);
+
+	Metal_Device *device_ptr = (Metal_Device *)this;
+
+	Metal_CommandBuffer *command_buffer_ptr = (Metal_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->command_buffer);
+	assert(command_buffer_ptr->graphics_pass_encoder == nil);
+	assert(command_buffer_ptr->compute_pass_encoder == nil);
+	assert(command_buffer_ptr->copy_pass_encoder != nil);
+	assert(command_buffer_ptr->acceleration_structure_pass_encoder == nil);
+
+	Metal_Buffer *src_buffer_ptr = (Metal_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)src_buffer);
+	assert(src_buffer_ptr);
+	assert(src_buffer_ptr->buffer);
+
+	Metal_Texture *dst_texture_ptr = (Metal_Texture *)opal_poolGetElement(&device_ptr->textures, (Opal_PoolHandle)dst_texture);
+	assert(dst_texture_ptr);
+	assert(dst_texture_ptr->texture);
+
+	for (uint32_t i = 0; i < num_regions; ++i)
+	{
+		const Opal_BufferTextureCopyRegion *region = &regions[i];
+		assert(region->layer_count > 0);
+
+		NSUInteger bytes_per_image = (NSUInteger)region->row_size * region->num_rows;
+
+		MTLSize src_size = {0};
+		src_size.width = region->size.width;
+		src_size.height = region->size.height;
+		src_size.depth = region->size.depth;
+
+		MTLOrigin dst_origin = {0};
+		dst_origin.x = region->texture_offset.x;
+		dst_origin.y = region->texture_offset.y;
+		dst_origin.z = region->texture_offset.z;
+
+		for (uint32_t layer = 0; layer < region->layer_count; ++layer)
+		{
+			[command_buffer_ptr->copy_pass_encoder
+				copyFromBuffer: src_buffer_ptr->buffer
+				sourceOffset: (NSUInteger)(region->buffer_offset + bytes_per_image * region->size.depth * layer)
+				sourceBytesPerRow: (NSUInteger)region->row_size
+				sourceBytesPerImage: (region->size.depth > 1) ? bytes_per_image : 0
+				sourceSize: src_size
+				toTexture: dst_texture_ptr->texture
+				destinationSlice: region->base_layer + layer
+				destinationLevel: region->mip
+				destinationOrigin: dst_origin];
+		}
+	}
+
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdCopyTextureToBufferRegions(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Texture src_texture, Opal_Buffer dst_buffer, uint32_t num_regions, const Opal_BufferTextureCopyRegion *regions)
+{
+	assert(this);
+	assert(command_buffer);
+	assert(num_regions == 0 || regions);
+
+	Metal_Device *device_ptr = (Metal_Device *)this;
+
+	Metal_CommandBuffer *command_buffer_ptr = (Metal_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->command_buffer);
+	assert(command_buffer_ptr->graphics_pass_encoder == nil);
+	assert(command_buffer_ptr->compute_pass_encoder == nil);
+	assert(command_buffer_ptr->copy_pass_encoder != nil);
+	assert(command_buffer_ptr->acceleration_structure_pass_encoder == nil);
+
+	Metal_Texture *src_texture_ptr = (Metal_Texture *)opal_poolGetElement(&device_ptr->textures, (Opal_PoolHandle)src_texture);
+	assert(src_texture_ptr);
+	assert(src_texture_ptr->texture);
+
+	Metal_Buffer *dst_buffer_ptr = (Metal_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)dst_buffer);
+	assert(dst_buffer_ptr);
+	assert(dst_buffer_ptr->buffer);
+
+	for (uint32_t i = 0; i < num_regions; ++i)
+	{
+		const Opal_BufferTextureCopyRegion *region = &regions[i];
+		assert(region->layer_count > 0);
+
+		NSUInteger bytes_per_image = (NSUInteger)region->row_size * region->num_rows;
+
+		MTLSize src_size = {0};
+		src_size.width = region->size.width;
+		src_size.height = region->size.height;
+		src_size.depth = region->size.depth;
+
+		MTLOrigin src_origin = {0};
+		src_origin.x = region->texture_offset.x;
+		src_origin.y = region->texture_offset.y;
+		src_origin.z = region->texture_offset.z;
+
+		for (uint32_t layer = 0; layer < region->layer_count; ++layer)
+		{
+			[command_buffer_ptr->copy_pass_encoder
+				copyFromTexture: src_texture_ptr->texture
+				sourceSlice: region->base_layer + layer
+				sourceLevel: region->mip
+				sourceOrigin: src_origin
+				sourceSize: src_size
+				toBuffer: dst_buffer_ptr->buffer
+				destinationOffset: (NSUInteger)(region->buffer_offset + bytes_per_image * region->size.depth * layer)
+				destinationBytesPerRow: (NSUInteger)region->row_size
+				destinationBytesPerImage: (region->size.depth > 1) ? bytes_per_image : 0];
+		}
+	}
+
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdCopyTextureToTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size)
 {
 	assert(this);
 	assert(command_buffer);
@@ -3946,7 +4579,182 @@ static Opal_Result metal_deviceCmdCopyTextureToTexture(Opal_Device this, Opal_Co
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCmdEndCopyPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdFillBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer buffer, uint64_t offset, uint64_t size, uint32_t value)
+{
+	assert(this);
+	assert(command_buffer);
+	assert((offset & 3) == 0);
+	assert((size & 3) == 0);
+
+	Metal_Device *device_ptr = (Metal_Device *)this;
+
+	Metal_CommandBuffer *command_buffer_ptr = (Metal_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->command_buffer);
+	assert(command_buffer_ptr->graphics_pass_encoder == nil);
+	assert(command_buffer_ptr->compute_pass_encoder == nil);
+	assert(command_buffer_ptr->copy_pass_encoder != nil);
+	assert(command_buffer_ptr->acceleration_structure_pass_encoder == nil);
+
+	Metal_Buffer *buffer_ptr = (Metal_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)buffer);
+	assert(buffer_ptr);
+	assert(buffer_ptr->buffer);
+
+	if (size == 0)
+		return OPAL_SUCCESS;
+
+	uint8_t byte = (uint8_t)(value & 0xFF);
+	if (value == byte * 0x01010101u)
+	{
+		[command_buffer_ptr->copy_pass_encoder
+			fillBuffer: buffer_ptr->buffer
+			range: NSMakeRange((NSUInteger)offset, (NSUInteger)size)
+			value: byte];
+
+		return OPAL_SUCCESS;
+	}
+
+	// note: blit encoders only fill bytes, wider patterns are copied from a temporary buffer in chunks
+	NSUInteger pattern_size = (NSUInteger)((size < OPAL_MAX_UPDATE_BUFFER_SIZE) ? size : OPAL_MAX_UPDATE_BUFFER_SIZE);
+
+	id<MTLBuffer> pattern = [device_ptr->device newBufferWithLength: pattern_size options: MTLResourceStorageModeShared];
+	if (pattern == nil)
+		return OPAL_NO_MEMORY;
+
+	uint32_t *pattern_data = (uint32_t *)pattern.contents;
+	for (NSUInteger i = 0; i < pattern_size / sizeof(uint32_t); ++i)
+		pattern_data[i] = value;
+
+	for (uint64_t copied = 0; copied < size; copied += pattern_size)
+	{
+		uint64_t chunk_size = size - copied;
+		if (chunk_size > pattern_size)
+			chunk_size = pattern_size;
+
+		[command_buffer_ptr->copy_pass_encoder
+			copyFromBuffer: pattern
+			sourceOffset: 0
+			toBuffer: buffer_ptr->buffer
+			destinationOffset: (NSUInteger)(offset + copied)
+			size: (NSUInteger)chunk_size];
+	}
+
+	metal_cmdReleaseOnCompletion(command_buffer_ptr, pattern);
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdUpdateBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer buffer, uint64_t offset, uint64_t size, const void *data)
+{
+	assert(this);
+	assert(command_buffer);
+	assert(size == 0 || data);
+	assert((offset & 3) == 0);
+	assert((size & 3) == 0);
+
+	if (size > OPAL_MAX_UPDATE_BUFFER_SIZE)
+		return OPAL_NOT_SUPPORTED;
+
+	Metal_Device *device_ptr = (Metal_Device *)this;
+
+	Metal_CommandBuffer *command_buffer_ptr = (Metal_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->command_buffer);
+	assert(command_buffer_ptr->graphics_pass_encoder == nil);
+	assert(command_buffer_ptr->compute_pass_encoder == nil);
+	assert(command_buffer_ptr->copy_pass_encoder != nil);
+	assert(command_buffer_ptr->acceleration_structure_pass_encoder == nil);
+
+	Metal_Buffer *buffer_ptr = (Metal_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)buffer);
+	assert(buffer_ptr);
+	assert(buffer_ptr->buffer);
+
+	if (size == 0)
+		return OPAL_SUCCESS;
+
+	id<MTLBuffer> staging = [device_ptr->device newBufferWithBytes: data length: (NSUInteger)size options: MTLResourceStorageModeShared];
+	if (staging == nil)
+		return OPAL_NO_MEMORY;
+
+	[command_buffer_ptr->copy_pass_encoder
+		copyFromBuffer: staging
+		sourceOffset: 0
+		toBuffer: buffer_ptr->buffer
+		destinationOffset: (NSUInteger)offset
+		size: (NSUInteger)size];
+
+	metal_cmdReleaseOnCompletion(command_buffer_ptr, staging);
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdClearTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureView texture_view, Opal_ClearValue clear_value)
+{
+	assert(this);
+	assert(command_buffer);
+
+	Metal_Device *device_ptr = (Metal_Device *)this;
+
+	Metal_CommandBuffer *command_buffer_ptr = (Metal_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->command_buffer);
+	assert(command_buffer_ptr->graphics_pass_encoder == nil);
+	assert(command_buffer_ptr->compute_pass_encoder == nil);
+	assert(command_buffer_ptr->copy_pass_encoder != nil);
+	assert(command_buffer_ptr->acceleration_structure_pass_encoder == nil);
+
+	Metal_TextureView *texture_view_ptr = (Metal_TextureView *)opal_poolGetElement(&device_ptr->texture_views, (Opal_PoolHandle)texture_view);
+	assert(texture_view_ptr);
+	assert(texture_view_ptr->texture_view);
+
+	if ((texture_view_ptr->texture_view.usage & MTLTextureUsageRenderTarget) == 0)
+		return OPAL_NOT_SUPPORTED;
+
+	return metal_cmdClearTexture(device_ptr, command_buffer_ptr, texture_view_ptr->texture_view, clear_value);
+}
+
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdBlitTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_Extent3D src_size, Opal_TextureRegion dst, Opal_Extent3D dst_size, Opal_SamplerFilterMode filter)
+{
+	assert(this);
+	assert(command_buffer);
+
+	// note: there is no scaling blit in the API, so only unscaled nearest blits are supported and they're plain copies
+	if (filter != OPAL_SAMPLER_FILTER_MODE_NEAREST)
+		return OPAL_NOT_SUPPORTED;
+
+	if (src_size.width != dst_size.width || src_size.height != dst_size.height || src_size.depth != dst_size.depth)
+		return OPAL_NOT_SUPPORTED;
+
+	return metal_deviceCmdCopyTextureToTexture(this, command_buffer, src, dst, src_size);
+}
+
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdGenerateMips(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureView texture_view)
+{
+	assert(this);
+	assert(command_buffer);
+
+	Metal_Device *device_ptr = (Metal_Device *)this;
+
+	Metal_CommandBuffer *command_buffer_ptr = (Metal_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->command_buffer);
+	assert(command_buffer_ptr->graphics_pass_encoder == nil);
+	assert(command_buffer_ptr->compute_pass_encoder == nil);
+	assert(command_buffer_ptr->copy_pass_encoder != nil);
+	assert(command_buffer_ptr->acceleration_structure_pass_encoder == nil);
+
+	Metal_TextureView *texture_view_ptr = (Metal_TextureView *)opal_poolGetElement(&device_ptr->texture_views, (Opal_PoolHandle)texture_view);
+	assert(texture_view_ptr);
+	assert(texture_view_ptr->texture_view);
+
+	if (texture_view_ptr->texture_view.mipmapLevelCount < 2)
+		return OPAL_SUCCESS;
+
+	// note: the view starts at its base mip, so the whole chain of the view is generated in a single command
+	[command_buffer_ptr->copy_pass_encoder generateMipmapsForTexture: texture_view_ptr->texture_view];
+
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdEndCopyPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -3970,7 +4778,7 @@ static Opal_Result metal_deviceCmdEndCopyPass(Opal_Device this, Opal_CommandBuff
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCmdBeginAccelerationStructurePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdBeginAccelerationStructurePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -3997,7 +4805,7 @@ static Opal_Result metal_deviceCmdBeginAccelerationStructurePass(Opal_Device thi
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCmdAccelerationStructureBuild(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureBuildDesc *desc)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdAccelerationStructureBuild(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureBuildDesc *desc)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4149,16 +4957,133 @@ static Opal_Result metal_deviceCmdAccelerationStructureBuild(Opal_Device this, O
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCmdAccelerationStructureCopy(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureCopyDesc *desc)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdAccelerationStructureBuildBatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_descs, const Opal_AccelerationStructureBuildDesc *descs)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(command_buffer);
-	OPAL_UNUSED(desc);
+	assert(this);
+	assert(command_buffer);
+	assert(num_descs == 0 || descs);
 
-	return OPAL_NOT_SUPPORTED;
+	Metal_Device *device_ptr = (Metal_Device *)this;
+
+	Metal_CommandBuffer *command_buffer_ptr = (Metal_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->command_buffer);
+	assert(command_buffer_ptr->acceleration_structure_pass_encoder != nil);
+
+	// note: runs are encoded into separate encoders chained with a fence
+	uint32_t first_build = 0;
+	while (first_build < num_descs)
+	{
+		uint32_t num_builds = opal_buildBatchGetRun(&device_ptr->build_batch, num_descs - first_build, descs + first_build);
+		assert(num_builds > 0);
+
+		if (first_build > 0)
+		{
+			Opal_Result result = metal_cmdSplitAccelerationStructurePass(device_ptr, command_buffer_ptr);
+			if (result != OPAL_SUCCESS)
+				return result;
+		}
+
+		for (uint32_t i = 0; i < num_builds; ++i)
+		{
+			Opal_Result result = metal_deviceCmdAccelerationStructureBuild(this, command_buffer, &descs[first_build + i]);
+			if (result != OPAL_SUCCESS)
+				return result;
+		}
+
+		first_build += num_builds;
+	}
+
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_deviceCmdEndAccelerationStructurePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdAccelerationStructureCopy(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureCopyDesc *desc)
+{
+	assert(this);
+	assert(command_buffer);
+	assert(desc);
+
+	Metal_Device *device_ptr = (Metal_Device *)this;
+
+	Metal_CommandBuffer *command_buffer_ptr = (Metal_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->command_buffer);
+	assert(command_buffer_ptr->acceleration_structure_pass_encoder != nil);
+
+	const Metal_AccelerationStructure *src_acceleration_structure_ptr = opal_poolGetElement(&device_ptr->acceleration_structures, (Opal_PoolHandle)desc->src_acceleration_structure);
+	assert(src_acceleration_structure_ptr);
+
+	const Metal_AccelerationStructure *dst_acceleration_structure_ptr = opal_poolGetElement(&device_ptr->acceleration_structures, (Opal_PoolHandle)desc->dst_acceleration_structure);
+	assert(dst_acceleration_structure_ptr);
+
+	id<MTLAccelerationStructureCommandEncoder> metal_pass_encoder = command_buffer_ptr->acceleration_structure_pass_encoder;
+
+	switch (desc->copy_mode)
+	{
+		case OPAL_ACCELERATION_STRUCTURE_COPY_MODE_CLONE:
+		{
+			[metal_pass_encoder
+				copyAccelerationStructure: src_acceleration_structure_ptr->acceleration_structure
+				toAccelerationStructure: dst_acceleration_structure_ptr->acceleration_structure
+			];
+		}
+		break;
+
+		case OPAL_ACCELERATION_STRUCTURE_COPY_MODE_COMPACT:
+		{
+			[metal_pass_encoder
+				copyAndCompactAccelerationStructure: src_acceleration_structure_ptr->acceleration_structure
+				toAccelerationStructure: dst_acceleration_structure_ptr->acceleration_structure
+			];
+		}
+		break;
+
+		default: assert(0); return OPAL_METAL_ERROR;
+	}
+
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdAccelerationStructureWriteCompactedSizes(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_acceleration_structures, const Opal_AccelerationStructure *acceleration_structures, Opal_BufferView dst)
+{
+	assert(this);
+	assert(command_buffer);
+	assert(num_acceleration_structures == 0 || acceleration_structures);
+
+	Metal_Device *device_ptr = (Metal_Device *)this;
+
+	Metal_CommandBuffer *command_buffer_ptr = (Metal_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->command_buffer);
+	assert(command_buffer_ptr->acceleration_structure_pass_encoder != nil);
+
+	const Metal_Buffer *buffer_ptr = opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)dst.buffer);
+	assert(buffer_ptr);
+
+	// note: sizes are only known after the builds are done
+	Opal_Result result = metal_cmdSplitAccelerationStructurePass(device_ptr, command_buffer_ptr);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	id<MTLAccelerationStructureCommandEncoder> metal_pass_encoder = command_buffer_ptr->acceleration_structure_pass_encoder;
+
+	for (uint32_t i = 0; i < num_acceleration_structures; ++i)
+	{
+		const Metal_AccelerationStructure *acceleration_structure_ptr = opal_poolGetElement(&device_ptr->acceleration_structures, (Opal_PoolHandle)acceleration_structures[i]);
+		assert(acceleration_structure_ptr);
+
+		[metal_pass_encoder
+			writeCompactedAccelerationStructureSize: acceleration_structure_ptr->acceleration_structure
+			toBuffer: buffer_ptr->buffer
+			offset: dst.offset + sizeof(uint64_t) * i
+			sizeDataType: MTLDataTypeULong
+		];
+	}
+
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result metal_deviceCmdEndAccelerationStructurePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4189,6 +5114,7 @@ static Opal_DeviceTable device_vtbl =
 	metal_deviceGetInfo,
 	metal_deviceGetQueue,
 	metal_deviceGetAccelerationStructurePrebuildInfo,
+	metal_deviceGetAccelerationStructureAddress,
 	metal_deviceGetSupportedSurfaceFormats,
 	metal_deviceGetSupportedPresentModes,
 	metal_deviceGetPreferredSurfaceFormat,
@@ -4212,6 +5138,12 @@ static Opal_DeviceTable device_vtbl =
 	metal_deviceCreateMeshletPipeline,
 	metal_deviceCreateComputePipeline,
 	metal_deviceCreateRaytracePipeline,
+	metal_deviceCreateGraphicsPipelines,
+	metal_deviceCreateComputePipelines,
+	metal_deviceCreateRaytracePipelines,
+	metal_deviceCreateGraphicsPipelinesAsync,
+	metal_deviceCreateComputePipelinesAsync,
+	metal_deviceCreateRaytracePipelinesAsync,
 	metal_deviceCreateSwapchain,
 
 	metal_deviceDestroySemaphore,
@@ -4248,11 +5180,16 @@ static Opal_DeviceTable device_vtbl =
 	metal_deviceQuerySemaphore,
 	metal_deviceSignalSemaphore,
 	metal_deviceWaitSemaphore,
+	metal_deviceWaitSemaphores,
+	metal_deviceRegisterSemaphoreCallback,
+	metal_deviceWaitPipelineTask,
 	metal_deviceWaitQueue,
 	metal_deviceWaitIdle,
 	metal_deviceSubmit,
 	metal_deviceAcquire,
 	metal_devicePresent,
+	metal_deviceWaitPresent,
+	metal_deviceGetSwapchainFrameTiming,
 
 	metal_deviceCmdSetDescriptorHeap,
 
@@ -4290,12 +5227,21 @@ static Opal_DeviceTable device_vtbl =
 	metal_deviceCmdCopyBufferToBuffer,
 	metal_deviceCmdCopyBufferToTexture,
 	metal_deviceCmdCopyTextureToBuffer,
+	metal_deviceCmdCopyBufferToTextureRegions,
+	metal_deviceCmdCopyTextureToBufferRegions,
 	metal_deviceCmdCopyTextureToTexture,
+	metal_deviceCmdFillBuffer,
+	metal_deviceCmdUpdateBuffer,
+	metal_deviceCmdClearTexture,
+	metal_deviceCmdBlitTexture,
+	metal_deviceCmdGenerateMips,
 	metal_deviceCmdEndCopyPass,
 
 	metal_deviceCmdBeginAccelerationStructurePass,
 	metal_deviceCmdAccelerationStructureBuild,
+	metal_deviceCmdAccelerationStructureBuildBatch,
 	metal_deviceCmdAccelerationStructureCopy,
+	metal_deviceCmdAccelerationStructureWriteCompactedSizes,
 	metal_deviceCmdEndAccelerationStructurePass,
 };
 
@@ -4324,6 +5270,11 @@ Opal_Result metal_deviceInitialize(Metal_Device *device_ptr, Metal_Instance *ins
 	// bump
 	opal_bumpInitialize(&device_ptr->bump, 256);
 
+	// build batch
+	opal_buildBatchInitialize(&device_ptr->build_batch);
+	device_ptr->acceleration_structure_pass_fence = [device_ptr->device newFence];
+	device_ptr->copy_pass_fence = [device_ptr->device newFence];
+
 	// pools
 	opal_poolInitialize(&device_ptr->queues, sizeof(Metal_Queue), 32);
 	opal_poolInitialize(&device_ptr->semaphores, sizeof(Metal_Semaphore), 32);
@@ -4344,6 +5295,18 @@ Opal_Result metal_deviceInitialize(Metal_Device *device_ptr, Metal_Instance *ins
 	opal_poolInitialize(&device_ptr->compute_pipelines, sizeof(Metal_ComputePipeline), 32);
 	opal_poolInitialize(&device_ptr->swapchains, sizeof(Metal_Swapchain), 32);
 
+	// caches
+	opal_cacheInitialize(&device_ptr->shader_cache, 64);
+	opal_cacheInitialize(&device_ptr->sampler_cache, 16);
+	opal_cacheInitialize(&device_ptr->descriptor_set_layout_cache, 16);
+	opal_cacheInitialize(&device_ptr->pipeline_layout_cache, 16);
+
+	// compiler
+	opal_compilerInitialize(&device_ptr->compiler, device_ptr, 0);
+
+	// note: the listener owns a serial dispatch queue, which is where semaphore callbacks run
+	device_ptr->listener = [[MTLSharedEventListener alloc] init];
+
 	// queues
 	const Metal_DeviceEnginesInfo *engines_info = &device_ptr->device_engines_info;
 
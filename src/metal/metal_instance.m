@@ -2,7 +2,7 @@
 
 /*
  */
-static Opal_Result metal_instanceEnumerateDevices(Opal_Instance this, uint32_t *device_count, Opal_DeviceInfo *infos)
+OPAL_BACKEND_STATIC Opal_Result metal_instanceEnumerateDevices(Opal_Instance this, uint32_t *device_count, Opal_DeviceInfo *infos)
 {
 	assert(this);
 	assert(device_count);
@@ -31,7 +31,7 @@ static Opal_Result metal_instanceEnumerateDevices(Opal_Instance this, uint32_t *
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_instanceCreateSurface(Opal_Instance this, void *handle, Opal_Surface *surface)
+OPAL_BACKEND_STATIC Opal_Result metal_instanceCreateSurface(Opal_Instance this, void *handle, Opal_Surface *surface)
 {
 	assert(this);
 	assert(handle);
@@ -46,7 +46,17 @@ static Opal_Result metal_instanceCreateSurface(Opal_Instance this, void *handle,
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_instanceCreateDefaultDevice(Opal_Instance this, Opal_DeviceHint hint, Opal_Device *device)
+OPAL_BACKEND_STATIC Opal_Result metal_instanceCreateHeadlessSurface(Opal_Instance this, uint32_t width, uint32_t height, Opal_Surface *surface)
+{
+	OPAL_UNUSED(this);
+	OPAL_UNUSED(width);
+	OPAL_UNUSED(height);
+	OPAL_UNUSED(surface);
+
+	return OPAL_NOT_SUPPORTED;
+}
+
+OPAL_BACKEND_STATIC Opal_Result metal_instanceCreateDefaultDevice(Opal_Instance this, Opal_DeviceHint hint, Opal_Device *device)
 {
 	assert(this);
 	assert(device);
@@ -95,7 +105,7 @@ static Opal_Result metal_instanceCreateDefaultDevice(Opal_Instance this, Opal_De
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_instanceCreateDevice(Opal_Instance this, uint32_t index, Opal_Device *device)
+OPAL_BACKEND_STATIC Opal_Result metal_instanceCreateDevice(Opal_Instance this, uint32_t index, Opal_Device *device)
 {
 	assert(this);
 	assert(device);
@@ -129,7 +139,7 @@ static Opal_Result metal_instanceCreateDevice(Opal_Instance this, uint32_t index
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_instanceDestroySurface(Opal_Instance this, Opal_Surface surface)
+OPAL_BACKEND_STATIC Opal_Result metal_instanceDestroySurface(Opal_Instance this, Opal_Surface surface)
 {
 	assert(this);
 	assert(surface);
@@ -143,7 +153,7 @@ static Opal_Result metal_instanceDestroySurface(Opal_Instance this, Opal_Surface
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result metal_instanceDestroy(Opal_Instance this)
+OPAL_BACKEND_STATIC Opal_Result metal_instanceDestroy(Opal_Instance this)
 {
 	assert(this);
 	Metal_Instance *ptr = (Metal_Instance *)this;
@@ -161,6 +171,7 @@ static Opal_InstanceTable instance_vtbl =
 	metal_instanceEnumerateDevices,
 
 	metal_instanceCreateSurface,
+	metal_instanceCreateHeadlessSurface,
 	metal_instanceCreateDevice,
 	metal_instanceCreateDefaultDevice,
 	
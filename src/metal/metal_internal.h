@@ -4,8 +4,13 @@
 #include <QuartzCore/CAMetalLayer.h>
 #include <Metal/Metal.h>
 
+#include "common/batch.h"
 #include "common/bump.h"
+#include "common/cache.h"
+#include "common/compiler.h"
+#include "common/format.h"
 #include "common/heap.h"
+#include "common/pacing.h"
 #include "common/pool.h"
 
 #define METAL_MAX_MEMORY_TYPES 3U
@@ -82,6 +87,9 @@ typedef struct Metal_Device_t
 	Metal_DeviceEnginesInfo device_engines_info;
 	Opal_Queue *queue_handles[OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX];
 	Opal_Bump bump;
+	Opal_BuildBatch build_batch;
+	id<MTLFence> acceleration_structure_pass_fence;
+	id<MTLFence> copy_pass_fence;
 	Opal_Pool queues;
 	Opal_Pool semaphores;
 	Opal_Pool fences;
@@ -100,6 +108,12 @@ typedef struct Metal_Device_t
 	Opal_Pool graphics_pipelines;
 	Opal_Pool compute_pipelines;
 	Opal_Pool swapchains;
+	Opal_Cache shader_cache;
+	Opal_Cache sampler_cache;
+	Opal_Cache descriptor_set_layout_cache;
+	Opal_Cache pipeline_layout_cache;
+	Opal_Compiler compiler;
+	MTLSharedEventListener *listener;
 
 	Metal_Allocator allocator;
 } Metal_Device;
@@ -253,6 +267,10 @@ typedef struct Metal_Swapchain_t
 
 	Opal_TextureView current_texture_view;
 	id<CAMetalDrawable> current_drawable;
+
+	dispatch_semaphore_t frame_semaphore;
+	id<CAMetalDrawable> presented_drawables[OPAL_PACING_MAX_FRAMES];
+	Opal_Pacing pacing;
 } Metal_Swapchain;
 
 typedef struct Metal_Surface_t
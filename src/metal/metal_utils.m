@@ -760,7 +760,12 @@ Opal_Result metal_helperFillDeviceInfo(id<MTLDevice> metal_device, Opal_DeviceIn
 
 	memcpy(info->features.queue_count, &device_engines_info.queue_counts, sizeof(uint32_t) * OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX);
 
-	info->features.acceleration_structure_instance_size = sizeof(MTLIndirectAccelerationStructureInstanceDescriptor);
+	if (metal_device.supportsRaytracing)
+	{
+		info->features.acceleration_structure_instance_size = sizeof(MTLIndirectAccelerationStructureInstanceDescriptor);
+		info->features.acceleration_structure_instance_layout = OPAL_ACCELERATION_STRUCTURE_INSTANCE_LAYOUT_COLUMN_MAJOR;
+	}
+
 	// TODO: enable tessellation shader back once it's implemented in the backend
 	// info->features.tessellation_shader = is_apple3_or_greater || is_mac2 || is_common2_or_greater;
 	info->features.compute_pipeline = 1;
@@ -779,6 +784,8 @@ Opal_Result metal_helperFillDeviceInfo(id<MTLDevice> metal_device, Opal_DeviceIn
 	info->limits.max_buffer_size = 0;
 	info->limits.min_uniform_buffer_offset_alignment = 256;
 	info->limits.min_storage_buffer_offset_alignment = 256;
+	info->limits.min_texture_copy_row_alignment = 1;
+	info->limits.min_texture_copy_offset_alignment = 4;
 	info->limits.max_descriptor_sets = 0;
 	info->limits.max_uniform_buffer_binding_size = 0xFFFFFFFF;
 	info->limits.max_storage_buffer_binding_size = 0xFFFFFFFF;
@@ -796,6 +803,7 @@ Opal_Result metal_helperFillDeviceInfo(id<MTLDevice> metal_device, Opal_DeviceIn
 	info->limits.max_compute_workgroup_local_size_z = 0;
 	info->limits.max_raytrace_recursion_depth = 0;
 	info->limits.max_raytrace_hit_attribute_size = 0;
+	info->limits.min_acceleration_structure_scratch_offset_alignment = 256;
 
 	return OPAL_SUCCESS;
 }
@@ -1,4 +1,6 @@
 #include "null_internal.h"
+#include "common/intrinsics.h"
+#include "common/timer.h"
 
 #include <assert.h>
 #include <stdlib.h>
@@ -6,7 +8,104 @@
 
 /*
  */
-static Opal_Result null_deviceGetInfo(Opal_Device this, Opal_DeviceInfo *info)
+static const Opal_SurfaceFormat null_surface_formats[] =
+{
+	{OPAL_TEXTURE_FORMAT_BGRA8_UNORM, OPAL_COLOR_SPACE_SRGB},
+	{OPAL_TEXTURE_FORMAT_BGRA8_UNORM_SRGB, OPAL_COLOR_SPACE_SRGB},
+	{OPAL_TEXTURE_FORMAT_RGBA8_UNORM, OPAL_COLOR_SPACE_SRGB},
+	{OPAL_TEXTURE_FORMAT_RGBA8_UNORM_SRGB, OPAL_COLOR_SPACE_SRGB},
+	{OPAL_TEXTURE_FORMAT_RGBA16_SFLOAT, OPAL_COLOR_SPACE_SRGB},
+};
+static const uint32_t num_null_surface_formats = sizeof(null_surface_formats) / sizeof(Opal_SurfaceFormat);
+
+static const Opal_PresentMode null_present_modes[] =
+{
+	OPAL_PRESENT_MODE_IMMEDIATE,
+	OPAL_PRESENT_MODE_FIFO,
+	OPAL_PRESENT_MODE_MAILBOX,
+};
+static const uint32_t num_null_present_modes = sizeof(null_present_modes) / sizeof(Opal_PresentMode);
+
+static Opal_Result null_addObject(Null_Device *device_ptr, Null_ObjectType type, uint64_t *handle)
+{
+	assert(device_ptr);
+	assert(handle);
+
+	Null_Object result = {0};
+	result.type = type;
+
+	*handle = (uint64_t)opal_poolAddElement(&device_ptr->objects, &result);
+	return OPAL_SUCCESS;
+}
+
+static Opal_Result null_removeObject(Null_Device *device_ptr, Null_ObjectType type, uint64_t handle)
+{
+	assert(device_ptr);
+
+	Opal_PoolHandle pool_handle = (Opal_PoolHandle)handle;
+	assert(pool_handle != OPAL_POOL_HANDLE_NULL);
+
+	Null_Object *object_ptr = (Null_Object *)opal_poolGetElement(&device_ptr->objects, pool_handle);
+	if (object_ptr == NULL || object_ptr->type != type)
+		return OPAL_INTERNAL_ERROR;
+
+	return opal_poolRemoveElement(&device_ptr->objects, pool_handle);
+}
+
+static Opal_Result null_compileGraphicsPipeline(void *device, const void *desc, Opal_Bump *scratch, void *pipeline)
+{
+	assert(device);
+	assert(desc);
+	assert(scratch);
+	assert(pipeline);
+
+	OPAL_UNUSED(device);
+	OPAL_UNUSED(desc);
+	OPAL_UNUSED(scratch);
+
+	Null_Object *pipeline_ptr = (Null_Object *)pipeline;
+	pipeline_ptr->type = NULL_OBJECT_TYPE_GRAPHICS_PIPELINE;
+
+	return OPAL_SUCCESS;
+}
+
+static Opal_Result null_compileComputePipeline(void *device, const void *desc, Opal_Bump *scratch, void *pipeline)
+{
+	assert(device);
+	assert(desc);
+	assert(scratch);
+	assert(pipeline);
+
+	OPAL_UNUSED(device);
+	OPAL_UNUSED(desc);
+	OPAL_UNUSED(scratch);
+
+	Null_Object *pipeline_ptr = (Null_Object *)pipeline;
+	pipeline_ptr->type = NULL_OBJECT_TYPE_COMPUTE_PIPELINE;
+
+	return OPAL_SUCCESS;
+}
+
+static Opal_Result null_compileRaytracePipeline(void *device, const void *desc, Opal_Bump *scratch, void *pipeline)
+{
+	assert(device);
+	assert(desc);
+	assert(scratch);
+	assert(pipeline);
+
+	OPAL_UNUSED(device);
+	OPAL_UNUSED(desc);
+	OPAL_UNUSED(scratch);
+
+	Null_Object *pipeline_ptr = (Null_Object *)pipeline;
+	pipeline_ptr->type = NULL_OBJECT_TYPE_RAYTRACE_PIPELINE;
+
+	return OPAL_SUCCESS;
+}
+
+/*
+ */
+OPAL_BACKEND_STATIC Opal_Result null_deviceGetInfo(Opal_Device this, Opal_DeviceInfo *info)
 {
 	assert(this);
 	assert(info);
@@ -17,17 +116,26 @@ static Opal_Result null_deviceGetInfo(Opal_Device this, Opal_DeviceInfo *info)
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceGetQueue(Opal_Device this, Opal_DeviceEngineType engine_type, uint32_t index, Opal_Queue *queue)
+OPAL_BACKEND_STATIC Opal_Result null_deviceGetQueue(Opal_Device this, Opal_DeviceEngineType engine_type, uint32_t index, Opal_Queue *queue)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(engine_type);
-	OPAL_UNUSED(index);
-	OPAL_UNUSED(queue);
+	assert(this);
+	assert(queue);
+	assert(engine_type < OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *ptr = (Null_Device *)this;
+	uint32_t queue_count = ptr->info.features.queue_count[engine_type];
+
+	if (index >= queue_count)
+		return OPAL_INVALID_QUEUE_INDEX;
+
+	Opal_Queue *queue_handles = ptr->queue_handles[engine_type];
+	assert(queue_handles);
+
+	*queue = queue_handles[index];
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceGetAccelerationStructurePrebuildInfo(Opal_Device this, const Opal_AccelerationStructureBuildDesc *desc, Opal_AccelerationStructurePrebuildInfo *info)
+OPAL_BACKEND_STATIC Opal_Result null_deviceGetAccelerationStructurePrebuildInfo(Opal_Device this, const Opal_AccelerationStructureBuildDesc *desc, Opal_AccelerationStructurePrebuildInfo *info)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(desc);
@@ -36,573 +144,1168 @@ static Opal_Result null_deviceGetAccelerationStructurePrebuildInfo(Opal_Device t
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result null_deviceGetSupportedSurfaceFormats(Opal_Device this, Opal_Surface surface, uint32_t *num_formats, Opal_SurfaceFormat *formats)
+OPAL_BACKEND_STATIC Opal_Result null_deviceGetAccelerationStructureAddress(Opal_Device this, Opal_AccelerationStructure acceleration_structure, uint64_t *address)
 {
 	OPAL_UNUSED(this);
-	OPAL_UNUSED(surface);
-	OPAL_UNUSED(num_formats);
-	OPAL_UNUSED(formats);
+	OPAL_UNUSED(acceleration_structure);
+	OPAL_UNUSED(address);
 
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result null_deviceGetSupportedPresentModes(Opal_Device this, Opal_Surface surface, uint32_t *num_present_modes, Opal_PresentMode *present_modes)
+OPAL_BACKEND_STATIC Opal_Result null_deviceGetSupportedSurfaceFormats(Opal_Device this, Opal_Surface surface, uint32_t *num_formats, Opal_SurfaceFormat *formats)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(surface);
-	OPAL_UNUSED(num_present_modes);
-	OPAL_UNUSED(present_modes);
+	assert(this);
+	assert(surface);
+	assert(num_formats);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+
+	Null_Surface *surface_ptr = (Null_Surface *)opal_poolGetElement(&device_ptr->instance->surfaces, (Opal_PoolHandle)surface);
+	assert(surface_ptr);
+
+	OPAL_UNUSED(surface_ptr);
+
+	if (formats)
+		memcpy(formats, null_surface_formats, sizeof(null_surface_formats));
+
+	*num_formats = num_null_surface_formats;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceGetPreferredSurfaceFormat(Opal_Device this, Opal_Surface surface, Opal_SurfaceFormat *format)
+OPAL_BACKEND_STATIC Opal_Result null_deviceGetSupportedPresentModes(Opal_Device this, Opal_Surface surface, uint32_t *num_present_modes, Opal_PresentMode *present_modes)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(surface);
-	OPAL_UNUSED(format);
+	assert(this);
+	assert(surface);
+	assert(num_present_modes);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+
+	Null_Surface *surface_ptr = (Null_Surface *)opal_poolGetElement(&device_ptr->instance->surfaces, (Opal_PoolHandle)surface);
+	assert(surface_ptr);
+
+	OPAL_UNUSED(surface_ptr);
+
+	if (present_modes)
+		memcpy(present_modes, null_present_modes, sizeof(null_present_modes));
+
+	*num_present_modes = num_null_present_modes;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceGetPreferredSurfacePresentMode(Opal_Device this, Opal_Surface surface, Opal_PresentMode *present_mode)
+OPAL_BACKEND_STATIC Opal_Result null_deviceGetPreferredSurfaceFormat(Opal_Device this, Opal_Surface surface, Opal_SurfaceFormat *format)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(surface);
-	OPAL_UNUSED(present_mode);
+	assert(this);
+	assert(surface);
+	assert(format);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+
+	Null_Surface *surface_ptr = (Null_Surface *)opal_poolGetElement(&device_ptr->instance->surfaces, (Opal_PoolHandle)surface);
+	assert(surface_ptr);
+
+	OPAL_UNUSED(surface_ptr);
+
+	*format = null_surface_formats[0];
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCreateSemaphore(Opal_Device this, const Opal_SemaphoreDesc *desc, Opal_Semaphore *semaphore)
+OPAL_BACKEND_STATIC Opal_Result null_deviceGetPreferredSurfacePresentMode(Opal_Device this, Opal_Surface surface, Opal_PresentMode *present_mode)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(desc);
-	OPAL_UNUSED(semaphore);
+	assert(this);
+	assert(surface);
+	assert(present_mode);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+
+	Null_Surface *surface_ptr = (Null_Surface *)opal_poolGetElement(&device_ptr->instance->surfaces, (Opal_PoolHandle)surface);
+	assert(surface_ptr);
+
+	OPAL_UNUSED(surface_ptr);
+
+	*present_mode = OPAL_PRESENT_MODE_FIFO;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCreateFence(Opal_Device this, Opal_Fence *fence)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCreateSemaphore(Opal_Device this, const Opal_SemaphoreDesc *desc, Opal_Semaphore *semaphore)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(fence);
+	assert(this);
+	assert(desc);
+	assert(semaphore);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+
+	Null_Semaphore result = {0};
+	result.value = desc->initial_value;
+
+	*semaphore = (Opal_Semaphore)opal_poolAddElement(&device_ptr->semaphores, &result);
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCreateBuffer(Opal_Device this, const Opal_BufferDesc *desc, Opal_Buffer *buffer)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCreateFence(Opal_Device this, Opal_Fence *fence)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(desc);
-	OPAL_UNUSED(buffer);
+	assert(this);
+	assert(fence);
 
-	return OPAL_NOT_SUPPORTED;
+	return null_addObject((Null_Device *)this, NULL_OBJECT_TYPE_FENCE, fence);
 }
 
-static Opal_Result null_deviceCreateTexture(Opal_Device this, const Opal_TextureDesc *desc, Opal_Texture *texture)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCreateBuffer(Opal_Device this, const Opal_BufferDesc *desc, Opal_Buffer *buffer)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(desc);
-	OPAL_UNUSED(texture);
+	assert(this);
+	assert(desc);
+	assert(buffer);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+
+	if (desc->size > device_ptr->info.limits.max_buffer_size)
+		return OPAL_NO_MEMORY;
+
+	Null_Buffer result = {0};
+	result.size = desc->size;
+
+	if (desc->memory_type != OPAL_ALLOCATION_MEMORY_TYPE_DEVICE_LOCAL)
+	{
+		result.data = (uint8_t *)malloc(desc->size);
+		if (result.data == NULL)
+			return OPAL_NO_MEMORY;
+
+		memset(result.data, 0, desc->size);
+	}
+
+	*buffer = (Opal_Buffer)opal_poolAddElement(&device_ptr->buffers, &result);
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCreateTextureView(Opal_Device this, const Opal_TextureViewDesc *desc, Opal_TextureView *texture_view)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCreateTexture(Opal_Device this, const Opal_TextureDesc *desc, Opal_Texture *texture)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(desc);
-	OPAL_UNUSED(texture_view);
+	assert(this);
+	assert(desc);
+	assert(texture);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+
+	Null_Texture result = {0};
+	result.type = desc->type;
+	result.format = desc->format;
+	result.width = desc->width;
+	result.height = desc->height;
+	result.depth = desc->depth;
+	result.mip_count = desc->mip_count;
+	result.layer_count = desc->layer_count;
+
+	*texture = (Opal_Texture)opal_poolAddElement(&device_ptr->textures, &result);
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCreateSampler(Opal_Device this, const Opal_SamplerDesc *desc, Opal_Sampler *sampler)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCreateTextureView(Opal_Device this, const Opal_TextureViewDesc *desc, Opal_TextureView *texture_view)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(desc);
-	OPAL_UNUSED(sampler);
+	assert(this);
+	assert(desc);
+	assert(texture_view);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+
+	Null_Texture *texture_ptr = (Null_Texture *)opal_poolGetElement(&device_ptr->textures, (Opal_PoolHandle)desc->texture);
+	assert(texture_ptr);
+
+	if (desc->base_mip + desc->mip_count > texture_ptr->mip_count)
+		return OPAL_INTERNAL_ERROR;
+
+	if (desc->base_layer + desc->layer_count > texture_ptr->layer_count)
+		return OPAL_INTERNAL_ERROR;
+
+	Null_TextureView result = {0};
+	result.texture = desc->texture;
+	result.base_mip = desc->base_mip;
+	result.mip_count = desc->mip_count;
+	result.base_layer = desc->base_layer;
+	result.layer_count = desc->layer_count;
+
+	*texture_view = (Opal_TextureView)opal_poolAddElement(&device_ptr->texture_views, &result);
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCreateAccelerationStructure(Opal_Device this, const Opal_AccelerationStructureDesc *desc, Opal_AccelerationStructure *acceleration_structure)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCreateSampler(Opal_Device this, const Opal_SamplerDesc *desc, Opal_Sampler *sampler)
 {
-	OPAL_UNUSED(this);
+	assert(this);
+	assert(desc);
+	assert(sampler);
+
+	Null_Device *device_ptr = (Null_Device *)this;
+
+	Opal_Sampler cached_sampler = (Opal_Sampler)opal_cacheAcquire(&device_ptr->sampler_cache, desc, sizeof(Opal_SamplerDesc));
+	if (cached_sampler != OPAL_NULL_HANDLE)
+	{
+		*sampler = cached_sampler;
+		return OPAL_SUCCESS;
+	}
+
+	Opal_Result result = null_addObject(device_ptr, NULL_OBJECT_TYPE_SAMPLER, sampler);
+	if (result == OPAL_SUCCESS)
+		opal_cacheInsert(&device_ptr->sampler_cache, desc, sizeof(Opal_SamplerDesc), *sampler);
+
+	return result;
+}
+
+OPAL_BACKEND_STATIC Opal_Result null_deviceCreateAccelerationStructure(Opal_Device this, const Opal_AccelerationStructureDesc *desc, Opal_AccelerationStructure *acceleration_structure)
+{
+	assert(this);
+	assert(desc);
+	assert(acceleration_structure);
+
 	OPAL_UNUSED(desc);
-	OPAL_UNUSED(acceleration_structure);
 
-	return OPAL_NOT_SUPPORTED;
+	return null_addObject((Null_Device *)this, NULL_OBJECT_TYPE_ACCELERATION_STRUCTURE, acceleration_structure);
 }
 
-static Opal_Result null_deviceCreateShaderBindingTable(Opal_Device this, Opal_RaytracePipeline pipeline, Opal_ShaderBindingTable *shader_binding_table)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCreateShaderBindingTable(Opal_Device this, Opal_RaytracePipeline pipeline, Opal_ShaderBindingTable *shader_binding_table)
 {
-	OPAL_UNUSED(this);
+	assert(this);
+	assert(pipeline);
+	assert(shader_binding_table);
+
 	OPAL_UNUSED(pipeline);
-	OPAL_UNUSED(shader_binding_table);
 
-	return OPAL_NOT_SUPPORTED;
+	return null_addObject((Null_Device *)this, NULL_OBJECT_TYPE_SHADER_BINDING_TABLE, shader_binding_table);
 }
 
-static Opal_Result null_deviceCreateCommandAllocator(Opal_Device this, Opal_Queue queue, Opal_CommandAllocator *command_allocator)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCreateCommandAllocator(Opal_Device this, Opal_Queue queue, Opal_CommandAllocator *command_allocator)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(queue);
-	OPAL_UNUSED(command_allocator);
+	assert(this);
+	assert(queue);
+	assert(command_allocator);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+
+	Null_Queue *queue_ptr = (Null_Queue *)opal_poolGetElement(&device_ptr->queues, (Opal_PoolHandle)queue);
+	assert(queue_ptr);
+
+	Opal_Result result = null_addObject(device_ptr, NULL_OBJECT_TYPE_COMMAND_ALLOCATOR, command_allocator);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	Null_Object *command_allocator_ptr = (Null_Object *)opal_poolGetElement(&device_ptr->objects, (Opal_PoolHandle)*command_allocator);
+	command_allocator_ptr->engine_type = queue_ptr->engine_type;
+
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCreateCommandBuffer(Opal_Device this, Opal_CommandAllocator command_allocator, Opal_CommandBuffer *command_buffer)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCreateCommandBuffer(Opal_Device this, Opal_CommandAllocator command_allocator, Opal_CommandBuffer *command_buffer)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(command_allocator);
-	OPAL_UNUSED(command_buffer);
+	assert(this);
+	assert(command_allocator);
+	assert(command_buffer);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+
+	Null_Object *command_allocator_ptr = (Null_Object *)opal_poolGetElement(&device_ptr->objects, (Opal_PoolHandle)command_allocator);
+	assert(command_allocator_ptr);
+	assert(command_allocator_ptr->type == NULL_OBJECT_TYPE_COMMAND_ALLOCATOR);
+
+	Opal_DeviceEngineType engine_type = command_allocator_ptr->engine_type;
+
+	Opal_Result result = null_addObject(device_ptr, NULL_OBJECT_TYPE_COMMAND_BUFFER, command_buffer);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	Null_Object *command_buffer_ptr = (Null_Object *)opal_poolGetElement(&device_ptr->objects, (Opal_PoolHandle)*command_buffer);
+	command_buffer_ptr->engine_type = engine_type;
+
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCreateShader(Opal_Device this, const Opal_ShaderDesc *desc, Opal_Shader *shader)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCreateShader(Opal_Device this, const Opal_ShaderDesc *desc, Opal_Shader *shader)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(desc);
-	OPAL_UNUSED(shader);
+	assert(this);
+	assert(desc);
+	assert(shader);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+
+	Opal_CacheDigest digest = {0};
+	opal_cacheDigest(&digest, (uint32_t)desc->type, desc->data, desc->size);
+
+	Opal_Shader cached_shader = (Opal_Shader)opal_cacheAcquire(&device_ptr->shader_cache, &digest, sizeof(Opal_CacheDigest));
+	if (cached_shader != OPAL_NULL_HANDLE)
+	{
+		*shader = cached_shader;
+		return OPAL_SUCCESS;
+	}
+
+	Opal_Result result = null_addObject(device_ptr, NULL_OBJECT_TYPE_SHADER, shader);
+	if (result == OPAL_SUCCESS)
+		opal_cacheInsert(&device_ptr->shader_cache, &digest, sizeof(Opal_CacheDigest), *shader);
+
+	return result;
 }
 
-static Opal_Result null_deviceCreateDescriptorHeap(Opal_Device this, const Opal_DescriptorHeapDesc *desc, Opal_DescriptorHeap *descriptor_heap)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCreateDescriptorHeap(Opal_Device this, const Opal_DescriptorHeapDesc *desc, Opal_DescriptorHeap *descriptor_heap)
 {
-	OPAL_UNUSED(this);
+	assert(this);
+	assert(desc);
+	assert(descriptor_heap);
+
 	OPAL_UNUSED(desc);
-	OPAL_UNUSED(descriptor_heap);
 
-	return OPAL_NOT_SUPPORTED;
+	return null_addObject((Null_Device *)this, NULL_OBJECT_TYPE_DESCRIPTOR_HEAP, descriptor_heap);
 }
 
-static Opal_Result null_deviceCreateDescriptorSetLayout(Opal_Device this, uint32_t num_entries, const Opal_DescriptorSetLayoutEntry *entries, Opal_DescriptorSetLayout *descriptor_set_layout)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCreateDescriptorSetLayout(Opal_Device this, uint32_t num_entries, const Opal_DescriptorSetLayoutEntry *entries, Opal_DescriptorSetLayout *descriptor_set_layout)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(num_entries);
-	OPAL_UNUSED(entries);
-	OPAL_UNUSED(descriptor_set_layout);
+	assert(this);
+	assert(num_entries == 0 || entries);
+	assert(descriptor_set_layout);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+	uint32_t entries_size = sizeof(Opal_DescriptorSetLayoutEntry) * num_entries;
+
+	Opal_DescriptorSetLayout cached_layout = (Opal_DescriptorSetLayout)opal_cacheAcquire(&device_ptr->descriptor_set_layout_cache, entries, entries_size);
+	if (cached_layout != OPAL_NULL_HANDLE)
+	{
+		*descriptor_set_layout = cached_layout;
+		return OPAL_SUCCESS;
+	}
+
+	Opal_Result result = null_addObject(device_ptr, NULL_OBJECT_TYPE_DESCRIPTOR_SET_LAYOUT, descriptor_set_layout);
+	if (result == OPAL_SUCCESS)
+		opal_cacheInsert(&device_ptr->descriptor_set_layout_cache, entries, entries_size, *descriptor_set_layout);
+
+	return result;
 }
 
-static Opal_Result null_deviceCreatePipelineLayout(Opal_Device this, uint32_t num_descriptor_set_layouts, const Opal_DescriptorSetLayout *descriptor_set_layouts, Opal_PipelineLayout *pipeline_layout)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCreatePipelineLayout(Opal_Device this, uint32_t num_descriptor_set_layouts, const Opal_DescriptorSetLayout *descriptor_set_layouts, Opal_PipelineLayout *pipeline_layout)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(num_descriptor_set_layouts);
-	OPAL_UNUSED(descriptor_set_layouts);
-	OPAL_UNUSED(pipeline_layout);
+	assert(this);
+	assert(num_descriptor_set_layouts == 0 || descriptor_set_layouts);
+	assert(pipeline_layout);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+	uint32_t layouts_size = sizeof(Opal_DescriptorSetLayout) * num_descriptor_set_layouts;
+
+	Opal_PipelineLayout cached_layout = (Opal_PipelineLayout)opal_cacheAcquire(&device_ptr->pipeline_layout_cache, descriptor_set_layouts, layouts_size);
+	if (cached_layout != OPAL_NULL_HANDLE)
+	{
+		*pipeline_layout = cached_layout;
+		return OPAL_SUCCESS;
+	}
+
+	Opal_Result result = null_addObject(device_ptr, NULL_OBJECT_TYPE_PIPELINE_LAYOUT, pipeline_layout);
+	if (result == OPAL_SUCCESS)
+		opal_cacheInsert(&device_ptr->pipeline_layout_cache, descriptor_set_layouts, layouts_size, *pipeline_layout);
+
+	return result;
 }
 
-static Opal_Result null_deviceCreateGraphicsPipeline(Opal_Device this, const Opal_GraphicsPipelineDesc *desc, Opal_GraphicsPipeline *pipeline)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCreateGraphicsPipeline(Opal_Device this, const Opal_GraphicsPipelineDesc *desc, Opal_GraphicsPipeline *pipeline)
 {
-	OPAL_UNUSED(this);
+	assert(this);
+	assert(desc);
+	assert(pipeline);
+
 	OPAL_UNUSED(desc);
-	OPAL_UNUSED(pipeline);
 
-	return OPAL_NOT_SUPPORTED;
+	return null_addObject((Null_Device *)this, NULL_OBJECT_TYPE_GRAPHICS_PIPELINE, pipeline);
 }
 
-static Opal_Result null_deviceCreateMeshletPipeline(Opal_Device this, const Opal_MeshletPipelineDesc *desc, Opal_GraphicsPipeline *pipeline)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCreateMeshletPipeline(Opal_Device this, const Opal_MeshletPipelineDesc *desc, Opal_GraphicsPipeline *pipeline)
 {
-	OPAL_UNUSED(this);
+	assert(this);
+	assert(desc);
+	assert(pipeline);
+
 	OPAL_UNUSED(desc);
-	OPAL_UNUSED(pipeline);
 
-	return OPAL_NOT_SUPPORTED;
+	return null_addObject((Null_Device *)this, NULL_OBJECT_TYPE_GRAPHICS_PIPELINE, pipeline);
 }
 
-static Opal_Result null_deviceCreateComputePipeline(Opal_Device this, const Opal_ComputePipelineDesc *desc, Opal_ComputePipeline *pipeline)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCreateComputePipeline(Opal_Device this, const Opal_ComputePipelineDesc *desc, Opal_ComputePipeline *pipeline)
 {
-	OPAL_UNUSED(this);
+	assert(this);
+	assert(desc);
+	assert(pipeline);
+
 	OPAL_UNUSED(desc);
-	OPAL_UNUSED(pipeline);
 
-	return OPAL_NOT_SUPPORTED;
+	return null_addObject((Null_Device *)this, NULL_OBJECT_TYPE_COMPUTE_PIPELINE, pipeline);
 }
 
-static Opal_Result null_deviceCreateRaytracePipeline(Opal_Device this, const Opal_RaytracePipelineDesc *desc, Opal_RaytracePipeline *pipeline)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCreateRaytracePipeline(Opal_Device this, const Opal_RaytracePipelineDesc *desc, Opal_RaytracePipeline *pipeline)
 {
-	OPAL_UNUSED(this);
+	assert(this);
+	assert(desc);
+	assert(pipeline);
+
 	OPAL_UNUSED(desc);
-	OPAL_UNUSED(pipeline);
 
-	return OPAL_NOT_SUPPORTED;
+	return null_addObject((Null_Device *)this, NULL_OBJECT_TYPE_RAYTRACE_PIPELINE, pipeline);
 }
 
-static Opal_Result null_deviceCreateSwapchain(Opal_Device this, const Opal_SwapchainDesc *desc, Opal_Swapchain *swapchain)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCreateGraphicsPipelines(Opal_Device this, uint32_t num_pipelines, const Opal_GraphicsPipelineDesc *descs, Opal_GraphicsPipeline *pipelines)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(desc);
-	OPAL_UNUSED(swapchain);
+	assert(this);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+	return opal_compilerRun(&device_ptr->compiler, null_compileGraphicsPipeline, &device_ptr->objects, num_pipelines, descs, sizeof(Opal_GraphicsPipelineDesc), pipelines);
 }
 
-static Opal_Result null_deviceDestroySemaphore(Opal_Device this, Opal_Semaphore semaphore)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCreateComputePipelines(Opal_Device this, uint32_t num_pipelines, const Opal_ComputePipelineDesc *descs, Opal_ComputePipeline *pipelines)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(semaphore);
+	assert(this);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+	return opal_compilerRun(&device_ptr->compiler, null_compileComputePipeline, &device_ptr->objects, num_pipelines, descs, sizeof(Opal_ComputePipelineDesc), pipelines);
 }
 
-static Opal_Result null_deviceDestroyFence(Opal_Device this, Opal_Fence fence)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCreateRaytracePipelines(Opal_Device this, uint32_t num_pipelines, const Opal_RaytracePipelineDesc *descs, Opal_RaytracePipeline *pipelines)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(fence);
+	assert(this);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+	return opal_compilerRun(&device_ptr->compiler, null_compileRaytracePipeline, &device_ptr->objects, num_pipelines, descs, sizeof(Opal_RaytracePipelineDesc), pipelines);
 }
 
-static Opal_Result null_deviceDestroyBuffer(Opal_Device this, Opal_Buffer buffer)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCreateGraphicsPipelinesAsync(Opal_Device this, uint32_t num_pipelines, const Opal_GraphicsPipelineDesc *descs, Opal_GraphicsPipeline *pipelines, Opal_PipelineTask *task)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(buffer);
+	assert(this);
+	assert(task);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+	return opal_compilerSubmit(&device_ptr->compiler, null_compileGraphicsPipeline, &device_ptr->objects, num_pipelines, descs, sizeof(Opal_GraphicsPipelineDesc), pipelines, task);
 }
 
-static Opal_Result null_deviceDestroyTexture(Opal_Device this, Opal_Texture texture)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCreateComputePipelinesAsync(Opal_Device this, uint32_t num_pipelines, const Opal_ComputePipelineDesc *descs, Opal_ComputePipeline *pipelines, Opal_PipelineTask *task)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(texture);
+	assert(this);
+	assert(task);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+	return opal_compilerSubmit(&device_ptr->compiler, null_compileComputePipeline, &device_ptr->objects, num_pipelines, descs, sizeof(Opal_ComputePipelineDesc), pipelines, task);
 }
 
-static Opal_Result null_deviceDestroyTextureView(Opal_Device this, Opal_TextureView texture_view)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCreateRaytracePipelinesAsync(Opal_Device this, uint32_t num_pipelines, const Opal_RaytracePipelineDesc *descs, Opal_RaytracePipeline *pipelines, Opal_PipelineTask *task)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(texture_view);
+	assert(this);
+	assert(task);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+	return opal_compilerSubmit(&device_ptr->compiler, null_compileRaytracePipeline, &device_ptr->objects, num_pipelines, descs, sizeof(Opal_RaytracePipelineDesc), pipelines, task);
 }
 
-static Opal_Result null_deviceDestroySampler(Opal_Device this, Opal_Sampler sampler)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCreateSwapchain(Opal_Device this, const Opal_SwapchainDesc *desc, Opal_Swapchain *swapchain)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(sampler);
+	assert(this);
+	assert(desc);
+	assert(swapchain);
+
+	Null_Device *device_ptr = (Null_Device *)this;
+
+	Null_Surface *surface_ptr = (Null_Surface *)opal_poolGetElement(&device_ptr->instance->surfaces, (Opal_PoolHandle)desc->surface);
+	assert(surface_ptr);
+
+	// format & mode
+	uint32_t format_index = 0;
+	for (; format_index < num_null_surface_formats; ++format_index)
+	{
+		const Opal_SurfaceFormat *format = &null_surface_formats[format_index];
+		if (format->texture_format == desc->format.texture_format && format->color_space == desc->format.color_space)
+			break;
+	}
+
+	if (format_index == num_null_surface_formats)
+		return OPAL_SWAPCHAIN_FORMAT_NOT_SUPPORTED;
+
+	if (desc->mode >= OPAL_PRESENT_MODE_ENUM_MAX)
+		return OPAL_SWAPCHAIN_PRESENT_MODE_NOT_SUPPORTED;
+
+	// images
+	// note: there is no display to scan images out, so the ring only needs to cover frames in flight
+	uint32_t num_images = (desc->mode == OPAL_PRESENT_MODE_MAILBOX) ? 3 : 2;
+	if (desc->max_frames_in_flight > 0)
+		num_images = max(num_images, desc->max_frames_in_flight + 1);
+
+	Null_Swapchain result = {0};
+	result.textures = (Opal_Texture *)malloc(sizeof(Opal_Texture) * num_images);
+	result.texture_views = (Opal_TextureView *)malloc(sizeof(Opal_TextureView) * num_images);
+	result.num_images = num_images;
+	result.current_image = num_images - 1;
+
+	Opal_TextureDesc texture_desc = {0};
+	texture_desc.type = OPAL_TEXTURE_TYPE_2D;
+	texture_desc.format = desc->format.texture_format;
+	texture_desc.width = surface_ptr->width;
+	texture_desc.height = surface_ptr->height;
+	texture_desc.depth = 1;
+	texture_desc.mip_count = 1;
+	texture_desc.layer_count = 1;
+	texture_desc.samples = OPAL_SAMPLES_1;
+	texture_desc.usage = desc->usage;
+
+	Opal_TextureViewDesc texture_view_desc = {0};
+	texture_view_desc.type = OPAL_TEXTURE_VIEW_TYPE_2D;
+	texture_view_desc.mip_count = 1;
+	texture_view_desc.layer_count = 1;
+
+	for (uint32_t i = 0; i < num_images; ++i)
+	{
+		null_deviceCreateTexture(this, &texture_desc, &result.textures[i]);
+
+		texture_view_desc.texture = result.textures[i];
+		null_deviceCreateTextureView(this, &texture_view_desc, &result.texture_views[i]);
+	}
+
+	opal_pacingInitialize(&result.pacing, desc->max_frames_in_flight);
+
+	*swapchain = (Opal_Swapchain)opal_poolAddElement(&device_ptr->swapchains, &result);
+	return OPAL_SUCCESS;
+}
 
-	return OPAL_NOT_SUPPORTED;
+OPAL_BACKEND_STATIC Opal_Result null_deviceDestroySemaphore(Opal_Device this, Opal_Semaphore semaphore)
+{
+	assert(this);
+	assert(semaphore);
+
+	Null_Device *device_ptr = (Null_Device *)this;
+	opal_notifierCancel(&device_ptr->notifier, (uint64_t)semaphore);
+
+	return opal_poolRemoveElement(&device_ptr->semaphores, (Opal_PoolHandle)semaphore);
 }
 
-static Opal_Result null_deviceDestroyAccelerationStructure(Opal_Device this, Opal_AccelerationStructure acceleration_structure)
+OPAL_BACKEND_STATIC Opal_Result null_deviceDestroyFence(Opal_Device this, Opal_Fence fence)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(acceleration_structure);
+	assert(this);
+	assert(fence);
 
-	return OPAL_NOT_SUPPORTED;
+	return null_removeObject((Null_Device *)this, NULL_OBJECT_TYPE_FENCE, fence);
 }
 
-static Opal_Result null_deviceDestroyShaderBindingTable(Opal_Device this, Opal_ShaderBindingTable shader_binding_table)
+OPAL_BACKEND_STATIC Opal_Result null_deviceDestroyBuffer(Opal_Device this, Opal_Buffer buffer)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(shader_binding_table);
+	assert(this);
+	assert(buffer);
 
-	return OPAL_NOT_SUPPORTED;
+	Opal_PoolHandle handle = (Opal_PoolHandle)buffer;
+	assert(handle != OPAL_POOL_HANDLE_NULL);
+
+	Null_Device *device_ptr = (Null_Device *)this;
+	Null_Buffer *buffer_ptr = (Null_Buffer *)opal_poolGetElement(&device_ptr->buffers, handle);
+	assert(buffer_ptr);
+
+	free(buffer_ptr->data);
+
+	return opal_poolRemoveElement(&device_ptr->buffers, handle);
 }
 
-static Opal_Result null_deviceDestroyCommandAllocator(Opal_Device this, Opal_CommandAllocator command_allocator)
+OPAL_BACKEND_STATIC Opal_Result null_deviceDestroyTexture(Opal_Device this, Opal_Texture texture)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(command_allocator);
+	assert(this);
+	assert(texture);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+	return opal_poolRemoveElement(&device_ptr->textures, (Opal_PoolHandle)texture);
 }
 
-static Opal_Result null_deviceDestroyCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
+OPAL_BACKEND_STATIC Opal_Result null_deviceDestroyTextureView(Opal_Device this, Opal_TextureView texture_view)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(command_buffer);
+	assert(this);
+	assert(texture_view);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+	return opal_poolRemoveElement(&device_ptr->texture_views, (Opal_PoolHandle)texture_view);
 }
 
-static Opal_Result null_deviceDestroyShader(Opal_Device this, Opal_Shader shader)
+OPAL_BACKEND_STATIC Opal_Result null_deviceDestroySampler(Opal_Device this, Opal_Sampler sampler)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(shader);
+	assert(this);
+	assert(sampler);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+	if (opal_cacheRelease(&device_ptr->sampler_cache, sampler) > 0)
+		return OPAL_SUCCESS;
+
+	return null_removeObject(device_ptr, NULL_OBJECT_TYPE_SAMPLER, sampler);
 }
 
-static Opal_Result null_deviceDestroyDescriptorHeap(Opal_Device this, Opal_DescriptorHeap descriptor_heap)
+OPAL_BACKEND_STATIC Opal_Result null_deviceDestroyAccelerationStructure(Opal_Device this, Opal_AccelerationStructure acceleration_structure)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(descriptor_heap);
+	assert(this);
+	assert(acceleration_structure);
 
-	return OPAL_NOT_SUPPORTED;
+	return null_removeObject((Null_Device *)this, NULL_OBJECT_TYPE_ACCELERATION_STRUCTURE, acceleration_structure);
 }
 
-static Opal_Result null_deviceDestroyDescriptorSetLayout(Opal_Device this, Opal_DescriptorSetLayout descriptor_set_layout)
+OPAL_BACKEND_STATIC Opal_Result null_deviceDestroyShaderBindingTable(Opal_Device this, Opal_ShaderBindingTable shader_binding_table)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(descriptor_set_layout);
+	assert(this);
+	assert(shader_binding_table);
 
-	return OPAL_NOT_SUPPORTED;
+	return null_removeObject((Null_Device *)this, NULL_OBJECT_TYPE_SHADER_BINDING_TABLE, shader_binding_table);
 }
 
-static Opal_Result null_deviceDestroyPipelineLayout(Opal_Device this, Opal_PipelineLayout pipeline_layout)
+OPAL_BACKEND_STATIC Opal_Result null_deviceDestroyCommandAllocator(Opal_Device this, Opal_CommandAllocator command_allocator)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(pipeline_layout);
+	assert(this);
+	assert(command_allocator);
 
-	return OPAL_NOT_SUPPORTED;
+	return null_removeObject((Null_Device *)this, NULL_OBJECT_TYPE_COMMAND_ALLOCATOR, command_allocator);
 }
 
-static Opal_Result null_deviceDestroyGraphicsPipeline(Opal_Device this, Opal_GraphicsPipeline pipeline)
+OPAL_BACKEND_STATIC Opal_Result null_deviceDestroyCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(pipeline);
+	assert(this);
+	assert(command_buffer);
 
-	return OPAL_NOT_SUPPORTED;
+	return null_removeObject((Null_Device *)this, NULL_OBJECT_TYPE_COMMAND_BUFFER, command_buffer);
 }
 
-static Opal_Result null_deviceDestroyComputePipeline(Opal_Device this, Opal_ComputePipeline pipeline)
+OPAL_BACKEND_STATIC Opal_Result null_deviceDestroyShader(Opal_Device this, Opal_Shader shader)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(pipeline);
+	assert(this);
+	assert(shader);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+	if (opal_cacheRelease(&device_ptr->shader_cache, shader) > 0)
+		return OPAL_SUCCESS;
+
+	return null_removeObject(device_ptr, NULL_OBJECT_TYPE_SHADER, shader);
 }
 
-static Opal_Result null_deviceDestroyRaytracePipeline(Opal_Device this, Opal_RaytracePipeline pipeline)
+OPAL_BACKEND_STATIC Opal_Result null_deviceDestroyDescriptorHeap(Opal_Device this, Opal_DescriptorHeap descriptor_heap)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(pipeline);
+	assert(this);
+	assert(descriptor_heap);
 
-	return OPAL_NOT_SUPPORTED;
+	return null_removeObject((Null_Device *)this, NULL_OBJECT_TYPE_DESCRIPTOR_HEAP, descriptor_heap);
 }
 
-static Opal_Result null_deviceDestroySwapchain(Opal_Device this, Opal_Swapchain swapchain)
+OPAL_BACKEND_STATIC Opal_Result null_deviceDestroyDescriptorSetLayout(Opal_Device this, Opal_DescriptorSetLayout descriptor_set_layout)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(swapchain);
+	assert(this);
+	assert(descriptor_set_layout);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+	if (opal_cacheRelease(&device_ptr->descriptor_set_layout_cache, descriptor_set_layout) > 0)
+		return OPAL_SUCCESS;
+
+	// note: the handle can be reused for another layout from now on
+	opal_cacheEvict(&device_ptr->pipeline_layout_cache, descriptor_set_layout);
+
+	return null_removeObject(device_ptr, NULL_OBJECT_TYPE_DESCRIPTOR_SET_LAYOUT, descriptor_set_layout);
+}
+
+OPAL_BACKEND_STATIC Opal_Result null_deviceDestroyPipelineLayout(Opal_Device this, Opal_PipelineLayout pipeline_layout)
+{
+	assert(this);
+	assert(pipeline_layout);
+
+	Null_Device *device_ptr = (Null_Device *)this;
+	if (opal_cacheRelease(&device_ptr->pipeline_layout_cache, pipeline_layout) > 0)
+		return OPAL_SUCCESS;
+
+	return null_removeObject(device_ptr, NULL_OBJECT_TYPE_PIPELINE_LAYOUT, pipeline_layout);
+}
+
+OPAL_BACKEND_STATIC Opal_Result null_deviceDestroyGraphicsPipeline(Opal_Device this, Opal_GraphicsPipeline pipeline)
+{
+	assert(this);
+	assert(pipeline);
+
+	return null_removeObject((Null_Device *)this, NULL_OBJECT_TYPE_GRAPHICS_PIPELINE, pipeline);
 }
 
-static Opal_Result null_deviceDestroy(Opal_Device this)
+OPAL_BACKEND_STATIC Opal_Result null_deviceDestroyComputePipeline(Opal_Device this, Opal_ComputePipeline pipeline)
+{
+	assert(this);
+	assert(pipeline);
+
+	return null_removeObject((Null_Device *)this, NULL_OBJECT_TYPE_COMPUTE_PIPELINE, pipeline);
+}
+
+OPAL_BACKEND_STATIC Opal_Result null_deviceDestroyRaytracePipeline(Opal_Device this, Opal_RaytracePipeline pipeline)
+{
+	assert(this);
+	assert(pipeline);
+
+	return null_removeObject((Null_Device *)this, NULL_OBJECT_TYPE_RAYTRACE_PIPELINE, pipeline);
+}
+
+OPAL_BACKEND_STATIC Opal_Result null_deviceDestroySwapchain(Opal_Device this, Opal_Swapchain swapchain)
+{
+	assert(this);
+	assert(swapchain);
+
+	Opal_PoolHandle handle = (Opal_PoolHandle)swapchain;
+	assert(handle != OPAL_POOL_HANDLE_NULL);
+
+	Null_Device *device_ptr = (Null_Device *)this;
+	Null_Swapchain *swapchain_ptr = (Null_Swapchain *)opal_poolGetElement(&device_ptr->swapchains, handle);
+	assert(swapchain_ptr);
+
+	for (uint32_t i = 0; i < swapchain_ptr->num_images; ++i)
+	{
+		opal_poolRemoveElement(&device_ptr->texture_views, (Opal_PoolHandle)swapchain_ptr->texture_views[i]);
+		opal_poolRemoveElement(&device_ptr->textures, (Opal_PoolHandle)swapchain_ptr->textures[i]);
+	}
+
+	free(swapchain_ptr->texture_views);
+	free(swapchain_ptr->textures);
+
+	return opal_poolRemoveElement(&device_ptr->swapchains, handle);
+}
+
+OPAL_BACKEND_STATIC Opal_Result null_deviceDestroy(Opal_Device this)
 {
 	assert(this);
 
 	Null_Device *ptr = (Null_Device *)this;
 
+	opal_notifierShutdown(&ptr->notifier);
+	opal_compilerShutdown(&ptr->compiler);
+
+	{
+		uint32_t head = opal_poolGetHeadIndex(&ptr->buffers);
+		while (head != OPAL_POOL_HANDLE_NULL)
+		{
+			Null_Buffer *buffer_ptr = (Null_Buffer *)opal_poolGetElementByIndex(&ptr->buffers, head);
+			free(buffer_ptr->data);
+
+			head = opal_poolGetNextIndex(&ptr->buffers, head);
+		}
+
+		opal_poolShutdown(&ptr->buffers);
+	}
+
+	{
+		uint32_t head = opal_poolGetHeadIndex(&ptr->swapchains);
+		while (head != OPAL_POOL_HANDLE_NULL)
+		{
+			Null_Swapchain *swapchain_ptr = (Null_Swapchain *)opal_poolGetElementByIndex(&ptr->swapchains, head);
+			free(swapchain_ptr->texture_views);
+			free(swapchain_ptr->textures);
+
+			head = opal_poolGetNextIndex(&ptr->swapchains, head);
+		}
+
+		opal_poolShutdown(&ptr->swapchains);
+	}
+
+	opal_cacheShutdown(&ptr->pipeline_layout_cache);
+	opal_cacheShutdown(&ptr->descriptor_set_layout_cache);
+	opal_cacheShutdown(&ptr->sampler_cache);
+	opal_cacheShutdown(&ptr->shader_cache);
+
+	opal_poolShutdown(&ptr->objects);
+	opal_poolShutdown(&ptr->texture_views);
+	opal_poolShutdown(&ptr->textures);
+	opal_poolShutdown(&ptr->semaphores);
+	opal_poolShutdown(&ptr->queues);
+
+	for (uint32_t i = 0; i < OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX; ++i)
+		free(ptr->queue_handles[i]);
+
 	free(ptr);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceBuildShaderBindingTable(Opal_Device this, Opal_ShaderBindingTable shader_binding_table, const Opal_ShaderBindingTableBuildDesc *desc)
+OPAL_BACKEND_STATIC Opal_Result null_deviceBuildShaderBindingTable(Opal_Device this, Opal_ShaderBindingTable shader_binding_table, const Opal_ShaderBindingTableBuildDesc *desc)
 {
+	assert(this);
+	assert(shader_binding_table);
+	assert(desc);
+
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(shader_binding_table);
 	OPAL_UNUSED(desc);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceBuildAccelerationStructureInstanceBuffer(Opal_Device this, const Opal_AccelerationStructureInstanceBufferBuildDesc *desc)
+OPAL_BACKEND_STATIC Opal_Result null_deviceBuildAccelerationStructureInstanceBuffer(Opal_Device this, const Opal_AccelerationStructureInstanceBufferBuildDesc *desc)
 {
+	assert(this);
+	assert(desc);
+
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(desc);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceResetCommandAllocator(Opal_Device this, Opal_CommandAllocator command_allocator)
+OPAL_BACKEND_STATIC Opal_Result null_deviceResetCommandAllocator(Opal_Device this, Opal_CommandAllocator command_allocator)
 {
+	assert(this);
+	assert(command_allocator);
+
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_allocator);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceAllocateDescriptorSet(Opal_Device this, const Opal_DescriptorSetAllocationDesc *desc, Opal_DescriptorSet *descriptor_set)
+OPAL_BACKEND_STATIC Opal_Result null_deviceAllocateDescriptorSet(Opal_Device this, const Opal_DescriptorSetAllocationDesc *desc, Opal_DescriptorSet *descriptor_set)
 {
-	OPAL_UNUSED(this);
+	assert(this);
+	assert(desc);
+	assert(descriptor_set);
+
 	OPAL_UNUSED(desc);
-	OPAL_UNUSED(descriptor_set);
 
-	return OPAL_NOT_SUPPORTED;
+	return null_addObject((Null_Device *)this, NULL_OBJECT_TYPE_DESCRIPTOR_SET, descriptor_set);
 }
 
-static Opal_Result null_deviceFreeDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set)
+OPAL_BACKEND_STATIC Opal_Result null_deviceFreeDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(descriptor_set);
+	assert(this);
+	assert(descriptor_set);
 
-	return OPAL_NOT_SUPPORTED;
+	return null_removeObject((Null_Device *)this, NULL_OBJECT_TYPE_DESCRIPTOR_SET, descriptor_set);
 }
 
-static Opal_Result null_deviceMapBuffer(Opal_Device this, Opal_Buffer buffer, void **ptr)
+OPAL_BACKEND_STATIC Opal_Result null_deviceMapBuffer(Opal_Device this, Opal_Buffer buffer, void **ptr)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(buffer);
-	OPAL_UNUSED(ptr);
+	assert(this);
+	assert(buffer);
+	assert(ptr);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+	Null_Buffer *buffer_ptr = (Null_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)buffer);
+	assert(buffer_ptr);
+
+	if (buffer_ptr->data == NULL)
+		return OPAL_BUFFER_NONMAPPABLE;
+
+	*ptr = buffer_ptr->data;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceUnmapBuffer(Opal_Device this, Opal_Buffer buffer)
+OPAL_BACKEND_STATIC Opal_Result null_deviceUnmapBuffer(Opal_Device this, Opal_Buffer buffer)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(buffer);
+	assert(this);
+	assert(buffer);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+	Null_Buffer *buffer_ptr = (Null_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)buffer);
+	assert(buffer_ptr);
+
+	if (buffer_ptr->data == NULL)
+		return OPAL_BUFFER_NONMAPPABLE;
+
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceWriteBuffer(Opal_Device this, Opal_Buffer buffer, uint64_t offset, const void *data, uint64_t size)
+OPAL_BACKEND_STATIC Opal_Result null_deviceWriteBuffer(Opal_Device this, Opal_Buffer buffer, uint64_t offset, const void *data, uint64_t size)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(buffer);
-	OPAL_UNUSED(offset);
-	OPAL_UNUSED(data);
-	OPAL_UNUSED(size);
+	assert(this);
+	assert(buffer);
+	assert(data);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+	Null_Buffer *buffer_ptr = (Null_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)buffer);
+	assert(buffer_ptr);
+
+	if (buffer_ptr->data == NULL)
+		return OPAL_BUFFER_NONMAPPABLE;
+
+	if (offset + size > buffer_ptr->size)
+		return OPAL_INVALID_BUFFER;
+
+	memcpy(buffer_ptr->data + offset, data, size);
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceUpdateDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set, uint32_t num_entries, const Opal_DescriptorSetEntry *entries)
+OPAL_BACKEND_STATIC Opal_Result null_deviceUpdateDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set, uint32_t num_entries, const Opal_DescriptorSetEntry *entries)
 {
+	assert(this);
+	assert(descriptor_set);
+	assert(num_entries == 0 || entries);
+
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(descriptor_set);
 	OPAL_UNUSED(num_entries);
 	OPAL_UNUSED(entries);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result null_deviceBeginCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
+{
+	assert(this);
+	assert(command_buffer);
+
+	OPAL_UNUSED(this);
+	OPAL_UNUSED(command_buffer);
+
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result null_deviceEndCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
+{
+	assert(this);
+	assert(command_buffer);
+
+	OPAL_UNUSED(this);
+	OPAL_UNUSED(command_buffer);
+
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result null_deviceQuerySemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t *value)
+{
+	assert(this);
+	assert(semaphore);
+	assert(value);
+
+	Null_Device *device_ptr = (Null_Device *)this;
+	Null_Semaphore *semaphore_ptr = (Null_Semaphore *)opal_poolGetElement(&device_ptr->semaphores, (Opal_PoolHandle)semaphore);
+	assert(semaphore_ptr);
+
+	*value = semaphore_ptr->value;
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result null_deviceSignalSemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t value)
+{
+	assert(this);
+	assert(semaphore);
+
+	Null_Device *device_ptr = (Null_Device *)this;
+	Null_Semaphore *semaphore_ptr = (Null_Semaphore *)opal_poolGetElement(&device_ptr->semaphores, (Opal_PoolHandle)semaphore);
+	assert(semaphore_ptr);
+
+	semaphore_ptr->value = value;
+
+	opal_notifierPoll(&device_ptr->notifier);
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result null_deviceWaitSemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t value, uint64_t timeout_milliseconds)
+{
+	assert(this);
+	assert(semaphore);
+
+	OPAL_UNUSED(timeout_milliseconds);
+
+	Null_Device *device_ptr = (Null_Device *)this;
+	Null_Semaphore *semaphore_ptr = (Null_Semaphore *)opal_poolGetElement(&device_ptr->semaphores, (Opal_PoolHandle)semaphore);
+	assert(semaphore_ptr);
+
+	// note: work completes at submit time, nothing can signal the semaphore while we wait
+	if (semaphore_ptr->value < value)
+		return OPAL_WAIT_TIMEOUT;
+
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result null_deviceWaitSemaphores(Opal_Device this, uint32_t num_semaphores, const Opal_Semaphore *semaphores, const uint64_t *values, uint32_t wait_any, uint64_t timeout_milliseconds)
+{
+	assert(this);
+	assert(num_semaphores > 0);
+	assert(semaphores);
+	assert(values);
+
+	OPAL_UNUSED(timeout_milliseconds);
+
+	Null_Device *device_ptr = (Null_Device *)this;
+
+	uint32_t num_signaled = 0;
+	for (uint32_t i = 0; i < num_semaphores; ++i)
+	{
+		Null_Semaphore *semaphore_ptr = (Null_Semaphore *)opal_poolGetElement(&device_ptr->semaphores, (Opal_PoolHandle)semaphores[i]);
+		assert(semaphore_ptr);
+
+		if (semaphore_ptr->value >= values[i])
+			num_signaled++;
+	}
+
+	// note: work completes at submit time, nothing can signal the semaphores while we wait
+	if ((wait_any && num_signaled > 0) || num_signaled == num_semaphores)
+		return OPAL_SUCCESS;
+
+	return OPAL_WAIT_TIMEOUT;
 }
 
-static Opal_Result null_deviceBeginCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
+OPAL_BACKEND_STATIC Opal_Result null_deviceRegisterSemaphoreCallback(Opal_Device this, Opal_Semaphore semaphore, uint64_t value, PFN_opalSemaphoreCallback callback, void *user_data)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(command_buffer);
+	assert(this);
+	assert(semaphore);
+	assert(callback);
 
-	return OPAL_NOT_SUPPORTED;
+	// note: semaphores only advance on submit & signal, which poll the notifier on the calling thread
+	Null_Device *device_ptr = (Null_Device *)this;
+	return opal_notifierRegister(&device_ptr->notifier, semaphore, (uint64_t)semaphore, value, callback, user_data);
 }
 
-static Opal_Result null_deviceEndCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
+OPAL_BACKEND_STATIC Opal_Result null_deviceWaitPipelineTask(Opal_Device this, Opal_PipelineTask task, uint64_t timeout_milliseconds)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(command_buffer);
+	assert(this);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+	return opal_compilerWait(&device_ptr->compiler, task, timeout_milliseconds);
 }
 
-static Opal_Result null_deviceQuerySemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t *value)
+OPAL_BACKEND_STATIC Opal_Result null_deviceWaitQueue(Opal_Device this, Opal_Queue queue)
 {
+	assert(this);
+	assert(queue);
+
 	OPAL_UNUSED(this);
-	OPAL_UNUSED(semaphore);
-	OPAL_UNUSED(value);
+	OPAL_UNUSED(queue);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceSignalSemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t value)
+OPAL_BACKEND_STATIC Opal_Result null_deviceWaitIdle(Opal_Device this)
 {
+	assert(this);
+
 	OPAL_UNUSED(this);
-	OPAL_UNUSED(semaphore);
-	OPAL_UNUSED(value);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceWaitSemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t value, uint64_t timeout_milliseconds)
+OPAL_BACKEND_STATIC Opal_Result null_deviceSubmit(Opal_Device this, Opal_Queue queue, const Opal_SubmitDesc *desc)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(semaphore);
-	OPAL_UNUSED(value);
-	OPAL_UNUSED(timeout_milliseconds);
+	assert(this);
+	assert(queue);
+	assert(desc);
 
-	return OPAL_NOT_SUPPORTED;
-}
+	Null_Device *device_ptr = (Null_Device *)this;
 
-static Opal_Result null_deviceWaitQueue(Opal_Device this, Opal_Queue queue)
-{
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(queue);
+	Null_Queue *queue_ptr = (Null_Queue *)opal_poolGetElement(&device_ptr->queues, (Opal_PoolHandle)queue);
+	assert(queue_ptr);
 
-	return OPAL_NOT_SUPPORTED;
+	OPAL_UNUSED(queue_ptr);
+
+	for (uint32_t i = 0; i < desc->num_signal_semaphores; ++i)
+	{
+		Null_Semaphore *semaphore_ptr = (Null_Semaphore *)opal_poolGetElement(&device_ptr->semaphores, (Opal_PoolHandle)desc->signal_semaphores[i]);
+		assert(semaphore_ptr);
+
+		semaphore_ptr->value = desc->signal_values[i];
+	}
+
+	uint64_t time = opal_timerGetNanoseconds();
+	for (uint32_t i = 0; i < desc->num_signal_swapchains; ++i)
+	{
+		Null_Swapchain *swapchain_ptr = (Null_Swapchain *)opal_poolGetElement(&device_ptr->swapchains, (Opal_PoolHandle)desc->signal_swapchains[i]);
+		assert(swapchain_ptr);
+
+		opal_pacingSubmit(&swapchain_ptr->pacing, time);
+	}
+
+	opal_notifierPoll(&device_ptr->notifier);
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceWaitIdle(Opal_Device this)
+OPAL_BACKEND_STATIC Opal_Result null_deviceAcquire(Opal_Device this, Opal_Swapchain swapchain, Opal_TextureView *texture_view)
 {
-	OPAL_UNUSED(this);
+	assert(this);
+	assert(swapchain);
+	assert(texture_view);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+
+	Null_Swapchain *swapchain_ptr = (Null_Swapchain *)opal_poolGetElement(&device_ptr->swapchains, (Opal_PoolHandle)swapchain);
+	assert(swapchain_ptr);
+
+	swapchain_ptr->current_image = (swapchain_ptr->current_image + 1) % swapchain_ptr->num_images;
+	opal_pacingAcquire(&swapchain_ptr->pacing, opal_timerGetNanoseconds());
+
+	*texture_view = swapchain_ptr->texture_views[swapchain_ptr->current_image];
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceSubmit(Opal_Device this, Opal_Queue queue, const Opal_SubmitDesc *desc)
+OPAL_BACKEND_STATIC Opal_Result null_devicePresent(Opal_Device this, Opal_Swapchain swapchain)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(queue);
-	OPAL_UNUSED(desc);
+	assert(this);
+	assert(swapchain);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+
+	Null_Swapchain *swapchain_ptr = (Null_Swapchain *)opal_poolGetElement(&device_ptr->swapchains, (Opal_PoolHandle)swapchain);
+	assert(swapchain_ptr);
+
+	// note: headless images are never scanned out, so a frame counts as displayed once presented
+	uint64_t time = opal_timerGetNanoseconds();
+	uint64_t frame_id = opal_pacingPresent(&swapchain_ptr->pacing, time);
+	opal_pacingDisplay(&swapchain_ptr->pacing, frame_id, time);
+
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceAcquire(Opal_Device this, Opal_Swapchain swapchain, Opal_TextureView *texture_view)
+OPAL_BACKEND_STATIC Opal_Result null_deviceWaitPresent(Opal_Device this, Opal_Swapchain swapchain, uint64_t frame_id, uint64_t timeout_milliseconds)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(swapchain);
-	OPAL_UNUSED(texture_view);
+	assert(this);
+	assert(swapchain);
 
-	return OPAL_NOT_SUPPORTED;
+	OPAL_UNUSED(timeout_milliseconds);
+
+	Null_Device *device_ptr = (Null_Device *)this;
+
+	Null_Swapchain *swapchain_ptr = (Null_Swapchain *)opal_poolGetElement(&device_ptr->swapchains, (Opal_PoolHandle)swapchain);
+	assert(swapchain_ptr);
+
+	// note: presents are displayed right away, so there is never anything to wait for and the timeout doesn't matter,
+	//       but a frame that wasn't presented yet would never complete on a real device
+	if (frame_id > swapchain_ptr->pacing.last_presented_frame)
+		return OPAL_INVALID_SWAPCHAIN;
+
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_devicePresent(Opal_Device this, Opal_Swapchain swapchain)
+OPAL_BACKEND_STATIC Opal_Result null_deviceGetSwapchainFrameTiming(Opal_Device this, Opal_Swapchain swapchain, Opal_FrameTiming *timing)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(swapchain);
+	assert(this);
+	assert(swapchain);
+	assert(timing);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+
+	Null_Swapchain *swapchain_ptr = (Null_Swapchain *)opal_poolGetElement(&device_ptr->swapchains, (Opal_PoolHandle)swapchain);
+	assert(swapchain_ptr);
+
+	opal_pacingGetTiming(&swapchain_ptr->pacing, timing);
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdSetDescriptorHeap(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_DescriptorHeap descriptor_heap)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdSetDescriptorHeap(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_DescriptorHeap descriptor_heap)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
 	OPAL_UNUSED(descriptor_heap);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdBeginGraphicsPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_FramebufferDesc *framebuffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdBeginGraphicsPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_FramebufferDesc *framebuffer, const Opal_PassBarriersDesc *barriers)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
 	OPAL_UNUSED(framebuffer);
 	OPAL_UNUSED(barriers);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdGraphicsSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdGraphicsSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
 	OPAL_UNUSED(pipeline_layout);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdGraphicsSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_GraphicsPipeline pipeline)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdGraphicsSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_GraphicsPipeline pipeline)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
 	OPAL_UNUSED(pipeline);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdGraphicsSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdGraphicsSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -611,10 +1314,10 @@ static Opal_Result null_deviceCmdGraphicsSetDescriptorSet(Opal_Device this, Opal
 	OPAL_UNUSED(num_dynamic_offsets);
 	OPAL_UNUSED(dynamic_offsets);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdGraphicsSetVertexBuffers(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t first_index, uint32_t num_vertex_buffers, const Opal_VertexBufferView *vertex_buffers)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdGraphicsSetVertexBuffers(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t first_index, uint32_t num_vertex_buffers, const Opal_VertexBufferView *vertex_buffers)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -622,28 +1325,28 @@ static Opal_Result null_deviceCmdGraphicsSetVertexBuffers(Opal_Device this, Opal
 	OPAL_UNUSED(num_vertex_buffers);
 	OPAL_UNUSED(vertex_buffers);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdGraphicsSetIndexBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_IndexBufferView index_buffer)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdGraphicsSetIndexBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_IndexBufferView index_buffer)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
 	OPAL_UNUSED(index_buffer);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdGraphicsSetViewport(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Viewport viewport)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdGraphicsSetViewport(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Viewport viewport)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
 	OPAL_UNUSED(viewport);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdGraphicsSetScissor(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdGraphicsSetScissor(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -652,10 +1355,10 @@ static Opal_Result null_deviceCmdGraphicsSetScissor(Opal_Device this, Opal_Comma
 	OPAL_UNUSED(width);
 	OPAL_UNUSED(height);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdGraphicsDraw(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_vertices, uint32_t num_instances, uint32_t base_vertex, uint32_t base_instance)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdGraphicsDraw(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_vertices, uint32_t num_instances, uint32_t base_vertex, uint32_t base_instance)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -664,10 +1367,10 @@ static Opal_Result null_deviceCmdGraphicsDraw(Opal_Device this, Opal_CommandBuff
 	OPAL_UNUSED(base_vertex);
 	OPAL_UNUSED(base_instance);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdGraphicsDrawIndexed(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_indices, uint32_t num_instances, uint32_t base_index, int32_t vertex_offset, uint32_t base_instance)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdGraphicsDrawIndexed(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_indices, uint32_t num_instances, uint32_t base_index, int32_t vertex_offset, uint32_t base_instance)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -677,10 +1380,10 @@ static Opal_Result null_deviceCmdGraphicsDrawIndexed(Opal_Device this, Opal_Comm
 	OPAL_UNUSED(vertex_offset);
 	OPAL_UNUSED(base_instance);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdGraphicsMeshletDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_threadgroups_x, uint32_t num_threadgroups_y, uint32_t num_threadgroups_z)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdGraphicsMeshletDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_threadgroups_x, uint32_t num_threadgroups_y, uint32_t num_threadgroups_z)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -688,46 +1391,46 @@ static Opal_Result null_deviceCmdGraphicsMeshletDispatch(Opal_Device this, Opal_
 	OPAL_UNUSED(num_threadgroups_y);
 	OPAL_UNUSED(num_threadgroups_z);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdEndGraphicsPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdEndGraphicsPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
 	OPAL_UNUSED(barriers);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdBeginComputePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdBeginComputePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
 	OPAL_UNUSED(barriers);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdComputeSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdComputeSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
 	OPAL_UNUSED(pipeline_layout);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdComputeSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_GraphicsPipeline pipeline)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdComputeSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_GraphicsPipeline pipeline)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
 	OPAL_UNUSED(pipeline);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdComputeSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdComputeSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -736,19 +1439,19 @@ static Opal_Result null_deviceCmdComputeSetDescriptorSet(Opal_Device this, Opal_
 	OPAL_UNUSED(num_dynamic_offsets);
 	OPAL_UNUSED(dynamic_offsets);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdComputeMemoryBarrier(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_MemoryBarrierDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdComputeMemoryBarrier(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_MemoryBarrierDesc *barriers)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
 	OPAL_UNUSED(barriers);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdComputeDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_threadgroups_x, uint32_t num_threadgroups_y, uint32_t num_threadgroups_z)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdComputeDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_threadgroups_x, uint32_t num_threadgroups_y, uint32_t num_threadgroups_z)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -756,46 +1459,46 @@ static Opal_Result null_deviceCmdComputeDispatch(Opal_Device this, Opal_CommandB
 	OPAL_UNUSED(num_threadgroups_y);
 	OPAL_UNUSED(num_threadgroups_z);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdEndComputePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdEndComputePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
 	OPAL_UNUSED(barriers);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdBeginRaytracePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdBeginRaytracePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
 	OPAL_UNUSED(barriers);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdRaytraceSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdRaytraceSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
 	OPAL_UNUSED(pipeline_layout);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdRaytraceSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_GraphicsPipeline pipeline)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdRaytraceSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_GraphicsPipeline pipeline)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
 	OPAL_UNUSED(pipeline);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdRaytraceSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdRaytraceSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -804,28 +1507,28 @@ static Opal_Result null_deviceCmdRaytraceSetDescriptorSet(Opal_Device this, Opal
 	OPAL_UNUSED(num_dynamic_offsets);
 	OPAL_UNUSED(dynamic_offsets);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdRaytraceSetShaderBindingTable(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_ShaderBindingTable shader_binding_table)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdRaytraceSetShaderBindingTable(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_ShaderBindingTable shader_binding_table)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
 	OPAL_UNUSED(shader_binding_table);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdRaytraceMemoryBarrier(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_MemoryBarrierDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdRaytraceMemoryBarrier(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_MemoryBarrierDesc *barriers)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
 	OPAL_UNUSED(barriers);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdRaytraceDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t width, uint32_t height, uint32_t depth)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdRaytraceDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t width, uint32_t height, uint32_t depth)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -833,41 +1536,53 @@ static Opal_Result null_deviceCmdRaytraceDispatch(Opal_Device this, Opal_Command
 	OPAL_UNUSED(height);
 	OPAL_UNUSED(depth);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdEndRaytracePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdEndRaytracePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
 	OPAL_UNUSED(barriers);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdBeginCopyPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdBeginCopyPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
 	OPAL_UNUSED(barriers);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdCopyBufferToBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer src_buffer, uint64_t src_offset, Opal_Buffer dst_buffer, uint64_t dst_offset, uint64_t size)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdCopyBufferToBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer src_buffer, uint64_t src_offset, Opal_Buffer dst_buffer, uint64_t dst_offset, uint64_t size)
 {
-	OPAL_UNUSED(this);
+	assert(this);
+	assert(command_buffer);
+
 	OPAL_UNUSED(command_buffer);
-	OPAL_UNUSED(src_buffer);
-	OPAL_UNUSED(src_offset);
-	OPAL_UNUSED(dst_buffer);
-	OPAL_UNUSED(dst_offset);
-	OPAL_UNUSED(size);
 
-	return OPAL_NOT_SUPPORTED;
+	Null_Device *device_ptr = (Null_Device *)this;
+
+	Null_Buffer *src_buffer_ptr = (Null_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)src_buffer);
+	assert(src_buffer_ptr);
+
+	Null_Buffer *dst_buffer_ptr = (Null_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)dst_buffer);
+	assert(dst_buffer_ptr);
+
+	if (src_offset + size > src_buffer_ptr->size || dst_offset + size > dst_buffer_ptr->size)
+		return OPAL_INVALID_ARGUMENT;
+
+	// note: there is no queue to defer the work to, so host backed buffers are copied at record time
+	if (src_buffer_ptr->data && dst_buffer_ptr->data)
+		memmove(dst_buffer_ptr->data + dst_offset, src_buffer_ptr->data + src_offset, (size_t)size);
+
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdCopyBufferToTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_BufferTextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdCopyBufferToTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_BufferTextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -875,10 +1590,10 @@ static Opal_Result null_deviceCmdCopyBufferToTexture(Opal_Device this, Opal_Comm
 	OPAL_UNUSED(dst);
 	OPAL_UNUSED(size);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdCopyTextureToBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_BufferTextureRegion dst, Opal_Extent3D size)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdCopyTextureToBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_BufferTextureRegion dst, Opal_Extent3D size)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -886,10 +1601,34 @@ static Opal_Result null_deviceCmdCopyTextureToBuffer(Opal_Device this, Opal_Comm
 	OPAL_UNUSED(dst);
 	OPAL_UNUSED(size);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdCopyBufferToTextureRegions(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer src_buffer, Opal_Texture dst_texture, uint32_t num_regions, const Opal_BufferTextureCopyRegion *regions)
+{
+	OPAL_UNUSED(this);
+	OPAL_UNUSED(command_buffer);
+	OPAL_UNUSED(src_buffer);
+	OPAL_UNUSED(dst_texture);
+	OPAL_UNUSED(num_regions);
+	OPAL_UNUSED(regions);
+
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdCopyTextureToBufferRegions(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Texture src_texture, Opal_Buffer dst_buffer, uint32_t num_regions, const Opal_BufferTextureCopyRegion *regions)
+{
+	OPAL_UNUSED(this);
+	OPAL_UNUSED(command_buffer);
+	OPAL_UNUSED(src_texture);
+	OPAL_UNUSED(dst_buffer);
+	OPAL_UNUSED(num_regions);
+	OPAL_UNUSED(regions);
+
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdCopyTextureToTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdCopyTextureToTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -897,54 +1636,226 @@ static Opal_Result null_deviceCmdCopyTextureToTexture(Opal_Device this, Opal_Com
 	OPAL_UNUSED(dst);
 	OPAL_UNUSED(size);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdFillBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer buffer, uint64_t offset, uint64_t size, uint32_t value)
+{
+	assert(this);
+	assert(command_buffer);
+	assert((offset & 3) == 0);
+	assert((size & 3) == 0);
+
+	OPAL_UNUSED(command_buffer);
+
+	Null_Device *device_ptr = (Null_Device *)this;
+
+	Null_Buffer *buffer_ptr = (Null_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)buffer);
+	assert(buffer_ptr);
+
+	if (offset + size > buffer_ptr->size)
+		return OPAL_INVALID_ARGUMENT;
+
+	// note: same as copies, host backed buffers are filled at record time
+	if (buffer_ptr->data)
+	{
+		uint8_t *dst = buffer_ptr->data + offset;
+		for (uint64_t i = 0; i < size; i += sizeof(uint32_t))
+			memcpy(dst + i, &value, sizeof(uint32_t));
+	}
+
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdUpdateBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer buffer, uint64_t offset, uint64_t size, const void *data)
+{
+	assert(this);
+	assert(command_buffer);
+	assert(size == 0 || data);
+	assert((offset & 3) == 0);
+	assert((size & 3) == 0);
+
+	OPAL_UNUSED(command_buffer);
+
+	if (size > OPAL_MAX_UPDATE_BUFFER_SIZE)
+		return OPAL_NOT_SUPPORTED;
+
+	Null_Device *device_ptr = (Null_Device *)this;
+
+	Null_Buffer *buffer_ptr = (Null_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)buffer);
+	assert(buffer_ptr);
+
+	if (offset + size > buffer_ptr->size)
+		return OPAL_INVALID_ARGUMENT;
+
+	if (buffer_ptr->data && size > 0)
+		memcpy(buffer_ptr->data + offset, data, (size_t)size);
+
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdClearTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureView texture_view, Opal_ClearValue clear_value)
+{
+	assert(this);
+	assert(command_buffer);
+
+	OPAL_UNUSED(clear_value);
+
+	Null_Device *device_ptr = (Null_Device *)this;
+
+	Null_Object *command_buffer_ptr = (Null_Object *)opal_poolGetElement(&device_ptr->objects, (Opal_PoolHandle)command_buffer);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->type == NULL_OBJECT_TYPE_COMMAND_BUFFER);
+
+	Null_TextureView *texture_view_ptr = (Null_TextureView *)opal_poolGetElement(&device_ptr->texture_views, (Opal_PoolHandle)texture_view);
+	assert(texture_view_ptr);
+
+	Null_Texture *texture_ptr = (Null_Texture *)opal_poolGetElement(&device_ptr->textures, (Opal_PoolHandle)texture_view_ptr->texture);
+	assert(texture_ptr);
+
+	// note: mirrors the strictest backend, color clears need the main or compute engine, depth stencil clears need the main engine
+	Opal_TextureFormat format = texture_ptr->format;
+	if (command_buffer_ptr->engine_type == OPAL_DEVICE_ENGINE_TYPE_COPY)
+		return OPAL_NOT_SUPPORTED;
+
+	if (format >= OPAL_TEXTURE_FORMAT_DEPTH_STENCIL_BEGIN && format <= OPAL_TEXTURE_FORMAT_DEPTH_STENCIL_END && command_buffer_ptr->engine_type != OPAL_DEVICE_ENGINE_TYPE_MAIN)
+		return OPAL_NOT_SUPPORTED;
+
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdBlitTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_Extent3D src_size, Opal_TextureRegion dst, Opal_Extent3D dst_size, Opal_SamplerFilterMode filter)
+{
+	assert(this);
+	assert(command_buffer);
+
+	OPAL_UNUSED(src);
+	OPAL_UNUSED(src_size);
+	OPAL_UNUSED(dst);
+	OPAL_UNUSED(dst_size);
+	OPAL_UNUSED(filter);
+
+	Null_Device *device_ptr = (Null_Device *)this;
+
+	Null_Object *command_buffer_ptr = (Null_Object *)opal_poolGetElement(&device_ptr->objects, (Opal_PoolHandle)command_buffer);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->type == NULL_OBJECT_TYPE_COMMAND_BUFFER);
+
+	// note: mirrors vulkan, blits are main engine only
+	if (command_buffer_ptr->engine_type != OPAL_DEVICE_ENGINE_TYPE_MAIN)
+		return OPAL_NOT_SUPPORTED;
+
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdGenerateMips(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureView texture_view)
+{
+	assert(this);
+	assert(command_buffer);
+
+	OPAL_UNUSED(texture_view);
+
+	Null_Device *device_ptr = (Null_Device *)this;
+
+	Null_Object *command_buffer_ptr = (Null_Object *)opal_poolGetElement(&device_ptr->objects, (Opal_PoolHandle)command_buffer);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->type == NULL_OBJECT_TYPE_COMMAND_BUFFER);
+
+	// note: mirrors vulkan, mips are generated with blits, which are main engine only
+	if (command_buffer_ptr->engine_type != OPAL_DEVICE_ENGINE_TYPE_MAIN)
+		return OPAL_NOT_SUPPORTED;
+
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdEndCopyPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdEndCopyPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
 	OPAL_UNUSED(barriers);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdBeginAccelerationStructurePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdBeginAccelerationStructurePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
 	OPAL_UNUSED(barriers);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdAccelerationStructureBuild(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureBuildDesc *desc)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdAccelerationStructureBuild(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureBuildDesc *desc)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
 	OPAL_UNUSED(desc);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdAccelerationStructureCopy(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureCopyDesc *desc)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdAccelerationStructureBuildBatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_descs, const Opal_AccelerationStructureBuildDesc *descs)
+{
+	OPAL_UNUSED(this);
+	OPAL_UNUSED(command_buffer);
+	OPAL_UNUSED(num_descs);
+	OPAL_UNUSED(descs);
+
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdAccelerationStructureCopy(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureCopyDesc *desc)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
 	OPAL_UNUSED(desc);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdAccelerationStructureWriteCompactedSizes(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_acceleration_structures, const Opal_AccelerationStructure *acceleration_structures, Opal_BufferView dst)
+{
+	OPAL_UNUSED(this);
+	OPAL_UNUSED(command_buffer);
+	OPAL_UNUSED(num_acceleration_structures);
+	OPAL_UNUSED(acceleration_structures);
+	OPAL_UNUSED(dst);
+
+	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_deviceCmdEndAccelerationStructurePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result null_deviceCmdEndAccelerationStructurePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
 	OPAL_UNUSED(barriers);
 
-	return OPAL_NOT_SUPPORTED;
+	return OPAL_SUCCESS;
+}
+
+/*
+ */
+static uint64_t null_notifierQuerySemaphore(void *device, uint64_t semaphore)
+{
+	Null_Device *device_ptr = (Null_Device *)device;
+	assert(device_ptr);
+
+	Null_Semaphore *semaphore_ptr = (Null_Semaphore *)opal_poolGetElement(&device_ptr->semaphores, (Opal_PoolHandle)semaphore);
+	assert(semaphore_ptr);
+
+	return semaphore_ptr->value;
 }
 
+static Opal_NotifierFunctions null_notifier_functions =
+{
+	NULL,
+	NULL,
+	null_notifierQuerySemaphore,
+	NULL,
+	NULL,
+};
+
 /*
  */
 static Opal_DeviceTable device_vtbl =
@@ -952,6 +1863,7 @@ static Opal_DeviceTable device_vtbl =
 	null_deviceGetInfo,
 	null_deviceGetQueue,
 	null_deviceGetAccelerationStructurePrebuildInfo,
+	null_deviceGetAccelerationStructureAddress,
 	null_deviceGetSupportedSurfaceFormats,
 	null_deviceGetSupportedPresentModes,
 	null_deviceGetPreferredSurfaceFormat,
@@ -975,6 +1887,12 @@ static Opal_DeviceTable device_vtbl =
 	null_deviceCreateMeshletPipeline,
 	null_deviceCreateComputePipeline,
 	null_deviceCreateRaytracePipeline,
+	null_deviceCreateGraphicsPipelines,
+	null_deviceCreateComputePipelines,
+	null_deviceCreateRaytracePipelines,
+	null_deviceCreateGraphicsPipelinesAsync,
+	null_deviceCreateComputePipelinesAsync,
+	null_deviceCreateRaytracePipelinesAsync,
 	null_deviceCreateSwapchain,
 
 	null_deviceDestroySemaphore,
@@ -1011,11 +1929,16 @@ static Opal_DeviceTable device_vtbl =
 	null_deviceQuerySemaphore,
 	null_deviceSignalSemaphore,
 	null_deviceWaitSemaphore,
+	null_deviceWaitSemaphores,
+	null_deviceRegisterSemaphoreCallback,
+	null_deviceWaitPipelineTask,
 	null_deviceWaitQueue,
 	null_deviceWaitIdle,
 	null_deviceSubmit,
 	null_deviceAcquire,
 	null_devicePresent,
+	null_deviceWaitPresent,
+	null_deviceGetSwapchainFrameTiming,
 
 	null_deviceCmdSetDescriptorHeap,
 
@@ -1053,12 +1976,21 @@ static Opal_DeviceTable device_vtbl =
 	null_deviceCmdCopyBufferToBuffer,
 	null_deviceCmdCopyBufferToTexture,
 	null_deviceCmdCopyTextureToBuffer,
+	null_deviceCmdCopyBufferToTextureRegions,
+	null_deviceCmdCopyTextureToBufferRegions,
 	null_deviceCmdCopyTextureToTexture,
+	null_deviceCmdFillBuffer,
+	null_deviceCmdUpdateBuffer,
+	null_deviceCmdClearTexture,
+	null_deviceCmdBlitTexture,
+	null_deviceCmdGenerateMips,
 	null_deviceCmdEndCopyPass,
 
 	null_deviceCmdBeginAccelerationStructurePass,
 	null_deviceCmdAccelerationStructureBuild,
+	null_deviceCmdAccelerationStructureBuildBatch,
 	null_deviceCmdAccelerationStructureCopy,
+	null_deviceCmdAccelerationStructureWriteCompactedSizes,
 	null_deviceCmdEndAccelerationStructurePass,
 };
 
@@ -1076,6 +2008,8 @@ Opal_Result null_fillDeviceInfo(Opal_DeviceInfo *info)
 	info->api = OPAL_API_NULL;
 	info->device_type = OPAL_DEVICE_TYPE_UNKNOWN;
 	info->features.queue_count[OPAL_DEVICE_ENGINE_TYPE_MAIN] = 1;
+	info->features.queue_count[OPAL_DEVICE_ENGINE_TYPE_COMPUTE] = 1;
+	info->features.queue_count[OPAL_DEVICE_ENGINE_TYPE_COPY] = 1;
 
 	info->limits.max_texture_dimension_1d = 16384;
 	info->limits.max_texture_dimension_2d = 16384;
@@ -1084,6 +2018,8 @@ Opal_Result null_fillDeviceInfo(Opal_DeviceInfo *info)
 	info->limits.max_buffer_size = 0xFFFFFFFF;
 	info->limits.min_uniform_buffer_offset_alignment = 16;
 	info->limits.min_storage_buffer_offset_alignment = 4;
+	info->limits.min_texture_copy_row_alignment = 1;
+	info->limits.min_texture_copy_offset_alignment = 4;
 	info->limits.max_descriptor_sets = 8;
 	info->limits.max_uniform_buffer_binding_size = 0x0000FFFF;
 	info->limits.max_storage_buffer_binding_size = 0xFFFFFFFF;
@@ -1091,6 +2027,7 @@ Opal_Result null_fillDeviceInfo(Opal_DeviceInfo *info)
 	info->limits.max_vertex_attributes = 64;
 	info->limits.max_vertex_buffer_stride = 0x00003FFF;
 	info->limits.max_color_attachments = 8;
+	info->limits.min_acceleration_structure_scratch_offset_alignment = 256;
 
 	return OPAL_SUCCESS;
 }
@@ -1100,11 +2037,59 @@ Opal_Result null_deviceInitialize(Null_Device *device_ptr, Null_Instance *instan
 	assert(instance_ptr);
 	assert(device_ptr);
 
-	OPAL_UNUSED(instance_ptr);
+	memset(device_ptr, 0, sizeof(Null_Device));
 
 	// vtable
 	device_ptr->vtbl = &device_vtbl;
+	device_ptr->instance = instance_ptr;
 
 	// data
-	return null_fillDeviceInfo(&device_ptr->info);
+	Opal_Result result = null_fillDeviceInfo(&device_ptr->info);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	// pools
+	opal_poolInitialize(&device_ptr->queues, sizeof(Null_Queue), 4);
+	opal_poolInitialize(&device_ptr->semaphores, sizeof(Null_Semaphore), 32);
+	opal_poolInitialize(&device_ptr->buffers, sizeof(Null_Buffer), 32);
+	opal_poolInitialize(&device_ptr->textures, sizeof(Null_Texture), 32);
+	opal_poolInitialize(&device_ptr->texture_views, sizeof(Null_TextureView), 32);
+	opal_poolInitialize(&device_ptr->swapchains, sizeof(Null_Swapchain), 4);
+	opal_poolInitialize(&device_ptr->objects, sizeof(Null_Object), 32);
+
+	// caches
+	opal_cacheInitialize(&device_ptr->shader_cache, 64);
+	opal_cacheInitialize(&device_ptr->sampler_cache, 16);
+	opal_cacheInitialize(&device_ptr->descriptor_set_layout_cache, 16);
+	opal_cacheInitialize(&device_ptr->pipeline_layout_cache, 16);
+
+	// compiler
+	opal_compilerInitialize(&device_ptr->compiler, device_ptr, 0);
+
+	// notifier
+	opal_notifierInitialize(&device_ptr->notifier, device_ptr, &null_notifier_functions);
+
+	// queues
+	for (uint32_t i = 0; i < OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX; ++i)
+	{
+		uint32_t queue_count = device_ptr->info.features.queue_count[i];
+		if (queue_count == 0)
+			continue;
+
+		Opal_Queue *queue_handles = (Opal_Queue *)malloc(sizeof(Opal_Queue) * queue_count);
+		assert(queue_handles);
+
+		for (uint32_t j = 0; j < queue_count; ++j)
+		{
+			Null_Queue queue = {0};
+			queue.engine_type = (Opal_DeviceEngineType)i;
+			queue.index = j;
+
+			queue_handles[j] = (Opal_Queue)opal_poolAddElement(&device_ptr->queues, &queue);
+		}
+
+		device_ptr->queue_handles[i] = queue_handles;
+	}
+
+	return OPAL_SUCCESS;
 }
@@ -6,7 +6,7 @@
 
 /*
  */
-static Opal_Result null_instanceEnumerateDevices(Opal_Instance this, uint32_t *device_count, Opal_DeviceInfo *infos)
+OPAL_BACKEND_STATIC Opal_Result null_instanceEnumerateDevices(Opal_Instance this, uint32_t *device_count, Opal_DeviceInfo *infos)
 {
 	assert(this);
 	assert(device_count);
@@ -21,7 +21,7 @@ static Opal_Result null_instanceEnumerateDevices(Opal_Instance this, uint32_t *d
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_instanceCreateSurface(Opal_Instance this, void *handle, Opal_Surface *surface)
+OPAL_BACKEND_STATIC Opal_Result null_instanceCreateSurface(Opal_Instance this, void *handle, Opal_Surface *surface)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(handle);
@@ -30,7 +30,24 @@ static Opal_Result null_instanceCreateSurface(Opal_Instance this, void *handle,
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result null_instanceCreateDefaultDevice(Opal_Instance this, Opal_DeviceHint hint, Opal_Device *device)
+OPAL_BACKEND_STATIC Opal_Result null_instanceCreateHeadlessSurface(Opal_Instance this, uint32_t width, uint32_t height, Opal_Surface *surface)
+{
+	assert(this);
+	assert(width > 0);
+	assert(height > 0);
+	assert(surface);
+
+	Null_Instance *instance_ptr = (Null_Instance *)this;
+
+	Null_Surface result = {0};
+	result.width = width;
+	result.height = height;
+
+	*surface = (Opal_Surface)opal_poolAddElement(&instance_ptr->surfaces, &result);
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result null_instanceCreateDefaultDevice(Opal_Instance this, Opal_DeviceHint hint, Opal_Device *device)
 {
 	assert(this);
 	assert(device);
@@ -52,7 +69,7 @@ static Opal_Result null_instanceCreateDefaultDevice(Opal_Instance this, Opal_Dev
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_instanceCreateDevice(Opal_Instance this, uint32_t index, Opal_Device *device)
+OPAL_BACKEND_STATIC Opal_Result null_instanceCreateDevice(Opal_Instance this, uint32_t index, Opal_Device *device)
 {
 	assert(this);
 	assert(device);
@@ -75,15 +92,19 @@ static Opal_Result null_instanceCreateDevice(Opal_Instance this, uint32_t index,
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result null_instanceDestroySurface(Opal_Instance this, Opal_Surface surface)
+OPAL_BACKEND_STATIC Opal_Result null_instanceDestroySurface(Opal_Instance this, Opal_Surface surface)
 {
-	OPAL_UNUSED(this);
-	OPAL_UNUSED(surface);
+	assert(this);
+	assert(surface);
 
-	return OPAL_NOT_SUPPORTED;
+	Opal_PoolHandle handle = (Opal_PoolHandle)surface;
+	assert(handle != OPAL_POOL_HANDLE_NULL);
+
+	Null_Instance *instance_ptr = (Null_Instance *)this;
+	return opal_poolRemoveElement(&instance_ptr->surfaces, handle);
 }
 
-static Opal_Result null_instanceDestroy(Opal_Instance this)
+OPAL_BACKEND_STATIC Opal_Result null_instanceDestroy(Opal_Instance this)
 {
 	assert(this);
 
@@ -92,6 +113,8 @@ static Opal_Result null_instanceDestroy(Opal_Instance this)
 	free(ptr->application_name);
 	free(ptr->engine_name);
 
+	opal_poolShutdown(&ptr->surfaces);
+
 	free(ptr);
 	return OPAL_SUCCESS;
 }
@@ -103,6 +126,7 @@ static Opal_InstanceTable instance_vtbl =
 	null_instanceEnumerateDevices,
 
 	null_instanceCreateSurface,
+	null_instanceCreateHeadlessSurface,
 	null_instanceCreateDevice,
 	null_instanceCreateDefaultDevice,
 
@@ -129,6 +153,9 @@ Opal_Result null_opalCreateInstance(const Opal_InstanceDesc *desc, Opal_Instance
 	ptr->engine_name = strdup(desc->engine_name);
 	ptr->engine_version = desc->engine_version;
 
+	// pools
+	opal_poolInitialize(&ptr->surfaces, sizeof(Null_Surface), 4);
+
 	*instance = (Opal_Instance)ptr;
 	return OPAL_SUCCESS;
 }
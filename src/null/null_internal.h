@@ -2,6 +2,33 @@
 
 #include "opal_internal.h"
 
+#include "common/cache.h"
+#include "common/compiler.h"
+#include "common/notifier.h"
+#include "common/pacing.h"
+#include "common/pool.h"
+
+typedef enum Null_ObjectType_t
+{
+	NULL_OBJECT_TYPE_FENCE = 0,
+	NULL_OBJECT_TYPE_SAMPLER,
+	NULL_OBJECT_TYPE_ACCELERATION_STRUCTURE,
+	NULL_OBJECT_TYPE_SHADER_BINDING_TABLE,
+	NULL_OBJECT_TYPE_COMMAND_ALLOCATOR,
+	NULL_OBJECT_TYPE_COMMAND_BUFFER,
+	NULL_OBJECT_TYPE_SHADER,
+	NULL_OBJECT_TYPE_DESCRIPTOR_HEAP,
+	NULL_OBJECT_TYPE_DESCRIPTOR_SET_LAYOUT,
+	NULL_OBJECT_TYPE_DESCRIPTOR_SET,
+	NULL_OBJECT_TYPE_PIPELINE_LAYOUT,
+	NULL_OBJECT_TYPE_GRAPHICS_PIPELINE,
+	NULL_OBJECT_TYPE_COMPUTE_PIPELINE,
+	NULL_OBJECT_TYPE_RAYTRACE_PIPELINE,
+
+	NULL_OBJECT_TYPE_ENUM_MAX,
+	NULL_OBJECT_TYPE_ENUM_FORCE32 = 0x7FFFFFFF,
+} Null_ObjectType;
+
 typedef struct Null_Instance_t
 {
 	Opal_InstanceTable *vtbl;
@@ -9,14 +36,88 @@ typedef struct Null_Instance_t
 	uint32_t application_version;
 	char *engine_name;
 	uint32_t engine_version;
+	Opal_Pool surfaces;
 } Null_Instance;
 
 typedef struct Null_Device_t
 {
 	Opal_DeviceTable *vtbl;
+	Null_Instance *instance;
 	Opal_DeviceInfo info;
 	Opal_DeviceLimits limits;
+	Opal_Queue *queue_handles[OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX];
+	Opal_Pool queues;
+	Opal_Pool semaphores;
+	Opal_Pool buffers;
+	Opal_Pool textures;
+	Opal_Pool texture_views;
+	Opal_Pool swapchains;
+	Opal_Pool objects;
+	Opal_Cache shader_cache;
+	Opal_Cache sampler_cache;
+	Opal_Cache descriptor_set_layout_cache;
+	Opal_Cache pipeline_layout_cache;
+	Opal_Compiler compiler;
+	Opal_Notifier notifier;
 } Null_Device;
 
+typedef struct Null_Queue_t
+{
+	Opal_DeviceEngineType engine_type;
+	uint32_t index;
+} Null_Queue;
+
+typedef struct Null_Semaphore_t
+{
+	uint64_t value;
+} Null_Semaphore;
+
+typedef struct Null_Buffer_t
+{
+	uint8_t *data;
+	uint64_t size;
+} Null_Buffer;
+
+typedef struct Null_Texture_t
+{
+	Opal_TextureType type;
+	Opal_TextureFormat format;
+	uint32_t width;
+	uint32_t height;
+	uint32_t depth;
+	uint32_t mip_count;
+	uint32_t layer_count;
+} Null_Texture;
+
+typedef struct Null_TextureView_t
+{
+	Opal_Texture texture;
+	uint32_t base_mip;
+	uint32_t mip_count;
+	uint32_t base_layer;
+	uint32_t layer_count;
+} Null_TextureView;
+
+typedef struct Null_Surface_t
+{
+	uint32_t width;
+	uint32_t height;
+} Null_Surface;
+
+typedef struct Null_Swapchain_t
+{
+	Opal_Texture *textures;
+	Opal_TextureView *texture_views;
+	uint32_t num_images;
+	uint32_t current_image;
+	Opal_Pacing pacing;
+} Null_Swapchain;
+
+typedef struct Null_Object_t
+{
+	Null_ObjectType type;
+	Opal_DeviceEngineType engine_type;
+} Null_Object;
+
 Opal_Result null_fillDeviceInfo(Opal_DeviceInfo *info);
 Opal_Result null_deviceInitialize(Null_Device *device_ptr, Null_Instance *instance_ptr);
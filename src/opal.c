@@ -1,6 +1,9 @@
 #include "opal_internal.h"
+#include "common/format.h"
+#include "common/texel.h"
 
 #include <assert.h>
+#include <stdlib.h>
 #include <string.h>
 
 /*
@@ -15,10 +18,40 @@ typedef struct Opal_DeviceInternal_t
 	Opal_DeviceTable *vtbl;
 } Opal_DeviceInternal;
 
+#if defined(OPAL_SINGLE_BACKEND)
+	#define OPAL_INSTANCE_CALL(INSTANCE, SLOT, FUNCTION) OPAL_BACKEND_FUNCTION(FUNCTION)
+	#define OPAL_DEVICE_CALL(DEVICE, SLOT, FUNCTION) OPAL_BACKEND_FUNCTION(FUNCTION)
+#else
+	#define OPAL_INSTANCE_CALL(INSTANCE, SLOT, FUNCTION) (opal_getInstanceVtbl(INSTANCE)->SLOT)
+	#define OPAL_DEVICE_CALL(DEVICE, SLOT, FUNCTION) (opal_getDeviceVtbl(DEVICE)->SLOT)
+
+static OPAL_INLINE const Opal_InstanceTable *opal_getInstanceVtbl(Opal_Instance instance)
+{
+	Opal_InstanceInternal *ptr = (Opal_InstanceInternal *)instance;
+	assert(ptr->vtbl);
+
+	return ptr->vtbl;
+}
+
+static OPAL_INLINE const Opal_DeviceTable *opal_getDeviceVtbl(Opal_Device device)
+{
+	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)device;
+	assert(ptr->vtbl);
+
+	return ptr->vtbl;
+}
+#endif
+
 /*
  */
-Opal_Result opalCreateInstance(Opal_Api api, const Opal_InstanceDesc *desc, Opal_Instance *instance)
+static Opal_Result opal_createBackendInstance(Opal_Api api, const Opal_InstanceDesc *desc, Opal_Instance *instance)
 {
+#if defined(OPAL_SINGLE_BACKEND)
+	if (api != OPAL_API_AUTO && api != OPAL_SINGLE_BACKEND_API)
+		return OPAL_NOT_SUPPORTED;
+
+	return OPAL_BACKEND_FUNCTION(opalCreateInstance)(desc, instance);
+#else
 	switch (api)
 	{
 		case OPAL_API_VULKAN: return vulkan_opalCreateInstance(desc, instance);
@@ -56,6 +89,85 @@ Opal_Result opalCreateInstance(Opal_Api api, const Opal_InstanceDesc *desc, Opal
 
 		default: return OPAL_NOT_SUPPORTED;
 	}
+#endif
+}
+
+#if !defined(OPAL_SINGLE_BACKEND)
+static Opal_Result opal_wrapInstance(const Opal_LayerDesc *layer, Opal_Api api, const Opal_InstanceDesc *desc, Opal_Instance *instance)
+{
+	assert(layer);
+	assert(instance);
+
+	if (layer->wrapInstance == NULL)
+		return OPAL_INVALID_LAYER;
+
+	Opal_Instance next_instance = *instance;
+
+	Opal_Result result = layer->wrapInstance(layer->user_data, api, desc, next_instance, instance);
+	if (result != OPAL_SUCCESS)
+	{
+		opalDestroyInstance(next_instance);
+		*instance = OPAL_NULL_HANDLE;
+	}
+
+	return result;
+}
+#endif
+
+/*
+ */
+Opal_Result opalCreateInstance(Opal_Api api, const Opal_InstanceDesc *desc, Opal_Instance *instance)
+{
+	Opal_Result result = opal_createBackendInstance(api, desc, instance);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	uint32_t num_layers = (desc != NULL) ? desc->num_layers : 0;
+
+#if defined(OPAL_SINGLE_BACKEND)
+	// note: entry points don't go through the vtbl, so there is nothing for layers to interpose
+	if (num_layers > 0)
+	{
+		opalDestroyInstance(*instance);
+		*instance = OPAL_NULL_HANDLE;
+		return OPAL_NOT_SUPPORTED;
+	}
+
+	return OPAL_SUCCESS;
+#else
+	// note: layers[0] is the closest one to the application, so the chain is built from the backend up
+	for (uint32_t i = num_layers; i > 0; --i)
+	{
+		assert(desc->layers);
+
+		result = opal_wrapInstance(&desc->layers[i - 1], api, desc, instance);
+		if (result != OPAL_SUCCESS)
+			return result;
+	}
+
+	const char *profile_path = getenv("OPAL_PROFILE_FILE");
+	if (profile_path != NULL && profile_path[0] != '\0')
+	{
+		Opal_LayerDesc profile_layer = {profile_opalWrapInstanceWithTrace, (void *)profile_path};
+
+		result = opal_wrapInstance(&profile_layer, api, desc, instance);
+		if (result != OPAL_SUCCESS)
+			return result;
+	}
+
+	const char *capture_path = getenv("OPAL_CAPTURE_FILE");
+	if (capture_path != NULL && capture_path[0] != '\0')
+	{
+		Opal_LayerDesc capture_layer = {0};
+		opalGetCaptureLayer(capture_path, &capture_layer);
+
+		result = opal_wrapInstance(&capture_layer, api, desc, instance);
+		if (result != OPAL_SUCCESS)
+			return result;
+	}
+
+	return OPAL_SUCCESS;
+#endif
 }
 
 Opal_Result opalGetInstanceTable(Opal_Instance instance, Opal_InstanceTable *instance_table)
@@ -88,6 +200,606 @@ Opal_Result opalGetDeviceTable(Opal_Device device, Opal_DeviceTable *device_tabl
 	return OPAL_SUCCESS;
 }
 
+Opal_Result opalGetCaptureLayer(const char *path, Opal_LayerDesc *layer)
+{
+	if (path == NULL)
+		return OPAL_INVALID_LAYER;
+
+	if (layer == NULL)
+		return OPAL_INVALID_OUTPUT_ARGUMENT;
+
+	layer->wrapInstance = capture_opalWrapInstance;
+	layer->user_data = (void *)path;
+
+	return OPAL_SUCCESS;
+}
+
+Opal_Result opalGetStateTrackingLayer(Opal_LayerDesc *layer)
+{
+	if (layer == NULL)
+		return OPAL_INVALID_OUTPUT_ARGUMENT;
+
+	layer->wrapInstance = state_opalWrapInstance;
+	layer->user_data = NULL;
+
+	return OPAL_SUCCESS;
+}
+
+Opal_Result opalGetTextureCopyLayout(const Opal_TextureDesc *desc, uint32_t row_alignment, uint64_t offset_alignment, uint32_t *num_regions, Opal_BufferTextureCopyRegion *regions, uint64_t *size)
+{
+	if (desc == NULL)
+		return OPAL_INVALID_ARGUMENT;
+
+	if (num_regions == NULL)
+		return OPAL_INVALID_OUTPUT_ARGUMENT;
+
+	return opal_formatGetCopyLayout(desc, row_alignment, offset_alignment, num_regions, regions, size);
+}
+
+/*
+ */
+Opal_Result opalTexelSwizzleRB(void *dst, const void *src, uint32_t num_texels)
+{
+	if (dst == NULL || src == NULL)
+		return OPAL_INVALID_ARGUMENT;
+
+	opal_texelSwizzleRB(dst, src, num_texels);
+	return OPAL_SUCCESS;
+}
+
+Opal_Result opalTexelSrgbToLinear(float *dst, const uint8_t *src, uint32_t num_values)
+{
+	if (dst == NULL || src == NULL)
+		return OPAL_INVALID_ARGUMENT;
+
+	opal_texelSrgbToLinear(dst, src, num_values);
+	return OPAL_SUCCESS;
+}
+
+Opal_Result opalTexelLinearToSrgb(uint8_t *dst, const float *src, uint32_t num_values)
+{
+	if (dst == NULL || src == NULL)
+		return OPAL_INVALID_ARGUMENT;
+
+	opal_texelLinearToSrgb(dst, src, num_values);
+	return OPAL_SUCCESS;
+}
+
+Opal_Result opalTexelFloatToHalf(uint16_t *dst, const float *src, uint32_t num_values)
+{
+	if (dst == NULL || src == NULL)
+		return OPAL_INVALID_ARGUMENT;
+
+	opal_texelFloatToHalf(dst, src, num_values);
+	return OPAL_SUCCESS;
+}
+
+Opal_Result opalTexelHalfToFloat(float *dst, const uint16_t *src, uint32_t num_values)
+{
+	if (dst == NULL || src == NULL)
+		return OPAL_INVALID_ARGUMENT;
+
+	opal_texelHalfToFloat(dst, src, num_values);
+	return OPAL_SUCCESS;
+}
+
+Opal_Result opalTexelPackRG11B10(uint32_t *dst, const float *src, uint32_t num_texels)
+{
+	if (dst == NULL || src == NULL)
+		return OPAL_INVALID_ARGUMENT;
+
+	opal_texelPackRG11B10(dst, src, num_texels);
+	return OPAL_SUCCESS;
+}
+
+Opal_Result opalTexelUnpackRG11B10(float *dst, const uint32_t *src, uint32_t num_texels)
+{
+	if (dst == NULL || src == NULL)
+		return OPAL_INVALID_ARGUMENT;
+
+	opal_texelUnpackRG11B10(dst, src, num_texels);
+	return OPAL_SUCCESS;
+}
+
+Opal_Result opalTexelPackRGB9E5(uint32_t *dst, const float *src, uint32_t num_texels)
+{
+	if (dst == NULL || src == NULL)
+		return OPAL_INVALID_ARGUMENT;
+
+	opal_texelPackRGB9E5(dst, src, num_texels);
+	return OPAL_SUCCESS;
+}
+
+Opal_Result opalTexelUnpackRGB9E5(float *dst, const uint32_t *src, uint32_t num_texels)
+{
+	if (dst == NULL || src == NULL)
+		return OPAL_INVALID_ARGUMENT;
+
+	opal_texelUnpackRGB9E5(dst, src, num_texels);
+	return OPAL_SUCCESS;
+}
+
+Opal_Result opalTexelDownsample(Opal_TextureFormat format, Opal_TexelFilter filter, uint32_t src_width, uint32_t src_height, uint32_t src_row_size, const void *src, uint32_t dst_row_size, void *dst)
+{
+	if (dst == NULL || src == NULL)
+		return OPAL_INVALID_ARGUMENT;
+
+	if (src_width == 0 || src_height == 0 || filter >= OPAL_TEXEL_FILTER_ENUM_MAX)
+		return OPAL_INVALID_ARGUMENT;
+
+	return opal_texelDownsample(format, filter, src_width, src_height, src_row_size, src, dst_row_size, dst);
+}
+
+/*
+ */
+Opal_Result opalCreateProfiler(const Opal_ProfilerDesc *desc, Opal_Profiler *profiler)
+{
+	if (desc == NULL)
+		return OPAL_INVALID_PROFILER;
+
+	if (profiler == NULL)
+		return OPAL_INVALID_OUTPUT_ARGUMENT;
+
+	return profile_opalCreateProfiler(desc, profiler);
+}
+
+Opal_Result opalGetProfilerLayer(Opal_Profiler profiler, Opal_LayerDesc *layer)
+{
+	if (profiler == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_PROFILER;
+
+	if (layer == NULL)
+		return OPAL_INVALID_OUTPUT_ARGUMENT;
+
+	layer->wrapInstance = profile_opalWrapInstance;
+	layer->user_data = (void *)profiler;
+
+	return OPAL_SUCCESS;
+}
+
+Opal_Result opalGetProfilerStats(Opal_Profiler profiler, uint32_t *num_stats, Opal_ProfilerCallStats *stats)
+{
+	if (profiler == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_PROFILER;
+
+	if (num_stats == NULL)
+		return OPAL_INVALID_OUTPUT_ARGUMENT;
+
+	return profile_opalGetProfilerStats(profiler, num_stats, stats);
+}
+
+Opal_Result opalResetProfilerStats(Opal_Profiler profiler)
+{
+	if (profiler == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_PROFILER;
+
+	return profile_opalResetProfilerStats(profiler);
+}
+
+Opal_Result opalWriteProfilerFrames(Opal_Profiler profiler, const char *path)
+{
+	if (profiler == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_PROFILER;
+
+	if (path == NULL)
+		return OPAL_INVALID_OUTPUT_ARGUMENT;
+
+	return profile_opalWriteProfilerFrames(profiler, path);
+}
+
+Opal_Result opalDestroyProfiler(Opal_Profiler profiler)
+{
+	if (profiler == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_PROFILER;
+
+	return profile_opalDestroyProfiler(profiler);
+}
+
+/*
+ */
+Opal_Result opalCreateUploader(Opal_Device device, const Opal_UploaderDesc *desc, Opal_Uploader *uploader)
+{
+	if (device == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_DEVICE;
+
+	if (desc == NULL)
+		return OPAL_INVALID_UPLOADER;
+
+	if (uploader == NULL)
+		return OPAL_INVALID_OUTPUT_ARGUMENT;
+
+	return upload_opalCreateUploader(device, desc, uploader);
+}
+
+Opal_Result opalUploadBuffer(Opal_Uploader uploader, Opal_Buffer buffer, uint64_t offset, const void *data, uint64_t size)
+{
+	if (uploader == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_UPLOADER;
+
+	if (buffer == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_BUFFER;
+
+	return upload_opalUploadBuffer(uploader, buffer, offset, data, size);
+}
+
+Opal_Result opalUploadTexture(Opal_Uploader uploader, Opal_TextureRegion dst, Opal_Extent3D size, const void *data, uint32_t row_size, uint32_t num_rows)
+{
+	if (uploader == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_UPLOADER;
+
+	return upload_opalUploadTexture(uploader, dst, size, data, row_size, num_rows);
+}
+
+Opal_Result opalFlushUploads(Opal_Uploader uploader, Opal_Semaphore *semaphore, uint64_t *value)
+{
+	if (uploader == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_UPLOADER;
+
+	return upload_opalFlushUploads(uploader, semaphore, value);
+}
+
+Opal_Result opalDestroyUploader(Opal_Uploader uploader)
+{
+	if (uploader == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_UPLOADER;
+
+	return upload_opalDestroyUploader(uploader);
+}
+
+/*
+ */
+Opal_Result opalCreateTransientAllocator(Opal_Device device, const Opal_TransientAllocatorDesc *desc, Opal_TransientAllocator *allocator)
+{
+	if (device == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_DEVICE;
+
+	if (desc == NULL)
+		return OPAL_INVALID_TRANSIENT_ALLOCATOR;
+
+	if (allocator == NULL)
+		return OPAL_INVALID_OUTPUT_ARGUMENT;
+
+	return upload_opalCreateTransientAllocator(device, desc, allocator);
+}
+
+Opal_Result opalGetTransientBuffer(Opal_TransientAllocator allocator, Opal_Buffer *buffer)
+{
+	if (allocator == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_TRANSIENT_ALLOCATOR;
+
+	if (buffer == NULL)
+		return OPAL_INVALID_OUTPUT_ARGUMENT;
+
+	return upload_opalGetTransientBuffer(allocator, buffer);
+}
+
+Opal_Result opalAllocateTransient(Opal_TransientAllocator allocator, uint64_t size, uint64_t alignment, Opal_TransientAllocation *allocation)
+{
+	if (allocator == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_TRANSIENT_ALLOCATOR;
+
+	if (allocation == NULL)
+		return OPAL_INVALID_OUTPUT_ARGUMENT;
+
+	return upload_opalAllocateTransient(allocator, size, alignment, allocation);
+}
+
+Opal_Result opalEndTransientFrame(Opal_TransientAllocator allocator, Opal_Semaphore semaphore, uint64_t value)
+{
+	if (allocator == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_TRANSIENT_ALLOCATOR;
+
+	if (semaphore == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_SEMAPHORE;
+
+	return upload_opalEndTransientFrame(allocator, semaphore, value);
+}
+
+Opal_Result opalDestroyTransientAllocator(Opal_TransientAllocator allocator)
+{
+	if (allocator == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_TRANSIENT_ALLOCATOR;
+
+	return upload_opalDestroyTransientAllocator(allocator);
+}
+
+/*
+ */
+Opal_Result opalCreateReadback(Opal_Device device, const Opal_ReadbackDesc *desc, Opal_Readback *readback)
+{
+	if (device == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_DEVICE;
+
+	if (desc == NULL)
+		return OPAL_INVALID_READBACK;
+
+	if (readback == NULL)
+		return OPAL_INVALID_OUTPUT_ARGUMENT;
+
+	return upload_opalCreateReadback(device, desc, readback);
+}
+
+Opal_Result opalReadbackAsync(Opal_Readback readback, Opal_CommandBuffer command_buffer, Opal_Buffer buffer, uint64_t offset, uint64_t size, PFN_opalReadbackCallback callback, void *user_data)
+{
+	if (readback == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_READBACK;
+
+	if (buffer == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_BUFFER;
+
+	return upload_opalReadbackAsync(readback, command_buffer, buffer, offset, size, callback, user_data);
+}
+
+Opal_Result opalReadbackTextureAsync(Opal_Readback readback, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_Extent3D size, uint32_t row_size, uint32_t num_rows, PFN_opalReadbackCallback callback, void *user_data)
+{
+	if (readback == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_READBACK;
+
+	return upload_opalReadbackTextureAsync(readback, command_buffer, src, size, row_size, num_rows, callback, user_data);
+}
+
+Opal_Result opalFlushReadbacks(Opal_Readback readback, Opal_Semaphore semaphore, uint64_t value)
+{
+	if (readback == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_READBACK;
+
+	if (semaphore == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_SEMAPHORE;
+
+	return upload_opalFlushReadbacks(readback, semaphore, value);
+}
+
+Opal_Result opalPollReadbacks(Opal_Readback readback)
+{
+	if (readback == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_READBACK;
+
+	return upload_opalPollReadbacks(readback);
+}
+
+Opal_Result opalDestroyReadback(Opal_Readback readback)
+{
+	if (readback == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_READBACK;
+
+	return upload_opalDestroyReadback(readback);
+}
+
+/*
+ */
+Opal_Result opalCreateCompactor(Opal_Device device, const Opal_CompactorDesc *desc, Opal_Compactor *compactor)
+{
+	if (device == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_DEVICE;
+
+	if (desc == NULL || desc->type >= OPAL_ACCELERATION_STRUCTURE_TYPE_ENUM_MAX)
+		return OPAL_INVALID_ARGUMENT;
+
+	if (compactor == NULL)
+		return OPAL_INVALID_OUTPUT_ARGUMENT;
+
+	return upload_opalCreateCompactor(device, desc, compactor);
+}
+
+Opal_Result opalCompactAccelerationStructures(Opal_Compactor compactor, Opal_CommandBuffer command_buffer, uint32_t num_acceleration_structures, const Opal_AccelerationStructure *acceleration_structures, PFN_opalCompactionCallback callback, void *user_data)
+{
+	if (compactor == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_COMPACTOR;
+
+	if (num_acceleration_structures == 0)
+		return OPAL_SUCCESS;
+
+	return upload_opalCompactAccelerationStructures(compactor, command_buffer, num_acceleration_structures, acceleration_structures, callback, user_data);
+}
+
+Opal_Result opalFlushCompactions(Opal_Compactor compactor, Opal_Semaphore semaphore, uint64_t value)
+{
+	if (compactor == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_COMPACTOR;
+
+	if (semaphore == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_SEMAPHORE;
+
+	return upload_opalFlushCompactions(compactor, semaphore, value);
+}
+
+Opal_Result opalPollCompactions(Opal_Compactor compactor, Opal_CommandBuffer command_buffer)
+{
+	if (compactor == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_COMPACTOR;
+
+	return upload_opalPollCompactions(compactor, command_buffer);
+}
+
+Opal_Result opalDestroyCompactor(Opal_Compactor compactor)
+{
+	if (compactor == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_COMPACTOR;
+
+	return upload_opalDestroyCompactor(compactor);
+}
+
+/*
+ */
+Opal_Result opalCreateGraph(Opal_Device device, Opal_Graph *graph)
+{
+	if (device == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_DEVICE;
+
+	if (graph == NULL)
+		return OPAL_INVALID_OUTPUT_ARGUMENT;
+
+	return graph_opalCreateGraph(device, graph);
+}
+
+Opal_Result opalResetGraph(Opal_Graph graph)
+{
+	if (graph == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_GRAPH;
+
+	return graph_opalResetGraph(graph);
+}
+
+Opal_Result opalImportGraphBuffer(Opal_Graph graph, Opal_Buffer buffer, Opal_BufferState initial_state, Opal_BufferState final_state, Opal_GraphResource *resource)
+{
+	if (graph == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_GRAPH;
+
+	if (buffer == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_BUFFER;
+
+	if (resource == NULL)
+		return OPAL_INVALID_OUTPUT_ARGUMENT;
+
+	return graph_opalImportGraphBuffer(graph, buffer, initial_state, final_state, resource);
+}
+
+Opal_Result opalImportGraphTexture(Opal_Graph graph, Opal_TextureView texture_view, Opal_TextureState initial_state, Opal_TextureState final_state, Opal_GraphResource *resource)
+{
+	if (graph == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_GRAPH;
+
+	if (texture_view == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_TEXTURE_VIEW;
+
+	if (resource == NULL)
+		return OPAL_INVALID_OUTPUT_ARGUMENT;
+
+	return graph_opalImportGraphTexture(graph, texture_view, initial_state, final_state, resource);
+}
+
+Opal_Result opalCreateGraphBuffer(Opal_Graph graph, const Opal_BufferDesc *desc, Opal_GraphResource *resource)
+{
+	if (graph == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_GRAPH;
+
+	if (desc == NULL)
+		return OPAL_INVALID_ARGUMENT;
+
+	if (resource == NULL)
+		return OPAL_INVALID_OUTPUT_ARGUMENT;
+
+	return graph_opalCreateGraphBuffer(graph, desc, resource);
+}
+
+Opal_Result opalCreateGraphTexture(Opal_Graph graph, const Opal_TextureDesc *desc, Opal_GraphResource *resource)
+{
+	if (graph == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_GRAPH;
+
+	if (desc == NULL)
+		return OPAL_INVALID_ARGUMENT;
+
+	if (resource == NULL)
+		return OPAL_INVALID_OUTPUT_ARGUMENT;
+
+	return graph_opalCreateGraphTexture(graph, desc, resource);
+}
+
+Opal_Result opalAddGraphPass(Opal_Graph graph, const Opal_GraphPassDesc *desc)
+{
+	if (graph == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_GRAPH;
+
+	if (desc == NULL)
+		return OPAL_INVALID_ARGUMENT;
+
+	return graph_opalAddGraphPass(graph, desc);
+}
+
+Opal_Result opalGetGraphBuffer(Opal_Graph graph, Opal_GraphResource resource, Opal_Buffer *buffer)
+{
+	if (graph == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_GRAPH;
+
+	if (buffer == NULL)
+		return OPAL_INVALID_OUTPUT_ARGUMENT;
+
+	return graph_opalGetGraphBuffer(graph, resource, buffer);
+}
+
+Opal_Result opalGetGraphTextureView(Opal_Graph graph, Opal_GraphResource resource, Opal_TextureView *texture_view)
+{
+	if (graph == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_GRAPH;
+
+	if (texture_view == NULL)
+		return OPAL_INVALID_OUTPUT_ARGUMENT;
+
+	return graph_opalGetGraphTextureView(graph, resource, texture_view);
+}
+
+Opal_Result opalExecuteGraph(Opal_Graph graph, Opal_CommandBuffer command_buffer)
+{
+	if (graph == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_GRAPH;
+
+	if (command_buffer == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_COMMAND_BUFFER;
+
+	return graph_opalExecuteGraph(graph, command_buffer);
+}
+
+Opal_Result opalDestroyGraph(Opal_Graph graph)
+{
+	if (graph == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_GRAPH;
+
+	return graph_opalDestroyGraph(graph);
+}
+
+/*
+ */
+Opal_Result opalCreateScheduler(Opal_Device device, Opal_Scheduler *scheduler)
+{
+	if (device == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_DEVICE;
+
+	if (scheduler == NULL)
+		return OPAL_INVALID_OUTPUT_ARGUMENT;
+
+	return schedule_opalCreateScheduler(device, scheduler);
+}
+
+Opal_Result opalGetSchedulerQueue(Opal_Scheduler scheduler, Opal_DeviceEngineType engine_type, Opal_Queue *queue)
+{
+	if (scheduler == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_SCHEDULER;
+
+	if (engine_type >= OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX)
+		return OPAL_INVALID_QUEUE_TYPE;
+
+	if (queue == NULL)
+		return OPAL_INVALID_OUTPUT_ARGUMENT;
+
+	return schedule_opalGetSchedulerQueue(scheduler, engine_type, queue);
+}
+
+Opal_Result opalSchedule(Opal_Scheduler scheduler, const Opal_ScheduleDesc *desc, Opal_Semaphore *semaphore, uint64_t *value)
+{
+	if (scheduler == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_SCHEDULER;
+
+	if (desc == NULL)
+		return OPAL_INVALID_SCHEDULER;
+
+	if (desc->engine_type >= OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX)
+		return OPAL_INVALID_QUEUE_TYPE;
+
+	if (semaphore == NULL || value == NULL)
+		return OPAL_INVALID_OUTPUT_ARGUMENT;
+
+	return schedule_opalSchedule(scheduler, desc, semaphore, value);
+}
+
+Opal_Result opalDestroyScheduler(Opal_Scheduler scheduler)
+{
+	if (scheduler == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_SCHEDULER;
+
+	return schedule_opalDestroyScheduler(scheduler);
+}
+
 /*
  */
 Opal_Result opalEnumerateDevices(Opal_Instance instance, uint32_t *device_count, Opal_DeviceInfo *infos)
@@ -95,11 +807,7 @@ Opal_Result opalEnumerateDevices(Opal_Instance instance, uint32_t *device_count,
 	if (instance == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_INSTANCE;
 
-	Opal_InstanceInternal *ptr = (Opal_InstanceInternal *)instance;
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->enumerateDevices);
-
-	return ptr->vtbl->enumerateDevices(instance, device_count, infos);
+	return OPAL_INSTANCE_CALL(instance, enumerateDevices, instanceEnumerateDevices)(instance, device_count, infos);
 }
 
 /*
@@ -109,11 +817,15 @@ Opal_Result opalCreateSurface(Opal_Instance instance, void *handle, Opal_Surface
 	if (instance == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_INSTANCE;
 
-	Opal_InstanceInternal *ptr = (Opal_InstanceInternal *)instance;
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->createSurface);
+	return OPAL_INSTANCE_CALL(instance, createSurface, instanceCreateSurface)(instance, handle, surface);
+}
 
-	return ptr->vtbl->createSurface(instance, handle, surface);
+Opal_Result opalCreateHeadlessSurface(Opal_Instance instance, uint32_t width, uint32_t height, Opal_Surface *surface)
+{
+	if (instance == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_INSTANCE;
+
+	return OPAL_INSTANCE_CALL(instance, createHeadlessSurface, instanceCreateHeadlessSurface)(instance, width, height, surface);
 }
 
 Opal_Result opalCreateDevice(Opal_Instance instance, uint32_t index, Opal_Device *device)
@@ -121,11 +833,7 @@ Opal_Result opalCreateDevice(Opal_Instance instance, uint32_t index, Opal_Device
 	if (instance == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_INSTANCE;
 
-	Opal_InstanceInternal *ptr = (Opal_InstanceInternal *)instance;
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->createDevice);
-
-	return ptr->vtbl->createDevice(instance, index, device);
+	return OPAL_INSTANCE_CALL(instance, createDevice, instanceCreateDevice)(instance, index, device);
 }
 
 Opal_Result opalCreateDefaultDevice(Opal_Instance instance, Opal_DeviceHint hint, Opal_Device *device)
@@ -133,11 +841,7 @@ Opal_Result opalCreateDefaultDevice(Opal_Instance instance, Opal_DeviceHint hint
 	if (instance == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_INSTANCE;
 
-	Opal_InstanceInternal *ptr = (Opal_InstanceInternal *)instance;
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->createDefaultDevice);
-
-	return ptr->vtbl->createDefaultDevice(instance, hint, device);
+	return OPAL_INSTANCE_CALL(instance, createDefaultDevice, instanceCreateDefaultDevice)(instance, hint, device);
 }
 
 /*
@@ -147,11 +851,7 @@ Opal_Result opalDestroySurface(Opal_Instance instance, Opal_Surface surface)
 	if (instance == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_INSTANCE;
 
-	Opal_InstanceInternal *ptr = (Opal_InstanceInternal *)instance;
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->destroySurface);
-
-	return ptr->vtbl->destroySurface(instance, surface);
+	return OPAL_INSTANCE_CALL(instance, destroySurface, instanceDestroySurface)(instance, surface);
 }
 
 Opal_Result opalDestroyInstance(Opal_Instance instance)
@@ -159,11 +859,7 @@ Opal_Result opalDestroyInstance(Opal_Instance instance)
 	if (instance == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_INSTANCE;
 
-	Opal_InstanceInternal *ptr = (Opal_InstanceInternal *)instance;
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->destroyInstance);
-
-	return ptr->vtbl->destroyInstance(instance);
+	return OPAL_INSTANCE_CALL(instance, destroyInstance, instanceDestroy)(instance);
 }
 
 /*
@@ -173,11 +869,7 @@ Opal_Result opalGetDeviceInfo(Opal_Device device, Opal_DeviceInfo *info)
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->getDeviceInfo);
-
-	return ptr->vtbl->getDeviceInfo(device, info);
+	return OPAL_DEVICE_CALL(device, getDeviceInfo, deviceGetInfo)(device, info);
 }
 
 Opal_Result opalGetDeviceQueue(Opal_Device device, Opal_DeviceEngineType engine_type, uint32_t index, Opal_Queue *queue)
@@ -185,11 +877,7 @@ Opal_Result opalGetDeviceQueue(Opal_Device device, Opal_DeviceEngineType engine_
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->getDeviceQueue);
-
-	return ptr->vtbl->getDeviceQueue(device, engine_type, index, queue);
+	return OPAL_DEVICE_CALL(device, getDeviceQueue, deviceGetQueue)(device, engine_type, index, queue);
 }
 
 Opal_Result opalGetAccelerationStructurePrebuildInfo(Opal_Device device, const Opal_AccelerationStructureBuildDesc *desc, Opal_AccelerationStructurePrebuildInfo *info)
@@ -197,11 +885,15 @@ Opal_Result opalGetAccelerationStructurePrebuildInfo(Opal_Device device, const O
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->getAccelerationStructurePrebuildInfo);
+	return OPAL_DEVICE_CALL(device, getAccelerationStructurePrebuildInfo, deviceGetAccelerationStructurePrebuildInfo)(device, desc, info);
+}
+
+Opal_Result opalGetAccelerationStructureAddress(Opal_Device device, Opal_AccelerationStructure acceleration_structure, uint64_t *address)
+{
+	if (device == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_DEVICE;
 
-	return ptr->vtbl->getAccelerationStructurePrebuildInfo(device, desc, info);
+	return OPAL_DEVICE_CALL(device, getAccelerationStructureAddress, deviceGetAccelerationStructureAddress)(device, acceleration_structure, address);
 }
 
 Opal_Result opalGetSupportedSurfaceFormats(Opal_Device device, Opal_Surface surface, uint32_t *num_formats, Opal_SurfaceFormat *formats)
@@ -209,11 +901,7 @@ Opal_Result opalGetSupportedSurfaceFormats(Opal_Device device, Opal_Surface surf
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->getSupportedSurfaceFormats);
-
-	return ptr->vtbl->getSupportedSurfaceFormats(device, surface, num_formats, formats);
+	return OPAL_DEVICE_CALL(device, getSupportedSurfaceFormats, deviceGetSupportedSurfaceFormats)(device, surface, num_formats, formats);
 }
 
 Opal_Result opalGetSupportedPresentModes(Opal_Device device, Opal_Surface surface, uint32_t *num_present_modes, Opal_PresentMode *present_modes)
@@ -221,11 +909,7 @@ Opal_Result opalGetSupportedPresentModes(Opal_Device device, Opal_Surface surfac
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->getSupportedPresentModes);
-
-	return ptr->vtbl->getSupportedPresentModes(device, surface, num_present_modes, present_modes);
+	return OPAL_DEVICE_CALL(device, getSupportedPresentModes, deviceGetSupportedPresentModes)(device, surface, num_present_modes, present_modes);
 }
 
 Opal_Result opalGetPreferredSurfaceFormat(Opal_Device device, Opal_Surface surface, Opal_SurfaceFormat *format)
@@ -233,11 +917,7 @@ Opal_Result opalGetPreferredSurfaceFormat(Opal_Device device, Opal_Surface surfa
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->getPreferredSurfaceFormat);
-
-	return ptr->vtbl->getPreferredSurfaceFormat(device, surface, format);
+	return OPAL_DEVICE_CALL(device, getPreferredSurfaceFormat, deviceGetPreferredSurfaceFormat)(device, surface, format);
 }
 
 Opal_Result opalGetPreferredSurfacePresentMode(Opal_Device device, Opal_Surface surface, Opal_PresentMode *present_mode)
@@ -245,11 +925,7 @@ Opal_Result opalGetPreferredSurfacePresentMode(Opal_Device device, Opal_Surface
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->getPreferredSurfacePresentMode);
-
-	return ptr->vtbl->getPreferredSurfacePresentMode(device, surface, present_mode);
+	return OPAL_DEVICE_CALL(device, getPreferredSurfacePresentMode, deviceGetPreferredSurfacePresentMode)(device, surface, present_mode);
 }
 
 /*
@@ -259,11 +935,7 @@ Opal_Result opalCreateSemaphore(Opal_Device device, const Opal_SemaphoreDesc *de
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->createSemaphore);
-
-	return ptr->vtbl->createSemaphore(device, desc, semaphore);
+	return OPAL_DEVICE_CALL(device, createSemaphore, deviceCreateSemaphore)(device, desc, semaphore);
 }
 
 Opal_Result opalCreateFence(Opal_Device device, Opal_Fence *fence)
@@ -271,11 +943,7 @@ Opal_Result opalCreateFence(Opal_Device device, Opal_Fence *fence)
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->createFence);
-
-	return ptr->vtbl->createFence(device, fence);
+	return OPAL_DEVICE_CALL(device, createFence, deviceCreateFence)(device, fence);
 }
 
 Opal_Result opalCreateBuffer(Opal_Device device, const Opal_BufferDesc *desc, Opal_Buffer *buffer)
@@ -283,11 +951,7 @@ Opal_Result opalCreateBuffer(Opal_Device device, const Opal_BufferDesc *desc, Op
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->createBuffer);
-
-	return ptr->vtbl->createBuffer(device, desc, buffer);
+	return OPAL_DEVICE_CALL(device, createBuffer, deviceCreateBuffer)(device, desc, buffer);
 }
 
 Opal_Result opalCreateTexture(Opal_Device device, const Opal_TextureDesc *desc, Opal_Texture *texture)
@@ -295,11 +959,7 @@ Opal_Result opalCreateTexture(Opal_Device device, const Opal_TextureDesc *desc,
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->createTexture);
-
-	return ptr->vtbl->createTexture(device, desc, texture);
+	return OPAL_DEVICE_CALL(device, createTexture, deviceCreateTexture)(device, desc, texture);
 }
 
 Opal_Result opalCreateTextureView(Opal_Device device, const Opal_TextureViewDesc *desc, Opal_TextureView *texture_view)
@@ -307,11 +967,7 @@ Opal_Result opalCreateTextureView(Opal_Device device, const Opal_TextureViewDesc
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->createTextureView);
-
-	return ptr->vtbl->createTextureView(device, desc, texture_view);
+	return OPAL_DEVICE_CALL(device, createTextureView, deviceCreateTextureView)(device, desc, texture_view);
 }
 
 Opal_Result opalCreateSampler(Opal_Device device, const Opal_SamplerDesc *desc, Opal_Sampler *sampler)
@@ -319,11 +975,7 @@ Opal_Result opalCreateSampler(Opal_Device device, const Opal_SamplerDesc *desc,
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->createSampler);
-
-	return ptr->vtbl->createSampler(device, desc, sampler);
+	return OPAL_DEVICE_CALL(device, createSampler, deviceCreateSampler)(device, desc, sampler);
 }
 
 Opal_Result opalCreateAccelerationStructure(Opal_Device device, const Opal_AccelerationStructureDesc *desc, Opal_AccelerationStructure *acceleration_structure)
@@ -331,11 +983,7 @@ Opal_Result opalCreateAccelerationStructure(Opal_Device device, const Opal_Accel
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->createAccelerationStructure);
-
-	return ptr->vtbl->createAccelerationStructure(device, desc, acceleration_structure);
+	return OPAL_DEVICE_CALL(device, createAccelerationStructure, deviceCreateAccelerationStructure)(device, desc, acceleration_structure);
 }
 
 Opal_Result opalCreateShaderBindingTable(Opal_Device device, Opal_RaytracePipeline pipeline, Opal_ShaderBindingTable *shader_binding_table)
@@ -343,11 +991,7 @@ Opal_Result opalCreateShaderBindingTable(Opal_Device device, Opal_RaytracePipeli
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->createShaderBindingTable);
-
-	return ptr->vtbl->createShaderBindingTable(device, pipeline, shader_binding_table);
+	return OPAL_DEVICE_CALL(device, createShaderBindingTable, deviceCreateShaderBindingTable)(device, pipeline, shader_binding_table);
 }
 
 Opal_Result opalCreateCommandAllocator(Opal_Device device, Opal_Queue queue, Opal_CommandAllocator *command_allocator)
@@ -355,11 +999,7 @@ Opal_Result opalCreateCommandAllocator(Opal_Device device, Opal_Queue queue, Opa
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->createCommandAllocator);
-
-	return ptr->vtbl->createCommandAllocator(device, queue, command_allocator);
+	return OPAL_DEVICE_CALL(device, createCommandAllocator, deviceCreateCommandAllocator)(device, queue, command_allocator);
 }
 
 Opal_Result opalCreateCommandBuffer(Opal_Device device, Opal_CommandAllocator command_allocator, Opal_CommandBuffer *command_buffer)
@@ -367,11 +1007,7 @@ Opal_Result opalCreateCommandBuffer(Opal_Device device, Opal_CommandAllocator co
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->createCommandBuffer);
-
-	return ptr->vtbl->createCommandBuffer(device, command_allocator, command_buffer);
+	return OPAL_DEVICE_CALL(device, createCommandBuffer, deviceCreateCommandBuffer)(device, command_allocator, command_buffer);
 }
 
 Opal_Result opalCreateShader(Opal_Device device, const Opal_ShaderDesc *desc, Opal_Shader *shader)
@@ -379,11 +1015,7 @@ Opal_Result opalCreateShader(Opal_Device device, const Opal_ShaderDesc *desc, Op
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->createShader);
-
-	return ptr->vtbl->createShader(device, desc, shader);
+	return OPAL_DEVICE_CALL(device, createShader, deviceCreateShader)(device, desc, shader);
 }
 
 Opal_Result opalCreateDescriptorHeap(Opal_Device device, const Opal_DescriptorHeapDesc *desc, Opal_DescriptorHeap *descriptor_buffer)
@@ -391,11 +1023,7 @@ Opal_Result opalCreateDescriptorHeap(Opal_Device device, const Opal_DescriptorHe
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->createDescriptorHeap);
-
-	return ptr->vtbl->createDescriptorHeap(device, desc, descriptor_buffer);
+	return OPAL_DEVICE_CALL(device, createDescriptorHeap, deviceCreateDescriptorHeap)(device, desc, descriptor_buffer);
 }
 
 Opal_Result opalCreateDescriptorSetLayout(Opal_Device device, uint32_t num_entries, const Opal_DescriptorSetLayoutEntry *entries, Opal_DescriptorSetLayout *descriptor_set_layout)
@@ -403,11 +1031,7 @@ Opal_Result opalCreateDescriptorSetLayout(Opal_Device device, uint32_t num_entri
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->createDescriptorSetLayout);
-
-	return ptr->vtbl->createDescriptorSetLayout(device, num_entries, entries, descriptor_set_layout);
+	return OPAL_DEVICE_CALL(device, createDescriptorSetLayout, deviceCreateDescriptorSetLayout)(device, num_entries, entries, descriptor_set_layout);
 }
 
 Opal_Result opalCreatePipelineLayout(Opal_Device device, uint32_t num_descriptor_set_layouts, const Opal_DescriptorSetLayout *descriptor_set_layouts, Opal_PipelineLayout *pipeline_layout)
@@ -415,11 +1039,7 @@ Opal_Result opalCreatePipelineLayout(Opal_Device device, uint32_t num_descriptor
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->createPipelineLayout);
-
-	return ptr->vtbl->createPipelineLayout(device, num_descriptor_set_layouts, descriptor_set_layouts, pipeline_layout);
+	return OPAL_DEVICE_CALL(device, createPipelineLayout, deviceCreatePipelineLayout)(device, num_descriptor_set_layouts, descriptor_set_layouts, pipeline_layout);
 }
 
 Opal_Result opalCreateGraphicsPipeline(Opal_Device device, const Opal_GraphicsPipelineDesc *desc, Opal_GraphicsPipeline *pipeline)
@@ -427,47 +1047,79 @@ Opal_Result opalCreateGraphicsPipeline(Opal_Device device, const Opal_GraphicsPi
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->createGraphicsPipeline);
-
-	return ptr->vtbl->createGraphicsPipeline(device, desc, pipeline);
+	return OPAL_DEVICE_CALL(device, createGraphicsPipeline, deviceCreateGraphicsPipeline)(device, desc, pipeline);
+}
+
+Opal_Result opalCreateMeshletPipeline(Opal_Device device, const Opal_MeshletPipelineDesc *desc, Opal_GraphicsPipeline *pipeline)
+{
+	if (device == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_DEVICE;
+
+	return OPAL_DEVICE_CALL(device, createMeshletPipeline, deviceCreateMeshletPipeline)(device, desc, pipeline);
+}
+
+Opal_Result opalCreateComputePipeline(Opal_Device device, const Opal_ComputePipelineDesc *desc, Opal_ComputePipeline *pipeline)
+{
+	if (device == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_DEVICE;
+
+	return OPAL_DEVICE_CALL(device, createComputePipeline, deviceCreateComputePipeline)(device, desc, pipeline);
+}
+
+Opal_Result opalCreateRaytracePipeline(Opal_Device device, const Opal_RaytracePipelineDesc *desc, Opal_RaytracePipeline *pipeline)
+{
+	if (device == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_DEVICE;
+
+	return OPAL_DEVICE_CALL(device, createRaytracePipeline, deviceCreateRaytracePipeline)(device, desc, pipeline);
+}
+
+Opal_Result opalCreateGraphicsPipelines(Opal_Device device, uint32_t num_pipelines, const Opal_GraphicsPipelineDesc *descs, Opal_GraphicsPipeline *pipelines)
+{
+	if (device == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_DEVICE;
+
+	return OPAL_DEVICE_CALL(device, createGraphicsPipelines, deviceCreateGraphicsPipelines)(device, num_pipelines, descs, pipelines);
+}
+
+Opal_Result opalCreateComputePipelines(Opal_Device device, uint32_t num_pipelines, const Opal_ComputePipelineDesc *descs, Opal_ComputePipeline *pipelines)
+{
+	if (device == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_DEVICE;
+
+	return OPAL_DEVICE_CALL(device, createComputePipelines, deviceCreateComputePipelines)(device, num_pipelines, descs, pipelines);
+}
+
+Opal_Result opalCreateRaytracePipelines(Opal_Device device, uint32_t num_pipelines, const Opal_RaytracePipelineDesc *descs, Opal_RaytracePipeline *pipelines)
+{
+	if (device == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_DEVICE;
+
+	return OPAL_DEVICE_CALL(device, createRaytracePipelines, deviceCreateRaytracePipelines)(device, num_pipelines, descs, pipelines);
 }
 
-Opal_Result opalCreateMeshletPipeline(Opal_Device device, const Opal_MeshletPipelineDesc *desc, Opal_GraphicsPipeline *pipeline)
+Opal_Result opalCreateGraphicsPipelinesAsync(Opal_Device device, uint32_t num_pipelines, const Opal_GraphicsPipelineDesc *descs, Opal_GraphicsPipeline *pipelines, Opal_PipelineTask *task)
 {
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->createMeshletPipeline);
-
-	return ptr->vtbl->createMeshletPipeline(device, desc, pipeline);
+	return OPAL_DEVICE_CALL(device, createGraphicsPipelinesAsync, deviceCreateGraphicsPipelinesAsync)(device, num_pipelines, descs, pipelines, task);
 }
 
-Opal_Result opalCreateComputePipeline(Opal_Device device, const Opal_ComputePipelineDesc *desc, Opal_ComputePipeline *pipeline)
+Opal_Result opalCreateComputePipelinesAsync(Opal_Device device, uint32_t num_pipelines, const Opal_ComputePipelineDesc *descs, Opal_ComputePipeline *pipelines, Opal_PipelineTask *task)
 {
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->createComputePipeline);
-
-	return ptr->vtbl->createComputePipeline(device, desc, pipeline);
+	return OPAL_DEVICE_CALL(device, createComputePipelinesAsync, deviceCreateComputePipelinesAsync)(device, num_pipelines, descs, pipelines, task);
 }
 
-Opal_Result opalCreateRaytracePipeline(Opal_Device device, const Opal_RaytracePipelineDesc *desc, Opal_RaytracePipeline *pipeline)
+Opal_Result opalCreateRaytracePipelinesAsync(Opal_Device device, uint32_t num_pipelines, const Opal_RaytracePipelineDesc *descs, Opal_RaytracePipeline *pipelines, Opal_PipelineTask *task)
 {
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->createRaytracePipeline);
-
-	return ptr->vtbl->createRaytracePipeline(device, desc, pipeline);
+	return OPAL_DEVICE_CALL(device, createRaytracePipelinesAsync, deviceCreateRaytracePipelinesAsync)(device, num_pipelines, descs, pipelines, task);
 }
 
 Opal_Result opalCreateSwapchain(Opal_Device device, const Opal_SwapchainDesc *desc, Opal_Swapchain *swapchain)
@@ -475,11 +1127,7 @@ Opal_Result opalCreateSwapchain(Opal_Device device, const Opal_SwapchainDesc *de
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->createSwapchain);
-
-	return ptr->vtbl->createSwapchain(device, desc, swapchain);
+	return OPAL_DEVICE_CALL(device, createSwapchain, deviceCreateSwapchain)(device, desc, swapchain);
 }
 
 /*
@@ -489,11 +1137,7 @@ Opal_Result opalDestroySemaphore(Opal_Device device, Opal_Semaphore semaphore)
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->destroySemaphore);
-
-	return ptr->vtbl->destroySemaphore(device, semaphore);
+	return OPAL_DEVICE_CALL(device, destroySemaphore, deviceDestroySemaphore)(device, semaphore);
 }
 
 Opal_Result opalDestroyFence(Opal_Device device, Opal_Fence fence)
@@ -501,11 +1145,7 @@ Opal_Result opalDestroyFence(Opal_Device device, Opal_Fence fence)
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->destroyFence);
-
-	return ptr->vtbl->destroyFence(device, fence);
+	return OPAL_DEVICE_CALL(device, destroyFence, deviceDestroyFence)(device, fence);
 }
 
 Opal_Result opalDestroyBuffer(Opal_Device device, Opal_Buffer buffer)
@@ -513,11 +1153,7 @@ Opal_Result opalDestroyBuffer(Opal_Device device, Opal_Buffer buffer)
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->destroyBuffer);
-
-	return ptr->vtbl->destroyBuffer(device, buffer);
+	return OPAL_DEVICE_CALL(device, destroyBuffer, deviceDestroyBuffer)(device, buffer);
 }
 
 Opal_Result opalDestroyTexture(Opal_Device device, Opal_Texture texture)
@@ -525,11 +1161,7 @@ Opal_Result opalDestroyTexture(Opal_Device device, Opal_Texture texture)
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->destroyTexture);
-
-	return ptr->vtbl->destroyTexture(device, texture);
+	return OPAL_DEVICE_CALL(device, destroyTexture, deviceDestroyTexture)(device, texture);
 }
 
 Opal_Result opalDestroyTextureView(Opal_Device device, Opal_TextureView texture_view)
@@ -537,11 +1169,7 @@ Opal_Result opalDestroyTextureView(Opal_Device device, Opal_TextureView texture_
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->destroyTextureView);
-
-	return ptr->vtbl->destroyTextureView(device, texture_view);
+	return OPAL_DEVICE_CALL(device, destroyTextureView, deviceDestroyTextureView)(device, texture_view);
 }
 
 Opal_Result opalDestroySampler(Opal_Device device, Opal_Sampler sampler)
@@ -549,11 +1177,7 @@ Opal_Result opalDestroySampler(Opal_Device device, Opal_Sampler sampler)
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->destroySampler);
-
-	return ptr->vtbl->destroySampler(device, sampler);
+	return OPAL_DEVICE_CALL(device, destroySampler, deviceDestroySampler)(device, sampler);
 }
 
 Opal_Result opalDestroyAccelerationStructure(Opal_Device device, Opal_AccelerationStructure acceleration_structure)
@@ -561,11 +1185,7 @@ Opal_Result opalDestroyAccelerationStructure(Opal_Device device, Opal_Accelerati
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->destroyAccelerationStructure);
-
-	return ptr->vtbl->destroyAccelerationStructure(device, acceleration_structure);
+	return OPAL_DEVICE_CALL(device, destroyAccelerationStructure, deviceDestroyAccelerationStructure)(device, acceleration_structure);
 }
 
 Opal_Result opalDestroyShaderBindingTable(Opal_Device device, Opal_ShaderBindingTable shader_binding_table)
@@ -573,11 +1193,7 @@ Opal_Result opalDestroyShaderBindingTable(Opal_Device device, Opal_ShaderBinding
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->destroyShaderBindingTable);
-
-	return ptr->vtbl->destroyShaderBindingTable(device, shader_binding_table);
+	return OPAL_DEVICE_CALL(device, destroyShaderBindingTable, deviceDestroyShaderBindingTable)(device, shader_binding_table);
 }
 
 Opal_Result opalDestroyCommandAllocator(Opal_Device device, Opal_CommandAllocator command_allocator)
@@ -585,11 +1201,7 @@ Opal_Result opalDestroyCommandAllocator(Opal_Device device, Opal_CommandAllocato
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->destroyCommandAllocator);
-
-	return ptr->vtbl->destroyCommandAllocator(device, command_allocator);
+	return OPAL_DEVICE_CALL(device, destroyCommandAllocator, deviceDestroyCommandAllocator)(device, command_allocator);
 }
 
 Opal_Result opalDestroyCommandBuffer(Opal_Device device, Opal_CommandBuffer command_buffer)
@@ -597,11 +1209,7 @@ Opal_Result opalDestroyCommandBuffer(Opal_Device device, Opal_CommandBuffer comm
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->destroyCommandBuffer);
-
-	return ptr->vtbl->destroyCommandBuffer(device, command_buffer);
+	return OPAL_DEVICE_CALL(device, destroyCommandBuffer, deviceDestroyCommandBuffer)(device, command_buffer);
 }
 
 Opal_Result opalDestroyShader(Opal_Device device, Opal_Shader shader)
@@ -609,11 +1217,7 @@ Opal_Result opalDestroyShader(Opal_Device device, Opal_Shader shader)
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->destroyShader);
-
-	return ptr->vtbl->destroyShader(device, shader);
+	return OPAL_DEVICE_CALL(device, destroyShader, deviceDestroyShader)(device, shader);
 }
 
 Opal_Result opalDestroyDescriptorHeap(Opal_Device device, Opal_DescriptorHeap descriptor_buffer)
@@ -621,11 +1225,7 @@ Opal_Result opalDestroyDescriptorHeap(Opal_Device device, Opal_DescriptorHeap de
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->destroyDescriptorHeap);
-
-	return ptr->vtbl->destroyDescriptorHeap(device, descriptor_buffer);
+	return OPAL_DEVICE_CALL(device, destroyDescriptorHeap, deviceDestroyDescriptorHeap)(device, descriptor_buffer);
 }
 
 Opal_Result opalDestroyDescriptorSetLayout(Opal_Device device, Opal_DescriptorSetLayout descriptor_set_layout)
@@ -633,11 +1233,7 @@ Opal_Result opalDestroyDescriptorSetLayout(Opal_Device device, Opal_DescriptorSe
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->destroyDescriptorSetLayout);
-
-	return ptr->vtbl->destroyDescriptorSetLayout(device, descriptor_set_layout);
+	return OPAL_DEVICE_CALL(device, destroyDescriptorSetLayout, deviceDestroyDescriptorSetLayout)(device, descriptor_set_layout);
 }
 
 Opal_Result opalDestroyPipelineLayout(Opal_Device device, Opal_PipelineLayout pipeline_layout)
@@ -645,11 +1241,7 @@ Opal_Result opalDestroyPipelineLayout(Opal_Device device, Opal_PipelineLayout pi
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->destroyPipelineLayout);
-
-	return ptr->vtbl->destroyPipelineLayout(device, pipeline_layout);
+	return OPAL_DEVICE_CALL(device, destroyPipelineLayout, deviceDestroyPipelineLayout)(device, pipeline_layout);
 }
 
 Opal_Result opalDestroyGraphicsPipeline(Opal_Device device, Opal_GraphicsPipeline pipeline)
@@ -657,11 +1249,7 @@ Opal_Result opalDestroyGraphicsPipeline(Opal_Device device, Opal_GraphicsPipelin
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->destroyGraphicsPipeline);
-
-	return ptr->vtbl->destroyGraphicsPipeline(device, pipeline);
+	return OPAL_DEVICE_CALL(device, destroyGraphicsPipeline, deviceDestroyGraphicsPipeline)(device, pipeline);
 }
 
 Opal_Result opalDestroyComputePipeline(Opal_Device device, Opal_ComputePipeline pipeline)
@@ -669,11 +1257,7 @@ Opal_Result opalDestroyComputePipeline(Opal_Device device, Opal_ComputePipeline
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->destroyComputePipeline);
-
-	return ptr->vtbl->destroyComputePipeline(device, pipeline);
+	return OPAL_DEVICE_CALL(device, destroyComputePipeline, deviceDestroyComputePipeline)(device, pipeline);
 }
 
 Opal_Result opalDestroyRaytracePipeline(Opal_Device device, Opal_RaytracePipeline pipeline)
@@ -681,11 +1265,7 @@ Opal_Result opalDestroyRaytracePipeline(Opal_Device device, Opal_RaytracePipelin
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->destroyRaytracePipeline);
-
-	return ptr->vtbl->destroyRaytracePipeline(device, pipeline);
+	return OPAL_DEVICE_CALL(device, destroyRaytracePipeline, deviceDestroyRaytracePipeline)(device, pipeline);
 }
 
 Opal_Result opalDestroySwapchain(Opal_Device device, Opal_Swapchain swapchain)
@@ -693,11 +1273,7 @@ Opal_Result opalDestroySwapchain(Opal_Device device, Opal_Swapchain swapchain)
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->destroySwapchain);
-
-	return ptr->vtbl->destroySwapchain(device, swapchain);
+	return OPAL_DEVICE_CALL(device, destroySwapchain, deviceDestroySwapchain)(device, swapchain);
 }
 
 Opal_Result opalDestroyDevice(Opal_Device device)
@@ -705,11 +1281,7 @@ Opal_Result opalDestroyDevice(Opal_Device device)
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->destroyDevice);
-
-	return ptr->vtbl->destroyDevice(device);
+	return OPAL_DEVICE_CALL(device, destroyDevice, deviceDestroy)(device);
 }
 
 /*
@@ -719,11 +1291,7 @@ Opal_Result opalBuildShaderBindingTable(Opal_Device device, Opal_ShaderBindingTa
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->buildShaderBindingTable);
-
-	return ptr->vtbl->buildShaderBindingTable(device, shader_binding_table, desc);
+	return OPAL_DEVICE_CALL(device, buildShaderBindingTable, deviceBuildShaderBindingTable)(device, shader_binding_table, desc);
 }
 
 Opal_Result opalBuildAccelerationStructureInstanceBuffer(Opal_Device device, const Opal_AccelerationStructureInstanceBufferBuildDesc *desc)
@@ -731,11 +1299,7 @@ Opal_Result opalBuildAccelerationStructureInstanceBuffer(Opal_Device device, con
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->buildAccelerationStructureInstanceBuffer);
-
-	return ptr->vtbl->buildAccelerationStructureInstanceBuffer(device, desc);
+	return OPAL_DEVICE_CALL(device, buildAccelerationStructureInstanceBuffer, deviceBuildAccelerationStructureInstanceBuffer)(device, desc);
 }
 
 Opal_Result opalResetCommandAllocator(Opal_Device device, Opal_CommandAllocator command_allocator)
@@ -743,11 +1307,7 @@ Opal_Result opalResetCommandAllocator(Opal_Device device, Opal_CommandAllocator
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->resetCommandAllocator);
-
-	return ptr->vtbl->resetCommandAllocator(device, command_allocator);
+	return OPAL_DEVICE_CALL(device, resetCommandAllocator, deviceResetCommandAllocator)(device, command_allocator);
 }
 
 Opal_Result opalAllocateDescriptorSet(Opal_Device device, const Opal_DescriptorSetAllocationDesc *desc, Opal_DescriptorSet *descriptor_set)
@@ -755,11 +1315,7 @@ Opal_Result opalAllocateDescriptorSet(Opal_Device device, const Opal_DescriptorS
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->allocateDescriptorSet);
-
-	return ptr->vtbl->allocateDescriptorSet(device, desc, descriptor_set);
+	return OPAL_DEVICE_CALL(device, allocateDescriptorSet, deviceAllocateDescriptorSet)(device, desc, descriptor_set);
 }
 
 Opal_Result opalFreeDescriptorSet(Opal_Device device, Opal_DescriptorSet descriptor_set)
@@ -767,11 +1323,7 @@ Opal_Result opalFreeDescriptorSet(Opal_Device device, Opal_DescriptorSet descrip
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->freeDescriptorSet);
-
-	return ptr->vtbl->freeDescriptorSet(device, descriptor_set);
+	return OPAL_DEVICE_CALL(device, freeDescriptorSet, deviceFreeDescriptorSet)(device, descriptor_set);
 }
 
 Opal_Result opalMapBuffer(Opal_Device device, Opal_Buffer buffer, void **mapped_ptr)
@@ -779,11 +1331,7 @@ Opal_Result opalMapBuffer(Opal_Device device, Opal_Buffer buffer, void **mapped_
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->mapBuffer);
-
-	return ptr->vtbl->mapBuffer(device, buffer, mapped_ptr);
+	return OPAL_DEVICE_CALL(device, mapBuffer, deviceMapBuffer)(device, buffer, mapped_ptr);
 }
 
 Opal_Result opalUnmapBuffer(Opal_Device device, Opal_Buffer buffer)
@@ -791,11 +1339,7 @@ Opal_Result opalUnmapBuffer(Opal_Device device, Opal_Buffer buffer)
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->unmapBuffer);
-
-	return ptr->vtbl->unmapBuffer(device, buffer);
+	return OPAL_DEVICE_CALL(device, unmapBuffer, deviceUnmapBuffer)(device, buffer);
 }
 
 Opal_Result opalWriteBuffer(Opal_Device device, Opal_Buffer buffer, uint64_t offset, const void *data, uint64_t size)
@@ -803,11 +1347,7 @@ Opal_Result opalWriteBuffer(Opal_Device device, Opal_Buffer buffer, uint64_t off
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->writeBuffer);
-
-	return ptr->vtbl->writeBuffer(device, buffer, offset, data, size);
+	return OPAL_DEVICE_CALL(device, writeBuffer, deviceWriteBuffer)(device, buffer, offset, data, size);
 }
 
 Opal_Result opalUpdateDescriptorSet(Opal_Device device, Opal_DescriptorSet descriptor_set, uint32_t num_entries, const Opal_DescriptorSetEntry *entries)
@@ -815,11 +1355,7 @@ Opal_Result opalUpdateDescriptorSet(Opal_Device device, Opal_DescriptorSet descr
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->updateDescriptorSet);
-
-	return ptr->vtbl->updateDescriptorSet(device, descriptor_set, num_entries, entries);
+	return OPAL_DEVICE_CALL(device, updateDescriptorSet, deviceUpdateDescriptorSet)(device, descriptor_set, num_entries, entries);
 }
 
 Opal_Result opalBeginCommandBuffer(Opal_Device device, Opal_CommandBuffer command_buffer)
@@ -827,11 +1363,7 @@ Opal_Result opalBeginCommandBuffer(Opal_Device device, Opal_CommandBuffer comman
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->beginCommandBuffer);
-
-	return ptr->vtbl->beginCommandBuffer(device, command_buffer);
+	return OPAL_DEVICE_CALL(device, beginCommandBuffer, deviceBeginCommandBuffer)(device, command_buffer);
 }
 
 Opal_Result opalEndCommandBuffer(Opal_Device device, Opal_CommandBuffer command_buffer)
@@ -839,11 +1371,7 @@ Opal_Result opalEndCommandBuffer(Opal_Device device, Opal_CommandBuffer command_
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->endCommandBuffer);
-
-	return ptr->vtbl->endCommandBuffer(device, command_buffer);
+	return OPAL_DEVICE_CALL(device, endCommandBuffer, deviceEndCommandBuffer)(device, command_buffer);
 }
 
 Opal_Result opalQuerySemaphore(Opal_Device device, Opal_Semaphore semaphore, uint64_t *value)
@@ -851,11 +1379,7 @@ Opal_Result opalQuerySemaphore(Opal_Device device, Opal_Semaphore semaphore, uin
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->querySemaphore);
-
-	return ptr->vtbl->querySemaphore(device, semaphore, value);
+	return OPAL_DEVICE_CALL(device, querySemaphore, deviceQuerySemaphore)(device, semaphore, value);
 }
 
 Opal_Result opalSignalSemaphore(Opal_Device device, Opal_Semaphore semaphore, uint64_t value)
@@ -863,11 +1387,7 @@ Opal_Result opalSignalSemaphore(Opal_Device device, Opal_Semaphore semaphore, ui
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->signalSemaphore);
-
-	return ptr->vtbl->signalSemaphore(device, semaphore, value);
+	return OPAL_DEVICE_CALL(device, signalSemaphore, deviceSignalSemaphore)(device, semaphore, value);
 }
 
 Opal_Result opalWaitSemaphore(Opal_Device device, Opal_Semaphore semaphore, uint64_t value, uint64_t timeout_milliseconds)
@@ -875,47 +1395,61 @@ Opal_Result opalWaitSemaphore(Opal_Device device, Opal_Semaphore semaphore, uint
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->waitSemaphore);
+	return OPAL_DEVICE_CALL(device, waitSemaphore, deviceWaitSemaphore)(device, semaphore, value, timeout_milliseconds);
+}
+
+Opal_Result opalWaitSemaphores(Opal_Device device, uint32_t num_semaphores, const Opal_Semaphore *semaphores, const uint64_t *values, uint32_t wait_any, uint64_t timeout_milliseconds)
+{
+	if (device == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_DEVICE;
+
+	if (num_semaphores == 0)
+		return OPAL_SUCCESS;
 
-	return ptr->vtbl->waitSemaphore(device, semaphore, value, timeout_milliseconds);
+	return OPAL_DEVICE_CALL(device, waitSemaphores, deviceWaitSemaphores)(device, num_semaphores, semaphores, values, wait_any, timeout_milliseconds);
 }
 
-Opal_Result opalWaitQueue(Opal_Device device, Opal_Queue queue)
+Opal_Result opalRegisterSemaphoreCallback(Opal_Device device, Opal_Semaphore semaphore, uint64_t value, PFN_opalSemaphoreCallback callback, void *user_data)
 {
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->waitQueue);
+	if (callback == NULL)
+		return OPAL_INVALID_OUTPUT_ARGUMENT;
 
-	return ptr->vtbl->waitQueue(device, queue);
+	return OPAL_DEVICE_CALL(device, registerSemaphoreCallback, deviceRegisterSemaphoreCallback)(device, semaphore, value, callback, user_data);
 }
 
-Opal_Result opalWaitIdle(Opal_Device device)
+Opal_Result opalWaitPipelineTask(Opal_Device device, Opal_PipelineTask task, uint64_t timeout_milliseconds)
 {
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->waitIdle);
+	return OPAL_DEVICE_CALL(device, waitPipelineTask, deviceWaitPipelineTask)(device, task, timeout_milliseconds);
+}
+
+Opal_Result opalWaitQueue(Opal_Device device, Opal_Queue queue)
+{
+	if (device == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_DEVICE;
 
-	return ptr->vtbl->waitIdle(device);
+	return OPAL_DEVICE_CALL(device, waitQueue, deviceWaitQueue)(device, queue);
 }
 
-Opal_Result opalSubmit(Opal_Device device, Opal_Queue queue, const Opal_SubmitDesc *desc)
+Opal_Result opalWaitIdle(Opal_Device device)
 {
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->submit);
+	return OPAL_DEVICE_CALL(device, waitIdle, deviceWaitIdle)(device);
+}
+
+Opal_Result opalSubmit(Opal_Device device, Opal_Queue queue, const Opal_SubmitDesc *desc)
+{
+	if (device == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_DEVICE;
 
-	return ptr->vtbl->submit(device, queue, desc);
+	return OPAL_DEVICE_CALL(device, submit, deviceSubmit)(device, queue, desc);
 }
 
 Opal_Result opalAcquire(Opal_Device device, Opal_Swapchain swapchain, Opal_TextureView *texture_view)
@@ -923,11 +1457,7 @@ Opal_Result opalAcquire(Opal_Device device, Opal_Swapchain swapchain, Opal_Textu
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->acquire);
-
-	return ptr->vtbl->acquire(device, swapchain, texture_view);
+	return OPAL_DEVICE_CALL(device, acquire, deviceAcquire)(device, swapchain, texture_view);
 }
 
 Opal_Result opalPresent(Opal_Device device, Opal_Swapchain swapchain)
@@ -935,11 +1465,26 @@ Opal_Result opalPresent(Opal_Device device, Opal_Swapchain swapchain)
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->present);
+	return OPAL_DEVICE_CALL(device, present, devicePresent)(device, swapchain);
+}
+
+Opal_Result opalWaitPresent(Opal_Device device, Opal_Swapchain swapchain, uint64_t frame_id, uint64_t timeout_milliseconds)
+{
+	if (device == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_DEVICE;
 
-	return ptr->vtbl->present(device, swapchain);
+	if (swapchain == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_SWAPCHAIN;
+
+	return OPAL_DEVICE_CALL(device, waitPresent, deviceWaitPresent)(device, swapchain, frame_id, timeout_milliseconds);
+}
+
+Opal_Result opalGetSwapchainFrameTiming(Opal_Device device, Opal_Swapchain swapchain, Opal_FrameTiming *timing)
+{
+	if (device == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_DEVICE;
+
+	return OPAL_DEVICE_CALL(device, getSwapchainFrameTiming, deviceGetSwapchainFrameTiming)(device, swapchain, timing);
 }
 
 /*
@@ -949,11 +1494,7 @@ Opal_Result opalCmdSetDescriptorHeap(Opal_Device device, Opal_CommandBuffer comm
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdSetDescriptorHeap);
-
-	return ptr->vtbl->cmdSetDescriptorHeap(device, command_buffer, descriptor_heap);
+	return OPAL_DEVICE_CALL(device, cmdSetDescriptorHeap, deviceCmdSetDescriptorHeap)(device, command_buffer, descriptor_heap);
 }
 
 Opal_Result opalCmdBeginGraphicsPass(Opal_Device device, Opal_CommandBuffer command_buffer, const Opal_FramebufferDesc *desc, const Opal_PassBarriersDesc *barriers)
@@ -961,11 +1502,7 @@ Opal_Result opalCmdBeginGraphicsPass(Opal_Device device, Opal_CommandBuffer comm
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdBeginGraphicsPass);
-
-	return ptr->vtbl->cmdBeginGraphicsPass(device, command_buffer, desc, barriers);
+	return OPAL_DEVICE_CALL(device, cmdBeginGraphicsPass, deviceCmdBeginGraphicsPass)(device, command_buffer, desc, barriers);
 }
 
 Opal_Result opalCmdGraphicsSetPipelineLayout(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
@@ -973,11 +1510,7 @@ Opal_Result opalCmdGraphicsSetPipelineLayout(Opal_Device device, Opal_CommandBuf
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdGraphicsSetPipelineLayout);
-
-	return ptr->vtbl->cmdGraphicsSetPipelineLayout(device, command_buffer, pipeline_layout);
+	return OPAL_DEVICE_CALL(device, cmdGraphicsSetPipelineLayout, deviceCmdGraphicsSetPipelineLayout)(device, command_buffer, pipeline_layout);
 }
 
 Opal_Result opalCmdGraphicsSetPipeline(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_GraphicsPipeline pipeline)
@@ -985,11 +1518,7 @@ Opal_Result opalCmdGraphicsSetPipeline(Opal_Device device, Opal_CommandBuffer co
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdGraphicsSetPipeline);
-
-	return ptr->vtbl->cmdGraphicsSetPipeline(device, command_buffer, pipeline);
+	return OPAL_DEVICE_CALL(device, cmdGraphicsSetPipeline, deviceCmdGraphicsSetPipeline)(device, command_buffer, pipeline);
 }
 
 Opal_Result opalCmdGraphicsSetDescriptorSet(Opal_Device device, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
@@ -997,11 +1526,7 @@ Opal_Result opalCmdGraphicsSetDescriptorSet(Opal_Device device, Opal_CommandBuff
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdGraphicsSetDescriptorSet);
-
-	return ptr->vtbl->cmdGraphicsSetDescriptorSet(device, command_buffer, index, descriptor_set, num_dynamic_offsets, dynamic_offsets);
+	return OPAL_DEVICE_CALL(device, cmdGraphicsSetDescriptorSet, deviceCmdGraphicsSetDescriptorSet)(device, command_buffer, index, descriptor_set, num_dynamic_offsets, dynamic_offsets);
 }
 
 Opal_Result opalCmdGraphicsSetVertexBuffers(Opal_Device device, Opal_CommandBuffer command_buffer, uint32_t first_index, uint32_t num_vertex_buffers, const Opal_VertexBufferView *vertex_buffers)
@@ -1009,11 +1534,7 @@ Opal_Result opalCmdGraphicsSetVertexBuffers(Opal_Device device, Opal_CommandBuff
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdGraphicsSetVertexBuffers);
-
-	return ptr->vtbl->cmdGraphicsSetVertexBuffers(device, command_buffer, first_index, num_vertex_buffers, vertex_buffers);
+	return OPAL_DEVICE_CALL(device, cmdGraphicsSetVertexBuffers, deviceCmdGraphicsSetVertexBuffers)(device, command_buffer, first_index, num_vertex_buffers, vertex_buffers);
 }
 
 Opal_Result opalCmdGraphicsSetIndexBuffer(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_IndexBufferView index_buffer)
@@ -1021,11 +1542,7 @@ Opal_Result opalCmdGraphicsSetIndexBuffer(Opal_Device device, Opal_CommandBuffer
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdGraphicsSetIndexBuffer);
-
-	return ptr->vtbl->cmdGraphicsSetIndexBuffer(device, command_buffer, index_buffer);
+	return OPAL_DEVICE_CALL(device, cmdGraphicsSetIndexBuffer, deviceCmdGraphicsSetIndexBuffer)(device, command_buffer, index_buffer);
 }
 
 Opal_Result opalCmdGraphicsSetViewport(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_Viewport viewport)
@@ -1033,11 +1550,7 @@ Opal_Result opalCmdGraphicsSetViewport(Opal_Device device, Opal_CommandBuffer co
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdGraphicsSetViewport);
-
-	return ptr->vtbl->cmdGraphicsSetViewport(device, command_buffer, viewport);
+	return OPAL_DEVICE_CALL(device, cmdGraphicsSetViewport, deviceCmdGraphicsSetViewport)(device, command_buffer, viewport);
 }
 
 Opal_Result opalCmdGraphicsSetScissor(Opal_Device device, Opal_CommandBuffer command_buffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
@@ -1045,11 +1558,7 @@ Opal_Result opalCmdGraphicsSetScissor(Opal_Device device, Opal_CommandBuffer com
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdGraphicsSetScissor);
-
-	return ptr->vtbl->cmdGraphicsSetScissor(device, command_buffer, x, y, width, height);
+	return OPAL_DEVICE_CALL(device, cmdGraphicsSetScissor, deviceCmdGraphicsSetScissor)(device, command_buffer, x, y, width, height);
 }
 
 Opal_Result opalCmdGraphicsDraw(Opal_Device device, Opal_CommandBuffer command_buffer, uint32_t num_vertices, uint32_t num_instances, uint32_t base_vertex, uint32_t base_instance)
@@ -1057,11 +1566,7 @@ Opal_Result opalCmdGraphicsDraw(Opal_Device device, Opal_CommandBuffer command_b
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdGraphicsDraw);
-
-	return ptr->vtbl->cmdGraphicsDraw(device, command_buffer, num_vertices, num_instances, base_vertex, base_instance);
+	return OPAL_DEVICE_CALL(device, cmdGraphicsDraw, deviceCmdGraphicsDraw)(device, command_buffer, num_vertices, num_instances, base_vertex, base_instance);
 }
 
 Opal_Result opalCmdGraphicsDrawIndexed(Opal_Device device, Opal_CommandBuffer command_buffer, uint32_t num_indices, uint32_t num_instances, uint32_t base_index, int32_t vertex_offset, uint32_t base_instance)
@@ -1069,11 +1574,7 @@ Opal_Result opalCmdGraphicsDrawIndexed(Opal_Device device, Opal_CommandBuffer co
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdGraphicsDrawIndexed);
-
-	return ptr->vtbl->cmdGraphicsDrawIndexed(device, command_buffer, num_indices, num_instances, base_index, vertex_offset, base_instance);
+	return OPAL_DEVICE_CALL(device, cmdGraphicsDrawIndexed, deviceCmdGraphicsDrawIndexed)(device, command_buffer, num_indices, num_instances, base_index, vertex_offset, base_instance);
 }
 
 Opal_Result opalCmdGraphicsMeshletDispatch(Opal_Device device, Opal_CommandBuffer command_buffer, uint32_t num_threadgroups_x, uint32_t num_threadgroups_y, uint32_t num_threadgroups_z)
@@ -1081,11 +1582,7 @@ Opal_Result opalCmdGraphicsMeshletDispatch(Opal_Device device, Opal_CommandBuffe
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdGraphicsMeshletDispatch);
-
-	return ptr->vtbl->cmdGraphicsMeshletDispatch(device, command_buffer, num_threadgroups_x, num_threadgroups_y, num_threadgroups_z);
+	return OPAL_DEVICE_CALL(device, cmdGraphicsMeshletDispatch, deviceCmdGraphicsMeshletDispatch)(device, command_buffer, num_threadgroups_x, num_threadgroups_y, num_threadgroups_z);
 }
 
 Opal_Result opalCmdEndGraphicsPass(Opal_Device device, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
@@ -1093,11 +1590,7 @@ Opal_Result opalCmdEndGraphicsPass(Opal_Device device, Opal_CommandBuffer comman
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdEndGraphicsPass);
-
-	return ptr->vtbl->cmdEndGraphicsPass(device, command_buffer, barriers);
+	return OPAL_DEVICE_CALL(device, cmdEndGraphicsPass, deviceCmdEndGraphicsPass)(device, command_buffer, barriers);
 }
 
 Opal_Result opalCmdBeginComputePass(Opal_Device device, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
@@ -1105,11 +1598,7 @@ Opal_Result opalCmdBeginComputePass(Opal_Device device, Opal_CommandBuffer comma
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdBeginComputePass);
-
-	return ptr->vtbl->cmdBeginComputePass(device, command_buffer, barriers);
+	return OPAL_DEVICE_CALL(device, cmdBeginComputePass, deviceCmdBeginComputePass)(device, command_buffer, barriers);
 }
 
 Opal_Result opalCmdComputeSetPipelineLayout(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
@@ -1117,11 +1606,7 @@ Opal_Result opalCmdComputeSetPipelineLayout(Opal_Device device, Opal_CommandBuff
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdComputeSetPipelineLayout);
-
-	return ptr->vtbl->cmdComputeSetPipelineLayout(device, command_buffer, pipeline_layout);
+	return OPAL_DEVICE_CALL(device, cmdComputeSetPipelineLayout, deviceCmdComputeSetPipelineLayout)(device, command_buffer, pipeline_layout);
 }
 
 Opal_Result opalCmdComputeSetPipeline(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_ComputePipeline pipeline)
@@ -1129,11 +1614,7 @@ Opal_Result opalCmdComputeSetPipeline(Opal_Device device, Opal_CommandBuffer com
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdComputeSetPipeline);
-
-	return ptr->vtbl->cmdComputeSetPipeline(device, command_buffer, pipeline);
+	return OPAL_DEVICE_CALL(device, cmdComputeSetPipeline, deviceCmdComputeSetPipeline)(device, command_buffer, pipeline);
 }
 
 Opal_Result opalCmdComputeSetDescriptorSet(Opal_Device device, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
@@ -1141,11 +1622,7 @@ Opal_Result opalCmdComputeSetDescriptorSet(Opal_Device device, Opal_CommandBuffe
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdComputeSetDescriptorSet);
-
-	return ptr->vtbl->cmdComputeSetDescriptorSet(device, command_buffer, index, descriptor_set, num_dynamic_offsets, dynamic_offsets);
+	return OPAL_DEVICE_CALL(device, cmdComputeSetDescriptorSet, deviceCmdComputeSetDescriptorSet)(device, command_buffer, index, descriptor_set, num_dynamic_offsets, dynamic_offsets);
 }
 
 Opal_Result opalCmdComputeMemoryBarrier(Opal_Device device, Opal_CommandBuffer command_buffer, const Opal_MemoryBarrierDesc *barriers)
@@ -1153,11 +1630,7 @@ Opal_Result opalCmdComputeMemoryBarrier(Opal_Device device, Opal_CommandBuffer c
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdComputeMemoryBarrier);
-
-	return ptr->vtbl->cmdComputeMemoryBarrier(device, command_buffer, barriers);
+	return OPAL_DEVICE_CALL(device, cmdComputeMemoryBarrier, deviceCmdComputeMemoryBarrier)(device, command_buffer, barriers);
 }
 
 Opal_Result opalCmdComputeDispatch(Opal_Device device, Opal_CommandBuffer command_buffer, uint32_t num_threadgroups_x, uint32_t num_threadgroups_y, uint32_t num_threadgroups_z)
@@ -1165,11 +1638,7 @@ Opal_Result opalCmdComputeDispatch(Opal_Device device, Opal_CommandBuffer comman
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdComputeDispatch);
-
-	return ptr->vtbl->cmdComputeDispatch(device, command_buffer, num_threadgroups_x, num_threadgroups_y, num_threadgroups_z);
+	return OPAL_DEVICE_CALL(device, cmdComputeDispatch, deviceCmdComputeDispatch)(device, command_buffer, num_threadgroups_x, num_threadgroups_y, num_threadgroups_z);
 }
 
 Opal_Result opalCmdEndComputePass(Opal_Device device, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
@@ -1177,11 +1646,7 @@ Opal_Result opalCmdEndComputePass(Opal_Device device, Opal_CommandBuffer command
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdEndComputePass);
-
-	return ptr->vtbl->cmdEndComputePass(device, command_buffer, barriers);
+	return OPAL_DEVICE_CALL(device, cmdEndComputePass, deviceCmdEndComputePass)(device, command_buffer, barriers);
 }
 
 Opal_Result opalCmdBeginRaytracePass(Opal_Device device, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
@@ -1189,11 +1654,7 @@ Opal_Result opalCmdBeginRaytracePass(Opal_Device device, Opal_CommandBuffer comm
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdBeginRaytracePass);
-
-	return ptr->vtbl->cmdBeginRaytracePass(device, command_buffer, barriers);
+	return OPAL_DEVICE_CALL(device, cmdBeginRaytracePass, deviceCmdBeginRaytracePass)(device, command_buffer, barriers);
 }
 
 Opal_Result opalCmdRaytraceSetPipelineLayout(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
@@ -1201,11 +1662,7 @@ Opal_Result opalCmdRaytraceSetPipelineLayout(Opal_Device device, Opal_CommandBuf
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdRaytraceSetPipelineLayout);
-
-	return ptr->vtbl->cmdRaytraceSetPipelineLayout(device, command_buffer, pipeline_layout);
+	return OPAL_DEVICE_CALL(device, cmdRaytraceSetPipelineLayout, deviceCmdRaytraceSetPipelineLayout)(device, command_buffer, pipeline_layout);
 }
 
 Opal_Result opalCmdRaytraceSetPipeline(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_ComputePipeline pipeline)
@@ -1213,11 +1670,7 @@ Opal_Result opalCmdRaytraceSetPipeline(Opal_Device device, Opal_CommandBuffer co
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdRaytraceSetPipeline);
-
-	return ptr->vtbl->cmdRaytraceSetPipeline(device, command_buffer, pipeline);
+	return OPAL_DEVICE_CALL(device, cmdRaytraceSetPipeline, deviceCmdRaytraceSetPipeline)(device, command_buffer, pipeline);
 }
 
 Opal_Result opalCmdRaytraceSetDescriptorSet(Opal_Device device, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
@@ -1225,11 +1678,7 @@ Opal_Result opalCmdRaytraceSetDescriptorSet(Opal_Device device, Opal_CommandBuff
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdRaytraceSetDescriptorSet);
-
-	return ptr->vtbl->cmdRaytraceSetDescriptorSet(device, command_buffer, index, descriptor_set, num_dynamic_offsets, dynamic_offsets);
+	return OPAL_DEVICE_CALL(device, cmdRaytraceSetDescriptorSet, deviceCmdRaytraceSetDescriptorSet)(device, command_buffer, index, descriptor_set, num_dynamic_offsets, dynamic_offsets);
 }
 
 Opal_Result opalCmdRaytraceSetShaderBindingTable(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_ShaderBindingTable shader_binding_table)
@@ -1237,11 +1686,7 @@ Opal_Result opalCmdRaytraceSetShaderBindingTable(Opal_Device device, Opal_Comman
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdRaytraceSetShaderBindingTable);
-
-	return ptr->vtbl->cmdRaytraceSetShaderBindingTable(device, command_buffer, shader_binding_table);
+	return OPAL_DEVICE_CALL(device, cmdRaytraceSetShaderBindingTable, deviceCmdRaytraceSetShaderBindingTable)(device, command_buffer, shader_binding_table);
 }
 
 Opal_Result opalCmdRaytraceMemoryBarrier(Opal_Device device, Opal_CommandBuffer command_buffer, const Opal_MemoryBarrierDesc *barriers)
@@ -1249,11 +1694,7 @@ Opal_Result opalCmdRaytraceMemoryBarrier(Opal_Device device, Opal_CommandBuffer
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdRaytraceMemoryBarrier);
-
-	return ptr->vtbl->cmdRaytraceMemoryBarrier(device, command_buffer, barriers);
+	return OPAL_DEVICE_CALL(device, cmdRaytraceMemoryBarrier, deviceCmdRaytraceMemoryBarrier)(device, command_buffer, barriers);
 }
 
 Opal_Result opalCmdRaytraceDispatch(Opal_Device device, Opal_CommandBuffer command_buffer, uint32_t width, uint32_t height, uint32_t depth)
@@ -1261,11 +1702,7 @@ Opal_Result opalCmdRaytraceDispatch(Opal_Device device, Opal_CommandBuffer comma
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdRaytraceDispatch);
-
-	return ptr->vtbl->cmdRaytraceDispatch(device, command_buffer, width, height, depth);
+	return OPAL_DEVICE_CALL(device, cmdRaytraceDispatch, deviceCmdRaytraceDispatch)(device, command_buffer, width, height, depth);
 }
 
 Opal_Result opalCmdEndRaytracePass(Opal_Device device, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
@@ -1273,11 +1710,7 @@ Opal_Result opalCmdEndRaytracePass(Opal_Device device, Opal_CommandBuffer comman
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdEndRaytracePass);
-
-	return ptr->vtbl->cmdEndRaytracePass(device, command_buffer, barriers);
+	return OPAL_DEVICE_CALL(device, cmdEndRaytracePass, deviceCmdEndRaytracePass)(device, command_buffer, barriers);
 }
 
 Opal_Result opalCmdBeginCopyPass(Opal_Device device, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
@@ -1285,11 +1718,7 @@ Opal_Result opalCmdBeginCopyPass(Opal_Device device, Opal_CommandBuffer command_
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdBeginCopyPass);
-
-	return ptr->vtbl->cmdBeginCopyPass(device, command_buffer, barriers);
+	return OPAL_DEVICE_CALL(device, cmdBeginCopyPass, deviceCmdBeginCopyPass)(device, command_buffer, barriers);
 }
 
 Opal_Result opalCmdCopyBufferToBuffer(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_Buffer src_buffer, uint64_t src_offset, Opal_Buffer dst_buffer, uint64_t dst_offset, uint64_t size)
@@ -1297,11 +1726,7 @@ Opal_Result opalCmdCopyBufferToBuffer(Opal_Device device, Opal_CommandBuffer com
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdCopyBufferToBuffer);
-
-	return ptr->vtbl->cmdCopyBufferToBuffer(device, command_buffer, src_buffer, src_offset, dst_buffer, dst_offset, size);
+	return OPAL_DEVICE_CALL(device, cmdCopyBufferToBuffer, deviceCmdCopyBufferToBuffer)(device, command_buffer, src_buffer, src_offset, dst_buffer, dst_offset, size);
 }
 
 Opal_Result opalCmdCopyBufferToTexture(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_BufferTextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size)
@@ -1309,11 +1734,7 @@ Opal_Result opalCmdCopyBufferToTexture(Opal_Device device, Opal_CommandBuffer co
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdCopyBufferToTexture);
-
-	return ptr->vtbl->cmdCopyBufferToTexture(device, command_buffer, src, dst, size);
+	return OPAL_DEVICE_CALL(device, cmdCopyBufferToTexture, deviceCmdCopyBufferToTexture)(device, command_buffer, src, dst, size);
 }
 
 Opal_Result opalCmdCopyTextureToBuffer(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_BufferTextureRegion dst, Opal_Extent3D size)
@@ -1321,11 +1742,23 @@ Opal_Result opalCmdCopyTextureToBuffer(Opal_Device device, Opal_CommandBuffer co
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdCopyTextureToBuffer);
+	return OPAL_DEVICE_CALL(device, cmdCopyTextureToBuffer, deviceCmdCopyTextureToBuffer)(device, command_buffer, src, dst, size);
+}
+
+Opal_Result opalCmdCopyBufferToTextureRegions(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_Buffer src_buffer, Opal_Texture dst_texture, uint32_t num_regions, const Opal_BufferTextureCopyRegion *regions)
+{
+	if (device == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_DEVICE;
+
+	return OPAL_DEVICE_CALL(device, cmdCopyBufferToTextureRegions, deviceCmdCopyBufferToTextureRegions)(device, command_buffer, src_buffer, dst_texture, num_regions, regions);
+}
+
+Opal_Result opalCmdCopyTextureToBufferRegions(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_Texture src_texture, Opal_Buffer dst_buffer, uint32_t num_regions, const Opal_BufferTextureCopyRegion *regions)
+{
+	if (device == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_DEVICE;
 
-	return ptr->vtbl->cmdCopyTextureToBuffer(device, command_buffer, src, dst, size);
+	return OPAL_DEVICE_CALL(device, cmdCopyTextureToBufferRegions, deviceCmdCopyTextureToBufferRegions)(device, command_buffer, src_texture, dst_buffer, num_regions, regions);
 }
 
 Opal_Result opalCmdCopyTextureToTexture(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size)
@@ -1333,35 +1766,102 @@ Opal_Result opalCmdCopyTextureToTexture(Opal_Device device, Opal_CommandBuffer c
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdCopyTextureToTexture);
+	return OPAL_DEVICE_CALL(device, cmdCopyTextureToTexture, deviceCmdCopyTextureToTexture)(device, command_buffer, src, dst, size);
+}
+
+Opal_Result opalCmdFillBuffer(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_Buffer buffer, uint64_t offset, uint64_t size, uint32_t value)
+{
+	if (device == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_DEVICE;
+
+	if (command_buffer == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_COMMAND_BUFFER;
 
-	return ptr->vtbl->cmdCopyTextureToTexture(device, command_buffer, src, dst, size);
+	if (buffer == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_BUFFER;
+
+	if ((offset & 3) != 0 || (size & 3) != 0)
+		return OPAL_INVALID_ARGUMENT;
+
+	return OPAL_DEVICE_CALL(device, cmdFillBuffer, deviceCmdFillBuffer)(device, command_buffer, buffer, offset, size, value);
 }
 
-Opal_Result opalCmdEndCopyPass(Opal_Device device, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+Opal_Result opalCmdUpdateBuffer(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_Buffer buffer, uint64_t offset, uint64_t size, const void *data)
 {
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdEndCopyPass);
+	if (command_buffer == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_COMMAND_BUFFER;
 
-	return ptr->vtbl->cmdEndCopyPass(device, command_buffer, barriers);
+	if (buffer == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_BUFFER;
+
+	if ((offset & 3) != 0 || (size & 3) != 0 || (size > 0 && data == NULL))
+		return OPAL_INVALID_ARGUMENT;
+
+	return OPAL_DEVICE_CALL(device, cmdUpdateBuffer, deviceCmdUpdateBuffer)(device, command_buffer, buffer, offset, size, data);
 }
 
-Opal_Result opalCmdBeginAccelerationStructurePass(Opal_Device device, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+Opal_Result opalCmdClearTexture(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_TextureView texture_view, Opal_ClearValue clear_value)
 {
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdBeginAccelerationStructurePass);
+	if (command_buffer == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_COMMAND_BUFFER;
+
+	if (texture_view == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_TEXTURE_VIEW;
+
+	return OPAL_DEVICE_CALL(device, cmdClearTexture, deviceCmdClearTexture)(device, command_buffer, texture_view, clear_value);
+}
+
+Opal_Result opalCmdBlitTexture(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_Extent3D src_size, Opal_TextureRegion dst, Opal_Extent3D dst_size, Opal_SamplerFilterMode filter)
+{
+	if (device == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_DEVICE;
+
+	if (command_buffer == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_COMMAND_BUFFER;
+
+	if (src.texture_view == OPAL_NULL_HANDLE || dst.texture_view == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_TEXTURE_VIEW;
+
+	if (filter >= OPAL_SAMPLER_FILTER_MODE_ENUM_MAX)
+		return OPAL_INVALID_ARGUMENT;
+
+	return OPAL_DEVICE_CALL(device, cmdBlitTexture, deviceCmdBlitTexture)(device, command_buffer, src, src_size, dst, dst_size, filter);
+}
+
+Opal_Result opalCmdGenerateMips(Opal_Device device, Opal_CommandBuffer command_buffer, Opal_TextureView texture_view)
+{
+	if (device == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_DEVICE;
 
-	return ptr->vtbl->cmdBeginAccelerationStructurePass(device, command_buffer, barriers);
+	if (command_buffer == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_COMMAND_BUFFER;
+
+	if (texture_view == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_TEXTURE_VIEW;
+
+	return OPAL_DEVICE_CALL(device, cmdGenerateMips, deviceCmdGenerateMips)(device, command_buffer, texture_view);
+}
+
+Opal_Result opalCmdEndCopyPass(Opal_Device device, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	if (device == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_DEVICE;
+
+	return OPAL_DEVICE_CALL(device, cmdEndCopyPass, deviceCmdEndCopyPass)(device, command_buffer, barriers);
+}
+
+Opal_Result opalCmdBeginAccelerationStructurePass(Opal_Device device, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	if (device == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_DEVICE;
+
+	return OPAL_DEVICE_CALL(device, cmdBeginAccelerationStructurePass, deviceCmdBeginAccelerationStructurePass)(device, command_buffer, barriers);
 }
 
 Opal_Result opalCmdAccelerationStructureBuild(Opal_Device device, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureBuildDesc *desc)
@@ -1369,11 +1869,18 @@ Opal_Result opalCmdAccelerationStructureBuild(Opal_Device device, Opal_CommandBu
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdAccelerationStructureBuild);
+	return OPAL_DEVICE_CALL(device, cmdAccelerationStructureBuild, deviceCmdAccelerationStructureBuild)(device, command_buffer, desc);
+}
+
+Opal_Result opalCmdAccelerationStructureBuildBatch(Opal_Device device, Opal_CommandBuffer command_buffer, uint32_t num_descs, const Opal_AccelerationStructureBuildDesc *descs)
+{
+	if (device == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_DEVICE;
 
-	return ptr->vtbl->cmdAccelerationStructureBuild(device, command_buffer, desc);
+	if (num_descs == 0)
+		return OPAL_SUCCESS;
+
+	return OPAL_DEVICE_CALL(device, cmdAccelerationStructureBuildBatch, deviceCmdAccelerationStructureBuildBatch)(device, command_buffer, num_descs, descs);
 }
 
 Opal_Result opalCmdAccelerationStructureCopy(Opal_Device device, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureCopyDesc *desc)
@@ -1381,11 +1888,18 @@ Opal_Result opalCmdAccelerationStructureCopy(Opal_Device device, Opal_CommandBuf
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdAccelerationStructureCopy);
+	return OPAL_DEVICE_CALL(device, cmdAccelerationStructureCopy, deviceCmdAccelerationStructureCopy)(device, command_buffer, desc);
+}
+
+Opal_Result opalCmdAccelerationStructureWriteCompactedSizes(Opal_Device device, Opal_CommandBuffer command_buffer, uint32_t num_acceleration_structures, const Opal_AccelerationStructure *acceleration_structures, Opal_BufferView dst)
+{
+	if (device == OPAL_NULL_HANDLE)
+		return OPAL_INVALID_DEVICE;
+
+	if (num_acceleration_structures == 0)
+		return OPAL_SUCCESS;
 
-	return ptr->vtbl->cmdAccelerationStructureCopy(device, command_buffer, desc);
+	return OPAL_DEVICE_CALL(device, cmdAccelerationStructureWriteCompactedSizes, deviceCmdAccelerationStructureWriteCompactedSizes)(device, command_buffer, num_acceleration_structures, acceleration_structures, dst);
 }
 
 Opal_Result opalCmdEndAccelerationStructurePass(Opal_Device device, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
@@ -1393,9 +1907,5 @@ Opal_Result opalCmdEndAccelerationStructurePass(Opal_Device device, Opal_Command
 	if (device == OPAL_NULL_HANDLE)
 		return OPAL_INVALID_DEVICE;
 
-	Opal_DeviceInternal *ptr = (Opal_DeviceInternal *)(device);
-	assert(ptr->vtbl);
-	assert(ptr->vtbl->cmdEndAccelerationStructurePass);
-
-	return ptr->vtbl->cmdEndAccelerationStructurePass(device, command_buffer, barriers);
+	return OPAL_DEVICE_CALL(device, cmdEndAccelerationStructurePass, deviceCmdEndAccelerationStructurePass)(device, command_buffer, barriers);
 }
@@ -4,10 +4,220 @@
 
 #define OPAL_UNUSED(x) do { (void)(x); } while(0)
 
+// note: with OPAL_SINGLE_BACKEND defined (i.e. OPAL_SINGLE_BACKEND=vulkan), entry points call
+//       backend functions directly instead of going through the handle's vtbl, so they lose
+//       internal linkage in order to be visible to opal.c
+#if defined(OPAL_SINGLE_BACKEND)
+	#define OPAL_BACKEND_STATIC
+	#define OPAL_BACKEND_CONCAT_IMPL(PREFIX, NAME) PREFIX ## _ ## NAME
+	#define OPAL_BACKEND_CONCAT(PREFIX, NAME) OPAL_BACKEND_CONCAT_IMPL(PREFIX, NAME)
+	#define OPAL_BACKEND_FUNCTION(NAME) OPAL_BACKEND_CONCAT(OPAL_SINGLE_BACKEND, NAME)
+#else
+	#define OPAL_BACKEND_STATIC static
+#endif
+
 Opal_Result vulkan_opalCreateInstance(const Opal_InstanceDesc *desc, Opal_Instance *instance);
 Opal_Result directx12_opalCreateInstance(const Opal_InstanceDesc *desc, Opal_Instance *instance);
 Opal_Result metal_opalCreateInstance(const Opal_InstanceDesc *desc, Opal_Instance *instance);
 Opal_Result webgpu_opalCreateInstance(const Opal_InstanceDesc *desc, Opal_Instance *instance);
 Opal_Result null_opalCreateInstance(const Opal_InstanceDesc *desc, Opal_Instance *instance);
 
-uint32_t opal_evaluateDevice(const Opal_DeviceInfo *info, Opal_DeviceHint hint);
\ No newline at end of file
+Opal_Result capture_opalWrapInstance(void *user_data, Opal_Api api, const Opal_InstanceDesc *desc, Opal_Instance next_instance, Opal_Instance *instance);
+
+Opal_Result profile_opalWrapInstance(void *user_data, Opal_Api api, const Opal_InstanceDesc *desc, Opal_Instance next_instance, Opal_Instance *instance);
+Opal_Result profile_opalWrapInstanceWithTrace(void *user_data, Opal_Api api, const Opal_InstanceDesc *desc, Opal_Instance next_instance, Opal_Instance *instance);
+Opal_Result profile_opalCreateProfiler(const Opal_ProfilerDesc *desc, Opal_Profiler *profiler);
+Opal_Result profile_opalGetProfilerStats(Opal_Profiler profiler, uint32_t *num_stats, Opal_ProfilerCallStats *stats);
+Opal_Result profile_opalResetProfilerStats(Opal_Profiler profiler);
+Opal_Result profile_opalWriteProfilerFrames(Opal_Profiler profiler, const char *path);
+Opal_Result profile_opalDestroyProfiler(Opal_Profiler profiler);
+
+Opal_Result state_opalWrapInstance(void *user_data, Opal_Api api, const Opal_InstanceDesc *desc, Opal_Instance next_instance, Opal_Instance *instance);
+
+Opal_Result upload_opalCreateUploader(Opal_Device device, const Opal_UploaderDesc *desc, Opal_Uploader *uploader);
+Opal_Result upload_opalUploadBuffer(Opal_Uploader uploader, Opal_Buffer buffer, uint64_t offset, const void *data, uint64_t size);
+Opal_Result upload_opalUploadTexture(Opal_Uploader uploader, Opal_TextureRegion dst, Opal_Extent3D size, const void *data, uint32_t row_size, uint32_t num_rows);
+Opal_Result upload_opalFlushUploads(Opal_Uploader uploader, Opal_Semaphore *semaphore, uint64_t *value);
+Opal_Result upload_opalDestroyUploader(Opal_Uploader uploader);
+Opal_Result upload_opalCreateTransientAllocator(Opal_Device device, const Opal_TransientAllocatorDesc *desc, Opal_TransientAllocator *allocator);
+Opal_Result upload_opalGetTransientBuffer(Opal_TransientAllocator allocator, Opal_Buffer *buffer);
+Opal_Result upload_opalAllocateTransient(Opal_TransientAllocator allocator, uint64_t size, uint64_t alignment, Opal_TransientAllocation *allocation);
+Opal_Result upload_opalEndTransientFrame(Opal_TransientAllocator allocator, Opal_Semaphore semaphore, uint64_t value);
+Opal_Result upload_opalDestroyTransientAllocator(Opal_TransientAllocator allocator);
+
+Opal_Result upload_opalCreateReadback(Opal_Device device, const Opal_ReadbackDesc *desc, Opal_Readback *readback);
+Opal_Result upload_opalReadbackAsync(Opal_Readback readback, Opal_CommandBuffer command_buffer, Opal_Buffer buffer, uint64_t offset, uint64_t size, PFN_opalReadbackCallback callback, void *user_data);
+Opal_Result upload_opalReadbackTextureAsync(Opal_Readback readback, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_Extent3D size, uint32_t row_size, uint32_t num_rows, PFN_opalReadbackCallback callback, void *user_data);
+Opal_Result upload_opalFlushReadbacks(Opal_Readback readback, Opal_Semaphore semaphore, uint64_t value);
+Opal_Result upload_opalPollReadbacks(Opal_Readback readback);
+Opal_Result upload_opalDestroyReadback(Opal_Readback readback);
+
+Opal_Result upload_opalCreateCompactor(Opal_Device device, const Opal_CompactorDesc *desc, Opal_Compactor *compactor);
+Opal_Result upload_opalCompactAccelerationStructures(Opal_Compactor compactor, Opal_CommandBuffer command_buffer, uint32_t num_acceleration_structures, const Opal_AccelerationStructure *acceleration_structures, PFN_opalCompactionCallback callback, void *user_data);
+Opal_Result upload_opalFlushCompactions(Opal_Compactor compactor, Opal_Semaphore semaphore, uint64_t value);
+Opal_Result upload_opalPollCompactions(Opal_Compactor compactor, Opal_CommandBuffer command_buffer);
+Opal_Result upload_opalDestroyCompactor(Opal_Compactor compactor);
+
+Opal_Result graph_opalCreateGraph(Opal_Device device, Opal_Graph *graph);
+Opal_Result graph_opalResetGraph(Opal_Graph graph);
+Opal_Result graph_opalImportGraphBuffer(Opal_Graph graph, Opal_Buffer buffer, Opal_BufferState initial_state, Opal_BufferState final_state, Opal_GraphResource *resource);
+Opal_Result graph_opalImportGraphTexture(Opal_Graph graph, Opal_TextureView texture_view, Opal_TextureState initial_state, Opal_TextureState final_state, Opal_GraphResource *resource);
+Opal_Result graph_opalCreateGraphBuffer(Opal_Graph graph, const Opal_BufferDesc *desc, Opal_GraphResource *resource);
+Opal_Result graph_opalCreateGraphTexture(Opal_Graph graph, const Opal_TextureDesc *desc, Opal_GraphResource *resource);
+Opal_Result graph_opalAddGraphPass(Opal_Graph graph, const Opal_GraphPassDesc *desc);
+Opal_Result graph_opalGetGraphBuffer(Opal_Graph graph, Opal_GraphResource resource, Opal_Buffer *buffer);
+Opal_Result graph_opalGetGraphTextureView(Opal_Graph graph, Opal_GraphResource resource, Opal_TextureView *texture_view);
+Opal_Result graph_opalExecuteGraph(Opal_Graph graph, Opal_CommandBuffer command_buffer);
+Opal_Result graph_opalDestroyGraph(Opal_Graph graph);
+
+Opal_Result schedule_opalCreateScheduler(Opal_Device device, Opal_Scheduler *scheduler);
+Opal_Result schedule_opalGetSchedulerQueue(Opal_Scheduler scheduler, Opal_DeviceEngineType engine_type, Opal_Queue *queue);
+Opal_Result schedule_opalSchedule(Opal_Scheduler scheduler, const Opal_ScheduleDesc *desc, Opal_Semaphore *semaphore, uint64_t *value);
+Opal_Result schedule_opalDestroyScheduler(Opal_Scheduler scheduler);
+
+uint32_t opal_evaluateDevice(const Opal_DeviceInfo *info, Opal_DeviceHint hint);
+
+#if defined(OPAL_SINGLE_BACKEND)
+Opal_Result OPAL_BACKEND_FUNCTION(instanceEnumerateDevices)(Opal_Instance this, uint32_t *device_count, Opal_DeviceInfo *infos);
+
+Opal_Result OPAL_BACKEND_FUNCTION(instanceCreateSurface)(Opal_Instance this, void *handle, Opal_Surface *surface);
+Opal_Result OPAL_BACKEND_FUNCTION(instanceCreateHeadlessSurface)(Opal_Instance this, uint32_t width, uint32_t height, Opal_Surface *surface);
+Opal_Result OPAL_BACKEND_FUNCTION(instanceCreateDevice)(Opal_Instance this, uint32_t index, Opal_Device *device);
+Opal_Result OPAL_BACKEND_FUNCTION(instanceCreateDefaultDevice)(Opal_Instance this, Opal_DeviceHint hint, Opal_Device *device);
+
+Opal_Result OPAL_BACKEND_FUNCTION(instanceDestroySurface)(Opal_Instance this, Opal_Surface surface);
+Opal_Result OPAL_BACKEND_FUNCTION(instanceDestroy)(Opal_Instance this);
+
+Opal_Result OPAL_BACKEND_FUNCTION(deviceGetInfo)(Opal_Device this, Opal_DeviceInfo *info);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceGetQueue)(Opal_Device this, Opal_DeviceEngineType engine_type, uint32_t index, Opal_Queue *queue);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceGetAccelerationStructurePrebuildInfo)(Opal_Device this, const Opal_AccelerationStructureBuildDesc *desc, Opal_AccelerationStructurePrebuildInfo *info);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceGetAccelerationStructureAddress)(Opal_Device this, Opal_AccelerationStructure acceleration_structure, uint64_t *address);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceGetSupportedSurfaceFormats)(Opal_Device this, Opal_Surface surface, uint32_t *num_formats, Opal_SurfaceFormat *formats);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceGetSupportedPresentModes)(Opal_Device this, Opal_Surface surface, uint32_t *num_present_modes, Opal_PresentMode *present_modes);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceGetPreferredSurfaceFormat)(Opal_Device this, Opal_Surface surface, Opal_SurfaceFormat *format);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceGetPreferredSurfacePresentMode)(Opal_Device this, Opal_Surface surface, Opal_PresentMode *present_mode);
+
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCreateSemaphore)(Opal_Device this, const Opal_SemaphoreDesc *desc, Opal_Semaphore *semaphore);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCreateFence)(Opal_Device this, Opal_Fence *fence);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCreateBuffer)(Opal_Device this, const Opal_BufferDesc *desc, Opal_Buffer *buffer);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCreateTexture)(Opal_Device this, const Opal_TextureDesc *desc, Opal_Texture *texture);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCreateTextureView)(Opal_Device this, const Opal_TextureViewDesc *desc, Opal_TextureView *texture_view);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCreateSampler)(Opal_Device this, const Opal_SamplerDesc *desc, Opal_Sampler *sampler);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCreateAccelerationStructure)(Opal_Device this, const Opal_AccelerationStructureDesc *desc, Opal_AccelerationStructure *acceleration_structure);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCreateShaderBindingTable)(Opal_Device this, Opal_RaytracePipeline pipeline, Opal_ShaderBindingTable *shader_binding_table);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCreateCommandAllocator)(Opal_Device this, Opal_Queue queue, Opal_CommandAllocator *command_allocator);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCreateCommandBuffer)(Opal_Device this, Opal_CommandAllocator command_allocator, Opal_CommandBuffer *command_buffer);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCreateShader)(Opal_Device this, const Opal_ShaderDesc *desc, Opal_Shader *shader);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCreateDescriptorHeap)(Opal_Device this, const Opal_DescriptorHeapDesc *desc, Opal_DescriptorHeap *descriptor_buffer);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCreateDescriptorSetLayout)(Opal_Device this, uint32_t num_entries, const Opal_DescriptorSetLayoutEntry *entries, Opal_DescriptorSetLayout *descriptor_set_layout);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCreatePipelineLayout)(Opal_Device this, uint32_t num_descriptor_setlayouts, const Opal_DescriptorSetLayout *descriptor_set_layouts, Opal_PipelineLayout *pipeline_layout);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCreateGraphicsPipeline)(Opal_Device this, const Opal_GraphicsPipelineDesc *desc, Opal_GraphicsPipeline *pipeline);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCreateMeshletPipeline)(Opal_Device this, const Opal_MeshletPipelineDesc *desc, Opal_GraphicsPipeline *pipeline);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCreateComputePipeline)(Opal_Device this, const Opal_ComputePipelineDesc *desc, Opal_ComputePipeline *pipeline);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCreateRaytracePipeline)(Opal_Device this, const Opal_RaytracePipelineDesc *desc, Opal_RaytracePipeline *pipeline);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCreateGraphicsPipelines)(Opal_Device this, uint32_t num_pipelines, const Opal_GraphicsPipelineDesc *descs, Opal_GraphicsPipeline *pipelines);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCreateComputePipelines)(Opal_Device this, uint32_t num_pipelines, const Opal_ComputePipelineDesc *descs, Opal_ComputePipeline *pipelines);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCreateRaytracePipelines)(Opal_Device this, uint32_t num_pipelines, const Opal_RaytracePipelineDesc *descs, Opal_RaytracePipeline *pipelines);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCreateGraphicsPipelinesAsync)(Opal_Device this, uint32_t num_pipelines, const Opal_GraphicsPipelineDesc *descs, Opal_GraphicsPipeline *pipelines, Opal_PipelineTask *task);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCreateComputePipelinesAsync)(Opal_Device this, uint32_t num_pipelines, const Opal_ComputePipelineDesc *descs, Opal_ComputePipeline *pipelines, Opal_PipelineTask *task);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCreateRaytracePipelinesAsync)(Opal_Device this, uint32_t num_pipelines, const Opal_RaytracePipelineDesc *descs, Opal_RaytracePipeline *pipelines, Opal_PipelineTask *task);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCreateSwapchain)(Opal_Device this, const Opal_SwapchainDesc *desc, Opal_Swapchain *swapchain);
+
+Opal_Result OPAL_BACKEND_FUNCTION(deviceDestroySemaphore)(Opal_Device this, Opal_Semaphore semaphore);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceDestroyFence)(Opal_Device this, Opal_Fence fence);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceDestroyBuffer)(Opal_Device this, Opal_Buffer buffer);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceDestroyTexture)(Opal_Device this, Opal_Texture texture);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceDestroyTextureView)(Opal_Device this, Opal_TextureView texture_view);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceDestroySampler)(Opal_Device this, Opal_Sampler sampler);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceDestroyAccelerationStructure)(Opal_Device this, Opal_AccelerationStructure acceleration_structure);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceDestroyShaderBindingTable)(Opal_Device this, Opal_ShaderBindingTable shader_binding_table);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceDestroyCommandAllocator)(Opal_Device this, Opal_CommandAllocator command_allocator);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceDestroyCommandBuffer)(Opal_Device this, Opal_CommandBuffer command_buffer);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceDestroyShader)(Opal_Device this, Opal_Shader shader);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceDestroyDescriptorHeap)(Opal_Device this, Opal_DescriptorHeap descriptor_buffer);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceDestroyDescriptorSetLayout)(Opal_Device this, Opal_DescriptorSetLayout descriptor_set_layout);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceDestroyPipelineLayout)(Opal_Device this, Opal_PipelineLayout pipeline_layout);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceDestroyGraphicsPipeline)(Opal_Device this, Opal_GraphicsPipeline pipeline);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceDestroyComputePipeline)(Opal_Device this, Opal_ComputePipeline pipeline);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceDestroyRaytracePipeline)(Opal_Device this, Opal_RaytracePipeline pipeline);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceDestroySwapchain)(Opal_Device this, Opal_Swapchain swapchain);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceDestroy)(Opal_Device this);
+
+Opal_Result OPAL_BACKEND_FUNCTION(deviceBuildShaderBindingTable)(Opal_Device this, Opal_ShaderBindingTable shader_binding_table, const Opal_ShaderBindingTableBuildDesc *desc);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceBuildAccelerationStructureInstanceBuffer)(Opal_Device this, const Opal_AccelerationStructureInstanceBufferBuildDesc *desc);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceResetCommandAllocator)(Opal_Device this, Opal_CommandAllocator command_allocator);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceAllocateDescriptorSet)(Opal_Device this, const Opal_DescriptorSetAllocationDesc *desc, Opal_DescriptorSet *descriptor_set);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceFreeDescriptorSet)(Opal_Device this, Opal_DescriptorSet descriptor_set);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceMapBuffer)(Opal_Device this, Opal_Buffer buffer, void **ptr);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceUnmapBuffer)(Opal_Device this, Opal_Buffer buffer);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceWriteBuffer)(Opal_Device this, Opal_Buffer buffer, uint64_t offset, const void *data, uint64_t size);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceUpdateDescriptorSet)(Opal_Device this, Opal_DescriptorSet descriptor_set, uint32_t num_entries, const Opal_DescriptorSetEntry *entries);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceBeginCommandBuffer)(Opal_Device this, Opal_CommandBuffer command_buffer);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceEndCommandBuffer)(Opal_Device this, Opal_CommandBuffer command_buffer);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceQuerySemaphore)(Opal_Device this, Opal_Semaphore semaphore, uint64_t *value);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceSignalSemaphore)(Opal_Device this, Opal_Semaphore semaphore, uint64_t value);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceWaitSemaphore)(Opal_Device this, Opal_Semaphore semaphore, uint64_t value, uint64_t timeout_milliseconds);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceWaitSemaphores)(Opal_Device this, uint32_t num_semaphores, const Opal_Semaphore *semaphores, const uint64_t *values, uint32_t wait_any, uint64_t timeout_milliseconds);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceRegisterSemaphoreCallback)(Opal_Device this, Opal_Semaphore semaphore, uint64_t value, PFN_opalSemaphoreCallback callback, void *user_data);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceWaitPipelineTask)(Opal_Device this, Opal_PipelineTask task, uint64_t timeout_milliseconds);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceWaitQueue)(Opal_Device this, Opal_Queue queue);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceWaitIdle)(Opal_Device this);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceSubmit)(Opal_Device this, Opal_Queue queue, const Opal_SubmitDesc *desc);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceAcquire)(Opal_Device this, Opal_Swapchain swapchain, Opal_TextureView *texture_view);
+Opal_Result OPAL_BACKEND_FUNCTION(devicePresent)(Opal_Device this, Opal_Swapchain swapchain);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceWaitPresent)(Opal_Device this, Opal_Swapchain swapchain, uint64_t frame_id, uint64_t timeout_milliseconds);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceGetSwapchainFrameTiming)(Opal_Device this, Opal_Swapchain swapchain, Opal_FrameTiming *timing);
+
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdSetDescriptorHeap)(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_DescriptorHeap descriptor_heap);
+
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdBeginGraphicsPass)(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_FramebufferDesc *desc, const Opal_PassBarriersDesc *barriers);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdGraphicsSetPipelineLayout)(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdGraphicsSetPipeline)(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_GraphicsPipeline pipeline);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdGraphicsSetDescriptorSet)(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdGraphicsSetVertexBuffers)(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t first_index, uint32_t num_vertex_buffers, const Opal_VertexBufferView *vertex_buffers);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdGraphicsSetIndexBuffer)(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_IndexBufferView index_buffer);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdGraphicsSetViewport)(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Viewport viewport);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdGraphicsSetScissor)(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdGraphicsDraw)(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_vertices, uint32_t num_instances, uint32_t base_vertex, uint32_t base_instance);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdGraphicsDrawIndexed)(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_indices, uint32_t num_instances, uint32_t base_index, int32_t vertex_offset, uint32_t base_instance);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdGraphicsMeshletDispatch)(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_threadgroups_x, uint32_t num_threadgroups_y, uint32_t num_threadgroups_z);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdEndGraphicsPass)(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers);
+
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdBeginComputePass)(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdComputeSetPipelineLayout)(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdComputeSetPipeline)(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_ComputePipeline pipeline);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdComputeSetDescriptorSet)(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdComputeMemoryBarrier)(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_MemoryBarrierDesc *barriers);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdComputeDispatch)(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_threadgroups_x, uint32_t num_threadgroups_y, uint32_t num_threadgroups_z);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdEndComputePass)(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers);
+
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdBeginRaytracePass)(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdRaytraceSetPipelineLayout)(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdRaytraceSetPipeline)(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_ComputePipeline pipeline);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdRaytraceSetDescriptorSet)(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdRaytraceSetShaderBindingTable)(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_ShaderBindingTable shader_binding_table);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdRaytraceMemoryBarrier)(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_MemoryBarrierDesc *barriers);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdRaytraceDispatch)(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t width, uint32_t height, uint32_t depth);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdEndRaytracePass)(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers);
+
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdBeginCopyPass)(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdCopyBufferToBuffer)(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer src_buffer, uint64_t src_offset, Opal_Buffer dst_buffer, uint64_t dst_offset, uint64_t size);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdCopyBufferToTexture)(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_BufferTextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdCopyTextureToBuffer)(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_BufferTextureRegion dst, Opal_Extent3D size);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdCopyBufferToTextureRegions)(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer src_buffer, Opal_Texture dst_texture, uint32_t num_regions, const Opal_BufferTextureCopyRegion *regions);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdCopyTextureToBufferRegions)(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Texture src_texture, Opal_Buffer dst_buffer, uint32_t num_regions, const Opal_BufferTextureCopyRegion *regions);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdCopyTextureToTexture)(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdFillBuffer)(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer buffer, uint64_t offset, uint64_t size, uint32_t value);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdUpdateBuffer)(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer buffer, uint64_t offset, uint64_t size, const void *data);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdClearTexture)(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureView texture_view, Opal_ClearValue clear_value);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdBlitTexture)(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_Extent3D src_size, Opal_TextureRegion dst, Opal_Extent3D dst_size, Opal_SamplerFilterMode filter);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdGenerateMips)(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureView texture_view);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdEndCopyPass)(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers);
+
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdBeginAccelerationStructurePass)(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdAccelerationStructureBuild)(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureBuildDesc *desc);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdAccelerationStructureBuildBatch)(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_descs, const Opal_AccelerationStructureBuildDesc *descs);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdAccelerationStructureCopy)(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureCopyDesc *desc);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdAccelerationStructureWriteCompactedSizes)(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_acceleration_structures, const Opal_AccelerationStructure *acceleration_structures, Opal_BufferView dst);
+Opal_Result OPAL_BACKEND_FUNCTION(deviceCmdEndAccelerationStructurePass)(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers);
+#endif
@@ -0,0 +1,247 @@
+#include "profile_internal.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PROFILE_DEFAULT_FRAME_EVENTS 256
+#define PROFILE_TRACE_BUFFER_SIZE 0x10000
+
+/*
+ */
+static double profile_profilerGetMicroseconds(const Profile_Profiler *profiler, uint64_t ticks)
+{
+	assert(profiler);
+	return (double)ticks * profiler->nanoseconds_per_tick / 1000.0;
+}
+
+static void profile_profilerWriteEvent(const Profile_Profiler *profiler, FILE *file, uint32_t index, const Profile_Event *event)
+{
+	assert(profiler);
+	assert(file);
+	assert(event);
+
+	fprintf(file, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":%.3f,\"dur\":%.3f}",
+		(index > 0) ? ",\n" : "",
+		capture_getCallName((Capture_Call)event->call),
+		profile_profilerGetMicroseconds(profiler, event->begin - profiler->base_ticks),
+		profile_profilerGetMicroseconds(profiler, event->duration)
+	);
+}
+
+static void profile_profilerWriteFrameMarker(const Profile_Profiler *profiler, FILE *file, uint32_t index, uint64_t frame, uint64_t ticks)
+{
+	assert(profiler);
+	assert(file);
+
+	fprintf(file, "%s{\"name\":\"frame %llu\",\"ph\":\"i\",\"s\":\"g\",\"pid\":0,\"tid\":0,\"ts\":%.3f}",
+		(index > 0) ? ",\n" : "",
+		(unsigned long long)frame,
+		profile_profilerGetMicroseconds(profiler, ticks - profiler->base_ticks)
+	);
+}
+
+/*
+ */
+Opal_Result profile_profilerInitialize(Profile_Profiler *profiler, const Opal_ProfilerDesc *desc)
+{
+	assert(profiler);
+	assert(desc);
+
+	memset(profiler, 0, sizeof(Profile_Profiler));
+
+	if (desc->trace_path)
+	{
+		profiler->trace = fopen(desc->trace_path, "wb");
+		if (profiler->trace == NULL)
+			return OPAL_INVALID_PROFILER;
+
+		setvbuf(profiler->trace, NULL, _IOFBF, PROFILE_TRACE_BUFFER_SIZE);
+		fprintf(profiler->trace, "[\n");
+	}
+
+	for (uint32_t i = 0; i < CAPTURE_CALL_ENUM_MAX; ++i)
+		opal_histogramReset(&profiler->histograms[i]);
+
+	if (desc->num_frames > 0)
+	{
+		profiler->frames = (Profile_Frame *)calloc(desc->num_frames, sizeof(Profile_Frame));
+		profiler->num_frames = desc->num_frames;
+	}
+
+	profiler->nanoseconds_per_tick = opal_timerCalibrate();
+	profiler->base_ticks = opal_timerGetTicks();
+
+	return OPAL_SUCCESS;
+}
+
+Opal_Result profile_profilerShutdown(Profile_Profiler *profiler)
+{
+	assert(profiler);
+
+	if (profiler->trace)
+	{
+		fprintf(profiler->trace, "\n]\n");
+		fclose(profiler->trace);
+	}
+
+	for (uint32_t i = 0; i < profiler->num_frames; ++i)
+		free(profiler->frames[i].events);
+
+	free(profiler->frames);
+	return OPAL_SUCCESS;
+}
+
+void profile_profilerRecord(Profile_Profiler *profiler, Capture_Call call, uint64_t begin, uint64_t end)
+{
+	assert(profiler);
+	assert(call < CAPTURE_CALL_ENUM_MAX);
+
+	uint64_t duration = end - begin;
+	opal_histogramAdd(&profiler->histograms[call], (uint64_t)((double)duration * profiler->nanoseconds_per_tick));
+
+	Profile_Event event = {call, begin, duration};
+
+	if (profiler->trace)
+		profile_profilerWriteEvent(profiler, profiler->trace, profiler->num_trace_events++, &event);
+
+	if (profiler->num_frames == 0)
+		return;
+
+	Profile_Frame *frame = &profiler->frames[profiler->current_frame];
+	if (frame->num_events == frame->capacity)
+	{
+		frame->capacity = (frame->capacity == 0) ? PROFILE_DEFAULT_FRAME_EVENTS : frame->capacity * 2;
+		frame->events = (Profile_Event *)realloc(frame->events, sizeof(Profile_Event) * frame->capacity);
+		assert(frame->events);
+	}
+
+	frame->events[frame->num_events++] = event;
+}
+
+void profile_profilerEndFrame(Profile_Profiler *profiler)
+{
+	assert(profiler);
+
+	if (profiler->trace)
+		profile_profilerWriteFrameMarker(profiler, profiler->trace, profiler->num_trace_events++, profiler->frame_index, opal_timerGetTicks());
+
+	profiler->frame_index++;
+
+	if (profiler->num_frames == 0)
+		return;
+
+	profiler->current_frame = (profiler->current_frame + 1) % profiler->num_frames;
+	profiler->frames[profiler->current_frame].num_events = 0;
+}
+
+/*
+ */
+Opal_Result profile_opalCreateProfiler(const Opal_ProfilerDesc *desc, Opal_Profiler *profiler)
+{
+	assert(desc);
+	assert(profiler);
+
+	Profile_Profiler *ptr = (Profile_Profiler *)malloc(sizeof(Profile_Profiler));
+	assert(ptr);
+
+	Opal_Result result = profile_profilerInitialize(ptr, desc);
+	if (result != OPAL_SUCCESS)
+	{
+		free(ptr);
+		return result;
+	}
+
+	*profiler = (Opal_Profiler)ptr;
+	return OPAL_SUCCESS;
+}
+
+Opal_Result profile_opalGetProfilerStats(Opal_Profiler profiler, uint32_t *num_stats, Opal_ProfilerCallStats *stats)
+{
+	assert(profiler);
+	assert(num_stats);
+
+	const Profile_Profiler *ptr = (const Profile_Profiler *)profiler;
+	uint32_t count = 0;
+
+	for (uint32_t i = 0; i < CAPTURE_CALL_ENUM_MAX; ++i)
+	{
+		const Opal_Histogram *histogram = &ptr->histograms[i];
+		if (histogram->count == 0)
+			continue;
+
+		if (stats && count < *num_stats)
+		{
+			Opal_ProfilerCallStats *entry = &stats[count];
+			entry->name = capture_getCallName((Capture_Call)i);
+			entry->count = histogram->count;
+			entry->total_ns = histogram->sum;
+			entry->p50_ns = opal_histogramGetPercentile(histogram, 0.50);
+			entry->p99_ns = opal_histogramGetPercentile(histogram, 0.99);
+			entry->max_ns = histogram->max;
+		}
+
+		count++;
+	}
+
+	if (stats == NULL || *num_stats > count)
+		*num_stats = count;
+
+	return OPAL_SUCCESS;
+}
+
+Opal_Result profile_opalResetProfilerStats(Opal_Profiler profiler)
+{
+	assert(profiler);
+
+	Profile_Profiler *ptr = (Profile_Profiler *)profiler;
+
+	for (uint32_t i = 0; i < CAPTURE_CALL_ENUM_MAX; ++i)
+		opal_histogramReset(&ptr->histograms[i]);
+
+	return OPAL_SUCCESS;
+}
+
+Opal_Result profile_opalWriteProfilerFrames(Opal_Profiler profiler, const char *path)
+{
+	assert(profiler);
+	assert(path);
+
+	const Profile_Profiler *ptr = (const Profile_Profiler *)profiler;
+	if (ptr->num_frames == 0)
+		return OPAL_NOT_SUPPORTED;
+
+	FILE *file = fopen(path, "wb");
+	if (file == NULL)
+		return OPAL_INVALID_OUTPUT_ARGUMENT;
+
+	fprintf(file, "[\n");
+
+	uint32_t index = 0;
+
+	// note: the oldest frame follows the current one in the ring, the current one is still being recorded
+	for (uint32_t i = 1; i <= ptr->num_frames; ++i)
+	{
+		const Profile_Frame *frame = &ptr->frames[(ptr->current_frame + i) % ptr->num_frames];
+
+		for (uint32_t j = 0; j < frame->num_events; ++j)
+			profile_profilerWriteEvent(ptr, file, index++, &frame->events[j]);
+	}
+
+	fprintf(file, "\n]\n");
+	fclose(file);
+
+	return OPAL_SUCCESS;
+}
+
+Opal_Result profile_opalDestroyProfiler(Opal_Profiler profiler)
+{
+	assert(profiler);
+
+	Profile_Profiler *ptr = (Profile_Profiler *)profiler;
+
+	profile_profilerShutdown(ptr);
+	free(ptr);
+
+	return OPAL_SUCCESS;
+}
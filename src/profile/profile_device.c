@@ -0,0 +1,1765 @@
+#include "profile_internal.h"
+
+#include <assert.h>
+#include <stdlib.h>
+
+/*
+ */
+static Opal_Result profile_deviceGetDeviceInfo(Opal_Device this, Opal_DeviceInfo *info)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.getDeviceInfo(device_ptr->next_device, info);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_GET_DEVICE_INFO, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceGetDeviceQueue(Opal_Device this, Opal_DeviceEngineType engine_type, uint32_t index, Opal_Queue *queue)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.getDeviceQueue(device_ptr->next_device, engine_type, index, queue);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_GET_DEVICE_QUEUE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceGetAccelerationStructurePrebuildInfo(Opal_Device this, const Opal_AccelerationStructureBuildDesc *desc, Opal_AccelerationStructurePrebuildInfo *info)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.getAccelerationStructurePrebuildInfo(device_ptr->next_device, desc, info);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_GET_ACCELERATION_STRUCTURE_PREBUILD_INFO, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceGetAccelerationStructureAddress(Opal_Device this, Opal_AccelerationStructure acceleration_structure, uint64_t *address)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.getAccelerationStructureAddress(device_ptr->next_device, acceleration_structure, address);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_GET_ACCELERATION_STRUCTURE_ADDRESS, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceGetSupportedSurfaceFormats(Opal_Device this, Opal_Surface surface, uint32_t *num_formats, Opal_SurfaceFormat *formats)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.getSupportedSurfaceFormats(device_ptr->next_device, surface, num_formats, formats);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_GET_SUPPORTED_SURFACE_FORMATS, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceGetSupportedPresentModes(Opal_Device this, Opal_Surface surface, uint32_t *num_present_modes, Opal_PresentMode *present_modes)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.getSupportedPresentModes(device_ptr->next_device, surface, num_present_modes, present_modes);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_GET_SUPPORTED_PRESENT_MODES, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceGetPreferredSurfaceFormat(Opal_Device this, Opal_Surface surface, Opal_SurfaceFormat *format)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.getPreferredSurfaceFormat(device_ptr->next_device, surface, format);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_GET_PREFERRED_SURFACE_FORMAT, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceGetPreferredSurfacePresentMode(Opal_Device this, Opal_Surface surface, Opal_PresentMode *present_mode)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.getPreferredSurfacePresentMode(device_ptr->next_device, surface, present_mode);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_GET_PREFERRED_SURFACE_PRESENT_MODE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCreateSemaphore(Opal_Device this, const Opal_SemaphoreDesc *desc, Opal_Semaphore *semaphore)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.createSemaphore(device_ptr->next_device, desc, semaphore);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CREATE_SEMAPHORE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCreateFence(Opal_Device this, Opal_Fence *fence)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.createFence(device_ptr->next_device, fence);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CREATE_FENCE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCreateBuffer(Opal_Device this, const Opal_BufferDesc *desc, Opal_Buffer *buffer)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.createBuffer(device_ptr->next_device, desc, buffer);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CREATE_BUFFER, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCreateTexture(Opal_Device this, const Opal_TextureDesc *desc, Opal_Texture *texture)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.createTexture(device_ptr->next_device, desc, texture);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CREATE_TEXTURE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCreateTextureView(Opal_Device this, const Opal_TextureViewDesc *desc, Opal_TextureView *texture_view)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.createTextureView(device_ptr->next_device, desc, texture_view);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CREATE_TEXTURE_VIEW, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCreateSampler(Opal_Device this, const Opal_SamplerDesc *desc, Opal_Sampler *sampler)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.createSampler(device_ptr->next_device, desc, sampler);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CREATE_SAMPLER, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCreateAccelerationStructure(Opal_Device this, const Opal_AccelerationStructureDesc *desc, Opal_AccelerationStructure *acceleration_structure)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.createAccelerationStructure(device_ptr->next_device, desc, acceleration_structure);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CREATE_ACCELERATION_STRUCTURE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCreateShaderBindingTable(Opal_Device this, Opal_RaytracePipeline pipeline, Opal_ShaderBindingTable *shader_binding_table)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.createShaderBindingTable(device_ptr->next_device, pipeline, shader_binding_table);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CREATE_SHADER_BINDING_TABLE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCreateCommandAllocator(Opal_Device this, Opal_Queue queue, Opal_CommandAllocator *command_allocator)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.createCommandAllocator(device_ptr->next_device, queue, command_allocator);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CREATE_COMMAND_ALLOCATOR, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCreateCommandBuffer(Opal_Device this, Opal_CommandAllocator command_allocator, Opal_CommandBuffer *command_buffer)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.createCommandBuffer(device_ptr->next_device, command_allocator, command_buffer);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CREATE_COMMAND_BUFFER, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCreateShader(Opal_Device this, const Opal_ShaderDesc *desc, Opal_Shader *shader)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.createShader(device_ptr->next_device, desc, shader);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CREATE_SHADER, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCreateDescriptorHeap(Opal_Device this, const Opal_DescriptorHeapDesc *desc, Opal_DescriptorHeap *descriptor_buffer)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.createDescriptorHeap(device_ptr->next_device, desc, descriptor_buffer);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CREATE_DESCRIPTOR_HEAP, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCreateDescriptorSetLayout(Opal_Device this, uint32_t num_entries, const Opal_DescriptorSetLayoutEntry *entries, Opal_DescriptorSetLayout *descriptor_set_layout)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.createDescriptorSetLayout(device_ptr->next_device, num_entries, entries, descriptor_set_layout);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CREATE_DESCRIPTOR_SET_LAYOUT, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCreatePipelineLayout(Opal_Device this, uint32_t num_descriptor_setlayouts, const Opal_DescriptorSetLayout *descriptor_set_layouts, Opal_PipelineLayout *pipeline_layout)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.createPipelineLayout(device_ptr->next_device, num_descriptor_setlayouts, descriptor_set_layouts, pipeline_layout);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CREATE_PIPELINE_LAYOUT, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCreateGraphicsPipeline(Opal_Device this, const Opal_GraphicsPipelineDesc *desc, Opal_GraphicsPipeline *pipeline)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.createGraphicsPipeline(device_ptr->next_device, desc, pipeline);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CREATE_GRAPHICS_PIPELINE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCreateMeshletPipeline(Opal_Device this, const Opal_MeshletPipelineDesc *desc, Opal_GraphicsPipeline *pipeline)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.createMeshletPipeline(device_ptr->next_device, desc, pipeline);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CREATE_MESHLET_PIPELINE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCreateComputePipeline(Opal_Device this, const Opal_ComputePipelineDesc *desc, Opal_ComputePipeline *pipeline)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.createComputePipeline(device_ptr->next_device, desc, pipeline);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CREATE_COMPUTE_PIPELINE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCreateRaytracePipeline(Opal_Device this, const Opal_RaytracePipelineDesc *desc, Opal_RaytracePipeline *pipeline)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.createRaytracePipeline(device_ptr->next_device, desc, pipeline);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CREATE_RAYTRACE_PIPELINE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCreateGraphicsPipelines(Opal_Device this, uint32_t num_pipelines, const Opal_GraphicsPipelineDesc *descs, Opal_GraphicsPipeline *pipelines)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.createGraphicsPipelines(device_ptr->next_device, num_pipelines, descs, pipelines);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CREATE_GRAPHICS_PIPELINES, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCreateComputePipelines(Opal_Device this, uint32_t num_pipelines, const Opal_ComputePipelineDesc *descs, Opal_ComputePipeline *pipelines)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.createComputePipelines(device_ptr->next_device, num_pipelines, descs, pipelines);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CREATE_COMPUTE_PIPELINES, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCreateRaytracePipelines(Opal_Device this, uint32_t num_pipelines, const Opal_RaytracePipelineDesc *descs, Opal_RaytracePipeline *pipelines)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.createRaytracePipelines(device_ptr->next_device, num_pipelines, descs, pipelines);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CREATE_RAYTRACE_PIPELINES, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCreateGraphicsPipelinesAsync(Opal_Device this, uint32_t num_pipelines, const Opal_GraphicsPipelineDesc *descs, Opal_GraphicsPipeline *pipelines, Opal_PipelineTask *task)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.createGraphicsPipelinesAsync(device_ptr->next_device, num_pipelines, descs, pipelines, task);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CREATE_GRAPHICS_PIPELINES_ASYNC, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCreateComputePipelinesAsync(Opal_Device this, uint32_t num_pipelines, const Opal_ComputePipelineDesc *descs, Opal_ComputePipeline *pipelines, Opal_PipelineTask *task)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.createComputePipelinesAsync(device_ptr->next_device, num_pipelines, descs, pipelines, task);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CREATE_COMPUTE_PIPELINES_ASYNC, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCreateRaytracePipelinesAsync(Opal_Device this, uint32_t num_pipelines, const Opal_RaytracePipelineDesc *descs, Opal_RaytracePipeline *pipelines, Opal_PipelineTask *task)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.createRaytracePipelinesAsync(device_ptr->next_device, num_pipelines, descs, pipelines, task);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CREATE_RAYTRACE_PIPELINES_ASYNC, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCreateSwapchain(Opal_Device this, const Opal_SwapchainDesc *desc, Opal_Swapchain *swapchain)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.createSwapchain(device_ptr->next_device, desc, swapchain);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CREATE_SWAPCHAIN, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceDestroySemaphore(Opal_Device this, Opal_Semaphore semaphore)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.destroySemaphore(device_ptr->next_device, semaphore);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_DESTROY_SEMAPHORE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceDestroyFence(Opal_Device this, Opal_Fence fence)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.destroyFence(device_ptr->next_device, fence);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_DESTROY_FENCE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceDestroyBuffer(Opal_Device this, Opal_Buffer buffer)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.destroyBuffer(device_ptr->next_device, buffer);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_DESTROY_BUFFER, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceDestroyTexture(Opal_Device this, Opal_Texture texture)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.destroyTexture(device_ptr->next_device, texture);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_DESTROY_TEXTURE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceDestroyTextureView(Opal_Device this, Opal_TextureView texture_view)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.destroyTextureView(device_ptr->next_device, texture_view);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_DESTROY_TEXTURE_VIEW, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceDestroySampler(Opal_Device this, Opal_Sampler sampler)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.destroySampler(device_ptr->next_device, sampler);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_DESTROY_SAMPLER, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceDestroyAccelerationStructure(Opal_Device this, Opal_AccelerationStructure acceleration_structure)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.destroyAccelerationStructure(device_ptr->next_device, acceleration_structure);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_DESTROY_ACCELERATION_STRUCTURE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceDestroyShaderBindingTable(Opal_Device this, Opal_ShaderBindingTable shader_binding_table)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.destroyShaderBindingTable(device_ptr->next_device, shader_binding_table);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_DESTROY_SHADER_BINDING_TABLE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceDestroyCommandAllocator(Opal_Device this, Opal_CommandAllocator command_allocator)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.destroyCommandAllocator(device_ptr->next_device, command_allocator);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_DESTROY_COMMAND_ALLOCATOR, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceDestroyCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.destroyCommandBuffer(device_ptr->next_device, command_buffer);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_DESTROY_COMMAND_BUFFER, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceDestroyShader(Opal_Device this, Opal_Shader shader)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.destroyShader(device_ptr->next_device, shader);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_DESTROY_SHADER, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceDestroyDescriptorHeap(Opal_Device this, Opal_DescriptorHeap descriptor_buffer)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.destroyDescriptorHeap(device_ptr->next_device, descriptor_buffer);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_DESTROY_DESCRIPTOR_HEAP, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceDestroyDescriptorSetLayout(Opal_Device this, Opal_DescriptorSetLayout descriptor_set_layout)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.destroyDescriptorSetLayout(device_ptr->next_device, descriptor_set_layout);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_DESTROY_DESCRIPTOR_SET_LAYOUT, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceDestroyPipelineLayout(Opal_Device this, Opal_PipelineLayout pipeline_layout)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.destroyPipelineLayout(device_ptr->next_device, pipeline_layout);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_DESTROY_PIPELINE_LAYOUT, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceDestroyGraphicsPipeline(Opal_Device this, Opal_GraphicsPipeline pipeline)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.destroyGraphicsPipeline(device_ptr->next_device, pipeline);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_DESTROY_GRAPHICS_PIPELINE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceDestroyComputePipeline(Opal_Device this, Opal_ComputePipeline pipeline)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.destroyComputePipeline(device_ptr->next_device, pipeline);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_DESTROY_COMPUTE_PIPELINE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceDestroyRaytracePipeline(Opal_Device this, Opal_RaytracePipeline pipeline)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.destroyRaytracePipeline(device_ptr->next_device, pipeline);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_DESTROY_RAYTRACE_PIPELINE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceDestroySwapchain(Opal_Device this, Opal_Swapchain swapchain)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.destroySwapchain(device_ptr->next_device, swapchain);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_DESTROY_SWAPCHAIN, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceDestroyDevice(Opal_Device this)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.destroyDevice(device_ptr->next_device);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_DESTROY_DEVICE, begin, opal_timerGetTicks());
+
+	free(device_ptr);
+
+	return result;
+}
+
+static Opal_Result profile_deviceBuildShaderBindingTable(Opal_Device this, Opal_ShaderBindingTable shader_binding_table, const Opal_ShaderBindingTableBuildDesc *desc)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.buildShaderBindingTable(device_ptr->next_device, shader_binding_table, desc);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_BUILD_SHADER_BINDING_TABLE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceBuildAccelerationStructureInstanceBuffer(Opal_Device this, const Opal_AccelerationStructureInstanceBufferBuildDesc *desc)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.buildAccelerationStructureInstanceBuffer(device_ptr->next_device, desc);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_BUILD_ACCELERATION_STRUCTURE_INSTANCE_BUFFER, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceResetCommandAllocator(Opal_Device this, Opal_CommandAllocator command_allocator)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.resetCommandAllocator(device_ptr->next_device, command_allocator);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_RESET_COMMAND_ALLOCATOR, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceAllocateDescriptorSet(Opal_Device this, const Opal_DescriptorSetAllocationDesc *desc, Opal_DescriptorSet *descriptor_set)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.allocateDescriptorSet(device_ptr->next_device, desc, descriptor_set);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_ALLOCATE_DESCRIPTOR_SET, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceFreeDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.freeDescriptorSet(device_ptr->next_device, descriptor_set);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_FREE_DESCRIPTOR_SET, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceMapBuffer(Opal_Device this, Opal_Buffer buffer, void **ptr)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.mapBuffer(device_ptr->next_device, buffer, ptr);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_MAP_BUFFER, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceUnmapBuffer(Opal_Device this, Opal_Buffer buffer)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.unmapBuffer(device_ptr->next_device, buffer);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_UNMAP_BUFFER, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceWriteBuffer(Opal_Device this, Opal_Buffer buffer, uint64_t offset, const void *data, uint64_t size)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.writeBuffer(device_ptr->next_device, buffer, offset, data, size);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_WRITE_BUFFER, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceUpdateDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set, uint32_t num_entries, const Opal_DescriptorSetEntry *entries)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.updateDescriptorSet(device_ptr->next_device, descriptor_set, num_entries, entries);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_UPDATE_DESCRIPTOR_SET, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceBeginCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.beginCommandBuffer(device_ptr->next_device, command_buffer);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_BEGIN_COMMAND_BUFFER, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceEndCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.endCommandBuffer(device_ptr->next_device, command_buffer);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_END_COMMAND_BUFFER, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceQuerySemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t *value)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.querySemaphore(device_ptr->next_device, semaphore, value);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_QUERY_SEMAPHORE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceSignalSemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t value)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.signalSemaphore(device_ptr->next_device, semaphore, value);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_SIGNAL_SEMAPHORE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceWaitSemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t value, uint64_t timeout_milliseconds)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.waitSemaphore(device_ptr->next_device, semaphore, value, timeout_milliseconds);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_WAIT_SEMAPHORE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceWaitSemaphores(Opal_Device this, uint32_t num_semaphores, const Opal_Semaphore *semaphores, const uint64_t *values, uint32_t wait_any, uint64_t timeout_milliseconds)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.waitSemaphores(device_ptr->next_device, num_semaphores, semaphores, values, wait_any, timeout_milliseconds);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_WAIT_SEMAPHORES, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceRegisterSemaphoreCallback(Opal_Device this, Opal_Semaphore semaphore, uint64_t value, PFN_opalSemaphoreCallback callback, void *user_data)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.registerSemaphoreCallback(device_ptr->next_device, semaphore, value, callback, user_data);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_REGISTER_SEMAPHORE_CALLBACK, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceWaitPipelineTask(Opal_Device this, Opal_PipelineTask task, uint64_t timeout_milliseconds)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.waitPipelineTask(device_ptr->next_device, task, timeout_milliseconds);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_WAIT_PIPELINE_TASK, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceWaitQueue(Opal_Device this, Opal_Queue queue)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.waitQueue(device_ptr->next_device, queue);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_WAIT_QUEUE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceWaitIdle(Opal_Device this)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.waitIdle(device_ptr->next_device);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_WAIT_IDLE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceSubmit(Opal_Device this, Opal_Queue queue, const Opal_SubmitDesc *desc)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.submit(device_ptr->next_device, queue, desc);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_SUBMIT, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceAcquire(Opal_Device this, Opal_Swapchain swapchain, Opal_TextureView *texture_view)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.acquire(device_ptr->next_device, swapchain, texture_view);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_ACQUIRE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_devicePresent(Opal_Device this, Opal_Swapchain swapchain)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.present(device_ptr->next_device, swapchain);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_PRESENT, begin, opal_timerGetTicks());
+
+	profile_profilerEndFrame(device_ptr->profiler);
+
+	return result;
+}
+
+static Opal_Result profile_deviceWaitPresent(Opal_Device this, Opal_Swapchain swapchain, uint64_t frame_id, uint64_t timeout_milliseconds)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.waitPresent(device_ptr->next_device, swapchain, frame_id, timeout_milliseconds);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_WAIT_PRESENT, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceGetSwapchainFrameTiming(Opal_Device this, Opal_Swapchain swapchain, Opal_FrameTiming *timing)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.getSwapchainFrameTiming(device_ptr->next_device, swapchain, timing);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_GET_SWAPCHAIN_FRAME_TIMING, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdSetDescriptorHeap(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_DescriptorHeap descriptor_heap)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdSetDescriptorHeap(device_ptr->next_device, command_buffer, descriptor_heap);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_SET_DESCRIPTOR_HEAP, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdBeginGraphicsPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_FramebufferDesc *desc, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdBeginGraphicsPass(device_ptr->next_device, command_buffer, desc, barriers);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_BEGIN_GRAPHICS_PASS, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdGraphicsSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdGraphicsSetPipelineLayout(device_ptr->next_device, command_buffer, pipeline_layout);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_GRAPHICS_SET_PIPELINE_LAYOUT, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdGraphicsSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_GraphicsPipeline pipeline)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdGraphicsSetPipeline(device_ptr->next_device, command_buffer, pipeline);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_GRAPHICS_SET_PIPELINE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdGraphicsSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdGraphicsSetDescriptorSet(device_ptr->next_device, command_buffer, index, descriptor_set, num_dynamic_offsets, dynamic_offsets);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_GRAPHICS_SET_DESCRIPTOR_SET, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdGraphicsSetVertexBuffers(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t first_index, uint32_t num_vertex_buffers, const Opal_VertexBufferView *vertex_buffers)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdGraphicsSetVertexBuffers(device_ptr->next_device, command_buffer, first_index, num_vertex_buffers, vertex_buffers);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_GRAPHICS_SET_VERTEX_BUFFERS, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdGraphicsSetIndexBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_IndexBufferView index_buffer)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdGraphicsSetIndexBuffer(device_ptr->next_device, command_buffer, index_buffer);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_GRAPHICS_SET_INDEX_BUFFER, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdGraphicsSetViewport(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Viewport viewport)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdGraphicsSetViewport(device_ptr->next_device, command_buffer, viewport);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_GRAPHICS_SET_VIEWPORT, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdGraphicsSetScissor(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdGraphicsSetScissor(device_ptr->next_device, command_buffer, x, y, width, height);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_GRAPHICS_SET_SCISSOR, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdGraphicsDraw(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_vertices, uint32_t num_instances, uint32_t base_vertex, uint32_t base_instance)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdGraphicsDraw(device_ptr->next_device, command_buffer, num_vertices, num_instances, base_vertex, base_instance);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_GRAPHICS_DRAW, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdGraphicsDrawIndexed(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_indices, uint32_t num_instances, uint32_t base_index, int32_t vertex_offset, uint32_t base_instance)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdGraphicsDrawIndexed(device_ptr->next_device, command_buffer, num_indices, num_instances, base_index, vertex_offset, base_instance);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_GRAPHICS_DRAW_INDEXED, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdGraphicsMeshletDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_threadgroups_x, uint32_t num_threadgroups_y, uint32_t num_threadgroups_z)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdGraphicsMeshletDispatch(device_ptr->next_device, command_buffer, num_threadgroups_x, num_threadgroups_y, num_threadgroups_z);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_GRAPHICS_MESHLET_DISPATCH, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdEndGraphicsPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdEndGraphicsPass(device_ptr->next_device, command_buffer, barriers);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_END_GRAPHICS_PASS, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdBeginComputePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdBeginComputePass(device_ptr->next_device, command_buffer, barriers);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_BEGIN_COMPUTE_PASS, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdComputeSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdComputeSetPipelineLayout(device_ptr->next_device, command_buffer, pipeline_layout);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_COMPUTE_SET_PIPELINE_LAYOUT, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdComputeSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_ComputePipeline pipeline)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdComputeSetPipeline(device_ptr->next_device, command_buffer, pipeline);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_COMPUTE_SET_PIPELINE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdComputeSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdComputeSetDescriptorSet(device_ptr->next_device, command_buffer, index, descriptor_set, num_dynamic_offsets, dynamic_offsets);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_COMPUTE_SET_DESCRIPTOR_SET, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdComputeMemoryBarrier(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_MemoryBarrierDesc *barriers)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdComputeMemoryBarrier(device_ptr->next_device, command_buffer, barriers);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_COMPUTE_MEMORY_BARRIER, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdComputeDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_threadgroups_x, uint32_t num_threadgroups_y, uint32_t num_threadgroups_z)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdComputeDispatch(device_ptr->next_device, command_buffer, num_threadgroups_x, num_threadgroups_y, num_threadgroups_z);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_COMPUTE_DISPATCH, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdEndComputePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdEndComputePass(device_ptr->next_device, command_buffer, barriers);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_END_COMPUTE_PASS, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdBeginRaytracePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdBeginRaytracePass(device_ptr->next_device, command_buffer, barriers);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_BEGIN_RAYTRACE_PASS, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdRaytraceSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdRaytraceSetPipelineLayout(device_ptr->next_device, command_buffer, pipeline_layout);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_RAYTRACE_SET_PIPELINE_LAYOUT, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdRaytraceSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_ComputePipeline pipeline)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdRaytraceSetPipeline(device_ptr->next_device, command_buffer, pipeline);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_RAYTRACE_SET_PIPELINE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdRaytraceSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdRaytraceSetDescriptorSet(device_ptr->next_device, command_buffer, index, descriptor_set, num_dynamic_offsets, dynamic_offsets);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_RAYTRACE_SET_DESCRIPTOR_SET, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdRaytraceSetShaderBindingTable(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_ShaderBindingTable shader_binding_table)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdRaytraceSetShaderBindingTable(device_ptr->next_device, command_buffer, shader_binding_table);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_RAYTRACE_SET_SHADER_BINDING_TABLE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdRaytraceMemoryBarrier(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_MemoryBarrierDesc *barriers)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdRaytraceMemoryBarrier(device_ptr->next_device, command_buffer, barriers);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_RAYTRACE_MEMORY_BARRIER, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdRaytraceDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t width, uint32_t height, uint32_t depth)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdRaytraceDispatch(device_ptr->next_device, command_buffer, width, height, depth);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_RAYTRACE_DISPATCH, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdEndRaytracePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdEndRaytracePass(device_ptr->next_device, command_buffer, barriers);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_END_RAYTRACE_PASS, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdBeginCopyPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdBeginCopyPass(device_ptr->next_device, command_buffer, barriers);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_BEGIN_COPY_PASS, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdCopyBufferToBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer src_buffer, uint64_t src_offset, Opal_Buffer dst_buffer, uint64_t dst_offset, uint64_t size)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdCopyBufferToBuffer(device_ptr->next_device, command_buffer, src_buffer, src_offset, dst_buffer, dst_offset, size);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_COPY_BUFFER_TO_BUFFER, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdCopyBufferToTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_BufferTextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdCopyBufferToTexture(device_ptr->next_device, command_buffer, src, dst, size);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_COPY_BUFFER_TO_TEXTURE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdCopyTextureToBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_BufferTextureRegion dst, Opal_Extent3D size)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdCopyTextureToBuffer(device_ptr->next_device, command_buffer, src, dst, size);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_COPY_TEXTURE_TO_BUFFER, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdCopyBufferToTextureRegions(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer src_buffer, Opal_Texture dst_texture, uint32_t num_regions, const Opal_BufferTextureCopyRegion *regions)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdCopyBufferToTextureRegions(device_ptr->next_device, command_buffer, src_buffer, dst_texture, num_regions, regions);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_COPY_BUFFER_TO_TEXTURE_REGIONS, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdCopyTextureToBufferRegions(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Texture src_texture, Opal_Buffer dst_buffer, uint32_t num_regions, const Opal_BufferTextureCopyRegion *regions)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdCopyTextureToBufferRegions(device_ptr->next_device, command_buffer, src_texture, dst_buffer, num_regions, regions);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_COPY_TEXTURE_TO_BUFFER_REGIONS, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdCopyTextureToTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdCopyTextureToTexture(device_ptr->next_device, command_buffer, src, dst, size);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_COPY_TEXTURE_TO_TEXTURE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdFillBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer buffer, uint64_t offset, uint64_t size, uint32_t value)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdFillBuffer(device_ptr->next_device, command_buffer, buffer, offset, size, value);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_FILL_BUFFER, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdUpdateBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer buffer, uint64_t offset, uint64_t size, const void *data)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdUpdateBuffer(device_ptr->next_device, command_buffer, buffer, offset, size, data);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_UPDATE_BUFFER, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdClearTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureView texture_view, Opal_ClearValue clear_value)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdClearTexture(device_ptr->next_device, command_buffer, texture_view, clear_value);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_CLEAR_TEXTURE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdBlitTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_Extent3D src_size, Opal_TextureRegion dst, Opal_Extent3D dst_size, Opal_SamplerFilterMode filter)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdBlitTexture(device_ptr->next_device, command_buffer, src, src_size, dst, dst_size, filter);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_BLIT_TEXTURE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdGenerateMips(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureView texture_view)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdGenerateMips(device_ptr->next_device, command_buffer, texture_view);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_GENERATE_MIPS, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdEndCopyPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdEndCopyPass(device_ptr->next_device, command_buffer, barriers);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_END_COPY_PASS, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdBeginAccelerationStructurePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdBeginAccelerationStructurePass(device_ptr->next_device, command_buffer, barriers);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_BEGIN_ACCELERATION_STRUCTURE_PASS, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdAccelerationStructureBuild(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureBuildDesc *desc)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdAccelerationStructureBuild(device_ptr->next_device, command_buffer, desc);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_ACCELERATION_STRUCTURE_BUILD, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdAccelerationStructureBuildBatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_descs, const Opal_AccelerationStructureBuildDesc *descs)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdAccelerationStructureBuildBatch(device_ptr->next_device, command_buffer, num_descs, descs);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_ACCELERATION_STRUCTURE_BUILD_BATCH, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdAccelerationStructureCopy(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureCopyDesc *desc)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdAccelerationStructureCopy(device_ptr->next_device, command_buffer, desc);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_ACCELERATION_STRUCTURE_COPY, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdAccelerationStructureWriteCompactedSizes(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_acceleration_structures, const Opal_AccelerationStructure *acceleration_structures, Opal_BufferView dst)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdAccelerationStructureWriteCompactedSizes(device_ptr->next_device, command_buffer, num_acceleration_structures, acceleration_structures, dst);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_ACCELERATION_STRUCTURE_WRITE_COMPACTED_SIZES, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_deviceCmdEndAccelerationStructurePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+
+	Profile_Device *device_ptr = (Profile_Device *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = device_ptr->next.cmdEndAccelerationStructurePass(device_ptr->next_device, command_buffer, barriers);
+	profile_profilerRecord(device_ptr->profiler, CAPTURE_CALL_CMD_END_ACCELERATION_STRUCTURE_PASS, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+/*
+ */
+static Opal_DeviceTable device_vtbl =
+{
+	profile_deviceGetDeviceInfo,
+	profile_deviceGetDeviceQueue,
+	profile_deviceGetAccelerationStructurePrebuildInfo,
+	profile_deviceGetAccelerationStructureAddress,
+	profile_deviceGetSupportedSurfaceFormats,
+	profile_deviceGetSupportedPresentModes,
+	profile_deviceGetPreferredSurfaceFormat,
+	profile_deviceGetPreferredSurfacePresentMode,
+
+	profile_deviceCreateSemaphore,
+	profile_deviceCreateFence,
+	profile_deviceCreateBuffer,
+	profile_deviceCreateTexture,
+	profile_deviceCreateTextureView,
+	profile_deviceCreateSampler,
+	profile_deviceCreateAccelerationStructure,
+	profile_deviceCreateShaderBindingTable,
+	profile_deviceCreateCommandAllocator,
+	profile_deviceCreateCommandBuffer,
+	profile_deviceCreateShader,
+	profile_deviceCreateDescriptorHeap,
+	profile_deviceCreateDescriptorSetLayout,
+	profile_deviceCreatePipelineLayout,
+	profile_deviceCreateGraphicsPipeline,
+	profile_deviceCreateMeshletPipeline,
+	profile_deviceCreateComputePipeline,
+	profile_deviceCreateRaytracePipeline,
+	profile_deviceCreateGraphicsPipelines,
+	profile_deviceCreateComputePipelines,
+	profile_deviceCreateRaytracePipelines,
+	profile_deviceCreateGraphicsPipelinesAsync,
+	profile_deviceCreateComputePipelinesAsync,
+	profile_deviceCreateRaytracePipelinesAsync,
+	profile_deviceCreateSwapchain,
+
+	profile_deviceDestroySemaphore,
+	profile_deviceDestroyFence,
+	profile_deviceDestroyBuffer,
+	profile_deviceDestroyTexture,
+	profile_deviceDestroyTextureView,
+	profile_deviceDestroySampler,
+	profile_deviceDestroyAccelerationStructure,
+	profile_deviceDestroyShaderBindingTable,
+	profile_deviceDestroyCommandAllocator,
+	profile_deviceDestroyCommandBuffer,
+	profile_deviceDestroyShader,
+	profile_deviceDestroyDescriptorHeap,
+	profile_deviceDestroyDescriptorSetLayout,
+	profile_deviceDestroyPipelineLayout,
+	profile_deviceDestroyGraphicsPipeline,
+	profile_deviceDestroyComputePipeline,
+	profile_deviceDestroyRaytracePipeline,
+	profile_deviceDestroySwapchain,
+	profile_deviceDestroyDevice,
+
+	profile_deviceBuildShaderBindingTable,
+	profile_deviceBuildAccelerationStructureInstanceBuffer,
+	profile_deviceResetCommandAllocator,
+	profile_deviceAllocateDescriptorSet,
+	profile_deviceFreeDescriptorSet,
+	profile_deviceMapBuffer,
+	profile_deviceUnmapBuffer,
+	profile_deviceWriteBuffer,
+	profile_deviceUpdateDescriptorSet,
+	profile_deviceBeginCommandBuffer,
+	profile_deviceEndCommandBuffer,
+	profile_deviceQuerySemaphore,
+	profile_deviceSignalSemaphore,
+	profile_deviceWaitSemaphore,
+	profile_deviceWaitSemaphores,
+	profile_deviceRegisterSemaphoreCallback,
+	profile_deviceWaitPipelineTask,
+	profile_deviceWaitQueue,
+	profile_deviceWaitIdle,
+	profile_deviceSubmit,
+	profile_deviceAcquire,
+	profile_devicePresent,
+	profile_deviceWaitPresent,
+	profile_deviceGetSwapchainFrameTiming,
+
+	profile_deviceCmdSetDescriptorHeap,
+
+	profile_deviceCmdBeginGraphicsPass,
+	profile_deviceCmdGraphicsSetPipelineLayout,
+	profile_deviceCmdGraphicsSetPipeline,
+	profile_deviceCmdGraphicsSetDescriptorSet,
+	profile_deviceCmdGraphicsSetVertexBuffers,
+	profile_deviceCmdGraphicsSetIndexBuffer,
+	profile_deviceCmdGraphicsSetViewport,
+	profile_deviceCmdGraphicsSetScissor,
+	profile_deviceCmdGraphicsDraw,
+	profile_deviceCmdGraphicsDrawIndexed,
+	profile_deviceCmdGraphicsMeshletDispatch,
+	profile_deviceCmdEndGraphicsPass,
+
+	profile_deviceCmdBeginComputePass,
+	profile_deviceCmdComputeSetPipelineLayout,
+	profile_deviceCmdComputeSetPipeline,
+	profile_deviceCmdComputeSetDescriptorSet,
+	profile_deviceCmdComputeMemoryBarrier,
+	profile_deviceCmdComputeDispatch,
+	profile_deviceCmdEndComputePass,
+
+	profile_deviceCmdBeginRaytracePass,
+	profile_deviceCmdRaytraceSetPipelineLayout,
+	profile_deviceCmdRaytraceSetPipeline,
+	profile_deviceCmdRaytraceSetDescriptorSet,
+	profile_deviceCmdRaytraceSetShaderBindingTable,
+	profile_deviceCmdRaytraceMemoryBarrier,
+	profile_deviceCmdRaytraceDispatch,
+	profile_deviceCmdEndRaytracePass,
+
+	profile_deviceCmdBeginCopyPass,
+	profile_deviceCmdCopyBufferToBuffer,
+	profile_deviceCmdCopyBufferToTexture,
+	profile_deviceCmdCopyTextureToBuffer,
+	profile_deviceCmdCopyBufferToTextureRegions,
+	profile_deviceCmdCopyTextureToBufferRegions,
+	profile_deviceCmdCopyTextureToTexture,
+	profile_deviceCmdFillBuffer,
+	profile_deviceCmdUpdateBuffer,
+	profile_deviceCmdClearTexture,
+	profile_deviceCmdBlitTexture,
+	profile_deviceCmdGenerateMips,
+	profile_deviceCmdEndCopyPass,
+
+	profile_deviceCmdBeginAccelerationStructurePass,
+	profile_deviceCmdAccelerationStructureBuild,
+	profile_deviceCmdAccelerationStructureBuildBatch,
+	profile_deviceCmdAccelerationStructureCopy,
+	profile_deviceCmdAccelerationStructureWriteCompactedSizes,
+	profile_deviceCmdEndAccelerationStructurePass,
+};
+
+/*
+ */
+Opal_Result profile_deviceInitialize(Profile_Device *device_ptr, Profile_Profiler *profiler, Opal_Device next_device)
+{
+	assert(device_ptr);
+	assert(profiler);
+	assert(next_device != OPAL_NULL_HANDLE);
+
+	// vtable
+	device_ptr->vtbl = &device_vtbl;
+
+	// data
+	device_ptr->next_device = next_device;
+	device_ptr->profiler = profiler;
+
+	return opalGetDeviceTable(next_device, &device_ptr->next);
+}
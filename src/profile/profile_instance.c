@@ -0,0 +1,199 @@
+#include "profile_internal.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ */
+static Opal_Result profile_instanceWrapDevice(Profile_Instance *instance_ptr, Opal_Device next_device, Opal_Device *device)
+{
+	assert(instance_ptr);
+	assert(device);
+
+	Profile_Device *device_ptr = (Profile_Device *)malloc(sizeof(Profile_Device));
+	assert(device_ptr);
+
+	Opal_Result result = profile_deviceInitialize(device_ptr, instance_ptr->profiler, next_device);
+	if (result != OPAL_SUCCESS)
+	{
+		free(device_ptr);
+		return result;
+	}
+
+	*device = (Opal_Device)device_ptr;
+	return OPAL_SUCCESS;
+}
+
+/*
+ */
+static Opal_Result profile_instanceEnumerateDevices(Opal_Instance this, uint32_t *device_count, Opal_DeviceInfo *infos)
+{
+	assert(this);
+
+	Profile_Instance *instance_ptr = (Profile_Instance *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = instance_ptr->next.enumerateDevices(instance_ptr->next_instance, device_count, infos);
+	profile_profilerRecord(instance_ptr->profiler, CAPTURE_CALL_ENUMERATE_DEVICES, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_instanceCreateSurface(Opal_Instance this, void *handle, Opal_Surface *surface)
+{
+	assert(this);
+
+	Profile_Instance *instance_ptr = (Profile_Instance *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = instance_ptr->next.createSurface(instance_ptr->next_instance, handle, surface);
+	profile_profilerRecord(instance_ptr->profiler, CAPTURE_CALL_CREATE_SURFACE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_instanceCreateHeadlessSurface(Opal_Instance this, uint32_t width, uint32_t height, Opal_Surface *surface)
+{
+	assert(this);
+
+	Profile_Instance *instance_ptr = (Profile_Instance *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = instance_ptr->next.createHeadlessSurface(instance_ptr->next_instance, width, height, surface);
+	profile_profilerRecord(instance_ptr->profiler, CAPTURE_CALL_CREATE_HEADLESS_SURFACE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_instanceCreateDevice(Opal_Instance this, uint32_t index, Opal_Device *device)
+{
+	assert(this);
+	assert(device);
+
+	Profile_Instance *instance_ptr = (Profile_Instance *)this;
+	Opal_Device next_device = OPAL_NULL_HANDLE;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = instance_ptr->next.createDevice(instance_ptr->next_instance, index, &next_device);
+	profile_profilerRecord(instance_ptr->profiler, CAPTURE_CALL_CREATE_DEVICE, begin, opal_timerGetTicks());
+
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	return profile_instanceWrapDevice(instance_ptr, next_device, device);
+}
+
+static Opal_Result profile_instanceCreateDefaultDevice(Opal_Instance this, Opal_DeviceHint hint, Opal_Device *device)
+{
+	assert(this);
+	assert(device);
+
+	Profile_Instance *instance_ptr = (Profile_Instance *)this;
+	Opal_Device next_device = OPAL_NULL_HANDLE;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = instance_ptr->next.createDefaultDevice(instance_ptr->next_instance, hint, &next_device);
+	profile_profilerRecord(instance_ptr->profiler, CAPTURE_CALL_CREATE_DEFAULT_DEVICE, begin, opal_timerGetTicks());
+
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	return profile_instanceWrapDevice(instance_ptr, next_device, device);
+}
+
+static Opal_Result profile_instanceDestroySurface(Opal_Instance this, Opal_Surface surface)
+{
+	assert(this);
+
+	Profile_Instance *instance_ptr = (Profile_Instance *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = instance_ptr->next.destroySurface(instance_ptr->next_instance, surface);
+	profile_profilerRecord(instance_ptr->profiler, CAPTURE_CALL_DESTROY_SURFACE, begin, opal_timerGetTicks());
+
+	return result;
+}
+
+static Opal_Result profile_instanceDestroy(Opal_Instance this)
+{
+	assert(this);
+
+	Profile_Instance *instance_ptr = (Profile_Instance *)this;
+
+	uint64_t begin = opal_timerGetTicks();
+	Opal_Result result = instance_ptr->next.destroyInstance(instance_ptr->next_instance);
+	profile_profilerRecord(instance_ptr->profiler, CAPTURE_CALL_DESTROY_INSTANCE, begin, opal_timerGetTicks());
+
+	if (instance_ptr->owns_profiler)
+		profile_opalDestroyProfiler((Opal_Profiler)instance_ptr->profiler);
+
+	free(instance_ptr);
+	return result;
+}
+
+/*
+ */
+static Opal_InstanceTable instance_vtbl =
+{
+	profile_instanceEnumerateDevices,
+
+	profile_instanceCreateSurface,
+	profile_instanceCreateHeadlessSurface,
+	profile_instanceCreateDevice,
+	profile_instanceCreateDefaultDevice,
+
+	profile_instanceDestroySurface,
+	profile_instanceDestroy,
+};
+
+/*
+ */
+static Opal_Result profile_wrapInstance(Profile_Profiler *profiler, uint32_t owns_profiler, Opal_Instance next_instance, Opal_Instance *instance)
+{
+	assert(profiler);
+	assert(next_instance != OPAL_NULL_HANDLE);
+	assert(instance);
+
+	Profile_Instance *ptr = (Profile_Instance *)malloc(sizeof(Profile_Instance));
+	assert(ptr);
+
+	// vtable
+	ptr->vtbl = &instance_vtbl;
+
+	// data
+	ptr->next_instance = next_instance;
+	opalGetInstanceTable(next_instance, &ptr->next);
+
+	ptr->profiler = profiler;
+	ptr->owns_profiler = owns_profiler;
+
+	*instance = (Opal_Instance)ptr;
+	return OPAL_SUCCESS;
+}
+
+Opal_Result profile_opalWrapInstance(void *user_data, Opal_Api api, const Opal_InstanceDesc *desc, Opal_Instance next_instance, Opal_Instance *instance)
+{
+	OPAL_UNUSED(api);
+	OPAL_UNUSED(desc);
+
+	return profile_wrapInstance((Profile_Profiler *)user_data, 0, next_instance, instance);
+}
+
+Opal_Result profile_opalWrapInstanceWithTrace(void *user_data, Opal_Api api, const Opal_InstanceDesc *desc, Opal_Instance next_instance, Opal_Instance *instance)
+{
+	OPAL_UNUSED(api);
+	OPAL_UNUSED(desc);
+
+	assert(user_data);
+
+	Opal_ProfilerDesc profiler_desc = {0};
+	profiler_desc.trace_path = (const char *)user_data;
+
+	Opal_Profiler profiler = OPAL_NULL_HANDLE;
+	Opal_Result result = profile_opalCreateProfiler(&profiler_desc, &profiler);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	return profile_wrapInstance((Profile_Profiler *)profiler, 1, next_instance, instance);
+}
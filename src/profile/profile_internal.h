@@ -0,0 +1,60 @@
+#pragma once
+
+#include "opal_internal.h"
+
+#include "capture/capture_codec.h"
+#include "common/histogram.h"
+#include "common/timer.h"
+
+#include <stdio.h>
+
+typedef struct Profile_Event_t
+{
+	uint32_t call;
+	uint64_t begin;
+	uint64_t duration;
+} Profile_Event;
+
+typedef struct Profile_Frame_t
+{
+	Profile_Event *events;
+	uint32_t num_events;
+	uint32_t capacity;
+} Profile_Frame;
+
+typedef struct Profile_Profiler_t
+{
+	Opal_Histogram histograms[CAPTURE_CALL_ENUM_MAX];
+	double nanoseconds_per_tick;
+	uint64_t base_ticks;
+	FILE *trace;
+	uint32_t num_trace_events;
+	Profile_Frame *frames;
+	uint32_t num_frames;
+	uint32_t current_frame;
+	uint64_t frame_index;
+} Profile_Profiler;
+
+typedef struct Profile_Instance_t
+{
+	Opal_InstanceTable *vtbl;
+	Opal_Instance next_instance;
+	Opal_InstanceTable next;
+	Profile_Profiler *profiler;
+	uint32_t owns_profiler;
+} Profile_Instance;
+
+typedef struct Profile_Device_t
+{
+	Opal_DeviceTable *vtbl;
+	Opal_Device next_device;
+	Opal_DeviceTable next;
+	Profile_Profiler *profiler;
+} Profile_Device;
+
+Opal_Result profile_profilerInitialize(Profile_Profiler *profiler, const Opal_ProfilerDesc *desc);
+Opal_Result profile_profilerShutdown(Profile_Profiler *profiler);
+void profile_profilerRecord(Profile_Profiler *profiler, Capture_Call call, uint64_t begin, uint64_t end);
+void profile_profilerEndFrame(Profile_Profiler *profiler);
+
+Opal_Result profile_deviceInitialize(Profile_Device *device_ptr, Profile_Profiler *profiler, Opal_Device next_device);
@@ -0,0 +1,256 @@
+#include "schedule_internal.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ */
+static OPAL_INLINE uint32_t schedule_findQueue(const Schedule_Scheduler *scheduler, Opal_Semaphore semaphore)
+{
+	assert(scheduler);
+
+	for (uint32_t i = 0; i < scheduler->num_queues; ++i)
+		if (scheduler->queues[i].semaphore == semaphore)
+			return i;
+
+	return SCHEDULE_INVALID_QUEUE;
+}
+
+static void schedule_addWait(Schedule_Scheduler *scheduler, uint32_t *num_waits, Opal_Semaphore semaphore, uint64_t value)
+{
+	assert(scheduler);
+	assert(num_waits);
+
+	for (uint32_t i = 0; i < *num_waits; ++i)
+	{
+		if (scheduler->wait_semaphores[i] != semaphore)
+			continue;
+
+		if (scheduler->wait_values[i] < value)
+			scheduler->wait_values[i] = value;
+
+		return;
+	}
+
+	if (scheduler->waits_capacity < *num_waits + 1)
+	{
+		uint32_t capacity = (scheduler->waits_capacity == 0) ? 16 : scheduler->waits_capacity * 2;
+
+		scheduler->wait_semaphores = (Opal_Semaphore *)realloc(scheduler->wait_semaphores, sizeof(Opal_Semaphore) * capacity);
+		assert(scheduler->wait_semaphores);
+
+		scheduler->wait_values = (uint64_t *)realloc(scheduler->wait_values, sizeof(uint64_t) * capacity);
+		assert(scheduler->wait_values);
+
+		scheduler->waits_capacity = capacity;
+	}
+
+	scheduler->wait_semaphores[*num_waits] = semaphore;
+	scheduler->wait_values[*num_waits] = value;
+	(*num_waits)++;
+}
+
+/*
+ */
+static Opal_Result schedule_schedulerShutdown(Schedule_Scheduler *scheduler)
+{
+	assert(scheduler);
+
+	Opal_Device device = scheduler->device;
+
+	Opal_Semaphore semaphores[OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX] = {0};
+	uint64_t values[OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX] = {0};
+	uint32_t num_semaphores = 0;
+
+	for (uint32_t i = 0; i < scheduler->num_queues; ++i)
+	{
+		Schedule_Queue *queue = &scheduler->queues[i];
+
+		if (queue->semaphore == OPAL_NULL_HANDLE || queue->value == 0)
+			continue;
+
+		semaphores[num_semaphores] = queue->semaphore;
+		values[num_semaphores] = queue->value;
+		num_semaphores++;
+	}
+
+	opalWaitSemaphores(device, num_semaphores, semaphores, values, 0, UINT64_MAX);
+
+	for (uint32_t i = 0; i < scheduler->num_queues; ++i)
+		if (scheduler->queues[i].semaphore != OPAL_NULL_HANDLE)
+			opalDestroySemaphore(device, scheduler->queues[i].semaphore);
+
+	free(scheduler->wait_semaphores);
+	free(scheduler->wait_values);
+
+	memset(scheduler, 0, sizeof(Schedule_Scheduler));
+	return OPAL_SUCCESS;
+}
+
+static Opal_Result schedule_schedulerInitialize(Schedule_Scheduler *scheduler, Opal_Device device)
+{
+	assert(scheduler);
+	assert(device);
+
+	memset(scheduler, 0, sizeof(Schedule_Scheduler));
+	scheduler->device = device;
+
+	Opal_DeviceInfo info = {0};
+	Opal_Result result = opalGetDeviceInfo(device, &info);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	// note: engine types without queues share the main queue, so their work is serialized with it
+	for (uint32_t i = 0; i < OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX; ++i)
+	{
+		if (i != OPAL_DEVICE_ENGINE_TYPE_MAIN && info.features.queue_count[i] == 0)
+		{
+			scheduler->engine_queues[i] = scheduler->engine_queues[OPAL_DEVICE_ENGINE_TYPE_MAIN];
+			continue;
+		}
+
+		Schedule_Queue *queue = &scheduler->queues[scheduler->num_queues];
+
+		result = opalGetDeviceQueue(device, (Opal_DeviceEngineType)i, 0, &queue->queue);
+		if (result != OPAL_SUCCESS)
+			break;
+
+		Opal_SemaphoreDesc semaphore_desc = {0};
+		semaphore_desc.flags = OPAL_SEMAPHORE_CREATION_FLAGS_HOST_OPERATIONS;
+
+		result = opalCreateSemaphore(device, &semaphore_desc, &queue->semaphore);
+		if (result != OPAL_SUCCESS)
+			break;
+
+		scheduler->engine_queues[i] = scheduler->num_queues++;
+	}
+
+	if (result != OPAL_SUCCESS)
+		schedule_schedulerShutdown(scheduler);
+
+	return result;
+}
+
+/*
+ */
+Opal_Result schedule_opalCreateScheduler(Opal_Device device, Opal_Scheduler *scheduler)
+{
+	assert(device);
+	assert(scheduler);
+
+	Schedule_Scheduler *ptr = (Schedule_Scheduler *)malloc(sizeof(Schedule_Scheduler));
+	assert(ptr);
+
+	Opal_Result result = schedule_schedulerInitialize(ptr, device);
+	if (result != OPAL_SUCCESS)
+	{
+		free(ptr);
+		return result;
+	}
+
+	*scheduler = (Opal_Scheduler)ptr;
+	return OPAL_SUCCESS;
+}
+
+Opal_Result schedule_opalGetSchedulerQueue(Opal_Scheduler scheduler, Opal_DeviceEngineType engine_type, Opal_Queue *queue)
+{
+	assert(scheduler);
+	assert(engine_type < OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX);
+	assert(queue);
+
+	Schedule_Scheduler *ptr = (Schedule_Scheduler *)scheduler;
+
+	*queue = ptr->queues[ptr->engine_queues[engine_type]].queue;
+	return OPAL_SUCCESS;
+}
+
+Opal_Result schedule_opalSchedule(Opal_Scheduler scheduler, const Opal_ScheduleDesc *desc, Opal_Semaphore *semaphore, uint64_t *value)
+{
+	assert(scheduler);
+	assert(desc);
+	assert(desc->engine_type < OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX);
+	assert(desc->num_dependencies == 0 || (desc->dependency_semaphores && desc->dependency_values));
+	assert(semaphore);
+	assert(value);
+
+	Schedule_Scheduler *ptr = (Schedule_Scheduler *)scheduler;
+
+	uint32_t index = ptr->engine_queues[desc->engine_type];
+	Schedule_Queue *queue = &ptr->queues[index];
+
+	uint64_t required_values[OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX] = {0};
+	uint32_t num_waits = 0;
+
+	for (uint32_t i = 0; i < desc->num_dependencies; ++i)
+	{
+		Opal_Semaphore dependency_semaphore = desc->dependency_semaphores[i];
+		uint64_t dependency_value = desc->dependency_values[i];
+
+		uint32_t source = schedule_findQueue(ptr, dependency_semaphore);
+		if (source == SCHEDULE_INVALID_QUEUE)
+		{
+			schedule_addWait(ptr, &num_waits, dependency_semaphore, dependency_value);
+			continue;
+		}
+
+		// note: nothing would ever signal a value that wasn't scheduled yet
+		if (dependency_value > ptr->queues[source].value)
+			return OPAL_INVALID_SCHEDULER;
+
+		// note: work on the same queue is already ordered by submission, and a queue that waited
+		//       for a value doesn't need to wait for anything older from the same source again
+		if (source == index || dependency_value <= queue->waited_values[source])
+			continue;
+
+		if (required_values[source] < dependency_value)
+			required_values[source] = dependency_value;
+	}
+
+	for (uint32_t i = 0; i < ptr->num_queues; ++i)
+		if (required_values[i] > 0)
+			schedule_addWait(ptr, &num_waits, ptr->queues[i].semaphore, required_values[i]);
+
+	uint64_t signal_value = queue->value + 1;
+
+	Opal_SubmitDesc submit = {0};
+	submit.num_wait_semaphores = num_waits;
+	submit.wait_semaphores = ptr->wait_semaphores;
+	submit.wait_values = ptr->wait_values;
+	submit.num_wait_swapchains = desc->num_wait_swapchains;
+	submit.wait_swapchains = desc->wait_swapchains;
+	submit.num_command_buffers = desc->num_command_buffers;
+	submit.command_buffers = desc->command_buffers;
+	submit.num_signal_semaphores = 1;
+	submit.signal_semaphores = &queue->semaphore;
+	submit.signal_values = &signal_value;
+	submit.num_signal_swapchains = desc->num_signal_swapchains;
+	submit.signal_swapchains = desc->signal_swapchains;
+
+	Opal_Result result = opalSubmit(ptr->device, queue->queue, &submit);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	queue->value = signal_value;
+
+	for (uint32_t i = 0; i < ptr->num_queues; ++i)
+		if (queue->waited_values[i] < required_values[i])
+			queue->waited_values[i] = required_values[i];
+
+	*semaphore = queue->semaphore;
+	*value = signal_value;
+
+	return OPAL_SUCCESS;
+}
+
+Opal_Result schedule_opalDestroyScheduler(Opal_Scheduler scheduler)
+{
+	assert(scheduler);
+
+	Schedule_Scheduler *ptr = (Schedule_Scheduler *)scheduler;
+
+	schedule_schedulerShutdown(ptr);
+	free(ptr);
+
+	return OPAL_SUCCESS;
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "opal_internal.h"
+
+#define SCHEDULE_INVALID_QUEUE 0xFFFFFFFF
+
+typedef struct Schedule_Queue_t
+{
+	Opal_Queue queue;
+	Opal_Semaphore semaphore;
+	uint64_t value;
+	uint64_t waited_values[OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX];
+} Schedule_Queue;
+
+typedef struct Schedule_Scheduler_t
+{
+	Opal_Device device;
+	Schedule_Queue queues[OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX];
+	uint32_t num_queues;
+	uint32_t engine_queues[OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX];
+
+	Opal_Semaphore *wait_semaphores;
+	uint64_t *wait_values;
+	uint32_t waits_capacity;
+} Schedule_Scheduler;
@@ -0,0 +1,1794 @@
+#include "state_internal.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ */
+static OPAL_INLINE void state_grow(void **data, uint32_t *capacity, uint32_t required, uint32_t element_size)
+{
+	assert(data);
+	assert(capacity);
+
+	if (*capacity >= required)
+		return;
+
+	uint32_t new_capacity = (*capacity == 0) ? 16 : *capacity;
+	while (new_capacity < required)
+		new_capacity *= 2;
+
+	*data = realloc(*data, (size_t)new_capacity * element_size);
+	assert(*data);
+
+	*capacity = new_capacity;
+}
+
+static OPAL_INLINE Opal_TextureViewType state_getSubresourceViewType(Opal_TextureType type, uint32_t layer_count)
+{
+	switch (type)
+	{
+		case OPAL_TEXTURE_TYPE_1D: return OPAL_TEXTURE_VIEW_TYPE_1D;
+		case OPAL_TEXTURE_TYPE_3D: return OPAL_TEXTURE_VIEW_TYPE_3D;
+		default: return (layer_count > 1) ? OPAL_TEXTURE_VIEW_TYPE_2D_ARRAY : OPAL_TEXTURE_VIEW_TYPE_2D;
+	}
+}
+
+static OPAL_INLINE uint32_t state_isUniform(const State_Texture *texture_ptr, uint32_t base_mip, uint32_t mip_count, uint32_t base_layer, uint32_t layer_count, Opal_TextureState state)
+{
+	assert(texture_ptr);
+
+	for (uint32_t mip = base_mip; mip < base_mip + mip_count; ++mip)
+	{
+		const Opal_TextureState *states = texture_ptr->states + mip * texture_ptr->layer_count;
+
+		for (uint32_t layer = base_layer; layer < base_layer + layer_count; ++layer)
+			if (states[layer] != state)
+				return 0;
+	}
+
+	return 1;
+}
+
+static OPAL_INLINE void state_setState(State_Texture *texture_ptr, const State_TextureView *view_ptr, Opal_TextureState state)
+{
+	assert(texture_ptr);
+	assert(view_ptr);
+
+	for (uint32_t mip = view_ptr->base_mip; mip < view_ptr->base_mip + view_ptr->mip_count; ++mip)
+	{
+		Opal_TextureState *states = texture_ptr->states + mip * texture_ptr->layer_count;
+
+		for (uint32_t layer = view_ptr->base_layer; layer < view_ptr->base_layer + view_ptr->layer_count; ++layer)
+			states[layer] = state;
+	}
+}
+
+/*
+ */
+static void state_deviceTrackBuffer(State_Device *device_ptr, Opal_Buffer buffer, Opal_BufferState state)
+{
+	assert(device_ptr);
+
+	opal_mapInsert(&device_ptr->buffers, buffer, &state);
+}
+
+static void state_deviceUntrackBuffer(State_Device *device_ptr, Opal_Buffer buffer)
+{
+	assert(device_ptr);
+
+	if (opal_mapFind(&device_ptr->buffers, buffer) == NULL)
+		return;
+
+	opal_mapRemove(&device_ptr->buffers, buffer);
+}
+
+static void state_deviceTrackTexture(State_Device *device_ptr, Opal_Texture texture, const Opal_TextureDesc *desc)
+{
+	assert(device_ptr);
+	assert(desc);
+
+	State_Texture data = {0};
+	data.type = desc->type;
+	data.mip_count = desc->mip_count;
+	data.layer_count = (desc->type == OPAL_TEXTURE_TYPE_3D) ? 1 : desc->layer_count;
+
+	// note: OPAL_TEXTURE_STATE_UNDEFINED is zero, textures are created in that state
+	data.states = (Opal_TextureState *)calloc(data.mip_count * data.layer_count, sizeof(Opal_TextureState));
+	assert(data.states);
+
+	opal_mapInsert(&device_ptr->textures, texture, &data);
+}
+
+static void state_deviceReleaseTexture(State_Device *device_ptr, State_Texture *texture_ptr)
+{
+	assert(device_ptr);
+	assert(texture_ptr);
+
+	if (texture_ptr->mip_views)
+	{
+		for (uint32_t i = 0; i < texture_ptr->mip_count; ++i)
+			if (texture_ptr->mip_views[i] != OPAL_NULL_HANDLE)
+				device_ptr->next.destroyTextureView(device_ptr->next_device, texture_ptr->mip_views[i]);
+	}
+
+	if (texture_ptr->subresource_views)
+	{
+		for (uint32_t i = 0; i < texture_ptr->mip_count * texture_ptr->layer_count; ++i)
+			if (texture_ptr->subresource_views[i] != OPAL_NULL_HANDLE)
+				device_ptr->next.destroyTextureView(device_ptr->next_device, texture_ptr->subresource_views[i]);
+	}
+
+	free(texture_ptr->states);
+	free(texture_ptr->mip_views);
+	free(texture_ptr->subresource_views);
+}
+
+static void state_deviceUntrackTexture(State_Device *device_ptr, Opal_Texture texture)
+{
+	assert(device_ptr);
+
+	State_Texture *texture_ptr = (State_Texture *)opal_mapFind(&device_ptr->textures, texture);
+	if (texture_ptr == NULL)
+		return;
+
+	state_deviceReleaseTexture(device_ptr, texture_ptr);
+	opal_mapRemove(&device_ptr->textures, texture);
+}
+
+static void state_deviceTrackTextureView(State_Device *device_ptr, Opal_TextureView texture_view, const Opal_TextureViewDesc *desc)
+{
+	assert(device_ptr);
+	assert(desc);
+
+	const State_Texture *texture_ptr = (const State_Texture *)opal_mapFind(&device_ptr->textures, desc->texture);
+	if (texture_ptr == NULL)
+		return;
+
+	State_TextureView data = {0};
+	data.texture = desc->texture;
+	data.base_mip = desc->base_mip;
+	data.mip_count = desc->mip_count;
+	data.base_layer = (texture_ptr->type == OPAL_TEXTURE_TYPE_3D) ? 0 : desc->base_layer;
+	data.layer_count = (texture_ptr->type == OPAL_TEXTURE_TYPE_3D) ? 1 : desc->layer_count;
+
+	assert(data.base_mip + data.mip_count <= texture_ptr->mip_count);
+	assert(data.base_layer + data.layer_count <= texture_ptr->layer_count);
+
+	opal_mapInsert(&device_ptr->texture_views, texture_view, &data);
+}
+
+static void state_deviceUntrackTextureView(State_Device *device_ptr, Opal_TextureView texture_view)
+{
+	assert(device_ptr);
+
+	if (opal_mapFind(&device_ptr->texture_views, texture_view) == NULL)
+		return;
+
+	opal_mapRemove(&device_ptr->texture_views, texture_view);
+}
+
+static void state_deviceUntrackFence(State_Device *device_ptr, Opal_Fence fence)
+{
+	assert(device_ptr);
+
+	State_SplitBarrier *split_ptr = (State_SplitBarrier *)opal_mapFind(&device_ptr->split_barriers, fence);
+	if (split_ptr == NULL)
+		return;
+
+	free(split_ptr->buffer_transitions);
+	free(split_ptr->texture_transitions);
+	opal_mapRemove(&device_ptr->split_barriers, fence);
+}
+
+/*
+ */
+static Opal_TextureView state_deviceGetSubresourceView(State_Device *device_ptr, State_Texture *texture_ptr, Opal_Texture texture, uint32_t mip, uint32_t layer)
+{
+	assert(device_ptr);
+	assert(texture_ptr);
+	assert(mip < texture_ptr->mip_count);
+	assert(layer == STATE_ALL_LAYERS || layer < texture_ptr->layer_count);
+
+	Opal_TextureView **views = (layer == STATE_ALL_LAYERS) ? &texture_ptr->mip_views : &texture_ptr->subresource_views;
+	uint32_t num_views = (layer == STATE_ALL_LAYERS) ? texture_ptr->mip_count : texture_ptr->mip_count * texture_ptr->layer_count;
+	uint32_t index = (layer == STATE_ALL_LAYERS) ? mip : mip * texture_ptr->layer_count + layer;
+
+	if (*views == NULL)
+	{
+		*views = (Opal_TextureView *)calloc(num_views, sizeof(Opal_TextureView));
+		assert(*views);
+	}
+
+	if ((*views)[index] != OPAL_NULL_HANDLE)
+		return (*views)[index];
+
+	Opal_TextureViewDesc desc = {0};
+	desc.texture = texture;
+	desc.base_mip = mip;
+	desc.mip_count = 1;
+	desc.base_layer = (layer == STATE_ALL_LAYERS) ? 0 : layer;
+	desc.layer_count = (layer == STATE_ALL_LAYERS) ? texture_ptr->layer_count : 1;
+	desc.type = state_getSubresourceViewType(texture_ptr->type, desc.layer_count);
+
+	Opal_TextureView texture_view = OPAL_NULL_HANDLE;
+	Opal_Result result = device_ptr->next.createTextureView(device_ptr->next_device, &desc, &texture_view);
+	if (result != OPAL_SUCCESS)
+		return OPAL_NULL_HANDLE;
+
+	(*views)[index] = texture_view;
+	return texture_view;
+}
+
+static void state_deviceAddBufferTransition(State_Device *device_ptr, Opal_Buffer buffer, Opal_BufferState state_before, Opal_BufferState state_after)
+{
+	assert(device_ptr);
+
+	state_grow((void **)&device_ptr->buffer_transitions, &device_ptr->buffer_transitions_capacity, device_ptr->num_buffer_transitions + 1, sizeof(Opal_BufferTransitionDesc));
+
+	Opal_BufferTransitionDesc *transition = &device_ptr->buffer_transitions[device_ptr->num_buffer_transitions++];
+	transition->buffer = buffer;
+	transition->state_before = state_before;
+	transition->state_after = state_after;
+}
+
+static void state_deviceAddTextureTransition(State_Device *device_ptr, Opal_TextureView texture_view, Opal_TextureState state_before, Opal_TextureState state_after)
+{
+	assert(device_ptr);
+
+	state_grow((void **)&device_ptr->texture_transitions, &device_ptr->texture_transitions_capacity, device_ptr->num_texture_transitions + 1, sizeof(Opal_TextureTransitionDesc));
+
+	Opal_TextureTransitionDesc *transition = &device_ptr->texture_transitions[device_ptr->num_texture_transitions++];
+	transition->texture_view = texture_view;
+	transition->state_before = state_before;
+	transition->state_after = state_after;
+}
+
+static void state_deviceResolveBufferTransition(State_Device *device_ptr, const Opal_BufferTransitionDesc *transition)
+{
+	assert(device_ptr);
+	assert(transition);
+
+	Opal_BufferState *state_ptr = (Opal_BufferState *)opal_mapFind(&device_ptr->buffers, transition->buffer);
+	if (state_ptr == NULL)
+	{
+		state_deviceAddBufferTransition(device_ptr, transition->buffer, transition->state_before, transition->state_after);
+		return;
+	}
+
+	if (*state_ptr != transition->state_after)
+		state_deviceAddBufferTransition(device_ptr, transition->buffer, *state_ptr, transition->state_after);
+
+	*state_ptr = transition->state_after;
+}
+
+static Opal_Result state_deviceResolveTextureTransition(State_Device *device_ptr, const Opal_TextureTransitionDesc *transition)
+{
+	assert(device_ptr);
+	assert(transition);
+
+	const State_TextureView *view_ptr = (const State_TextureView *)opal_mapFind(&device_ptr->texture_views, transition->texture_view);
+	State_Texture *texture_ptr = (view_ptr) ? (State_Texture *)opal_mapFind(&device_ptr->textures, view_ptr->texture) : NULL;
+
+	// note: swapchain textures and views of untracked textures keep the caller's state_before
+	if (texture_ptr == NULL)
+	{
+		state_deviceAddTextureTransition(device_ptr, transition->texture_view, transition->state_before, transition->state_after);
+		return OPAL_SUCCESS;
+	}
+
+	Opal_TextureState state_after = transition->state_after;
+	uint32_t layer_count = texture_ptr->layer_count;
+	uint32_t whole_layers = (view_ptr->base_layer == 0 && view_ptr->layer_count == layer_count);
+
+	// note: the common case is a view whose subresources share a state, it gets a single transition on the view itself
+	Opal_TextureState state = texture_ptr->states[view_ptr->base_mip * layer_count + view_ptr->base_layer];
+	if (state_isUniform(texture_ptr, view_ptr->base_mip, view_ptr->mip_count, view_ptr->base_layer, view_ptr->layer_count, state))
+	{
+		if (state != state_after)
+			state_deviceAddTextureTransition(device_ptr, transition->texture_view, state, state_after);
+	}
+	else
+	{
+		for (uint32_t mip = view_ptr->base_mip; mip < view_ptr->base_mip + view_ptr->mip_count; ++mip)
+		{
+			Opal_TextureState *states = texture_ptr->states + mip * layer_count;
+
+			if (whole_layers && state_isUniform(texture_ptr, mip, 1, 0, layer_count, states[0]))
+			{
+				if (states[0] == state_after)
+					continue;
+
+				Opal_TextureView mip_view = state_deviceGetSubresourceView(device_ptr, texture_ptr, view_ptr->texture, mip, STATE_ALL_LAYERS);
+				if (mip_view == OPAL_NULL_HANDLE)
+					return OPAL_NO_MEMORY;
+
+				state_deviceAddTextureTransition(device_ptr, mip_view, states[0], state_after);
+				continue;
+			}
+
+			for (uint32_t layer = view_ptr->base_layer; layer < view_ptr->base_layer + view_ptr->layer_count; ++layer)
+			{
+				if (states[layer] == state_after)
+					continue;
+
+				Opal_TextureView subresource_view = state_deviceGetSubresourceView(device_ptr, texture_ptr, view_ptr->texture, mip, layer);
+				if (subresource_view == OPAL_NULL_HANDLE)
+					return OPAL_NO_MEMORY;
+
+				state_deviceAddTextureTransition(device_ptr, subresource_view, states[layer], state_after);
+			}
+		}
+	}
+
+	state_setState(texture_ptr, view_ptr, state_after);
+	return OPAL_SUCCESS;
+}
+
+static void state_deviceStoreSplitBarrier(State_Device *device_ptr, Opal_Fence fence, uint32_t first_buffer_transition, uint32_t first_texture_transition)
+{
+	assert(device_ptr);
+	assert(fence != OPAL_NULL_HANDLE);
+
+	State_SplitBarrier *split_ptr = (State_SplitBarrier *)opal_mapFind(&device_ptr->split_barriers, fence);
+	if (split_ptr == NULL)
+	{
+		State_SplitBarrier data = {0};
+		split_ptr = (State_SplitBarrier *)opal_mapInsert(&device_ptr->split_barriers, fence, &data);
+	}
+
+	uint32_t num_buffer_transitions = device_ptr->num_buffer_transitions - first_buffer_transition;
+	uint32_t num_texture_transitions = device_ptr->num_texture_transitions - first_texture_transition;
+
+	state_grow((void **)&split_ptr->buffer_transitions, &split_ptr->buffer_transitions_capacity, num_buffer_transitions, sizeof(Opal_BufferTransitionDesc));
+	state_grow((void **)&split_ptr->texture_transitions, &split_ptr->texture_transitions_capacity, num_texture_transitions, sizeof(Opal_TextureTransitionDesc));
+
+	if (num_buffer_transitions > 0)
+		memcpy(split_ptr->buffer_transitions, device_ptr->buffer_transitions + first_buffer_transition, sizeof(Opal_BufferTransitionDesc) * num_buffer_transitions);
+
+	if (num_texture_transitions > 0)
+		memcpy(split_ptr->texture_transitions, device_ptr->texture_transitions + first_texture_transition, sizeof(Opal_TextureTransitionDesc) * num_texture_transitions);
+
+	split_ptr->num_buffer_transitions = num_buffer_transitions;
+	split_ptr->num_texture_transitions = num_texture_transitions;
+	split_ptr->pending = 1;
+}
+
+static uint32_t state_deviceLoadSplitBarrier(State_Device *device_ptr, Opal_Fence fence)
+{
+	assert(device_ptr);
+	assert(fence != OPAL_NULL_HANDLE);
+
+	State_SplitBarrier *split_ptr = (State_SplitBarrier *)opal_mapFind(&device_ptr->split_barriers, fence);
+	if (split_ptr == NULL || split_ptr->pending == 0)
+		return 0;
+
+	for (uint32_t i = 0; i < split_ptr->num_buffer_transitions; ++i)
+	{
+		const Opal_BufferTransitionDesc *transition = &split_ptr->buffer_transitions[i];
+		state_deviceAddBufferTransition(device_ptr, transition->buffer, transition->state_before, transition->state_after);
+	}
+
+	for (uint32_t i = 0; i < split_ptr->num_texture_transitions; ++i)
+	{
+		const Opal_TextureTransitionDesc *transition = &split_ptr->texture_transitions[i];
+		state_deviceAddTextureTransition(device_ptr, transition->texture_view, transition->state_before, transition->state_after);
+	}
+
+	split_ptr->pending = 0;
+	return 1;
+}
+
+static Opal_Result state_deviceResolveBarriers(State_Device *device_ptr, const Opal_PassBarriersDesc *barriers, Opal_PassBarriersDesc *resolved)
+{
+	assert(device_ptr);
+	assert(resolved);
+
+	if (barriers == NULL)
+		return OPAL_SUCCESS;
+
+	state_grow((void **)&device_ptr->barriers, &device_ptr->barriers_capacity, barriers->num_barriers, sizeof(Opal_BarrierDesc));
+
+	device_ptr->num_buffer_transitions = 0;
+	device_ptr->num_texture_transitions = 0;
+
+	for (uint32_t i = 0; i < barriers->num_barriers; ++i)
+	{
+		const Opal_BarrierDesc *barrier = &barriers->barriers[i];
+
+		uint32_t first_buffer_transition = device_ptr->num_buffer_transitions;
+		uint32_t first_texture_transition = device_ptr->num_texture_transitions;
+
+		// note: both halves of a split barrier must carry the same transitions, so the end half
+		//       replays what was resolved for the begin half instead of looking at current states
+		uint32_t loaded = 0;
+		if (barrier->fence != OPAL_NULL_HANDLE && barrier->fence_op == OPAL_FENCE_OP_END)
+			loaded = state_deviceLoadSplitBarrier(device_ptr, barrier->fence);
+
+		if (!loaded)
+		{
+			for (uint32_t j = 0; j < barrier->num_buffer_transitions; ++j)
+				state_deviceResolveBufferTransition(device_ptr, &barrier->buffer_transitions[j]);
+
+			for (uint32_t j = 0; j < barrier->num_texture_transitions; ++j)
+			{
+				Opal_Result result = state_deviceResolveTextureTransition(device_ptr, &barrier->texture_transitions[j]);
+				if (result != OPAL_SUCCESS)
+					return result;
+			}
+
+			if (barrier->fence != OPAL_NULL_HANDLE && barrier->fence_op == OPAL_FENCE_OP_BEGIN)
+				state_deviceStoreSplitBarrier(device_ptr, barrier->fence, first_buffer_transition, first_texture_transition);
+		}
+
+		Opal_BarrierDesc *resolved_barrier = &device_ptr->barriers[i];
+		*resolved_barrier = *barrier;
+		resolved_barrier->num_buffer_transitions = device_ptr->num_buffer_transitions - first_buffer_transition;
+		resolved_barrier->num_texture_transitions = device_ptr->num_texture_transitions - first_texture_transition;
+	}
+
+	// note: transition arrays might have been reallocated while resolving, so pointers are patched at the end
+	uint32_t buffer_offset = 0;
+	uint32_t texture_offset = 0;
+
+	for (uint32_t i = 0; i < barriers->num_barriers; ++i)
+	{
+		Opal_BarrierDesc *resolved_barrier = &device_ptr->barriers[i];
+
+		resolved_barrier->buffer_transitions = (resolved_barrier->num_buffer_transitions > 0) ? device_ptr->buffer_transitions + buffer_offset : NULL;
+		resolved_barrier->texture_transitions = (resolved_barrier->num_texture_transitions > 0) ? device_ptr->texture_transitions + texture_offset : NULL;
+
+		buffer_offset += resolved_barrier->num_buffer_transitions;
+		texture_offset += resolved_barrier->num_texture_transitions;
+	}
+
+	resolved->num_barriers = barriers->num_barriers;
+	resolved->barriers = device_ptr->barriers;
+
+	return OPAL_SUCCESS;
+}
+
+/*
+ */
+static Opal_Result state_deviceGetDeviceInfo(Opal_Device this, Opal_DeviceInfo *info)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.getDeviceInfo(device_ptr->next_device, info);
+}
+
+static Opal_Result state_deviceGetDeviceQueue(Opal_Device this, Opal_DeviceEngineType engine_type, uint32_t index, Opal_Queue *queue)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.getDeviceQueue(device_ptr->next_device, engine_type, index, queue);
+}
+
+static Opal_Result state_deviceGetAccelerationStructurePrebuildInfo(Opal_Device this, const Opal_AccelerationStructureBuildDesc *desc, Opal_AccelerationStructurePrebuildInfo *info)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.getAccelerationStructurePrebuildInfo(device_ptr->next_device, desc, info);
+}
+
+static Opal_Result state_deviceGetAccelerationStructureAddress(Opal_Device this, Opal_AccelerationStructure acceleration_structure, uint64_t *address)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.getAccelerationStructureAddress(device_ptr->next_device, acceleration_structure, address);
+}
+
+static Opal_Result state_deviceGetSupportedSurfaceFormats(Opal_Device this, Opal_Surface surface, uint32_t *num_formats, Opal_SurfaceFormat *formats)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.getSupportedSurfaceFormats(device_ptr->next_device, surface, num_formats, formats);
+}
+
+static Opal_Result state_deviceGetSupportedPresentModes(Opal_Device this, Opal_Surface surface, uint32_t *num_present_modes, Opal_PresentMode *present_modes)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.getSupportedPresentModes(device_ptr->next_device, surface, num_present_modes, present_modes);
+}
+
+static Opal_Result state_deviceGetPreferredSurfaceFormat(Opal_Device this, Opal_Surface surface, Opal_SurfaceFormat *format)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.getPreferredSurfaceFormat(device_ptr->next_device, surface, format);
+}
+
+static Opal_Result state_deviceGetPreferredSurfacePresentMode(Opal_Device this, Opal_Surface surface, Opal_PresentMode *present_mode)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.getPreferredSurfacePresentMode(device_ptr->next_device, surface, present_mode);
+}
+
+static Opal_Result state_deviceCreateSemaphore(Opal_Device this, const Opal_SemaphoreDesc *desc, Opal_Semaphore *semaphore)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.createSemaphore(device_ptr->next_device, desc, semaphore);
+}
+
+static Opal_Result state_deviceCreateFence(Opal_Device this, Opal_Fence *fence)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.createFence(device_ptr->next_device, fence);
+}
+
+static Opal_Result state_deviceCreateBuffer(Opal_Device this, const Opal_BufferDesc *desc, Opal_Buffer *buffer)
+{
+	assert(this);
+	assert(desc);
+	assert(buffer);
+
+	State_Device *device_ptr = (State_Device *)this;
+
+	Opal_Result result = device_ptr->next.createBuffer(device_ptr->next_device, desc, buffer);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	opal_mutexLock(&device_ptr->mutex);
+	state_deviceTrackBuffer(device_ptr, *buffer, desc->initial_state);
+	opal_mutexUnlock(&device_ptr->mutex);
+
+	return OPAL_SUCCESS;
+}
+
+static Opal_Result state_deviceCreateTexture(Opal_Device this, const Opal_TextureDesc *desc, Opal_Texture *texture)
+{
+	assert(this);
+	assert(desc);
+	assert(texture);
+
+	State_Device *device_ptr = (State_Device *)this;
+
+	Opal_Result result = device_ptr->next.createTexture(device_ptr->next_device, desc, texture);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	opal_mutexLock(&device_ptr->mutex);
+	state_deviceTrackTexture(device_ptr, *texture, desc);
+	opal_mutexUnlock(&device_ptr->mutex);
+
+	return OPAL_SUCCESS;
+}
+
+static Opal_Result state_deviceCreateTextureView(Opal_Device this, const Opal_TextureViewDesc *desc, Opal_TextureView *texture_view)
+{
+	assert(this);
+	assert(desc);
+	assert(texture_view);
+
+	State_Device *device_ptr = (State_Device *)this;
+
+	Opal_Result result = device_ptr->next.createTextureView(device_ptr->next_device, desc, texture_view);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	opal_mutexLock(&device_ptr->mutex);
+	state_deviceTrackTextureView(device_ptr, *texture_view, desc);
+	opal_mutexUnlock(&device_ptr->mutex);
+
+	return OPAL_SUCCESS;
+}
+
+static Opal_Result state_deviceCreateSampler(Opal_Device this, const Opal_SamplerDesc *desc, Opal_Sampler *sampler)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.createSampler(device_ptr->next_device, desc, sampler);
+}
+
+static Opal_Result state_deviceCreateAccelerationStructure(Opal_Device this, const Opal_AccelerationStructureDesc *desc, Opal_AccelerationStructure *acceleration_structure)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.createAccelerationStructure(device_ptr->next_device, desc, acceleration_structure);
+}
+
+static Opal_Result state_deviceCreateShaderBindingTable(Opal_Device this, Opal_RaytracePipeline pipeline, Opal_ShaderBindingTable *shader_binding_table)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.createShaderBindingTable(device_ptr->next_device, pipeline, shader_binding_table);
+}
+
+static Opal_Result state_deviceCreateCommandAllocator(Opal_Device this, Opal_Queue queue, Opal_CommandAllocator *command_allocator)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.createCommandAllocator(device_ptr->next_device, queue, command_allocator);
+}
+
+static Opal_Result state_deviceCreateCommandBuffer(Opal_Device this, Opal_CommandAllocator command_allocator, Opal_CommandBuffer *command_buffer)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.createCommandBuffer(device_ptr->next_device, command_allocator, command_buffer);
+}
+
+static Opal_Result state_deviceCreateShader(Opal_Device this, const Opal_ShaderDesc *desc, Opal_Shader *shader)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.createShader(device_ptr->next_device, desc, shader);
+}
+
+static Opal_Result state_deviceCreateDescriptorHeap(Opal_Device this, const Opal_DescriptorHeapDesc *desc, Opal_DescriptorHeap *descriptor_buffer)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.createDescriptorHeap(device_ptr->next_device, desc, descriptor_buffer);
+}
+
+static Opal_Result state_deviceCreateDescriptorSetLayout(Opal_Device this, uint32_t num_entries, const Opal_DescriptorSetLayoutEntry *entries, Opal_DescriptorSetLayout *descriptor_set_layout)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.createDescriptorSetLayout(device_ptr->next_device, num_entries, entries, descriptor_set_layout);
+}
+
+static Opal_Result state_deviceCreatePipelineLayout(Opal_Device this, uint32_t num_descriptor_setlayouts, const Opal_DescriptorSetLayout *descriptor_set_layouts, Opal_PipelineLayout *pipeline_layout)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.createPipelineLayout(device_ptr->next_device, num_descriptor_setlayouts, descriptor_set_layouts, pipeline_layout);
+}
+
+static Opal_Result state_deviceCreateGraphicsPipeline(Opal_Device this, const Opal_GraphicsPipelineDesc *desc, Opal_GraphicsPipeline *pipeline)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.createGraphicsPipeline(device_ptr->next_device, desc, pipeline);
+}
+
+static Opal_Result state_deviceCreateMeshletPipeline(Opal_Device this, const Opal_MeshletPipelineDesc *desc, Opal_GraphicsPipeline *pipeline)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.createMeshletPipeline(device_ptr->next_device, desc, pipeline);
+}
+
+static Opal_Result state_deviceCreateComputePipeline(Opal_Device this, const Opal_ComputePipelineDesc *desc, Opal_ComputePipeline *pipeline)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.createComputePipeline(device_ptr->next_device, desc, pipeline);
+}
+
+static Opal_Result state_deviceCreateRaytracePipeline(Opal_Device this, const Opal_RaytracePipelineDesc *desc, Opal_RaytracePipeline *pipeline)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.createRaytracePipeline(device_ptr->next_device, desc, pipeline);
+}
+
+static Opal_Result state_deviceCreateGraphicsPipelines(Opal_Device this, uint32_t num_pipelines, const Opal_GraphicsPipelineDesc *descs, Opal_GraphicsPipeline *pipelines)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.createGraphicsPipelines(device_ptr->next_device, num_pipelines, descs, pipelines);
+}
+
+static Opal_Result state_deviceCreateComputePipelines(Opal_Device this, uint32_t num_pipelines, const Opal_ComputePipelineDesc *descs, Opal_ComputePipeline *pipelines)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.createComputePipelines(device_ptr->next_device, num_pipelines, descs, pipelines);
+}
+
+static Opal_Result state_deviceCreateRaytracePipelines(Opal_Device this, uint32_t num_pipelines, const Opal_RaytracePipelineDesc *descs, Opal_RaytracePipeline *pipelines)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.createRaytracePipelines(device_ptr->next_device, num_pipelines, descs, pipelines);
+}
+
+static Opal_Result state_deviceCreateGraphicsPipelinesAsync(Opal_Device this, uint32_t num_pipelines, const Opal_GraphicsPipelineDesc *descs, Opal_GraphicsPipeline *pipelines, Opal_PipelineTask *task)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.createGraphicsPipelinesAsync(device_ptr->next_device, num_pipelines, descs, pipelines, task);
+}
+
+static Opal_Result state_deviceCreateComputePipelinesAsync(Opal_Device this, uint32_t num_pipelines, const Opal_ComputePipelineDesc *descs, Opal_ComputePipeline *pipelines, Opal_PipelineTask *task)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.createComputePipelinesAsync(device_ptr->next_device, num_pipelines, descs, pipelines, task);
+}
+
+static Opal_Result state_deviceCreateRaytracePipelinesAsync(Opal_Device this, uint32_t num_pipelines, const Opal_RaytracePipelineDesc *descs, Opal_RaytracePipeline *pipelines, Opal_PipelineTask *task)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.createRaytracePipelinesAsync(device_ptr->next_device, num_pipelines, descs, pipelines, task);
+}
+
+static Opal_Result state_deviceCreateSwapchain(Opal_Device this, const Opal_SwapchainDesc *desc, Opal_Swapchain *swapchain)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.createSwapchain(device_ptr->next_device, desc, swapchain);
+}
+
+static Opal_Result state_deviceDestroySemaphore(Opal_Device this, Opal_Semaphore semaphore)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.destroySemaphore(device_ptr->next_device, semaphore);
+}
+
+static Opal_Result state_deviceDestroyFence(Opal_Device this, Opal_Fence fence)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+
+	opal_mutexLock(&device_ptr->mutex);
+	state_deviceUntrackFence(device_ptr, fence);
+	opal_mutexUnlock(&device_ptr->mutex);
+
+	return device_ptr->next.destroyFence(device_ptr->next_device, fence);
+}
+
+static Opal_Result state_deviceDestroyBuffer(Opal_Device this, Opal_Buffer buffer)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+
+	opal_mutexLock(&device_ptr->mutex);
+	state_deviceUntrackBuffer(device_ptr, buffer);
+	opal_mutexUnlock(&device_ptr->mutex);
+
+	return device_ptr->next.destroyBuffer(device_ptr->next_device, buffer);
+}
+
+static Opal_Result state_deviceDestroyTexture(Opal_Device this, Opal_Texture texture)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+
+	opal_mutexLock(&device_ptr->mutex);
+	state_deviceUntrackTexture(device_ptr, texture);
+	opal_mutexUnlock(&device_ptr->mutex);
+
+	return device_ptr->next.destroyTexture(device_ptr->next_device, texture);
+}
+
+static Opal_Result state_deviceDestroyTextureView(Opal_Device this, Opal_TextureView texture_view)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+
+	opal_mutexLock(&device_ptr->mutex);
+	state_deviceUntrackTextureView(device_ptr, texture_view);
+	opal_mutexUnlock(&device_ptr->mutex);
+
+	return device_ptr->next.destroyTextureView(device_ptr->next_device, texture_view);
+}
+
+static Opal_Result state_deviceDestroySampler(Opal_Device this, Opal_Sampler sampler)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.destroySampler(device_ptr->next_device, sampler);
+}
+
+static Opal_Result state_deviceDestroyAccelerationStructure(Opal_Device this, Opal_AccelerationStructure acceleration_structure)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.destroyAccelerationStructure(device_ptr->next_device, acceleration_structure);
+}
+
+static Opal_Result state_deviceDestroyShaderBindingTable(Opal_Device this, Opal_ShaderBindingTable shader_binding_table)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.destroyShaderBindingTable(device_ptr->next_device, shader_binding_table);
+}
+
+static Opal_Result state_deviceDestroyCommandAllocator(Opal_Device this, Opal_CommandAllocator command_allocator)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.destroyCommandAllocator(device_ptr->next_device, command_allocator);
+}
+
+static Opal_Result state_deviceDestroyCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.destroyCommandBuffer(device_ptr->next_device, command_buffer);
+}
+
+static Opal_Result state_deviceDestroyShader(Opal_Device this, Opal_Shader shader)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.destroyShader(device_ptr->next_device, shader);
+}
+
+static Opal_Result state_deviceDestroyDescriptorHeap(Opal_Device this, Opal_DescriptorHeap descriptor_buffer)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.destroyDescriptorHeap(device_ptr->next_device, descriptor_buffer);
+}
+
+static Opal_Result state_deviceDestroyDescriptorSetLayout(Opal_Device this, Opal_DescriptorSetLayout descriptor_set_layout)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.destroyDescriptorSetLayout(device_ptr->next_device, descriptor_set_layout);
+}
+
+static Opal_Result state_deviceDestroyPipelineLayout(Opal_Device this, Opal_PipelineLayout pipeline_layout)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.destroyPipelineLayout(device_ptr->next_device, pipeline_layout);
+}
+
+static Opal_Result state_deviceDestroyGraphicsPipeline(Opal_Device this, Opal_GraphicsPipeline pipeline)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.destroyGraphicsPipeline(device_ptr->next_device, pipeline);
+}
+
+static Opal_Result state_deviceDestroyComputePipeline(Opal_Device this, Opal_ComputePipeline pipeline)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.destroyComputePipeline(device_ptr->next_device, pipeline);
+}
+
+static Opal_Result state_deviceDestroyRaytracePipeline(Opal_Device this, Opal_RaytracePipeline pipeline)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.destroyRaytracePipeline(device_ptr->next_device, pipeline);
+}
+
+static Opal_Result state_deviceDestroySwapchain(Opal_Device this, Opal_Swapchain swapchain)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.destroySwapchain(device_ptr->next_device, swapchain);
+}
+
+static Opal_Result state_deviceDestroyDevice(Opal_Device this)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+
+	uint32_t index = opal_mapGetFirstIndex(&device_ptr->textures);
+	while (index != OPAL_MAP_INDEX_NULL)
+	{
+		State_Texture *texture_ptr = (State_Texture *)opal_mapGetElementByIndex(&device_ptr->textures, index);
+		state_deviceReleaseTexture(device_ptr, texture_ptr);
+
+		index = opal_mapGetNextIndex(&device_ptr->textures, index);
+	}
+
+	index = opal_mapGetFirstIndex(&device_ptr->split_barriers);
+	while (index != OPAL_MAP_INDEX_NULL)
+	{
+		State_SplitBarrier *split_ptr = (State_SplitBarrier *)opal_mapGetElementByIndex(&device_ptr->split_barriers, index);
+
+		free(split_ptr->buffer_transitions);
+		free(split_ptr->texture_transitions);
+
+		index = opal_mapGetNextIndex(&device_ptr->split_barriers, index);
+	}
+
+	opal_mapShutdown(&device_ptr->buffers);
+	opal_mapShutdown(&device_ptr->textures);
+	opal_mapShutdown(&device_ptr->texture_views);
+	opal_mapShutdown(&device_ptr->split_barriers);
+	opal_mutexShutdown(&device_ptr->mutex);
+
+	free(device_ptr->barriers);
+	free(device_ptr->buffer_transitions);
+	free(device_ptr->texture_transitions);
+
+	Opal_Result result = device_ptr->next.destroyDevice(device_ptr->next_device);
+
+	free(device_ptr);
+	return result;
+}
+
+static Opal_Result state_deviceBuildShaderBindingTable(Opal_Device this, Opal_ShaderBindingTable shader_binding_table, const Opal_ShaderBindingTableBuildDesc *desc)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.buildShaderBindingTable(device_ptr->next_device, shader_binding_table, desc);
+}
+
+static Opal_Result state_deviceBuildAccelerationStructureInstanceBuffer(Opal_Device this, const Opal_AccelerationStructureInstanceBufferBuildDesc *desc)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.buildAccelerationStructureInstanceBuffer(device_ptr->next_device, desc);
+}
+
+static Opal_Result state_deviceResetCommandAllocator(Opal_Device this, Opal_CommandAllocator command_allocator)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.resetCommandAllocator(device_ptr->next_device, command_allocator);
+}
+
+static Opal_Result state_deviceAllocateDescriptorSet(Opal_Device this, const Opal_DescriptorSetAllocationDesc *desc, Opal_DescriptorSet *descriptor_set)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.allocateDescriptorSet(device_ptr->next_device, desc, descriptor_set);
+}
+
+static Opal_Result state_deviceFreeDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.freeDescriptorSet(device_ptr->next_device, descriptor_set);
+}
+
+static Opal_Result state_deviceMapBuffer(Opal_Device this, Opal_Buffer buffer, void **ptr)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.mapBuffer(device_ptr->next_device, buffer, ptr);
+}
+
+static Opal_Result state_deviceUnmapBuffer(Opal_Device this, Opal_Buffer buffer)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.unmapBuffer(device_ptr->next_device, buffer);
+}
+
+static Opal_Result state_deviceWriteBuffer(Opal_Device this, Opal_Buffer buffer, uint64_t offset, const void *data, uint64_t size)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.writeBuffer(device_ptr->next_device, buffer, offset, data, size);
+}
+
+static Opal_Result state_deviceUpdateDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set, uint32_t num_entries, const Opal_DescriptorSetEntry *entries)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.updateDescriptorSet(device_ptr->next_device, descriptor_set, num_entries, entries);
+}
+
+static Opal_Result state_deviceBeginCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.beginCommandBuffer(device_ptr->next_device, command_buffer);
+}
+
+static Opal_Result state_deviceEndCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.endCommandBuffer(device_ptr->next_device, command_buffer);
+}
+
+static Opal_Result state_deviceQuerySemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t *value)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.querySemaphore(device_ptr->next_device, semaphore, value);
+}
+
+static Opal_Result state_deviceSignalSemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t value)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.signalSemaphore(device_ptr->next_device, semaphore, value);
+}
+
+static Opal_Result state_deviceWaitSemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t value, uint64_t timeout_milliseconds)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.waitSemaphore(device_ptr->next_device, semaphore, value, timeout_milliseconds);
+}
+
+static Opal_Result state_deviceWaitSemaphores(Opal_Device this, uint32_t num_semaphores, const Opal_Semaphore *semaphores, const uint64_t *values, uint32_t wait_any, uint64_t timeout_milliseconds)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.waitSemaphores(device_ptr->next_device, num_semaphores, semaphores, values, wait_any, timeout_milliseconds);
+}
+
+static Opal_Result state_deviceRegisterSemaphoreCallback(Opal_Device this, Opal_Semaphore semaphore, uint64_t value, PFN_opalSemaphoreCallback callback, void *user_data)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.registerSemaphoreCallback(device_ptr->next_device, semaphore, value, callback, user_data);
+}
+
+static Opal_Result state_deviceWaitPipelineTask(Opal_Device this, Opal_PipelineTask task, uint64_t timeout_milliseconds)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.waitPipelineTask(device_ptr->next_device, task, timeout_milliseconds);
+}
+
+static Opal_Result state_deviceWaitQueue(Opal_Device this, Opal_Queue queue)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.waitQueue(device_ptr->next_device, queue);
+}
+
+static Opal_Result state_deviceWaitIdle(Opal_Device this)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.waitIdle(device_ptr->next_device);
+}
+
+static Opal_Result state_deviceSubmit(Opal_Device this, Opal_Queue queue, const Opal_SubmitDesc *desc)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.submit(device_ptr->next_device, queue, desc);
+}
+
+static Opal_Result state_deviceAcquire(Opal_Device this, Opal_Swapchain swapchain, Opal_TextureView *texture_view)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.acquire(device_ptr->next_device, swapchain, texture_view);
+}
+
+static Opal_Result state_devicePresent(Opal_Device this, Opal_Swapchain swapchain)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.present(device_ptr->next_device, swapchain);
+}
+
+static Opal_Result state_deviceWaitPresent(Opal_Device this, Opal_Swapchain swapchain, uint64_t frame_id, uint64_t timeout_milliseconds)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.waitPresent(device_ptr->next_device, swapchain, frame_id, timeout_milliseconds);
+}
+
+static Opal_Result state_deviceGetSwapchainFrameTiming(Opal_Device this, Opal_Swapchain swapchain, Opal_FrameTiming *timing)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.getSwapchainFrameTiming(device_ptr->next_device, swapchain, timing);
+}
+
+static Opal_Result state_deviceCmdSetDescriptorHeap(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_DescriptorHeap descriptor_heap)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdSetDescriptorHeap(device_ptr->next_device, command_buffer, descriptor_heap);
+}
+
+static Opal_Result state_deviceCmdBeginGraphicsPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_FramebufferDesc *desc, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	Opal_PassBarriersDesc resolved = {0};
+
+	opal_mutexLock(&device_ptr->mutex);
+
+	Opal_Result result = state_deviceResolveBarriers(device_ptr, barriers, &resolved);
+	if (result == OPAL_SUCCESS)
+		result = device_ptr->next.cmdBeginGraphicsPass(device_ptr->next_device, command_buffer, desc, (barriers) ? &resolved : NULL);
+
+	opal_mutexUnlock(&device_ptr->mutex);
+	return result;
+}
+
+static Opal_Result state_deviceCmdGraphicsSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdGraphicsSetPipelineLayout(device_ptr->next_device, command_buffer, pipeline_layout);
+}
+
+static Opal_Result state_deviceCmdGraphicsSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_GraphicsPipeline pipeline)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdGraphicsSetPipeline(device_ptr->next_device, command_buffer, pipeline);
+}
+
+static Opal_Result state_deviceCmdGraphicsSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdGraphicsSetDescriptorSet(device_ptr->next_device, command_buffer, index, descriptor_set, num_dynamic_offsets, dynamic_offsets);
+}
+
+static Opal_Result state_deviceCmdGraphicsSetVertexBuffers(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t first_index, uint32_t num_vertex_buffers, const Opal_VertexBufferView *vertex_buffers)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdGraphicsSetVertexBuffers(device_ptr->next_device, command_buffer, first_index, num_vertex_buffers, vertex_buffers);
+}
+
+static Opal_Result state_deviceCmdGraphicsSetIndexBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_IndexBufferView index_buffer)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdGraphicsSetIndexBuffer(device_ptr->next_device, command_buffer, index_buffer);
+}
+
+static Opal_Result state_deviceCmdGraphicsSetViewport(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Viewport viewport)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdGraphicsSetViewport(device_ptr->next_device, command_buffer, viewport);
+}
+
+static Opal_Result state_deviceCmdGraphicsSetScissor(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdGraphicsSetScissor(device_ptr->next_device, command_buffer, x, y, width, height);
+}
+
+static Opal_Result state_deviceCmdGraphicsDraw(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_vertices, uint32_t num_instances, uint32_t base_vertex, uint32_t base_instance)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdGraphicsDraw(device_ptr->next_device, command_buffer, num_vertices, num_instances, base_vertex, base_instance);
+}
+
+static Opal_Result state_deviceCmdGraphicsDrawIndexed(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_indices, uint32_t num_instances, uint32_t base_index, int32_t vertex_offset, uint32_t base_instance)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdGraphicsDrawIndexed(device_ptr->next_device, command_buffer, num_indices, num_instances, base_index, vertex_offset, base_instance);
+}
+
+static Opal_Result state_deviceCmdGraphicsMeshletDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_threadgroups_x, uint32_t num_threadgroups_y, uint32_t num_threadgroups_z)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdGraphicsMeshletDispatch(device_ptr->next_device, command_buffer, num_threadgroups_x, num_threadgroups_y, num_threadgroups_z);
+}
+
+static Opal_Result state_deviceCmdEndGraphicsPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	Opal_PassBarriersDesc resolved = {0};
+
+	opal_mutexLock(&device_ptr->mutex);
+
+	Opal_Result result = state_deviceResolveBarriers(device_ptr, barriers, &resolved);
+	if (result == OPAL_SUCCESS)
+		result = device_ptr->next.cmdEndGraphicsPass(device_ptr->next_device, command_buffer, (barriers) ? &resolved : NULL);
+
+	opal_mutexUnlock(&device_ptr->mutex);
+	return result;
+}
+
+static Opal_Result state_deviceCmdBeginComputePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	Opal_PassBarriersDesc resolved = {0};
+
+	opal_mutexLock(&device_ptr->mutex);
+
+	Opal_Result result = state_deviceResolveBarriers(device_ptr, barriers, &resolved);
+	if (result == OPAL_SUCCESS)
+		result = device_ptr->next.cmdBeginComputePass(device_ptr->next_device, command_buffer, (barriers) ? &resolved : NULL);
+
+	opal_mutexUnlock(&device_ptr->mutex);
+	return result;
+}
+
+static Opal_Result state_deviceCmdComputeSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdComputeSetPipelineLayout(device_ptr->next_device, command_buffer, pipeline_layout);
+}
+
+static Opal_Result state_deviceCmdComputeSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_ComputePipeline pipeline)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdComputeSetPipeline(device_ptr->next_device, command_buffer, pipeline);
+}
+
+static Opal_Result state_deviceCmdComputeSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdComputeSetDescriptorSet(device_ptr->next_device, command_buffer, index, descriptor_set, num_dynamic_offsets, dynamic_offsets);
+}
+
+static Opal_Result state_deviceCmdComputeMemoryBarrier(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_MemoryBarrierDesc *barriers)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdComputeMemoryBarrier(device_ptr->next_device, command_buffer, barriers);
+}
+
+static Opal_Result state_deviceCmdComputeDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_threadgroups_x, uint32_t num_threadgroups_y, uint32_t num_threadgroups_z)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdComputeDispatch(device_ptr->next_device, command_buffer, num_threadgroups_x, num_threadgroups_y, num_threadgroups_z);
+}
+
+static Opal_Result state_deviceCmdEndComputePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	Opal_PassBarriersDesc resolved = {0};
+
+	opal_mutexLock(&device_ptr->mutex);
+
+	Opal_Result result = state_deviceResolveBarriers(device_ptr, barriers, &resolved);
+	if (result == OPAL_SUCCESS)
+		result = device_ptr->next.cmdEndComputePass(device_ptr->next_device, command_buffer, (barriers) ? &resolved : NULL);
+
+	opal_mutexUnlock(&device_ptr->mutex);
+	return result;
+}
+
+static Opal_Result state_deviceCmdBeginRaytracePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	Opal_PassBarriersDesc resolved = {0};
+
+	opal_mutexLock(&device_ptr->mutex);
+
+	Opal_Result result = state_deviceResolveBarriers(device_ptr, barriers, &resolved);
+	if (result == OPAL_SUCCESS)
+		result = device_ptr->next.cmdBeginRaytracePass(device_ptr->next_device, command_buffer, (barriers) ? &resolved : NULL);
+
+	opal_mutexUnlock(&device_ptr->mutex);
+	return result;
+}
+
+static Opal_Result state_deviceCmdRaytraceSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdRaytraceSetPipelineLayout(device_ptr->next_device, command_buffer, pipeline_layout);
+}
+
+static Opal_Result state_deviceCmdRaytraceSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_ComputePipeline pipeline)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdRaytraceSetPipeline(device_ptr->next_device, command_buffer, pipeline);
+}
+
+static Opal_Result state_deviceCmdRaytraceSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdRaytraceSetDescriptorSet(device_ptr->next_device, command_buffer, index, descriptor_set, num_dynamic_offsets, dynamic_offsets);
+}
+
+static Opal_Result state_deviceCmdRaytraceSetShaderBindingTable(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_ShaderBindingTable shader_binding_table)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdRaytraceSetShaderBindingTable(device_ptr->next_device, command_buffer, shader_binding_table);
+}
+
+static Opal_Result state_deviceCmdRaytraceMemoryBarrier(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_MemoryBarrierDesc *barriers)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdRaytraceMemoryBarrier(device_ptr->next_device, command_buffer, barriers);
+}
+
+static Opal_Result state_deviceCmdRaytraceDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t width, uint32_t height, uint32_t depth)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdRaytraceDispatch(device_ptr->next_device, command_buffer, width, height, depth);
+}
+
+static Opal_Result state_deviceCmdEndRaytracePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	Opal_PassBarriersDesc resolved = {0};
+
+	opal_mutexLock(&device_ptr->mutex);
+
+	Opal_Result result = state_deviceResolveBarriers(device_ptr, barriers, &resolved);
+	if (result == OPAL_SUCCESS)
+		result = device_ptr->next.cmdEndRaytracePass(device_ptr->next_device, command_buffer, (barriers) ? &resolved : NULL);
+
+	opal_mutexUnlock(&device_ptr->mutex);
+	return result;
+}
+
+static Opal_Result state_deviceCmdBeginCopyPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	Opal_PassBarriersDesc resolved = {0};
+
+	opal_mutexLock(&device_ptr->mutex);
+
+	Opal_Result result = state_deviceResolveBarriers(device_ptr, barriers, &resolved);
+	if (result == OPAL_SUCCESS)
+		result = device_ptr->next.cmdBeginCopyPass(device_ptr->next_device, command_buffer, (barriers) ? &resolved : NULL);
+
+	opal_mutexUnlock(&device_ptr->mutex);
+	return result;
+}
+
+static Opal_Result state_deviceCmdCopyBufferToBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer src_buffer, uint64_t src_offset, Opal_Buffer dst_buffer, uint64_t dst_offset, uint64_t size)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdCopyBufferToBuffer(device_ptr->next_device, command_buffer, src_buffer, src_offset, dst_buffer, dst_offset, size);
+}
+
+static Opal_Result state_deviceCmdCopyBufferToTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_BufferTextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdCopyBufferToTexture(device_ptr->next_device, command_buffer, src, dst, size);
+}
+
+static Opal_Result state_deviceCmdCopyTextureToBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_BufferTextureRegion dst, Opal_Extent3D size)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdCopyTextureToBuffer(device_ptr->next_device, command_buffer, src, dst, size);
+}
+
+static Opal_Result state_deviceCmdCopyBufferToTextureRegions(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer src_buffer, Opal_Texture dst_texture, uint32_t num_regions, const Opal_BufferTextureCopyRegion *regions)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdCopyBufferToTextureRegions(device_ptr->next_device, command_buffer, src_buffer, dst_texture, num_regions, regions);
+}
+
+static Opal_Result state_deviceCmdCopyTextureToBufferRegions(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Texture src_texture, Opal_Buffer dst_buffer, uint32_t num_regions, const Opal_BufferTextureCopyRegion *regions)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdCopyTextureToBufferRegions(device_ptr->next_device, command_buffer, src_texture, dst_buffer, num_regions, regions);
+}
+
+static Opal_Result state_deviceCmdCopyTextureToTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdCopyTextureToTexture(device_ptr->next_device, command_buffer, src, dst, size);
+}
+
+static Opal_Result state_deviceCmdFillBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer buffer, uint64_t offset, uint64_t size, uint32_t value)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdFillBuffer(device_ptr->next_device, command_buffer, buffer, offset, size, value);
+}
+
+static Opal_Result state_deviceCmdUpdateBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer buffer, uint64_t offset, uint64_t size, const void *data)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdUpdateBuffer(device_ptr->next_device, command_buffer, buffer, offset, size, data);
+}
+
+static Opal_Result state_deviceCmdClearTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureView texture_view, Opal_ClearValue clear_value)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdClearTexture(device_ptr->next_device, command_buffer, texture_view, clear_value);
+}
+
+static Opal_Result state_deviceCmdBlitTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_Extent3D src_size, Opal_TextureRegion dst, Opal_Extent3D dst_size, Opal_SamplerFilterMode filter)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdBlitTexture(device_ptr->next_device, command_buffer, src, src_size, dst, dst_size, filter);
+}
+
+static Opal_Result state_deviceCmdGenerateMips(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureView texture_view)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+
+	Opal_Result result = device_ptr->next.cmdGenerateMips(device_ptr->next_device, command_buffer, texture_view);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	opal_mutexLock(&device_ptr->mutex);
+
+	// note: mip generation leaves the whole view in the copy src state without any barrier from the application
+	const State_TextureView *view_ptr = (const State_TextureView *)opal_mapFind(&device_ptr->texture_views, texture_view);
+	State_Texture *texture_ptr = (view_ptr) ? (State_Texture *)opal_mapFind(&device_ptr->textures, view_ptr->texture) : NULL;
+
+	if (texture_ptr)
+		state_setState(texture_ptr, view_ptr, OPAL_TEXTURE_STATE_COPY_SRC);
+
+	opal_mutexUnlock(&device_ptr->mutex);
+	return OPAL_SUCCESS;
+}
+
+static Opal_Result state_deviceCmdEndCopyPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	Opal_PassBarriersDesc resolved = {0};
+
+	opal_mutexLock(&device_ptr->mutex);
+
+	Opal_Result result = state_deviceResolveBarriers(device_ptr, barriers, &resolved);
+	if (result == OPAL_SUCCESS)
+		result = device_ptr->next.cmdEndCopyPass(device_ptr->next_device, command_buffer, (barriers) ? &resolved : NULL);
+
+	opal_mutexUnlock(&device_ptr->mutex);
+	return result;
+}
+
+static Opal_Result state_deviceCmdBeginAccelerationStructurePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	Opal_PassBarriersDesc resolved = {0};
+
+	opal_mutexLock(&device_ptr->mutex);
+
+	Opal_Result result = state_deviceResolveBarriers(device_ptr, barriers, &resolved);
+	if (result == OPAL_SUCCESS)
+		result = device_ptr->next.cmdBeginAccelerationStructurePass(device_ptr->next_device, command_buffer, (barriers) ? &resolved : NULL);
+
+	opal_mutexUnlock(&device_ptr->mutex);
+	return result;
+}
+
+static Opal_Result state_deviceCmdAccelerationStructureBuild(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureBuildDesc *desc)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdAccelerationStructureBuild(device_ptr->next_device, command_buffer, desc);
+}
+
+static Opal_Result state_deviceCmdAccelerationStructureBuildBatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_descs, const Opal_AccelerationStructureBuildDesc *descs)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdAccelerationStructureBuildBatch(device_ptr->next_device, command_buffer, num_descs, descs);
+}
+
+static Opal_Result state_deviceCmdAccelerationStructureCopy(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureCopyDesc *desc)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdAccelerationStructureCopy(device_ptr->next_device, command_buffer, desc);
+}
+
+static Opal_Result state_deviceCmdAccelerationStructureWriteCompactedSizes(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_acceleration_structures, const Opal_AccelerationStructure *acceleration_structures, Opal_BufferView dst)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	return device_ptr->next.cmdAccelerationStructureWriteCompactedSizes(device_ptr->next_device, command_buffer, num_acceleration_structures, acceleration_structures, dst);
+}
+
+static Opal_Result state_deviceCmdEndAccelerationStructurePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+
+	State_Device *device_ptr = (State_Device *)this;
+	Opal_PassBarriersDesc resolved = {0};
+
+	opal_mutexLock(&device_ptr->mutex);
+
+	Opal_Result result = state_deviceResolveBarriers(device_ptr, barriers, &resolved);
+	if (result == OPAL_SUCCESS)
+		result = device_ptr->next.cmdEndAccelerationStructurePass(device_ptr->next_device, command_buffer, (barriers) ? &resolved : NULL);
+
+	opal_mutexUnlock(&device_ptr->mutex);
+	return result;
+}
+
+/*
+ */
+static Opal_DeviceTable device_vtbl =
+{
+	state_deviceGetDeviceInfo,
+	state_deviceGetDeviceQueue,
+	state_deviceGetAccelerationStructurePrebuildInfo,
+	state_deviceGetAccelerationStructureAddress,
+	state_deviceGetSupportedSurfaceFormats,
+	state_deviceGetSupportedPresentModes,
+	state_deviceGetPreferredSurfaceFormat,
+	state_deviceGetPreferredSurfacePresentMode,
+
+	state_deviceCreateSemaphore,
+	state_deviceCreateFence,
+	state_deviceCreateBuffer,
+	state_deviceCreateTexture,
+	state_deviceCreateTextureView,
+	state_deviceCreateSampler,
+	state_deviceCreateAccelerationStructure,
+	state_deviceCreateShaderBindingTable,
+	state_deviceCreateCommandAllocator,
+	state_deviceCreateCommandBuffer,
+	state_deviceCreateShader,
+	state_deviceCreateDescriptorHeap,
+	state_deviceCreateDescriptorSetLayout,
+	state_deviceCreatePipelineLayout,
+	state_deviceCreateGraphicsPipeline,
+	state_deviceCreateMeshletPipeline,
+	state_deviceCreateComputePipeline,
+	state_deviceCreateRaytracePipeline,
+	state_deviceCreateGraphicsPipelines,
+	state_deviceCreateComputePipelines,
+	state_deviceCreateRaytracePipelines,
+	state_deviceCreateGraphicsPipelinesAsync,
+	state_deviceCreateComputePipelinesAsync,
+	state_deviceCreateRaytracePipelinesAsync,
+	state_deviceCreateSwapchain,
+
+	state_deviceDestroySemaphore,
+	state_deviceDestroyFence,
+	state_deviceDestroyBuffer,
+	state_deviceDestroyTexture,
+	state_deviceDestroyTextureView,
+	state_deviceDestroySampler,
+	state_deviceDestroyAccelerationStructure,
+	state_deviceDestroyShaderBindingTable,
+	state_deviceDestroyCommandAllocator,
+	state_deviceDestroyCommandBuffer,
+	state_deviceDestroyShader,
+	state_deviceDestroyDescriptorHeap,
+	state_deviceDestroyDescriptorSetLayout,
+	state_deviceDestroyPipelineLayout,
+	state_deviceDestroyGraphicsPipeline,
+	state_deviceDestroyComputePipeline,
+	state_deviceDestroyRaytracePipeline,
+	state_deviceDestroySwapchain,
+	state_deviceDestroyDevice,
+
+	state_deviceBuildShaderBindingTable,
+	state_deviceBuildAccelerationStructureInstanceBuffer,
+	state_deviceResetCommandAllocator,
+	state_deviceAllocateDescriptorSet,
+	state_deviceFreeDescriptorSet,
+	state_deviceMapBuffer,
+	state_deviceUnmapBuffer,
+	state_deviceWriteBuffer,
+	state_deviceUpdateDescriptorSet,
+	state_deviceBeginCommandBuffer,
+	state_deviceEndCommandBuffer,
+	state_deviceQuerySemaphore,
+	state_deviceSignalSemaphore,
+	state_deviceWaitSemaphore,
+	state_deviceWaitSemaphores,
+	state_deviceRegisterSemaphoreCallback,
+	state_deviceWaitPipelineTask,
+	state_deviceWaitQueue,
+	state_deviceWaitIdle,
+	state_deviceSubmit,
+	state_deviceAcquire,
+	state_devicePresent,
+	state_deviceWaitPresent,
+	state_deviceGetSwapchainFrameTiming,
+
+	state_deviceCmdSetDescriptorHeap,
+
+	state_deviceCmdBeginGraphicsPass,
+	state_deviceCmdGraphicsSetPipelineLayout,
+	state_deviceCmdGraphicsSetPipeline,
+	state_deviceCmdGraphicsSetDescriptorSet,
+	state_deviceCmdGraphicsSetVertexBuffers,
+	state_deviceCmdGraphicsSetIndexBuffer,
+	state_deviceCmdGraphicsSetViewport,
+	state_deviceCmdGraphicsSetScissor,
+	state_deviceCmdGraphicsDraw,
+	state_deviceCmdGraphicsDrawIndexed,
+	state_deviceCmdGraphicsMeshletDispatch,
+	state_deviceCmdEndGraphicsPass,
+
+	state_deviceCmdBeginComputePass,
+	state_deviceCmdComputeSetPipelineLayout,
+	state_deviceCmdComputeSetPipeline,
+	state_deviceCmdComputeSetDescriptorSet,
+	state_deviceCmdComputeMemoryBarrier,
+	state_deviceCmdComputeDispatch,
+	state_deviceCmdEndComputePass,
+
+	state_deviceCmdBeginRaytracePass,
+	state_deviceCmdRaytraceSetPipelineLayout,
+	state_deviceCmdRaytraceSetPipeline,
+	state_deviceCmdRaytraceSetDescriptorSet,
+	state_deviceCmdRaytraceSetShaderBindingTable,
+	state_deviceCmdRaytraceMemoryBarrier,
+	state_deviceCmdRaytraceDispatch,
+	state_deviceCmdEndRaytracePass,
+
+	state_deviceCmdBeginCopyPass,
+	state_deviceCmdCopyBufferToBuffer,
+	state_deviceCmdCopyBufferToTexture,
+	state_deviceCmdCopyTextureToBuffer,
+	state_deviceCmdCopyBufferToTextureRegions,
+	state_deviceCmdCopyTextureToBufferRegions,
+	state_deviceCmdCopyTextureToTexture,
+	state_deviceCmdFillBuffer,
+	state_deviceCmdUpdateBuffer,
+	state_deviceCmdClearTexture,
+	state_deviceCmdBlitTexture,
+	state_deviceCmdGenerateMips,
+	state_deviceCmdEndCopyPass,
+
+	state_deviceCmdBeginAccelerationStructurePass,
+	state_deviceCmdAccelerationStructureBuild,
+	state_deviceCmdAccelerationStructureBuildBatch,
+	state_deviceCmdAccelerationStructureCopy,
+	state_deviceCmdAccelerationStructureWriteCompactedSizes,
+	state_deviceCmdEndAccelerationStructurePass,
+};
+
+
+/*
+ */
+Opal_Result state_deviceInitialize(State_Device *device_ptr, Opal_Device next_device)
+{
+	assert(device_ptr);
+	assert(next_device != OPAL_NULL_HANDLE);
+
+	memset(device_ptr, 0, sizeof(State_Device));
+
+	// vtable
+	device_ptr->vtbl = &device_vtbl;
+
+	// data
+	device_ptr->next_device = next_device;
+
+	Opal_Result result = opalGetDeviceTable(next_device, &device_ptr->next);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	opal_mutexInitialize(&device_ptr->mutex);
+	opal_mapInitialize(&device_ptr->buffers, sizeof(Opal_BufferState), 64);
+	opal_mapInitialize(&device_ptr->textures, sizeof(State_Texture), 64);
+	opal_mapInitialize(&device_ptr->texture_views, sizeof(State_TextureView), 64);
+	opal_mapInitialize(&device_ptr->split_barriers, sizeof(State_SplitBarrier), 16);
+
+	return OPAL_SUCCESS;
+}
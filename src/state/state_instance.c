@@ -0,0 +1,143 @@
+#include "state_internal.h"
+
+#include <assert.h>
+#include <stdlib.h>
+
+/*
+ */
+static Opal_Result state_instanceWrapDevice(Opal_Device next_device, Opal_Device *device)
+{
+	assert(device);
+
+	State_Device *device_ptr = (State_Device *)malloc(sizeof(State_Device));
+	assert(device_ptr);
+
+	Opal_Result result = state_deviceInitialize(device_ptr, next_device);
+	if (result != OPAL_SUCCESS)
+	{
+		// note: the next layer already created its device, so it has to go as well
+		if (device_ptr->next.destroyDevice)
+			device_ptr->next.destroyDevice(next_device);
+
+		free(device_ptr);
+		return result;
+	}
+
+	*device = (Opal_Device)device_ptr;
+	return OPAL_SUCCESS;
+}
+
+/*
+ */
+static Opal_Result state_instanceEnumerateDevices(Opal_Instance this, uint32_t *device_count, Opal_DeviceInfo *infos)
+{
+	assert(this);
+
+	State_Instance *instance_ptr = (State_Instance *)this;
+	return instance_ptr->next.enumerateDevices(instance_ptr->next_instance, device_count, infos);
+}
+
+static Opal_Result state_instanceCreateSurface(Opal_Instance this, void *handle, Opal_Surface *surface)
+{
+	assert(this);
+
+	State_Instance *instance_ptr = (State_Instance *)this;
+	return instance_ptr->next.createSurface(instance_ptr->next_instance, handle, surface);
+}
+
+static Opal_Result state_instanceCreateHeadlessSurface(Opal_Instance this, uint32_t width, uint32_t height, Opal_Surface *surface)
+{
+	assert(this);
+
+	State_Instance *instance_ptr = (State_Instance *)this;
+	return instance_ptr->next.createHeadlessSurface(instance_ptr->next_instance, width, height, surface);
+}
+
+static Opal_Result state_instanceCreateDevice(Opal_Instance this, uint32_t index, Opal_Device *device)
+{
+	assert(this);
+	assert(device);
+
+	State_Instance *instance_ptr = (State_Instance *)this;
+	Opal_Device next_device = OPAL_NULL_HANDLE;
+
+	Opal_Result result = instance_ptr->next.createDevice(instance_ptr->next_instance, index, &next_device);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	return state_instanceWrapDevice(next_device, device);
+}
+
+static Opal_Result state_instanceCreateDefaultDevice(Opal_Instance this, Opal_DeviceHint hint, Opal_Device *device)
+{
+	assert(this);
+	assert(device);
+
+	State_Instance *instance_ptr = (State_Instance *)this;
+	Opal_Device next_device = OPAL_NULL_HANDLE;
+
+	Opal_Result result = instance_ptr->next.createDefaultDevice(instance_ptr->next_instance, hint, &next_device);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	return state_instanceWrapDevice(next_device, device);
+}
+
+static Opal_Result state_instanceDestroySurface(Opal_Instance this, Opal_Surface surface)
+{
+	assert(this);
+
+	State_Instance *instance_ptr = (State_Instance *)this;
+	return instance_ptr->next.destroySurface(instance_ptr->next_instance, surface);
+}
+
+static Opal_Result state_instanceDestroy(Opal_Instance this)
+{
+	assert(this);
+
+	State_Instance *instance_ptr = (State_Instance *)this;
+	Opal_Result result = instance_ptr->next.destroyInstance(instance_ptr->next_instance);
+
+	free(instance_ptr);
+	return result;
+}
+
+/*
+ */
+static Opal_InstanceTable instance_vtbl =
+{
+	state_instanceEnumerateDevices,
+
+	state_instanceCreateSurface,
+	state_instanceCreateHeadlessSurface,
+	state_instanceCreateDevice,
+	state_instanceCreateDefaultDevice,
+
+	state_instanceDestroySurface,
+	state_instanceDestroy,
+};
+
+/*
+ */
+Opal_Result state_opalWrapInstance(void *user_data, Opal_Api api, const Opal_InstanceDesc *desc, Opal_Instance next_instance, Opal_Instance *instance)
+{
+	OPAL_UNUSED(user_data);
+	OPAL_UNUSED(api);
+	OPAL_UNUSED(desc);
+
+	assert(next_instance != OPAL_NULL_HANDLE);
+	assert(instance);
+
+	State_Instance *ptr = (State_Instance *)malloc(sizeof(State_Instance));
+	assert(ptr);
+
+	// vtable
+	ptr->vtbl = &instance_vtbl;
+
+	// data
+	ptr->next_instance = next_instance;
+	opalGetInstanceTable(next_instance, &ptr->next);
+
+	*instance = (Opal_Instance)ptr;
+	return OPAL_SUCCESS;
+}
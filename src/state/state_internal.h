@@ -0,0 +1,71 @@
+#pragma once
+
+#include "opal_internal.h"
+
+#include "common/map.h"
+#include "common/thread.h"
+
+#define STATE_ALL_LAYERS 0xFFFFFFFF
+
+typedef struct State_Texture_t
+{
+	Opal_TextureType type;
+	uint32_t mip_count;
+	uint32_t layer_count;
+	Opal_TextureState *states;
+	Opal_TextureView *mip_views;
+	Opal_TextureView *subresource_views;
+} State_Texture;
+
+typedef struct State_TextureView_t
+{
+	Opal_Texture texture;
+	uint32_t base_mip;
+	uint32_t mip_count;
+	uint32_t base_layer;
+	uint32_t layer_count;
+} State_TextureView;
+
+typedef struct State_SplitBarrier_t
+{
+	Opal_BufferTransitionDesc *buffer_transitions;
+	uint32_t num_buffer_transitions;
+	uint32_t buffer_transitions_capacity;
+	Opal_TextureTransitionDesc *texture_transitions;
+	uint32_t num_texture_transitions;
+	uint32_t texture_transitions_capacity;
+	uint32_t pending;
+} State_SplitBarrier;
+
+typedef struct State_Instance_t
+{
+	Opal_InstanceTable *vtbl;
+	Opal_Instance next_instance;
+	Opal_InstanceTable next;
+} State_Instance;
+
+typedef struct State_Device_t
+{
+	Opal_DeviceTable *vtbl;
+	Opal_Device next_device;
+	Opal_DeviceTable next;
+
+	Opal_Mutex mutex;
+	Opal_Map buffers;
+	Opal_Map textures;
+	Opal_Map texture_views;
+	Opal_Map split_barriers;
+
+	Opal_BarrierDesc *barriers;
+	uint32_t barriers_capacity;
+
+	Opal_BufferTransitionDesc *buffer_transitions;
+	uint32_t num_buffer_transitions;
+	uint32_t buffer_transitions_capacity;
+
+	Opal_TextureTransitionDesc *texture_transitions;
+	uint32_t num_texture_transitions;
+	uint32_t texture_transitions_capacity;
+} State_Device;
+
+Opal_Result state_deviceInitialize(State_Device *device_ptr, Opal_Device next_device);
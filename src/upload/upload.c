@@ -0,0 +1,489 @@
+#include "upload_internal.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define UPLOAD_DEFAULT_RING_SIZE 0x2000000
+#define UPLOAD_DEFAULT_BATCHES 3
+#define UPLOAD_BUFFER_ALIGNMENT 16
+
+/*
+ */
+static OPAL_INLINE uint64_t upload_alignUp(uint64_t value, uint64_t alignment)
+{
+	assert(alignment > 0);
+	return (value + alignment - 1) / alignment * alignment;
+}
+
+/*
+ */
+static Opal_Result upload_uploaderRetire(Upload_Uploader *uploader)
+{
+	assert(uploader);
+
+	if (uploader->num_pending_batches == 0)
+		return OPAL_SUCCESS;
+
+	uint64_t completed_value = 0;
+	Opal_Result result = opalQuerySemaphore(uploader->device, uploader->semaphore, &completed_value);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	while (uploader->num_pending_batches > 0)
+	{
+		const Upload_Batch *batch = &uploader->batches[uploader->first_batch];
+		if (batch->value > completed_value)
+			break;
+
+		uploader->ring_tail = batch->ring_end;
+		uploader->first_batch = (uploader->first_batch + 1) % uploader->num_batches;
+		uploader->num_pending_batches--;
+	}
+
+	return OPAL_SUCCESS;
+}
+
+static Opal_Result upload_uploaderWaitOldest(Upload_Uploader *uploader)
+{
+	assert(uploader);
+	assert(uploader->num_pending_batches > 0);
+
+	const Upload_Batch *batch = &uploader->batches[uploader->first_batch];
+
+	Opal_Result result = opalWaitSemaphore(uploader->device, uploader->semaphore, batch->value, UINT64_MAX);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	return upload_uploaderRetire(uploader);
+}
+
+static Opal_Result upload_uploaderSubmit(Upload_Uploader *uploader)
+{
+	assert(uploader);
+
+	if (uploader->num_recorded_copies == 0)
+		return OPAL_SUCCESS;
+
+	assert(uploader->num_pending_batches < uploader->num_batches);
+
+	uint32_t index = (uploader->first_batch + uploader->num_pending_batches) % uploader->num_batches;
+	Upload_Batch *batch = &uploader->batches[index];
+
+	Opal_Result result = opalCmdEndCopyPass(uploader->device, batch->command_buffer, NULL);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	result = opalEndCommandBuffer(uploader->device, batch->command_buffer);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	uint64_t value = uploader->last_value + 1;
+
+	Opal_SubmitDesc submit = {0};
+	submit.num_command_buffers = 1;
+	submit.command_buffers = &batch->command_buffer;
+	submit.num_signal_semaphores = 1;
+	submit.signal_semaphores = &uploader->semaphore;
+	submit.signal_values = &value;
+
+	result = opalSubmit(uploader->device, uploader->queue, &submit);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	batch->value = value;
+	batch->ring_end = uploader->ring_head;
+
+	uploader->last_value = value;
+	uploader->num_pending_batches++;
+	uploader->num_recorded_copies = 0;
+
+	return OPAL_SUCCESS;
+}
+
+static Opal_Result upload_uploaderBeginBatch(Upload_Uploader *uploader, Opal_CommandBuffer *command_buffer)
+{
+	assert(uploader);
+	assert(command_buffer);
+
+	uint32_t index = (uploader->first_batch + uploader->num_pending_batches) % uploader->num_batches;
+	if (uploader->num_recorded_copies > 0)
+	{
+		*command_buffer = uploader->batches[index].command_buffer;
+		return OPAL_SUCCESS;
+	}
+
+	if (uploader->num_pending_batches == uploader->num_batches)
+	{
+		Opal_Result result = upload_uploaderWaitOldest(uploader);
+		if (result != OPAL_SUCCESS)
+			return result;
+
+		index = (uploader->first_batch + uploader->num_pending_batches) % uploader->num_batches;
+	}
+
+	Upload_Batch *batch = &uploader->batches[index];
+
+	Opal_Result result = opalResetCommandAllocator(uploader->device, batch->command_allocator);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	result = opalBeginCommandBuffer(uploader->device, batch->command_buffer);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	result = opalCmdBeginCopyPass(uploader->device, batch->command_buffer, NULL);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	*command_buffer = batch->command_buffer;
+	return OPAL_SUCCESS;
+}
+
+static uint32_t upload_uploaderFits(const Upload_Uploader *uploader, uint64_t size, uint64_t alignment, uint64_t *start)
+{
+	assert(uploader);
+	assert(start);
+
+	uint64_t position = upload_alignUp(uploader->ring_head, alignment);
+	uint64_t wrapped_position = position % uploader->ring_size;
+
+	// note: allocations never straddle the end of the ring, skip the remainder instead
+	if (wrapped_position + size > uploader->ring_size)
+		position += uploader->ring_size - wrapped_position;
+
+	*start = position;
+	return position + size - uploader->ring_tail <= uploader->ring_size;
+}
+
+static Opal_Result upload_uploaderAllocate(Upload_Uploader *uploader, uint64_t size, uint64_t alignment, uint64_t *offset)
+{
+	assert(uploader);
+	assert(offset);
+
+	if (size > uploader->ring_size)
+		return OPAL_NO_MEMORY;
+
+	uint64_t start = 0;
+	while (!upload_uploaderFits(uploader, size, alignment, &start))
+	{
+		Opal_Result result = upload_uploaderRetire(uploader);
+		if (result != OPAL_SUCCESS)
+			return result;
+
+		if (upload_uploaderFits(uploader, size, alignment, &start))
+			break;
+
+		if (uploader->num_recorded_copies > 0)
+			result = upload_uploaderSubmit(uploader);
+		else if (uploader->num_pending_batches > 0)
+			result = upload_uploaderWaitOldest(uploader);
+		else
+			uploader->ring_head = uploader->ring_tail = upload_alignUp(uploader->ring_head, uploader->ring_size);
+
+		if (result != OPAL_SUCCESS)
+			return result;
+	}
+
+	uploader->ring_head = start + size;
+
+	*offset = start % uploader->ring_size;
+	return OPAL_SUCCESS;
+}
+
+static Opal_Result upload_uploaderWrite(Upload_Uploader *uploader, uint64_t offset, const void *data, uint64_t size)
+{
+	assert(uploader);
+	assert(data);
+
+	if (uploader->ring_data == NULL)
+		return opalWriteBuffer(uploader->device, uploader->buffer, offset, data, size);
+
+	memcpy(uploader->ring_data + offset, data, (size_t)size);
+	return OPAL_SUCCESS;
+}
+
+static Opal_Result upload_uploaderCreateObjects(Upload_Uploader *uploader, const Opal_DeviceInfo *info)
+{
+	assert(uploader);
+	assert(info);
+
+	Opal_Device device = uploader->device;
+
+	Opal_SemaphoreDesc semaphore_desc = {0};
+	semaphore_desc.flags = OPAL_SEMAPHORE_CREATION_FLAGS_HOST_OPERATIONS;
+
+	Opal_Result result = opalCreateSemaphore(device, &semaphore_desc, &uploader->semaphore);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	Opal_BufferDesc buffer_desc = {0};
+	buffer_desc.size = uploader->ring_size;
+	buffer_desc.memory_type = OPAL_ALLOCATION_MEMORY_TYPE_UPLOAD;
+	buffer_desc.usage = OPAL_BUFFER_USAGE_COPY_SRC;
+	buffer_desc.hint = OPAL_ALLOCATION_HINT_PREFER_DEDICATED;
+
+	result = opalCreateBuffer(device, &buffer_desc, &uploader->buffer);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	// note: WebGPU can't submit copies from a mapped buffer, the ring is filled with queue writes there
+	if (info->api != OPAL_API_WEBGPU)
+	{
+		result = opalMapBuffer(device, uploader->buffer, (void **)&uploader->ring_data);
+		if (result != OPAL_SUCCESS)
+			return result;
+	}
+
+	uploader->batches = (Upload_Batch *)calloc(uploader->num_batches, sizeof(Upload_Batch));
+	assert(uploader->batches);
+
+	for (uint32_t i = 0; i < uploader->num_batches; ++i)
+	{
+		Upload_Batch *batch = &uploader->batches[i];
+
+		result = opalCreateCommandAllocator(device, uploader->queue, &batch->command_allocator);
+		if (result != OPAL_SUCCESS)
+			return result;
+
+		result = opalCreateCommandBuffer(device, batch->command_allocator, &batch->command_buffer);
+		if (result != OPAL_SUCCESS)
+			return result;
+	}
+
+	return OPAL_SUCCESS;
+}
+
+/*
+ */
+Opal_Result upload_uploaderInitialize(Upload_Uploader *uploader, Opal_Device device, const Opal_UploaderDesc *desc)
+{
+	assert(uploader);
+	assert(device);
+	assert(desc);
+
+	memset(uploader, 0, sizeof(Upload_Uploader));
+
+	Opal_DeviceInfo info = {0};
+	Opal_Result result = opalGetDeviceInfo(device, &info);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	Opal_DeviceEngineType engine_type = OPAL_DEVICE_ENGINE_TYPE_COPY;
+	if (info.features.queue_count[OPAL_DEVICE_ENGINE_TYPE_COPY] == 0)
+		engine_type = OPAL_DEVICE_ENGINE_TYPE_MAIN;
+
+	result = opalGetDeviceQueue(device, engine_type, 0, &uploader->queue);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	// note: texture offsets also have to be a multiple of the texel block size, which is at most 16 bytes
+	uploader->row_alignment = (info.limits.min_texture_copy_row_alignment > 0) ? info.limits.min_texture_copy_row_alignment : 1;
+	uploader->offset_alignment = info.limits.min_texture_copy_offset_alignment;
+	if (uploader->offset_alignment < UPLOAD_BUFFER_ALIGNMENT)
+		uploader->offset_alignment = UPLOAD_BUFFER_ALIGNMENT;
+
+	uploader->device = device;
+	uploader->ring_size = (desc->ring_size > 0) ? desc->ring_size : UPLOAD_DEFAULT_RING_SIZE;
+	uploader->ring_size = upload_alignUp(uploader->ring_size, uploader->offset_alignment);
+	uploader->num_batches = (desc->num_batches > 0) ? desc->num_batches : UPLOAD_DEFAULT_BATCHES;
+
+	result = upload_uploaderCreateObjects(uploader, &info);
+	if (result != OPAL_SUCCESS)
+		upload_uploaderShutdown(uploader);
+
+	return result;
+}
+
+Opal_Result upload_uploaderShutdown(Upload_Uploader *uploader)
+{
+	assert(uploader);
+
+	Opal_Device device = uploader->device;
+
+	upload_uploaderSubmit(uploader);
+
+	if (uploader->last_value > 0)
+		opalWaitSemaphore(device, uploader->semaphore, uploader->last_value, UINT64_MAX);
+
+	for (uint32_t i = 0; uploader->batches && i < uploader->num_batches; ++i)
+	{
+		Upload_Batch *batch = &uploader->batches[i];
+
+		if (batch->command_buffer != OPAL_NULL_HANDLE)
+			opalDestroyCommandBuffer(device, batch->command_buffer);
+
+		if (batch->command_allocator != OPAL_NULL_HANDLE)
+			opalDestroyCommandAllocator(device, batch->command_allocator);
+	}
+
+	free(uploader->batches);
+
+	if (uploader->ring_data != NULL)
+		opalUnmapBuffer(device, uploader->buffer);
+
+	if (uploader->buffer != OPAL_NULL_HANDLE)
+		opalDestroyBuffer(device, uploader->buffer);
+
+	if (uploader->semaphore != OPAL_NULL_HANDLE)
+		opalDestroySemaphore(device, uploader->semaphore);
+
+	memset(uploader, 0, sizeof(Upload_Uploader));
+	return OPAL_SUCCESS;
+}
+
+/*
+ */
+Opal_Result upload_opalCreateUploader(Opal_Device device, const Opal_UploaderDesc *desc, Opal_Uploader *uploader)
+{
+	assert(device);
+	assert(desc);
+	assert(uploader);
+
+	Upload_Uploader *ptr = (Upload_Uploader *)malloc(sizeof(Upload_Uploader));
+	assert(ptr);
+
+	Opal_Result result = upload_uploaderInitialize(ptr, device, desc);
+	if (result != OPAL_SUCCESS)
+	{
+		free(ptr);
+		return result;
+	}
+
+	*uploader = (Opal_Uploader)ptr;
+	return OPAL_SUCCESS;
+}
+
+Opal_Result upload_opalUploadBuffer(Opal_Uploader uploader, Opal_Buffer buffer, uint64_t offset, const void *data, uint64_t size)
+{
+	assert(uploader);
+	assert(buffer);
+	assert(data || size == 0);
+
+	Upload_Uploader *ptr = (Upload_Uploader *)uploader;
+	const uint8_t *bytes = (const uint8_t *)data;
+
+	// note: large uploads are split so that copying the next chunk overlaps with the previous one on the GPU
+	uint64_t max_chunk_size = ptr->ring_size / 2;
+
+	while (size > 0)
+	{
+		uint64_t chunk_size = (size < max_chunk_size) ? size : max_chunk_size;
+		uint64_t ring_offset = 0;
+
+		Opal_Result result = upload_uploaderAllocate(ptr, chunk_size, UPLOAD_BUFFER_ALIGNMENT, &ring_offset);
+		if (result != OPAL_SUCCESS)
+			return result;
+
+		Opal_CommandBuffer command_buffer = OPAL_NULL_HANDLE;
+		result = upload_uploaderBeginBatch(ptr, &command_buffer);
+		if (result != OPAL_SUCCESS)
+			return result;
+
+		result = upload_uploaderWrite(ptr, ring_offset, bytes, chunk_size);
+		if (result != OPAL_SUCCESS)
+			return result;
+
+		result = opalCmdCopyBufferToBuffer(ptr->device, command_buffer, ptr->buffer, ring_offset, buffer, offset, chunk_size);
+		if (result != OPAL_SUCCESS)
+			return result;
+
+		ptr->num_recorded_copies++;
+
+		bytes += chunk_size;
+		offset += chunk_size;
+		size -= chunk_size;
+	}
+
+	return OPAL_SUCCESS;
+}
+
+Opal_Result upload_opalUploadTexture(Opal_Uploader uploader, Opal_TextureRegion dst, Opal_Extent3D size, const void *data, uint32_t row_size, uint32_t num_rows)
+{
+	assert(uploader);
+	assert(dst.texture_view);
+	assert(data);
+	assert(row_size > 0);
+	assert(num_rows > 0);
+
+	Upload_Uploader *ptr = (Upload_Uploader *)uploader;
+	const uint8_t *bytes = (const uint8_t *)data;
+
+	uint32_t depth = (size.depth > 0) ? size.depth : 1;
+	uint32_t total_rows = num_rows * depth;
+	uint64_t row_pitch = upload_alignUp(row_size, ptr->row_alignment);
+
+	uint64_t ring_offset = 0;
+	Opal_Result result = upload_uploaderAllocate(ptr, row_pitch * total_rows, ptr->offset_alignment, &ring_offset);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	Opal_CommandBuffer command_buffer = OPAL_NULL_HANDLE;
+	result = upload_uploaderBeginBatch(ptr, &command_buffer);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	if (row_pitch == row_size)
+	{
+		result = upload_uploaderWrite(ptr, ring_offset, bytes, row_pitch * total_rows);
+		if (result != OPAL_SUCCESS)
+			return result;
+	}
+	else
+	{
+		for (uint32_t i = 0; i < total_rows; ++i)
+		{
+			result = upload_uploaderWrite(ptr, ring_offset + row_pitch * i, bytes + (uint64_t)row_size * i, row_size);
+			if (result != OPAL_SUCCESS)
+				return result;
+		}
+	}
+
+	Opal_BufferTextureRegion src = {0};
+	src.buffer = ptr->buffer;
+	src.offset = ring_offset;
+	src.row_size = (uint32_t)row_pitch;
+	src.num_rows = num_rows;
+
+	result = opalCmdCopyBufferToTexture(ptr->device, command_buffer, src, dst, size);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	ptr->num_recorded_copies++;
+	return OPAL_SUCCESS;
+}
+
+Opal_Result upload_opalFlushUploads(Opal_Uploader uploader, Opal_Semaphore *semaphore, uint64_t *value)
+{
+	assert(uploader);
+
+	Upload_Uploader *ptr = (Upload_Uploader *)uploader;
+
+	Opal_Result result = upload_uploaderSubmit(ptr);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	result = upload_uploaderRetire(ptr);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	if (semaphore)
+		*semaphore = ptr->semaphore;
+
+	if (value)
+		*value = ptr->last_value;
+
+	return OPAL_SUCCESS;
+}
+
+Opal_Result upload_opalDestroyUploader(Opal_Uploader uploader)
+{
+	assert(uploader);
+
+	Upload_Uploader *ptr = (Upload_Uploader *)uploader;
+
+	upload_uploaderShutdown(ptr);
+	free(ptr);
+
+	return OPAL_SUCCESS;
+}
@@ -0,0 +1,383 @@
+#include "upload_internal.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define UPLOAD_COMPACTOR_DEFAULT_SIZES 1024
+#define UPLOAD_COMPACTOR_DEFAULT_ENTRIES 64
+
+/*
+ */
+static Upload_CompactorQuery *upload_compactorAddQuery(Upload_Compactor *compactor)
+{
+	assert(compactor);
+
+	if (compactor->num_queries == compactor->query_capacity)
+	{
+		compactor->query_capacity *= 2;
+		compactor->queries = (Upload_CompactorQuery *)realloc(compactor->queries, sizeof(Upload_CompactorQuery) * compactor->query_capacity);
+		assert(compactor->queries);
+	}
+
+	Upload_CompactorQuery *query = &compactor->queries[compactor->num_queries++];
+	memset(query, 0, sizeof(Upload_CompactorQuery));
+
+	return query;
+}
+
+static Upload_CompactorOriginal *upload_compactorAddOriginal(Upload_Compactor *compactor)
+{
+	assert(compactor);
+
+	if (compactor->num_originals == compactor->original_capacity)
+	{
+		compactor->original_capacity *= 2;
+		compactor->originals = (Upload_CompactorOriginal *)realloc(compactor->originals, sizeof(Upload_CompactorOriginal) * compactor->original_capacity);
+		assert(compactor->originals);
+	}
+
+	Upload_CompactorOriginal *original = &compactor->originals[compactor->num_originals++];
+	memset(original, 0, sizeof(Upload_CompactorOriginal));
+
+	return original;
+}
+
+static Opal_Result upload_compactorAllocate(Upload_Compactor *compactor, uint32_t count, uint64_t *position)
+{
+	assert(compactor);
+	assert(position);
+
+	if (count > compactor->max_sizes)
+		return OPAL_NO_MEMORY;
+
+	// note: nothing in flight, restart from the beginning so the sizes of one call don't get split by the wrap
+	if (compactor->num_queries == 0)
+		compactor->ring_head = compactor->ring_tail = 0;
+
+	uint64_t head = compactor->ring_head;
+	uint64_t wrapped_head = head % compactor->max_sizes;
+
+	if (wrapped_head + count > compactor->max_sizes)
+		head += compactor->max_sizes - wrapped_head;
+
+	if (head + count - compactor->ring_tail > compactor->max_sizes)
+		return OPAL_NO_MEMORY;
+
+	compactor->ring_head = head + count;
+
+	*position = head;
+	return OPAL_SUCCESS;
+}
+
+static Opal_Result upload_compactorRetireOriginals(Upload_Compactor *compactor)
+{
+	assert(compactor);
+
+	Opal_Semaphore semaphore = OPAL_NULL_HANDLE;
+	uint64_t completed_value = 0;
+	uint32_t completed = 0;
+
+	for (; completed < compactor->num_submitted_originals; ++completed)
+	{
+		const Upload_CompactorOriginal *original = &compactor->originals[completed];
+
+		if (original->semaphore != semaphore)
+		{
+			semaphore = original->semaphore;
+
+			Opal_Result result = opalQuerySemaphore(compactor->device, semaphore, &completed_value);
+			if (result != OPAL_SUCCESS)
+				return result;
+		}
+
+		if (original->value > completed_value)
+			break;
+
+		opalDestroyAccelerationStructure(compactor->device, original->acceleration_structure);
+	}
+
+	if (completed == 0)
+		return OPAL_SUCCESS;
+
+	memmove(compactor->originals, compactor->originals + completed, sizeof(Upload_CompactorOriginal) * (compactor->num_originals - completed));
+	compactor->num_originals -= completed;
+	compactor->num_submitted_originals -= completed;
+
+	return OPAL_SUCCESS;
+}
+
+static Opal_Result upload_compactorCompact(Upload_Compactor *compactor, Opal_CommandBuffer command_buffer, const Upload_CompactorQuery *query)
+{
+	assert(compactor);
+	assert(command_buffer);
+	assert(query);
+
+	uint64_t size = compactor->sizes[query->slot];
+
+	// note: backends that don't report compacted sizes leave zero, the original is kept as is
+	if (size == 0)
+		return OPAL_SUCCESS;
+
+	Opal_AccelerationStructureDesc acceleration_structure_desc = {0};
+	acceleration_structure_desc.type = compactor->type;
+	acceleration_structure_desc.size = size;
+
+	Opal_AccelerationStructure compacted = OPAL_NULL_HANDLE;
+	Opal_Result result = opalCreateAccelerationStructure(compactor->device, &acceleration_structure_desc, &compacted);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	Opal_AccelerationStructureCopyDesc copy_desc = {0};
+	copy_desc.copy_mode = OPAL_ACCELERATION_STRUCTURE_COPY_MODE_COMPACT;
+	copy_desc.src_acceleration_structure = query->acceleration_structure;
+	copy_desc.dst_acceleration_structure = compacted;
+
+	result = opalCmdAccelerationStructureCopy(compactor->device, command_buffer, &copy_desc);
+	if (result != OPAL_SUCCESS)
+	{
+		opalDestroyAccelerationStructure(compactor->device, compacted);
+		return result;
+	}
+
+	Upload_CompactorOriginal *original = upload_compactorAddOriginal(compactor);
+	original->acceleration_structure = query->acceleration_structure;
+
+	if (query->callback)
+		query->callback(query->user_data, query->acceleration_structure, compacted);
+
+	return OPAL_SUCCESS;
+}
+
+/*
+ */
+Opal_Result upload_compactorInitialize(Upload_Compactor *compactor, Opal_Device device, const Opal_CompactorDesc *desc)
+{
+	assert(compactor);
+	assert(device);
+	assert(desc);
+
+	memset(compactor, 0, sizeof(Upload_Compactor));
+
+	Opal_DeviceInfo info = {0};
+	Opal_Result result = opalGetDeviceInfo(device, &info);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	if (info.api == OPAL_API_WEBGPU)
+		return OPAL_NOT_SUPPORTED;
+
+	compactor->device = device;
+	compactor->type = desc->type;
+	compactor->max_sizes = (desc->max_pending_sizes > 0) ? desc->max_pending_sizes : UPLOAD_COMPACTOR_DEFAULT_SIZES;
+
+	Opal_BufferDesc buffer_desc = {0};
+	buffer_desc.size = sizeof(uint64_t) * compactor->max_sizes;
+	buffer_desc.memory_type = OPAL_ALLOCATION_MEMORY_TYPE_READBACK;
+	buffer_desc.usage = OPAL_BUFFER_USAGE_COPY_DST;
+	buffer_desc.hint = OPAL_ALLOCATION_HINT_AUTO;
+	buffer_desc.initial_state = OPAL_BUFFER_STATE_COPY_DST;
+
+	result = opalCreateBuffer(device, &buffer_desc, &compactor->buffer);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	result = opalMapBuffer(device, compactor->buffer, (void **)&compactor->sizes);
+	if (result != OPAL_SUCCESS)
+	{
+		opalDestroyBuffer(device, compactor->buffer);
+		return result;
+	}
+
+	compactor->query_capacity = UPLOAD_COMPACTOR_DEFAULT_ENTRIES;
+	compactor->queries = (Upload_CompactorQuery *)malloc(sizeof(Upload_CompactorQuery) * compactor->query_capacity);
+	assert(compactor->queries);
+
+	compactor->original_capacity = UPLOAD_COMPACTOR_DEFAULT_ENTRIES;
+	compactor->originals = (Upload_CompactorOriginal *)malloc(sizeof(Upload_CompactorOriginal) * compactor->original_capacity);
+	assert(compactor->originals);
+
+	return OPAL_SUCCESS;
+}
+
+Opal_Result upload_compactorShutdown(Upload_Compactor *compactor)
+{
+	assert(compactor);
+
+	Opal_Device device = compactor->device;
+
+	// note: sizes may still be written to the buffer, wait for the queries as well
+	for (uint32_t i = 0; i < compactor->num_submitted_queries; ++i)
+	{
+		const Upload_CompactorQuery *query = &compactor->queries[i];
+		opalWaitSemaphore(device, query->semaphore, query->value, UINT64_MAX);
+	}
+
+	// note: originals of copies that were never flushed are destroyed right away
+	for (uint32_t i = 0; i < compactor->num_originals; ++i)
+	{
+		const Upload_CompactorOriginal *original = &compactor->originals[i];
+
+		if (i < compactor->num_submitted_originals)
+			opalWaitSemaphore(device, original->semaphore, original->value, UINT64_MAX);
+
+		opalDestroyAccelerationStructure(device, original->acceleration_structure);
+	}
+
+	free(compactor->queries);
+	free(compactor->originals);
+
+	opalUnmapBuffer(device, compactor->buffer);
+	opalDestroyBuffer(device, compactor->buffer);
+
+	memset(compactor, 0, sizeof(Upload_Compactor));
+	return OPAL_SUCCESS;
+}
+
+/*
+ */
+Opal_Result upload_opalCreateCompactor(Opal_Device device, const Opal_CompactorDesc *desc, Opal_Compactor *compactor)
+{
+	assert(device);
+	assert(desc);
+	assert(compactor);
+
+	Upload_Compactor *ptr = (Upload_Compactor *)malloc(sizeof(Upload_Compactor));
+	assert(ptr);
+
+	Opal_Result result = upload_compactorInitialize(ptr, device, desc);
+	if (result != OPAL_SUCCESS)
+	{
+		free(ptr);
+		return result;
+	}
+
+	*compactor = (Opal_Compactor)ptr;
+	return OPAL_SUCCESS;
+}
+
+Opal_Result upload_opalCompactAccelerationStructures(Opal_Compactor compactor, Opal_CommandBuffer command_buffer, uint32_t num_acceleration_structures, const Opal_AccelerationStructure *acceleration_structures, PFN_opalCompactionCallback callback, void *user_data)
+{
+	assert(compactor);
+	assert(command_buffer);
+	assert(num_acceleration_structures > 0);
+	assert(acceleration_structures);
+
+	Upload_Compactor *ptr = (Upload_Compactor *)compactor;
+
+	uint64_t position = 0;
+	Opal_Result result = upload_compactorAllocate(ptr, num_acceleration_structures, &position);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	uint32_t first_slot = (uint32_t)(position % ptr->max_sizes);
+	memset(ptr->sizes + first_slot, 0, sizeof(uint64_t) * num_acceleration_structures);
+
+	Opal_BufferView dst = {0};
+	dst.buffer = ptr->buffer;
+	dst.offset = sizeof(uint64_t) * first_slot;
+	dst.size = sizeof(uint64_t) * num_acceleration_structures;
+
+	result = opalCmdAccelerationStructureWriteCompactedSizes(ptr->device, command_buffer, num_acceleration_structures, acceleration_structures, dst);
+	if (result != OPAL_SUCCESS)
+	{
+		ptr->ring_head = position;
+		return result;
+	}
+
+	for (uint32_t i = 0; i < num_acceleration_structures; ++i)
+	{
+		Upload_CompactorQuery *query = upload_compactorAddQuery(ptr);
+		query->acceleration_structure = acceleration_structures[i];
+		query->callback = callback;
+		query->user_data = user_data;
+		query->slot = first_slot + i;
+		query->ring_end = position + i + 1;
+	}
+
+	return OPAL_SUCCESS;
+}
+
+Opal_Result upload_opalFlushCompactions(Opal_Compactor compactor, Opal_Semaphore semaphore, uint64_t value)
+{
+	assert(compactor);
+	assert(semaphore);
+
+	Upload_Compactor *ptr = (Upload_Compactor *)compactor;
+
+	for (uint32_t i = ptr->num_submitted_queries; i < ptr->num_queries; ++i)
+	{
+		ptr->queries[i].semaphore = semaphore;
+		ptr->queries[i].value = value;
+	}
+
+	for (uint32_t i = ptr->num_submitted_originals; i < ptr->num_originals; ++i)
+	{
+		ptr->originals[i].semaphore = semaphore;
+		ptr->originals[i].value = value;
+	}
+
+	ptr->num_submitted_queries = ptr->num_queries;
+	ptr->num_submitted_originals = ptr->num_originals;
+	return OPAL_SUCCESS;
+}
+
+Opal_Result upload_opalPollCompactions(Opal_Compactor compactor, Opal_CommandBuffer command_buffer)
+{
+	assert(compactor);
+	assert(command_buffer);
+
+	Upload_Compactor *ptr = (Upload_Compactor *)compactor;
+
+	Opal_Result result = upload_compactorRetireOriginals(ptr);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	Opal_Semaphore semaphore = OPAL_NULL_HANDLE;
+	uint64_t completed_value = 0;
+	uint32_t completed = 0;
+
+	for (; completed < ptr->num_submitted_queries; ++completed)
+	{
+		const Upload_CompactorQuery *query = &ptr->queries[completed];
+
+		if (query->semaphore != semaphore)
+		{
+			semaphore = query->semaphore;
+
+			result = opalQuerySemaphore(ptr->device, semaphore, &completed_value);
+			if (result != OPAL_SUCCESS)
+				break;
+		}
+
+		if (query->value > completed_value)
+			break;
+
+		result = upload_compactorCompact(ptr, command_buffer, query);
+		if (result != OPAL_SUCCESS)
+			break;
+
+		ptr->ring_tail = query->ring_end;
+	}
+
+	if (completed > 0)
+	{
+		memmove(ptr->queries, ptr->queries + completed, sizeof(Upload_CompactorQuery) * (ptr->num_queries - completed));
+		ptr->num_queries -= completed;
+		ptr->num_submitted_queries -= completed;
+	}
+
+	return result;
+}
+
+Opal_Result upload_opalDestroyCompactor(Opal_Compactor compactor)
+{
+	assert(compactor);
+
+	Upload_Compactor *ptr = (Upload_Compactor *)compactor;
+
+	upload_compactorShutdown(ptr);
+	free(ptr);
+
+	return OPAL_SUCCESS;
+}
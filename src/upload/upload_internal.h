@@ -0,0 +1,139 @@
+#pragma once
+
+#include "opal_internal.h"
+
+#include "common/thread.h"
+
+typedef struct Upload_Batch_t
+{
+	Opal_CommandAllocator command_allocator;
+	Opal_CommandBuffer command_buffer;
+	uint64_t value;
+	uint64_t ring_end;
+} Upload_Batch;
+
+typedef struct Upload_Uploader_t
+{
+	Opal_Device device;
+	Opal_Queue queue;
+	Opal_Semaphore semaphore;
+	Opal_Buffer buffer;
+	uint8_t *ring_data;
+	uint64_t ring_size;
+	uint64_t ring_head;
+	uint64_t ring_tail;
+	uint32_t row_alignment;
+	uint64_t offset_alignment;
+	Upload_Batch *batches;
+	uint32_t num_batches;
+	uint32_t first_batch;
+	uint32_t num_pending_batches;
+	uint32_t num_recorded_copies;
+	uint64_t last_value;
+} Upload_Uploader;
+
+typedef struct Upload_TransientFrame_t
+{
+	Opal_Semaphore semaphore;
+	uint64_t value;
+} Upload_TransientFrame;
+
+typedef struct Upload_TransientAllocator_t
+{
+	Opal_Device device;
+	Opal_Buffer buffer;
+	uint8_t *data;
+	uint8_t *shadow_data;
+	uint64_t frame_size;
+	uint64_t min_alignment;
+	uint64_t offset;
+	Upload_TransientFrame *frames;
+	uint32_t num_frames;
+	uint32_t current_frame;
+	uint32_t frame_ready;
+} Upload_TransientAllocator;
+
+typedef struct Upload_ReadbackRequest_t
+{
+	PFN_opalReadbackCallback callback;
+	void *user_data;
+	Opal_Semaphore semaphore;
+	uint64_t value;
+	uint64_t offset;
+	uint64_t ring_end;
+	uint32_t row_size;
+	uint32_t row_pitch;
+	uint32_t num_rows;
+	uint32_t ready;
+} Upload_ReadbackRequest;
+
+typedef struct Upload_Readback_t
+{
+	Opal_Device device;
+	Opal_Buffer buffer;
+	uint8_t *ring_data;
+	uint64_t ring_size;
+	uint64_t ring_head;
+	uint64_t ring_tail;
+	Upload_ReadbackRequest *requests;
+	uint32_t request_capacity;
+	uint32_t request_first;
+	uint32_t request_completed;
+	uint32_t request_submitted;
+	uint32_t request_last;
+	uint32_t pending_flushes;
+	Opal_Mutex mutex;
+	Opal_Condition condition;
+	Opal_Thread thread;
+	uint32_t has_thread;
+	uint32_t shutdown;
+} Upload_Readback;
+
+typedef struct Upload_CompactorQuery_t
+{
+	Opal_AccelerationStructure acceleration_structure;
+	PFN_opalCompactionCallback callback;
+	void *user_data;
+	Opal_Semaphore semaphore;
+	uint64_t value;
+	uint64_t ring_end;
+	uint32_t slot;
+} Upload_CompactorQuery;
+
+typedef struct Upload_CompactorOriginal_t
+{
+	Opal_AccelerationStructure acceleration_structure;
+	Opal_Semaphore semaphore;
+	uint64_t value;
+} Upload_CompactorOriginal;
+
+typedef struct Upload_Compactor_t
+{
+	Opal_Device device;
+	Opal_Buffer buffer;
+	Opal_AccelerationStructureType type;
+	uint64_t *sizes;
+	uint32_t max_sizes;
+	uint64_t ring_head;
+	uint64_t ring_tail;
+	Upload_CompactorQuery *queries;
+	uint32_t num_queries;
+	uint32_t num_submitted_queries;
+	uint32_t query_capacity;
+	Upload_CompactorOriginal *originals;
+	uint32_t num_originals;
+	uint32_t num_submitted_originals;
+	uint32_t original_capacity;
+} Upload_Compactor;
+
+Opal_Result upload_uploaderInitialize(Upload_Uploader *uploader, Opal_Device device, const Opal_UploaderDesc *desc);
+Opal_Result upload_uploaderShutdown(Upload_Uploader *uploader);
+
+Opal_Result upload_transientInitialize(Upload_TransientAllocator *allocator, Opal_Device device, const Opal_TransientAllocatorDesc *desc);
+Opal_Result upload_transientShutdown(Upload_TransientAllocator *allocator);
+
+Opal_Result upload_readbackInitialize(Upload_Readback *readback, Opal_Device device, const Opal_ReadbackDesc *desc);
+Opal_Result upload_readbackShutdown(Upload_Readback *readback);
+
+Opal_Result upload_compactorInitialize(Upload_Compactor *compactor, Opal_Device device, const Opal_CompactorDesc *desc);
+Opal_Result upload_compactorShutdown(Upload_Compactor *compactor);
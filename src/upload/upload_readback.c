@@ -0,0 +1,524 @@
+#include "upload_internal.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define UPLOAD_READBACK_DEFAULT_RING_SIZE 0x400000
+#define UPLOAD_READBACK_DEFAULT_REQUESTS 64
+#define UPLOAD_READBACK_BUFFER_ALIGNMENT 16
+#define UPLOAD_READBACK_ROW_ALIGNMENT 256
+#define UPLOAD_READBACK_OFFSET_ALIGNMENT 512
+
+/*
+ */
+static OPAL_INLINE uint64_t upload_readbackAlignUp(uint64_t value, uint64_t alignment)
+{
+	assert(alignment > 0);
+	return (value + alignment - 1) / alignment * alignment;
+}
+
+static OPAL_INLINE Upload_ReadbackRequest *upload_readbackGetRequest(Upload_Readback *readback, uint32_t index)
+{
+	assert(readback);
+	assert(readback->request_capacity > 0);
+
+	return &readback->requests[index % readback->request_capacity];
+}
+
+/*
+ */
+static void upload_readbackInvoke(const Upload_ReadbackRequest *request, const uint8_t *data, uint8_t **scratch, uint64_t *scratch_size)
+{
+	assert(request);
+	assert(data);
+	assert(scratch);
+	assert(scratch_size);
+
+	if (request->callback == NULL)
+		return;
+
+	uint64_t size = (uint64_t)request->row_size * request->num_rows;
+
+	// note: texture rows are copied with 256 byte pitch, callbacks get them tightly packed
+	if (request->row_pitch != request->row_size)
+	{
+		if (*scratch_size < size)
+		{
+			*scratch = (uint8_t *)realloc(*scratch, (size_t)size);
+			*scratch_size = size;
+			assert(*scratch);
+		}
+
+		for (uint32_t i = 0; i < request->num_rows; ++i)
+			memcpy(*scratch + (uint64_t)request->row_size * i, data + (uint64_t)request->row_pitch * i, request->row_size);
+
+		data = *scratch;
+	}
+
+	request->callback(request->user_data, data, size);
+}
+
+static void upload_readbackRelease(Upload_Readback *readback, const Upload_ReadbackRequest *request)
+{
+	assert(readback);
+	assert(request);
+
+	readback->ring_tail = request->ring_end;
+	readback->request_first++;
+}
+
+static void upload_readbackThreadFunction(void *user_data)
+{
+	Upload_Readback *readback = (Upload_Readback *)user_data;
+	assert(readback);
+
+	uint8_t *scratch = NULL;
+	uint64_t scratch_size = 0;
+
+	opal_mutexLock(&readback->mutex);
+
+	for (;;)
+	{
+		while (readback->request_first == readback->request_completed && !readback->shutdown)
+			opal_conditionWait(&readback->condition, &readback->mutex);
+
+		if (readback->request_first == readback->request_completed)
+			break;
+
+		Upload_ReadbackRequest request = *upload_readbackGetRequest(readback, readback->request_first);
+		opal_mutexUnlock(&readback->mutex);
+
+		upload_readbackInvoke(&request, readback->ring_data + request.offset, &scratch, &scratch_size);
+
+		opal_mutexLock(&readback->mutex);
+		upload_readbackRelease(readback, &request);
+	}
+
+	opal_mutexUnlock(&readback->mutex);
+	free(scratch);
+}
+
+static void upload_readbackSemaphoreCallback(void *user_data, Opal_Semaphore semaphore, uint64_t value)
+{
+	Upload_Readback *readback = (Upload_Readback *)user_data;
+	assert(readback);
+
+	opal_mutexLock(&readback->mutex);
+
+	// note: flushes may complete out of order across semaphores, callbacks still run in submission order
+	for (uint32_t i = readback->request_completed; i != readback->request_submitted; ++i)
+	{
+		Upload_ReadbackRequest *request = upload_readbackGetRequest(readback, i);
+		if (request->semaphore == semaphore && request->value <= value)
+			request->ready = 1;
+	}
+
+	while (readback->request_completed != readback->request_submitted && upload_readbackGetRequest(readback, readback->request_completed)->ready)
+		readback->request_completed++;
+
+	assert(readback->pending_flushes > 0);
+	readback->pending_flushes--;
+
+	opal_conditionBroadcast(&readback->condition);
+	opal_mutexUnlock(&readback->mutex);
+}
+
+static Opal_Result upload_readbackInvokeInline(Upload_Readback *readback)
+{
+	assert(readback);
+
+	opal_mutexLock(&readback->mutex);
+	uint32_t request_completed = readback->request_completed;
+	opal_mutexUnlock(&readback->mutex);
+
+	if (readback->request_first == request_completed)
+		return OPAL_SUCCESS;
+
+	// note: WebGPU can't keep the ring mapped while copies are in flight, so it's mapped just for the callbacks
+	uint8_t *ring_data = readback->ring_data;
+	if (ring_data == NULL)
+	{
+		Opal_Result result = opalMapBuffer(readback->device, readback->buffer, (void **)&ring_data);
+		if (result != OPAL_SUCCESS)
+			return result;
+	}
+
+	uint8_t *scratch = NULL;
+	uint64_t scratch_size = 0;
+
+	while (readback->request_first != request_completed)
+	{
+		Upload_ReadbackRequest request = *upload_readbackGetRequest(readback, readback->request_first);
+
+		upload_readbackInvoke(&request, ring_data + request.offset, &scratch, &scratch_size);
+		upload_readbackRelease(readback, &request);
+	}
+
+	free(scratch);
+
+	if (readback->ring_data == NULL)
+		return opalUnmapBuffer(readback->device, readback->buffer);
+
+	return OPAL_SUCCESS;
+}
+
+static Opal_Result upload_readbackAllocate(Upload_Readback *readback, uint64_t size, uint64_t alignment, uint64_t *offset)
+{
+	assert(readback);
+	assert(offset);
+
+	if (size > readback->ring_size)
+		return OPAL_NO_MEMORY;
+
+	opal_mutexLock(&readback->mutex);
+	uint64_t ring_tail = readback->ring_tail;
+
+	// note: nothing in flight, restart from the beginning so large requests don't get split by the wrap
+	if (readback->request_first == readback->request_last)
+		readback->ring_head = readback->ring_tail = ring_tail = upload_readbackAlignUp(readback->ring_head, readback->ring_size);
+
+	opal_mutexUnlock(&readback->mutex);
+
+	uint64_t position = upload_readbackAlignUp(readback->ring_head, alignment);
+	uint64_t wrapped_position = position % readback->ring_size;
+
+	if (wrapped_position + size > readback->ring_size)
+		position += readback->ring_size - wrapped_position;
+
+	// note: the render thread never waits for callbacks, running out of space is reported instead
+	if (position + size - ring_tail > readback->ring_size)
+		return OPAL_NO_MEMORY;
+
+	readback->ring_head = position + size;
+
+	*offset = position % readback->ring_size;
+	return OPAL_SUCCESS;
+}
+
+static Opal_Result upload_readbackRecordBufferCopy(Upload_Readback *readback, Opal_CommandBuffer command_buffer, Opal_Buffer buffer, uint64_t offset, uint64_t ring_offset, uint64_t size)
+{
+	assert(readback);
+
+	Opal_Result result = opalCmdBeginCopyPass(readback->device, command_buffer, NULL);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	result = opalCmdCopyBufferToBuffer(readback->device, command_buffer, buffer, offset, readback->buffer, ring_offset, size);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	return opalCmdEndCopyPass(readback->device, command_buffer, NULL);
+}
+
+static Opal_Result upload_readbackRecordTextureCopy(Upload_Readback *readback, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_BufferTextureRegion dst, Opal_Extent3D size)
+{
+	assert(readback);
+
+	Opal_Result result = opalCmdBeginCopyPass(readback->device, command_buffer, NULL);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	result = opalCmdCopyTextureToBuffer(readback->device, command_buffer, src, dst, size);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	return opalCmdEndCopyPass(readback->device, command_buffer, NULL);
+}
+
+static Upload_ReadbackRequest *upload_readbackAddRequest(Upload_Readback *readback)
+{
+	assert(readback);
+
+	opal_mutexLock(&readback->mutex);
+
+	if (readback->request_last - readback->request_first == readback->request_capacity)
+	{
+		uint32_t capacity = readback->request_capacity * 2;
+		Upload_ReadbackRequest *requests = (Upload_ReadbackRequest *)malloc(sizeof(Upload_ReadbackRequest) * capacity);
+		assert(requests);
+
+		for (uint32_t i = readback->request_first; i != readback->request_last; ++i)
+			requests[i % capacity] = readback->requests[i % readback->request_capacity];
+
+		free(readback->requests);
+		readback->requests = requests;
+		readback->request_capacity = capacity;
+	}
+
+	Upload_ReadbackRequest *request = upload_readbackGetRequest(readback, readback->request_last);
+	memset(request, 0, sizeof(Upload_ReadbackRequest));
+
+	opal_mutexUnlock(&readback->mutex);
+
+	return request;
+}
+
+/*
+ */
+Opal_Result upload_readbackInitialize(Upload_Readback *readback, Opal_Device device, const Opal_ReadbackDesc *desc)
+{
+	assert(readback);
+	assert(device);
+	assert(desc);
+
+	memset(readback, 0, sizeof(Upload_Readback));
+
+	Opal_DeviceInfo info = {0};
+	Opal_Result result = opalGetDeviceInfo(device, &info);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	readback->device = device;
+	readback->ring_size = (desc->ring_size > 0) ? desc->ring_size : UPLOAD_READBACK_DEFAULT_RING_SIZE;
+	readback->ring_size = upload_readbackAlignUp(readback->ring_size, UPLOAD_READBACK_OFFSET_ALIGNMENT);
+
+	Opal_BufferDesc buffer_desc = {0};
+	buffer_desc.size = readback->ring_size;
+	buffer_desc.memory_type = OPAL_ALLOCATION_MEMORY_TYPE_READBACK;
+	buffer_desc.usage = OPAL_BUFFER_USAGE_COPY_DST;
+	buffer_desc.hint = OPAL_ALLOCATION_HINT_PREFER_DEDICATED;
+	buffer_desc.initial_state = OPAL_BUFFER_STATE_COPY_DST;
+
+	result = opalCreateBuffer(device, &buffer_desc, &readback->buffer);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	if (info.api != OPAL_API_WEBGPU)
+	{
+		result = opalMapBuffer(device, readback->buffer, (void **)&readback->ring_data);
+		if (result != OPAL_SUCCESS)
+		{
+			opalDestroyBuffer(device, readback->buffer);
+			return result;
+		}
+	}
+
+	readback->request_capacity = UPLOAD_READBACK_DEFAULT_REQUESTS;
+	readback->requests = (Upload_ReadbackRequest *)malloc(sizeof(Upload_ReadbackRequest) * readback->request_capacity);
+	assert(readback->requests);
+
+	opal_mutexInitialize(&readback->mutex);
+	opal_conditionInitialize(&readback->condition);
+
+	// note: without threads (i.e. on the web) callbacks of completed readbacks run inline from opalPollReadbacks
+	if (readback->ring_data != NULL)
+		readback->has_thread = (opal_threadCreate(&readback->thread, upload_readbackThreadFunction, readback) == OPAL_SUCCESS);
+
+	return OPAL_SUCCESS;
+}
+
+Opal_Result upload_readbackShutdown(Upload_Readback *readback)
+{
+	assert(readback);
+
+	Opal_Device device = readback->device;
+
+	// note: wait for everything that was submitted, so no callback is lost
+	opal_mutexLock(&readback->mutex);
+	uint32_t request_completed = readback->request_completed;
+	opal_mutexUnlock(&readback->mutex);
+
+	uint32_t all_reached = 1;
+	for (uint32_t i = request_completed; i != readback->request_submitted; ++i)
+	{
+		const Upload_ReadbackRequest *request = upload_readbackGetRequest(readback, i);
+		if (opalWaitSemaphore(device, request->semaphore, request->value, UINT64_MAX) != OPAL_SUCCESS)
+			all_reached = 0;
+	}
+
+	// note: semaphore callbacks of reached values may still be running on the notifier thread,
+	//       they must not outlive the readback
+	opal_mutexLock(&readback->mutex);
+	while (all_reached && readback->pending_flushes > 0)
+		opal_conditionWait(&readback->condition, &readback->mutex);
+
+	readback->request_completed = readback->request_submitted;
+	readback->shutdown = 1;
+	opal_conditionBroadcast(&readback->condition);
+	opal_mutexUnlock(&readback->mutex);
+
+	if (readback->has_thread)
+		opal_threadJoin(&readback->thread);
+	else
+		upload_readbackInvokeInline(readback);
+
+	opal_conditionShutdown(&readback->condition);
+	opal_mutexShutdown(&readback->mutex);
+
+	free(readback->requests);
+
+	if (readback->ring_data != NULL)
+		opalUnmapBuffer(device, readback->buffer);
+
+	opalDestroyBuffer(device, readback->buffer);
+
+	memset(readback, 0, sizeof(Upload_Readback));
+	return OPAL_SUCCESS;
+}
+
+/*
+ */
+Opal_Result upload_opalCreateReadback(Opal_Device device, const Opal_ReadbackDesc *desc, Opal_Readback *readback)
+{
+	assert(device);
+	assert(desc);
+	assert(readback);
+
+	Upload_Readback *ptr = (Upload_Readback *)malloc(sizeof(Upload_Readback));
+	assert(ptr);
+
+	Opal_Result result = upload_readbackInitialize(ptr, device, desc);
+	if (result != OPAL_SUCCESS)
+	{
+		free(ptr);
+		return result;
+	}
+
+	*readback = (Opal_Readback)ptr;
+	return OPAL_SUCCESS;
+}
+
+Opal_Result upload_opalReadbackAsync(Opal_Readback readback, Opal_CommandBuffer command_buffer, Opal_Buffer buffer, uint64_t offset, uint64_t size, PFN_opalReadbackCallback callback, void *user_data)
+{
+	assert(readback);
+	assert(command_buffer);
+	assert(buffer);
+	assert(size > 0);
+
+	Upload_Readback *ptr = (Upload_Readback *)readback;
+	uint64_t ring_head = ptr->ring_head;
+
+	uint64_t ring_offset = 0;
+	Opal_Result result = upload_readbackAllocate(ptr, size, UPLOAD_READBACK_BUFFER_ALIGNMENT, &ring_offset);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	result = upload_readbackRecordBufferCopy(ptr, command_buffer, buffer, offset, ring_offset, size);
+	if (result != OPAL_SUCCESS)
+	{
+		ptr->ring_head = ring_head;
+		return result;
+	}
+
+	Upload_ReadbackRequest *request = upload_readbackAddRequest(ptr);
+	request->callback = callback;
+	request->user_data = user_data;
+	request->offset = ring_offset;
+	request->ring_end = ptr->ring_head;
+	request->row_size = (uint32_t)size;
+	request->row_pitch = (uint32_t)size;
+	request->num_rows = 1;
+
+	ptr->request_last++;
+	return OPAL_SUCCESS;
+}
+
+Opal_Result upload_opalReadbackTextureAsync(Opal_Readback readback, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_Extent3D size, uint32_t row_size, uint32_t num_rows, PFN_opalReadbackCallback callback, void *user_data)
+{
+	assert(readback);
+	assert(command_buffer);
+	assert(src.texture_view);
+	assert(row_size > 0);
+	assert(num_rows > 0);
+
+	Upload_Readback *ptr = (Upload_Readback *)readback;
+	uint64_t ring_head = ptr->ring_head;
+
+	uint32_t depth = (size.depth > 0) ? size.depth : 1;
+	uint32_t row_pitch = (uint32_t)upload_readbackAlignUp(row_size, UPLOAD_READBACK_ROW_ALIGNMENT);
+
+	uint64_t ring_offset = 0;
+	Opal_Result result = upload_readbackAllocate(ptr, (uint64_t)row_pitch * num_rows * depth, UPLOAD_READBACK_OFFSET_ALIGNMENT, &ring_offset);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	Opal_BufferTextureRegion dst = {0};
+	dst.buffer = ptr->buffer;
+	dst.offset = ring_offset;
+	dst.row_size = row_pitch;
+	dst.num_rows = num_rows;
+
+	result = upload_readbackRecordTextureCopy(ptr, command_buffer, src, dst, size);
+	if (result != OPAL_SUCCESS)
+	{
+		ptr->ring_head = ring_head;
+		return result;
+	}
+
+	Upload_ReadbackRequest *request = upload_readbackAddRequest(ptr);
+	request->callback = callback;
+	request->user_data = user_data;
+	request->offset = ring_offset;
+	request->ring_end = ptr->ring_head;
+	request->row_size = row_size;
+	request->row_pitch = row_pitch;
+	request->num_rows = num_rows * depth;
+
+	ptr->request_last++;
+	return OPAL_SUCCESS;
+}
+
+Opal_Result upload_opalFlushReadbacks(Opal_Readback readback, Opal_Semaphore semaphore, uint64_t value)
+{
+	assert(readback);
+	assert(semaphore);
+
+	Upload_Readback *ptr = (Upload_Readback *)readback;
+
+	opal_mutexLock(&ptr->mutex);
+
+	if (ptr->request_submitted == ptr->request_last)
+	{
+		opal_mutexUnlock(&ptr->mutex);
+		return OPAL_SUCCESS;
+	}
+
+	for (uint32_t i = ptr->request_submitted; i != ptr->request_last; ++i)
+	{
+		Upload_ReadbackRequest *request = upload_readbackGetRequest(ptr, i);
+		request->semaphore = semaphore;
+		request->value = value;
+	}
+
+	ptr->request_submitted = ptr->request_last;
+	ptr->pending_flushes++;
+
+	opal_mutexUnlock(&ptr->mutex);
+
+	// note: may run the callback right away if the value is already reached, so the mutex is not held here
+	Opal_Result result = opalRegisterSemaphoreCallback(ptr->device, semaphore, value, upload_readbackSemaphoreCallback, ptr);
+	if (result != OPAL_SUCCESS)
+	{
+		opal_mutexLock(&ptr->mutex);
+		ptr->pending_flushes--;
+		opal_mutexUnlock(&ptr->mutex);
+	}
+
+	return result;
+}
+
+Opal_Result upload_opalPollReadbacks(Opal_Readback readback)
+{
+	assert(readback);
+
+	Upload_Readback *ptr = (Upload_Readback *)readback;
+
+	// note: completion is driven by semaphore callbacks, polling is only needed where there is no completion thread
+	if (ptr->has_thread)
+		return OPAL_SUCCESS;
+
+	return upload_readbackInvokeInline(ptr);
+}
+
+Opal_Result upload_opalDestroyReadback(Opal_Readback readback)
+{
+	assert(readback);
+
+	Upload_Readback *ptr = (Upload_Readback *)readback;
+
+	upload_readbackShutdown(ptr);
+	free(ptr);
+
+	return OPAL_SUCCESS;
+}
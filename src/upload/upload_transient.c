@@ -0,0 +1,239 @@
+#include "upload_internal.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define UPLOAD_TRANSIENT_DEFAULT_FRAME_SIZE 0x400000
+#define UPLOAD_TRANSIENT_DEFAULT_FRAMES 3
+#define UPLOAD_TRANSIENT_FRAME_ALIGNMENT 256
+
+/*
+ */
+static OPAL_INLINE uint64_t upload_transientAlignUp(uint64_t value, uint64_t alignment)
+{
+	assert(alignment > 0);
+	return (value + alignment - 1) / alignment * alignment;
+}
+
+/*
+ */
+static Opal_Result upload_transientWaitFrame(Upload_TransientAllocator *allocator)
+{
+	assert(allocator);
+
+	if (allocator->frame_ready)
+		return OPAL_SUCCESS;
+
+	Upload_TransientFrame *frame = &allocator->frames[allocator->current_frame];
+	if (frame->semaphore != OPAL_NULL_HANDLE)
+	{
+		Opal_Result result = opalWaitSemaphore(allocator->device, frame->semaphore, frame->value, UINT64_MAX);
+		if (result != OPAL_SUCCESS)
+			return result;
+	}
+
+	frame->semaphore = OPAL_NULL_HANDLE;
+	frame->value = 0;
+
+	allocator->offset = 0;
+	allocator->frame_ready = 1;
+
+	return OPAL_SUCCESS;
+}
+
+/*
+ */
+Opal_Result upload_transientInitialize(Upload_TransientAllocator *allocator, Opal_Device device, const Opal_TransientAllocatorDesc *desc)
+{
+	assert(allocator);
+	assert(device);
+	assert(desc);
+
+	memset(allocator, 0, sizeof(Upload_TransientAllocator));
+
+	Opal_DeviceInfo info = {0};
+	Opal_Result result = opalGetDeviceInfo(device, &info);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	uint64_t frame_size = (desc->frame_size > 0) ? desc->frame_size : UPLOAD_TRANSIENT_DEFAULT_FRAME_SIZE;
+	uint32_t num_frames = (desc->num_frames > 0) ? desc->num_frames : UPLOAD_TRANSIENT_DEFAULT_FRAMES;
+
+	Opal_BufferUsageFlags usage = desc->usage;
+	if (usage == 0)
+		usage = OPAL_BUFFER_USAGE_UNIFORM | OPAL_BUFFER_USAGE_VERTEX | OPAL_BUFFER_USAGE_INDEX;
+
+	allocator->min_alignment = 4;
+	if ((usage & OPAL_BUFFER_USAGE_UNIFORM) && info.limits.min_uniform_buffer_offset_alignment > allocator->min_alignment)
+		allocator->min_alignment = info.limits.min_uniform_buffer_offset_alignment;
+
+	if ((usage & OPAL_BUFFER_USAGE_UNORDERED_ACCESS) && info.limits.min_storage_buffer_offset_alignment > allocator->min_alignment)
+		allocator->min_alignment = info.limits.min_storage_buffer_offset_alignment;
+
+	allocator->device = device;
+	allocator->frame_size = upload_transientAlignUp(frame_size, UPLOAD_TRANSIENT_FRAME_ALIGNMENT);
+	allocator->num_frames = num_frames;
+
+	// note: dynamic descriptor offsets are 32-bit
+	if (allocator->frame_size * num_frames > UINT32_MAX)
+		return OPAL_NO_MEMORY;
+
+	Opal_BufferDesc buffer_desc = {0};
+	buffer_desc.size = allocator->frame_size * num_frames;
+	buffer_desc.memory_type = OPAL_ALLOCATION_MEMORY_TYPE_STREAM;
+	buffer_desc.usage = usage;
+	buffer_desc.hint = OPAL_ALLOCATION_HINT_PREFER_DEDICATED;
+
+	result = opalCreateBuffer(device, &buffer_desc, &allocator->buffer);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	// note: WebGPU can't map uniform / vertex / index buffers, allocations are written to a shadow copy
+	//       and uploaded with a single queue write when the frame ends
+	if (info.api == OPAL_API_WEBGPU)
+	{
+		allocator->shadow_data = (uint8_t *)malloc((size_t)allocator->frame_size);
+		assert(allocator->shadow_data);
+	}
+	else
+	{
+		result = opalMapBuffer(device, allocator->buffer, (void **)&allocator->data);
+		if (result != OPAL_SUCCESS)
+		{
+			upload_transientShutdown(allocator);
+			return result;
+		}
+	}
+
+	allocator->frames = (Upload_TransientFrame *)calloc(num_frames, sizeof(Upload_TransientFrame));
+	assert(allocator->frames);
+
+	return OPAL_SUCCESS;
+}
+
+Opal_Result upload_transientShutdown(Upload_TransientAllocator *allocator)
+{
+	assert(allocator);
+
+	Opal_Device device = allocator->device;
+
+	for (uint32_t i = 0; allocator->frames && i < allocator->num_frames; ++i)
+	{
+		const Upload_TransientFrame *frame = &allocator->frames[i];
+		if (frame->semaphore != OPAL_NULL_HANDLE)
+			opalWaitSemaphore(device, frame->semaphore, frame->value, UINT64_MAX);
+	}
+
+	free(allocator->frames);
+	free(allocator->shadow_data);
+
+	if (allocator->data != NULL)
+		opalUnmapBuffer(device, allocator->buffer);
+
+	if (allocator->buffer != OPAL_NULL_HANDLE)
+		opalDestroyBuffer(device, allocator->buffer);
+
+	memset(allocator, 0, sizeof(Upload_TransientAllocator));
+	return OPAL_SUCCESS;
+}
+
+/*
+ */
+Opal_Result upload_opalCreateTransientAllocator(Opal_Device device, const Opal_TransientAllocatorDesc *desc, Opal_TransientAllocator *allocator)
+{
+	assert(device);
+	assert(desc);
+	assert(allocator);
+
+	Upload_TransientAllocator *ptr = (Upload_TransientAllocator *)malloc(sizeof(Upload_TransientAllocator));
+	assert(ptr);
+
+	Opal_Result result = upload_transientInitialize(ptr, device, desc);
+	if (result != OPAL_SUCCESS)
+	{
+		free(ptr);
+		return result;
+	}
+
+	*allocator = (Opal_TransientAllocator)ptr;
+	return OPAL_SUCCESS;
+}
+
+Opal_Result upload_opalGetTransientBuffer(Opal_TransientAllocator allocator, Opal_Buffer *buffer)
+{
+	assert(allocator);
+	assert(buffer);
+
+	const Upload_TransientAllocator *ptr = (const Upload_TransientAllocator *)allocator;
+
+	*buffer = ptr->buffer;
+	return OPAL_SUCCESS;
+}
+
+Opal_Result upload_opalAllocateTransient(Opal_TransientAllocator allocator, uint64_t size, uint64_t alignment, Opal_TransientAllocation *allocation)
+{
+	assert(allocator);
+	assert(allocation);
+
+	Upload_TransientAllocator *ptr = (Upload_TransientAllocator *)allocator;
+
+	Opal_Result result = upload_transientWaitFrame(ptr);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	if (alignment < ptr->min_alignment)
+		alignment = ptr->min_alignment;
+
+	uint64_t offset = upload_transientAlignUp(ptr->offset, alignment);
+	if (offset + size > ptr->frame_size)
+		return OPAL_NO_MEMORY;
+
+	ptr->offset = offset + size;
+
+	uint64_t frame_offset = ptr->frame_size * ptr->current_frame;
+
+	allocation->buffer = ptr->buffer;
+	allocation->offset = frame_offset + offset;
+	allocation->ptr = (ptr->data != NULL) ? ptr->data + frame_offset + offset : ptr->shadow_data + offset;
+
+	return OPAL_SUCCESS;
+}
+
+Opal_Result upload_opalEndTransientFrame(Opal_TransientAllocator allocator, Opal_Semaphore semaphore, uint64_t value)
+{
+	assert(allocator);
+	assert(semaphore);
+
+	Upload_TransientAllocator *ptr = (Upload_TransientAllocator *)allocator;
+
+	if (ptr->shadow_data != NULL && ptr->offset > 0)
+	{
+		uint64_t frame_offset = ptr->frame_size * ptr->current_frame;
+
+		Opal_Result result = opalWriteBuffer(ptr->device, ptr->buffer, frame_offset, ptr->shadow_data, ptr->offset);
+		if (result != OPAL_SUCCESS)
+			return result;
+	}
+
+	Upload_TransientFrame *frame = &ptr->frames[ptr->current_frame];
+	frame->semaphore = semaphore;
+	frame->value = value;
+
+	ptr->current_frame = (ptr->current_frame + 1) % ptr->num_frames;
+	ptr->frame_ready = 0;
+
+	return OPAL_SUCCESS;
+}
+
+Opal_Result upload_opalDestroyTransientAllocator(Opal_TransientAllocator allocator)
+{
+	assert(allocator);
+
+	Upload_TransientAllocator *ptr = (Upload_TransientAllocator *)allocator;
+
+	upload_transientShutdown(ptr);
+	free(ptr);
+
+	return OPAL_SUCCESS;
+}
@@ -1,10 +1,13 @@
 #include "vulkan_internal.h"
 #include "common/intrinsics.h"
+#include "common/timer.h"
 
 #include <assert.h>
 #include <string.h>
 #include <stdlib.h>
 
+#define VULKAN_COMPACTED_SIZE_QUERIES_PER_POOL 256
+
 /*
  */
 static uint32_t vulkan_memory_required_flags[] =
@@ -33,11 +36,12 @@ static uint32_t vulkan_memory_not_preferred_flags[] =
 
 /*
  */
-static Opal_Result vulkan_deviceDestroyTextureView(Opal_Device this, Opal_TextureView texture_view);
-static Opal_Result vulkan_deviceMapBuffer(Opal_Device this, Opal_Buffer buffer, void **ptr);
-static Opal_Result vulkan_deviceUnmapBuffer(Opal_Device this, Opal_Buffer buffer);
-static Opal_Result vulkan_deviceFreeDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set);
-static Opal_Result vulkan_deviceUpdateDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set, uint32_t num_entries, const Opal_DescriptorSetEntry *entries);
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceDestroyTextureView(Opal_Device this, Opal_TextureView texture_view);
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceMapBuffer(Opal_Device this, Opal_Buffer buffer, void **ptr);
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceUnmapBuffer(Opal_Device this, Opal_Buffer buffer);
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceFreeDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set);
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceUpdateDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set, uint32_t num_entries, const Opal_DescriptorSetEntry *entries);
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdAccelerationStructureBuildBatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_descs, const Opal_AccelerationStructureBuildDesc *descs);
 
 /*
  */
@@ -451,6 +455,210 @@ static void vulkan_cmdSetDescriptorSet(Vulkan_Device *device_ptr, Vulkan_Command
 
 /*
  */
+static void vulkan_fillAccelerationStructureBuild(Vulkan_Device *device_ptr, const Opal_AccelerationStructureBuildDesc *desc, VkAccelerationStructureBuildGeometryInfoKHR *build_info, VkAccelerationStructureGeometryKHR *entries, VkAccelerationStructureBuildRangeInfoKHR *build_ranges)
+{
+	assert(device_ptr);
+	assert(desc);
+	assert(build_info);
+	assert(entries);
+	assert(build_ranges);
+
+	const Vulkan_AccelerationStructure *dst_acceleration_structure_ptr = opal_poolGetElement(&device_ptr->acceleration_structures, (Opal_PoolHandle)desc->dst_acceleration_structure);
+	assert(dst_acceleration_structure_ptr);
+
+	const Vulkan_Buffer *scratch_buffer_ptr = opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)desc->scratch_buffer.buffer);
+	assert(scratch_buffer_ptr);
+
+	build_info->sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR;
+	build_info->type = vulkan_helperToAccelerationStructureType(desc->type);
+	build_info->flags = vulkan_helperToAccelerationStructureBuildFlags(desc->build_flags);
+	build_info->mode = vulkan_helperToAccelerationStructureBuildMode(desc->build_mode);
+	build_info->dstAccelerationStructure = dst_acceleration_structure_ptr->acceleration_structure;
+
+	if (desc->src_acceleration_structure)
+	{
+		const Vulkan_AccelerationStructure *src_acceleration_structure_ptr = opal_poolGetElement(&device_ptr->acceleration_structures, (Opal_PoolHandle)desc->src_acceleration_structure);
+		assert(src_acceleration_structure_ptr);
+
+		build_info->srcAccelerationStructure = src_acceleration_structure_ptr->acceleration_structure;
+	}
+
+	build_info->pGeometries = entries;
+	build_info->geometryCount = 1;
+	if (desc->type == OPAL_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL)
+		build_info->geometryCount = desc->input.bottom_level.num_geometries;
+
+	build_info->scratchData.deviceAddress = scratch_buffer_ptr->device_address + desc->scratch_buffer.offset;
+
+	if (desc->type == OPAL_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL)
+	{
+		for (uint32_t j = 0; j < build_info->geometryCount; ++j)
+		{
+			const Opal_AccelerationStructureGeometry *opal_geometry = &desc->input.bottom_level.geometries[j];
+			VkAccelerationStructureGeometryKHR *geometry = &entries[j];
+			VkAccelerationStructureBuildRangeInfoKHR *build_range = &build_ranges[j];
+
+			geometry->sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_KHR;
+			geometry->geometryType = vulkan_helperToAccelerationStructureGeometryType(opal_geometry->type);
+			geometry->flags = vulkan_helperToAccelerationStructureGeometryFlags(opal_geometry->flags);
+
+			if (opal_geometry->type == OPAL_ACCELERATION_STRUCTURE_GEOMETRY_TYPE_TRIANGLES)
+			{
+				const Opal_AccelerationStructureGeometryDataTriangles *opal_triangles = &opal_geometry->data.triangles;
+				VkAccelerationStructureGeometryTrianglesDataKHR *triangles = &geometry->geometry.triangles;
+
+				const Vulkan_Buffer *vertex_buffer_ptr = opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)opal_triangles->vertex_buffer.buffer);
+				assert(vertex_buffer_ptr);
+
+				triangles->sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_TRIANGLES_DATA_KHR;
+				triangles->vertexFormat = vulkan_helperToVertexFormat(opal_triangles->vertex_format);
+				triangles->vertexData.deviceAddress = vertex_buffer_ptr->device_address + opal_triangles->vertex_buffer.offset;
+				triangles->vertexStride = opal_triangles->vertex_stride;
+				triangles->maxVertex = opal_triangles->num_vertices - 1;
+				triangles->indexType = vulkan_helperToIndexType(opal_triangles->index_format);
+
+				build_range->primitiveCount = opal_triangles->num_vertices / 3;
+
+				if (opal_triangles->index_buffer.buffer != OPAL_NULL_HANDLE)
+				{
+					const Vulkan_Buffer *index_buffer_ptr = opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)opal_triangles->index_buffer.buffer);
+					assert(index_buffer_ptr);
+
+					triangles->indexData.deviceAddress = index_buffer_ptr->device_address + opal_triangles->index_buffer.offset;
+
+					build_range->primitiveCount = opal_triangles->num_indices / 3;
+				}
+			}
+			else if (opal_geometry->type == OPAL_ACCELERATION_STRUCTURE_GEOMETRY_TYPE_AABBS)
+			{
+				const Opal_AccelerationStructureGeometryDataAABBs *opal_aabbs = &opal_geometry->data.aabbs;
+				VkAccelerationStructureGeometryAabbsDataKHR *aabbs = &geometry->geometry.aabbs;
+
+				Vulkan_Buffer *entries_buffer_ptr = opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)opal_aabbs->entries_buffer.buffer);
+				assert(entries_buffer_ptr);
+
+				aabbs->sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_AABBS_DATA_KHR;
+				aabbs->stride = opal_aabbs->stride;
+				aabbs->data.deviceAddress = entries_buffer_ptr->device_address + opal_aabbs->entries_buffer.offset;
+
+				build_range->primitiveCount = opal_aabbs->num_entries;
+			}
+			else
+				assert(0);
+		}
+	}
+	else if (desc->type == OPAL_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL)
+	{
+		VkAccelerationStructureGeometryKHR *geometry = &entries[0];
+		VkAccelerationStructureBuildRangeInfoKHR *build_range = &build_ranges[0];
+		const Opal_AccelerationStructureBuildInputTopLevel *input = &desc->input.top_level;
+
+		Vulkan_Buffer *instances_buffer_ptr = opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)input->instance_buffer.buffer);
+		assert(instances_buffer_ptr);
+
+		geometry->sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_KHR;
+		geometry->geometryType = VK_GEOMETRY_TYPE_INSTANCES_KHR;
+
+		VkAccelerationStructureGeometryInstancesDataKHR *instances = &geometry->geometry.instances;
+		instances->sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_INSTANCES_DATA_KHR;
+		instances->arrayOfPointers = VK_FALSE;
+		instances->data.deviceAddress = instances_buffer_ptr->device_address + input->instance_buffer.offset;
+
+		build_range->primitiveCount = input->num_instances;
+	}
+	else
+		assert(0);
+}
+
+static uint64_t vulkan_resolveInstanceAddress(void *device, Opal_AccelerationStructure blas)
+{
+	assert(device);
+
+	Vulkan_Device *device_ptr = (Vulkan_Device *)device;
+
+	Vulkan_AccelerationStructure *blas_ptr = (Vulkan_AccelerationStructure *)opal_poolGetElement(&device_ptr->acceleration_structures, (Opal_PoolHandle)blas);
+	assert(blas_ptr);
+
+	return blas_ptr->device_address;
+}
+
+static void vulkan_fillBufferImageCopies(const Vulkan_Image *image_ptr, uint32_t num_regions, const Opal_BufferTextureCopyRegion *regions, VkBufferImageCopy *copy_regions)
+{
+	assert(image_ptr);
+	assert(regions);
+	assert(copy_regions);
+
+	// note: Opal rows are in bytes and blocks, Vulkan wants texels, zero means tightly packed for both
+	Opal_FormatBlockInfo block = opal_formatGetBlockInfo(image_ptr->format);
+
+	VkImageAspectFlags aspect_mask = image_ptr->aspect_mask;
+	if (aspect_mask & VK_IMAGE_ASPECT_DEPTH_BIT)
+		aspect_mask = VK_IMAGE_ASPECT_DEPTH_BIT;
+
+	for (uint32_t i = 0; i < num_regions; ++i)
+	{
+		const Opal_BufferTextureCopyRegion *region = &regions[i];
+		assert(region->layer_count > 0);
+
+		VkBufferImageCopy *copy_region = &copy_regions[i];
+		memset(copy_region, 0, sizeof(VkBufferImageCopy));
+
+		copy_region->bufferOffset = region->buffer_offset;
+		copy_region->bufferRowLength = (block.size > 0) ? region->row_size / block.size * block.width : 0;
+		copy_region->bufferImageHeight = region->num_rows * block.height;
+		copy_region->imageExtent.width = region->size.width;
+		copy_region->imageExtent.height = region->size.height;
+		copy_region->imageExtent.depth = region->size.depth;
+		copy_region->imageOffset.x = region->texture_offset.x;
+		copy_region->imageOffset.y = region->texture_offset.y;
+		copy_region->imageOffset.z = region->texture_offset.z;
+		copy_region->imageSubresource.aspectMask = aspect_mask;
+		copy_region->imageSubresource.mipLevel = region->mip;
+		copy_region->imageSubresource.baseArrayLayer = region->base_layer;
+		copy_region->imageSubresource.layerCount = region->layer_count;
+	}
+}
+
+static VkBool32 vulkan_hasFormatFeatures(Vulkan_Device *device_ptr, Opal_TextureFormat format, VkFormatFeatureFlags features)
+{
+	assert(device_ptr);
+
+	VkFormatProperties format_properties = {0};
+	vkGetPhysicalDeviceFormatProperties(device_ptr->physical_device, vulkan_helperToImageFormat(format), &format_properties);
+
+	return (format_properties.optimalTilingFeatures & features) == features;
+}
+
+static void vulkan_cmdMipBarrier(Vulkan_Device *device_ptr, Vulkan_CommandBuffer *command_buffer_ptr, const Vulkan_ImageView *image_view_ptr, uint32_t mip)
+{
+	assert(device_ptr);
+	assert(command_buffer_ptr);
+	assert(image_view_ptr);
+
+	VkImageMemoryBarrier barrier = {0};
+	barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+	barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+	barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+	barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+	barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+	barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	barrier.image = image_view_ptr->image;
+	barrier.subresourceRange.aspectMask = image_view_ptr->aspect_mask;
+	barrier.subresourceRange.baseMipLevel = mip;
+	barrier.subresourceRange.levelCount = 1;
+	barrier.subresourceRange.baseArrayLayer = image_view_ptr->base_layer;
+	barrier.subresourceRange.layerCount = image_view_ptr->num_layers;
+
+	device_ptr->vk.vkCmdPipelineBarrier(
+		command_buffer_ptr->command_buffer,
+		VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+		0, NULL,
+		0, NULL,
+		1, &barrier
+	);
+}
+
 static void vulkan_destroySemaphore(Vulkan_Device *device_ptr, Vulkan_Semaphore *semaphore_ptr)
 {
 	assert(device_ptr);
@@ -576,6 +784,17 @@ static void vulkan_destroyCommandAllocator(Vulkan_Device *device_ptr, Vulkan_Com
 	device_ptr->vk.vkDestroyCommandPool(device_ptr->device, command_allocator_ptr->pool, NULL);
 }
 
+static void vulkan_destroyCommandBuffer(Vulkan_Device *device_ptr, Vulkan_CommandBuffer *command_buffer_ptr)
+{
+	assert(device_ptr);
+	assert(command_buffer_ptr);
+
+	for (uint32_t i = 0; i < command_buffer_ptr->num_compacted_size_pools; ++i)
+		device_ptr->vk.vkDestroyQueryPool(device_ptr->device, command_buffer_ptr->compacted_size_pools[i], NULL);
+
+	free(command_buffer_ptr->compacted_size_pools);
+}
+
 static void vulkan_destroyShader(Vulkan_Device *device_ptr, Vulkan_Shader *shader_ptr)
 {
 	assert(device_ptr);
@@ -668,7 +887,7 @@ static void vulkan_destroySwapchain(Vulkan_Device *device_ptr, Vulkan_Swapchain
 
 /*
  */
-static Opal_Result vulkan_deviceGetInfo(Opal_Device this, Opal_DeviceInfo *info)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceGetInfo(Opal_Device this, Opal_DeviceInfo *info)
 {
 	assert(this);
 	assert(info);
@@ -677,7 +896,7 @@ static Opal_Result vulkan_deviceGetInfo(Opal_Device this, Opal_DeviceInfo *info)
 	return vulkan_helperFillDeviceInfo(ptr->physical_device, info);
 }
 
-static Opal_Result vulkan_deviceGetQueue(Opal_Device this, Opal_DeviceEngineType engine_type, uint32_t index, Opal_Queue *queue)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceGetQueue(Opal_Device this, Opal_DeviceEngineType engine_type, uint32_t index, Opal_Queue *queue)
 {
 	assert(this);
 	assert(queue);
@@ -696,7 +915,7 @@ static Opal_Result vulkan_deviceGetQueue(Opal_Device this, Opal_DeviceEngineType
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceGetAccelerationStructurePrebuildInfo(Opal_Device this, const Opal_AccelerationStructureBuildDesc *desc, Opal_AccelerationStructurePrebuildInfo *info)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceGetAccelerationStructurePrebuildInfo(Opal_Device this, const Opal_AccelerationStructureBuildDesc *desc, Opal_AccelerationStructurePrebuildInfo *info)
 {
 	assert(this);
 	assert(desc);
@@ -798,7 +1017,22 @@ static Opal_Result vulkan_deviceGetAccelerationStructurePrebuildInfo(Opal_Device
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceGetSupportedSurfaceFormats(Opal_Device this, Opal_Surface surface, uint32_t *num_formats, Opal_SurfaceFormat *formats)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceGetAccelerationStructureAddress(Opal_Device this, Opal_AccelerationStructure acceleration_structure, uint64_t *address)
+{
+	assert(this);
+	assert(acceleration_structure);
+	assert(address);
+
+	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
+
+	Vulkan_AccelerationStructure *acceleration_structure_ptr = (Vulkan_AccelerationStructure *)opal_poolGetElement(&device_ptr->acceleration_structures, (Opal_PoolHandle)acceleration_structure);
+	assert(acceleration_structure_ptr);
+
+	*address = acceleration_structure_ptr->device_address;
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceGetSupportedSurfaceFormats(Opal_Device this, Opal_Surface surface, uint32_t *num_formats, Opal_SurfaceFormat *formats)
 {
 	assert(this);
 	assert(surface);
@@ -887,7 +1121,7 @@ static Opal_Result vulkan_deviceGetSupportedSurfaceFormats(Opal_Device this, Opa
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceGetSupportedPresentModes(Opal_Device this, Opal_Surface surface, uint32_t *num_present_modes, Opal_PresentMode *present_modes)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceGetSupportedPresentModes(Opal_Device this, Opal_Surface surface, uint32_t *num_present_modes, Opal_PresentMode *present_modes)
 {
 	assert(this);
 	assert(surface);
@@ -948,7 +1182,7 @@ static Opal_Result vulkan_deviceGetSupportedPresentModes(Opal_Device this, Opal_
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceGetPreferredSurfaceFormat(Opal_Device this, Opal_Surface surface, Opal_SurfaceFormat *format)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceGetPreferredSurfaceFormat(Opal_Device this, Opal_Surface surface, Opal_SurfaceFormat *format)
 {
 	assert(this);
 	assert(surface);
@@ -985,7 +1219,7 @@ static Opal_Result vulkan_deviceGetPreferredSurfaceFormat(Opal_Device this, Opal
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceGetPreferredSurfacePresentMode(Opal_Device this, Opal_Surface surface, Opal_PresentMode *present_mode)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceGetPreferredSurfacePresentMode(Opal_Device this, Opal_Surface surface, Opal_PresentMode *present_mode)
 {
 	assert(this);
 	assert(surface);
@@ -1022,7 +1256,7 @@ static Opal_Result vulkan_deviceGetPreferredSurfacePresentMode(Opal_Device this,
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCreateSemaphore(Opal_Device this, const Opal_SemaphoreDesc *desc, Opal_Semaphore *semaphore)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCreateSemaphore(Opal_Device this, const Opal_SemaphoreDesc *desc, Opal_Semaphore *semaphore)
 {
 	assert(this);
 	assert(desc);
@@ -1053,7 +1287,7 @@ static Opal_Result vulkan_deviceCreateSemaphore(Opal_Device this, const Opal_Sem
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCreateFence(Opal_Device this, Opal_Fence *fence)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCreateFence(Opal_Device this, Opal_Fence *fence)
 {
 	assert(this);
 	assert(fence);
@@ -1077,7 +1311,7 @@ static Opal_Result vulkan_deviceCreateFence(Opal_Device this, Opal_Fence *fence)
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCreateBuffer(Opal_Device this, const Opal_BufferDesc *desc, Opal_Buffer *buffer)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCreateBuffer(Opal_Device this, const Opal_BufferDesc *desc, Opal_Buffer *buffer)
 {
 	assert(this);
 	assert(desc);
@@ -1141,7 +1375,7 @@ static Opal_Result vulkan_deviceCreateBuffer(Opal_Device this, const Opal_Buffer
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCreateTexture(Opal_Device this, const Opal_TextureDesc *desc, Opal_Texture *texture)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCreateTexture(Opal_Device this, const Opal_TextureDesc *desc, Opal_Texture *texture)
 {
 	assert(this);
 	assert(desc);
@@ -1252,7 +1486,7 @@ static Opal_Result vulkan_deviceCreateTexture(Opal_Device this, const Opal_Textu
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCreateTextureView(Opal_Device this, const Opal_TextureViewDesc *desc, Opal_TextureView *texture_view)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCreateTextureView(Opal_Device this, const Opal_TextureViewDesc *desc, Opal_TextureView *texture_view)
 {
 	assert(this);
 	assert(desc);
@@ -1306,7 +1540,7 @@ static Opal_Result vulkan_deviceCreateTextureView(Opal_Device this, const Opal_T
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCreateSampler(Opal_Device this, const Opal_SamplerDesc *desc, Opal_Sampler *sampler)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCreateSampler(Opal_Device this, const Opal_SamplerDesc *desc, Opal_Sampler *sampler)
 {
 	assert(this);
 	assert(desc);
@@ -1315,6 +1549,13 @@ static Opal_Result vulkan_deviceCreateSampler(Opal_Device this, const Opal_Sampl
 	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
 	VkDevice vulkan_device = device_ptr->device;
 
+	Opal_Sampler cached_sampler = (Opal_Sampler)opal_cacheAcquire(&device_ptr->sampler_cache, desc, sizeof(Opal_SamplerDesc));
+	if (cached_sampler != OPAL_NULL_HANDLE)
+	{
+		*sampler = cached_sampler;
+		return OPAL_SUCCESS;
+	}
+
 	VkSampler vulkan_sampler = VK_NULL_HANDLE;
 
 	VkSamplerCreateInfo sampler_info = {0};
@@ -1340,10 +1581,11 @@ static Opal_Result vulkan_deviceCreateSampler(Opal_Device this, const Opal_Sampl
 	result.sampler = vulkan_sampler;
 
 	*sampler = (Opal_Sampler)opal_poolAddElement(&device_ptr->samplers, &result);
+	opal_cacheInsert(&device_ptr->sampler_cache, desc, sizeof(Opal_SamplerDesc), *sampler);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCreateAccelerationStructure(Opal_Device this, const Opal_AccelerationStructureDesc *desc, Opal_AccelerationStructure *acceleration_structure)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCreateAccelerationStructure(Opal_Device this, const Opal_AccelerationStructureDesc *desc, Opal_AccelerationStructure *acceleration_structure)
 {
 	assert(this);
 	assert(desc);
@@ -1419,7 +1661,7 @@ static Opal_Result vulkan_deviceCreateAccelerationStructure(Opal_Device this, co
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCreateShaderBindingTable(Opal_Device this, Opal_RaytracePipeline pipeline, Opal_ShaderBindingTable *shader_binding_table)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCreateShaderBindingTable(Opal_Device this, Opal_RaytracePipeline pipeline, Opal_ShaderBindingTable *shader_binding_table)
 {
 	assert(this);
 	assert(pipeline);
@@ -1434,7 +1676,7 @@ static Opal_Result vulkan_deviceCreateShaderBindingTable(Opal_Device this, Opal_
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCreateCommandAllocator(Opal_Device this, Opal_Queue queue, Opal_CommandAllocator *command_allocator)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCreateCommandAllocator(Opal_Device this, Opal_Queue queue, Opal_CommandAllocator *command_allocator)
 {
 	assert(this);
 	assert(command_allocator);
@@ -1457,12 +1699,13 @@ static Opal_Result vulkan_deviceCreateCommandAllocator(Opal_Device this, Opal_Qu
 
 	Vulkan_CommandAllocator result = {0};
 	result.pool = vulkan_command_pool;
+	result.engine_type = queue_ptr->engine_type;
 
 	*command_allocator = (Opal_CommandAllocator)opal_poolAddElement(&device_ptr->command_allocators, &result);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCreateCommandBuffer(Opal_Device this, Opal_CommandAllocator command_allcoator, Opal_CommandBuffer *command_buffer)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCreateCommandBuffer(Opal_Device this, Opal_CommandAllocator command_allcoator, Opal_CommandBuffer *command_buffer)
 {
 	assert(this);
 	assert(command_allcoator);
@@ -1488,6 +1731,7 @@ static Opal_Result vulkan_deviceCreateCommandBuffer(Opal_Device this, Opal_Comma
 	Vulkan_CommandBuffer result = {0};
 	result.command_buffer = vulkan_command_buffer;
 	result.command_allocator = command_allcoator;
+	result.engine_type = command_allocator_ptr->engine_type;
 
 	// TODO: add handle to Vulkan_CommandAllocator instance
 
@@ -1495,7 +1739,7 @@ static Opal_Result vulkan_deviceCreateCommandBuffer(Opal_Device this, Opal_Comma
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCreateShader(Opal_Device this, const Opal_ShaderDesc *desc, Opal_Shader *shader)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCreateShader(Opal_Device this, const Opal_ShaderDesc *desc, Opal_Shader *shader)
 {
 	assert(this);
 	assert(desc);
@@ -1505,6 +1749,16 @@ static Opal_Result vulkan_deviceCreateShader(Opal_Device this, const Opal_Shader
 	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
 	VkDevice vulkan_device = device_ptr->device;
 
+	Opal_CacheDigest digest = {0};
+	opal_cacheDigest(&digest, (uint32_t)desc->type, desc->data, desc->size);
+
+	Opal_Shader cached_shader = (Opal_Shader)opal_cacheAcquire(&device_ptr->shader_cache, &digest, sizeof(Opal_CacheDigest));
+	if (cached_shader != OPAL_NULL_HANDLE)
+	{
+		*shader = cached_shader;
+		return OPAL_SUCCESS;
+	}
+
 	VkShaderModule vulkan_shader = VK_NULL_HANDLE;
 
 	VkShaderModuleCreateInfo shader_info = {0};
@@ -1519,11 +1773,14 @@ static Opal_Result vulkan_deviceCreateShader(Opal_Device this, const Opal_Shader
 	Vulkan_Shader result = {0};
 	result.shader = vulkan_shader;
 
+	opal_compilerPause(&device_ptr->compiler);
 	*shader = (Opal_Shader)opal_poolAddElement(&device_ptr->shaders, &result);
+	opal_compilerResume(&device_ptr->compiler);
+	opal_cacheInsert(&device_ptr->shader_cache, &digest, sizeof(Opal_CacheDigest), *shader);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCreateDescriptorHeap(Opal_Device this, const Opal_DescriptorHeapDesc *desc, Opal_DescriptorHeap *descriptor_heap)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCreateDescriptorHeap(Opal_Device this, const Opal_DescriptorHeapDesc *desc, Opal_DescriptorHeap *descriptor_heap)
 {
 	assert(this);
 	assert(desc);
@@ -1664,7 +1921,7 @@ static Opal_Result vulkan_deviceCreateDescriptorHeap(Opal_Device this, const Opa
 	return opal_result;
 }
 
-static Opal_Result vulkan_deviceCreateDescriptorSetLayout(Opal_Device this, uint32_t num_entries, const Opal_DescriptorSetLayoutEntry *entries, Opal_DescriptorSetLayout *descriptor_set_layout)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCreateDescriptorSetLayout(Opal_Device this, uint32_t num_entries, const Opal_DescriptorSetLayoutEntry *entries, Opal_DescriptorSetLayout *descriptor_set_layout)
 {
 	assert(this);
 	assert(num_entries == 0 || entries);
@@ -1673,6 +1930,15 @@ static Opal_Result vulkan_deviceCreateDescriptorSetLayout(Opal_Device this, uint
 	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
 	VkDevice vulkan_device = device_ptr->device;
 
+	uint32_t entries_size = sizeof(Opal_DescriptorSetLayoutEntry) * num_entries;
+
+	Opal_DescriptorSetLayout cached_layout = (Opal_DescriptorSetLayout)opal_cacheAcquire(&device_ptr->descriptor_set_layout_cache, entries, entries_size);
+	if (cached_layout != OPAL_NULL_HANDLE)
+	{
+		*descriptor_set_layout = cached_layout;
+		return OPAL_SUCCESS;
+	}
+
 	VkDescriptorSetLayout vulkan_set_layout = VK_NULL_HANDLE;
 
 	VkDescriptorSetLayoutCreateInfo set_layout_info = {0};
@@ -1792,11 +2058,14 @@ static Opal_Result vulkan_deviceCreateDescriptorSetLayout(Opal_Device this, uint
 	result.num_static_descriptors = num_static_entries;
 	result.num_dynamic_descriptors = num_dynamic_entries;
 
+	opal_compilerPause(&device_ptr->compiler);
 	*descriptor_set_layout = (Opal_DescriptorSetLayout)opal_poolAddElement(&device_ptr->descriptor_set_layouts, &result);
+	opal_compilerResume(&device_ptr->compiler);
+	opal_cacheInsert(&device_ptr->descriptor_set_layout_cache, entries, entries_size, *descriptor_set_layout);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCreatePipelineLayout(Opal_Device this, uint32_t num_descriptor_set_layouts, const Opal_DescriptorSetLayout *descriptor_set_layouts, Opal_PipelineLayout *pipeline_layout)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCreatePipelineLayout(Opal_Device this, uint32_t num_descriptor_set_layouts, const Opal_DescriptorSetLayout *descriptor_set_layouts, Opal_PipelineLayout *pipeline_layout)
 {
 	assert(this);
 	assert(pipeline_layout);
@@ -1804,6 +2073,15 @@ static Opal_Result vulkan_deviceCreatePipelineLayout(Opal_Device this, uint32_t
 	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
 	VkDevice vulkan_device = device_ptr->device;
 
+	uint32_t layouts_size = sizeof(Opal_DescriptorSetLayout) * num_descriptor_set_layouts;
+
+	Opal_PipelineLayout cached_layout = (Opal_PipelineLayout)opal_cacheAcquire(&device_ptr->pipeline_layout_cache, descriptor_set_layouts, layouts_size);
+	if (cached_layout != OPAL_NULL_HANDLE)
+	{
+		*pipeline_layout = cached_layout;
+		return OPAL_SUCCESS;
+	}
+
 	VkDescriptorSetLayout *set_layouts = NULL;
 
 	uint32_t num_dynamic_descriptors = 0;
@@ -1841,22 +2119,28 @@ static Opal_Result vulkan_deviceCreatePipelineLayout(Opal_Device this, uint32_t
 	result.layout = vulkan_pipeline_layout;
 	result.num_dynamic_descriptors = num_dynamic_descriptors;
 
+	opal_compilerPause(&device_ptr->compiler);
 	*pipeline_layout = (Opal_PipelineLayout)opal_poolAddElement(&device_ptr->pipeline_layouts, &result);
+	opal_compilerResume(&device_ptr->compiler);
+	opal_cacheInsert(&device_ptr->pipeline_layout_cache, descriptor_set_layouts, layouts_size, *pipeline_layout);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCreateGraphicsPipeline(Opal_Device this, const Opal_GraphicsPipelineDesc *desc, Opal_GraphicsPipeline *pipeline)
+static Opal_Result vulkan_compileGraphicsPipeline(void *device, const void *data, Opal_Bump *bump, void *pipeline)
 {
-	assert(this);
-	assert(desc);
+	assert(device);
+	assert(data);
+	assert(bump);
+	assert(pipeline);
+
+	const Opal_GraphicsPipelineDesc *desc = (const Opal_GraphicsPipelineDesc *)data;
 	assert(desc->vertex_function.shader);
 	assert(desc->vertex_function.name);
 	assert(desc->fragment_function.shader);
 	assert(desc->fragment_function.name);
 	assert(desc->pipeline_layout);
-	assert(pipeline);
 
-	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
+	Vulkan_Device *device_ptr = (Vulkan_Device *)device;
 	VkDevice vulkan_device = device_ptr->device;
 
 	// pipeline layout
@@ -1922,12 +2206,12 @@ static Opal_Result vulkan_deviceCreateGraphicsPipeline(Opal_Device this, const O
 	for (uint32_t i = 0; i < desc->num_vertex_streams; ++i)
 		num_vertex_attributes += desc->vertex_streams[i].num_vertex_attributes;
 
-	opal_bumpReset(&device_ptr->bump);
-	uint32_t vertex_streams_offset = opal_bumpAlloc(&device_ptr->bump, sizeof(VkVertexInputBindingDescription) * desc->num_vertex_streams);
-	uint32_t vertex_attributes_offset = opal_bumpAlloc(&device_ptr->bump, sizeof(VkVertexInputAttributeDescription) * num_vertex_attributes);
+	opal_bumpReset(bump);
+	uint32_t vertex_streams_offset = opal_bumpAlloc(bump, sizeof(VkVertexInputBindingDescription) * desc->num_vertex_streams);
+	uint32_t vertex_attributes_offset = opal_bumpAlloc(bump, sizeof(VkVertexInputAttributeDescription) * num_vertex_attributes);
 
-	VkVertexInputBindingDescription *vertex_streams = (VkVertexInputBindingDescription *)(device_ptr->bump.data + vertex_streams_offset);
-	VkVertexInputAttributeDescription *vertex_attributes = (VkVertexInputAttributeDescription *)(device_ptr->bump.data + vertex_attributes_offset);
+	VkVertexInputBindingDescription *vertex_streams = (VkVertexInputBindingDescription *)(bump->data + vertex_streams_offset);
+	VkVertexInputAttributeDescription *vertex_attributes = (VkVertexInputAttributeDescription *)(bump->data + vertex_attributes_offset);
 
 	uint32_t num_attributes = 0;
 	for (uint32_t i = 0; i < desc->num_vertex_streams; ++i)
@@ -2088,11 +2372,28 @@ static Opal_Result vulkan_deviceCreateGraphicsPipeline(Opal_Device this, const O
 	Vulkan_GraphicsPipeline result = {0};
 	result.pipeline = vulkan_pipeline;
 
+	*(Vulkan_GraphicsPipeline *)pipeline = result;
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCreateGraphicsPipeline(Opal_Device this, const Opal_GraphicsPipelineDesc *desc, Opal_GraphicsPipeline *pipeline)
+{
+	assert(this);
+	assert(desc);
+	assert(pipeline);
+
+	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
+	Vulkan_GraphicsPipeline result = {0};
+
+	Opal_Result opal_result = vulkan_compileGraphicsPipeline(device_ptr, desc, &device_ptr->bump, &result);
+	if (opal_result != OPAL_SUCCESS)
+		return opal_result;
+
 	*pipeline = (Opal_GraphicsPipeline)opal_poolAddElement(&device_ptr->graphics_pipelines, &result);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCreateMeshletPipeline(Opal_Device this, const Opal_MeshletPipelineDesc *desc, Opal_GraphicsPipeline *pipeline)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCreateMeshletPipeline(Opal_Device this, const Opal_MeshletPipelineDesc *desc, Opal_GraphicsPipeline *pipeline)
 {
 	assert(this);
 	assert(desc);
@@ -2278,16 +2579,21 @@ static Opal_Result vulkan_deviceCreateMeshletPipeline(Opal_Device this, const Op
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCreateComputePipeline(Opal_Device this, const Opal_ComputePipelineDesc *desc, Opal_ComputePipeline *pipeline)
+static Opal_Result vulkan_compileComputePipeline(void *device, const void *data, Opal_Bump *bump, void *pipeline)
 {
-	assert(this);
-	assert(desc);
+	assert(device);
+	assert(data);
+	assert(bump);
+	assert(pipeline);
+
+	OPAL_UNUSED(bump);
+
+	const Opal_ComputePipelineDesc *desc = (const Opal_ComputePipelineDesc *)data;
 	assert(desc->compute_function.shader);
 	assert(desc->compute_function.name);
 	assert(desc->pipeline_layout);
-	assert(pipeline);
 
-	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
+	Vulkan_Device *device_ptr = (Vulkan_Device *)device;
 	VkDevice vulkan_device = device_ptr->device;
 
 	// pipeline layout
@@ -2324,19 +2630,39 @@ static Opal_Result vulkan_deviceCreateComputePipeline(Opal_Device this, const Op
 	Vulkan_ComputePipeline result = {0};
 	result.pipeline = vulkan_pipeline;
 
-	*pipeline = (Opal_ComputePipeline)opal_poolAddElement(&device_ptr->compute_pipelines, &result);
+	*(Vulkan_ComputePipeline *)pipeline = result;
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCreateRaytracePipeline(Opal_Device this, const Opal_RaytracePipelineDesc *desc, Opal_RaytracePipeline *pipeline)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCreateComputePipeline(Opal_Device this, const Opal_ComputePipelineDesc *desc, Opal_ComputePipeline *pipeline)
 {
-	// TODO: add support for desc->max_ray_payload_size & desc->max_hit_attribute_size
-
 	assert(this);
 	assert(desc);
 	assert(pipeline);
 
 	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
+	Vulkan_ComputePipeline result = {0};
+
+	Opal_Result opal_result = vulkan_compileComputePipeline(device_ptr, desc, &device_ptr->bump, &result);
+	if (opal_result != OPAL_SUCCESS)
+		return opal_result;
+
+	*pipeline = (Opal_ComputePipeline)opal_poolAddElement(&device_ptr->compute_pipelines, &result);
+	return OPAL_SUCCESS;
+}
+
+static Opal_Result vulkan_compileRaytracePipeline(void *device, const void *data, Opal_Bump *bump, void *pipeline)
+{
+	// TODO: add support for desc->max_ray_payload_size & desc->max_hit_attribute_size
+
+	assert(device);
+	assert(data);
+	assert(bump);
+	assert(pipeline);
+
+	const Opal_RaytracePipelineDesc *desc = (const Opal_RaytracePipelineDesc *)data;
+
+	Vulkan_Device *device_ptr = (Vulkan_Device *)device;
 	VkDevice vulkan_device = device_ptr->device;
 
 	// pipeline layout
@@ -2350,14 +2676,14 @@ static Opal_Result vulkan_deviceCreateRaytracePipeline(Opal_Device this, const O
 	uint32_t max_shader_modules = desc->num_raygen_functions + desc->num_miss_functions + desc->num_intersection_functions * 3;
 	uint32_t max_shader_groups = desc->num_raygen_functions + desc->num_miss_functions + desc->num_intersection_functions;
 
-	opal_bumpReset(&device_ptr->bump);
-	uint32_t shader_stages_offset = opal_bumpAlloc(&device_ptr->bump, sizeof(VkPipelineShaderStageCreateInfo) * max_shader_modules);
-	uint32_t shader_groups_offset = opal_bumpAlloc(&device_ptr->bump, sizeof(VkRayTracingShaderGroupCreateInfoKHR) * max_shader_groups);
+	opal_bumpReset(bump);
+	uint32_t shader_stages_offset = opal_bumpAlloc(bump, sizeof(VkPipelineShaderStageCreateInfo) * max_shader_modules);
+	uint32_t shader_groups_offset = opal_bumpAlloc(bump, sizeof(VkRayTracingShaderGroupCreateInfoKHR) * max_shader_groups);
 
-	VkPipelineShaderStageCreateInfo *shader_stages = (VkPipelineShaderStageCreateInfo *)(device_ptr->bump.data + shader_stages_offset);
+	VkPipelineShaderStageCreateInfo *shader_stages = (VkPipelineShaderStageCreateInfo *)(bump->data + shader_stages_offset);
 	memset(shader_stages, 0, sizeof(VkPipelineShaderStageCreateInfo) * max_shader_modules);
 
-	VkRayTracingShaderGroupCreateInfoKHR *shader_groups = (VkRayTracingShaderGroupCreateInfoKHR *)(device_ptr->bump.data + shader_groups_offset);
+	VkRayTracingShaderGroupCreateInfoKHR *shader_groups = (VkRayTracingShaderGroupCreateInfoKHR *)(bump->data + shader_groups_offset);
 	memset(shader_groups, 0, sizeof(VkRayTracingShaderGroupCreateInfoKHR) * max_shader_groups);
 
 	// TODO: add hashmap lookup to gather unique shader stages, now let's create shader stages with duplicates
@@ -2516,45 +2842,128 @@ static Opal_Result vulkan_deviceCreateRaytracePipeline(Opal_Device this, const O
 	result.num_intersection_handles = num_intersection_handles;
 	result.shader_handles = shader_handles;
 
-	*pipeline = (Opal_RaytracePipeline)opal_poolAddElement(&device_ptr->raytrace_pipelines, &result);
+	*(Vulkan_RaytracePipeline *)pipeline = result;
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCreateSwapchain(Opal_Device this, const Opal_SwapchainDesc *desc, Opal_Swapchain *swapchain)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCreateRaytracePipeline(Opal_Device this, const Opal_RaytracePipelineDesc *desc, Opal_RaytracePipeline *pipeline)
 {
 	assert(this);
 	assert(desc);
-	assert(desc->surface);
-	assert(swapchain);
+	assert(pipeline);
 
 	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
-	Vulkan_Instance *instance_ptr = device_ptr->instance;
-	VkPhysicalDevice vulkan_physical_device = device_ptr->physical_device;
-	VkDevice vulkan_device = device_ptr->device;
-
-	// surface
-	Vulkan_Surface *surface_ptr = (Vulkan_Surface *)opal_poolGetElement(&instance_ptr->surfaces, (Opal_PoolHandle)desc->surface);
-	assert(surface_ptr);
+	Vulkan_RaytracePipeline result = {0};
 
-	VkSurfaceKHR vulkan_surface = surface_ptr->surface;
-	VkSwapchainKHR vulkan_swapchain = VK_NULL_HANDLE;
+	Opal_Result opal_result = vulkan_compileRaytracePipeline(device_ptr, desc, &device_ptr->bump, &result);
+	if (opal_result != OPAL_SUCCESS)
+		return opal_result;
 
-	// surface capabilities
-	VkSurfaceCapabilitiesKHR surface_capabilities = {0};
-	VkResult vulkan_result = vkGetPhysicalDeviceSurfaceCapabilitiesKHR(vulkan_physical_device, vulkan_surface, &surface_capabilities);
-	if (vulkan_result != VK_SUCCESS)
-		return OPAL_VULKAN_ERROR;
+	*pipeline = (Opal_RaytracePipeline)opal_poolAddElement(&device_ptr->raytrace_pipelines, &result);
+	return OPAL_SUCCESS;
+}
 
-	uint32_t num_images = surface_capabilities.minImageCount + 1;
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCreateGraphicsPipelines(Opal_Device this, uint32_t num_pipelines, const Opal_GraphicsPipelineDesc *descs, Opal_GraphicsPipeline *pipelines)
+{
+	assert(this);
 
-	if (surface_capabilities.maxImageCount > 0)
-		num_images = min(num_images, surface_capabilities.maxImageCount);
+	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
+	return opal_compilerRun(&device_ptr->compiler, vulkan_compileGraphicsPipeline, &device_ptr->graphics_pipelines, num_pipelines, descs, sizeof(Opal_GraphicsPipelineDesc), pipelines);
+}
 
-	VkExtent2D extent = surface_capabilities.currentExtent;
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCreateComputePipelines(Opal_Device this, uint32_t num_pipelines, const Opal_ComputePipelineDesc *descs, Opal_ComputePipeline *pipelines)
+{
+	assert(this);
+
+	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
+	return opal_compilerRun(&device_ptr->compiler, vulkan_compileComputePipeline, &device_ptr->compute_pipelines, num_pipelines, descs, sizeof(Opal_ComputePipelineDesc), pipelines);
+}
+
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCreateRaytracePipelines(Opal_Device this, uint32_t num_pipelines, const Opal_RaytracePipelineDesc *descs, Opal_RaytracePipeline *pipelines)
+{
+	assert(this);
+
+	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
+	return opal_compilerRun(&device_ptr->compiler, vulkan_compileRaytracePipeline, &device_ptr->raytrace_pipelines, num_pipelines, descs, sizeof(Opal_RaytracePipelineDesc), pipelines);
+}
+
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCreateGraphicsPipelinesAsync(Opal_Device this, uint32_t num_pipelines, const Opal_GraphicsPipelineDesc *descs, Opal_GraphicsPipeline *pipelines, Opal_PipelineTask *task)
+{
+	assert(this);
+	assert(task);
+
+	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
+	return opal_compilerSubmit(&device_ptr->compiler, vulkan_compileGraphicsPipeline, &device_ptr->graphics_pipelines, num_pipelines, descs, sizeof(Opal_GraphicsPipelineDesc), pipelines, task);
+}
+
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCreateComputePipelinesAsync(Opal_Device this, uint32_t num_pipelines, const Opal_ComputePipelineDesc *descs, Opal_ComputePipeline *pipelines, Opal_PipelineTask *task)
+{
+	assert(this);
+	assert(task);
+
+	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
+	return opal_compilerSubmit(&device_ptr->compiler, vulkan_compileComputePipeline, &device_ptr->compute_pipelines, num_pipelines, descs, sizeof(Opal_ComputePipelineDesc), pipelines, task);
+}
+
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCreateRaytracePipelinesAsync(Opal_Device this, uint32_t num_pipelines, const Opal_RaytracePipelineDesc *descs, Opal_RaytracePipeline *pipelines, Opal_PipelineTask *task)
+{
+	assert(this);
+	assert(task);
+
+	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
+	return opal_compilerSubmit(&device_ptr->compiler, vulkan_compileRaytracePipeline, &device_ptr->raytrace_pipelines, num_pipelines, descs, sizeof(Opal_RaytracePipelineDesc), pipelines, task);
+}
+
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCreateSwapchain(Opal_Device this, const Opal_SwapchainDesc *desc, Opal_Swapchain *swapchain)
+{
+	assert(this);
+	assert(desc);
+	assert(desc->surface);
+	assert(swapchain);
+
+	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
+	Vulkan_Instance *instance_ptr = device_ptr->instance;
+	VkPhysicalDevice vulkan_physical_device = device_ptr->physical_device;
+	VkDevice vulkan_device = device_ptr->device;
+
+	// surface
+	Vulkan_Surface *surface_ptr = (Vulkan_Surface *)opal_poolGetElement(&instance_ptr->surfaces, (Opal_PoolHandle)desc->surface);
+	assert(surface_ptr);
+
+	VkSurfaceKHR vulkan_surface = surface_ptr->surface;
+	VkSwapchainKHR vulkan_swapchain = VK_NULL_HANDLE;
+
+	// surface capabilities
+	VkSurfaceCapabilitiesKHR surface_capabilities = {0};
+	VkResult vulkan_result = vkGetPhysicalDeviceSurfaceCapabilitiesKHR(vulkan_physical_device, vulkan_surface, &surface_capabilities);
+	if (vulkan_result != VK_SUCCESS)
+		return OPAL_VULKAN_ERROR;
+
+	uint32_t num_images = surface_capabilities.minImageCount + 1;
+
+	// note: without present wait the only way to bound latency is the number of images
+	//       the presentation engine can queue up
+	if (desc->max_frames_in_flight > 0 && device_ptr->present_wait == VK_FALSE)
+		num_images = max(surface_capabilities.minImageCount, desc->max_frames_in_flight + 1);
+
+	if (surface_capabilities.maxImageCount > 0)
+		num_images = min(num_images, surface_capabilities.maxImageCount);
+
+	VkExtent2D extent = surface_capabilities.currentExtent;
 
 	if (extent.width == 0xFFFFFFFF || extent.height == 0xFFFFFFFF)
+	{
 		extent = surface_capabilities.minImageExtent;
 
+		if (surface_ptr->extent.width > 0 && surface_ptr->extent.height > 0)
+		{
+			extent.width = max(surface_ptr->extent.width, surface_capabilities.minImageExtent.width);
+			extent.height = max(surface_ptr->extent.height, surface_capabilities.minImageExtent.height);
+			extent.width = min(extent.width, surface_capabilities.maxImageExtent.width);
+			extent.height = min(extent.height, surface_capabilities.maxImageExtent.height);
+		}
+	}
+
 	// surface present queue
 	Vulkan_Queue *queue_ptr = (Vulkan_Queue *)opal_poolGetElement(&device_ptr->queues, (Opal_PoolHandle)desc->queue);
 	assert(queue_ptr);
@@ -2763,11 +3172,13 @@ static Opal_Result vulkan_deviceCreateSwapchain(Opal_Device this, const Opal_Swa
 	result.current_image = 0;
 	result.current_semaphore = 0;
 
+	opal_pacingInitialize(&result.pacing, (device_ptr->present_wait == VK_TRUE) ? desc->max_frames_in_flight : 0);
+
 	*swapchain = (Opal_Swapchain)opal_poolAddElement(&device_ptr->swapchains, &result);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceDestroySemaphore(Opal_Device this, Opal_Semaphore semaphore)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceDestroySemaphore(Opal_Device this, Opal_Semaphore semaphore)
 {
 	assert(this);
 	assert(semaphore);
@@ -2779,13 +3190,14 @@ static Opal_Result vulkan_deviceDestroySemaphore(Opal_Device this, Opal_Semaphor
 	Vulkan_Semaphore *semaphore_ptr = (Vulkan_Semaphore *)opal_poolGetElement(&device_ptr->semaphores, handle);
 	assert(semaphore_ptr);
 
+	opal_notifierCancel(&device_ptr->notifier, (uint64_t)semaphore_ptr->semaphore);
 	opal_poolRemoveElement(&device_ptr->semaphores, handle);
 
 	vulkan_destroySemaphore(device_ptr, semaphore_ptr);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceDestroyFence(Opal_Device this, Opal_Fence fence)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceDestroyFence(Opal_Device this, Opal_Fence fence)
 {
 	assert(this);
 	assert(fence);
@@ -2803,7 +3215,7 @@ static Opal_Result vulkan_deviceDestroyFence(Opal_Device this, Opal_Fence fence)
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceDestroyBuffer(Opal_Device this, Opal_Buffer buffer)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceDestroyBuffer(Opal_Device this, Opal_Buffer buffer)
 {
 	assert(this);
 	assert(buffer);
@@ -2821,7 +3233,7 @@ static Opal_Result vulkan_deviceDestroyBuffer(Opal_Device this, Opal_Buffer buff
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceDestroyTexture(Opal_Device this, Opal_Texture texture)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceDestroyTexture(Opal_Device this, Opal_Texture texture)
 {
 	assert(this);
 	assert(texture);
@@ -2839,7 +3251,7 @@ static Opal_Result vulkan_deviceDestroyTexture(Opal_Device this, Opal_Texture te
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceDestroyTextureView(Opal_Device this, Opal_TextureView texture_view)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceDestroyTextureView(Opal_Device this, Opal_TextureView texture_view)
 {
 	assert(this);
 	assert(texture_view);
@@ -2857,7 +3269,7 @@ static Opal_Result vulkan_deviceDestroyTextureView(Opal_Device this, Opal_Textur
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceDestroySampler(Opal_Device this, Opal_Sampler sampler)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceDestroySampler(Opal_Device this, Opal_Sampler sampler)
 {
 	assert(this);
 	assert(sampler);
@@ -2866,6 +3278,9 @@ static Opal_Result vulkan_deviceDestroySampler(Opal_Device this, Opal_Sampler sa
 	assert(handle != OPAL_POOL_HANDLE_NULL);
 
 	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
+	if (opal_cacheRelease(&device_ptr->sampler_cache, sampler) > 0)
+		return OPAL_SUCCESS;
+
 	Vulkan_Sampler *sampler_ptr = (Vulkan_Sampler *)opal_poolGetElement(&device_ptr->samplers, handle);
 	assert(sampler_ptr);
 
@@ -2875,7 +3290,7 @@ static Opal_Result vulkan_deviceDestroySampler(Opal_Device this, Opal_Sampler sa
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceDestroyAccelerationStructure(Opal_Device this, Opal_AccelerationStructure acceleration_structure)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceDestroyAccelerationStructure(Opal_Device this, Opal_AccelerationStructure acceleration_structure)
 {
 	assert(this);
 	assert(acceleration_structure);
@@ -2893,7 +3308,7 @@ static Opal_Result vulkan_deviceDestroyAccelerationStructure(Opal_Device this, O
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceDestroyShaderBindingTable(Opal_Device this, Opal_ShaderBindingTable shader_binding_table)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceDestroyShaderBindingTable(Opal_Device this, Opal_ShaderBindingTable shader_binding_table)
 {
 	assert(this);
 	assert(shader_binding_table);
@@ -2911,7 +3326,7 @@ static Opal_Result vulkan_deviceDestroyShaderBindingTable(Opal_Device this, Opal
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceDestroyCommandAllocator(Opal_Device this, Opal_CommandAllocator command_allocator)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceDestroyCommandAllocator(Opal_Device this, Opal_CommandAllocator command_allocator)
 {
 	assert(this);
 	assert(command_allocator);
@@ -2931,7 +3346,7 @@ static Opal_Result vulkan_deviceDestroyCommandAllocator(Opal_Device this, Opal_C
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceDestroyCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceDestroyCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
 {
 	assert(this);
 	assert(command_buffer);
@@ -2946,6 +3361,7 @@ static Opal_Result vulkan_deviceDestroyCommandBuffer(Opal_Device this, Opal_Comm
 	assert(command_allocator_ptr);
 
 	device_ptr->vk.vkFreeCommandBuffers(vulkan_device, command_allocator_ptr->pool, 1, &command_buffer_ptr->command_buffer);
+	vulkan_destroyCommandBuffer(device_ptr, command_buffer_ptr);
 
 	// TODO: remove handle from Vulkan_CommandAllocator instance
 
@@ -2953,7 +3369,7 @@ static Opal_Result vulkan_deviceDestroyCommandBuffer(Opal_Device this, Opal_Comm
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceDestroyShader(Opal_Device this, Opal_Shader shader)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceDestroyShader(Opal_Device this, Opal_Shader shader)
 {
 	assert(this);
 	assert(shader);
@@ -2962,6 +3378,9 @@ static Opal_Result vulkan_deviceDestroyShader(Opal_Device this, Opal_Shader shad
 	assert(handle != OPAL_POOL_HANDLE_NULL);
 
 	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
+	if (opal_cacheRelease(&device_ptr->shader_cache, shader) > 0)
+		return OPAL_SUCCESS;
+
 	Vulkan_Shader *shader_ptr = (Vulkan_Shader *)opal_poolGetElement(&device_ptr->shaders, handle);
 	assert(shader_ptr);
 
@@ -2971,7 +3390,7 @@ static Opal_Result vulkan_deviceDestroyShader(Opal_Device this, Opal_Shader shad
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceDestroyDescriptorHeap(Opal_Device this, Opal_DescriptorHeap descriptor_heap)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceDestroyDescriptorHeap(Opal_Device this, Opal_DescriptorHeap descriptor_heap)
 {
 	assert(this);
 	assert(descriptor_heap);
@@ -2989,7 +3408,7 @@ static Opal_Result vulkan_deviceDestroyDescriptorHeap(Opal_Device this, Opal_Des
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceDestroyDescriptorSetLayout(Opal_Device this, Opal_DescriptorSetLayout descriptor_set_layout)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceDestroyDescriptorSetLayout(Opal_Device this, Opal_DescriptorSetLayout descriptor_set_layout)
 {
 	assert(this);
 	assert(descriptor_set_layout);
@@ -2998,6 +3417,12 @@ static Opal_Result vulkan_deviceDestroyDescriptorSetLayout(Opal_Device this, Opa
 	assert(handle != OPAL_POOL_HANDLE_NULL);
 
 	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
+	if (opal_cacheRelease(&device_ptr->descriptor_set_layout_cache, descriptor_set_layout) > 0)
+		return OPAL_SUCCESS;
+
+	// note: the handle can be reused for another layout from now on
+	opal_cacheEvict(&device_ptr->pipeline_layout_cache, descriptor_set_layout);
+
 	Vulkan_DescriptorSetLayout *descriptor_set_layout_ptr = (Vulkan_DescriptorSetLayout *)opal_poolGetElement(&device_ptr->descriptor_set_layouts, handle);
 	assert(descriptor_set_layout_ptr);
 
@@ -3007,7 +3432,7 @@ static Opal_Result vulkan_deviceDestroyDescriptorSetLayout(Opal_Device this, Opa
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceDestroyPipelineLayout(Opal_Device this, Opal_PipelineLayout pipeline_layout)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceDestroyPipelineLayout(Opal_Device this, Opal_PipelineLayout pipeline_layout)
 {
 	assert(this);
 	assert(pipeline_layout);
@@ -3016,6 +3441,9 @@ static Opal_Result vulkan_deviceDestroyPipelineLayout(Opal_Device this, Opal_Pip
 	assert(handle != OPAL_POOL_HANDLE_NULL);
 
 	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
+	if (opal_cacheRelease(&device_ptr->pipeline_layout_cache, pipeline_layout) > 0)
+		return OPAL_SUCCESS;
+
 	Vulkan_PipelineLayout *pipeline_layout_ptr = (Vulkan_PipelineLayout *)opal_poolGetElement(&device_ptr->pipeline_layouts, handle);
 	assert(pipeline_layout_ptr);
 
@@ -3025,7 +3453,7 @@ static Opal_Result vulkan_deviceDestroyPipelineLayout(Opal_Device this, Opal_Pip
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceDestroyGraphicsPipeline(Opal_Device this, Opal_GraphicsPipeline pipeline)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceDestroyGraphicsPipeline(Opal_Device this, Opal_GraphicsPipeline pipeline)
 {
 	assert(this);
 	assert(pipeline);
@@ -3043,7 +3471,7 @@ static Opal_Result vulkan_deviceDestroyGraphicsPipeline(Opal_Device this, Opal_G
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceDestroyComputePipeline(Opal_Device this, Opal_ComputePipeline pipeline)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceDestroyComputePipeline(Opal_Device this, Opal_ComputePipeline pipeline)
 {
 	assert(this);
 	assert(pipeline);
@@ -3061,7 +3489,7 @@ static Opal_Result vulkan_deviceDestroyComputePipeline(Opal_Device this, Opal_Co
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceDestroyRaytracePipeline(Opal_Device this, Opal_RaytracePipeline pipeline)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceDestroyRaytracePipeline(Opal_Device this, Opal_RaytracePipeline pipeline)
 {
 	assert(this);
 	assert(pipeline);
@@ -3079,7 +3507,7 @@ static Opal_Result vulkan_deviceDestroyRaytracePipeline(Opal_Device this, Opal_R
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceDestroySwapchain(Opal_Device this, Opal_Swapchain swapchain)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceDestroySwapchain(Opal_Device this, Opal_Swapchain swapchain)
 {
 	assert(this);
 	assert(swapchain);
@@ -3100,12 +3528,21 @@ static Opal_Result vulkan_deviceDestroySwapchain(Opal_Device this, Opal_Swapchai
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceDestroy(Opal_Device this)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceDestroy(Opal_Device this)
 {
 	assert(this);
 
 	Vulkan_Device *ptr = (Vulkan_Device *)this;
 
+	opal_instancePackerShutdown(&ptr->instance_packer);
+	opal_notifierShutdown(&ptr->notifier);
+	opal_compilerShutdown(&ptr->compiler);
+
+	opal_cacheShutdown(&ptr->pipeline_layout_cache);
+	opal_cacheShutdown(&ptr->descriptor_set_layout_cache);
+	opal_cacheShutdown(&ptr->sampler_cache);
+	opal_cacheShutdown(&ptr->shader_cache);
+
 	{
 		uint32_t head = opal_poolGetHeadIndex(&ptr->swapchains);
 		while (head != OPAL_POOL_HANDLE_NULL)
@@ -3331,11 +3768,24 @@ static Opal_Result vulkan_deviceDestroy(Opal_Device this)
 	for (uint32_t i = 0; i < OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX; ++i)
 		free(ptr->queue_handles[i]);
 
+	{
+		uint32_t head = opal_poolGetHeadIndex(&ptr->command_buffers);
+		while (head != OPAL_POOL_HANDLE_NULL)
+		{
+			Vulkan_CommandBuffer *command_buffer_ptr = (Vulkan_CommandBuffer *)opal_poolGetElementByIndex(&ptr->command_buffers, head);
+			vulkan_destroyCommandBuffer(ptr, command_buffer_ptr);
+
+			head = opal_poolGetNextIndex(&ptr->command_buffers, head);
+		}
+
+		opal_poolShutdown(&ptr->command_buffers);
+	}
+
 	opal_poolShutdown(&ptr->queues);
 	opal_poolShutdown(&ptr->descriptor_sets);
-	opal_poolShutdown(&ptr->command_buffers);
 
 	opal_bumpShutdown(&ptr->bump);
+	opal_buildBatchShutdown(&ptr->build_batch);
 
 #ifdef OPAL_HAS_VMA
 	if (ptr->use_vma > 0)
@@ -3357,7 +3807,7 @@ static Opal_Result vulkan_deviceDestroy(Opal_Device this)
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceBuildShaderBindingTable(Opal_Device this, Opal_ShaderBindingTable shader_binding_table, const Opal_ShaderBindingTableBuildDesc *desc)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceBuildShaderBindingTable(Opal_Device this, Opal_ShaderBindingTable shader_binding_table, const Opal_ShaderBindingTableBuildDesc *desc)
 {
 	assert(this);
 	assert(shader_binding_table);
@@ -3514,7 +3964,7 @@ static Opal_Result vulkan_deviceBuildShaderBindingTable(Opal_Device this, Opal_S
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceBuildAccelerationStructureInstanceBuffer(Opal_Device this, const Opal_AccelerationStructureInstanceBufferBuildDesc *desc)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceBuildAccelerationStructureInstanceBuffer(Opal_Device this, const Opal_AccelerationStructureInstanceBufferBuildDesc *desc)
 {
 	assert(this);
 	assert(desc);
@@ -3528,28 +3978,12 @@ static Opal_Result vulkan_deviceBuildAccelerationStructureInstanceBuffer(Opal_De
 
 	dst_data += desc->buffer.offset;
 
-	for (uint32_t i = 0; i < desc->num_instances; ++i)
-	{
-		const Opal_AccelerationStructureInstance *opal_instance = &desc->instances[i];
-		VkAccelerationStructureInstanceKHR *vulkan_instance = (VkAccelerationStructureInstanceKHR *)dst_data;
-
-		Vulkan_AccelerationStructure *blas_ptr = (Vulkan_AccelerationStructure *)opal_poolGetElement(&device_ptr->acceleration_structures, (Opal_PoolHandle)opal_instance->blas);
-		assert(blas_ptr);
-
-		memcpy(&vulkan_instance->transform, opal_instance->transform, sizeof(VkTransformMatrixKHR));
-		vulkan_instance->instanceCustomIndex = opal_instance->custom_index;
-		vulkan_instance->mask = opal_instance->mask;
-		vulkan_instance->instanceShaderBindingTableRecordOffset = opal_instance->intersection_index_offset;
-		vulkan_instance->flags = vulkan_helperToAccelerationStructureGeometryInstanceFlags(opal_instance->flags);
-		vulkan_instance->accelerationStructureReference = blas_ptr->device_address;
-
-		dst_data += sizeof(VkAccelerationStructureInstanceKHR);
-	}
+	opal_instancePackerRun(&device_ptr->instance_packer, dst_data, desc->num_instances, desc->instances, desc->blas_addresses, vulkan_resolveInstanceAddress);
 
 	return vulkan_deviceUnmapBuffer(this, desc->buffer.buffer);
 }
 
-static Opal_Result vulkan_deviceResetCommandAllocator(Opal_Device this, Opal_CommandAllocator command_allocator)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceResetCommandAllocator(Opal_Device this, Opal_CommandAllocator command_allocator)
 {
 	assert(this);
 	assert(command_allocator);
@@ -3567,7 +4001,7 @@ static Opal_Result vulkan_deviceResetCommandAllocator(Opal_Device this, Opal_Com
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceAllocateDescriptorSet(Opal_Device this, const Opal_DescriptorSetAllocationDesc *desc, Opal_DescriptorSet *descriptor_set)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceAllocateDescriptorSet(Opal_Device this, const Opal_DescriptorSetAllocationDesc *desc, Opal_DescriptorSet *descriptor_set)
 {
 	assert(this);
 	assert(desc);
@@ -3622,7 +4056,7 @@ static Opal_Result vulkan_deviceAllocateDescriptorSet(Opal_Device this, const Op
 	return opal_result;
 }
 
-static Opal_Result vulkan_deviceFreeDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceFreeDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set)
 {
 	assert(this);
 	assert(descriptor_set);
@@ -3654,7 +4088,7 @@ static Opal_Result vulkan_deviceFreeDescriptorSet(Opal_Device this, Opal_Descrip
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceMapBuffer(Opal_Device this, Opal_Buffer buffer, void **ptr)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceMapBuffer(Opal_Device this, Opal_Buffer buffer, void **ptr)
 {
 	assert(this);
 	assert(buffer);
@@ -3685,7 +4119,7 @@ static Opal_Result vulkan_deviceMapBuffer(Opal_Device this, Opal_Buffer buffer,
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceUnmapBuffer(Opal_Device this, Opal_Buffer buffer)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceUnmapBuffer(Opal_Device this, Opal_Buffer buffer)
 {
 	assert(this);
 	assert(buffer);
@@ -3710,7 +4144,7 @@ static Opal_Result vulkan_deviceUnmapBuffer(Opal_Device this, Opal_Buffer buffer
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceWriteBuffer(Opal_Device this, Opal_Buffer buffer, uint64_t offset, const void *data, uint64_t size)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceWriteBuffer(Opal_Device this, Opal_Buffer buffer, uint64_t offset, const void *data, uint64_t size)
 {
 	assert(this);
 	assert(buffer);
@@ -3727,7 +4161,7 @@ static Opal_Result vulkan_deviceWriteBuffer(Opal_Device this, Opal_Buffer buffer
 	return vulkan_deviceUnmapBuffer(this, buffer);
 }
 
-static Opal_Result vulkan_deviceUpdateDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set, uint32_t num_entries, const Opal_DescriptorSetEntry *entries)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceUpdateDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set, uint32_t num_entries, const Opal_DescriptorSetEntry *entries)
 {
 	assert(this);
 	assert(descriptor_set);
@@ -3926,7 +4360,7 @@ static Opal_Result vulkan_deviceUpdateDescriptorSet(Opal_Device this, Opal_Descr
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceBeginCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceBeginCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
 {
 	assert(this);
 	assert(command_buffer);
@@ -3945,10 +4379,11 @@ static Opal_Result vulkan_deviceBeginCommandBuffer(Opal_Device this, Opal_Comman
 		return OPAL_VULKAN_ERROR;
 
 	command_buffer_ptr->pipeline_layout = OPAL_NULL_HANDLE;
+	command_buffer_ptr->num_compacted_size_queries = 0;
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceEndCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceEndCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
 {
 	assert(this);
 	assert(command_buffer);
@@ -3966,7 +4401,7 @@ static Opal_Result vulkan_deviceEndCommandBuffer(Opal_Device this, Opal_CommandB
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceQuerySemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t *value)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceQuerySemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t *value)
 {
 	assert(this);
 	assert(semaphore);
@@ -3984,7 +4419,7 @@ static Opal_Result vulkan_deviceQuerySemaphore(Opal_Device this, Opal_Semaphore
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceSignalSemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t value)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceSignalSemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t value)
 {
 	assert(this);
 	assert(semaphore);
@@ -4006,7 +4441,7 @@ static Opal_Result vulkan_deviceSignalSemaphore(Opal_Device this, Opal_Semaphore
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceWaitSemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t value, uint64_t timeout_milliseconds)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceWaitSemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t value, uint64_t timeout_milliseconds)
 {
 	assert(this);
 	assert(semaphore);
@@ -4032,7 +4467,68 @@ static Opal_Result vulkan_deviceWaitSemaphore(Opal_Device this, Opal_Semaphore s
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceWaitQueue(Opal_Device this, Opal_Queue queue)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceWaitSemaphores(Opal_Device this, uint32_t num_semaphores, const Opal_Semaphore *semaphores, const uint64_t *values, uint32_t wait_any, uint64_t timeout_milliseconds)
+{
+	assert(this);
+	assert(num_semaphores > 0);
+	assert(semaphores);
+	assert(values);
+
+	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
+
+	opal_bumpReset(&device_ptr->bump);
+	uint32_t vulkan_semaphores_offset = opal_bumpAlloc(&device_ptr->bump, sizeof(VkSemaphore) * num_semaphores);
+
+	VkSemaphore *vulkan_semaphores = (VkSemaphore *)(device_ptr->bump.data + vulkan_semaphores_offset);
+
+	for (uint32_t i = 0; i < num_semaphores; ++i)
+	{
+		Vulkan_Semaphore *semaphore_ptr = (Vulkan_Semaphore *)opal_poolGetElement(&device_ptr->semaphores, (Opal_PoolHandle)semaphores[i]);
+		assert(semaphore_ptr);
+
+		vulkan_semaphores[i] = semaphore_ptr->semaphore;
+	}
+
+	VkSemaphoreWaitInfoKHR wait_info = {0};
+	wait_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+	wait_info.flags = (wait_any) ? VK_SEMAPHORE_WAIT_ANY_BIT_KHR : 0;
+	wait_info.semaphoreCount = num_semaphores;
+	wait_info.pSemaphores = vulkan_semaphores;
+	wait_info.pValues = values;
+
+	VkResult result = device_ptr->vk.vkWaitSemaphoresKHR(device_ptr->device, &wait_info, timeout_milliseconds * 1000000);
+	if (result == VK_TIMEOUT)
+		return OPAL_WAIT_TIMEOUT;
+
+	if (result != VK_SUCCESS)
+		return OPAL_VULKAN_ERROR;
+
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceRegisterSemaphoreCallback(Opal_Device this, Opal_Semaphore semaphore, uint64_t value, PFN_opalSemaphoreCallback callback, void *user_data)
+{
+	assert(this);
+	assert(semaphore);
+	assert(callback);
+
+	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
+
+	Vulkan_Semaphore *semaphore_ptr = (Vulkan_Semaphore *)opal_poolGetElement(&device_ptr->semaphores, (Opal_PoolHandle)semaphore);
+	assert(semaphore_ptr);
+
+	return opal_notifierRegister(&device_ptr->notifier, semaphore, (uint64_t)semaphore_ptr->semaphore, value, callback, user_data);
+}
+
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceWaitPipelineTask(Opal_Device this, Opal_PipelineTask task, uint64_t timeout_milliseconds)
+{
+	assert(this);
+
+	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
+	return opal_compilerWait(&device_ptr->compiler, task, timeout_milliseconds);
+}
+
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceWaitQueue(Opal_Device this, Opal_Queue queue)
 {
 	assert(this);
 	assert(queue);
@@ -4049,7 +4545,7 @@ static Opal_Result vulkan_deviceWaitQueue(Opal_Device this, Opal_Queue queue)
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceWaitIdle(Opal_Device this)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceWaitIdle(Opal_Device this)
 {
 	assert(this);
 
@@ -4063,7 +4559,7 @@ static Opal_Result vulkan_deviceWaitIdle(Opal_Device this)
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceSubmit(Opal_Device this, Opal_Queue queue, const Opal_SubmitDesc *desc)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceSubmit(Opal_Device this, Opal_Queue queue, const Opal_SubmitDesc *desc)
 {
 	assert(this);
 	assert(desc);
@@ -4160,6 +4656,8 @@ static Opal_Result vulkan_deviceSubmit(Opal_Device this, Opal_Queue queue, const
 		signal_semaphores[current_signal_object] = swapchain_ptr->present_semaphores[swapchain_ptr->current_semaphore];
 		signal_values[current_signal_object] = 0;
 		current_signal_object++;
+
+		opal_pacingSubmit(&swapchain_ptr->pacing, opal_timerGetNanoseconds());
 	}
 
 	VkTimelineSemaphoreSubmitInfo timeline_submit_info = {0};
@@ -4187,7 +4685,7 @@ static Opal_Result vulkan_deviceSubmit(Opal_Device this, Opal_Queue queue, const
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceAcquire(Opal_Device this, Opal_Swapchain swapchain, Opal_TextureView *texture_view)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceAcquire(Opal_Device this, Opal_Swapchain swapchain, Opal_TextureView *texture_view)
 {
 	assert(this);
  	assert(swapchain);
@@ -4203,10 +4701,23 @@ static Opal_Result vulkan_deviceAcquire(Opal_Device this, Opal_Swapchain swapcha
 	semaphore_index %= swapchain_ptr->num_images;
 
 	VkSemaphore vulkan_semaphore = swapchain_ptr->acquire_semaphores[semaphore_index];
-	uint64_t timeout = 0;
 
-	VkResult result = device_ptr->vk.vkAcquireNextImageKHR(vulkan_device, swapchain_ptr->swapchain, timeout, vulkan_semaphore, VK_NULL_HANDLE, &swapchain_ptr->current_image);
-	if (result != VK_SUCCESS)
+	// note: block until the frame max_frames_in_flight presents ago reached the display,
+	//       this is what keeps input to photon latency bounded when the gpu is the bottleneck
+	uint64_t throttle_frame = opal_pacingGetThrottleFrame(&swapchain_ptr->pacing);
+	if (throttle_frame > 0)
+	{
+		VkResult result = device_ptr->vk.vkWaitForPresentKHR(vulkan_device, swapchain_ptr->swapchain, throttle_frame, UINT64_MAX);
+		if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR)
+			return OPAL_VULKAN_ERROR;
+
+		opal_pacingDisplay(&swapchain_ptr->pacing, throttle_frame, opal_timerGetNanoseconds());
+	}
+
+	// note: zero timeout fails as soon as all images are queued for presentation, so block
+	//       instead and let the presentation engine pace the caller
+	VkResult result = device_ptr->vk.vkAcquireNextImageKHR(vulkan_device, swapchain_ptr->swapchain, UINT64_MAX, vulkan_semaphore, VK_NULL_HANDLE, &swapchain_ptr->current_image);
+	if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR)
 		return OPAL_VULKAN_ERROR;
 
 	assert(swapchain_ptr->current_image < swapchain_ptr->num_images);
@@ -4214,10 +4725,11 @@ static Opal_Result vulkan_deviceAcquire(Opal_Device this, Opal_Swapchain swapcha
 
 	swapchain_ptr->current_semaphore = semaphore_index;
 
+	opal_pacingAcquire(&swapchain_ptr->pacing, opal_timerGetNanoseconds());
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_devicePresent(Opal_Device this, Opal_Swapchain swapchain)
+OPAL_BACKEND_STATIC Opal_Result vulkan_devicePresent(Opal_Device this, Opal_Swapchain swapchain)
 {
 	assert(this);
  	assert(swapchain);
@@ -4241,14 +4753,97 @@ static Opal_Result vulkan_devicePresent(Opal_Device this, Opal_Swapchain swapcha
 	present_info.pSwapchains = &swapchain_ptr->swapchain;
 	present_info.pImageIndices = &swapchain_ptr->current_image;
 
+	uint64_t present_id = opal_pacingGetNextFrame(&swapchain_ptr->pacing);
+
+	VkPresentIdKHR present_id_info = {0};
+	present_id_info.sType = VK_STRUCTURE_TYPE_PRESENT_ID_KHR;
+	present_id_info.swapchainCount = 1;
+	present_id_info.pPresentIds = &present_id;
+
+	if (device_ptr->present_wait == VK_TRUE)
+		present_info.pNext = &present_id_info;
+
 	VkResult result = device_ptr->vk.vkQueuePresentKHR(queue_ptr->queue, &present_info);
-	if (result != VK_SUCCESS)
+	if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR)
+		return OPAL_VULKAN_ERROR;
+
+	opal_pacingPresent(&swapchain_ptr->pacing, opal_timerGetNanoseconds());
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceWaitPresent(Opal_Device this, Opal_Swapchain swapchain, uint64_t frame_id, uint64_t timeout_milliseconds)
+{
+	assert(this);
+	assert(swapchain);
+
+	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
+
+	if (device_ptr->present_wait == VK_FALSE)
+		return OPAL_NOT_SUPPORTED;
+
+	Vulkan_Swapchain *swapchain_ptr = (Vulkan_Swapchain *)opal_poolGetElement(&device_ptr->swapchains, (Opal_PoolHandle)swapchain);
+	assert(swapchain_ptr);
+
+	// note: vkWaitForPresentKHR on a frame that wasn't presented yet would only return on timeout
+	if (frame_id > swapchain_ptr->pacing.last_presented_frame)
+		return OPAL_INVALID_SWAPCHAIN;
+
+	if (frame_id <= swapchain_ptr->pacing.last_displayed_frame)
+		return OPAL_SUCCESS;
+
+	VkResult result = device_ptr->vk.vkWaitForPresentKHR(device_ptr->device, swapchain_ptr->swapchain, frame_id, timeout_milliseconds * 1000000);
+	if (result == VK_TIMEOUT)
+		return OPAL_WAIT_TIMEOUT;
+
+	if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR)
 		return OPAL_VULKAN_ERROR;
 
+	opal_pacingDisplay(&swapchain_ptr->pacing, frame_id, opal_timerGetNanoseconds());
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceGetSwapchainFrameTiming(Opal_Device this, Opal_Swapchain swapchain, Opal_FrameTiming *timing)
+{
+	assert(this);
+	assert(swapchain);
+	assert(timing);
+
+	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
+
+	Vulkan_Swapchain *swapchain_ptr = (Vulkan_Swapchain *)opal_poolGetElement(&device_ptr->swapchains, (Opal_PoolHandle)swapchain);
+	assert(swapchain_ptr);
+
+	// note: poll the newest completed present, display time is when the completion was observed.
+	//       Only the last OPAL_PACING_MAX_FRAMES presents are polled, so a long gap between
+	//       calls doesn't turn into thousands of vkWaitForPresentKHR calls
+	if (device_ptr->present_wait == VK_TRUE)
+	{
+		uint64_t first_frame = swapchain_ptr->pacing.last_displayed_frame + 1;
+		uint64_t last_frame = swapchain_ptr->pacing.last_presented_frame;
+		uint64_t now = opal_timerGetNanoseconds();
+
+		if (last_frame >= OPAL_PACING_MAX_FRAMES && first_frame < last_frame - OPAL_PACING_MAX_FRAMES + 1)
+			first_frame = last_frame - OPAL_PACING_MAX_FRAMES + 1;
+
+		for (uint64_t frame_id = last_frame; frame_id >= first_frame; --frame_id)
+		{
+			VkResult result = device_ptr->vk.vkWaitForPresentKHR(device_ptr->device, swapchain_ptr->swapchain, frame_id, 0);
+			if (result == VK_TIMEOUT)
+				continue;
+
+			if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR)
+				return OPAL_VULKAN_ERROR;
+
+			opal_pacingDisplay(&swapchain_ptr->pacing, frame_id, now);
+			break;
+		}
+	}
+
+	opal_pacingGetTiming(&swapchain_ptr->pacing, timing);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdSetDescriptorHeap(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_DescriptorHeap descriptor_heap)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdSetDescriptorHeap(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_DescriptorHeap descriptor_heap)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4271,7 +4866,7 @@ static Opal_Result vulkan_deviceCmdSetDescriptorHeap(Opal_Device this, Opal_Comm
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdBeginGraphicsPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_FramebufferDesc *framebuffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdBeginGraphicsPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_FramebufferDesc *framebuffer, const Opal_PassBarriersDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4384,7 +4979,7 @@ static Opal_Result vulkan_deviceCmdBeginGraphicsPass(Opal_Device this, Opal_Comm
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdGraphicsSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdGraphicsSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4399,7 +4994,7 @@ static Opal_Result vulkan_deviceCmdGraphicsSetPipelineLayout(Opal_Device this, O
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdGraphicsSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_GraphicsPipeline pipeline)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdGraphicsSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_GraphicsPipeline pipeline)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4418,7 +5013,7 @@ static Opal_Result vulkan_deviceCmdGraphicsSetPipeline(Opal_Device this, Opal_Co
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdGraphicsSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdGraphicsSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4434,7 +5029,7 @@ static Opal_Result vulkan_deviceCmdGraphicsSetDescriptorSet(Opal_Device this, Op
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdGraphicsSetVertexBuffers(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t first_index, uint32_t num_vertex_buffers, const Opal_VertexBufferView *vertex_buffers)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdGraphicsSetVertexBuffers(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t first_index, uint32_t num_vertex_buffers, const Opal_VertexBufferView *vertex_buffers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4468,7 +5063,7 @@ static Opal_Result vulkan_deviceCmdGraphicsSetVertexBuffers(Opal_Device this, Op
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdGraphicsSetIndexBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_IndexBufferView index_buffer)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdGraphicsSetIndexBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_IndexBufferView index_buffer)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4489,7 +5084,7 @@ static Opal_Result vulkan_deviceCmdGraphicsSetIndexBuffer(Opal_Device this, Opal
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdGraphicsSetViewport(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Viewport viewport)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdGraphicsSetViewport(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Viewport viewport)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4512,7 +5107,7 @@ static Opal_Result vulkan_deviceCmdGraphicsSetViewport(Opal_Device this, Opal_Co
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdGraphicsSetScissor(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdGraphicsSetScissor(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4533,7 +5128,7 @@ static Opal_Result vulkan_deviceCmdGraphicsSetScissor(Opal_Device this, Opal_Com
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdGraphicsDraw(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_vertices, uint32_t num_instances, uint32_t base_vertex, uint32_t base_instance)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdGraphicsDraw(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_vertices, uint32_t num_instances, uint32_t base_vertex, uint32_t base_instance)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4548,7 +5143,7 @@ static Opal_Result vulkan_deviceCmdGraphicsDraw(Opal_Device this, Opal_CommandBu
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdGraphicsDrawIndexed(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_indices, uint32_t num_instances, uint32_t base_index, int32_t vertex_offset, uint32_t base_instance)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdGraphicsDrawIndexed(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_indices, uint32_t num_instances, uint32_t base_index, int32_t vertex_offset, uint32_t base_instance)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4563,7 +5158,7 @@ static Opal_Result vulkan_deviceCmdGraphicsDrawIndexed(Opal_Device this, Opal_Co
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdGraphicsMeshletDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_threadgroups_x, uint32_t num_threadgroups_y, uint32_t num_threadgroups_z)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdGraphicsMeshletDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_threadgroups_x, uint32_t num_threadgroups_y, uint32_t num_threadgroups_z)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4578,7 +5173,7 @@ static Opal_Result vulkan_deviceCmdGraphicsMeshletDispatch(Opal_Device this, Opa
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdEndGraphicsPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdEndGraphicsPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4598,7 +5193,7 @@ static Opal_Result vulkan_deviceCmdEndGraphicsPass(Opal_Device this, Opal_Comman
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdBeginComputePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdBeginComputePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4616,7 +5211,7 @@ static Opal_Result vulkan_deviceCmdBeginComputePass(Opal_Device this, Opal_Comma
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdComputeSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdComputeSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4631,7 +5226,7 @@ static Opal_Result vulkan_deviceCmdComputeSetPipelineLayout(Opal_Device this, Op
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdComputeSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_GraphicsPipeline pipeline)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdComputeSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_GraphicsPipeline pipeline)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4650,7 +5245,7 @@ static Opal_Result vulkan_deviceCmdComputeSetPipeline(Opal_Device this, Opal_Com
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdComputeSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdComputeSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4666,7 +5261,7 @@ static Opal_Result vulkan_deviceCmdComputeSetDescriptorSet(Opal_Device this, Opa
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdComputeMemoryBarrier(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_MemoryBarrierDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdComputeMemoryBarrier(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_MemoryBarrierDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4682,7 +5277,7 @@ static Opal_Result vulkan_deviceCmdComputeMemoryBarrier(Opal_Device this, Opal_C
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdComputeDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_threadgroups_x, uint32_t num_threadgroups_y, uint32_t num_threadgroups_z)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdComputeDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_threadgroups_x, uint32_t num_threadgroups_y, uint32_t num_threadgroups_z)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4697,7 +5292,7 @@ static Opal_Result vulkan_deviceCmdComputeDispatch(Opal_Device this, Opal_Comman
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdEndComputePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdEndComputePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4716,7 +5311,7 @@ static Opal_Result vulkan_deviceCmdEndComputePass(Opal_Device this, Opal_Command
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdBeginRaytracePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdBeginRaytracePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4734,7 +5329,7 @@ static Opal_Result vulkan_deviceCmdBeginRaytracePass(Opal_Device this, Opal_Comm
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdRaytraceSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdRaytraceSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4749,7 +5344,7 @@ static Opal_Result vulkan_deviceCmdRaytraceSetPipelineLayout(Opal_Device this, O
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdRaytraceSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_GraphicsPipeline pipeline)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdRaytraceSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_GraphicsPipeline pipeline)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4768,7 +5363,7 @@ static Opal_Result vulkan_deviceCmdRaytraceSetPipeline(Opal_Device this, Opal_Co
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdRaytraceSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdRaytraceSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4784,7 +5379,7 @@ static Opal_Result vulkan_deviceCmdRaytraceSetDescriptorSet(Opal_Device this, Op
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdRaytraceSetShaderBindingTable(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_ShaderBindingTable shader_binding_table)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdRaytraceSetShaderBindingTable(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_ShaderBindingTable shader_binding_table)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4808,7 +5403,7 @@ static Opal_Result vulkan_deviceCmdRaytraceSetShaderBindingTable(Opal_Device thi
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdRaytraceMemoryBarrier(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_MemoryBarrierDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdRaytraceMemoryBarrier(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_MemoryBarrierDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4824,7 +5419,7 @@ static Opal_Result vulkan_deviceCmdRaytraceMemoryBarrier(Opal_Device this, Opal_
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdRaytraceDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t width, uint32_t height, uint32_t depth)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdRaytraceDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t width, uint32_t height, uint32_t depth)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4876,7 +5471,7 @@ static Opal_Result vulkan_deviceCmdRaytraceDispatch(Opal_Device this, Opal_Comma
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdEndRaytracePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdEndRaytracePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4895,7 +5490,7 @@ static Opal_Result vulkan_deviceCmdEndRaytracePass(Opal_Device this, Opal_Comman
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdBeginCopyPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdBeginCopyPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4913,7 +5508,7 @@ static Opal_Result vulkan_deviceCmdBeginCopyPass(Opal_Device this, Opal_CommandB
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdCopyBufferToBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer src_buffer, uint64_t src_offset, Opal_Buffer dst_buffer, uint64_t dst_offset, uint64_t size)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdCopyBufferToBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer src_buffer, uint64_t src_offset, Opal_Buffer dst_buffer, uint64_t dst_offset, uint64_t size)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4940,7 +5535,7 @@ static Opal_Result vulkan_deviceCmdCopyBufferToBuffer(Opal_Device this, Opal_Com
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdCopyBufferToTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_BufferTextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdCopyBufferToTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_BufferTextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size)
 {
 	assert(this);
 	assert(command_buffer);
@@ -4975,7 +5570,7 @@ static Opal_Result vulkan_deviceCmdCopyBufferToTexture(Opal_Device this, Opal_Co
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdCopyTextureToBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_BufferTextureRegion dst, Opal_Extent3D size)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdCopyTextureToBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_BufferTextureRegion dst, Opal_Extent3D size)
 {
 	assert(this);
 	assert(command_buffer);
@@ -5010,7 +5605,71 @@ static Opal_Result vulkan_deviceCmdCopyTextureToBuffer(Opal_Device this, Opal_Co
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdCopyTextureToTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdCopyBufferToTextureRegions(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer src_buffer, Opal_Texture dst_texture, uint32_t num_regions, const Opal_BufferTextureCopyRegion *regions)
+{
+	assert(this);
+	assert(command_buffer);
+	assert(num_regions == 0 || regions);
+
+	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
+
+	Vulkan_CommandBuffer *command_buffer_ptr = (Vulkan_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->pass == VULKAN_PASS_TYPE_COPY);
+
+	Vulkan_Buffer *src_buffer_ptr = (Vulkan_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)src_buffer);
+	assert(src_buffer_ptr);
+
+	Vulkan_Image *dst_image_ptr = (Vulkan_Image *)opal_poolGetElement(&device_ptr->images, (Opal_PoolHandle)dst_texture);
+	assert(dst_image_ptr);
+
+	if (num_regions == 0)
+		return OPAL_SUCCESS;
+
+	opal_bumpReset(&device_ptr->bump);
+	opal_bumpAlloc(&device_ptr->bump, sizeof(VkBufferImageCopy) * num_regions);
+
+	VkBufferImageCopy *copy_regions = (VkBufferImageCopy *)device_ptr->bump.data;
+	vulkan_fillBufferImageCopies(dst_image_ptr, num_regions, regions, copy_regions);
+
+	device_ptr->vk.vkCmdCopyBufferToImage(command_buffer_ptr->command_buffer, src_buffer_ptr->buffer, dst_image_ptr->image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, num_regions, copy_regions);
+
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdCopyTextureToBufferRegions(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Texture src_texture, Opal_Buffer dst_buffer, uint32_t num_regions, const Opal_BufferTextureCopyRegion *regions)
+{
+	assert(this);
+	assert(command_buffer);
+	assert(num_regions == 0 || regions);
+
+	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
+
+	Vulkan_CommandBuffer *command_buffer_ptr = (Vulkan_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->pass == VULKAN_PASS_TYPE_COPY);
+
+	Vulkan_Image *src_image_ptr = (Vulkan_Image *)opal_poolGetElement(&device_ptr->images, (Opal_PoolHandle)src_texture);
+	assert(src_image_ptr);
+
+	Vulkan_Buffer *dst_buffer_ptr = (Vulkan_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)dst_buffer);
+	assert(dst_buffer_ptr);
+
+	if (num_regions == 0)
+		return OPAL_SUCCESS;
+
+	opal_bumpReset(&device_ptr->bump);
+	opal_bumpAlloc(&device_ptr->bump, sizeof(VkBufferImageCopy) * num_regions);
+
+	VkBufferImageCopy *copy_regions = (VkBufferImageCopy *)device_ptr->bump.data;
+	vulkan_fillBufferImageCopies(src_image_ptr, num_regions, regions, copy_regions);
+
+	device_ptr->vk.vkCmdCopyImageToBuffer(command_buffer_ptr->command_buffer, src_image_ptr->image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, dst_buffer_ptr->buffer, num_regions, copy_regions);
+
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdCopyTextureToTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size)
 {
 	assert(this);
 	assert(command_buffer);
@@ -5055,10 +5714,12 @@ static Opal_Result vulkan_deviceCmdCopyTextureToTexture(Opal_Device this, Opal_C
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdEndCopyPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdFillBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer buffer, uint64_t offset, uint64_t size, uint32_t value)
 {
 	assert(this);
 	assert(command_buffer);
+	assert((offset & 3) == 0);
+	assert((size & 3) == 0);
 
 	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
 
@@ -5066,174 +5727,339 @@ static Opal_Result vulkan_deviceCmdEndCopyPass(Opal_Device this, Opal_CommandBuf
 	assert(command_buffer_ptr);
 	assert(command_buffer_ptr->pass == VULKAN_PASS_TYPE_COPY);
 
-	command_buffer_ptr->pass = VULKAN_PASS_TYPE_NONE;
+	Vulkan_Buffer *buffer_ptr = (Vulkan_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)buffer);
+	assert(buffer_ptr);
 
-	if (barriers != NULL)
-		vulkan_cmdPipelineBarrier(device_ptr, command_buffer_ptr, barriers);
+	if (size == 0)
+		return OPAL_SUCCESS;
+
+	device_ptr->vk.vkCmdFillBuffer(command_buffer_ptr->command_buffer, buffer_ptr->buffer, offset, size, value);
 
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdBeginAccelerationStructurePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdUpdateBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer buffer, uint64_t offset, uint64_t size, const void *data)
 {
 	assert(this);
 	assert(command_buffer);
+	assert(size == 0 || data);
+	assert((offset & 3) == 0);
+	assert((size & 3) == 0);
+
+	if (size > OPAL_MAX_UPDATE_BUFFER_SIZE)
+		return OPAL_NOT_SUPPORTED;
 
 	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
 
 	Vulkan_CommandBuffer *command_buffer_ptr = (Vulkan_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
 	assert(command_buffer_ptr);
-	assert(command_buffer_ptr->pass == VULKAN_PASS_TYPE_NONE);
+	assert(command_buffer_ptr->pass == VULKAN_PASS_TYPE_COPY);
 
-	if (barriers != NULL)
-		vulkan_cmdPipelineBarrier(device_ptr, command_buffer_ptr, barriers);
+	Vulkan_Buffer *buffer_ptr = (Vulkan_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)buffer);
+	assert(buffer_ptr);
 
-	command_buffer_ptr->pass = VULKAN_PASS_TYPE_ACCELERATION_STRUCTURE;
+	if (size == 0)
+		return OPAL_SUCCESS;
+
+	device_ptr->vk.vkCmdUpdateBuffer(command_buffer_ptr->command_buffer, buffer_ptr->buffer, offset, size, data);
 
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdAccelerationStructureBuild(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureBuildDesc *desc)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdClearTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureView texture_view, Opal_ClearValue clear_value)
 {
 	assert(this);
 	assert(command_buffer);
-	assert(desc);
 
 	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
 
 	Vulkan_CommandBuffer *command_buffer_ptr = (Vulkan_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
 	assert(command_buffer_ptr);
-	assert(command_buffer_ptr->pass == VULKAN_PASS_TYPE_ACCELERATION_STRUCTURE);
+	assert(command_buffer_ptr->pass == VULKAN_PASS_TYPE_COPY);
 
-	VkCommandBuffer vulkan_command_buffer = command_buffer_ptr->command_buffer;
+	Vulkan_ImageView *image_view_ptr = (Vulkan_ImageView *)opal_poolGetElement(&device_ptr->image_views, (Opal_PoolHandle)texture_view);
+	assert(image_view_ptr);
 
-	uint32_t num_entries = 1;
-	if (desc->type == OPAL_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL)
-		num_entries = desc->input.bottom_level.num_geometries;
+	// note: color clears need a graphics or compute queue, depth stencil clears need a graphics queue
+	VkBool32 is_depth_stencil = (image_view_ptr->aspect_mask & (VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT)) != 0;
 
-	opal_bumpReset(&device_ptr->bump);
-	uint32_t entries_offset = opal_bumpAlloc(&device_ptr->bump, sizeof(VkAccelerationStructureGeometryKHR) * num_entries);
-	uint32_t build_ranges_offset = opal_bumpAlloc(&device_ptr->bump, sizeof(VkAccelerationStructureBuildRangeInfoKHR) * num_entries);
+	if (command_buffer_ptr->engine_type == OPAL_DEVICE_ENGINE_TYPE_COPY)
+		return OPAL_NOT_SUPPORTED;
 
-	VkAccelerationStructureGeometryKHR *entries = (VkAccelerationStructureGeometryKHR *)(device_ptr->bump.data + entries_offset);
-	memset(entries, 0, sizeof(VkAccelerationStructureGeometryKHR) * num_entries);
+	if (is_depth_stencil && command_buffer_ptr->engine_type != OPAL_DEVICE_ENGINE_TYPE_MAIN)
+		return OPAL_NOT_SUPPORTED;
 
-	VkAccelerationStructureBuildRangeInfoKHR *build_ranges = (VkAccelerationStructureBuildRangeInfoKHR *)(device_ptr->bump.data + build_ranges_offset);
-	memset(build_ranges, 0, sizeof(VkAccelerationStructureBuildRangeInfoKHR) * num_entries);
+	VkImageSubresourceRange range = {0};
+	range.aspectMask = image_view_ptr->aspect_mask;
+	range.baseMipLevel = image_view_ptr->base_mip;
+	range.levelCount = 1;
+	range.baseArrayLayer = image_view_ptr->base_layer;
+	range.layerCount = image_view_ptr->num_layers;
 
-	const Vulkan_AccelerationStructure *dst_acceleration_structure_ptr = opal_poolGetElement(&device_ptr->acceleration_structures, (Opal_PoolHandle)desc->dst_acceleration_structure);
-	assert(dst_acceleration_structure_ptr);
-
-	const Vulkan_Buffer *scratch_buffer_ptr = opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)desc->scratch_buffer.buffer);
-	assert(scratch_buffer_ptr);
-
-	VkAccelerationStructureBuildGeometryInfoKHR build_info = {0};
-	build_info.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR;
-	build_info.type = vulkan_helperToAccelerationStructureType(desc->type);
-	build_info.flags = vulkan_helperToAccelerationStructureBuildFlags(desc->build_flags);
-	build_info.mode = vulkan_helperToAccelerationStructureBuildMode(desc->build_mode);
-	build_info.dstAccelerationStructure = dst_acceleration_structure_ptr->acceleration_structure;
+	if (is_depth_stencil)
+	{
+		VkClearDepthStencilValue value = {0};
+		value.depth = clear_value.depth_stencil.depth;
+		value.stencil = clear_value.depth_stencil.stencil;
 
-	if (desc->src_acceleration_structure)
+		device_ptr->vk.vkCmdClearDepthStencilImage(command_buffer_ptr->command_buffer, image_view_ptr->image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &value, 1, &range);
+	}
+	else
 	{
-		const Vulkan_AccelerationStructure *src_acceleration_structure_ptr = opal_poolGetElement(&device_ptr->acceleration_structures, (Opal_PoolHandle)desc->src_acceleration_structure);
-		assert(src_acceleration_structure_ptr);
+		VkClearColorValue value = {0};
+		memcpy(&value, &clear_value.color, sizeof(VkClearColorValue));
 
-		build_info.srcAccelerationStructure = src_acceleration_structure_ptr->acceleration_structure;
+		device_ptr->vk.vkCmdClearColorImage(command_buffer_ptr->command_buffer, image_view_ptr->image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &value, 1, &range);
 	}
 
-	build_info.pGeometries = entries;
-	build_info.geometryCount = 1;
-	if (desc->type == OPAL_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL)
-		build_info.geometryCount = desc->input.bottom_level.num_geometries;
+	return OPAL_SUCCESS;
+}
 
-	build_info.scratchData.deviceAddress = scratch_buffer_ptr->device_address + desc->scratch_buffer.offset;
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdBlitTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_Extent3D src_size, Opal_TextureRegion dst, Opal_Extent3D dst_size, Opal_SamplerFilterMode filter)
+{
+	assert(this);
+	assert(command_buffer);
 
-	if (desc->type == OPAL_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL)
-	{
-		for (uint32_t j = 0; j < build_info.geometryCount; ++j)
-		{
-			const Opal_AccelerationStructureGeometry *opal_geometry = &desc->input.bottom_level.geometries[j];
-			VkAccelerationStructureGeometryKHR *geometry = &entries[j];
-			VkAccelerationStructureBuildRangeInfoKHR *build_range = &build_ranges[j];
+	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
 
-			geometry->sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_KHR;
-			geometry->geometryType = vulkan_helperToAccelerationStructureGeometryType(opal_geometry->type);
-			geometry->flags = vulkan_helperToAccelerationStructureGeometryFlags(opal_geometry->flags);
+	Vulkan_CommandBuffer *command_buffer_ptr = (Vulkan_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->pass == VULKAN_PASS_TYPE_COPY);
 
-			if (opal_geometry->type == OPAL_ACCELERATION_STRUCTURE_GEOMETRY_TYPE_TRIANGLES)
-			{
-				const Opal_AccelerationStructureGeometryDataTriangles *opal_triangles = &opal_geometry->data.triangles;
-				VkAccelerationStructureGeometryTrianglesDataKHR *triangles = &geometry->geometry.triangles;
+	Vulkan_ImageView *src_image_view_ptr = (Vulkan_ImageView *)opal_poolGetElement(&device_ptr->image_views, (Opal_PoolHandle)src.texture_view);
+	assert(src_image_view_ptr);
 
-				const Vulkan_Buffer *vertex_buffer_ptr = opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)opal_triangles->vertex_buffer.buffer);
-				assert(vertex_buffer_ptr);
+	Vulkan_ImageView *dst_image_view_ptr = (Vulkan_ImageView *)opal_poolGetElement(&device_ptr->image_views, (Opal_PoolHandle)dst.texture_view);
+	assert(dst_image_view_ptr);
 
-				triangles->sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_TRIANGLES_DATA_KHR;
-				triangles->vertexFormat = vulkan_helperToVertexFormat(opal_triangles->vertex_format);
-				triangles->vertexData.deviceAddress = vertex_buffer_ptr->device_address + opal_triangles->vertex_buffer.offset;
-				triangles->vertexStride = opal_triangles->vertex_stride;
-				triangles->maxVertex = opal_triangles->num_vertices - 1;
-				triangles->indexType = vulkan_helperToIndexType(opal_triangles->index_format);
+	// note: vkCmdBlitImage is graphics queue only
+	if (command_buffer_ptr->engine_type != OPAL_DEVICE_ENGINE_TYPE_MAIN)
+		return OPAL_NOT_SUPPORTED;
+
+	VkFormatFeatureFlags src_features = VK_FORMAT_FEATURE_BLIT_SRC_BIT;
+	if (filter == OPAL_SAMPLER_FILTER_MODE_LINEAR)
+		src_features |= VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT;
+
+	if (!vulkan_hasFormatFeatures(device_ptr, src_image_view_ptr->format, src_features))
+		return OPAL_NOT_SUPPORTED;
+
+	if (!vulkan_hasFormatFeatures(device_ptr, dst_image_view_ptr->format, VK_FORMAT_FEATURE_BLIT_DST_BIT))
+		return OPAL_NOT_SUPPORTED;
+
+	VkImageBlit blit_region = {0};
+	blit_region.srcSubresource.aspectMask = src_image_view_ptr->aspect_mask;
+	blit_region.srcSubresource.mipLevel = src_image_view_ptr->base_mip;
+	blit_region.srcSubresource.baseArrayLayer = src_image_view_ptr->base_layer;
+	blit_region.srcSubresource.layerCount = src_image_view_ptr->num_layers;
+	blit_region.srcOffsets[0].x = src.offset.x;
+	blit_region.srcOffsets[0].y = src.offset.y;
+	blit_region.srcOffsets[0].z = src.offset.z;
+	blit_region.srcOffsets[1].x = src.offset.x + src_size.width;
+	blit_region.srcOffsets[1].y = src.offset.y + src_size.height;
+	blit_region.srcOffsets[1].z = src.offset.z + src_size.depth;
+
+	blit_region.dstSubresource.aspectMask = dst_image_view_ptr->aspect_mask;
+	blit_region.dstSubresource.mipLevel = dst_image_view_ptr->base_mip;
+	blit_region.dstSubresource.baseArrayLayer = dst_image_view_ptr->base_layer;
+	blit_region.dstSubresource.layerCount = dst_image_view_ptr->num_layers;
+	blit_region.dstOffsets[0].x = dst.offset.x;
+	blit_region.dstOffsets[0].y = dst.offset.y;
+	blit_region.dstOffsets[0].z = dst.offset.z;
+	blit_region.dstOffsets[1].x = dst.offset.x + dst_size.width;
+	blit_region.dstOffsets[1].y = dst.offset.y + dst_size.height;
+	blit_region.dstOffsets[1].z = dst.offset.z + dst_size.depth;
+
+	device_ptr->vk.vkCmdBlitImage(command_buffer_ptr->command_buffer, src_image_view_ptr->image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, dst_image_view_ptr->image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &blit_region, vulkan_helperToFilter(filter));
 
-				build_range->primitiveCount = opal_triangles->num_vertices / 3;
+	return OPAL_SUCCESS;
+}
 
-				if (opal_triangles->index_buffer.buffer != OPAL_NULL_HANDLE)
-				{
-					const Vulkan_Buffer *index_buffer_ptr = opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)opal_triangles->index_buffer.buffer);
-					assert(index_buffer_ptr);
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdGenerateMips(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureView texture_view)
+{
+	assert(this);
+	assert(command_buffer);
 
-					triangles->indexData.deviceAddress = index_buffer_ptr->device_address + opal_triangles->index_buffer.offset;
+	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
 
-					build_range->primitiveCount = opal_triangles->num_indices / 3;
-				}
-			}
-			else if (opal_geometry->type == OPAL_ACCELERATION_STRUCTURE_GEOMETRY_TYPE_AABBS)
-			{
-				const Opal_AccelerationStructureGeometryDataAABBs *opal_aabbs = &opal_geometry->data.aabbs;
-				VkAccelerationStructureGeometryAabbsDataKHR *aabbs = &geometry->geometry.aabbs;
+	Vulkan_CommandBuffer *command_buffer_ptr = (Vulkan_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->pass == VULKAN_PASS_TYPE_COPY);
 
-				Vulkan_Buffer *entries_buffer_ptr = opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)opal_aabbs->entries_buffer.buffer);
-				assert(entries_buffer_ptr);
+	Vulkan_ImageView *image_view_ptr = (Vulkan_ImageView *)opal_poolGetElement(&device_ptr->image_views, (Opal_PoolHandle)texture_view);
+	assert(image_view_ptr);
+	assert(image_view_ptr->num_mips > 0);
 
-				aabbs->sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_AABBS_DATA_KHR;
-				aabbs->stride = opal_aabbs->stride;
-				aabbs->data.deviceAddress = entries_buffer_ptr->device_address + opal_aabbs->entries_buffer.offset;
+	// note: vkCmdBlitImage is graphics queue only
+	if (command_buffer_ptr->engine_type != OPAL_DEVICE_ENGINE_TYPE_MAIN)
+		return OPAL_NOT_SUPPORTED;
 
-				build_range->primitiveCount = opal_aabbs->num_entries;
-			}
-			else
-				assert(0);
-		}
+	// note: depth formats can't be blitted with linear filtering, color formats have to support it
+	VkFilter filter = VK_FILTER_LINEAR;
+	VkFormatFeatureFlags features = VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT | VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT;
+
+	if (image_view_ptr->aspect_mask & (VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT))
+	{
+		filter = VK_FILTER_NEAREST;
+		features = VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT;
 	}
-	else if (desc->type == OPAL_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL)
+
+	if (!vulkan_hasFormatFeatures(device_ptr, image_view_ptr->format, features))
+		return OPAL_NOT_SUPPORTED;
+
+	// note: every level is a transfer dst until it's written, then it becomes the source for the next one,
+	//       so the chain needs one barrier per level and leaves the whole view in the copy src state
+	uint32_t base_mip = image_view_ptr->base_mip;
+	uint32_t last_mip = base_mip + image_view_ptr->num_mips - 1;
+
+	for (uint32_t mip = base_mip + 1; mip <= last_mip; ++mip)
 	{
-		VkAccelerationStructureGeometryKHR *geometry = &entries[0];
-		VkAccelerationStructureBuildRangeInfoKHR *build_range = &build_ranges[0];
-		const Opal_AccelerationStructureBuildInputTopLevel *input = &desc->input.top_level;
+		vulkan_cmdMipBarrier(device_ptr, command_buffer_ptr, image_view_ptr, mip - 1);
+
+		VkImageBlit blit_region = {0};
+		blit_region.srcSubresource.aspectMask = image_view_ptr->aspect_mask;
+		blit_region.srcSubresource.mipLevel = mip - 1;
+		blit_region.srcSubresource.baseArrayLayer = image_view_ptr->base_layer;
+		blit_region.srcSubresource.layerCount = image_view_ptr->num_layers;
+		blit_region.srcOffsets[1].x = (int32_t)max(image_view_ptr->width >> (mip - 1), 1);
+		blit_region.srcOffsets[1].y = (int32_t)max(image_view_ptr->height >> (mip - 1), 1);
+		blit_region.srcOffsets[1].z = (int32_t)max(image_view_ptr->depth >> (mip - 1), 1);
+
+		blit_region.dstSubresource.aspectMask = image_view_ptr->aspect_mask;
+		blit_region.dstSubresource.mipLevel = mip;
+		blit_region.dstSubresource.baseArrayLayer = image_view_ptr->base_layer;
+		blit_region.dstSubresource.layerCount = image_view_ptr->num_layers;
+		blit_region.dstOffsets[1].x = (int32_t)max(image_view_ptr->width >> mip, 1);
+		blit_region.dstOffsets[1].y = (int32_t)max(image_view_ptr->height >> mip, 1);
+		blit_region.dstOffsets[1].z = (int32_t)max(image_view_ptr->depth >> mip, 1);
+
+		device_ptr->vk.vkCmdBlitImage(command_buffer_ptr->command_buffer, image_view_ptr->image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, image_view_ptr->image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &blit_region, filter);
+	}
 
-		Vulkan_Buffer *instances_buffer_ptr = opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)input->instance_buffer.buffer);
-		assert(instances_buffer_ptr);
+	vulkan_cmdMipBarrier(device_ptr, command_buffer_ptr, image_view_ptr, last_mip);
 
-		geometry->sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_KHR;
-		geometry->geometryType = VK_GEOMETRY_TYPE_INSTANCES_KHR;
+	return OPAL_SUCCESS;
+}
 
-		VkAccelerationStructureGeometryInstancesDataKHR *instances = &geometry->geometry.instances;
-		instances->sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_INSTANCES_DATA_KHR;
-		instances->arrayOfPointers = VK_FALSE;
-		instances->data.deviceAddress = instances_buffer_ptr->device_address + input->instance_buffer.offset;
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdEndCopyPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+	assert(command_buffer);
 
-		build_range->primitiveCount = input->num_instances;
+	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
+
+	Vulkan_CommandBuffer *command_buffer_ptr = (Vulkan_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->pass == VULKAN_PASS_TYPE_COPY);
+
+	command_buffer_ptr->pass = VULKAN_PASS_TYPE_NONE;
+
+	if (barriers != NULL)
+		vulkan_cmdPipelineBarrier(device_ptr, command_buffer_ptr, barriers);
+
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdBeginAccelerationStructurePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+{
+	assert(this);
+	assert(command_buffer);
+
+	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
+
+	Vulkan_CommandBuffer *command_buffer_ptr = (Vulkan_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->pass == VULKAN_PASS_TYPE_NONE);
+
+	if (barriers != NULL)
+		vulkan_cmdPipelineBarrier(device_ptr, command_buffer_ptr, barriers);
+
+	command_buffer_ptr->pass = VULKAN_PASS_TYPE_ACCELERATION_STRUCTURE;
+
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdAccelerationStructureBuild(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureBuildDesc *desc)
+{
+	assert(desc);
+	return vulkan_deviceCmdAccelerationStructureBuildBatch(this, command_buffer, 1, desc);
+}
+
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdAccelerationStructureBuildBatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_descs, const Opal_AccelerationStructureBuildDesc *descs)
+{
+	assert(this);
+	assert(command_buffer);
+	assert(num_descs == 0 || descs);
+
+	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
+
+	Vulkan_CommandBuffer *command_buffer_ptr = (Vulkan_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->pass == VULKAN_PASS_TYPE_ACCELERATION_STRUCTURE);
+
+	VkCommandBuffer vulkan_command_buffer = command_buffer_ptr->command_buffer;
+
+	uint32_t num_entries = 0;
+	for (uint32_t i = 0; i < num_descs; ++i)
+		num_entries += (descs[i].type == OPAL_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL) ? descs[i].input.bottom_level.num_geometries : 1;
+
+	opal_bumpReset(&device_ptr->bump);
+	uint32_t build_infos_offset = opal_bumpAlloc(&device_ptr->bump, sizeof(VkAccelerationStructureBuildGeometryInfoKHR) * num_descs);
+	uint32_t build_range_ptrs_offset = opal_bumpAlloc(&device_ptr->bump, sizeof(VkAccelerationStructureBuildRangeInfoKHR *) * num_descs);
+	uint32_t entries_offset = opal_bumpAlloc(&device_ptr->bump, sizeof(VkAccelerationStructureGeometryKHR) * num_entries);
+	uint32_t build_ranges_offset = opal_bumpAlloc(&device_ptr->bump, sizeof(VkAccelerationStructureBuildRangeInfoKHR) * num_entries);
+
+	VkAccelerationStructureBuildGeometryInfoKHR *build_infos = (VkAccelerationStructureBuildGeometryInfoKHR *)(device_ptr->bump.data + build_infos_offset);
+	memset(build_infos, 0, sizeof(VkAccelerationStructureBuildGeometryInfoKHR) * num_descs);
+
+	const VkAccelerationStructureBuildRangeInfoKHR **build_range_ptrs = (const VkAccelerationStructureBuildRangeInfoKHR **)(device_ptr->bump.data + build_range_ptrs_offset);
+
+	VkAccelerationStructureGeometryKHR *entries = (VkAccelerationStructureGeometryKHR *)(device_ptr->bump.data + entries_offset);
+	memset(entries, 0, sizeof(VkAccelerationStructureGeometryKHR) * num_entries);
+
+	VkAccelerationStructureBuildRangeInfoKHR *build_ranges = (VkAccelerationStructureBuildRangeInfoKHR *)(device_ptr->bump.data + build_ranges_offset);
+	memset(build_ranges, 0, sizeof(VkAccelerationStructureBuildRangeInfoKHR) * num_entries);
+
+	uint32_t first_entry = 0;
+	for (uint32_t i = 0; i < num_descs; ++i)
+	{
+		vulkan_fillAccelerationStructureBuild(device_ptr, &descs[i], &build_infos[i], &entries[first_entry], &build_ranges[first_entry]);
+
+		build_range_ptrs[i] = &build_ranges[first_entry];
+		first_entry += build_infos[i].geometryCount;
 	}
-	else
-		assert(0);
 
-	device_ptr->vk.vkCmdBuildAccelerationStructuresKHR(vulkan_command_buffer, 1, &build_info, &build_ranges);
+	// note: builds of a run don't touch each other's memory and go to the driver in one call,
+	//       runs are separated by a barrier on acceleration structure and scratch memory
+	uint32_t first_build = 0;
+	while (first_build < num_descs)
+	{
+		uint32_t num_builds = opal_buildBatchGetRun(&device_ptr->build_batch, num_descs - first_build, descs + first_build);
+		assert(num_builds > 0);
+
+		if (first_build > 0)
+		{
+			VkMemoryBarrier barrier = {0};
+			barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+			barrier.srcAccessMask = VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR;
+			barrier.dstAccessMask = VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR | VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR;
+
+			device_ptr->vk.vkCmdPipelineBarrier(
+				vulkan_command_buffer,
+				VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, 0,
+				1, &barrier,
+				0, NULL,
+				0, NULL
+			);
+		}
+
+		device_ptr->vk.vkCmdBuildAccelerationStructuresKHR(vulkan_command_buffer, num_builds, &build_infos[first_build], &build_range_ptrs[first_build]);
+		first_build += num_builds;
+	}
 
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdAccelerationStructureCopy(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureCopyDesc *desc)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdAccelerationStructureCopy(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureCopyDesc *desc)
 {
 	assert(this);
 	assert(command_buffer);
@@ -5262,7 +6088,99 @@ static Opal_Result vulkan_deviceCmdAccelerationStructureCopy(Opal_Device this, O
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_deviceCmdEndAccelerationStructurePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdAccelerationStructureWriteCompactedSizes(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_acceleration_structures, const Opal_AccelerationStructure *acceleration_structures, Opal_BufferView dst)
+{
+	assert(this);
+	assert(command_buffer);
+	assert(num_acceleration_structures == 0 || acceleration_structures);
+
+	Vulkan_Device *device_ptr = (Vulkan_Device *)this;
+
+	Vulkan_CommandBuffer *command_buffer_ptr = (Vulkan_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->pass == VULKAN_PASS_TYPE_ACCELERATION_STRUCTURE);
+
+	Vulkan_Buffer *buffer_ptr = (Vulkan_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)dst.buffer);
+	assert(buffer_ptr);
+
+	VkCommandBuffer vulkan_command_buffer = command_buffer_ptr->command_buffer;
+
+	// note: query pools are owned by the command buffer and reused on every recording,
+	//       another pool is added once all queries of the existing ones are taken
+	uint32_t num_queries = command_buffer_ptr->num_compacted_size_queries + num_acceleration_structures;
+	uint32_t num_pools = (num_queries + VULKAN_COMPACTED_SIZE_QUERIES_PER_POOL - 1) / VULKAN_COMPACTED_SIZE_QUERIES_PER_POOL;
+
+	if (num_pools > command_buffer_ptr->num_compacted_size_pools)
+	{
+		command_buffer_ptr->compacted_size_pools = (VkQueryPool *)realloc(command_buffer_ptr->compacted_size_pools, sizeof(VkQueryPool) * num_pools);
+		assert(command_buffer_ptr->compacted_size_pools);
+
+		VkQueryPoolCreateInfo pool_info = {0};
+		pool_info.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+		pool_info.queryType = VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR;
+		pool_info.queryCount = VULKAN_COMPACTED_SIZE_QUERIES_PER_POOL;
+
+		for (uint32_t i = command_buffer_ptr->num_compacted_size_pools; i < num_pools; ++i)
+		{
+			VkResult result = device_ptr->vk.vkCreateQueryPool(device_ptr->device, &pool_info, NULL, &command_buffer_ptr->compacted_size_pools[i]);
+			if (result != VK_SUCCESS)
+				return OPAL_VULKAN_ERROR;
+
+			command_buffer_ptr->num_compacted_size_pools++;
+		}
+	}
+
+	opal_bumpReset(&device_ptr->bump);
+	uint32_t handles_offset = opal_bumpAlloc(&device_ptr->bump, sizeof(VkAccelerationStructureKHR) * num_acceleration_structures);
+	VkAccelerationStructureKHR *handles = (VkAccelerationStructureKHR *)(device_ptr->bump.data + handles_offset);
+
+	for (uint32_t i = 0; i < num_acceleration_structures; ++i)
+	{
+		const Vulkan_AccelerationStructure *acceleration_structure_ptr = (Vulkan_AccelerationStructure *)opal_poolGetElement(&device_ptr->acceleration_structures, (Opal_PoolHandle)acceleration_structures[i]);
+		assert(acceleration_structure_ptr);
+
+		handles[i] = acceleration_structure_ptr->acceleration_structure;
+	}
+
+	// note: sizes are only known after the builds are done
+	VkMemoryBarrier barrier = {0};
+	barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+	barrier.srcAccessMask = VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR;
+	barrier.dstAccessMask = VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR;
+
+	device_ptr->vk.vkCmdPipelineBarrier(
+		vulkan_command_buffer,
+		VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, 0,
+		1, &barrier,
+		0, NULL,
+		0, NULL
+	);
+
+	uint32_t written = 0;
+	while (written < num_acceleration_structures)
+	{
+		uint32_t query = command_buffer_ptr->num_compacted_size_queries;
+		uint32_t first_query = query % VULKAN_COMPACTED_SIZE_QUERIES_PER_POOL;
+		uint32_t count = num_acceleration_structures - written;
+
+		if (count > VULKAN_COMPACTED_SIZE_QUERIES_PER_POOL - first_query)
+			count = VULKAN_COMPACTED_SIZE_QUERIES_PER_POOL - first_query;
+
+		VkQueryPool pool = command_buffer_ptr->compacted_size_pools[query / VULKAN_COMPACTED_SIZE_QUERIES_PER_POOL];
+		VkDeviceSize offset = dst.offset + sizeof(uint64_t) * written;
+
+		device_ptr->vk.vkCmdResetQueryPool(vulkan_command_buffer, pool, first_query, count);
+		device_ptr->vk.vkCmdWriteAccelerationStructuresPropertiesKHR(vulkan_command_buffer, count, &handles[written], VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR, pool, first_query);
+		device_ptr->vk.vkCmdCopyQueryPoolResults(vulkan_command_buffer, pool, first_query, count, buffer_ptr->buffer, offset, sizeof(uint64_t), VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+
+		command_buffer_ptr->num_compacted_size_queries += count;
+		written += count;
+	}
+
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result vulkan_deviceCmdEndAccelerationStructurePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -5281,6 +6199,95 @@ static Opal_Result vulkan_deviceCmdEndAccelerationStructurePass(Opal_Device this
 	return OPAL_SUCCESS;
 }
 
+/*
+ */
+static Opal_Result vulkan_notifierCreateSemaphore(void *device, uint64_t *semaphore)
+{
+	Vulkan_Device *device_ptr = (Vulkan_Device *)device;
+	assert(device_ptr);
+	assert(semaphore);
+
+	VkSemaphoreTypeCreateInfoKHR semaphore_type_info = {0};
+	semaphore_type_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR;
+	semaphore_type_info.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+
+	VkSemaphoreCreateInfo semaphore_info = {0};
+	semaphore_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+	semaphore_info.pNext = &semaphore_type_info;
+
+	VkSemaphore vulkan_semaphore = VK_NULL_HANDLE;
+
+	VkResult result = device_ptr->vk.vkCreateSemaphore(device_ptr->device, &semaphore_info, NULL, &vulkan_semaphore);
+	if (result != VK_SUCCESS)
+		return OPAL_VULKAN_ERROR;
+
+	*semaphore = (uint64_t)vulkan_semaphore;
+	return OPAL_SUCCESS;
+}
+
+static void vulkan_notifierDestroySemaphore(void *device, uint64_t semaphore)
+{
+	Vulkan_Device *device_ptr = (Vulkan_Device *)device;
+	assert(device_ptr);
+
+	device_ptr->vk.vkDestroySemaphore(device_ptr->device, (VkSemaphore)semaphore, NULL);
+}
+
+static uint64_t vulkan_notifierQuerySemaphore(void *device, uint64_t semaphore)
+{
+	Vulkan_Device *device_ptr = (Vulkan_Device *)device;
+	assert(device_ptr);
+
+	uint64_t value = 0;
+	device_ptr->vk.vkGetSemaphoreCounterValueKHR(device_ptr->device, (VkSemaphore)semaphore, &value);
+
+	return value;
+}
+
+static void vulkan_notifierSignalSemaphore(void *device, uint64_t semaphore, uint64_t value)
+{
+	Vulkan_Device *device_ptr = (Vulkan_Device *)device;
+	assert(device_ptr);
+
+	VkSemaphoreSignalInfoKHR signal_info = {0};
+	signal_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO_KHR;
+	signal_info.semaphore = (VkSemaphore)semaphore;
+	signal_info.value = value;
+
+	device_ptr->vk.vkSignalSemaphoreKHR(device_ptr->device, &signal_info);
+}
+
+static void vulkan_notifierWaitSemaphores(void *device, uint32_t num_semaphores, const uint64_t *semaphores, const uint64_t *values, Opal_Bump *scratch)
+{
+	Vulkan_Device *device_ptr = (Vulkan_Device *)device;
+	assert(device_ptr);
+	assert(scratch);
+
+	uint32_t vulkan_semaphores_offset = opal_bumpAlloc(scratch, sizeof(VkSemaphore) * num_semaphores);
+	VkSemaphore *vulkan_semaphores = (VkSemaphore *)(scratch->data + vulkan_semaphores_offset);
+
+	for (uint32_t i = 0; i < num_semaphores; ++i)
+		vulkan_semaphores[i] = (VkSemaphore)semaphores[i];
+
+	VkSemaphoreWaitInfoKHR wait_info = {0};
+	wait_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+	wait_info.flags = VK_SEMAPHORE_WAIT_ANY_BIT_KHR;
+	wait_info.semaphoreCount = num_semaphores;
+	wait_info.pSemaphores = vulkan_semaphores;
+	wait_info.pValues = values;
+
+	device_ptr->vk.vkWaitSemaphoresKHR(device_ptr->device, &wait_info, UINT64_MAX);
+}
+
+static Opal_NotifierFunctions vulkan_notifier_functions =
+{
+	vulkan_notifierCreateSemaphore,
+	vulkan_notifierDestroySemaphore,
+	vulkan_notifierQuerySemaphore,
+	vulkan_notifierSignalSemaphore,
+	vulkan_notifierWaitSemaphores,
+};
+
 /*
  */
 static Opal_DeviceTable device_vtbl =
@@ -5288,6 +6295,7 @@ static Opal_DeviceTable device_vtbl =
 	vulkan_deviceGetInfo,
 	vulkan_deviceGetQueue,
 	vulkan_deviceGetAccelerationStructurePrebuildInfo,
+	vulkan_deviceGetAccelerationStructureAddress,
 	vulkan_deviceGetSupportedSurfaceFormats,
 	vulkan_deviceGetSupportedPresentModes,
 	vulkan_deviceGetPreferredSurfaceFormat,
@@ -5311,6 +6319,12 @@ static Opal_DeviceTable device_vtbl =
 	vulkan_deviceCreateMeshletPipeline,
 	vulkan_deviceCreateComputePipeline,
 	vulkan_deviceCreateRaytracePipeline,
+	vulkan_deviceCreateGraphicsPipelines,
+	vulkan_deviceCreateComputePipelines,
+	vulkan_deviceCreateRaytracePipelines,
+	vulkan_deviceCreateGraphicsPipelinesAsync,
+	vulkan_deviceCreateComputePipelinesAsync,
+	vulkan_deviceCreateRaytracePipelinesAsync,
 	vulkan_deviceCreateSwapchain,
 
 	vulkan_deviceDestroySemaphore,
@@ -5347,11 +6361,16 @@ static Opal_DeviceTable device_vtbl =
 	vulkan_deviceQuerySemaphore,
 	vulkan_deviceSignalSemaphore,
 	vulkan_deviceWaitSemaphore,
+	vulkan_deviceWaitSemaphores,
+	vulkan_deviceRegisterSemaphoreCallback,
+	vulkan_deviceWaitPipelineTask,
 	vulkan_deviceWaitQueue,
 	vulkan_deviceWaitIdle,
 	vulkan_deviceSubmit,
 	vulkan_deviceAcquire,
 	vulkan_devicePresent,
+	vulkan_deviceWaitPresent,
+	vulkan_deviceGetSwapchainFrameTiming,
 
 	vulkan_deviceCmdSetDescriptorHeap,
 
@@ -5389,12 +6408,21 @@ static Opal_DeviceTable device_vtbl =
 	vulkan_deviceCmdCopyBufferToBuffer,
 	vulkan_deviceCmdCopyBufferToTexture,
 	vulkan_deviceCmdCopyTextureToBuffer,
+	vulkan_deviceCmdCopyBufferToTextureRegions,
+	vulkan_deviceCmdCopyTextureToBufferRegions,
 	vulkan_deviceCmdCopyTextureToTexture,
+	vulkan_deviceCmdFillBuffer,
+	vulkan_deviceCmdUpdateBuffer,
+	vulkan_deviceCmdClearTexture,
+	vulkan_deviceCmdBlitTexture,
+	vulkan_deviceCmdGenerateMips,
 	vulkan_deviceCmdEndCopyPass,
 
 	vulkan_deviceCmdBeginAccelerationStructurePass,
 	vulkan_deviceCmdAccelerationStructureBuild,
+	vulkan_deviceCmdAccelerationStructureBuildBatch,
 	vulkan_deviceCmdAccelerationStructureCopy,
+	vulkan_deviceCmdAccelerationStructureWriteCompactedSizes,
 	vulkan_deviceCmdEndAccelerationStructurePass,
 };
 
@@ -5519,6 +6547,9 @@ Opal_Result vulkan_deviceInitialize(Vulkan_Device *device_ptr, Vulkan_Instance *
 	// bump
 	opal_bumpInitialize(&device_ptr->bump, 256);
 
+	// build batch
+	opal_buildBatchInitialize(&device_ptr->build_batch);
+
 	// pools
 	opal_poolInitialize(&device_ptr->queues, sizeof(Vulkan_Queue), 32);
 	opal_poolInitialize(&device_ptr->semaphores, sizeof(Vulkan_Semaphore), 32);
@@ -5541,6 +6572,21 @@ Opal_Result vulkan_deviceInitialize(Vulkan_Device *device_ptr, Vulkan_Instance *
 	opal_poolInitialize(&device_ptr->raytrace_pipelines, sizeof(Vulkan_RaytracePipeline), 32);
 	opal_poolInitialize(&device_ptr->swapchains, sizeof(Vulkan_Swapchain), 32);
 
+	// caches
+	opal_cacheInitialize(&device_ptr->shader_cache, 64);
+	opal_cacheInitialize(&device_ptr->sampler_cache, 16);
+	opal_cacheInitialize(&device_ptr->descriptor_set_layout_cache, 16);
+	opal_cacheInitialize(&device_ptr->pipeline_layout_cache, 16);
+
+	// compiler
+	opal_compilerInitialize(&device_ptr->compiler, device_ptr, 0);
+
+	// instance packer
+	opal_instancePackerInitialize(&device_ptr->instance_packer, device_ptr, 0);
+
+	// notifier
+	opal_notifierInitialize(&device_ptr->notifier, device_ptr, &vulkan_notifier_functions);
+
 	// queues
 	const Vulkan_DeviceEnginesInfo *engines_info = &device_ptr->device_engines_info;
 
@@ -5551,6 +6597,7 @@ Opal_Result vulkan_deviceInitialize(Vulkan_Device *device_ptr, Vulkan_Instance *
 
 		Vulkan_Queue queue = {0};
 		queue.family_index = queue_family;
+		queue.engine_type = (Opal_DeviceEngineType)i;
 
 		Opal_Queue *queue_handles = (Opal_Queue *)malloc(sizeof(Opal_Queue) * queue_count);
 
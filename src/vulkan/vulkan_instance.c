@@ -34,7 +34,7 @@ static void vulkan_volkLoadInstance(VkInstance instance)
 
 /*
  */
-static Opal_Result vulkan_instanceEnumerateDevices(Opal_Instance this, uint32_t *device_count, Opal_DeviceInfo *infos)
+OPAL_BACKEND_STATIC Opal_Result vulkan_instanceEnumerateDevices(Opal_Instance this, uint32_t *device_count, Opal_DeviceInfo *infos)
 {
 	assert(this);
 	assert(device_count);
@@ -72,7 +72,7 @@ static Opal_Result vulkan_instanceEnumerateDevices(Opal_Instance this, uint32_t
 	return opal_result;
 }
 
-static Opal_Result vulkan_instanceCreateSurface(Opal_Instance this, void *handle, Opal_Surface *surface)
+OPAL_BACKEND_STATIC Opal_Result vulkan_instanceCreateSurface(Opal_Instance this, void *handle, Opal_Surface *surface)
 {
 	assert(this);
 	assert(handle);
@@ -94,7 +94,39 @@ static Opal_Result vulkan_instanceCreateSurface(Opal_Instance this, void *handle
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_instanceCreateDefaultDevice(Opal_Instance this, Opal_DeviceHint hint, Opal_Device *device)
+OPAL_BACKEND_STATIC Opal_Result vulkan_instanceCreateHeadlessSurface(Opal_Instance this, uint32_t width, uint32_t height, Opal_Surface *surface)
+{
+	assert(this);
+	assert(width > 0);
+	assert(height > 0);
+	assert(surface);
+
+	Vulkan_Instance *instance_ptr = (Vulkan_Instance *)this;
+
+	if (instance_ptr->headless_surface == VK_FALSE)
+		return OPAL_NOT_SUPPORTED;
+
+	VkInstance vulkan_instance = instance_ptr->instance;
+	VkSurfaceKHR vulkan_surface = VK_NULL_HANDLE;
+
+	VkHeadlessSurfaceCreateInfoEXT surface_info = {0};
+	surface_info.sType = VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT;
+
+	VkResult vulkan_result = vkCreateHeadlessSurfaceEXT(vulkan_instance, &surface_info, NULL, &vulkan_surface);
+	if (vulkan_result != VK_SUCCESS)
+		return OPAL_VULKAN_ERROR;
+
+	// note: headless surfaces have no current extent, swapchains take it from here instead
+	Vulkan_Surface result = {0};
+	result.surface = vulkan_surface;
+	result.extent.width = width;
+	result.extent.height = height;
+
+	*surface = (Opal_Surface)opal_poolAddElement(&instance_ptr->surfaces, &result);
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result vulkan_instanceCreateDefaultDevice(Opal_Instance this, Opal_DeviceHint hint, Opal_Device *device)
 {
 	assert(this);
 	assert(device);
@@ -152,7 +184,8 @@ static Opal_Result vulkan_instanceCreateDefaultDevice(Opal_Instance this, Opal_D
 
 	VkDevice vulkan_device = VK_NULL_HANDLE;
 	Vulkan_DeviceEnginesInfo device_engine_infos = {0};
-	opal_result = vulkan_helperCreateDevice(vulkan_physical_device, &device_engine_infos, &vulkan_device);
+	VkBool32 present_wait = VK_FALSE;
+	opal_result = vulkan_helperCreateDevice(vulkan_physical_device, &device_engine_infos, &vulkan_device, &present_wait);
 
 	if (opal_result != OPAL_SUCCESS)
 		return opal_result;
@@ -162,6 +195,7 @@ static Opal_Result vulkan_instanceCreateDefaultDevice(Opal_Instance this, Opal_D
 	assert(device_ptr);
 
 	memcpy(&device_ptr->device_engines_info, &device_engine_infos, sizeof(Vulkan_DeviceEnginesInfo));
+	device_ptr->present_wait = present_wait;
 
 	opal_result = vulkan_deviceInitialize(device_ptr, instance_ptr, vulkan_physical_device, vulkan_device);
 	if (opal_result != OPAL_SUCCESS)
@@ -174,7 +208,7 @@ static Opal_Result vulkan_instanceCreateDefaultDevice(Opal_Instance this, Opal_D
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_instanceCreateDevice(Opal_Instance this, uint32_t index, Opal_Device *device)
+OPAL_BACKEND_STATIC Opal_Result vulkan_instanceCreateDevice(Opal_Instance this, uint32_t index, Opal_Device *device)
 {
 	assert(this);
 	assert(device);
@@ -213,7 +247,8 @@ static Opal_Result vulkan_instanceCreateDevice(Opal_Instance this, uint32_t inde
 
 	VkDevice vulkan_device = VK_NULL_HANDLE;
 	Vulkan_DeviceEnginesInfo device_engine_infos = {0};
-	Opal_Result opal_result = vulkan_helperCreateDevice(vulkan_physical_device, &device_engine_infos, &vulkan_device);
+	VkBool32 present_wait = VK_FALSE;
+	Opal_Result opal_result = vulkan_helperCreateDevice(vulkan_physical_device, &device_engine_infos, &vulkan_device, &present_wait);
 
 	if (opal_result != OPAL_SUCCESS)
 		return opal_result;
@@ -223,6 +258,7 @@ static Opal_Result vulkan_instanceCreateDevice(Opal_Instance this, uint32_t inde
 	assert(device_ptr);
 
 	memcpy(&device_ptr->device_engines_info, &device_engine_infos, sizeof(Vulkan_DeviceEnginesInfo));
+	device_ptr->present_wait = present_wait;
 
 	opal_result = vulkan_deviceInitialize(device_ptr, instance_ptr, vulkan_physical_device, vulkan_device);
 	if (opal_result != OPAL_SUCCESS)
@@ -235,7 +271,7 @@ static Opal_Result vulkan_instanceCreateDevice(Opal_Instance this, uint32_t inde
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_instanceDestroySurface(Opal_Instance this, Opal_Surface surface)
+OPAL_BACKEND_STATIC Opal_Result vulkan_instanceDestroySurface(Opal_Instance this, Opal_Surface surface)
 {
 	assert(this);
 	assert(surface);
@@ -253,7 +289,7 @@ static Opal_Result vulkan_instanceDestroySurface(Opal_Instance this, Opal_Surfac
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result vulkan_instanceDestroy(Opal_Instance this)
+OPAL_BACKEND_STATIC Opal_Result vulkan_instanceDestroy(Opal_Instance this)
 {
 	assert(this);
 
@@ -283,6 +319,7 @@ static Opal_InstanceTable instance_vtbl =
 	vulkan_instanceEnumerateDevices,
 
 	vulkan_instanceCreateSurface,
+	vulkan_instanceCreateHeadlessSurface,
 	vulkan_instanceCreateDevice,
 	vulkan_instanceCreateDefaultDevice,
 
@@ -320,6 +357,33 @@ Opal_Result vulkan_opalCreateInstance(const Opal_InstanceDesc *desc, Opal_Instan
 	extensions[num_extensions++] = VK_KHR_SURFACE_EXTENSION_NAME;
 	extensions[num_extensions++] = vulkan_platformGetSurfaceExtension();
 
+	// headless surfaces are optional, servers without a display usually have them
+	VkBool32 has_headless_surface = VK_FALSE;
+
+	uint32_t num_instance_extensions = 0;
+	VkResult result = vkEnumerateInstanceExtensionProperties(NULL, &num_instance_extensions, NULL);
+	if (result != VK_SUCCESS)
+		return OPAL_VULKAN_ERROR;
+
+	VkExtensionProperties *instance_extensions = (VkExtensionProperties *)malloc(sizeof(VkExtensionProperties) * num_instance_extensions);
+	result = vkEnumerateInstanceExtensionProperties(NULL, &num_instance_extensions, instance_extensions);
+	if (result != VK_SUCCESS)
+	{
+		free(instance_extensions);
+		return OPAL_VULKAN_ERROR;
+	}
+
+	for (uint32_t i = 0; i < num_instance_extensions; ++i)
+	{
+		if (strcmp(instance_extensions[i].extensionName, VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME) == 0)
+			has_headless_surface = VK_TRUE;
+	}
+
+	free(instance_extensions);
+
+	if (has_headless_surface == VK_TRUE)
+		extensions[num_extensions++] = VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME;
+
 	info.enabledExtensionCount = num_extensions;
 	info.ppEnabledExtensionNames = extensions;
 
@@ -329,7 +393,7 @@ Opal_Result vulkan_opalCreateInstance(const Opal_InstanceDesc *desc, Opal_Instan
 		info.ppEnabledLayerNames = &validation_layer_name;
 	}
 
-	VkResult result = vkCreateInstance(&info, NULL, &vulkan_instance);
+	result = vkCreateInstance(&info, NULL, &vulkan_instance);
 	if (result != VK_SUCCESS)
 		return OPAL_VULKAN_ERROR;
 
@@ -343,6 +407,7 @@ Opal_Result vulkan_opalCreateInstance(const Opal_InstanceDesc *desc, Opal_Instan
 
 	// data
 	ptr->instance = vulkan_instance;
+	ptr->headless_surface = has_headless_surface;
 	ptr->heap_size = desc->heap_size;
 	ptr->max_heap_allocations = desc->max_heap_allocations;
 	ptr->max_heaps = desc->max_heaps;
@@ -8,8 +8,15 @@
 #include "vk_mem_alloc.h"
 #endif
 
+#include "common/batch.h"
 #include "common/bump.h"
+#include "common/cache.h"
+#include "common/compiler.h"
+#include "common/format.h"
 #include "common/heap.h"
+#include "common/instances.h"
+#include "common/notifier.h"
+#include "common/pacing.h"
 #include "common/pool.h"
 
 typedef struct VolkDeviceTable VolkDeviceTable;
@@ -106,6 +113,7 @@ typedef struct Vulkan_Instance_t
 	uint32_t max_heaps;
 	uint32_t flags;
 	VkInstance instance;
+	VkBool32 headless_surface;
 	Opal_Pool surfaces;
 } Vulkan_Instance;
 
@@ -121,8 +129,10 @@ typedef struct Vulkan_Device_t
 	VkPhysicalDeviceDescriptorBufferPropertiesEXT descriptor_buffer_properties;
 	size_t max_descriptor_size;
 	Vulkan_DeviceEnginesInfo device_engines_info;
+	VkBool32 present_wait;
 	Opal_Queue *queue_handles[OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX];
 	Opal_Bump bump;
+	Opal_BuildBatch build_batch;
 	Opal_Pool queues;
 	Opal_Pool semaphores;
 	Opal_Pool fences;
@@ -143,6 +153,13 @@ typedef struct Vulkan_Device_t
 	Opal_Pool compute_pipelines;
 	Opal_Pool raytrace_pipelines;
 	Opal_Pool swapchains;
+	Opal_Cache shader_cache;
+	Opal_Cache sampler_cache;
+	Opal_Cache descriptor_set_layout_cache;
+	Opal_Cache pipeline_layout_cache;
+	Opal_Compiler compiler;
+	Opal_Notifier notifier;
+	Opal_InstancePacker instance_packer;
 
 #ifdef OPAL_HAS_VMA
 	uint32_t use_vma;
@@ -155,6 +172,7 @@ typedef struct Vulkan_Queue_t
 {
 	VkQueue queue;
 	uint32_t family_index;
+	Opal_DeviceEngineType engine_type;
 } Vulkan_Queue;
 
 typedef struct Vulkan_Semaphore_t
@@ -248,6 +266,7 @@ typedef struct Vulkan_ShaderBindingTable_t
 typedef struct Vulkan_CommandAllocator_t
 {
 	VkCommandPool pool;
+	Opal_DeviceEngineType engine_type;
 } Vulkan_CommandAllocator;
 
 typedef struct Vulkan_CommandBuffer_t
@@ -259,6 +278,10 @@ typedef struct Vulkan_CommandBuffer_t
 	VkDeviceAddress intersection_entry;
 	Vulkan_PassType pass;
 	Opal_CommandAllocator command_allocator;
+	Opal_DeviceEngineType engine_type;
+	VkQueryPool *compacted_size_pools;
+	uint32_t num_compacted_size_pools;
+	uint32_t num_compacted_size_queries;
 } Vulkan_CommandBuffer;
 
 typedef struct Vulkan_Shader_t
@@ -330,6 +353,7 @@ typedef struct Vulkan_RaytracePipeline_t
 typedef struct Vulkan_Surface_t
 {
 	VkSurfaceKHR surface;
+	VkExtent2D extent;
 } Vulkan_Surface;
 
 typedef struct Vulkan_Swapchain_t
@@ -342,11 +366,12 @@ typedef struct Vulkan_Swapchain_t
 	uint32_t num_images;
 	uint32_t current_image;
 	uint32_t current_semaphore;
+	Opal_Pacing pacing;
 } Vulkan_Swapchain;
 
 Opal_Result vulkan_deviceInitialize(Vulkan_Device *device_ptr, Vulkan_Instance *instance_ptr, VkPhysicalDevice physical_device, VkDevice device);
 
-Opal_Result vulkan_helperCreateDevice(VkPhysicalDevice physical_device, Vulkan_DeviceEnginesInfo *info, VkDevice *device);
+Opal_Result vulkan_helperCreateDevice(VkPhysicalDevice physical_device, Vulkan_DeviceEnginesInfo *info, VkDevice *device, VkBool32 *present_wait);
 Opal_Result vulkan_helperFillDeviceInfo(VkPhysicalDevice device, Opal_DeviceInfo *info);
 Opal_Result vulkan_helperFillDeviceEnginesInfo(VkPhysicalDevice physical_device, Vulkan_DeviceEnginesInfo *info);
 Opal_Result vulkan_helperFindBestMemoryType(const VkPhysicalDeviceMemoryProperties *memory_properties, uint32_t memory_type_mask, uint32_t required_flags, uint32_t preferred_flags, uint32_t not_preferred_flags, uint32_t *memory_type);
@@ -884,8 +884,9 @@ VkAccessFlags vulkan_helperToBufferAccessMask(Opal_BufferUsageFlags usage, Opal_
 			if (usage & OPAL_BUFFER_USAGE_INDIRECT)
 				result |= VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
 
+			// note: builds read their input buffers as shader reads
 			if (usage & OPAL_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT)
-				result |= VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR;
+				result |= VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR;
 
 			if (usage & OPAL_BUFFER_USAGE_COPY_SRC)
 				result |= VK_ACCESS_TRANSFER_READ_BIT;
@@ -1137,11 +1138,12 @@ Opal_Result vulkan_helperFindBestMemoryType(const VkPhysicalDeviceMemoryProperti
 
 /*
  */
-Opal_Result vulkan_helperCreateDevice(VkPhysicalDevice physical_device, Vulkan_DeviceEnginesInfo *info, VkDevice *device)
+Opal_Result vulkan_helperCreateDevice(VkPhysicalDevice physical_device, Vulkan_DeviceEnginesInfo *info, VkDevice *device, VkBool32 *present_wait)
 {
 	assert(physical_device != VK_NULL_HANDLE);
 	assert(info);
 	assert(device);
+	assert(present_wait);
 
 	// get physical device features
 	VkPhysicalDeviceFeatures2 features = {0};
@@ -1171,6 +1173,12 @@ Opal_Result vulkan_helperCreateDevice(VkPhysicalDevice physical_device, Vulkan_D
 	VkPhysicalDeviceDescriptorBufferFeaturesEXT descriptor_buffer_features = {0};
 	descriptor_buffer_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT;
 
+	VkPhysicalDevicePresentIdFeaturesKHR present_id_features = {0};
+	present_id_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR;
+
+	VkPhysicalDevicePresentWaitFeaturesKHR present_wait_features = {0};
+	present_wait_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR;
+
 	features.pNext = &dynamic_rendering_features;
 	dynamic_rendering_features.pNext = &acceleration_structure_features;
 	acceleration_structure_features.pNext = &buffer_device_address_features;
@@ -1179,6 +1187,8 @@ Opal_Result vulkan_helperCreateDevice(VkPhysicalDevice physical_device, Vulkan_D
 	raytracing_maintenance_features.pNext = &mesh_features;
 	mesh_features.pNext = &timeline_semaphore_features;
 	timeline_semaphore_features.pNext = &descriptor_buffer_features;
+	descriptor_buffer_features.pNext = &present_id_features;
+	present_id_features.pNext = &present_wait_features;
 
 	vkGetPhysicalDeviceFeatures2(physical_device, &features);
 
@@ -1204,6 +1214,8 @@ Opal_Result vulkan_helperCreateDevice(VkPhysicalDevice physical_device, Vulkan_D
 	VkBool32 has_meshlet = VK_FALSE;
 	VkBool32 has_timeline_semaphores = VK_FALSE;
 	VkBool32 has_descriptor_buffer = VK_FALSE;
+	VkBool32 has_present_id = VK_FALSE;
+	VkBool32 has_present_wait = VK_FALSE;
 
 	for (uint32_t i = 0; i < num_device_extensions; ++i)
 	{
@@ -1232,6 +1244,12 @@ Opal_Result vulkan_helperCreateDevice(VkPhysicalDevice physical_device, Vulkan_D
 
 		if (strcmp(device_extension_name, VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME) == 0)
 			has_descriptor_buffer = descriptor_buffer_features.descriptorBuffer;
+
+		if (strcmp(device_extension_name, VK_KHR_PRESENT_ID_EXTENSION_NAME) == 0)
+			has_present_id = present_id_features.presentId;
+
+		if (strcmp(device_extension_name, VK_KHR_PRESENT_WAIT_EXTENSION_NAME) == 0)
+			has_present_wait = present_wait_features.presentWait;
 	}
 
 	free(device_extensions);
@@ -1341,6 +1359,23 @@ Opal_Result vulkan_helperCreateDevice(VkPhysicalDevice physical_device, Vulkan_D
 		paravozik->next = NULL;
 	}
 
+	// note: present wait is useless without present ids, so enable them together or not at all
+	*present_wait = has_present_id && has_present_wait;
+
+	if (*present_wait == VK_TRUE)
+	{
+		extensions[num_extensions++] = VK_KHR_PRESENT_ID_EXTENSION_NAME;
+		extensions[num_extensions++] = VK_KHR_PRESENT_WAIT_EXTENSION_NAME;
+
+		paravozik->next = &present_id_features;
+
+		paravozik = (VkParavozikKHR *)&present_id_features;
+		paravozik->next = &present_wait_features;
+
+		paravozik = (VkParavozikKHR *)&present_wait_features;
+		paravozik->next = NULL;
+	}
+
 	// get physical device queues
 	vulkan_helperFillDeviceEnginesInfo(physical_device, info);
 	VkDeviceQueueCreateInfo queue_infos[OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX];
@@ -1397,9 +1432,13 @@ Opal_Result vulkan_helperFillDeviceInfo(VkPhysicalDevice device, Opal_DeviceInfo
 	VkPhysicalDeviceMaintenance3Properties maintenance = {0};
 	maintenance.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_3_PROPERTIES;
 
+	VkPhysicalDeviceAccelerationStructurePropertiesKHR acceleration_structure_properties = {0};
+	acceleration_structure_properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_PROPERTIES_KHR;
+	acceleration_structure_properties.pNext = &maintenance;
+
 	VkPhysicalDeviceRayTracingPipelinePropertiesKHR raytracing_properties = {0};
 	raytracing_properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_PROPERTIES_KHR;
-	raytracing_properties.pNext = &maintenance;
+	raytracing_properties.pNext = &acceleration_structure_properties;
 
 	VkPhysicalDeviceProperties2 properties = {0};
 	properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
@@ -1484,7 +1523,12 @@ Opal_Result vulkan_helperFillDeviceInfo(VkPhysicalDevice device, Opal_DeviceInfo
 
 	memcpy(info->features.queue_count, &device_engines_info.queue_counts, sizeof(uint32_t) * OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX);
 
-	info->features.acceleration_structure_instance_size = sizeof(VkAccelerationStructureInstanceKHR);
+	if (has_acceleration_structure)
+	{
+		info->features.acceleration_structure_instance_size = sizeof(VkAccelerationStructureInstanceKHR);
+		info->features.acceleration_structure_instance_layout = OPAL_ACCELERATION_STRUCTURE_INSTANCE_LAYOUT_ROW_MAJOR;
+	}
+
 	info->features.tessellation_shader = (features.features.tessellationShader == VK_TRUE);
 	info->features.geometry_shader = (features.features.geometryShader == VK_TRUE);
 	info->features.compute_pipeline = 1;
@@ -1503,6 +1547,8 @@ Opal_Result vulkan_helperFillDeviceInfo(VkPhysicalDevice device, Opal_DeviceInfo
 	info->limits.max_buffer_size = maintenance.maxMemoryAllocationSize;
 	info->limits.min_uniform_buffer_offset_alignment = properties.properties.limits.minUniformBufferOffsetAlignment;
 	info->limits.min_storage_buffer_offset_alignment = properties.properties.limits.minStorageBufferOffsetAlignment;
+	info->limits.min_texture_copy_row_alignment = 1;
+	info->limits.min_texture_copy_offset_alignment = 4;
 
 	info->limits.max_descriptor_sets = properties.properties.limits.maxBoundDescriptorSets;
 	info->limits.max_uniform_buffer_binding_size = properties.properties.limits.maxUniformBufferRange;
@@ -1527,6 +1573,7 @@ Opal_Result vulkan_helperFillDeviceInfo(VkPhysicalDevice device, Opal_DeviceInfo
 
 	info->limits.max_raytrace_recursion_depth = raytracing_properties.maxRayRecursionDepth;
 	info->limits.max_raytrace_hit_attribute_size = raytracing_properties.maxRayHitAttributeSize;
+	info->limits.min_acceleration_structure_scratch_offset_alignment = acceleration_structure_properties.minAccelerationStructureScratchOffsetAlignment;
 
 	return OPAL_SUCCESS;
 }
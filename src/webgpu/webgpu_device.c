@@ -1,4 +1,5 @@
 #include "webgpu_internal.h"
+#include "common/timer.h"
 
 #include <emscripten.h>
 
@@ -64,6 +65,8 @@ static void webgpu_deviceOnSubmittedWorkDoneCallback(WGPUQueueWorkDoneStatus sta
 
 		swapchain_ptr->semaphore_value = signal_swapchains_values[i];
 	}
+
+	opal_notifierPoll(&device_ptr->notifier);
 }
 
 static void webgpu_deviceOnBufferMapCallback(WGPUBufferMapAsyncStatus status, void *userdata)
@@ -73,6 +76,37 @@ static void webgpu_deviceOnBufferMapCallback(WGPUBufferMapAsyncStatus status, vo
 
 /*
  */
+static void webgpu_fillBufferTextureCopy(const WebGPU_Buffer *buffer_ptr, const WebGPU_Texture *texture_ptr, const Opal_BufferTextureCopyRegion *region, WGPUImageCopyBuffer *buffer_info, WGPUImageCopyTexture *texture_info, WGPUExtent3D *copy_info)
+{
+	assert(buffer_ptr);
+	assert(texture_ptr);
+	assert(region);
+	assert(region->layer_count > 0);
+
+	// note: WebGPU copies one region per call, array layers ride on the z axis like 3D slices
+	buffer_info->layout.offset = region->buffer_offset;
+	buffer_info->layout.bytesPerRow = region->row_size;
+	buffer_info->layout.rowsPerImage = region->num_rows;
+	buffer_info->buffer = buffer_ptr->buffer;
+
+	texture_info->texture = texture_ptr->texture;
+	texture_info->mipLevel = region->mip;
+	texture_info->origin.x = region->texture_offset.x;
+	texture_info->origin.y = region->texture_offset.y;
+	texture_info->origin.z = region->texture_offset.z;
+	texture_info->aspect = texture_ptr->aspect;
+
+	copy_info->width = region->size.width;
+	copy_info->height = region->size.height;
+	copy_info->depthOrArrayLayers = region->size.depth;
+
+	if (texture_ptr->dimension != WGPUTextureDimension_3D)
+	{
+		texture_info->origin.z = region->base_layer;
+		copy_info->depthOrArrayLayers = region->layer_count;
+	}
+}
+
 static void webgpu_destroyQueue(WebGPU_Queue *queue_ptr)
 {
 	assert(queue_ptr);
@@ -186,7 +220,7 @@ static void webgpu_destroySwapchain(WebGPU_Swapchain *swapchain_ptr)
 
 /*
  */
-static Opal_Result webgpu_deviceGetInfo(Opal_Device this, Opal_DeviceInfo *info)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceGetInfo(Opal_Device this, Opal_DeviceInfo *info)
 {
 	assert(this);
 	assert(info);
@@ -195,7 +229,7 @@ static Opal_Result webgpu_deviceGetInfo(Opal_Device this, Opal_DeviceInfo *info)
 	return webgpu_helperFillDeviceInfo(device_ptr->adapter, info);
 }
 
-static Opal_Result webgpu_deviceGetQueue(Opal_Device this, Opal_DeviceEngineType engine_type, uint32_t index, Opal_Queue *queue)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceGetQueue(Opal_Device this, Opal_DeviceEngineType engine_type, uint32_t index, Opal_Queue *queue)
 {
 	assert(this);
 	assert(queue);
@@ -213,7 +247,7 @@ static Opal_Result webgpu_deviceGetQueue(Opal_Device this, Opal_DeviceEngineType
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceGetAccelerationStructurePrebuildInfo(Opal_Device this, const Opal_AccelerationStructureBuildDesc *desc, Opal_AccelerationStructurePrebuildInfo *info)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceGetAccelerationStructurePrebuildInfo(Opal_Device this, const Opal_AccelerationStructureBuildDesc *desc, Opal_AccelerationStructurePrebuildInfo *info)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(desc);
@@ -222,7 +256,16 @@ static Opal_Result webgpu_deviceGetAccelerationStructurePrebuildInfo(Opal_Device
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result webgpu_deviceGetSupportedSurfaceFormats(Opal_Device this, Opal_Surface surface, uint32_t *num_formats, Opal_SurfaceFormat *formats)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceGetAccelerationStructureAddress(Opal_Device this, Opal_AccelerationStructure acceleration_structure, uint64_t *address)
+{
+	OPAL_UNUSED(this);
+	OPAL_UNUSED(acceleration_structure);
+	OPAL_UNUSED(address);
+
+	return OPAL_NOT_SUPPORTED;
+}
+
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceGetSupportedSurfaceFormats(Opal_Device this, Opal_Surface surface, uint32_t *num_formats, Opal_SurfaceFormat *formats)
 {
 	assert(this);
 	assert(surface);
@@ -255,7 +298,7 @@ static Opal_Result webgpu_deviceGetSupportedSurfaceFormats(Opal_Device this, Opa
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceGetSupportedPresentModes(Opal_Device this, Opal_Surface surface, uint32_t *num_present_modes, Opal_PresentMode *present_modes)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceGetSupportedPresentModes(Opal_Device this, Opal_Surface surface, uint32_t *num_present_modes, Opal_PresentMode *present_modes)
 {
 	assert(this);
 	assert(surface);
@@ -287,7 +330,7 @@ static Opal_Result webgpu_deviceGetSupportedPresentModes(Opal_Device this, Opal_
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceGetPreferredSurfaceFormat(Opal_Device this, Opal_Surface surface, Opal_SurfaceFormat *format)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceGetPreferredSurfaceFormat(Opal_Device this, Opal_Surface surface, Opal_SurfaceFormat *format)
 {
 	assert(this);
 	assert(surface);
@@ -329,7 +372,7 @@ static Opal_Result webgpu_deviceGetPreferredSurfaceFormat(Opal_Device this, Opal
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceGetPreferredSurfacePresentMode(Opal_Device this, Opal_Surface surface, Opal_PresentMode *present_mode)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceGetPreferredSurfacePresentMode(Opal_Device this, Opal_Surface surface, Opal_PresentMode *present_mode)
 {
 	assert(this);
 	assert(surface);
@@ -372,7 +415,7 @@ static Opal_Result webgpu_deviceGetPreferredSurfacePresentMode(Opal_Device this,
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCreateSemaphore(Opal_Device this, const Opal_SemaphoreDesc *desc, Opal_Semaphore *semaphore)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCreateSemaphore(Opal_Device this, const Opal_SemaphoreDesc *desc, Opal_Semaphore *semaphore)
 {
 	assert(this);
 	assert(desc);
@@ -386,7 +429,7 @@ static Opal_Result webgpu_deviceCreateSemaphore(Opal_Device this, const Opal_Sem
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCreateFence(Opal_Device this, Opal_Fence *fence)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCreateFence(Opal_Device this, Opal_Fence *fence)
 {
 	assert(this);
 	assert(fence);
@@ -399,7 +442,7 @@ static Opal_Result webgpu_deviceCreateFence(Opal_Device this, Opal_Fence *fence)
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCreateBuffer(Opal_Device this, const Opal_BufferDesc *desc, Opal_Buffer *buffer)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCreateBuffer(Opal_Device this, const Opal_BufferDesc *desc, Opal_Buffer *buffer)
 {
 	assert(this);
 	assert(desc);
@@ -437,7 +480,7 @@ static Opal_Result webgpu_deviceCreateBuffer(Opal_Device this, const Opal_Buffer
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCreateTexture(Opal_Device this, const Opal_TextureDesc *desc, Opal_Texture *texture)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCreateTexture(Opal_Device this, const Opal_TextureDesc *desc, Opal_Texture *texture)
 {
 	assert(this);
 	assert(desc);
@@ -476,7 +519,7 @@ static Opal_Result webgpu_deviceCreateTexture(Opal_Device this, const Opal_Textu
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCreateTextureView(Opal_Device this, const Opal_TextureViewDesc *desc, Opal_TextureView *texture_view)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCreateTextureView(Opal_Device this, const Opal_TextureViewDesc *desc, Opal_TextureView *texture_view)
 {
 	assert(this);
 	assert(desc);
@@ -511,7 +554,7 @@ static Opal_Result webgpu_deviceCreateTextureView(Opal_Device this, const Opal_T
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCreateSampler(Opal_Device this, const Opal_SamplerDesc *desc, Opal_Sampler *sampler)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCreateSampler(Opal_Device this, const Opal_SamplerDesc *desc, Opal_Sampler *sampler)
 {
 	assert(this);
 	assert(desc);
@@ -520,6 +563,13 @@ static Opal_Result webgpu_deviceCreateSampler(Opal_Device this, const Opal_Sampl
 	WebGPU_Device *device_ptr = (WebGPU_Device *)this;
 	WGPUDevice webgpu_device = device_ptr->device;
 
+	Opal_Sampler cached_sampler = (Opal_Sampler)opal_cacheAcquire(&device_ptr->sampler_cache, desc, sizeof(Opal_SamplerDesc));
+	if (cached_sampler != OPAL_NULL_HANDLE)
+	{
+		*sampler = cached_sampler;
+		return OPAL_SUCCESS;
+	}
+
 	WGPUSamplerDescriptor sampler_info = {0};
 	sampler_info.addressModeU = webgpu_helperToAddressMode(desc->address_mode_u);
 	sampler_info.addressModeV = webgpu_helperToAddressMode(desc->address_mode_v);
@@ -541,10 +591,11 @@ static Opal_Result webgpu_deviceCreateSampler(Opal_Device this, const Opal_Sampl
 	result.sampler = webgpu_sampler;
 
 	*sampler = (Opal_Sampler)opal_poolAddElement(&device_ptr->samplers, &result);
+	opal_cacheInsert(&device_ptr->sampler_cache, desc, sizeof(Opal_SamplerDesc), *sampler);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCreateAccelerationStructure(Opal_Device this, const Opal_AccelerationStructureDesc *desc, Opal_AccelerationStructure *acceleration_structure)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCreateAccelerationStructure(Opal_Device this, const Opal_AccelerationStructureDesc *desc, Opal_AccelerationStructure *acceleration_structure)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(desc);
@@ -553,7 +604,7 @@ static Opal_Result webgpu_deviceCreateAccelerationStructure(Opal_Device this, co
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result webgpu_deviceCreateShaderBindingTable(Opal_Device this, Opal_RaytracePipeline pipeline, Opal_ShaderBindingTable *shader_binding_table)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCreateShaderBindingTable(Opal_Device this, Opal_RaytracePipeline pipeline, Opal_ShaderBindingTable *shader_binding_table)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(pipeline);
@@ -562,7 +613,7 @@ static Opal_Result webgpu_deviceCreateShaderBindingTable(Opal_Device this, Opal_
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result webgpu_deviceCreateCommandAllocator(Opal_Device this, Opal_Queue queue, Opal_CommandAllocator *command_allocator)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCreateCommandAllocator(Opal_Device this, Opal_Queue queue, Opal_CommandAllocator *command_allocator)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(queue);
@@ -578,7 +629,7 @@ static Opal_Result webgpu_deviceCreateCommandAllocator(Opal_Device this, Opal_Qu
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCreateCommandBuffer(Opal_Device this, Opal_CommandAllocator command_allocator, Opal_CommandBuffer *command_buffer)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCreateCommandBuffer(Opal_Device this, Opal_CommandAllocator command_allocator, Opal_CommandBuffer *command_buffer)
 {
 	assert(this);
 	assert(command_allocator);
@@ -599,7 +650,7 @@ static Opal_Result webgpu_deviceCreateCommandBuffer(Opal_Device this, Opal_Comma
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCreateShader(Opal_Device this, const Opal_ShaderDesc *desc, Opal_Shader *shader)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCreateShader(Opal_Device this, const Opal_ShaderDesc *desc, Opal_Shader *shader)
 {
 	assert(this);
 	assert(desc);
@@ -608,6 +659,16 @@ static Opal_Result webgpu_deviceCreateShader(Opal_Device this, const Opal_Shader
 	WebGPU_Device *device_ptr = (WebGPU_Device *)this;
 	WGPUDevice webgpu_device = device_ptr->device;
 
+	Opal_CacheDigest digest = {0};
+	opal_cacheDigest(&digest, (uint32_t)desc->type, desc->data, desc->size);
+
+	Opal_Shader cached_shader = (Opal_Shader)opal_cacheAcquire(&device_ptr->shader_cache, &digest, sizeof(Opal_CacheDigest));
+	if (cached_shader != OPAL_NULL_HANDLE)
+	{
+		*shader = cached_shader;
+		return OPAL_SUCCESS;
+	}
+
 	if (desc->type == OPAL_SHADER_SOURCE_TYPE_DXIL_BINARY || desc->type == OPAL_SHADER_SOURCE_TYPE_METALLIB_BINARY)
 		return OPAL_SHADER_SOURCE_NOT_SUPPORTED;
 
@@ -642,11 +703,14 @@ static Opal_Result webgpu_deviceCreateShader(Opal_Device this, const Opal_Shader
 	WebGPU_Shader result = {0};
 	result.shader = webgpu_shader;
 
+	opal_compilerPause(&device_ptr->compiler);
 	*shader = (Opal_Shader)opal_poolAddElement(&device_ptr->shaders, &result);
+	opal_compilerResume(&device_ptr->compiler);
+	opal_cacheInsert(&device_ptr->shader_cache, &digest, sizeof(Opal_CacheDigest), *shader);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCreateDescriptorHeap(Opal_Device this, const Opal_DescriptorHeapDesc *desc, Opal_DescriptorHeap *descriptor_heap)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCreateDescriptorHeap(Opal_Device this, const Opal_DescriptorHeapDesc *desc, Opal_DescriptorHeap *descriptor_heap)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(desc);
@@ -663,7 +727,7 @@ static Opal_Result webgpu_deviceCreateDescriptorHeap(Opal_Device this, const Opa
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCreateDescriptorSetLayout(Opal_Device this, uint32_t num_entries, const Opal_DescriptorSetLayoutEntry *entries, Opal_DescriptorSetLayout *descriptor_set_layout)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCreateDescriptorSetLayout(Opal_Device this, uint32_t num_entries, const Opal_DescriptorSetLayoutEntry *entries, Opal_DescriptorSetLayout *descriptor_set_layout)
 {
 	assert(this);
 	assert(num_entries == 0 || entries);
@@ -672,6 +736,15 @@ static Opal_Result webgpu_deviceCreateDescriptorSetLayout(Opal_Device this, uint
 	WebGPU_Device *device_ptr = (WebGPU_Device *)this;
 	WGPUDevice webgpu_device = device_ptr->device;
 
+	uint32_t entries_size = sizeof(Opal_DescriptorSetLayoutEntry) * num_entries;
+
+	Opal_DescriptorSetLayout cached_layout = (Opal_DescriptorSetLayout)opal_cacheAcquire(&device_ptr->descriptor_set_layout_cache, entries, entries_size);
+	if (cached_layout != OPAL_NULL_HANDLE)
+	{
+		*descriptor_set_layout = cached_layout;
+		return OPAL_SUCCESS;
+	}
+
 	WGPUBindGroupLayoutEntry *webgpu_bindings = NULL;
 
 	if (num_entries > 0)
@@ -796,11 +869,14 @@ static Opal_Result webgpu_deviceCreateDescriptorSetLayout(Opal_Device this, uint
 		layout_bindings[i].type = type;
 	}
 
+	opal_compilerPause(&device_ptr->compiler);
 	*descriptor_set_layout = (Opal_DescriptorSetLayout)opal_poolAddElement(&device_ptr->descriptor_set_layouts, &result);
+	opal_compilerResume(&device_ptr->compiler);
+	opal_cacheInsert(&device_ptr->descriptor_set_layout_cache, entries, entries_size, *descriptor_set_layout);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCreatePipelineLayout(Opal_Device this, uint32_t num_descriptor_set_layouts, const Opal_DescriptorSetLayout *descriptor_set_layouts, Opal_PipelineLayout *pipeline_layout)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCreatePipelineLayout(Opal_Device this, uint32_t num_descriptor_set_layouts, const Opal_DescriptorSetLayout *descriptor_set_layouts, Opal_PipelineLayout *pipeline_layout)
 {
 	assert(this);
 	assert(pipeline_layout);
@@ -808,6 +884,15 @@ static Opal_Result webgpu_deviceCreatePipelineLayout(Opal_Device this, uint32_t
 	WebGPU_Device *device_ptr = (WebGPU_Device *)this;
 	WGPUDevice webgpu_device = device_ptr->device;
 
+	uint32_t layouts_size = sizeof(Opal_DescriptorSetLayout) * num_descriptor_set_layouts;
+
+	Opal_PipelineLayout cached_layout = (Opal_PipelineLayout)opal_cacheAcquire(&device_ptr->pipeline_layout_cache, descriptor_set_layouts, layouts_size);
+	if (cached_layout != OPAL_NULL_HANDLE)
+	{
+		*pipeline_layout = cached_layout;
+		return OPAL_SUCCESS;
+	}
+
 	opal_bumpReset(&device_ptr->bump);
 	opal_bumpAlloc(&device_ptr->bump, sizeof(WGPUBindGroupLayout) * num_descriptor_set_layouts);
 
@@ -833,17 +918,23 @@ static Opal_Result webgpu_deviceCreatePipelineLayout(Opal_Device this, uint32_t
 	WebGPU_PipelineLayout result = {0};
 	result.layout = webgpu_pipeline_layout;
 
+	opal_compilerPause(&device_ptr->compiler);
 	*pipeline_layout = (Opal_PipelineLayout)opal_poolAddElement(&device_ptr->pipeline_layouts, &result);
+	opal_compilerResume(&device_ptr->compiler);
+	opal_cacheInsert(&device_ptr->pipeline_layout_cache, descriptor_set_layouts, layouts_size, *pipeline_layout);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCreateGraphicsPipeline(Opal_Device this, const Opal_GraphicsPipelineDesc *desc, Opal_GraphicsPipeline *pipeline)
+static Opal_Result webgpu_compileGraphicsPipeline(void *device, const void *data, Opal_Bump *bump, void *pipeline)
 {
-	assert(this);
-	assert(desc);
+	assert(device);
+	assert(data);
+	assert(bump);
 	assert(pipeline);
 
-	WebGPU_Device *device_ptr = (WebGPU_Device *)this;
+	const Opal_GraphicsPipelineDesc *desc = (const Opal_GraphicsPipelineDesc *)data;
+
+	WebGPU_Device *device_ptr = (WebGPU_Device *)device;
 	WGPUDevice webgpu_device = device_ptr->device;
 
 	WebGPU_PipelineLayout *layout_ptr = (WebGPU_PipelineLayout *)opal_poolGetElement(&device_ptr->pipeline_layouts, (Opal_PoolHandle)desc->pipeline_layout);
@@ -861,12 +952,12 @@ static Opal_Result webgpu_deviceCreateGraphicsPipeline(Opal_Device this, const O
 	for (uint32_t i = 0; i < num_vertex_streams; ++i)
 		num_total_vertex_attributes += desc->vertex_streams[i].num_vertex_attributes;
 
-	opal_bumpReset(&device_ptr->bump);
-	uint32_t buffers_offset = opal_bumpAlloc(&device_ptr->bump, sizeof(WGPUVertexBufferLayout) * num_vertex_streams);
-	uint32_t attributes_offset = opal_bumpAlloc(&device_ptr->bump, sizeof(WGPUVertexAttribute) * num_total_vertex_attributes);
+	opal_bumpReset(bump);
+	uint32_t buffers_offset = opal_bumpAlloc(bump, sizeof(WGPUVertexBufferLayout) * num_vertex_streams);
+	uint32_t attributes_offset = opal_bumpAlloc(bump, sizeof(WGPUVertexAttribute) * num_total_vertex_attributes);
 
-	WGPUVertexBufferLayout *vertex_buffers = (WGPUVertexBufferLayout *)(device_ptr->bump.data + buffers_offset);
-	WGPUVertexAttribute *vertex_attributes = (WGPUVertexAttribute *)(device_ptr->bump.data + attributes_offset);
+	WGPUVertexBufferLayout *vertex_buffers = (WGPUVertexBufferLayout *)(bump->data + buffers_offset);
+	WGPUVertexAttribute *vertex_attributes = (WGPUVertexAttribute *)(bump->data + attributes_offset);
 
 	uint32_t attribute_offset = 0;
 	for (uint32_t i = 0; i < num_vertex_streams; ++i)
@@ -973,11 +1064,28 @@ static Opal_Result webgpu_deviceCreateGraphicsPipeline(Opal_Device this, const O
 	WebGPU_GraphicsPipeline result = {0};
 	result.pipeline = webgpu_pipeline;
 
+	*(WebGPU_GraphicsPipeline *)pipeline = result;
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCreateGraphicsPipeline(Opal_Device this, const Opal_GraphicsPipelineDesc *desc, Opal_GraphicsPipeline *pipeline)
+{
+	assert(this);
+	assert(desc);
+	assert(pipeline);
+
+	WebGPU_Device *device_ptr = (WebGPU_Device *)this;
+	WebGPU_GraphicsPipeline result = {0};
+
+	Opal_Result opal_result = webgpu_compileGraphicsPipeline(device_ptr, desc, &device_ptr->bump, &result);
+	if (opal_result != OPAL_SUCCESS)
+		return opal_result;
+
 	*pipeline = (Opal_GraphicsPipeline)opal_poolAddElement(&device_ptr->graphics_pipelines, &result);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCreateMeshletPipeline(Opal_Device this, const Opal_MeshletPipelineDesc *desc, Opal_GraphicsPipeline *pipeline)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCreateMeshletPipeline(Opal_Device this, const Opal_MeshletPipelineDesc *desc, Opal_GraphicsPipeline *pipeline)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(desc);
@@ -986,13 +1094,18 @@ static Opal_Result webgpu_deviceCreateMeshletPipeline(Opal_Device this, const Op
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result webgpu_deviceCreateComputePipeline(Opal_Device this, const Opal_ComputePipelineDesc *desc, Opal_ComputePipeline *pipeline)
+static Opal_Result webgpu_compileComputePipeline(void *device, const void *data, Opal_Bump *bump, void *pipeline)
 {
-	assert(this);
-	assert(desc);
+	assert(device);
+	assert(data);
+	assert(bump);
 	assert(pipeline);
 
-	WebGPU_Device *device_ptr = (WebGPU_Device *)this;
+	OPAL_UNUSED(bump);
+
+	const Opal_ComputePipelineDesc *desc = (const Opal_ComputePipelineDesc *)data;
+
+	WebGPU_Device *device_ptr = (WebGPU_Device *)device;
 	WGPUDevice webgpu_device = device_ptr->device;
 
 	WebGPU_PipelineLayout *layout_ptr = (WebGPU_PipelineLayout *)opal_poolGetElement(&device_ptr->pipeline_layouts, (Opal_PoolHandle)desc->pipeline_layout);
@@ -1013,11 +1126,28 @@ static Opal_Result webgpu_deviceCreateComputePipeline(Opal_Device this, const Op
 	WebGPU_ComputePipeline result = {0};
 	result.pipeline = webgpu_pipeline;
 
+	*(WebGPU_ComputePipeline *)pipeline = result;
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCreateComputePipeline(Opal_Device this, const Opal_ComputePipelineDesc *desc, Opal_ComputePipeline *pipeline)
+{
+	assert(this);
+	assert(desc);
+	assert(pipeline);
+
+	WebGPU_Device *device_ptr = (WebGPU_Device *)this;
+	WebGPU_ComputePipeline result = {0};
+
+	Opal_Result opal_result = webgpu_compileComputePipeline(device_ptr, desc, &device_ptr->bump, &result);
+	if (opal_result != OPAL_SUCCESS)
+		return opal_result;
+
 	*pipeline = (Opal_ComputePipeline)opal_poolAddElement(&device_ptr->compute_pipelines, &result);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCreateRaytracePipeline(Opal_Device this, const Opal_RaytracePipelineDesc *desc, Opal_RaytracePipeline *pipeline)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCreateRaytracePipeline(Opal_Device this, const Opal_RaytracePipelineDesc *desc, Opal_RaytracePipeline *pipeline)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(desc);
@@ -1026,7 +1156,62 @@ static Opal_Result webgpu_deviceCreateRaytracePipeline(Opal_Device this, const O
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result webgpu_deviceCreateSwapchain(Opal_Device this, const Opal_SwapchainDesc *desc, Opal_Swapchain *swapchain)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCreateGraphicsPipelines(Opal_Device this, uint32_t num_pipelines, const Opal_GraphicsPipelineDesc *descs, Opal_GraphicsPipeline *pipelines)
+{
+	assert(this);
+
+	WebGPU_Device *device_ptr = (WebGPU_Device *)this;
+	return opal_compilerRun(&device_ptr->compiler, webgpu_compileGraphicsPipeline, &device_ptr->graphics_pipelines, num_pipelines, descs, sizeof(Opal_GraphicsPipelineDesc), pipelines);
+}
+
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCreateComputePipelines(Opal_Device this, uint32_t num_pipelines, const Opal_ComputePipelineDesc *descs, Opal_ComputePipeline *pipelines)
+{
+	assert(this);
+
+	WebGPU_Device *device_ptr = (WebGPU_Device *)this;
+	return opal_compilerRun(&device_ptr->compiler, webgpu_compileComputePipeline, &device_ptr->compute_pipelines, num_pipelines, descs, sizeof(Opal_ComputePipelineDesc), pipelines);
+}
+
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCreateRaytracePipelines(Opal_Device this, uint32_t num_pipelines, const Opal_RaytracePipelineDesc *descs, Opal_RaytracePipeline *pipelines)
+{
+	OPAL_UNUSED(this);
+	OPAL_UNUSED(num_pipelines);
+	OPAL_UNUSED(descs);
+	OPAL_UNUSED(pipelines);
+
+	return OPAL_NOT_SUPPORTED;
+}
+
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCreateGraphicsPipelinesAsync(Opal_Device this, uint32_t num_pipelines, const Opal_GraphicsPipelineDesc *descs, Opal_GraphicsPipeline *pipelines, Opal_PipelineTask *task)
+{
+	assert(this);
+	assert(task);
+
+	WebGPU_Device *device_ptr = (WebGPU_Device *)this;
+	return opal_compilerSubmit(&device_ptr->compiler, webgpu_compileGraphicsPipeline, &device_ptr->graphics_pipelines, num_pipelines, descs, sizeof(Opal_GraphicsPipelineDesc), pipelines, task);
+}
+
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCreateComputePipelinesAsync(Opal_Device this, uint32_t num_pipelines, const Opal_ComputePipelineDesc *descs, Opal_ComputePipeline *pipelines, Opal_PipelineTask *task)
+{
+	assert(this);
+	assert(task);
+
+	WebGPU_Device *device_ptr = (WebGPU_Device *)this;
+	return opal_compilerSubmit(&device_ptr->compiler, webgpu_compileComputePipeline, &device_ptr->compute_pipelines, num_pipelines, descs, sizeof(Opal_ComputePipelineDesc), pipelines, task);
+}
+
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCreateRaytracePipelinesAsync(Opal_Device this, uint32_t num_pipelines, const Opal_RaytracePipelineDesc *descs, Opal_RaytracePipeline *pipelines, Opal_PipelineTask *task)
+{
+	OPAL_UNUSED(this);
+	OPAL_UNUSED(num_pipelines);
+	OPAL_UNUSED(descs);
+	OPAL_UNUSED(pipelines);
+	OPAL_UNUSED(task);
+
+	return OPAL_NOT_SUPPORTED;
+}
+
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCreateSwapchain(Opal_Device this, const Opal_SwapchainDesc *desc, Opal_Swapchain *swapchain)
 {
 	assert(this);
 	assert(desc);
@@ -1081,11 +1266,14 @@ static Opal_Result webgpu_deviceCreateSwapchain(Opal_Device this, const Opal_Swa
 	result.swapchain = webgpu_swapchain;
 	result.current_texture_view = OPAL_NULL_HANDLE;
 
+	// note: the browser paces presentation to its own frame callbacks, frames in flight can't be limited
+	opal_pacingInitialize(&result.pacing, 0);
+
 	*swapchain = (Opal_Swapchain)opal_poolAddElement(&device_ptr->swapchains, &result);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceDestroySemaphore(Opal_Device this, Opal_Semaphore semaphore)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceDestroySemaphore(Opal_Device this, Opal_Semaphore semaphore)
 {
 	assert(this);
 	assert(semaphore);
@@ -1094,12 +1282,14 @@ static Opal_Result webgpu_deviceDestroySemaphore(Opal_Device this, Opal_Semaphor
 	assert(handle != OPAL_POOL_HANDLE_NULL);
 
 	WebGPU_Device *device_ptr = (WebGPU_Device *)this;
+
+	opal_notifierCancel(&device_ptr->notifier, (uint64_t)semaphore);
 	opal_poolRemoveElement(&device_ptr->semaphores, handle);
 
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceDestroyFence(Opal_Device this, Opal_Fence fence)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceDestroyFence(Opal_Device this, Opal_Fence fence)
 {
 	assert(this);
 	assert(fence);
@@ -1113,7 +1303,7 @@ static Opal_Result webgpu_deviceDestroyFence(Opal_Device this, Opal_Fence fence)
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceDestroyBuffer(Opal_Device this, Opal_Buffer buffer)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceDestroyBuffer(Opal_Device this, Opal_Buffer buffer)
 {
 	assert(this);
 	assert(buffer);
@@ -1131,7 +1321,7 @@ static Opal_Result webgpu_deviceDestroyBuffer(Opal_Device this, Opal_Buffer buff
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceDestroyTexture(Opal_Device this, Opal_Texture texture)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceDestroyTexture(Opal_Device this, Opal_Texture texture)
 {
 	assert(this);
 	assert(texture);
@@ -1149,7 +1339,7 @@ static Opal_Result webgpu_deviceDestroyTexture(Opal_Device this, Opal_Texture te
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceDestroyTextureView(Opal_Device this, Opal_TextureView texture_view)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceDestroyTextureView(Opal_Device this, Opal_TextureView texture_view)
 {
 	assert(this);
 	assert(texture_view);
@@ -1167,7 +1357,7 @@ static Opal_Result webgpu_deviceDestroyTextureView(Opal_Device this, Opal_Textur
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceDestroySampler(Opal_Device this, Opal_Sampler sampler)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceDestroySampler(Opal_Device this, Opal_Sampler sampler)
 {
 	assert(this);
 	assert(sampler);
@@ -1176,6 +1366,9 @@ static Opal_Result webgpu_deviceDestroySampler(Opal_Device this, Opal_Sampler sa
 	assert(handle != OPAL_POOL_HANDLE_NULL);
 
 	WebGPU_Device *device_ptr = (WebGPU_Device *)this;
+	if (opal_cacheRelease(&device_ptr->sampler_cache, sampler) > 0)
+		return OPAL_SUCCESS;
+
 	WebGPU_Sampler *sampler_ptr = (WebGPU_Sampler *)opal_poolGetElement(&device_ptr->samplers, handle);
 	assert(sampler_ptr);
 
@@ -1185,7 +1378,7 @@ static Opal_Result webgpu_deviceDestroySampler(Opal_Device this, Opal_Sampler sa
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceDestroyAccelerationStructure(Opal_Device this, Opal_AccelerationStructure acceleration_structure)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceDestroyAccelerationStructure(Opal_Device this, Opal_AccelerationStructure acceleration_structure)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(acceleration_structure);
@@ -1193,7 +1386,7 @@ static Opal_Result webgpu_deviceDestroyAccelerationStructure(Opal_Device this, O
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result webgpu_deviceDestroyShaderBindingTable(Opal_Device this, Opal_ShaderBindingTable shader_binding_table)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceDestroyShaderBindingTable(Opal_Device this, Opal_ShaderBindingTable shader_binding_table)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(shader_binding_table);
@@ -1201,7 +1394,7 @@ static Opal_Result webgpu_deviceDestroyShaderBindingTable(Opal_Device this, Opal
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result webgpu_deviceDestroyCommandAllocator(Opal_Device this, Opal_CommandAllocator command_allocator)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceDestroyCommandAllocator(Opal_Device this, Opal_CommandAllocator command_allocator)
 {
 	assert(this);
 	assert(command_allocator);
@@ -1215,7 +1408,7 @@ static Opal_Result webgpu_deviceDestroyCommandAllocator(Opal_Device this, Opal_C
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceDestroyCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceDestroyCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
 {
 	assert(this);
 	assert(command_buffer);
@@ -1238,7 +1431,7 @@ static Opal_Result webgpu_deviceDestroyCommandBuffer(Opal_Device this, Opal_Comm
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceDestroyShader(Opal_Device this, Opal_Shader shader)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceDestroyShader(Opal_Device this, Opal_Shader shader)
 {
 	assert(this);
 	assert(shader);
@@ -1247,6 +1440,9 @@ static Opal_Result webgpu_deviceDestroyShader(Opal_Device this, Opal_Shader shad
 	assert(handle != OPAL_POOL_HANDLE_NULL);
 
 	WebGPU_Device *device_ptr = (WebGPU_Device *)this;
+	if (opal_cacheRelease(&device_ptr->shader_cache, shader) > 0)
+		return OPAL_SUCCESS;
+
 	WebGPU_Shader *shader_ptr = (WebGPU_Shader *)opal_poolGetElement(&device_ptr->shaders, handle);
 	assert(shader_ptr);
 
@@ -1256,7 +1452,7 @@ static Opal_Result webgpu_deviceDestroyShader(Opal_Device this, Opal_Shader shad
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceDestroyDescriptorHeap(Opal_Device this, Opal_DescriptorHeap descriptor_heap)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceDestroyDescriptorHeap(Opal_Device this, Opal_DescriptorHeap descriptor_heap)
 {
 	assert(this);
 	assert(descriptor_heap);
@@ -1270,7 +1466,7 @@ static Opal_Result webgpu_deviceDestroyDescriptorHeap(Opal_Device this, Opal_Des
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceDestroyDescriptorSetLayout(Opal_Device this, Opal_DescriptorSetLayout descriptor_set_layout)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceDestroyDescriptorSetLayout(Opal_Device this, Opal_DescriptorSetLayout descriptor_set_layout)
 {
 	assert(this);
 	assert(descriptor_set_layout);
@@ -1279,6 +1475,12 @@ static Opal_Result webgpu_deviceDestroyDescriptorSetLayout(Opal_Device this, Opa
 	assert(handle != OPAL_POOL_HANDLE_NULL);
 
 	WebGPU_Device *device_ptr = (WebGPU_Device *)this;
+	if (opal_cacheRelease(&device_ptr->descriptor_set_layout_cache, descriptor_set_layout) > 0)
+		return OPAL_SUCCESS;
+
+	// note: the handle can be reused for another layout from now on
+	opal_cacheEvict(&device_ptr->pipeline_layout_cache, descriptor_set_layout);
+
 	WebGPU_DescriptorSetLayout *layout_ptr = (WebGPU_DescriptorSetLayout *)opal_poolGetElement(&device_ptr->descriptor_set_layouts, handle);
 	assert(layout_ptr);
 
@@ -1288,7 +1490,7 @@ static Opal_Result webgpu_deviceDestroyDescriptorSetLayout(Opal_Device this, Opa
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceDestroyPipelineLayout(Opal_Device this, Opal_PipelineLayout pipeline_layout)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceDestroyPipelineLayout(Opal_Device this, Opal_PipelineLayout pipeline_layout)
 {
 	assert(this);
 	assert(pipeline_layout);
@@ -1297,6 +1499,9 @@ static Opal_Result webgpu_deviceDestroyPipelineLayout(Opal_Device this, Opal_Pip
 	assert(handle != OPAL_POOL_HANDLE_NULL);
 
 	WebGPU_Device *device_ptr = (WebGPU_Device *)this;
+	if (opal_cacheRelease(&device_ptr->pipeline_layout_cache, pipeline_layout) > 0)
+		return OPAL_SUCCESS;
+
 	WebGPU_PipelineLayout *layout_ptr = (WebGPU_PipelineLayout *)opal_poolGetElement(&device_ptr->pipeline_layouts, handle);
 	assert(layout_ptr);
 
@@ -1306,7 +1511,7 @@ static Opal_Result webgpu_deviceDestroyPipelineLayout(Opal_Device this, Opal_Pip
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceDestroyGraphicsPipeline(Opal_Device this, Opal_GraphicsPipeline pipeline)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceDestroyGraphicsPipeline(Opal_Device this, Opal_GraphicsPipeline pipeline)
 {
 	assert(this);
 	assert(pipeline);
@@ -1324,7 +1529,7 @@ static Opal_Result webgpu_deviceDestroyGraphicsPipeline(Opal_Device this, Opal_G
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceDestroyComputePipeline(Opal_Device this, Opal_ComputePipeline pipeline)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceDestroyComputePipeline(Opal_Device this, Opal_ComputePipeline pipeline)
 {
 	assert(this);
 	assert(pipeline);
@@ -1342,7 +1547,7 @@ static Opal_Result webgpu_deviceDestroyComputePipeline(Opal_Device this, Opal_Co
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceDestroyRaytracePipeline(Opal_Device this, Opal_RaytracePipeline pipeline)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceDestroyRaytracePipeline(Opal_Device this, Opal_RaytracePipeline pipeline)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(pipeline);
@@ -1350,7 +1555,7 @@ static Opal_Result webgpu_deviceDestroyRaytracePipeline(Opal_Device this, Opal_R
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result webgpu_deviceDestroySwapchain(Opal_Device this, Opal_Swapchain swapchain)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceDestroySwapchain(Opal_Device this, Opal_Swapchain swapchain)
 {
 	assert(this);
 	assert(swapchain);
@@ -1368,12 +1573,20 @@ static Opal_Result webgpu_deviceDestroySwapchain(Opal_Device this, Opal_Swapchai
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceDestroy(Opal_Device this)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceDestroy(Opal_Device this)
 {
 	assert(this);
 
 	WebGPU_Device *ptr = (WebGPU_Device *)this;
 
+	opal_notifierShutdown(&ptr->notifier);
+	opal_compilerShutdown(&ptr->compiler);
+
+	opal_cacheShutdown(&ptr->pipeline_layout_cache);
+	opal_cacheShutdown(&ptr->descriptor_set_layout_cache);
+	opal_cacheShutdown(&ptr->sampler_cache);
+	opal_cacheShutdown(&ptr->shader_cache);
+
 	{
 		uint32_t head = opal_poolGetHeadIndex(&ptr->swapchains);
 		while (head != OPAL_POOL_HANDLE_NULL)
@@ -1560,7 +1773,7 @@ static Opal_Result webgpu_deviceDestroy(Opal_Device this)
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceBuildShaderBindingTable(Opal_Device this, Opal_ShaderBindingTable shader_binding_table, const Opal_ShaderBindingTableBuildDesc *desc)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceBuildShaderBindingTable(Opal_Device this, Opal_ShaderBindingTable shader_binding_table, const Opal_ShaderBindingTableBuildDesc *desc)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(shader_binding_table);
@@ -1569,7 +1782,7 @@ static Opal_Result webgpu_deviceBuildShaderBindingTable(Opal_Device this, Opal_S
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result webgpu_deviceBuildAccelerationStructureInstanceBuffer(Opal_Device this, const Opal_AccelerationStructureInstanceBufferBuildDesc *desc)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceBuildAccelerationStructureInstanceBuffer(Opal_Device this, const Opal_AccelerationStructureInstanceBufferBuildDesc *desc)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(desc);
@@ -1577,7 +1790,7 @@ static Opal_Result webgpu_deviceBuildAccelerationStructureInstanceBuffer(Opal_De
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result webgpu_deviceResetCommandAllocator(Opal_Device this, Opal_CommandAllocator command_allocator)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceResetCommandAllocator(Opal_Device this, Opal_CommandAllocator command_allocator)
 {
 	assert(this);
 	assert(command_allocator);
@@ -1595,7 +1808,7 @@ static Opal_Result webgpu_deviceResetCommandAllocator(Opal_Device this, Opal_Com
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceAllocateDescriptorSet(Opal_Device this, const Opal_DescriptorSetAllocationDesc *desc, Opal_DescriptorSet *descriptor_set)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceAllocateDescriptorSet(Opal_Device this, const Opal_DescriptorSetAllocationDesc *desc, Opal_DescriptorSet *descriptor_set)
 {
 	assert(this);
 	assert(desc);
@@ -1744,7 +1957,7 @@ static Opal_Result webgpu_deviceAllocateDescriptorSet(Opal_Device this, const Op
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceFreeDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceFreeDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set)
 {
 	assert(this);
 	assert(descriptor_set);
@@ -1773,7 +1986,7 @@ static Opal_Result webgpu_deviceFreeDescriptorSet(Opal_Device this, Opal_Descrip
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceMapBuffer(Opal_Device this, Opal_Buffer buffer, void **ptr)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceMapBuffer(Opal_Device this, Opal_Buffer buffer, void **ptr)
 {
 	assert(this);
 	assert(buffer);
@@ -1809,7 +2022,7 @@ static Opal_Result webgpu_deviceMapBuffer(Opal_Device this, Opal_Buffer buffer,
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceUnmapBuffer(Opal_Device this, Opal_Buffer buffer)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceUnmapBuffer(Opal_Device this, Opal_Buffer buffer)
 {
 	assert(this);
 	assert(buffer);
@@ -1833,7 +2046,7 @@ static Opal_Result webgpu_deviceUnmapBuffer(Opal_Device this, Opal_Buffer buffer
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceWriteBuffer(Opal_Device this, Opal_Buffer buffer, uint64_t offset, const void *data, uint64_t size)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceWriteBuffer(Opal_Device this, Opal_Buffer buffer, uint64_t offset, const void *data, uint64_t size)
 {
 	assert(this);
 	assert(buffer);
@@ -1852,7 +2065,7 @@ static Opal_Result webgpu_deviceWriteBuffer(Opal_Device this, Opal_Buffer buffer
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceUpdateDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set, uint32_t num_entries, const Opal_DescriptorSetEntry *entries)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceUpdateDescriptorSet(Opal_Device this, Opal_DescriptorSet descriptor_set, uint32_t num_entries, const Opal_DescriptorSetEntry *entries)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(descriptor_set);
@@ -1862,7 +2075,7 @@ static Opal_Result webgpu_deviceUpdateDescriptorSet(Opal_Device this, Opal_Descr
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result webgpu_deviceBeginCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceBeginCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
 {
 	assert(this);
 	assert(command_buffer);
@@ -1882,7 +2095,7 @@ static Opal_Result webgpu_deviceBeginCommandBuffer(Opal_Device this, Opal_Comman
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceEndCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceEndCommandBuffer(Opal_Device this, Opal_CommandBuffer command_buffer)
 {
 	assert(this);
 	assert(command_buffer);
@@ -1906,7 +2119,7 @@ static Opal_Result webgpu_deviceEndCommandBuffer(Opal_Device this, Opal_CommandB
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceQuerySemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t *value)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceQuerySemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t *value)
 {
 	assert(this);
 	assert(semaphore);
@@ -1920,7 +2133,7 @@ static Opal_Result webgpu_deviceQuerySemaphore(Opal_Device this, Opal_Semaphore
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceSignalSemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t value)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceSignalSemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t value)
 {
 	assert(this);
 	assert(semaphore);
@@ -1931,10 +2144,12 @@ static Opal_Result webgpu_deviceSignalSemaphore(Opal_Device this, Opal_Semaphore
 	assert(semaphore_ptr->value <= value);
 
 	semaphore_ptr->value = value;
+
+	opal_notifierPoll(&device_ptr->notifier);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceWaitSemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t value, uint64_t timeout_milliseconds)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceWaitSemaphore(Opal_Device this, Opal_Semaphore semaphore, uint64_t value, uint64_t timeout_milliseconds)
 {
 	assert(this);
 	assert(semaphore);
@@ -1956,7 +2171,57 @@ static Opal_Result webgpu_deviceWaitSemaphore(Opal_Device this, Opal_Semaphore s
 	return OPAL_WAIT_TIMEOUT;
 }
 
-static Opal_Result webgpu_deviceWaitQueue(Opal_Device this, Opal_Queue queue)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceWaitSemaphores(Opal_Device this, uint32_t num_semaphores, const Opal_Semaphore *semaphores, const uint64_t *values, uint32_t wait_any, uint64_t timeout_milliseconds)
+{
+	assert(this);
+	assert(num_semaphores > 0);
+	assert(semaphores);
+	assert(values);
+
+	WebGPU_Device *device_ptr = (WebGPU_Device *)this;
+
+	uint64_t current_timeout = timeout_milliseconds;
+	while (current_timeout-- > 0)
+	{
+		uint32_t num_signaled = 0;
+		for (uint32_t i = 0; i < num_semaphores; ++i)
+		{
+			WebGPU_Semaphore *semaphore_ptr = (WebGPU_Semaphore *)opal_poolGetElement(&device_ptr->semaphores, (Opal_PoolHandle)semaphores[i]);
+			assert(semaphore_ptr);
+
+			if (semaphore_ptr->value >= values[i])
+				num_signaled++;
+		}
+
+		if ((wait_any && num_signaled > 0) || num_signaled == num_semaphores)
+			return OPAL_SUCCESS;
+
+		emscripten_sleep(1);
+	}
+
+	return OPAL_WAIT_TIMEOUT;
+}
+
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceRegisterSemaphoreCallback(Opal_Device this, Opal_Semaphore semaphore, uint64_t value, PFN_opalSemaphoreCallback callback, void *user_data)
+{
+	assert(this);
+	assert(semaphore);
+	assert(callback);
+
+	// note: no threads on the web, semaphore values advance in queue work done callbacks which poll the notifier
+	WebGPU_Device *device_ptr = (WebGPU_Device *)this;
+	return opal_notifierRegister(&device_ptr->notifier, semaphore, (uint64_t)semaphore, value, callback, user_data);
+}
+
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceWaitPipelineTask(Opal_Device this, Opal_PipelineTask task, uint64_t timeout_milliseconds)
+{
+	assert(this);
+
+	WebGPU_Device *device_ptr = (WebGPU_Device *)this;
+	return opal_compilerWait(&device_ptr->compiler, task, timeout_milliseconds);
+}
+
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceWaitQueue(Opal_Device this, Opal_Queue queue)
 {
 	assert(this);
 	assert(queue);
@@ -1971,7 +2236,7 @@ static Opal_Result webgpu_deviceWaitQueue(Opal_Device this, Opal_Queue queue)
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceWaitIdle(Opal_Device this)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceWaitIdle(Opal_Device this)
 {
 	assert(this);
 
@@ -1981,7 +2246,7 @@ static Opal_Result webgpu_deviceWaitIdle(Opal_Device this)
 	return webgpu_deviceWaitQueue(this, device_ptr->queue);
 }
 
-static Opal_Result webgpu_deviceSubmit(Opal_Device this, Opal_Queue queue, const Opal_SubmitDesc *desc)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceSubmit(Opal_Device this, Opal_Queue queue, const Opal_SubmitDesc *desc)
 {
 	assert(this);
 	assert(queue);
@@ -2009,6 +2274,7 @@ static Opal_Result webgpu_deviceSubmit(Opal_Device this, Opal_Queue queue, const
 		assert(swapchain_ptr);
 
 		opal_ringWrite(&queue_ptr->submit_ring, &swapchain_ptr->wait_value, sizeof(uint64_t));
+		opal_pacingSubmit(&swapchain_ptr->pacing, opal_timerGetNanoseconds());
 	}
 
 	opal_bumpReset(&device_ptr->bump);
@@ -2030,7 +2296,7 @@ static Opal_Result webgpu_deviceSubmit(Opal_Device this, Opal_Queue queue, const
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceAcquire(Opal_Device this, Opal_Swapchain swapchain, Opal_TextureView *texture_view)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceAcquire(Opal_Device this, Opal_Swapchain swapchain, Opal_TextureView *texture_view)
 {
 	assert(this);
 	assert(swapchain);
@@ -2073,18 +2339,52 @@ static Opal_Result webgpu_deviceAcquire(Opal_Device this, Opal_Swapchain swapcha
 	swapchain_ptr->wait_value = swapchain_ptr->semaphore_value + 1;
 
 	*texture_view = handle;
+
+	opal_pacingAcquire(&swapchain_ptr->pacing, opal_timerGetNanoseconds());
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result webgpu_devicePresent(Opal_Device this, Opal_Swapchain swapchain)
+{
+	assert(this);
+	assert(swapchain);
+
+	WebGPU_Device *device_ptr = (WebGPU_Device *)this;
+
+	WebGPU_Swapchain *swapchain_ptr = (WebGPU_Swapchain *)opal_poolGetElement(&device_ptr->swapchains, (Opal_PoolHandle)swapchain);
+	assert(swapchain_ptr);
+
+	opal_pacingPresent(&swapchain_ptr->pacing, opal_timerGetNanoseconds());
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_devicePresent(Opal_Device this, Opal_Swapchain swapchain)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceWaitPresent(Opal_Device this, Opal_Swapchain swapchain, uint64_t frame_id, uint64_t timeout_milliseconds)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(swapchain);
+	OPAL_UNUSED(frame_id);
+	OPAL_UNUSED(timeout_milliseconds);
+
+	return OPAL_NOT_SUPPORTED;
+}
+
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceGetSwapchainFrameTiming(Opal_Device this, Opal_Swapchain swapchain, Opal_FrameTiming *timing)
+{
+	assert(this);
+	assert(swapchain);
+	assert(timing);
 
+	WebGPU_Device *device_ptr = (WebGPU_Device *)this;
+
+	WebGPU_Swapchain *swapchain_ptr = (WebGPU_Swapchain *)opal_poolGetElement(&device_ptr->swapchains, (Opal_PoolHandle)swapchain);
+	assert(swapchain_ptr);
+
+	// note: the compositor doesn't report when frames hit the screen, display time stays zero
+	opal_pacingGetTiming(&swapchain_ptr->pacing, timing);
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCmdSetDescriptorHeap(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_DescriptorHeap heap)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdSetDescriptorHeap(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_DescriptorHeap heap)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -2093,7 +2393,7 @@ static Opal_Result webgpu_deviceCmdSetDescriptorHeap(Opal_Device this, Opal_Comm
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCmdBeginGraphicsPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_FramebufferDesc *framebuffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdBeginGraphicsPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_FramebufferDesc *framebuffer, const Opal_PassBarriersDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -2175,7 +2475,7 @@ static Opal_Result webgpu_deviceCmdBeginGraphicsPass(Opal_Device this, Opal_Comm
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCmdGraphicsSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdGraphicsSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -2184,7 +2484,7 @@ static Opal_Result webgpu_deviceCmdGraphicsSetPipelineLayout(Opal_Device this, O
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCmdGraphicsSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_GraphicsPipeline pipeline)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdGraphicsSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_GraphicsPipeline pipeline)
 {
 	assert(this);
 	assert(command_buffer);
@@ -2207,7 +2507,7 @@ static Opal_Result webgpu_deviceCmdGraphicsSetPipeline(Opal_Device this, Opal_Co
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCmdGraphicsSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdGraphicsSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
 {
 	assert(this);
 	assert(command_buffer);
@@ -2231,7 +2531,7 @@ static Opal_Result webgpu_deviceCmdGraphicsSetDescriptorSet(Opal_Device this, Op
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCmdGraphicsSetVertexBuffers(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t first_index, uint32_t num_vertex_buffers, const Opal_VertexBufferView *vertex_buffers)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdGraphicsSetVertexBuffers(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t first_index, uint32_t num_vertex_buffers, const Opal_VertexBufferView *vertex_buffers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -2260,7 +2560,7 @@ static Opal_Result webgpu_deviceCmdGraphicsSetVertexBuffers(Opal_Device this, Op
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCmdGraphicsSetIndexBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_IndexBufferView index_buffer)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdGraphicsSetIndexBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_IndexBufferView index_buffer)
 {
 	assert(this);
 	assert(command_buffer);
@@ -2285,7 +2585,7 @@ static Opal_Result webgpu_deviceCmdGraphicsSetIndexBuffer(Opal_Device this, Opal
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCmdGraphicsSetViewport(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Viewport viewport)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdGraphicsSetViewport(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Viewport viewport)
 {
 	assert(this);
 	assert(command_buffer);
@@ -2304,7 +2604,7 @@ static Opal_Result webgpu_deviceCmdGraphicsSetViewport(Opal_Device this, Opal_Co
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCmdGraphicsSetScissor(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdGraphicsSetScissor(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
 {
 	assert(this);
 	assert(command_buffer);
@@ -2323,7 +2623,7 @@ static Opal_Result webgpu_deviceCmdGraphicsSetScissor(Opal_Device this, Opal_Com
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCmdGraphicsDraw(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_vertices, uint32_t num_instances, uint32_t base_vertex, uint32_t base_instance)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdGraphicsDraw(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_vertices, uint32_t num_instances, uint32_t base_vertex, uint32_t base_instance)
 {
 	assert(this);
 	assert(command_buffer);
@@ -2342,7 +2642,7 @@ static Opal_Result webgpu_deviceCmdGraphicsDraw(Opal_Device this, Opal_CommandBu
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCmdGraphicsDrawIndexed(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_indices, uint32_t num_instances, uint32_t base_index, int32_t vertex_offset, uint32_t base_instance)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdGraphicsDrawIndexed(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_indices, uint32_t num_instances, uint32_t base_index, int32_t vertex_offset, uint32_t base_instance)
 {
 	assert(this);
 	assert(command_buffer);
@@ -2361,7 +2661,7 @@ static Opal_Result webgpu_deviceCmdGraphicsDrawIndexed(Opal_Device this, Opal_Co
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCmdGraphicsMeshletDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_threadgroups_x, uint32_t num_threadgroups_y, uint32_t num_threadgroups_z)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdGraphicsMeshletDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_threadgroups_x, uint32_t num_threadgroups_y, uint32_t num_threadgroups_z)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -2372,7 +2672,7 @@ static Opal_Result webgpu_deviceCmdGraphicsMeshletDispatch(Opal_Device this, Opa
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result webgpu_deviceCmdEndGraphicsPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdEndGraphicsPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -2397,7 +2697,7 @@ static Opal_Result webgpu_deviceCmdEndGraphicsPass(Opal_Device this, Opal_Comman
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCmdBeginComputePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdBeginComputePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -2423,7 +2723,7 @@ static Opal_Result webgpu_deviceCmdBeginComputePass(Opal_Device this, Opal_Comma
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCmdComputeSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdComputeSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -2432,7 +2732,7 @@ static Opal_Result webgpu_deviceCmdComputeSetPipelineLayout(Opal_Device this, Op
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCmdComputeSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_ComputePipeline pipeline)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdComputeSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_ComputePipeline pipeline)
 {
 	assert(this);
 	assert(command_buffer);
@@ -2455,7 +2755,7 @@ static Opal_Result webgpu_deviceCmdComputeSetPipeline(Opal_Device this, Opal_Com
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCmdComputeSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdComputeSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
 {
 	assert(this);
 	assert(command_buffer);
@@ -2479,7 +2779,7 @@ static Opal_Result webgpu_deviceCmdComputeSetDescriptorSet(Opal_Device this, Opa
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCmdComputeMemoryBarrier(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_MemoryBarrierDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdComputeMemoryBarrier(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_MemoryBarrierDesc *barriers)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -2488,7 +2788,7 @@ static Opal_Result webgpu_deviceCmdComputeMemoryBarrier(Opal_Device this, Opal_C
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCmdComputeDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_threadgroups_x, uint32_t num_threadgroups_y, uint32_t num_threadgroups_z)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdComputeDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_threadgroups_x, uint32_t num_threadgroups_y, uint32_t num_threadgroups_z)
 {
 	assert(this);
 	assert(command_buffer);
@@ -2507,7 +2807,7 @@ static Opal_Result webgpu_deviceCmdComputeDispatch(Opal_Device this, Opal_Comman
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCmdEndComputePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdEndComputePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -2532,7 +2832,7 @@ static Opal_Result webgpu_deviceCmdEndComputePass(Opal_Device this, Opal_Command
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCmdBeginRaytracePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdBeginRaytracePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -2541,7 +2841,7 @@ static Opal_Result webgpu_deviceCmdBeginRaytracePass(Opal_Device this, Opal_Comm
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result webgpu_deviceCmdRaytraceSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdRaytraceSetPipelineLayout(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_PipelineLayout pipeline_layout)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -2550,7 +2850,7 @@ static Opal_Result webgpu_deviceCmdRaytraceSetPipelineLayout(Opal_Device this, O
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result webgpu_deviceCmdRaytraceSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_RaytracePipeline pipeline)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdRaytraceSetPipeline(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_RaytracePipeline pipeline)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -2559,7 +2859,7 @@ static Opal_Result webgpu_deviceCmdRaytraceSetPipeline(Opal_Device this, Opal_Co
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result webgpu_deviceCmdRaytraceSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdRaytraceSetDescriptorSet(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t index, Opal_DescriptorSet descriptor_set, uint32_t num_dynamic_offsets, const uint32_t *dynamic_offsets)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -2571,7 +2871,7 @@ static Opal_Result webgpu_deviceCmdRaytraceSetDescriptorSet(Opal_Device this, Op
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result webgpu_deviceCmdRaytraceSetShaderBindingTable(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_ShaderBindingTable shader_binding_table)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdRaytraceSetShaderBindingTable(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_ShaderBindingTable shader_binding_table)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -2580,7 +2880,7 @@ static Opal_Result webgpu_deviceCmdRaytraceSetShaderBindingTable(Opal_Device thi
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result webgpu_deviceCmdRaytraceMemoryBarrier(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_MemoryBarrierDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdRaytraceMemoryBarrier(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_MemoryBarrierDesc *barriers)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -2589,7 +2889,7 @@ static Opal_Result webgpu_deviceCmdRaytraceMemoryBarrier(Opal_Device this, Opal_
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCmdRaytraceDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t width, uint32_t height, uint32_t depth)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdRaytraceDispatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t width, uint32_t height, uint32_t depth)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -2600,7 +2900,7 @@ static Opal_Result webgpu_deviceCmdRaytraceDispatch(Opal_Device this, Opal_Comma
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result webgpu_deviceCmdEndRaytracePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdEndRaytracePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -2609,7 +2909,7 @@ static Opal_Result webgpu_deviceCmdEndRaytracePass(Opal_Device this, Opal_Comman
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result webgpu_deviceCmdBeginCopyPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdBeginCopyPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -2628,7 +2928,7 @@ static Opal_Result webgpu_deviceCmdBeginCopyPass(Opal_Device this, Opal_CommandB
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCmdCopyBufferToBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer src_buffer, uint64_t src_offset, Opal_Buffer dst_buffer, uint64_t dst_offset, uint64_t size)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdCopyBufferToBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer src_buffer, uint64_t src_offset, Opal_Buffer dst_buffer, uint64_t dst_offset, uint64_t size)
 {
 	assert(this);
 	assert(command_buffer);
@@ -2655,7 +2955,7 @@ static Opal_Result webgpu_deviceCmdCopyBufferToBuffer(Opal_Device this, Opal_Com
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCmdCopyBufferToTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_BufferTextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdCopyBufferToTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_BufferTextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size)
 {
 	assert(this);
 	assert(command_buffer);
@@ -2701,7 +3001,7 @@ static Opal_Result webgpu_deviceCmdCopyBufferToTexture(Opal_Device this, Opal_Co
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCmdCopyTextureToBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_BufferTextureRegion dst, Opal_Extent3D size)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdCopyTextureToBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_BufferTextureRegion dst, Opal_Extent3D size)
 {
 	assert(this);
 	assert(command_buffer);
@@ -2747,7 +3047,83 @@ static Opal_Result webgpu_deviceCmdCopyTextureToBuffer(Opal_Device this, Opal_Co
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCmdCopyTextureToTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdCopyBufferToTextureRegions(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer src_buffer, Opal_Texture dst_texture, uint32_t num_regions, const Opal_BufferTextureCopyRegion *regions)
+{
+	assert(this);
+	assert(command_buffer);
+	assert(src_buffer);
+	assert(dst_texture);
+	assert(num_regions == 0 || regions);
+
+	WebGPU_Device *device_ptr = (WebGPU_Device *)this;
+
+	WebGPU_CommandBuffer *command_buffer_ptr = (WebGPU_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->pass == WEBGPU_PASS_TYPE_COPY);
+	assert(command_buffer_ptr->command_encoder);
+
+	WGPUCommandEncoder webgpu_encoder = command_buffer_ptr->command_encoder;
+
+	WebGPU_Buffer *src_buffer_ptr = (WebGPU_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)src_buffer);
+	assert(src_buffer_ptr);
+
+	WebGPU_Texture *dst_texture_ptr = (WebGPU_Texture *)opal_poolGetElement(&device_ptr->textures, (Opal_PoolHandle)dst_texture);
+	assert(dst_texture_ptr);
+
+	for (uint32_t i = 0; i < num_regions; ++i)
+	{
+		const Opal_BufferTextureCopyRegion *region = &regions[i];
+
+		WGPUImageCopyBuffer src_buffer_info = {0};
+		WGPUImageCopyTexture dst_texture_info = {0};
+		WGPUExtent3D copy_info = {0};
+
+		webgpu_fillBufferTextureCopy(src_buffer_ptr, dst_texture_ptr, region, &src_buffer_info, &dst_texture_info, &copy_info);
+		wgpuCommandEncoderCopyBufferToTexture(webgpu_encoder, &src_buffer_info, &dst_texture_info, &copy_info);
+	}
+
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdCopyTextureToBufferRegions(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Texture src_texture, Opal_Buffer dst_buffer, uint32_t num_regions, const Opal_BufferTextureCopyRegion *regions)
+{
+	assert(this);
+	assert(command_buffer);
+	assert(src_texture);
+	assert(dst_buffer);
+	assert(num_regions == 0 || regions);
+
+	WebGPU_Device *device_ptr = (WebGPU_Device *)this;
+
+	WebGPU_CommandBuffer *command_buffer_ptr = (WebGPU_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->pass == WEBGPU_PASS_TYPE_COPY);
+	assert(command_buffer_ptr->command_encoder);
+
+	WGPUCommandEncoder webgpu_encoder = command_buffer_ptr->command_encoder;
+
+	WebGPU_Texture *src_texture_ptr = (WebGPU_Texture *)opal_poolGetElement(&device_ptr->textures, (Opal_PoolHandle)src_texture);
+	assert(src_texture_ptr);
+
+	WebGPU_Buffer *dst_buffer_ptr = (WebGPU_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)dst_buffer);
+	assert(dst_buffer_ptr);
+
+	for (uint32_t i = 0; i < num_regions; ++i)
+	{
+		const Opal_BufferTextureCopyRegion *region = &regions[i];
+
+		WGPUImageCopyBuffer dst_buffer_info = {0};
+		WGPUImageCopyTexture src_texture_info = {0};
+		WGPUExtent3D copy_info = {0};
+
+		webgpu_fillBufferTextureCopy(dst_buffer_ptr, src_texture_ptr, region, &dst_buffer_info, &src_texture_info, &copy_info);
+		wgpuCommandEncoderCopyTextureToBuffer(webgpu_encoder, &src_texture_info, &dst_buffer_info, &copy_info);
+	}
+
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdCopyTextureToTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_TextureRegion dst, Opal_Extent3D size)
 {
 	assert(this);
 	assert(command_buffer);
@@ -2795,7 +3171,152 @@ static Opal_Result webgpu_deviceCmdCopyTextureToTexture(Opal_Device this, Opal_C
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCmdEndCopyPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdFillBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer buffer, uint64_t offset, uint64_t size, uint32_t value)
+{
+	assert(this);
+	assert(command_buffer);
+	assert((offset & 3) == 0);
+	assert((size & 3) == 0);
+
+	WebGPU_Device *device_ptr = (WebGPU_Device *)this;
+
+	WebGPU_CommandBuffer *command_buffer_ptr = (WebGPU_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->pass == WEBGPU_PASS_TYPE_COPY);
+	assert(command_buffer_ptr->command_encoder);
+
+	WebGPU_Buffer *buffer_ptr = (WebGPU_Buffer *)opal_poolGetElement(&device_ptr->buffers, (Opal_PoolHandle)buffer);
+	assert(buffer_ptr);
+
+	// note: command encoders can only clear buffers to zero
+	if (value != 0)
+		return OPAL_NOT_SUPPORTED;
+
+	if (size == 0)
+		return OPAL_SUCCESS;
+
+	wgpuCommandEncoderClearBuffer(command_buffer_ptr->command_encoder, buffer_ptr->buffer, offset, size);
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdUpdateBuffer(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_Buffer buffer, uint64_t offset, uint64_t size, const void *data)
+{
+	OPAL_UNUSED(this);
+	OPAL_UNUSED(command_buffer);
+	OPAL_UNUSED(buffer);
+	OPAL_UNUSED(offset);
+	OPAL_UNUSED(size);
+	OPAL_UNUSED(data);
+
+	// note: queue writes are not ordered with encoded commands, so there is no inline update
+	return OPAL_NOT_SUPPORTED;
+}
+
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdClearTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureView texture_view, Opal_ClearValue clear_value)
+{
+	assert(this);
+	assert(command_buffer);
+
+	WebGPU_Device *device_ptr = (WebGPU_Device *)this;
+
+	WebGPU_CommandBuffer *command_buffer_ptr = (WebGPU_CommandBuffer *)opal_poolGetElement(&device_ptr->command_buffers, (Opal_PoolHandle)command_buffer);
+	assert(command_buffer_ptr);
+	assert(command_buffer_ptr->pass == WEBGPU_PASS_TYPE_COPY);
+	assert(command_buffer_ptr->command_encoder);
+
+	WebGPU_TextureView *texture_view_ptr = (WebGPU_TextureView *)opal_poolGetElement(&device_ptr->texture_views, (Opal_PoolHandle)texture_view);
+	assert(texture_view_ptr);
+
+	// note: copy passes are plain command encoder calls, so the clear is an empty render pass
+	//       and the view has to be a valid single layer render attachment
+	if ((wgpuTextureGetUsage(texture_view_ptr->texture) & WGPUTextureUsage_RenderAttachment) == 0)
+		return OPAL_NOT_SUPPORTED;
+
+	WGPURenderPassColorAttachment webgpu_color = {0};
+	WGPURenderPassDepthStencilAttachment webgpu_depthstencil = {0};
+	WGPURenderPassDescriptor pass_info = {0};
+
+	WGPUTextureFormat format = wgpuTextureGetFormat(texture_view_ptr->texture);
+	switch (format)
+	{
+		case WGPUTextureFormat_Depth16Unorm:
+		case WGPUTextureFormat_Depth32Float:
+		case WGPUTextureFormat_Depth24Plus:
+		{
+			webgpu_depthstencil.view = texture_view_ptr->texture_view;
+			webgpu_depthstencil.depthLoadOp = WGPULoadOp_Clear;
+			webgpu_depthstencil.depthStoreOp = WGPUStoreOp_Store;
+			webgpu_depthstencil.depthClearValue = clear_value.depth_stencil.depth;
+			pass_info.depthStencilAttachment = &webgpu_depthstencil;
+		}
+		break;
+
+		case WGPUTextureFormat_Depth24PlusStencil8:
+		case WGPUTextureFormat_Depth32FloatStencil8:
+		{
+			webgpu_depthstencil.view = texture_view_ptr->texture_view;
+			webgpu_depthstencil.depthLoadOp = WGPULoadOp_Clear;
+			webgpu_depthstencil.depthStoreOp = WGPUStoreOp_Store;
+			webgpu_depthstencil.depthClearValue = clear_value.depth_stencil.depth;
+			webgpu_depthstencil.stencilLoadOp = WGPULoadOp_Clear;
+			webgpu_depthstencil.stencilStoreOp = WGPUStoreOp_Store;
+			webgpu_depthstencil.stencilClearValue = clear_value.depth_stencil.stencil;
+			pass_info.depthStencilAttachment = &webgpu_depthstencil;
+		}
+		break;
+
+		default:
+		{
+			webgpu_color.view = texture_view_ptr->texture_view;
+			webgpu_color.depthSlice = WGPU_DEPTH_SLICE_UNDEFINED;
+			webgpu_color.loadOp = WGPULoadOp_Clear;
+			webgpu_color.storeOp = WGPUStoreOp_Store;
+			webgpu_color.clearValue.r = clear_value.color.f[0];
+			webgpu_color.clearValue.g = clear_value.color.f[1];
+			webgpu_color.clearValue.b = clear_value.color.f[2];
+			webgpu_color.clearValue.a = clear_value.color.f[3];
+			pass_info.colorAttachmentCount = 1;
+			pass_info.colorAttachments = &webgpu_color;
+		}
+		break;
+	}
+
+	WGPURenderPassEncoder pass_encoder = wgpuCommandEncoderBeginRenderPass(command_buffer_ptr->command_encoder, &pass_info);
+	if (pass_encoder == NULL)
+		return OPAL_WEBGPU_ERROR;
+
+	wgpuRenderPassEncoderEnd(pass_encoder);
+	wgpuRenderPassEncoderRelease(pass_encoder);
+
+	return OPAL_SUCCESS;
+}
+
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdBlitTexture(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureRegion src, Opal_Extent3D src_size, Opal_TextureRegion dst, Opal_Extent3D dst_size, Opal_SamplerFilterMode filter)
+{
+	assert(this);
+	assert(command_buffer);
+
+	// note: there is no scaling blit in the API, so only unscaled nearest blits are supported and they're plain copies
+	if (filter != OPAL_SAMPLER_FILTER_MODE_NEAREST)
+		return OPAL_NOT_SUPPORTED;
+
+	if (src_size.width != dst_size.width || src_size.height != dst_size.height || src_size.depth != dst_size.depth)
+		return OPAL_NOT_SUPPORTED;
+
+	return webgpu_deviceCmdCopyTextureToTexture(this, command_buffer, src, dst, src_size);
+}
+
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdGenerateMips(Opal_Device this, Opal_CommandBuffer command_buffer, Opal_TextureView texture_view)
+{
+	OPAL_UNUSED(this);
+	OPAL_UNUSED(command_buffer);
+	OPAL_UNUSED(texture_view);
+
+	// note: mips have to be downsampled with shaders, which Opal doesn't ship for this backend
+	return OPAL_NOT_SUPPORTED;
+}
+
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdEndCopyPass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	assert(this);
 	assert(command_buffer);
@@ -2814,7 +3335,7 @@ static Opal_Result webgpu_deviceCmdEndCopyPass(Opal_Device this, Opal_CommandBuf
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_deviceCmdBeginAccelerationStructurePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdBeginAccelerationStructurePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -2823,7 +3344,7 @@ static Opal_Result webgpu_deviceCmdBeginAccelerationStructurePass(Opal_Device th
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result webgpu_deviceCmdAccelerationStructureBuild(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureBuildDesc *desc)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdAccelerationStructureBuild(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureBuildDesc *desc)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -2832,7 +3353,17 @@ static Opal_Result webgpu_deviceCmdAccelerationStructureBuild(Opal_Device this,
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result webgpu_deviceCmdAccelerationStructureCopy(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureCopyDesc *desc)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdAccelerationStructureBuildBatch(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_descs, const Opal_AccelerationStructureBuildDesc *descs)
+{
+	OPAL_UNUSED(this);
+	OPAL_UNUSED(command_buffer);
+	OPAL_UNUSED(num_descs);
+	OPAL_UNUSED(descs);
+
+	return OPAL_NOT_SUPPORTED;
+}
+
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdAccelerationStructureCopy(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureCopyDesc *desc)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -2841,7 +3372,18 @@ static Opal_Result webgpu_deviceCmdAccelerationStructureCopy(Opal_Device this, O
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result webgpu_deviceCmdEndAccelerationStructurePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdAccelerationStructureWriteCompactedSizes(Opal_Device this, Opal_CommandBuffer command_buffer, uint32_t num_acceleration_structures, const Opal_AccelerationStructure *acceleration_structures, Opal_BufferView dst)
+{
+	OPAL_UNUSED(this);
+	OPAL_UNUSED(command_buffer);
+	OPAL_UNUSED(num_acceleration_structures);
+	OPAL_UNUSED(acceleration_structures);
+	OPAL_UNUSED(dst);
+
+	return OPAL_NOT_SUPPORTED;
+}
+
+OPAL_BACKEND_STATIC Opal_Result webgpu_deviceCmdEndAccelerationStructurePass(Opal_Device this, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
 {
 	OPAL_UNUSED(this);
 	OPAL_UNUSED(command_buffer);
@@ -2850,6 +3392,28 @@ static Opal_Result webgpu_deviceCmdEndAccelerationStructurePass(Opal_Device this
 	return OPAL_NOT_SUPPORTED;
 }
 
+/*
+ */
+static uint64_t webgpu_notifierQuerySemaphore(void *device, uint64_t semaphore)
+{
+	WebGPU_Device *device_ptr = (WebGPU_Device *)device;
+	assert(device_ptr);
+
+	WebGPU_Semaphore *semaphore_ptr = (WebGPU_Semaphore *)opal_poolGetElement(&device_ptr->semaphores, (Opal_PoolHandle)semaphore);
+	assert(semaphore_ptr);
+
+	return semaphore_ptr->value;
+}
+
+static Opal_NotifierFunctions webgpu_notifier_functions =
+{
+	NULL,
+	NULL,
+	webgpu_notifierQuerySemaphore,
+	NULL,
+	NULL,
+};
+
 /*
  */
 static Opal_DeviceTable device_vtbl =
@@ -2857,6 +3421,7 @@ static Opal_DeviceTable device_vtbl =
 	webgpu_deviceGetInfo,
 	webgpu_deviceGetQueue,
 	webgpu_deviceGetAccelerationStructurePrebuildInfo,
+	webgpu_deviceGetAccelerationStructureAddress,
 	webgpu_deviceGetSupportedSurfaceFormats,
 	webgpu_deviceGetSupportedPresentModes,
 	webgpu_deviceGetPreferredSurfaceFormat,
@@ -2880,6 +3445,12 @@ static Opal_DeviceTable device_vtbl =
 	webgpu_deviceCreateMeshletPipeline,
 	webgpu_deviceCreateComputePipeline,
 	webgpu_deviceCreateRaytracePipeline,
+	webgpu_deviceCreateGraphicsPipelines,
+	webgpu_deviceCreateComputePipelines,
+	webgpu_deviceCreateRaytracePipelines,
+	webgpu_deviceCreateGraphicsPipelinesAsync,
+	webgpu_deviceCreateComputePipelinesAsync,
+	webgpu_deviceCreateRaytracePipelinesAsync,
 	webgpu_deviceCreateSwapchain,
 
 	webgpu_deviceDestroySemaphore,
@@ -2916,11 +3487,16 @@ static Opal_DeviceTable device_vtbl =
 	webgpu_deviceQuerySemaphore,
 	webgpu_deviceSignalSemaphore,
 	webgpu_deviceWaitSemaphore,
+	webgpu_deviceWaitSemaphores,
+	webgpu_deviceRegisterSemaphoreCallback,
+	webgpu_deviceWaitPipelineTask,
 	webgpu_deviceWaitQueue,
 	webgpu_deviceWaitIdle,
 	webgpu_deviceSubmit,
 	webgpu_deviceAcquire,
 	webgpu_devicePresent,
+	webgpu_deviceWaitPresent,
+	webgpu_deviceGetSwapchainFrameTiming,
 
 	webgpu_deviceCmdSetDescriptorHeap,
 
@@ -2958,12 +3534,21 @@ static Opal_DeviceTable device_vtbl =
 	webgpu_deviceCmdCopyBufferToBuffer,
 	webgpu_deviceCmdCopyBufferToTexture,
 	webgpu_deviceCmdCopyTextureToBuffer,
+	webgpu_deviceCmdCopyBufferToTextureRegions,
+	webgpu_deviceCmdCopyTextureToBufferRegions,
 	webgpu_deviceCmdCopyTextureToTexture,
+	webgpu_deviceCmdFillBuffer,
+	webgpu_deviceCmdUpdateBuffer,
+	webgpu_deviceCmdClearTexture,
+	webgpu_deviceCmdBlitTexture,
+	webgpu_deviceCmdGenerateMips,
 	webgpu_deviceCmdEndCopyPass,
 
 	webgpu_deviceCmdBeginAccelerationStructurePass,
 	webgpu_deviceCmdAccelerationStructureBuild,
+	webgpu_deviceCmdAccelerationStructureBuildBatch,
 	webgpu_deviceCmdAccelerationStructureCopy,
+	webgpu_deviceCmdAccelerationStructureWriteCompactedSizes,
 	webgpu_deviceCmdEndAccelerationStructurePass,
 };
 
@@ -3007,6 +3592,18 @@ Opal_Result webgpu_deviceInitialize(WebGPU_Device *device_ptr, WebGPU_Instance *
 	opal_poolInitialize(&device_ptr->compute_pipelines, sizeof(WebGPU_ComputePipeline), 32);
 	opal_poolInitialize(&device_ptr->swapchains, sizeof(WebGPU_Swapchain), 32);
 
+	// caches
+	opal_cacheInitialize(&device_ptr->shader_cache, 64);
+	opal_cacheInitialize(&device_ptr->sampler_cache, 16);
+	opal_cacheInitialize(&device_ptr->descriptor_set_layout_cache, 16);
+	opal_cacheInitialize(&device_ptr->pipeline_layout_cache, 16);
+
+	// compiler
+	opal_compilerInitialize(&device_ptr->compiler, device_ptr, 0);
+
+	// notifier
+	opal_notifierInitialize(&device_ptr->notifier, device_ptr, &webgpu_notifier_functions);
+
 	// queues
 	{
 		WebGPU_QueueSubmitRequest *info = (WebGPU_QueueSubmitRequest *)malloc(sizeof(WebGPU_QueueSubmitRequest));
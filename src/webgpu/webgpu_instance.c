@@ -64,7 +64,7 @@ static WGPUDevice webgpu_requestDeviceSync(WGPUAdapter adapter)
 
 /*
  */
-static Opal_Result webgpu_instanceEnumerateDevices(Opal_Instance this, uint32_t *device_count, Opal_DeviceInfo *infos)
+OPAL_BACKEND_STATIC Opal_Result webgpu_instanceEnumerateDevices(Opal_Instance this, uint32_t *device_count, Opal_DeviceInfo *infos)
 {
 	assert(this);
 
@@ -74,7 +74,7 @@ static Opal_Result webgpu_instanceEnumerateDevices(Opal_Instance this, uint32_t
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result webgpu_instanceCreateSurface(Opal_Instance this, void *handle, Opal_Surface *surface)
+OPAL_BACKEND_STATIC Opal_Result webgpu_instanceCreateSurface(Opal_Instance this, void *handle, Opal_Surface *surface)
 {
 	assert(this);
 	assert(handle);
@@ -101,7 +101,17 @@ static Opal_Result webgpu_instanceCreateSurface(Opal_Instance this, void *handle
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_instanceCreateDefaultDevice(Opal_Instance this, Opal_DeviceHint hint, Opal_Device *device)
+OPAL_BACKEND_STATIC Opal_Result webgpu_instanceCreateHeadlessSurface(Opal_Instance this, uint32_t width, uint32_t height, Opal_Surface *surface)
+{
+	OPAL_UNUSED(this);
+	OPAL_UNUSED(width);
+	OPAL_UNUSED(height);
+	OPAL_UNUSED(surface);
+
+	return OPAL_NOT_SUPPORTED;
+}
+
+OPAL_BACKEND_STATIC Opal_Result webgpu_instanceCreateDefaultDevice(Opal_Instance this, Opal_DeviceHint hint, Opal_Device *device)
 {
 	assert(this);
 
@@ -152,7 +162,7 @@ static Opal_Result webgpu_instanceCreateDefaultDevice(Opal_Instance this, Opal_D
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_instanceCreateDevice(Opal_Instance this, uint32_t index, Opal_Device *device)
+OPAL_BACKEND_STATIC Opal_Result webgpu_instanceCreateDevice(Opal_Instance this, uint32_t index, Opal_Device *device)
 {
 	assert(this);
 
@@ -162,7 +172,7 @@ static Opal_Result webgpu_instanceCreateDevice(Opal_Instance this, uint32_t inde
 	return OPAL_NOT_SUPPORTED;
 }
 
-static Opal_Result webgpu_instanceDestroySurface(Opal_Instance this, Opal_Surface surface)
+OPAL_BACKEND_STATIC Opal_Result webgpu_instanceDestroySurface(Opal_Instance this, Opal_Surface surface)
 {
 	assert(this);
 	assert(surface);
@@ -180,7 +190,7 @@ static Opal_Result webgpu_instanceDestroySurface(Opal_Instance this, Opal_Surfac
 	return OPAL_SUCCESS;
 }
 
-static Opal_Result webgpu_instanceDestroy(Opal_Instance this)
+OPAL_BACKEND_STATIC Opal_Result webgpu_instanceDestroy(Opal_Instance this)
 {
 	assert(this);
 
@@ -210,6 +220,7 @@ static Opal_InstanceTable instance_vtbl =
 	webgpu_instanceEnumerateDevices,
 
 	webgpu_instanceCreateSurface,
+	webgpu_instanceCreateHeadlessSurface,
 	webgpu_instanceCreateDevice,
 	webgpu_instanceCreateDefaultDevice,
 
@@ -5,6 +5,11 @@
 #include <webgpu/webgpu.h>
 
 #include "common/bump.h"
+#include "common/cache.h"
+#include "common/compiler.h"
+#include "common/format.h"
+#include "common/notifier.h"
+#include "common/pacing.h"
 #include "common/pool.h"
 #include "common/ring.h"
 
@@ -54,6 +59,12 @@ typedef struct WebGPU_Device_t
 	Opal_Pool graphics_pipelines;
 	Opal_Pool compute_pipelines;
 	Opal_Pool swapchains;
+	Opal_Cache shader_cache;
+	Opal_Cache sampler_cache;
+	Opal_Cache descriptor_set_layout_cache;
+	Opal_Cache pipeline_layout_cache;
+	Opal_Compiler compiler;
+	Opal_Notifier notifier;
 } WebGPU_Device;
 
 typedef struct WebGPU_Surface_t
@@ -179,6 +190,7 @@ typedef struct WebGPU_Swapchain_t
 	Opal_TextureView current_texture_view;
 	uint64_t semaphore_value;
 	uint64_t wait_value;
+	Opal_Pacing pacing;
 } WebGPU_Swapchain;
 
 Opal_Result webgpu_deviceInitialize(WebGPU_Device *device_ptr, WebGPU_Instance *instance_ptr, WGPUAdapter adapter, WGPUDevice device, WGPUQueue queue);
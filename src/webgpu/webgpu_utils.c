@@ -806,6 +806,8 @@ Opal_Result webgpu_helperFillDeviceInfo(WGPUAdapter adapter, Opal_DeviceInfo *in
 	info->limits.max_buffer_size = adapter_limits.limits.maxBufferSize;
 	info->limits.min_uniform_buffer_offset_alignment = adapter_limits.limits.minUniformBufferOffsetAlignment;
 	info->limits.min_storage_buffer_offset_alignment = adapter_limits.limits.minStorageBufferOffsetAlignment;
+	info->limits.min_texture_copy_row_alignment = 256;
+	info->limits.min_texture_copy_offset_alignment = 4;
 
 	info->limits.max_descriptor_sets = adapter_limits.limits.maxBindGroups;
 	info->limits.max_uniform_buffer_binding_size = adapter_limits.limits.maxUniformBufferBindingSize;
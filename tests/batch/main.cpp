@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+extern "C"
+{
+#include "batch.h"
+}
+
+constexpr Opal_Buffer scratch_buffer = 100;
+constexpr Opal_Buffer other_scratch_buffer = 200;
+
+static Opal_AccelerationStructureBuildDesc makeBuild(Opal_AccelerationStructure dst, Opal_Buffer scratch, uint64_t offset, uint64_t size, Opal_AccelerationStructureType type = OPAL_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL)
+{
+	Opal_AccelerationStructureBuildDesc desc = {};
+	desc.type = type;
+	desc.build_mode = OPAL_ACCELERATION_STRUCTURE_BUILD_MODE_BUILD;
+	desc.dst_acceleration_structure = dst;
+	desc.scratch_buffer = {scratch, offset, size};
+
+	return desc;
+}
+
+class BuildBatchTest : public testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		Opal_Result result = opal_buildBatchInitialize(&batch);
+		ASSERT_EQ(result, OPAL_SUCCESS);
+	}
+
+	void TearDown() override
+	{
+		Opal_Result result = opal_buildBatchShutdown(&batch);
+		ASSERT_EQ(result, OPAL_SUCCESS);
+	}
+
+	std::vector<uint32_t> GetRuns(const std::vector<Opal_AccelerationStructureBuildDesc> &descs)
+	{
+		std::vector<uint32_t> runs;
+
+		uint32_t first = 0;
+		while (first < descs.size())
+		{
+			uint32_t count = opal_buildBatchGetRun(&batch, (uint32_t)descs.size() - first, descs.data() + first);
+			EXPECT_GT(count, 0u);
+			if (count == 0)
+				break;
+
+			runs.push_back(count);
+			first += count;
+		}
+
+		return runs;
+	}
+
+	Opal_BuildBatch batch;
+};
+
+TEST_F(BuildBatchTest, SubAllocatedScratch)
+{
+	std::vector<Opal_AccelerationStructureBuildDesc> descs;
+
+	for (uint64_t i = 0; i < 5000; ++i)
+		descs.push_back(makeBuild(i + 1, scratch_buffer, i * 256, 256));
+
+	EXPECT_EQ(GetRuns(descs), std::vector<uint32_t>({5000}));
+}
+
+TEST_F(BuildBatchTest, SharedScratch)
+{
+	std::vector<Opal_AccelerationStructureBuildDesc> descs;
+	descs.push_back(makeBuild(1, scratch_buffer, 0, 1024));
+	descs.push_back(makeBuild(2, scratch_buffer, 1024, 1024));
+	descs.push_back(makeBuild(3, scratch_buffer, 512, 1024));
+	descs.push_back(makeBuild(4, scratch_buffer, 2048, 512));
+
+	EXPECT_EQ(GetRuns(descs), std::vector<uint32_t>({2, 2}));
+}
+
+TEST_F(BuildBatchTest, OutOfOrderScratch)
+{
+	std::vector<Opal_AccelerationStructureBuildDesc> descs;
+	descs.push_back(makeBuild(1, scratch_buffer, 0, 256));
+	descs.push_back(makeBuild(2, scratch_buffer, 1024, 256));
+	descs.push_back(makeBuild(3, scratch_buffer, 512, 256));
+	descs.push_back(makeBuild(4, scratch_buffer, 256, 256));
+	descs.push_back(makeBuild(5, scratch_buffer, 768, 512));
+
+	EXPECT_EQ(GetRuns(descs), std::vector<uint32_t>({4, 1}));
+}
+
+TEST_F(BuildBatchTest, SeparateScratchBuffers)
+{
+	std::vector<Opal_AccelerationStructureBuildDesc> descs;
+	descs.push_back(makeBuild(1, scratch_buffer, 0, 1024));
+	descs.push_back(makeBuild(2, other_scratch_buffer, 0, 1024));
+	descs.push_back(makeBuild(3, other_scratch_buffer, 0, 0));
+
+	EXPECT_EQ(GetRuns(descs), std::vector<uint32_t>({2, 1}));
+}
+
+TEST_F(BuildBatchTest, WholeBufferScratch)
+{
+	std::vector<Opal_AccelerationStructureBuildDesc> descs;
+	descs.push_back(makeBuild(1, scratch_buffer, 0, 1024));
+	descs.push_back(makeBuild(2, scratch_buffer, 4096, 0));
+	descs.push_back(makeBuild(3, scratch_buffer, 1 << 20, 256));
+
+	EXPECT_EQ(GetRuns(descs), std::vector<uint32_t>({2, 1}));
+}
+
+TEST_F(BuildBatchTest, AccelerationStructureHazards)
+{
+	std::vector<Opal_AccelerationStructureBuildDesc> descs;
+	descs.push_back(makeBuild(1, scratch_buffer, 0, 256));
+	descs.push_back(makeBuild(1, scratch_buffer, 256, 256));
+
+	Opal_AccelerationStructureBuildDesc update = makeBuild(2, scratch_buffer, 512, 256);
+	update.build_mode = OPAL_ACCELERATION_STRUCTURE_BUILD_MODE_UPDATE;
+	update.src_acceleration_structure = 1;
+	descs.push_back(update);
+
+	// note: in-place updates only depend on builds of other runs
+	update = makeBuild(3, scratch_buffer, 768, 256);
+	update.build_mode = OPAL_ACCELERATION_STRUCTURE_BUILD_MODE_UPDATE;
+	update.src_acceleration_structure = 3;
+	descs.push_back(update);
+
+	EXPECT_EQ(GetRuns(descs), std::vector<uint32_t>({1, 1, 2}));
+}
+
+TEST_F(BuildBatchTest, RebuildUpdateSource)
+{
+	std::vector<Opal_AccelerationStructureBuildDesc> descs;
+
+	Opal_AccelerationStructureBuildDesc update = makeBuild(2, scratch_buffer, 0, 256);
+	update.build_mode = OPAL_ACCELERATION_STRUCTURE_BUILD_MODE_UPDATE;
+	update.src_acceleration_structure = 1;
+	descs.push_back(update);
+
+	// note: two updates may read the same source in one run
+	update = makeBuild(3, scratch_buffer, 256, 256);
+	update.build_mode = OPAL_ACCELERATION_STRUCTURE_BUILD_MODE_UPDATE;
+	update.src_acceleration_structure = 1;
+	descs.push_back(update);
+
+	// note: the updates above have to read the source before it's rebuilt
+	descs.push_back(makeBuild(1, scratch_buffer, 512, 256));
+	descs.push_back(makeBuild(4, scratch_buffer, 768, 256));
+
+	EXPECT_EQ(GetRuns(descs), std::vector<uint32_t>({2, 2}));
+}
+
+TEST_F(BuildBatchTest, LevelChanges)
+{
+	std::vector<Opal_AccelerationStructureBuildDesc> descs;
+	descs.push_back(makeBuild(1, scratch_buffer, 0, 256));
+	descs.push_back(makeBuild(2, scratch_buffer, 256, 256));
+	descs.push_back(makeBuild(3, scratch_buffer, 512, 256, OPAL_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL));
+	descs.push_back(makeBuild(4, scratch_buffer, 768, 256, OPAL_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL));
+	descs.push_back(makeBuild(5, scratch_buffer, 1024, 256));
+
+	EXPECT_EQ(GetRuns(descs), std::vector<uint32_t>({2, 2, 1}));
+}
+
+int main(int argc, char **argv)
+{
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
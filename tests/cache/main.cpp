@@ -0,0 +1,194 @@
+#include <gtest/gtest.h>
+
+#include <string.h>
+
+extern "C"
+{
+#include "cache.h"
+}
+
+struct TestDesc
+{
+	uint32_t filter;
+	uint32_t address_mode;
+	float min_lod;
+	float max_lod;
+};
+
+constexpr uint32_t cache_capacity = 0;
+
+class CacheTest : public testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		Opal_Result result = opal_cacheInitialize(&cache, cache_capacity);
+		ASSERT_EQ(result, OPAL_SUCCESS);
+	}
+
+	void TearDown() override
+	{
+		Opal_Result result = opal_cacheShutdown(&cache);
+		ASSERT_EQ(result, OPAL_SUCCESS);
+	}
+
+	Opal_Cache cache;
+};
+
+TEST_F(CacheTest, AcquireMissing)
+{
+	TestDesc desc = {1, 2, 0.0f, 16.0f};
+
+	EXPECT_EQ(opal_cacheAcquire(&cache, &desc, sizeof(TestDesc)), OPAL_NULL_HANDLE);
+	EXPECT_EQ(opal_cacheGetSize(&cache), 0);
+}
+
+TEST_F(CacheTest, InsertAcquire)
+{
+	TestDesc desc = {1, 2, 0.0f, 16.0f};
+	TestDesc same = desc;
+	TestDesc other = {1, 3, 0.0f, 16.0f};
+
+	EXPECT_EQ(opal_cacheInsert(&cache, &desc, sizeof(TestDesc), 42), OPAL_SUCCESS);
+	EXPECT_EQ(opal_cacheGetSize(&cache), 1);
+
+	EXPECT_EQ(opal_cacheAcquire(&cache, &same, sizeof(TestDesc)), 42);
+	EXPECT_EQ(opal_cacheAcquire(&cache, &other, sizeof(TestDesc)), OPAL_NULL_HANDLE);
+	EXPECT_EQ(opal_cacheAcquire(&cache, &desc, sizeof(uint32_t)), OPAL_NULL_HANDLE);
+}
+
+TEST_F(CacheTest, ReleaseRefcount)
+{
+	TestDesc desc = {1, 2, 0.0f, 16.0f};
+
+	EXPECT_EQ(opal_cacheInsert(&cache, &desc, sizeof(TestDesc), 7), OPAL_SUCCESS);
+	EXPECT_EQ(opal_cacheAcquire(&cache, &desc, sizeof(TestDesc)), 7);
+	EXPECT_EQ(opal_cacheAcquire(&cache, &desc, sizeof(TestDesc)), 7);
+
+	EXPECT_EQ(opal_cacheRelease(&cache, 7), 2);
+	EXPECT_EQ(opal_cacheRelease(&cache, 7), 1);
+	EXPECT_EQ(opal_cacheRelease(&cache, 7), 0);
+
+	EXPECT_EQ(opal_cacheGetSize(&cache), 0);
+	EXPECT_EQ(opal_cacheAcquire(&cache, &desc, sizeof(TestDesc)), OPAL_NULL_HANDLE);
+}
+
+TEST_F(CacheTest, ReleaseUnknown)
+{
+	EXPECT_EQ(opal_cacheRelease(&cache, 123), 0);
+}
+
+TEST_F(CacheTest, EmptyData)
+{
+	EXPECT_EQ(opal_cacheInsert(&cache, nullptr, 0, 5), OPAL_SUCCESS);
+	EXPECT_EQ(opal_cacheAcquire(&cache, nullptr, 0), 5);
+
+	EXPECT_EQ(opal_cacheRelease(&cache, 5), 1);
+	EXPECT_EQ(opal_cacheRelease(&cache, 5), 0);
+}
+
+TEST_F(CacheTest, Many)
+{
+	for (uint32_t i = 0; i < 1024; ++i)
+	{
+		TestDesc desc = {i, i * 3, 0.0f, (float)i};
+		EXPECT_EQ(opal_cacheInsert(&cache, &desc, sizeof(TestDesc), i + 1), OPAL_SUCCESS);
+	}
+
+	EXPECT_EQ(opal_cacheGetSize(&cache), 1024);
+
+	for (uint32_t i = 0; i < 1024; ++i)
+	{
+		TestDesc desc = {i, i * 3, 0.0f, (float)i};
+		EXPECT_EQ(opal_cacheAcquire(&cache, &desc, sizeof(TestDesc)), i + 1);
+	}
+
+	for (uint32_t i = 0; i < 1024; ++i)
+	{
+		EXPECT_EQ(opal_cacheRelease(&cache, i + 1), 1);
+		EXPECT_EQ(opal_cacheRelease(&cache, i + 1), 0);
+	}
+
+	EXPECT_EQ(opal_cacheGetSize(&cache), 0);
+}
+
+TEST_F(CacheTest, Digest)
+{
+	uint8_t blob[1027];
+	for (uint32_t i = 0; i < sizeof(blob); ++i)
+		blob[i] = (uint8_t)(i * 7);
+
+	Opal_CacheDigest digest = {};
+	Opal_CacheDigest same = {};
+	opal_cacheDigest(&digest, 0, blob, sizeof(blob));
+	opal_cacheDigest(&same, 0, blob, sizeof(blob));
+
+	EXPECT_EQ(memcmp(&digest, &same, sizeof(Opal_CacheDigest)), 0);
+
+	Opal_CacheDigest other_tag = {};
+	opal_cacheDigest(&other_tag, 1, blob, sizeof(blob));
+
+	EXPECT_NE(memcmp(&digest, &other_tag, sizeof(Opal_CacheDigest)), 0);
+
+	// note: last byte lives in the unaligned tail
+	blob[sizeof(blob) - 1] ^= 1;
+
+	Opal_CacheDigest other_data = {};
+	opal_cacheDigest(&other_data, 0, blob, sizeof(blob));
+
+	EXPECT_NE(memcmp(&digest, &other_data, sizeof(Opal_CacheDigest)), 0);
+
+	Opal_CacheDigest other_size = {};
+	opal_cacheDigest(&other_size, 0, blob, sizeof(blob) - 1);
+
+	EXPECT_NE(memcmp(&digest, &other_size, sizeof(Opal_CacheDigest)), 0);
+}
+
+TEST_F(CacheTest, DigestKey)
+{
+	uint32_t blob[256];
+	for (uint32_t i = 0; i < 256; ++i)
+		blob[i] = i;
+
+	Opal_CacheDigest digest = {};
+	opal_cacheDigest(&digest, 0, blob, sizeof(blob));
+
+	EXPECT_EQ(opal_cacheInsert(&cache, &digest, sizeof(Opal_CacheDigest), 42), OPAL_SUCCESS);
+
+	Opal_CacheDigest same = {};
+	opal_cacheDigest(&same, 0, blob, sizeof(blob));
+
+	EXPECT_EQ(opal_cacheAcquire(&cache, &same, sizeof(Opal_CacheDigest)), 42);
+	EXPECT_EQ(opal_cacheRelease(&cache, 42), 1);
+	EXPECT_EQ(opal_cacheRelease(&cache, 42), 0);
+}
+
+TEST_F(CacheTest, EvictHandle)
+{
+	uint64_t layouts[2] = {7, 9};
+	uint64_t other_layouts[2] = {8, 9};
+
+	ASSERT_EQ(opal_cacheInsert(&cache, layouts, sizeof(layouts), 42), OPAL_SUCCESS);
+	ASSERT_EQ(opal_cacheInsert(&cache, other_layouts, sizeof(other_layouts), 43), OPAL_SUCCESS);
+	ASSERT_EQ(opal_cacheAcquire(&cache, layouts, sizeof(layouts)), 42);
+
+	// note: handle 7 is destroyed and reused for a different layout
+	opal_cacheEvict(&cache, 7);
+
+	EXPECT_EQ(opal_cacheAcquire(&cache, layouts, sizeof(layouts)), OPAL_NULL_HANDLE);
+	EXPECT_EQ(opal_cacheInsert(&cache, layouts, sizeof(layouts), 44), OPAL_INTERNAL_ERROR);
+	EXPECT_EQ(opal_cacheAcquire(&cache, other_layouts, sizeof(other_layouts)), 43);
+
+	EXPECT_EQ(opal_cacheRelease(&cache, 42), 1);
+	EXPECT_EQ(opal_cacheRelease(&cache, 42), 0);
+	EXPECT_EQ(opal_cacheRelease(&cache, 44), 0);
+
+	EXPECT_EQ(opal_cacheInsert(&cache, layouts, sizeof(layouts), 45), OPAL_SUCCESS);
+	EXPECT_EQ(opal_cacheAcquire(&cache, layouts, sizeof(layouts)), 45);
+}
+
+int main(int argc, char **argv)
+{
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
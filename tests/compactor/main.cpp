@@ -0,0 +1,351 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <map>
+#include <set>
+#include <vector>
+
+#include <opal.h>
+
+// note: mirrors Opal_DeviceInternal, every backend device starts with its table
+struct DeviceHeader
+{
+	Opal_DeviceTable *vtbl;
+};
+
+struct Compaction
+{
+	Opal_AccelerationStructure src;
+	Opal_AccelerationStructure dst;
+};
+
+class CompactorTest : public testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		Opal_InstanceDesc instance_desc = {};
+		instance_desc.application_name = "test_compactor";
+		instance_desc.engine_name = "opal";
+
+		ASSERT_EQ(opalCreateInstance(OPAL_API_NULL, &instance_desc, &instance), OPAL_SUCCESS);
+		ASSERT_EQ(opalCreateDefaultDevice(instance, OPAL_DEVICE_HINT_DEFAULT, &device), OPAL_SUCCESS);
+		ASSERT_EQ(opalGetDeviceQueue(device, OPAL_DEVICE_ENGINE_TYPE_MAIN, 0, &queue), OPAL_SUCCESS);
+		ASSERT_EQ(opalCreateCommandAllocator(device, queue, &command_allocator), OPAL_SUCCESS);
+		ASSERT_EQ(opalCreateCommandBuffer(device, command_allocator, &command_buffer), OPAL_SUCCESS);
+
+		Opal_SemaphoreDesc semaphore_desc = {};
+		semaphore_desc.flags = OPAL_SEMAPHORE_CREATION_FLAGS_HOST_OPERATIONS;
+		ASSERT_EQ(opalCreateSemaphore(device, &semaphore_desc, &semaphore), OPAL_SUCCESS);
+
+		// note: null backends don't write compacted sizes, so the writes are intercepted to report test sizes
+		DeviceHeader *device_ptr = (DeviceHeader *)device;
+		ASSERT_EQ(opalGetDeviceTable(device, &table), OPAL_SUCCESS);
+
+		original_table = device_ptr->vtbl;
+		next_create = table.createAccelerationStructure;
+		next_destroy = table.destroyAccelerationStructure;
+		next_copy = table.cmdAccelerationStructureCopy;
+		next_write_sizes = table.cmdAccelerationStructureWriteCompactedSizes;
+		table.createAccelerationStructure = hookCreate;
+		table.destroyAccelerationStructure = hookDestroy;
+		table.cmdAccelerationStructureCopy = hookCopy;
+		table.cmdAccelerationStructureWriteCompactedSizes = hookWriteSizes;
+		device_ptr->vtbl = &table;
+
+		current = this;
+	}
+
+	void TearDown() override
+	{
+		// note: the compactor destroys the originals it still holds, the rest belongs to the test
+		if (compactor != OPAL_NULL_HANDLE)
+			opalDestroyCompactor(compactor);
+
+		std::set<Opal_AccelerationStructure> remaining = live;
+		for (Opal_AccelerationStructure acceleration_structure : remaining)
+			opalDestroyAccelerationStructure(device, acceleration_structure);
+
+		if (original_table != nullptr)
+			((DeviceHeader *)device)->vtbl = original_table;
+
+		current = nullptr;
+
+		opalDestroySemaphore(device, semaphore);
+		opalDestroyCommandBuffer(device, command_buffer);
+		opalDestroyCommandAllocator(device, command_allocator);
+		opalDestroyDevice(device);
+		opalDestroyInstance(instance);
+	}
+
+	static Opal_Result hookCreate(Opal_Device device, const Opal_AccelerationStructureDesc *desc, Opal_AccelerationStructure *acceleration_structure)
+	{
+		Opal_Result result = current->next_create(device, desc, acceleration_structure);
+		if (result == OPAL_SUCCESS)
+			current->created_sizes[*acceleration_structure] = desc->size;
+
+		return result;
+	}
+
+	static Opal_Result hookDestroy(Opal_Device device, Opal_AccelerationStructure acceleration_structure)
+	{
+		current->live.erase(acceleration_structure);
+		current->destroyed.push_back(acceleration_structure);
+
+		return current->next_destroy(device, acceleration_structure);
+	}
+
+	static Opal_Result hookCopy(Opal_Device device, Opal_CommandBuffer command_buffer, const Opal_AccelerationStructureCopyDesc *desc)
+	{
+		current->copies.push_back(*desc);
+		return current->next_copy(device, command_buffer, desc);
+	}
+
+	// note: sizes land in the readback buffer at record time, same as null buffer copies
+	static Opal_Result hookWriteSizes(Opal_Device device, Opal_CommandBuffer command_buffer, uint32_t num_acceleration_structures, const Opal_AccelerationStructure *acceleration_structures, Opal_BufferView dst)
+	{
+		Opal_Result result = current->next_write_sizes(device, command_buffer, num_acceleration_structures, acceleration_structures, dst);
+		if (result != OPAL_SUCCESS)
+			return result;
+
+		EXPECT_EQ(dst.size, sizeof(uint64_t) * num_acceleration_structures);
+
+		uint8_t *data = nullptr;
+		result = opalMapBuffer(device, dst.buffer, (void **)&data);
+		if (result != OPAL_SUCCESS)
+			return result;
+
+		for (uint32_t i = 0; i < num_acceleration_structures; ++i)
+		{
+			uint64_t size = current->reported_sizes[acceleration_structures[i]];
+			memcpy(data + dst.offset + sizeof(uint64_t) * i, &size, sizeof(uint64_t));
+		}
+
+		current->num_written_sizes += num_acceleration_structures;
+		return opalUnmapBuffer(device, dst.buffer);
+	}
+
+	static void onCompacted(void *user_data, Opal_AccelerationStructure src, Opal_AccelerationStructure dst)
+	{
+		CompactorTest *test = (CompactorTest *)user_data;
+
+		test->live.insert(dst);
+		test->compactions.push_back({src, dst});
+	}
+
+	void createCompactor(uint32_t max_pending_sizes)
+	{
+		Opal_CompactorDesc compactor_desc = {};
+		compactor_desc.max_pending_sizes = max_pending_sizes;
+		compactor_desc.type = OPAL_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL;
+
+		ASSERT_EQ(opalCreateCompactor(device, &compactor_desc, &compactor), OPAL_SUCCESS);
+	}
+
+	Opal_AccelerationStructure create(uint64_t compacted_size)
+	{
+		Opal_AccelerationStructureDesc desc = {};
+		desc.type = OPAL_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL;
+		desc.size = 4096;
+
+		Opal_AccelerationStructure acceleration_structure = OPAL_NULL_HANDLE;
+		EXPECT_EQ(opalCreateAccelerationStructure(device, &desc, &acceleration_structure), OPAL_SUCCESS);
+
+		live.insert(acceleration_structure);
+		reported_sizes[acceleration_structure] = compacted_size;
+
+		return acceleration_structure;
+	}
+
+	bool wasDestroyed(Opal_AccelerationStructure acceleration_structure) const
+	{
+		for (Opal_AccelerationStructure handle : destroyed)
+			if (handle == acceleration_structure)
+				return true;
+
+		return false;
+	}
+
+	static CompactorTest *current;
+
+	Opal_Instance instance {OPAL_NULL_HANDLE};
+	Opal_Device device {OPAL_NULL_HANDLE};
+	Opal_Queue queue {OPAL_NULL_HANDLE};
+	Opal_CommandAllocator command_allocator {OPAL_NULL_HANDLE};
+	Opal_CommandBuffer command_buffer {OPAL_NULL_HANDLE};
+	Opal_Semaphore semaphore {OPAL_NULL_HANDLE};
+	Opal_Compactor compactor {OPAL_NULL_HANDLE};
+
+	Opal_DeviceTable table {};
+	Opal_DeviceTable *original_table {nullptr};
+	PFN_opalCreateAccelerationStructure next_create {nullptr};
+	PFN_opalDestroyAccelerationStructure next_destroy {nullptr};
+	PFN_opalCmdAccelerationStructureCopy next_copy {nullptr};
+	PFN_opalCmdAccelerationStructureWriteCompactedSizes next_write_sizes {nullptr};
+
+	std::map<Opal_AccelerationStructure, uint64_t> reported_sizes;
+	std::map<Opal_AccelerationStructure, uint64_t> created_sizes;
+	std::set<Opal_AccelerationStructure> live;
+	std::vector<Opal_AccelerationStructure> destroyed;
+	std::vector<Opal_AccelerationStructureCopyDesc> copies;
+	std::vector<Compaction> compactions;
+	uint32_t num_written_sizes {0};
+};
+
+CompactorTest *CompactorTest::current = nullptr;
+
+TEST_F(CompactorTest, SizesReadBackAfterSemaphore)
+{
+	createCompactor(16);
+
+	const Opal_AccelerationStructure structures[2] = {create(256), create(512)};
+
+	ASSERT_EQ(opalCompactAccelerationStructures(compactor, command_buffer, 2, structures, onCompacted, this), OPAL_SUCCESS);
+
+	if (num_written_sizes == 0)
+		GTEST_SKIP() << "single backend builds don't dispatch through the device table";
+
+	ASSERT_EQ(opalFlushCompactions(compactor, semaphore, 1), OPAL_SUCCESS);
+
+	// note: sizes are already in the buffer, but aren't trusted until the semaphore says so
+	ASSERT_EQ(opalPollCompactions(compactor, command_buffer), OPAL_SUCCESS);
+	EXPECT_TRUE(compactions.empty());
+	EXPECT_TRUE(copies.empty());
+
+	ASSERT_EQ(opalSignalSemaphore(device, semaphore, 1), OPAL_SUCCESS);
+	ASSERT_EQ(opalPollCompactions(compactor, command_buffer), OPAL_SUCCESS);
+
+	ASSERT_EQ(compactions.size(), 2u);
+	ASSERT_EQ(copies.size(), 2u);
+
+	for (uint32_t i = 0; i < 2; ++i)
+	{
+		EXPECT_EQ(compactions[i].src, structures[i]);
+		EXPECT_NE(compactions[i].dst, OPAL_NULL_HANDLE);
+		EXPECT_NE(compactions[i].dst, structures[i]);
+		EXPECT_EQ(created_sizes[compactions[i].dst], reported_sizes[structures[i]]);
+
+		EXPECT_EQ(copies[i].copy_mode, OPAL_ACCELERATION_STRUCTURE_COPY_MODE_COMPACT);
+		EXPECT_EQ(copies[i].src_acceleration_structure, structures[i]);
+		EXPECT_EQ(copies[i].dst_acceleration_structure, compactions[i].dst);
+	}
+
+	// note: nothing left to compact, polling again doesn't repeat the callbacks
+	ASSERT_EQ(opalPollCompactions(compactor, command_buffer), OPAL_SUCCESS);
+	EXPECT_EQ(compactions.size(), 2u);
+}
+
+TEST_F(CompactorTest, ZeroSizeKeepsOriginal)
+{
+	createCompactor(16);
+
+	const Opal_AccelerationStructure structures[3] = {create(0), create(128), create(0)};
+
+	ASSERT_EQ(opalCompactAccelerationStructures(compactor, command_buffer, 3, structures, onCompacted, this), OPAL_SUCCESS);
+
+	if (num_written_sizes == 0)
+		GTEST_SKIP() << "single backend builds don't dispatch through the device table";
+
+	ASSERT_EQ(opalFlushCompactions(compactor, semaphore, 1), OPAL_SUCCESS);
+	ASSERT_EQ(opalSignalSemaphore(device, semaphore, 1), OPAL_SUCCESS);
+	ASSERT_EQ(opalPollCompactions(compactor, command_buffer), OPAL_SUCCESS);
+
+	ASSERT_EQ(compactions.size(), 1u);
+	EXPECT_EQ(compactions[0].src, structures[1]);
+	EXPECT_EQ(created_sizes[compactions[0].dst], 128u);
+	EXPECT_EQ(copies.size(), 1u);
+}
+
+TEST_F(CompactorTest, UnreportedSizesKeepOriginals)
+{
+	createCompactor(16);
+
+	// note: the hook reports zero for structures it doesn't know, same as backends without compacted sizes
+	Opal_AccelerationStructure structures[2] = {create(0), create(0)};
+
+	ASSERT_EQ(opalCompactAccelerationStructures(compactor, command_buffer, 2, structures, onCompacted, this), OPAL_SUCCESS);
+	ASSERT_EQ(opalFlushCompactions(compactor, semaphore, 1), OPAL_SUCCESS);
+	ASSERT_EQ(opalSignalSemaphore(device, semaphore, 1), OPAL_SUCCESS);
+	ASSERT_EQ(opalPollCompactions(compactor, command_buffer), OPAL_SUCCESS);
+
+	EXPECT_TRUE(compactions.empty());
+	EXPECT_TRUE(copies.empty());
+	EXPECT_FALSE(wasDestroyed(structures[0]));
+	EXPECT_FALSE(wasDestroyed(structures[1]));
+}
+
+TEST_F(CompactorTest, OriginalsRetiredAfterCopy)
+{
+	createCompactor(16);
+
+	const Opal_AccelerationStructure original = create(64);
+
+	ASSERT_EQ(opalCompactAccelerationStructures(compactor, command_buffer, 1, &original, onCompacted, this), OPAL_SUCCESS);
+
+	if (num_written_sizes == 0)
+		GTEST_SKIP() << "single backend builds don't dispatch through the device table";
+
+	ASSERT_EQ(opalFlushCompactions(compactor, semaphore, 1), OPAL_SUCCESS);
+	ASSERT_EQ(opalSignalSemaphore(device, semaphore, 1), OPAL_SUCCESS);
+	ASSERT_EQ(opalPollCompactions(compactor, command_buffer), OPAL_SUCCESS);
+	ASSERT_EQ(compactions.size(), 1u);
+
+	// note: the compacting copy was only recorded, the original stays alive until its submit completes
+	ASSERT_EQ(opalFlushCompactions(compactor, semaphore, 2), OPAL_SUCCESS);
+	ASSERT_EQ(opalPollCompactions(compactor, command_buffer), OPAL_SUCCESS);
+	EXPECT_FALSE(wasDestroyed(original));
+
+	ASSERT_EQ(opalSignalSemaphore(device, semaphore, 2), OPAL_SUCCESS);
+	ASSERT_EQ(opalPollCompactions(compactor, command_buffer), OPAL_SUCCESS);
+	EXPECT_TRUE(wasDestroyed(original));
+	EXPECT_FALSE(wasDestroyed(compactions[0].dst));
+}
+
+TEST_F(CompactorTest, RingReusedAfterPoll)
+{
+	createCompactor(4);
+
+	const Opal_AccelerationStructure first[3] = {create(32), create(48), create(80)};
+	const Opal_AccelerationStructure second[2] = {create(96), create(112)};
+
+	ASSERT_EQ(opalCompactAccelerationStructures(compactor, command_buffer, 3, first, onCompacted, this), OPAL_SUCCESS);
+	ASSERT_EQ(opalFlushCompactions(compactor, semaphore, 1), OPAL_SUCCESS);
+
+	// note: sizes of one call are never split by the wrap, the slots of the first call are still pending
+	EXPECT_EQ(opalCompactAccelerationStructures(compactor, command_buffer, 2, second, onCompacted, this), OPAL_NO_MEMORY);
+
+	if (num_written_sizes == 0)
+		GTEST_SKIP() << "single backend builds don't dispatch through the device table";
+
+	ASSERT_EQ(opalSignalSemaphore(device, semaphore, 1), OPAL_SUCCESS);
+	ASSERT_EQ(opalPollCompactions(compactor, command_buffer), OPAL_SUCCESS);
+	ASSERT_EQ(compactions.size(), 3u);
+
+	ASSERT_EQ(opalCompactAccelerationStructures(compactor, command_buffer, 2, second, onCompacted, this), OPAL_SUCCESS);
+	ASSERT_EQ(opalFlushCompactions(compactor, semaphore, 2), OPAL_SUCCESS);
+	ASSERT_EQ(opalSignalSemaphore(device, semaphore, 2), OPAL_SUCCESS);
+	ASSERT_EQ(opalPollCompactions(compactor, command_buffer), OPAL_SUCCESS);
+
+	// note: reused slots hold the sizes of the second call, not stale ones of the first
+	ASSERT_EQ(compactions.size(), 5u);
+	EXPECT_EQ(created_sizes[compactions[3].dst], 96u);
+	EXPECT_EQ(created_sizes[compactions[4].dst], 112u);
+}
+
+TEST_F(CompactorTest, TooManyStructures)
+{
+	createCompactor(2);
+
+	const Opal_AccelerationStructure structures[3] = {create(16), create(16), create(16)};
+
+	EXPECT_EQ(opalCompactAccelerationStructures(compactor, command_buffer, 3, structures, onCompacted, this), OPAL_NO_MEMORY);
+	EXPECT_EQ(num_written_sizes, 0u);
+
+	EXPECT_EQ(opalCompactAccelerationStructures(compactor, command_buffer, 2, structures, onCompacted, this), OPAL_SUCCESS);
+}
+
+int main(int argc, char **argv)
+{
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,240 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+extern "C"
+{
+#include "compiler.h"
+}
+
+struct TestDesc
+{
+	uint32_t value;
+	uint32_t fail;
+};
+
+struct TestPipeline
+{
+	uint32_t value;
+};
+
+constexpr uint32_t num_pipelines = 256;
+
+static std::atomic<bool> gate {true};
+
+static Opal_Result compileTestPipeline(void *device, const void *desc, Opal_Bump *scratch, void *pipeline)
+{
+	const TestDesc *desc_ptr = (const TestDesc *)desc;
+	TestPipeline *pipeline_ptr = (TestPipeline *)pipeline;
+
+	while (!gate.load())
+		std::this_thread::yield();
+
+	// note: exercise per-thread scratch
+	opal_bumpReset(scratch);
+	uint32_t offset = opal_bumpAlloc(scratch, sizeof(uint32_t) * 64);
+	uint32_t *temp = (uint32_t *)(scratch->data + offset);
+
+	for (uint32_t i = 0; i < 64; ++i)
+		temp[i] = desc_ptr->value;
+
+	if (desc_ptr->fail)
+		return OPAL_INTERNAL_ERROR;
+
+	pipeline_ptr->value = temp[63] + *(uint32_t *)device;
+	return OPAL_SUCCESS;
+}
+
+class CompilerTest : public testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		gate = true;
+
+		Opal_Result result = opal_poolInitialize(&pipelines, sizeof(TestPipeline), 16);
+		ASSERT_EQ(result, OPAL_SUCCESS);
+
+		result = opal_compilerInitialize(&compiler, &device, 0);
+		ASSERT_EQ(result, OPAL_SUCCESS);
+
+		for (uint32_t i = 0; i < num_pipelines; ++i)
+		{
+			descs[i].value = i;
+			descs[i].fail = 0;
+			handles[i] = OPAL_NULL_HANDLE;
+		}
+	}
+
+	void TearDown() override
+	{
+		gate = true;
+
+		Opal_Result result = opal_compilerShutdown(&compiler);
+		ASSERT_EQ(result, OPAL_SUCCESS);
+
+		result = opal_poolShutdown(&pipelines);
+		ASSERT_EQ(result, OPAL_SUCCESS);
+	}
+
+	void ExpectCompiled(uint32_t index)
+	{
+		ASSERT_NE(handles[index], OPAL_NULL_HANDLE);
+
+		TestPipeline *pipeline_ptr = (TestPipeline *)opal_poolGetElement(&pipelines, (Opal_PoolHandle)handles[index]);
+		ASSERT_NE(pipeline_ptr, nullptr);
+		EXPECT_EQ(pipeline_ptr->value, descs[index].value + device);
+	}
+
+	uint32_t device {1000};
+	Opal_Pool pipelines;
+	Opal_Compiler compiler;
+	TestDesc descs[num_pipelines];
+	uint64_t handles[num_pipelines];
+};
+
+TEST_F(CompilerTest, Run)
+{
+	Opal_Result result = opal_compilerRun(&compiler, compileTestPipeline, &pipelines, num_pipelines, descs, sizeof(TestDesc), handles);
+	EXPECT_EQ(result, OPAL_SUCCESS);
+	EXPECT_EQ(pipelines.size, num_pipelines);
+
+	for (uint32_t i = 0; i < num_pipelines; ++i)
+		ExpectCompiled(i);
+}
+
+TEST_F(CompilerTest, RunPartialFailure)
+{
+	for (uint32_t i = 1; i < num_pipelines; i += 2)
+		descs[i].fail = 1;
+
+	Opal_Result result = opal_compilerRun(&compiler, compileTestPipeline, &pipelines, num_pipelines, descs, sizeof(TestDesc), handles);
+	EXPECT_EQ(result, OPAL_INTERNAL_ERROR);
+	EXPECT_EQ(pipelines.size, num_pipelines / 2);
+
+	for (uint32_t i = 0; i < num_pipelines; i += 2)
+		ExpectCompiled(i);
+
+	for (uint32_t i = 1; i < num_pipelines; i += 2)
+		EXPECT_EQ(handles[i], OPAL_NULL_HANDLE);
+}
+
+TEST_F(CompilerTest, RunConcurrent)
+{
+	Opal_Pool other_pipelines;
+	uint64_t other_handles[num_pipelines] = {};
+
+	ASSERT_EQ(opal_poolInitialize(&other_pipelines, sizeof(TestPipeline), 16), OPAL_SUCCESS);
+
+	// note: both callers start the workers and compile on their own thread at the same time
+	std::thread other([&]()
+	{
+		EXPECT_EQ(opal_compilerRun(&compiler, compileTestPipeline, &other_pipelines, num_pipelines, descs, sizeof(TestDesc), other_handles), OPAL_SUCCESS);
+	});
+
+	EXPECT_EQ(opal_compilerRun(&compiler, compileTestPipeline, &pipelines, num_pipelines, descs, sizeof(TestDesc), handles), OPAL_SUCCESS);
+	other.join();
+
+	EXPECT_EQ(pipelines.size, num_pipelines);
+	EXPECT_EQ(other_pipelines.size, num_pipelines);
+
+	for (uint32_t i = 0; i < num_pipelines; ++i)
+	{
+		ExpectCompiled(i);
+
+		TestPipeline *pipeline_ptr = (TestPipeline *)opal_poolGetElement(&other_pipelines, (Opal_PoolHandle)other_handles[i]);
+		ASSERT_NE(pipeline_ptr, nullptr);
+		EXPECT_EQ(pipeline_ptr->value, descs[i].value + device);
+	}
+
+	EXPECT_EQ(opal_poolShutdown(&other_pipelines), OPAL_SUCCESS);
+}
+
+TEST_F(CompilerTest, SubmitWait)
+{
+	Opal_PipelineTask task = OPAL_NULL_HANDLE;
+
+	Opal_Result result = opal_compilerSubmit(&compiler, compileTestPipeline, &pipelines, num_pipelines, descs, sizeof(TestDesc), handles, &task);
+	ASSERT_EQ(result, OPAL_SUCCESS);
+
+	result = opal_compilerWait(&compiler, task, UINT64_MAX);
+	EXPECT_EQ(result, OPAL_SUCCESS);
+
+	for (uint32_t i = 0; i < num_pipelines; ++i)
+		ExpectCompiled(i);
+
+	// note: wait consumes the task
+	EXPECT_EQ(opal_compilerWait(&compiler, task, 0), OPAL_INVALID_PIPELINE_TASK);
+}
+
+TEST_F(CompilerTest, WaitTimeout)
+{
+	Opal_PipelineTask task = OPAL_NULL_HANDLE;
+	gate = false;
+
+	Opal_Result result = opal_compilerSubmit(&compiler, compileTestPipeline, &pipelines, num_pipelines, descs, sizeof(TestDesc), handles, &task);
+	ASSERT_EQ(result, OPAL_SUCCESS);
+
+	if (compiler.num_threads == 0)
+		GTEST_SKIP() << "no worker threads on this platform";
+
+	EXPECT_EQ(opal_compilerWait(&compiler, task, 0), OPAL_WAIT_TIMEOUT);
+	EXPECT_EQ(opal_compilerWait(&compiler, task, 10), OPAL_WAIT_TIMEOUT);
+	EXPECT_EQ(pipelines.size, 0);
+
+	gate = true;
+
+	EXPECT_EQ(opal_compilerWait(&compiler, task, UINT64_MAX), OPAL_SUCCESS);
+	EXPECT_EQ(pipelines.size, num_pipelines);
+}
+
+TEST_F(CompilerTest, Pause)
+{
+	Opal_PipelineTask task = OPAL_NULL_HANDLE;
+
+	// note: workers are started on the first submit
+	Opal_Result result = opal_compilerRun(&compiler, compileTestPipeline, &pipelines, 0, nullptr, sizeof(TestDesc), nullptr);
+	ASSERT_EQ(result, OPAL_SUCCESS);
+
+	if (compiler.num_threads == 0)
+		GTEST_SKIP() << "no worker threads on this platform";
+
+	opal_compilerPause(&compiler);
+
+	result = opal_compilerSubmit(&compiler, compileTestPipeline, &pipelines, num_pipelines, descs, sizeof(TestDesc), handles, &task);
+	ASSERT_EQ(result, OPAL_SUCCESS);
+
+	EXPECT_EQ(opal_compilerWait(&compiler, task, 10), OPAL_WAIT_TIMEOUT);
+	EXPECT_EQ(compiler.num_running, 0);
+
+	opal_compilerResume(&compiler);
+
+	EXPECT_EQ(opal_compilerWait(&compiler, task, UINT64_MAX), OPAL_SUCCESS);
+
+	for (uint32_t i = 0; i < num_pipelines; ++i)
+		ExpectCompiled(i);
+}
+
+TEST_F(CompilerTest, ShutdownRegistersPending)
+{
+	Opal_PipelineTask task = OPAL_NULL_HANDLE;
+
+	Opal_Result result = opal_compilerSubmit(&compiler, compileTestPipeline, &pipelines, num_pipelines, descs, sizeof(TestDesc), handles, &task);
+	ASSERT_EQ(result, OPAL_SUCCESS);
+
+	result = opal_compilerShutdown(&compiler);
+	ASSERT_EQ(result, OPAL_SUCCESS);
+
+	// note: nobody waited, pipelines still end up in the pool so their owner can free them
+	EXPECT_EQ(pipelines.size, num_pipelines);
+
+	result = opal_compilerInitialize(&compiler, &device, 0);
+	ASSERT_EQ(result, OPAL_SUCCESS);
+}
+
+int main(int argc, char **argv)
+{
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,229 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <opal.h>
+
+class CopyTest : public testing::Test
+{
+protected:
+	static const uint32_t buffer_size = 256;
+
+	void SetUp() override
+	{
+		Opal_InstanceDesc instance_desc = {};
+		instance_desc.application_name = "test_copy";
+		instance_desc.engine_name = "opal";
+
+		ASSERT_EQ(opalCreateInstance(OPAL_API_NULL, &instance_desc, &instance), OPAL_SUCCESS);
+		ASSERT_EQ(opalCreateDefaultDevice(instance, OPAL_DEVICE_HINT_DEFAULT, &device), OPAL_SUCCESS);
+
+		const Opal_DeviceEngineType engine_types[] = {OPAL_DEVICE_ENGINE_TYPE_MAIN, OPAL_DEVICE_ENGINE_TYPE_COMPUTE, OPAL_DEVICE_ENGINE_TYPE_COPY};
+		for (uint32_t i = 0; i < OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX; ++i)
+		{
+			ASSERT_EQ(opalGetDeviceQueue(device, engine_types[i], 0, &queues[i]), OPAL_SUCCESS);
+			ASSERT_EQ(opalCreateCommandAllocator(device, queues[i], &command_allocators[i]), OPAL_SUCCESS);
+			ASSERT_EQ(opalCreateCommandBuffer(device, command_allocators[i], &command_buffers[i]), OPAL_SUCCESS);
+		}
+
+		Opal_BufferDesc buffer_desc = {};
+		buffer_desc.size = buffer_size;
+		buffer_desc.memory_type = OPAL_ALLOCATION_MEMORY_TYPE_READBACK;
+		buffer_desc.usage = OPAL_BUFFER_USAGE_COPY_DST;
+
+		ASSERT_EQ(opalCreateBuffer(device, &buffer_desc, &buffer), OPAL_SUCCESS);
+
+		createTexture(OPAL_TEXTURE_FORMAT_RGBA8_UNORM, &color_texture, &color_view);
+		createTexture(OPAL_TEXTURE_FORMAT_D32_SFLOAT, &depth_texture, &depth_view);
+	}
+
+	void TearDown() override
+	{
+		opalDestroyTextureView(device, depth_view);
+		opalDestroyTexture(device, depth_texture);
+		opalDestroyTextureView(device, color_view);
+		opalDestroyTexture(device, color_texture);
+		opalDestroyBuffer(device, buffer);
+
+		for (uint32_t i = 0; i < OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX; ++i)
+		{
+			opalDestroyCommandBuffer(device, command_buffers[i]);
+			opalDestroyCommandAllocator(device, command_allocators[i]);
+		}
+
+		opalDestroyDevice(device);
+		opalDestroyInstance(instance);
+	}
+
+	void createTexture(Opal_TextureFormat format, Opal_Texture *texture, Opal_TextureView *texture_view)
+	{
+		Opal_TextureDesc texture_desc = {};
+		texture_desc.type = OPAL_TEXTURE_TYPE_2D;
+		texture_desc.format = format;
+		texture_desc.width = 16;
+		texture_desc.height = 16;
+		texture_desc.depth = 1;
+		texture_desc.mip_count = 1;
+		texture_desc.layer_count = 1;
+		texture_desc.samples = OPAL_SAMPLES_1;
+		texture_desc.usage = (Opal_TextureUsageFlags)(OPAL_TEXTURE_USAGE_FRAMEBUFFER_ATTACHMENT | OPAL_TEXTURE_USAGE_COPY_DST);
+
+		ASSERT_EQ(opalCreateTexture(device, &texture_desc, texture), OPAL_SUCCESS);
+
+		Opal_TextureViewDesc texture_view_desc = {};
+		texture_view_desc.texture = *texture;
+		texture_view_desc.type = OPAL_TEXTURE_VIEW_TYPE_2D;
+		texture_view_desc.mip_count = 1;
+		texture_view_desc.layer_count = 1;
+
+		ASSERT_EQ(opalCreateTextureView(device, &texture_view_desc, texture_view), OPAL_SUCCESS);
+	}
+
+	std::vector<uint8_t> readBuffer()
+	{
+		uint8_t *data = nullptr;
+		EXPECT_EQ(opalMapBuffer(device, buffer, (void **)&data), OPAL_SUCCESS);
+
+		std::vector<uint8_t> result(data, data + buffer_size);
+		EXPECT_EQ(opalUnmapBuffer(device, buffer), OPAL_SUCCESS);
+
+		return result;
+	}
+
+	Opal_Instance instance {OPAL_NULL_HANDLE};
+	Opal_Device device {OPAL_NULL_HANDLE};
+	Opal_Queue queues[OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX] {};
+	Opal_CommandAllocator command_allocators[OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX] {};
+	Opal_CommandBuffer command_buffers[OPAL_DEVICE_ENGINE_TYPE_ENUM_MAX] {};
+	Opal_Buffer buffer {OPAL_NULL_HANDLE};
+	Opal_Texture color_texture {OPAL_NULL_HANDLE};
+	Opal_TextureView color_view {OPAL_NULL_HANDLE};
+	Opal_Texture depth_texture {OPAL_NULL_HANDLE};
+	Opal_TextureView depth_view {OPAL_NULL_HANDLE};
+};
+
+TEST_F(CopyTest, FillBuffer)
+{
+	Opal_CommandBuffer command_buffer = command_buffers[OPAL_DEVICE_ENGINE_TYPE_COPY];
+	ASSERT_EQ(opalCmdFillBuffer(device, command_buffer, buffer, 16, 32, 0xA1B2C3D4), OPAL_SUCCESS);
+
+	std::vector<uint8_t> data = readBuffer();
+	const uint32_t value = 0xA1B2C3D4;
+
+	for (uint32_t i = 0; i < buffer_size; ++i)
+	{
+		uint8_t expected = (i >= 16 && i < 48) ? ((const uint8_t *)&value)[i & 3] : 0;
+		ASSERT_EQ(data[i], expected);
+	}
+}
+
+TEST_F(CopyTest, FillBufferInvalidArguments)
+{
+	Opal_CommandBuffer command_buffer = command_buffers[OPAL_DEVICE_ENGINE_TYPE_COPY];
+
+	EXPECT_EQ(opalCmdFillBuffer(OPAL_NULL_HANDLE, command_buffer, buffer, 0, 4, 0), OPAL_INVALID_DEVICE);
+	EXPECT_EQ(opalCmdFillBuffer(device, OPAL_NULL_HANDLE, buffer, 0, 4, 0), OPAL_INVALID_COMMAND_BUFFER);
+	EXPECT_EQ(opalCmdFillBuffer(device, command_buffer, OPAL_NULL_HANDLE, 0, 4, 0), OPAL_INVALID_BUFFER);
+	EXPECT_EQ(opalCmdFillBuffer(device, command_buffer, buffer, 2, 4, 0), OPAL_INVALID_ARGUMENT);
+	EXPECT_EQ(opalCmdFillBuffer(device, command_buffer, buffer, 0, 6, 0), OPAL_INVALID_ARGUMENT);
+	EXPECT_EQ(opalCmdFillBuffer(device, command_buffer, buffer, buffer_size - 4, 8, 0), OPAL_INVALID_ARGUMENT);
+}
+
+TEST_F(CopyTest, UpdateBuffer)
+{
+	Opal_CommandBuffer command_buffer = command_buffers[OPAL_DEVICE_ENGINE_TYPE_COPY];
+
+	uint8_t source[64];
+	for (uint32_t i = 0; i < 64; ++i)
+		source[i] = (uint8_t)(i * 3 + 1);
+
+	ASSERT_EQ(opalCmdUpdateBuffer(device, command_buffer, buffer, 64, 64, source), OPAL_SUCCESS);
+	ASSERT_EQ(opalCmdUpdateBuffer(device, command_buffer, buffer, 0, 0, nullptr), OPAL_SUCCESS);
+
+	std::vector<uint8_t> data = readBuffer();
+	for (uint32_t i = 0; i < buffer_size; ++i)
+	{
+		uint8_t expected = (i >= 64 && i < 128) ? source[i - 64] : 0;
+		ASSERT_EQ(data[i], expected);
+	}
+}
+
+TEST_F(CopyTest, UpdateBufferInvalidArguments)
+{
+	Opal_CommandBuffer command_buffer = command_buffers[OPAL_DEVICE_ENGINE_TYPE_COPY];
+	std::vector<uint8_t> source(OPAL_MAX_UPDATE_BUFFER_SIZE + 4);
+
+	EXPECT_EQ(opalCmdUpdateBuffer(OPAL_NULL_HANDLE, command_buffer, buffer, 0, 4, source.data()), OPAL_INVALID_DEVICE);
+	EXPECT_EQ(opalCmdUpdateBuffer(device, OPAL_NULL_HANDLE, buffer, 0, 4, source.data()), OPAL_INVALID_COMMAND_BUFFER);
+	EXPECT_EQ(opalCmdUpdateBuffer(device, command_buffer, OPAL_NULL_HANDLE, 0, 4, source.data()), OPAL_INVALID_BUFFER);
+	EXPECT_EQ(opalCmdUpdateBuffer(device, command_buffer, buffer, 0, 4, nullptr), OPAL_INVALID_ARGUMENT);
+	EXPECT_EQ(opalCmdUpdateBuffer(device, command_buffer, buffer, 1, 4, source.data()), OPAL_INVALID_ARGUMENT);
+	EXPECT_EQ(opalCmdUpdateBuffer(device, command_buffer, buffer, 0, 3, source.data()), OPAL_INVALID_ARGUMENT);
+	EXPECT_EQ(opalCmdUpdateBuffer(device, command_buffer, buffer, buffer_size, 4, source.data()), OPAL_INVALID_ARGUMENT);
+	EXPECT_EQ(opalCmdUpdateBuffer(device, command_buffer, buffer, 0, OPAL_MAX_UPDATE_BUFFER_SIZE + 4, source.data()), OPAL_NOT_SUPPORTED);
+}
+
+TEST_F(CopyTest, ClearTextureEngines)
+{
+	Opal_ClearValue clear_value = {};
+
+	EXPECT_EQ(opalCmdClearTexture(device, command_buffers[OPAL_DEVICE_ENGINE_TYPE_MAIN], color_view, clear_value), OPAL_SUCCESS);
+	EXPECT_EQ(opalCmdClearTexture(device, command_buffers[OPAL_DEVICE_ENGINE_TYPE_COMPUTE], color_view, clear_value), OPAL_SUCCESS);
+	EXPECT_EQ(opalCmdClearTexture(device, command_buffers[OPAL_DEVICE_ENGINE_TYPE_COPY], color_view, clear_value), OPAL_NOT_SUPPORTED);
+
+	EXPECT_EQ(opalCmdClearTexture(device, command_buffers[OPAL_DEVICE_ENGINE_TYPE_MAIN], depth_view, clear_value), OPAL_SUCCESS);
+	EXPECT_EQ(opalCmdClearTexture(device, command_buffers[OPAL_DEVICE_ENGINE_TYPE_COMPUTE], depth_view, clear_value), OPAL_NOT_SUPPORTED);
+	EXPECT_EQ(opalCmdClearTexture(device, command_buffers[OPAL_DEVICE_ENGINE_TYPE_COPY], depth_view, clear_value), OPAL_NOT_SUPPORTED);
+}
+
+TEST_F(CopyTest, ClearTextureInvalidArguments)
+{
+	Opal_ClearValue clear_value = {};
+	Opal_CommandBuffer command_buffer = command_buffers[OPAL_DEVICE_ENGINE_TYPE_MAIN];
+
+	EXPECT_EQ(opalCmdClearTexture(OPAL_NULL_HANDLE, command_buffer, color_view, clear_value), OPAL_INVALID_DEVICE);
+	EXPECT_EQ(opalCmdClearTexture(device, OPAL_NULL_HANDLE, color_view, clear_value), OPAL_INVALID_COMMAND_BUFFER);
+	EXPECT_EQ(opalCmdClearTexture(device, command_buffer, OPAL_NULL_HANDLE, clear_value), OPAL_INVALID_TEXTURE_VIEW);
+}
+
+TEST_F(CopyTest, BlitTextureEngines)
+{
+	Opal_TextureRegion src = {color_view, {0, 0, 0}};
+	Opal_TextureRegion dst = {color_view, {0, 0, 0}};
+	Opal_Extent3D src_size = {16, 16, 1};
+	Opal_Extent3D dst_size = {8, 8, 1};
+
+	EXPECT_EQ(opalCmdBlitTexture(device, command_buffers[OPAL_DEVICE_ENGINE_TYPE_MAIN], src, src_size, dst, dst_size, OPAL_SAMPLER_FILTER_MODE_LINEAR), OPAL_SUCCESS);
+	EXPECT_EQ(opalCmdBlitTexture(device, command_buffers[OPAL_DEVICE_ENGINE_TYPE_COMPUTE], src, src_size, dst, dst_size, OPAL_SAMPLER_FILTER_MODE_LINEAR), OPAL_NOT_SUPPORTED);
+	EXPECT_EQ(opalCmdBlitTexture(device, command_buffers[OPAL_DEVICE_ENGINE_TYPE_COPY], src, src_size, dst, dst_size, OPAL_SAMPLER_FILTER_MODE_LINEAR), OPAL_NOT_SUPPORTED);
+}
+
+TEST_F(CopyTest, BlitTextureInvalidArguments)
+{
+	Opal_CommandBuffer command_buffer = command_buffers[OPAL_DEVICE_ENGINE_TYPE_MAIN];
+	Opal_TextureRegion region = {color_view, {0, 0, 0}};
+	Opal_TextureRegion null_region = {OPAL_NULL_HANDLE, {0, 0, 0}};
+	Opal_Extent3D size = {16, 16, 1};
+
+	EXPECT_EQ(opalCmdBlitTexture(OPAL_NULL_HANDLE, command_buffer, region, size, region, size, OPAL_SAMPLER_FILTER_MODE_NEAREST), OPAL_INVALID_DEVICE);
+	EXPECT_EQ(opalCmdBlitTexture(device, OPAL_NULL_HANDLE, region, size, region, size, OPAL_SAMPLER_FILTER_MODE_NEAREST), OPAL_INVALID_COMMAND_BUFFER);
+	EXPECT_EQ(opalCmdBlitTexture(device, command_buffer, null_region, size, region, size, OPAL_SAMPLER_FILTER_MODE_NEAREST), OPAL_INVALID_TEXTURE_VIEW);
+	EXPECT_EQ(opalCmdBlitTexture(device, command_buffer, region, size, null_region, size, OPAL_SAMPLER_FILTER_MODE_NEAREST), OPAL_INVALID_TEXTURE_VIEW);
+	EXPECT_EQ(opalCmdBlitTexture(device, command_buffer, region, size, region, size, OPAL_SAMPLER_FILTER_MODE_ENUM_MAX), OPAL_INVALID_ARGUMENT);
+}
+
+TEST_F(CopyTest, GenerateMipsEngines)
+{
+	EXPECT_EQ(opalCmdGenerateMips(device, command_buffers[OPAL_DEVICE_ENGINE_TYPE_MAIN], color_view), OPAL_SUCCESS);
+	EXPECT_EQ(opalCmdGenerateMips(device, command_buffers[OPAL_DEVICE_ENGINE_TYPE_COMPUTE], color_view), OPAL_NOT_SUPPORTED);
+	EXPECT_EQ(opalCmdGenerateMips(device, command_buffers[OPAL_DEVICE_ENGINE_TYPE_COPY], color_view), OPAL_NOT_SUPPORTED);
+
+	EXPECT_EQ(opalCmdGenerateMips(device, OPAL_NULL_HANDLE, color_view), OPAL_INVALID_COMMAND_BUFFER);
+	EXPECT_EQ(opalCmdGenerateMips(device, command_buffers[OPAL_DEVICE_ENGINE_TYPE_MAIN], OPAL_NULL_HANDLE), OPAL_INVALID_TEXTURE_VIEW);
+}
+
+int main(int argc, char **argv)
+{
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
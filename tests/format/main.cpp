@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+extern "C"
+{
+#include "format.h"
+}
+
+static Opal_TextureDesc makeDesc(Opal_TextureType type, Opal_TextureFormat format, uint32_t width, uint32_t height, uint32_t depth, uint32_t mip_count, uint32_t layer_count)
+{
+	Opal_TextureDesc desc = {};
+	desc.type = type;
+	desc.format = format;
+	desc.width = width;
+	desc.height = height;
+	desc.depth = depth;
+	desc.mip_count = mip_count;
+	desc.layer_count = layer_count;
+	desc.samples = OPAL_SAMPLES_1;
+
+	return desc;
+}
+
+static std::vector<Opal_BufferTextureCopyRegion> getLayout(const Opal_TextureDesc &desc, uint32_t row_alignment, uint64_t offset_alignment, uint64_t *size)
+{
+	uint32_t num_regions = 0;
+	Opal_Result result = opal_formatGetCopyLayout(&desc, row_alignment, offset_alignment, &num_regions, nullptr, nullptr);
+	EXPECT_EQ(result, OPAL_SUCCESS);
+
+	std::vector<Opal_BufferTextureCopyRegion> regions(num_regions);
+	result = opal_formatGetCopyLayout(&desc, row_alignment, offset_alignment, &num_regions, regions.data(), size);
+	EXPECT_EQ(result, OPAL_SUCCESS);
+
+	return regions;
+}
+
+TEST(Format, BlockInfoCoversEveryFormat)
+{
+	for (uint32_t i = OPAL_TEXTURE_FORMAT_COLOR_BEGIN; i < OPAL_TEXTURE_FORMAT_ENUM_MAX; ++i)
+	{
+		Opal_FormatBlockInfo block = opal_formatGetBlockInfo((Opal_TextureFormat)i);
+		EXPECT_GT(block.size, 0u);
+		EXPECT_GT(block.width, 0u);
+		EXPECT_GT(block.height, 0u);
+	}
+}
+
+TEST(Format, BlockInfoValues)
+{
+	Opal_FormatBlockInfo rgba8 = opal_formatGetBlockInfo(OPAL_TEXTURE_FORMAT_RGBA8_UNORM);
+	EXPECT_EQ(rgba8.size, 4u);
+	EXPECT_EQ(rgba8.width, 1u);
+	EXPECT_EQ(rgba8.height, 1u);
+
+	Opal_FormatBlockInfo rgba32 = opal_formatGetBlockInfo(OPAL_TEXTURE_FORMAT_RGBA32_SFLOAT);
+	EXPECT_EQ(rgba32.size, 16u);
+
+	Opal_FormatBlockInfo bc1 = opal_formatGetBlockInfo(OPAL_TEXTURE_FORMAT_BC1_R5G6B5_UNORM_SRGB);
+	EXPECT_EQ(bc1.size, 8u);
+	EXPECT_EQ(bc1.width, 4u);
+	EXPECT_EQ(bc1.height, 4u);
+
+	Opal_FormatBlockInfo bc7 = opal_formatGetBlockInfo(OPAL_TEXTURE_FORMAT_BC7_RGBA8_UNORM);
+	EXPECT_EQ(bc7.size, 16u);
+
+	Opal_FormatBlockInfo eac = opal_formatGetBlockInfo(OPAL_TEXTURE_FORMAT_EAC_RG11_SNORM);
+	EXPECT_EQ(eac.size, 16u);
+
+	Opal_FormatBlockInfo astc = opal_formatGetBlockInfo(OPAL_TEXTURE_FORMAT_ASTC_10x8_UNORM_SRGB);
+	EXPECT_EQ(astc.size, 16u);
+	EXPECT_EQ(astc.width, 10u);
+	EXPECT_EQ(astc.height, 8u);
+
+	Opal_FormatBlockInfo depth = opal_formatGetBlockInfo(OPAL_TEXTURE_FORMAT_D32_SFLOAT_S8_UINT);
+	EXPECT_EQ(depth.size, 4u);
+}
+
+TEST(Format, LayoutUndefinedFormat)
+{
+	Opal_TextureDesc desc = makeDesc(OPAL_TEXTURE_TYPE_2D, OPAL_TEXTURE_FORMAT_UNDEFINED, 16, 16, 1, 1, 1);
+
+	uint32_t num_regions = 0;
+	EXPECT_EQ(opal_formatGetCopyLayout(&desc, 1, 1, &num_regions, nullptr, nullptr), OPAL_TEXTURE_FORMAT_NOT_SUPPORTED);
+}
+
+TEST(Format, LayoutTightlyPacked)
+{
+	Opal_TextureDesc desc = makeDesc(OPAL_TEXTURE_TYPE_2D, OPAL_TEXTURE_FORMAT_RGBA8_UNORM, 256, 64, 1, 9, 1);
+
+	uint64_t size = 0;
+	std::vector<Opal_BufferTextureCopyRegion> regions = getLayout(desc, 1, 1, &size);
+	ASSERT_EQ(regions.size(), 9u);
+
+	uint64_t offset = 0;
+	for (uint32_t mip = 0; mip < 9; ++mip)
+	{
+		const Opal_BufferTextureCopyRegion &region = regions[mip];
+		uint32_t width = std::max(256u >> mip, 1u);
+		uint32_t height = std::max(64u >> mip, 1u);
+
+		EXPECT_EQ(region.buffer_offset, offset);
+		EXPECT_EQ(region.row_size, width * 4);
+		EXPECT_EQ(region.num_rows, height);
+		EXPECT_EQ(region.mip, mip);
+		EXPECT_EQ(region.base_layer, 0u);
+		EXPECT_EQ(region.layer_count, 1u);
+		EXPECT_EQ(region.size.width, width);
+		EXPECT_EQ(region.size.height, height);
+		EXPECT_EQ(region.size.depth, 1u);
+
+		offset += (uint64_t)width * height * 4;
+	}
+
+	EXPECT_EQ(size, offset);
+}
+
+TEST(Format, LayoutCubeMipChain)
+{
+	Opal_TextureDesc desc = makeDesc(OPAL_TEXTURE_TYPE_2D, OPAL_TEXTURE_FORMAT_RGBA16_SFLOAT, 2048, 2048, 1, 12, 6);
+
+	uint64_t size = 0;
+	std::vector<Opal_BufferTextureCopyRegion> regions = getLayout(desc, 1, 1, &size);
+	ASSERT_EQ(regions.size(), 72u);
+
+	for (uint32_t layer = 0; layer < 6; ++layer)
+	{
+		for (uint32_t mip = 0; mip < 12; ++mip)
+		{
+			const Opal_BufferTextureCopyRegion &region = regions[layer * 12 + mip];
+			EXPECT_EQ(region.mip, mip);
+			EXPECT_EQ(region.base_layer, layer);
+			EXPECT_EQ(region.size.width, std::max(2048u >> mip, 1u));
+		}
+	}
+
+	const Opal_BufferTextureCopyRegion &last = regions.back();
+	EXPECT_EQ(size, last.buffer_offset + (uint64_t)last.row_size * last.num_rows);
+}
+
+TEST(Format, LayoutAligned)
+{
+	Opal_TextureDesc desc = makeDesc(OPAL_TEXTURE_TYPE_2D, OPAL_TEXTURE_FORMAT_R8_UNORM, 100, 30, 1, 7, 2);
+
+	uint64_t size = 0;
+	std::vector<Opal_BufferTextureCopyRegion> regions = getLayout(desc, 256, 512, &size);
+	ASSERT_EQ(regions.size(), 14u);
+
+	uint64_t end = 0;
+	for (const Opal_BufferTextureCopyRegion &region : regions)
+	{
+		EXPECT_EQ(region.row_size % 256, 0u);
+		EXPECT_EQ(region.buffer_offset % 512, 0u);
+		EXPECT_GE(region.buffer_offset, end);
+		EXPECT_GE(region.row_size, region.size.width);
+
+		end = region.buffer_offset + (uint64_t)region.row_size * region.num_rows;
+	}
+
+	EXPECT_EQ(size, end);
+}
+
+TEST(Format, LayoutCompressedSmallMips)
+{
+	Opal_TextureDesc desc = makeDesc(OPAL_TEXTURE_TYPE_2D, OPAL_TEXTURE_FORMAT_BC1_R5G6B5_UNORM, 16, 8, 1, 5, 1);
+
+	uint64_t size = 0;
+	std::vector<Opal_BufferTextureCopyRegion> regions = getLayout(desc, 1, 1, &size);
+	ASSERT_EQ(regions.size(), 5u);
+
+	EXPECT_EQ(regions[0].row_size, 32u);
+	EXPECT_EQ(regions[0].num_rows, 2u);
+
+	for (uint32_t mip = 2; mip < 5; ++mip)
+	{
+		EXPECT_EQ(regions[mip].row_size, 8u);
+		EXPECT_EQ(regions[mip].num_rows, 1u);
+		EXPECT_EQ(regions[mip].buffer_offset % 8, 0u);
+	}
+
+	EXPECT_EQ(regions[4].size.width, 1u);
+	EXPECT_EQ(regions[4].size.height, 1u);
+	EXPECT_EQ(size, 64u + 16u + 8u + 8u + 8u);
+}
+
+TEST(Format, Layout3D)
+{
+	Opal_TextureDesc desc = makeDesc(OPAL_TEXTURE_TYPE_3D, OPAL_TEXTURE_FORMAT_R32_SFLOAT, 32, 16, 8, 3, 4);
+
+	uint64_t size = 0;
+	std::vector<Opal_BufferTextureCopyRegion> regions = getLayout(desc, 1, 1, &size);
+	ASSERT_EQ(regions.size(), 3u);
+
+	EXPECT_EQ(regions[0].size.depth, 8u);
+	EXPECT_EQ(regions[1].size.depth, 4u);
+	EXPECT_EQ(regions[2].size.depth, 2u);
+	EXPECT_EQ(regions[1].buffer_offset, 32u * 16u * 8u * 4u);
+	EXPECT_EQ(size, 32u * 16u * 8u * 4u + 16u * 8u * 4u * 4u + 8u * 4u * 2u * 4u);
+}
+
+int main(int argc, char **argv)
+{
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,366 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+extern "C"
+{
+#include "graph_internal.h"
+}
+
+struct RecordedBarrier
+{
+	Opal_FenceOp fence_op;
+	Opal_Fence fence;
+	std::vector<Opal_BufferTransitionDesc> buffer_transitions;
+};
+
+struct RecordedPass
+{
+	uint32_t id;
+	std::vector<RecordedBarrier> begin_barriers;
+	std::vector<RecordedBarrier> end_barriers;
+};
+
+class GraphTest : public testing::Test
+{
+protected:
+	struct Tag
+	{
+		GraphTest *test;
+		uint32_t id;
+	};
+
+	static const uint32_t max_tags = 16;
+
+	void SetUp() override
+	{
+		Opal_InstanceDesc instance_desc = {};
+		instance_desc.application_name = "test_graph";
+		instance_desc.engine_name = "opal";
+
+		ASSERT_EQ(opalCreateInstance(OPAL_API_NULL, &instance_desc, &instance), OPAL_SUCCESS);
+		ASSERT_EQ(opalCreateDefaultDevice(instance, OPAL_DEVICE_HINT_DEFAULT, &device), OPAL_SUCCESS);
+		ASSERT_EQ(opalGetDeviceQueue(device, OPAL_DEVICE_ENGINE_TYPE_MAIN, 0, &queue), OPAL_SUCCESS);
+		ASSERT_EQ(opalCreateCommandAllocator(device, queue, &command_allocator), OPAL_SUCCESS);
+		ASSERT_EQ(opalCreateCommandBuffer(device, command_allocator, &command_buffer), OPAL_SUCCESS);
+
+		buffer_desc.size = 256;
+		buffer_desc.memory_type = OPAL_ALLOCATION_MEMORY_TYPE_DEVICE_LOCAL;
+		buffer_desc.usage = (Opal_BufferUsageFlags)(OPAL_BUFFER_USAGE_UNORDERED_ACCESS | OPAL_BUFFER_USAGE_COPY_DST);
+
+		ASSERT_EQ(opalCreateBuffer(device, &buffer_desc, &output), OPAL_SUCCESS);
+		ASSERT_EQ(opalCreateBuffer(device, &buffer_desc, &other_output), OPAL_SUCCESS);
+
+		ASSERT_EQ(opalCreateGraph(device, &graph), OPAL_SUCCESS);
+
+		for (uint32_t i = 0; i < max_tags; ++i)
+			tags[i] = {this, i};
+	}
+
+	void TearDown() override
+	{
+		opalDestroyGraph(graph);
+		opalDestroyBuffer(device, other_output);
+		opalDestroyBuffer(device, output);
+		opalDestroyCommandBuffer(device, command_buffer);
+		opalDestroyCommandAllocator(device, command_allocator);
+		opalDestroyDevice(device);
+		opalDestroyInstance(instance);
+	}
+
+	static void recordBarriers(const Opal_BarrierDesc *barriers, uint32_t first, uint32_t last, std::vector<RecordedBarrier> &recorded)
+	{
+		for (uint32_t i = first; i < last; ++i)
+		{
+			const Opal_BarrierDesc *barrier = &barriers[i];
+			RecordedBarrier result = {barrier->fence_op, barrier->fence, {}};
+
+			for (uint32_t j = 0; j < barrier->num_buffer_transitions; ++j)
+				result.buffer_transitions.push_back(barrier->buffer_transitions[j]);
+
+			recorded.push_back(result);
+		}
+	}
+
+	// note: passes are recorded in compiled order, so the n-th callback runs at position n
+	static void callback(void *user_data, Opal_Graph graph, Opal_CommandBuffer)
+	{
+		Tag *tag = (Tag *)user_data;
+		GraphTest *test = tag->test;
+
+		const Graph_Graph *ptr = (const Graph_Graph *)graph;
+		uint32_t position = (uint32_t)test->passes.size();
+
+		RecordedPass pass = {tag->id, {}, {}};
+		recordBarriers(ptr->begin_barriers, ptr->begin_offsets[position], ptr->begin_offsets[position + 1], pass.begin_barriers);
+		recordBarriers(ptr->end_barriers, ptr->end_offsets[position], ptr->end_offsets[position + 1], pass.end_barriers);
+
+		test->passes.push_back(pass);
+	}
+
+	Opal_GraphResource importBuffer(Opal_Buffer buffer, Opal_BufferState initial_state, Opal_BufferState final_state)
+	{
+		Opal_GraphResource resource = OPAL_NULL_HANDLE;
+		EXPECT_EQ(opalImportGraphBuffer(graph, buffer, initial_state, final_state, &resource), OPAL_SUCCESS);
+		return resource;
+	}
+
+	Opal_GraphResource createBuffer(const Opal_BufferDesc &desc)
+	{
+		Opal_GraphResource resource = OPAL_NULL_HANDLE;
+		EXPECT_EQ(opalCreateGraphBuffer(graph, &desc, &resource), OPAL_SUCCESS);
+		return resource;
+	}
+
+	void addPass(uint32_t id, std::initializer_list<Opal_GraphBufferAccess> accesses, Opal_GraphPassFlags flags = (Opal_GraphPassFlags)0)
+	{
+		std::vector<Opal_GraphBufferAccess> buffer_accesses(accesses);
+
+		Opal_GraphPassDesc desc = {};
+		desc.type = OPAL_GRAPH_PASS_TYPE_COMPUTE;
+		desc.flags = flags;
+		desc.num_buffer_accesses = (uint32_t)buffer_accesses.size();
+		desc.buffer_accesses = buffer_accesses.data();
+		desc.callback = callback;
+		desc.user_data = &tags[id];
+
+		ASSERT_EQ(opalAddGraphPass(graph, &desc), OPAL_SUCCESS);
+	}
+
+	static Opal_GraphBufferAccess write(Opal_GraphResource buffer)
+	{
+		return {buffer, OPAL_BUFFER_STATE_UNORDERED_ACCESS, OPAL_BARRIER_STAGE_NONE};
+	}
+
+	static Opal_GraphBufferAccess read(Opal_GraphResource buffer)
+	{
+		return {buffer, OPAL_BUFFER_STATE_GENERIC_READ, OPAL_BARRIER_STAGE_NONE};
+	}
+
+	std::vector<uint32_t> order() const
+	{
+		std::vector<uint32_t> result;
+		for (const RecordedPass &pass : passes)
+			result.push_back(pass.id);
+
+		return result;
+	}
+
+	Opal_Instance instance {OPAL_NULL_HANDLE};
+	Opal_Device device {OPAL_NULL_HANDLE};
+	Opal_Queue queue {OPAL_NULL_HANDLE};
+	Opal_CommandAllocator command_allocator {OPAL_NULL_HANDLE};
+	Opal_CommandBuffer command_buffer {OPAL_NULL_HANDLE};
+	Opal_Buffer output {OPAL_NULL_HANDLE};
+	Opal_Buffer other_output {OPAL_NULL_HANDLE};
+	Opal_Graph graph {OPAL_NULL_HANDLE};
+	Opal_BufferDesc buffer_desc {};
+
+	Tag tags[max_tags];
+	std::vector<RecordedPass> passes;
+};
+
+TEST_F(GraphTest, CullsDeadPasses)
+{
+	Opal_GraphResource imported = importBuffer(output, OPAL_BUFFER_STATE_UNORDERED_ACCESS, OPAL_BUFFER_STATE_UNORDERED_ACCESS);
+	Opal_GraphResource used = createBuffer(buffer_desc);
+	Opal_GraphResource unused = createBuffer(buffer_desc);
+	Opal_GraphResource kept = createBuffer(buffer_desc);
+
+	addPass(0, {write(unused)});
+	addPass(1, {write(used)});
+	addPass(2, {write(unused)});
+	addPass(3, {read(used), write(imported)});
+	addPass(4, {write(kept)}, OPAL_GRAPH_PASS_FLAGS_NEVER_CULL);
+
+	ASSERT_EQ(opalExecuteGraph(graph, command_buffer), OPAL_SUCCESS);
+	EXPECT_EQ(order(), std::vector<uint32_t>({1, 4, 3}));
+
+	// note: resources of culled passes are never allocated
+	Opal_Buffer buffer = OPAL_NULL_HANDLE;
+	EXPECT_EQ(opalGetGraphBuffer(graph, unused, &buffer), OPAL_INVALID_GRAPH);
+	EXPECT_EQ(opalGetGraphBuffer(graph, kept, &buffer), OPAL_SUCCESS);
+}
+
+TEST_F(GraphTest, OrdersDependencies)
+{
+	Opal_GraphResource imported = importBuffer(output, OPAL_BUFFER_STATE_UNORDERED_ACCESS, OPAL_BUFFER_STATE_UNORDERED_ACCESS);
+	Opal_GraphResource other_imported = importBuffer(other_output, OPAL_BUFFER_STATE_UNORDERED_ACCESS, OPAL_BUFFER_STATE_UNORDERED_ACCESS);
+	Opal_GraphResource first = createBuffer(buffer_desc);
+	Opal_GraphResource second = createBuffer(buffer_desc);
+
+	addPass(0, {write(first)});
+	addPass(1, {read(first), write(imported)});
+	addPass(2, {write(second)});
+	addPass(3, {read(second), write(other_imported)});
+
+	ASSERT_EQ(opalExecuteGraph(graph, command_buffer), OPAL_SUCCESS);
+
+	// note: the independent producer is moved between the first producer and its consumer
+	EXPECT_EQ(order(), std::vector<uint32_t>({0, 2, 1, 3}));
+}
+
+TEST_F(GraphTest, KeepsWriteAfterReadOrder)
+{
+	Opal_GraphResource imported = importBuffer(output, OPAL_BUFFER_STATE_UNORDERED_ACCESS, OPAL_BUFFER_STATE_UNORDERED_ACCESS);
+	Opal_GraphResource shared = createBuffer(buffer_desc);
+
+	addPass(0, {write(shared)});
+	addPass(1, {read(shared), write(imported)});
+	addPass(2, {write(shared)});
+	addPass(3, {read(shared), write(imported)});
+
+	ASSERT_EQ(opalExecuteGraph(graph, command_buffer), OPAL_SUCCESS);
+	EXPECT_EQ(order(), std::vector<uint32_t>({0, 1, 2, 3}));
+}
+
+TEST_F(GraphTest, PlacesSplitBarriers)
+{
+	Opal_GraphResource imported = importBuffer(output, OPAL_BUFFER_STATE_GENERIC_READ, OPAL_BUFFER_STATE_GENERIC_READ);
+	Opal_GraphResource other_imported = importBuffer(other_output, OPAL_BUFFER_STATE_UNORDERED_ACCESS, OPAL_BUFFER_STATE_UNORDERED_ACCESS);
+
+	addPass(0, {write(imported)});
+	addPass(1, {write(other_imported)});
+	addPass(2, {read(imported), write(other_imported)});
+
+	ASSERT_EQ(opalExecuteGraph(graph, command_buffer), OPAL_SUCCESS);
+	ASSERT_EQ(order(), std::vector<uint32_t>({0, 1, 2}));
+
+	// note: the initial transition has no producer to overlap with, so it isn't split
+	ASSERT_EQ(passes[0].begin_barriers.size(), 1);
+	EXPECT_EQ(passes[0].begin_barriers[0].fence, OPAL_NULL_HANDLE);
+	ASSERT_EQ(passes[0].begin_barriers[0].buffer_transitions.size(), 1);
+	EXPECT_EQ(passes[0].begin_barriers[0].buffer_transitions[0].buffer, output);
+	EXPECT_EQ(passes[0].begin_barriers[0].buffer_transitions[0].state_before, OPAL_BUFFER_STATE_GENERIC_READ);
+	EXPECT_EQ(passes[0].begin_barriers[0].buffer_transitions[0].state_after, OPAL_BUFFER_STATE_UNORDERED_ACCESS);
+
+	// note: the transition to the reader is begun right after the writer and ended right before the reader
+	ASSERT_EQ(passes[0].end_barriers.size(), 1);
+	const RecordedBarrier &begin = passes[0].end_barriers[0];
+	EXPECT_EQ(begin.fence_op, OPAL_FENCE_OP_BEGIN);
+	EXPECT_NE(begin.fence, OPAL_NULL_HANDLE);
+	ASSERT_EQ(begin.buffer_transitions.size(), 1);
+	EXPECT_EQ(begin.buffer_transitions[0].buffer, output);
+	EXPECT_EQ(begin.buffer_transitions[0].state_before, OPAL_BUFFER_STATE_UNORDERED_ACCESS);
+	EXPECT_EQ(begin.buffer_transitions[0].state_after, OPAL_BUFFER_STATE_GENERIC_READ);
+
+	// note: the unrelated pass in between sees none of it
+	EXPECT_TRUE(passes[1].begin_barriers.empty());
+
+	const RecordedBarrier *end = nullptr;
+	for (const RecordedBarrier &barrier : passes[2].begin_barriers)
+		if (barrier.fence == begin.fence)
+			end = &barrier;
+
+	ASSERT_NE(end, nullptr);
+	EXPECT_EQ(end->fence_op, OPAL_FENCE_OP_END);
+	ASSERT_EQ(end->buffer_transitions.size(), 1);
+	EXPECT_EQ(end->buffer_transitions[0].buffer, output);
+
+	// note: the imported buffer is already in its final state, nothing is left after the last pass
+	for (const RecordedBarrier &barrier : passes[2].end_barriers)
+		for (const Opal_BufferTransitionDesc &transition : barrier.buffer_transitions)
+			EXPECT_NE(transition.buffer, output);
+}
+
+TEST_F(GraphTest, TransitionsImportsToFinalState)
+{
+	Opal_GraphResource imported = importBuffer(output, OPAL_BUFFER_STATE_GENERIC_READ, OPAL_BUFFER_STATE_GENERIC_READ);
+
+	addPass(0, {write(imported)});
+
+	ASSERT_EQ(opalExecuteGraph(graph, command_buffer), OPAL_SUCCESS);
+	ASSERT_EQ(passes.size(), 1);
+
+	ASSERT_EQ(passes[0].end_barriers.size(), 1);
+	EXPECT_EQ(passes[0].end_barriers[0].fence, OPAL_NULL_HANDLE);
+	ASSERT_EQ(passes[0].end_barriers[0].buffer_transitions.size(), 1);
+	EXPECT_EQ(passes[0].end_barriers[0].buffer_transitions[0].buffer, output);
+	EXPECT_EQ(passes[0].end_barriers[0].buffer_transitions[0].state_before, OPAL_BUFFER_STATE_UNORDERED_ACCESS);
+	EXPECT_EQ(passes[0].end_barriers[0].buffer_transitions[0].state_after, OPAL_BUFFER_STATE_GENERIC_READ);
+}
+
+TEST_F(GraphTest, AliasesTransients)
+{
+	Opal_GraphResource imported = importBuffer(output, OPAL_BUFFER_STATE_UNORDERED_ACCESS, OPAL_BUFFER_STATE_UNORDERED_ACCESS);
+	Opal_GraphResource first = createBuffer(buffer_desc);
+	Opal_GraphResource second = createBuffer(buffer_desc);
+	Opal_GraphResource third = createBuffer(buffer_desc);
+
+	Opal_BufferDesc larger_desc = buffer_desc;
+	larger_desc.size *= 2;
+	Opal_GraphResource larger = createBuffer(larger_desc);
+
+	addPass(0, {write(first)});
+	addPass(1, {read(first), write(second)});
+	addPass(2, {read(second), write(third)});
+	addPass(3, {read(third), write(larger)});
+	addPass(4, {read(larger), write(imported)});
+
+	ASSERT_EQ(opalExecuteGraph(graph, command_buffer), OPAL_SUCCESS);
+	ASSERT_EQ(order(), std::vector<uint32_t>({0, 1, 2, 3, 4}));
+
+	Opal_Buffer first_buffer = OPAL_NULL_HANDLE;
+	Opal_Buffer second_buffer = OPAL_NULL_HANDLE;
+	Opal_Buffer third_buffer = OPAL_NULL_HANDLE;
+	Opal_Buffer larger_buffer = OPAL_NULL_HANDLE;
+
+	ASSERT_EQ(opalGetGraphBuffer(graph, first, &first_buffer), OPAL_SUCCESS);
+	ASSERT_EQ(opalGetGraphBuffer(graph, second, &second_buffer), OPAL_SUCCESS);
+	ASSERT_EQ(opalGetGraphBuffer(graph, third, &third_buffer), OPAL_SUCCESS);
+	ASSERT_EQ(opalGetGraphBuffer(graph, larger, &larger_buffer), OPAL_SUCCESS);
+
+	// note: the first buffer is dead once the second pass ends, the third one reuses it
+	EXPECT_EQ(first_buffer, third_buffer);
+
+	// note: overlapping lifetimes and different descs never share
+	EXPECT_NE(first_buffer, second_buffer);
+	EXPECT_NE(larger_buffer, first_buffer);
+	EXPECT_NE(larger_buffer, second_buffer);
+}
+
+TEST_F(GraphTest, ReusesPhysicalsAcrossExecutions)
+{
+	Opal_GraphResource imported = importBuffer(output, OPAL_BUFFER_STATE_UNORDERED_ACCESS, OPAL_BUFFER_STATE_UNORDERED_ACCESS);
+	Opal_GraphResource transient = createBuffer(buffer_desc);
+
+	addPass(0, {write(transient)});
+	addPass(1, {read(transient), write(imported)});
+
+	ASSERT_EQ(opalExecuteGraph(graph, command_buffer), OPAL_SUCCESS);
+
+	Opal_Buffer first_buffer = OPAL_NULL_HANDLE;
+	ASSERT_EQ(opalGetGraphBuffer(graph, transient, &first_buffer), OPAL_SUCCESS);
+
+	ASSERT_EQ(opalResetGraph(graph), OPAL_SUCCESS);
+
+	imported = importBuffer(output, OPAL_BUFFER_STATE_UNORDERED_ACCESS, OPAL_BUFFER_STATE_UNORDERED_ACCESS);
+	transient = createBuffer(buffer_desc);
+
+	addPass(0, {write(transient)});
+	addPass(1, {read(transient), write(imported)});
+
+	ASSERT_EQ(opalExecuteGraph(graph, command_buffer), OPAL_SUCCESS);
+
+	Opal_Buffer second_buffer = OPAL_NULL_HANDLE;
+	ASSERT_EQ(opalGetGraphBuffer(graph, transient, &second_buffer), OPAL_SUCCESS);
+	EXPECT_EQ(first_buffer, second_buffer);
+}
+
+TEST_F(GraphTest, InvalidArguments)
+{
+	Opal_GraphResource resource = OPAL_NULL_HANDLE;
+
+	EXPECT_EQ(opalImportGraphTexture(graph, OPAL_NULL_HANDLE, OPAL_TEXTURE_STATE_UNDEFINED, OPAL_TEXTURE_STATE_UNDEFINED, &resource), OPAL_INVALID_TEXTURE_VIEW);
+	EXPECT_EQ(opalCreateGraphBuffer(graph, nullptr, &resource), OPAL_INVALID_ARGUMENT);
+	EXPECT_EQ(opalCreateGraphTexture(graph, nullptr, &resource), OPAL_INVALID_ARGUMENT);
+	EXPECT_EQ(opalAddGraphPass(graph, nullptr), OPAL_INVALID_ARGUMENT);
+	EXPECT_EQ(opalExecuteGraph(graph, OPAL_NULL_HANDLE), OPAL_INVALID_COMMAND_BUFFER);
+	EXPECT_EQ(opalExecuteGraph(OPAL_NULL_HANDLE, command_buffer), OPAL_INVALID_GRAPH);
+}
+
+int main(int argc, char **argv)
+{
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
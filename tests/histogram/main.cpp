@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "histogram.h"
+}
+
+class HistogramTest : public testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		opal_histogramReset(&histogram);
+	}
+
+	Opal_Histogram histogram {};
+};
+
+TEST_F(HistogramTest, Empty)
+{
+	EXPECT_EQ(histogram.count, 0);
+	EXPECT_EQ(opal_histogramGetPercentile(&histogram, 0.5), 0);
+	EXPECT_EQ(opal_histogramGetPercentile(&histogram, 0.99), 0);
+}
+
+TEST_F(HistogramTest, SmallValuesAreExact)
+{
+	for (uint64_t i = 0; i < 16; ++i)
+		opal_histogramAdd(&histogram, i);
+
+	EXPECT_EQ(histogram.count, 16);
+	EXPECT_EQ(histogram.sum, 120);
+	EXPECT_EQ(histogram.min, 0);
+	EXPECT_EQ(histogram.max, 15);
+
+	EXPECT_EQ(opal_histogramGetPercentile(&histogram, 0.0), 0);
+	EXPECT_EQ(opal_histogramGetPercentile(&histogram, 0.5), 7);
+	EXPECT_EQ(opal_histogramGetPercentile(&histogram, 1.0), 15);
+}
+
+TEST_F(HistogramTest, SingleValue)
+{
+	opal_histogramAdd(&histogram, 123456);
+
+	EXPECT_EQ(opal_histogramGetPercentile(&histogram, 0.0), 123456);
+	EXPECT_EQ(opal_histogramGetPercentile(&histogram, 0.5), 123456);
+	EXPECT_EQ(opal_histogramGetPercentile(&histogram, 1.0), 123456);
+}
+
+TEST_F(HistogramTest, PercentilesWithinBucketError)
+{
+	for (uint64_t i = 1; i <= 10000; ++i)
+		opal_histogramAdd(&histogram, i * 100);
+
+	uint64_t p50 = opal_histogramGetPercentile(&histogram, 0.5);
+	uint64_t p99 = opal_histogramGetPercentile(&histogram, 0.99);
+
+	EXPECT_NEAR((double)p50, 500000.0, 500000.0 * 0.125);
+	EXPECT_NEAR((double)p99, 990000.0, 990000.0 * 0.125);
+	EXPECT_EQ(opal_histogramGetPercentile(&histogram, 1.0), 1000000);
+}
+
+TEST_F(HistogramTest, Outliers)
+{
+	for (uint32_t i = 0; i < 99; ++i)
+		opal_histogramAdd(&histogram, 1000);
+
+	opal_histogramAdd(&histogram, UINT64_MAX);
+
+	EXPECT_NEAR((double)opal_histogramGetPercentile(&histogram, 0.5), 1000.0, 1000.0 * 0.125);
+	EXPECT_EQ(histogram.max, UINT64_MAX);
+	EXPECT_EQ(opal_histogramGetPercentile(&histogram, 1.0), UINT64_MAX);
+}
+
+TEST_F(HistogramTest, Reset)
+{
+	opal_histogramAdd(&histogram, 42);
+	opal_histogramReset(&histogram);
+
+	EXPECT_EQ(histogram.count, 0);
+	EXPECT_EQ(histogram.sum, 0);
+	EXPECT_EQ(histogram.max, 0);
+	EXPECT_EQ(opal_histogramGetPercentile(&histogram, 0.5), 0);
+}
+
+int main(int argc, char **argv)
+{
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,203 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+extern "C"
+{
+#include "instances.h"
+}
+
+// note: mirrors VkAccelerationStructureInstanceKHR and D3D12_RAYTRACING_INSTANCE_DESC
+struct NativeInstance
+{
+	float transform[12];
+	uint32_t custom_index_and_mask;
+	uint32_t offset_and_flags;
+	uint64_t address;
+};
+
+static_assert(sizeof(NativeInstance) == sizeof(Opal_AccelerationStructureInstance), "instance sizes must match");
+
+static Opal_AccelerationStructureInstance makeInstance(uint32_t index)
+{
+	Opal_AccelerationStructureInstance instance = {};
+
+	for (uint32_t row = 0; row < 3; ++row)
+		for (uint32_t column = 0; column < 4; ++column)
+			instance.transform[row][column] = (float)(index * 12 + row * 4 + column);
+
+	instance.custom_index = index & 0xFFFFFF;
+	instance.mask = (index * 7) & 0xFF;
+	instance.intersection_index_offset = (index * 3) & 0xFFFFFF;
+	instance.flags = (Opal_AccelerationStructureInstanceFlags)(index & 0xF);
+	instance.blas = index % 17 + 1;
+
+	return instance;
+}
+
+static uint64_t resolveAddress(void *device, Opal_AccelerationStructure blas)
+{
+	const uint64_t *base = (const uint64_t *)device;
+	return *base + blas * 0x100;
+}
+
+static void expectPacked(const uint8_t *data, const std::vector<Opal_AccelerationStructureInstance> &instances, uint64_t base)
+{
+	for (uint32_t i = 0; i < instances.size(); ++i)
+	{
+		const Opal_AccelerationStructureInstance &instance = instances[i];
+
+		NativeInstance native;
+		memcpy(&native, data + i * sizeof(NativeInstance), sizeof(NativeInstance));
+
+		for (uint32_t row = 0; row < 3; ++row)
+			for (uint32_t column = 0; column < 4; ++column)
+				ASSERT_EQ(native.transform[row * 4 + column], instance.transform[row][column]);
+
+		ASSERT_EQ(native.custom_index_and_mask & 0xFFFFFF, instance.custom_index);
+		ASSERT_EQ(native.custom_index_and_mask >> 24, instance.mask);
+		ASSERT_EQ(native.offset_and_flags & 0xFFFFFF, instance.intersection_index_offset);
+		ASSERT_EQ(native.offset_and_flags >> 24, (uint32_t)instance.flags);
+		ASSERT_EQ(native.address, base + instance.blas * 0x100);
+	}
+}
+
+class InstancePackerTest : public testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		Opal_Result result = opal_instancePackerInitialize(&packer, &base, 3);
+		ASSERT_EQ(result, OPAL_SUCCESS);
+	}
+
+	void TearDown() override
+	{
+		Opal_Result result = opal_instancePackerShutdown(&packer);
+		ASSERT_EQ(result, OPAL_SUCCESS);
+	}
+
+	void Fill(uint32_t count)
+	{
+		instances.resize(count);
+		addresses.resize(count);
+
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			instances[i] = makeInstance(i);
+			addresses[i] = base + instances[i].blas * 0x100;
+		}
+
+		// note: one extra instance of slack so tests can pack at unaligned offsets
+		storage.assign((count + 1) * sizeof(Opal_AccelerationStructureInstance) + 64, 0xCD);
+	}
+
+	uint8_t *Aligned(uint32_t offset)
+	{
+		uintptr_t ptr = (uintptr_t)storage.data();
+		ptr = (ptr + 63) & ~(uintptr_t)63;
+
+		return (uint8_t *)ptr + offset;
+	}
+
+	uint64_t base {0x1000000};
+	Opal_InstancePacker packer;
+	std::vector<Opal_AccelerationStructureInstance> instances;
+	std::vector<uint64_t> addresses;
+	std::vector<uint8_t> storage;
+};
+
+TEST_F(InstancePackerTest, PackAligned)
+{
+	Fill(37);
+
+	opal_instancesPack(Aligned(0), (uint32_t)instances.size(), instances.data(), addresses.data());
+	expectPacked(Aligned(0), instances, base);
+}
+
+TEST_F(InstancePackerTest, PackUnaligned)
+{
+	Fill(37);
+
+	opal_instancesPack(Aligned(8), (uint32_t)instances.size(), instances.data(), addresses.data());
+	expectPacked(Aligned(8), instances, base);
+}
+
+TEST_F(InstancePackerTest, PackDoesNotOverrun)
+{
+	Fill(5);
+
+	opal_instancesPack(Aligned(0), (uint32_t)instances.size(), instances.data(), addresses.data());
+
+	const uint8_t *tail = Aligned(0) + instances.size() * sizeof(Opal_AccelerationStructureInstance);
+	for (uint32_t i = 0; i < sizeof(Opal_AccelerationStructureInstance); ++i)
+		ASSERT_EQ(tail[i], 0xCD);
+}
+
+TEST_F(InstancePackerTest, RunResolved)
+{
+	Fill(1000);
+
+	opal_instancePackerRun(&packer, Aligned(0), (uint32_t)instances.size(), instances.data(), nullptr, resolveAddress);
+	expectPacked(Aligned(0), instances, base);
+}
+
+TEST_F(InstancePackerTest, RunThreadedResolved)
+{
+	Fill(OPAL_INSTANCE_PACKER_CHUNK_SIZE * 5 + 123);
+
+	opal_instancePackerRun(&packer, Aligned(0), (uint32_t)instances.size(), instances.data(), nullptr, resolveAddress);
+	expectPacked(Aligned(0), instances, base);
+}
+
+TEST_F(InstancePackerTest, RunThreadedPreResolved)
+{
+	Fill(OPAL_INSTANCE_PACKER_CHUNK_SIZE * 4 + 1);
+
+	opal_instancePackerRun(&packer, Aligned(16), (uint32_t)instances.size(), instances.data(), addresses.data(), nullptr);
+	expectPacked(Aligned(16), instances, base);
+}
+
+TEST_F(InstancePackerTest, RunRepeated)
+{
+	Fill(OPAL_INSTANCE_PACKER_CHUNK_SIZE * 3);
+
+	for (uint32_t i = 0; i < 8; ++i)
+	{
+		base += 0x1000;
+		for (uint32_t j = 0; j < instances.size(); ++j)
+			addresses[j] = base + instances[j].blas * 0x100;
+
+		const uint64_t *pre_resolved = (i % 2) ? addresses.data() : nullptr;
+		opal_instancePackerRun(&packer, Aligned(0), (uint32_t)instances.size(), instances.data(), pre_resolved, resolveAddress);
+		expectPacked(Aligned(0), instances, base);
+	}
+}
+
+TEST_F(InstancePackerTest, RunConcurrentFirstBuilds)
+{
+	Fill(OPAL_INSTANCE_PACKER_CHUNK_SIZE * 4);
+
+	// note: both builds race to start the workers, only one of them may spawn them
+	std::vector<uint8_t> other_storage(instances.size() * sizeof(Opal_AccelerationStructureInstance), 0xCD);
+
+	std::thread other([&]()
+	{
+		opal_instancePackerRun(&packer, other_storage.data(), (uint32_t)instances.size(), instances.data(), addresses.data(), nullptr);
+	});
+
+	opal_instancePackerRun(&packer, Aligned(0), (uint32_t)instances.size(), instances.data(), nullptr, resolveAddress);
+	other.join();
+
+	EXPECT_LE(packer.num_threads, 3u);
+	expectPacked(Aligned(0), instances, base);
+	expectPacked(other_storage.data(), instances, base);
+}
+
+int main(int argc, char **argv)
+{
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "map.h"
+}
+
+struct TestData
+{
+	uint64_t value;
+	uint64_t extra;
+};
+
+constexpr uint32_t map_element_size = sizeof(TestData);
+constexpr uint32_t map_capacity = 0;
+
+class MapTest : public testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		Opal_Result result = opal_mapInitialize(&map, map_element_size, map_capacity);
+		ASSERT_EQ(result, OPAL_SUCCESS);
+	}
+
+	void TearDown() override
+	{
+		Opal_Result result = opal_mapShutdown(&map);
+		ASSERT_EQ(result, OPAL_SUCCESS);
+	}
+
+	Opal_Map map;
+};
+
+TEST_F(MapTest, InsertFindRemove)
+{
+	for (uint64_t i = 0; i < 256; ++i)
+	{
+		TestData data = {i * 3, i * 7};
+		EXPECT_NE(opal_mapInsert(&map, i + 1, &data), nullptr);
+	}
+
+	EXPECT_EQ(opal_mapGetSize(&map), 256);
+
+	for (uint64_t i = 0; i < 256; ++i)
+	{
+		TestData *data = reinterpret_cast<TestData *>(opal_mapFind(&map, i + 1));
+		ASSERT_NE(data, nullptr);
+
+		EXPECT_EQ(data->value, i * 3);
+		EXPECT_EQ(data->extra, i * 7);
+	}
+
+	for (uint64_t i = 0; i < 256; ++i)
+		EXPECT_EQ(opal_mapRemove(&map, i + 1), OPAL_SUCCESS);
+
+	EXPECT_EQ(opal_mapGetSize(&map), 0);
+	EXPECT_EQ(opal_mapFind(&map, 1), nullptr);
+}
+
+TEST_F(MapTest, InsertOverwrites)
+{
+	TestData first = {1, 2};
+	TestData second = {3, 4};
+
+	opal_mapInsert(&map, 42, &first);
+	opal_mapInsert(&map, 42, &second);
+
+	EXPECT_EQ(opal_mapGetSize(&map), 1);
+
+	TestData *data = reinterpret_cast<TestData *>(opal_mapFind(&map, 42));
+	ASSERT_NE(data, nullptr);
+	EXPECT_EQ(data->value, 3);
+	EXPECT_EQ(data->extra, 4);
+}
+
+TEST_F(MapTest, RemoveMissing)
+{
+	TestData data = {1, 2};
+
+	EXPECT_EQ(opal_mapRemove(&map, 42), OPAL_INTERNAL_ERROR);
+
+	opal_mapInsert(&map, 42, &data);
+	EXPECT_EQ(opal_mapRemove(&map, 42), OPAL_SUCCESS);
+	EXPECT_EQ(opal_mapRemove(&map, 42), OPAL_INTERNAL_ERROR);
+}
+
+TEST_F(MapTest, RemoveKeepsProbeChains)
+{
+	// note: keys are handle-like values, interleave removals to exercise backward shift
+	for (uint64_t i = 0; i < 1024; ++i)
+	{
+		TestData data = {i, 0};
+		opal_mapInsert(&map, (i << 32) | 1, &data);
+	}
+
+	for (uint64_t i = 0; i < 1024; i += 2)
+		EXPECT_EQ(opal_mapRemove(&map, (i << 32) | 1), OPAL_SUCCESS);
+
+	EXPECT_EQ(opal_mapGetSize(&map), 512);
+
+	for (uint64_t i = 0; i < 1024; ++i)
+	{
+		TestData *data = reinterpret_cast<TestData *>(opal_mapFind(&map, (i << 32) | 1));
+		if (i % 2 == 0)
+		{
+			EXPECT_EQ(data, nullptr);
+		}
+		else
+		{
+			ASSERT_NE(data, nullptr);
+			EXPECT_EQ(data->value, i);
+		}
+	}
+}
+
+TEST_F(MapTest, Iterate)
+{
+	uint64_t expected_sum = 0;
+	for (uint64_t i = 0; i < 100; ++i)
+	{
+		TestData data = {i, 0};
+		opal_mapInsert(&map, i + 1000, &data);
+		expected_sum += i;
+	}
+
+	uint64_t sum = 0;
+	uint32_t count = 0;
+
+	uint32_t index = opal_mapGetFirstIndex(&map);
+	while (index != OPAL_MAP_INDEX_NULL)
+	{
+		TestData *data = reinterpret_cast<TestData *>(opal_mapGetElementByIndex(&map, index));
+		EXPECT_EQ(opal_mapGetKeyByIndex(&map, index), data->value + 1000);
+
+		sum += data->value;
+		count++;
+
+		index = opal_mapGetNextIndex(&map, index);
+	}
+
+	EXPECT_EQ(count, 100);
+	EXPECT_EQ(sum, expected_sum);
+}
+
+TEST_F(MapTest, Clear)
+{
+	TestData data = {1, 2};
+	for (uint64_t i = 0; i < 64; ++i)
+		opal_mapInsert(&map, i, &data);
+
+	EXPECT_EQ(opal_mapClear(&map), OPAL_SUCCESS);
+	EXPECT_EQ(opal_mapGetSize(&map), 0);
+	EXPECT_EQ(opal_mapGetFirstIndex(&map), OPAL_MAP_INDEX_NULL);
+	EXPECT_EQ(opal_mapFind(&map, 0), nullptr);
+}
+
+int main(int argc, char **argv)
+{
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
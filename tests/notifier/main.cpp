@@ -0,0 +1,332 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+extern "C"
+{
+#include "notifier.h"
+}
+
+constexpr uint32_t max_semaphores = 8;
+
+struct TestDevice
+{
+	std::atomic<uint64_t> values[max_semaphores];
+	std::atomic<uint32_t> num_semaphores;
+	std::atomic<uint32_t> num_waits;
+};
+
+struct TestCallbacks
+{
+	std::atomic<uint32_t> count;
+	std::vector<uint64_t> values;
+	Opal_Notifier *notifier;
+	uint64_t chained_value;
+};
+
+static Opal_Result createTestSemaphore(void *device, uint64_t *semaphore)
+{
+	TestDevice *device_ptr = (TestDevice *)device;
+
+	*semaphore = device_ptr->num_semaphores++;
+	device_ptr->values[*semaphore] = 0;
+	return OPAL_SUCCESS;
+}
+
+static void destroyTestSemaphore(void *, uint64_t)
+{
+}
+
+static uint64_t queryTestSemaphore(void *device, uint64_t semaphore)
+{
+	TestDevice *device_ptr = (TestDevice *)device;
+	return device_ptr->values[semaphore];
+}
+
+static void signalTestSemaphore(void *device, uint64_t semaphore, uint64_t value)
+{
+	TestDevice *device_ptr = (TestDevice *)device;
+	device_ptr->values[semaphore] = value;
+}
+
+static void waitTestSemaphores(void *device, uint32_t num_semaphores, const uint64_t *semaphores, const uint64_t *values, Opal_Bump *scratch)
+{
+	TestDevice *device_ptr = (TestDevice *)device;
+	device_ptr->num_waits++;
+
+	// note: exercise the scratch the backend gets for converting handles
+	uint32_t offset = opal_bumpAlloc(scratch, sizeof(uint64_t) * num_semaphores);
+	uint64_t *temp = (uint64_t *)(scratch->data + offset);
+
+	for (uint32_t i = 0; i < num_semaphores; ++i)
+		temp[i] = semaphores[i];
+
+	while (1)
+	{
+		for (uint32_t i = 0; i < num_semaphores; ++i)
+			if (device_ptr->values[temp[i]] >= values[i])
+				return;
+
+		std::this_thread::yield();
+	}
+}
+
+static void testCallback(void *user_data, Opal_Semaphore, uint64_t value)
+{
+	TestCallbacks *callbacks = (TestCallbacks *)user_data;
+	callbacks->values.push_back(value);
+	callbacks->count++;
+}
+
+static void chainedCallback(void *user_data, Opal_Semaphore semaphore, uint64_t value)
+{
+	TestCallbacks *callbacks = (TestCallbacks *)user_data;
+	testCallback(user_data, semaphore, value);
+
+	if (callbacks->chained_value > 0)
+	{
+		uint64_t chained_value = callbacks->chained_value;
+		callbacks->chained_value = 0;
+
+		opal_notifierRegister(callbacks->notifier, semaphore, semaphore, chained_value, testCallback, callbacks);
+	}
+}
+
+static bool waitForCount(const TestCallbacks &callbacks, uint32_t count)
+{
+	auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+	while (callbacks.count.load() < count)
+	{
+		if (std::chrono::steady_clock::now() > deadline)
+			return false;
+
+		std::this_thread::yield();
+	}
+
+	return true;
+}
+
+class NotifierTest : public testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		device.num_semaphores = 0;
+		device.num_waits = 0;
+
+		for (uint32_t i = 0; i < max_semaphores; ++i)
+			device.values[i] = 0;
+
+		callbacks.count = 0;
+		callbacks.values.clear();
+		callbacks.notifier = &notifier;
+		callbacks.chained_value = 0;
+
+		// note: semaphores the tests wait on come first, the wake semaphore is created last
+		semaphores[0] = device.num_semaphores++;
+		semaphores[1] = device.num_semaphores++;
+	}
+
+	void Initialize(bool threaded)
+	{
+		Opal_NotifierFunctions functions = {};
+		functions.query = queryTestSemaphore;
+
+		if (threaded)
+		{
+			functions.create = createTestSemaphore;
+			functions.destroy = destroyTestSemaphore;
+			functions.signal = signalTestSemaphore;
+			functions.wait = waitTestSemaphores;
+		}
+
+		Opal_Result result = opal_notifierInitialize(&notifier, &device, &functions);
+		ASSERT_EQ(result, OPAL_SUCCESS);
+	}
+
+	void Shutdown()
+	{
+		Opal_Result result = opal_notifierShutdown(&notifier);
+		ASSERT_EQ(result, OPAL_SUCCESS);
+	}
+
+	Opal_Result Register(uint32_t index, uint64_t value, PFN_opalSemaphoreCallback callback = testCallback)
+	{
+		return opal_notifierRegister(&notifier, (Opal_Semaphore)semaphores[index], semaphores[index], value, callback, &callbacks);
+	}
+
+	TestDevice device;
+	TestCallbacks callbacks;
+	Opal_Notifier notifier;
+	uint64_t semaphores[2];
+};
+
+TEST_F(NotifierTest, ThreadedRunsWhenReached)
+{
+	Initialize(true);
+
+	ASSERT_EQ(Register(0, 1), OPAL_SUCCESS);
+	ASSERT_EQ(Register(0, 2), OPAL_SUCCESS);
+	ASSERT_EQ(Register(1, 5), OPAL_SUCCESS);
+
+	device.values[semaphores[0]] = 1;
+	ASSERT_TRUE(waitForCount(callbacks, 1));
+
+	device.values[semaphores[1]] = 5;
+	ASSERT_TRUE(waitForCount(callbacks, 2));
+
+	device.values[semaphores[0]] = 2;
+	ASSERT_TRUE(waitForCount(callbacks, 3));
+
+	Shutdown();
+
+	ASSERT_EQ(callbacks.values.size(), 3u);
+	EXPECT_EQ(callbacks.values[0], 1u);
+	EXPECT_EQ(callbacks.values[1], 5u);
+	EXPECT_EQ(callbacks.values[2], 2u);
+}
+
+TEST_F(NotifierTest, ThreadedAlreadyReached)
+{
+	Initialize(true);
+
+	device.values[semaphores[0]] = 10;
+
+	for (uint64_t i = 1; i <= 10; ++i)
+		ASSERT_EQ(Register(0, i), OPAL_SUCCESS);
+
+	ASSERT_TRUE(waitForCount(callbacks, 10));
+	Shutdown();
+
+	for (uint64_t i = 0; i < 10; ++i)
+		EXPECT_EQ(callbacks.values[i], i + 1);
+}
+
+TEST_F(NotifierTest, ThreadedWaitsOncePerSemaphore)
+{
+	Initialize(true);
+
+	ASSERT_EQ(Register(0, 1), OPAL_SUCCESS);
+	ASSERT_EQ(Register(0, 1), OPAL_SUCCESS);
+	ASSERT_EQ(Register(0, 1), OPAL_SUCCESS);
+
+	// note: all three are waited on through a single entry, one signal runs them together
+	device.values[semaphores[0]] = 1;
+	ASSERT_TRUE(waitForCount(callbacks, 3));
+
+	Shutdown();
+	EXPECT_EQ(callbacks.count.load(), 3u);
+}
+
+TEST_F(NotifierTest, ThreadedChained)
+{
+	Initialize(true);
+
+	callbacks.chained_value = 2;
+	ASSERT_EQ(Register(0, 1, chainedCallback), OPAL_SUCCESS);
+
+	device.values[semaphores[0]] = 1;
+	ASSERT_TRUE(waitForCount(callbacks, 1));
+
+	device.values[semaphores[0]] = 2;
+	ASSERT_TRUE(waitForCount(callbacks, 2));
+
+	Shutdown();
+}
+
+TEST_F(NotifierTest, PollRunsWhenReached)
+{
+	Initialize(false);
+
+	device.values[semaphores[0]] = 1;
+
+	// note: reached values run inline
+	ASSERT_EQ(Register(0, 1), OPAL_SUCCESS);
+	EXPECT_EQ(callbacks.count.load(), 1u);
+
+	ASSERT_EQ(Register(0, 3), OPAL_SUCCESS);
+	ASSERT_EQ(Register(1, 1), OPAL_SUCCESS);
+	EXPECT_EQ(callbacks.count.load(), 1u);
+
+	device.values[semaphores[0]] = 3;
+	opal_notifierPoll(&notifier);
+	EXPECT_EQ(callbacks.count.load(), 2u);
+
+	opal_notifierPoll(&notifier);
+	EXPECT_EQ(callbacks.count.load(), 2u);
+
+	Shutdown();
+
+	// note: unreached values are dropped
+	EXPECT_EQ(callbacks.count.load(), 2u);
+	EXPECT_EQ(device.num_waits.load(), 0u);
+}
+
+TEST_F(NotifierTest, PollChained)
+{
+	Initialize(false);
+
+	callbacks.chained_value = 1;
+	ASSERT_EQ(Register(0, 1, chainedCallback), OPAL_SUCCESS);
+
+	device.values[semaphores[0]] = 1;
+	opal_notifierPoll(&notifier);
+
+	// note: the callback registered from inside the poll is already reached and runs in the same poll
+	EXPECT_EQ(callbacks.count.load(), 2u);
+
+	Shutdown();
+}
+
+TEST_F(NotifierTest, Cancel)
+{
+	Initialize(true);
+
+	ASSERT_EQ(Register(0, 1), OPAL_SUCCESS);
+	ASSERT_EQ(Register(0, 2), OPAL_SUCCESS);
+	ASSERT_EQ(Register(1, 1), OPAL_SUCCESS);
+
+	// note: returns once the thread is done waiting on the semaphore
+	opal_notifierCancel(&notifier, semaphores[0]);
+	EXPECT_EQ(notifier.num_entries, 1u);
+
+	device.values[semaphores[0]] = 2;
+	device.values[semaphores[1]] = 1;
+	ASSERT_TRUE(waitForCount(callbacks, 1));
+
+	Shutdown();
+
+	ASSERT_EQ(callbacks.values.size(), 1u);
+	EXPECT_EQ(callbacks.values[0], 1u);
+}
+
+TEST_F(NotifierTest, ShutdownRunsReached)
+{
+	Initialize(true);
+
+	ASSERT_EQ(Register(0, 1), OPAL_SUCCESS);
+	ASSERT_EQ(Register(1, 1), OPAL_SUCCESS);
+
+	Shutdown();
+	EXPECT_EQ(callbacks.count.load(), 0u);
+
+	Initialize(true);
+
+	ASSERT_EQ(Register(0, 4), OPAL_SUCCESS);
+
+	// note: signaled right before shutdown, the thread may or may not see it, shutdown runs it either way
+	device.values[semaphores[0]] = 4;
+
+	Shutdown();
+	EXPECT_EQ(callbacks.count.load(), 1u);
+}
+
+int main(int argc, char **argv)
+{
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "pacing.h"
+}
+
+class PacingTest : public testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		opal_pacingInitialize(&pacing, 2);
+	}
+
+	uint64_t frame(uint64_t time)
+	{
+		opal_pacingAcquire(&pacing, time);
+		opal_pacingSubmit(&pacing, time + 1);
+		return opal_pacingPresent(&pacing, time + 2);
+	}
+
+	Opal_Pacing pacing {};
+};
+
+TEST_F(PacingTest, Empty)
+{
+	Opal_FrameTiming timing {};
+	opal_pacingGetTiming(&pacing, &timing);
+
+	EXPECT_EQ(timing.frame_id, 0);
+	EXPECT_EQ(timing.present_time, 0);
+	EXPECT_EQ(opal_pacingGetNextFrame(&pacing), 1);
+	EXPECT_EQ(opal_pacingGetThrottleFrame(&pacing), 0);
+}
+
+TEST_F(PacingTest, FrameIdsStartAtOne)
+{
+	EXPECT_EQ(frame(100), 1);
+	EXPECT_EQ(frame(200), 2);
+	EXPECT_EQ(opal_pacingGetNextFrame(&pacing), 3);
+}
+
+TEST_F(PacingTest, TimingWithoutDisplay)
+{
+	frame(100);
+
+	Opal_FrameTiming timing {};
+	opal_pacingGetTiming(&pacing, &timing);
+
+	EXPECT_EQ(timing.frame_id, 1);
+	EXPECT_EQ(timing.acquire_time, 100);
+	EXPECT_EQ(timing.submit_time, 101);
+	EXPECT_EQ(timing.present_time, 102);
+	EXPECT_EQ(timing.display_time, 0);
+}
+
+TEST_F(PacingTest, TimingPrefersDisplayedFrame)
+{
+	frame(100);
+	frame(200);
+	frame(300);
+	opal_pacingDisplay(&pacing, 2, 250);
+
+	Opal_FrameTiming timing {};
+	opal_pacingGetTiming(&pacing, &timing);
+
+	EXPECT_EQ(timing.frame_id, 2);
+	EXPECT_EQ(timing.acquire_time, 200);
+	EXPECT_EQ(timing.display_time, 250);
+}
+
+TEST_F(PacingTest, LastSubmitWins)
+{
+	opal_pacingAcquire(&pacing, 10);
+	opal_pacingSubmit(&pacing, 20);
+	opal_pacingSubmit(&pacing, 30);
+	opal_pacingPresent(&pacing, 40);
+
+	Opal_FrameTiming timing {};
+	opal_pacingGetTiming(&pacing, &timing);
+
+	EXPECT_EQ(timing.submit_time, 30);
+}
+
+TEST_F(PacingTest, SubmitWithoutAcquire)
+{
+	opal_pacingSubmit(&pacing, 20);
+	opal_pacingPresent(&pacing, 40);
+
+	Opal_FrameTiming timing {};
+	opal_pacingGetTiming(&pacing, &timing);
+
+	EXPECT_EQ(timing.frame_id, 1);
+	EXPECT_EQ(timing.acquire_time, 0);
+	EXPECT_EQ(timing.submit_time, 20);
+}
+
+TEST_F(PacingTest, StaleSlotIsReset)
+{
+	for (uint64_t i = 0; i < OPAL_PACING_MAX_FRAMES; ++i)
+		frame(i * 100);
+
+	// note: slot of frame 1 is reused by frame 17, acquire only must not leak old submit time
+	opal_pacingAcquire(&pacing, 5000);
+	opal_pacingPresent(&pacing, 5001);
+
+	Opal_FrameTiming timing {};
+	opal_pacingGetTiming(&pacing, &timing);
+
+	EXPECT_EQ(timing.frame_id, OPAL_PACING_MAX_FRAMES + 1);
+	EXPECT_EQ(timing.acquire_time, 5000);
+	EXPECT_EQ(timing.submit_time, 0);
+}
+
+TEST_F(PacingTest, DisplayIgnoresOldAndFutureFrames)
+{
+	frame(100);
+	frame(200);
+
+	opal_pacingDisplay(&pacing, 3, 999);
+	EXPECT_EQ(pacing.last_displayed_frame, 0);
+
+	opal_pacingDisplay(&pacing, 2, 250);
+	opal_pacingDisplay(&pacing, 1, 150);
+	EXPECT_EQ(pacing.last_displayed_frame, 2);
+
+	Opal_FrameTiming timing {};
+	opal_pacingGetTiming(&pacing, &timing);
+
+	EXPECT_EQ(timing.frame_id, 2);
+	EXPECT_EQ(timing.display_time, 250);
+}
+
+TEST_F(PacingTest, Throttle)
+{
+	frame(100);
+	EXPECT_EQ(opal_pacingGetThrottleFrame(&pacing), 0);
+
+	frame(200);
+	EXPECT_EQ(opal_pacingGetThrottleFrame(&pacing), 1);
+
+	opal_pacingDisplay(&pacing, 1, 150);
+	EXPECT_EQ(opal_pacingGetThrottleFrame(&pacing), 0);
+
+	frame(300);
+	EXPECT_EQ(opal_pacingGetThrottleFrame(&pacing), 2);
+
+	// note: a later frame on screen implies earlier ones are done
+	frame(400);
+	opal_pacingDisplay(&pacing, 3, 350);
+	EXPECT_EQ(opal_pacingGetThrottleFrame(&pacing), 0);
+}
+
+TEST_F(PacingTest, NoThrottleWithoutLimit)
+{
+	opal_pacingInitialize(&pacing, 0);
+
+	for (uint64_t i = 0; i < 8; ++i)
+		frame(i * 100);
+
+	EXPECT_EQ(opal_pacingGetThrottleFrame(&pacing), 0);
+}
+
+TEST_F(PacingTest, DisplayedFrameOutOfHistory)
+{
+	frame(100);
+	opal_pacingDisplay(&pacing, 1, 150);
+
+	for (uint64_t i = 1; i <= OPAL_PACING_MAX_FRAMES; ++i)
+		frame(i * 1000);
+
+	Opal_FrameTiming timing {};
+	opal_pacingGetTiming(&pacing, &timing);
+
+	EXPECT_EQ(timing.frame_id, OPAL_PACING_MAX_FRAMES + 1);
+	EXPECT_EQ(timing.display_time, 0);
+}
+
+int main(int argc, char **argv)
+{
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,269 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <opal.h>
+
+struct ReadbackResult
+{
+	uint32_t id;
+	std::vector<uint8_t> data;
+};
+
+class ReadbackTest : public testing::Test
+{
+protected:
+	struct Tag
+	{
+		ReadbackTest *test;
+		uint32_t id;
+	};
+
+	static const uint32_t source_size = 4096;
+	static const uint32_t ring_size = 1024;
+	static const uint32_t max_tags = 16;
+
+	void SetUp() override
+	{
+		Opal_InstanceDesc instance_desc = {};
+		instance_desc.application_name = "test_readback";
+		instance_desc.engine_name = "opal";
+
+		ASSERT_EQ(opalCreateInstance(OPAL_API_NULL, &instance_desc, &instance), OPAL_SUCCESS);
+		ASSERT_EQ(opalCreateDefaultDevice(instance, OPAL_DEVICE_HINT_DEFAULT, &device), OPAL_SUCCESS);
+		ASSERT_EQ(opalGetDeviceQueue(device, OPAL_DEVICE_ENGINE_TYPE_MAIN, 0, &queue), OPAL_SUCCESS);
+		ASSERT_EQ(opalCreateCommandAllocator(device, queue, &command_allocator), OPAL_SUCCESS);
+		ASSERT_EQ(opalCreateCommandBuffer(device, command_allocator, &command_buffer), OPAL_SUCCESS);
+
+		Opal_SemaphoreDesc semaphore_desc = {};
+		ASSERT_EQ(opalCreateSemaphore(device, &semaphore_desc, &semaphore), OPAL_SUCCESS);
+		ASSERT_EQ(opalCreateSemaphore(device, &semaphore_desc, &other_semaphore), OPAL_SUCCESS);
+
+		Opal_BufferDesc buffer_desc = {};
+		buffer_desc.size = source_size;
+		buffer_desc.memory_type = OPAL_ALLOCATION_MEMORY_TYPE_UPLOAD;
+		buffer_desc.usage = OPAL_BUFFER_USAGE_COPY_SRC;
+
+		ASSERT_EQ(opalCreateBuffer(device, &buffer_desc, &source), OPAL_SUCCESS);
+
+		uint8_t *data = nullptr;
+		ASSERT_EQ(opalMapBuffer(device, source, (void **)&data), OPAL_SUCCESS);
+
+		for (uint32_t i = 0; i < source_size; ++i)
+			data[i] = (uint8_t)(i * 7);
+
+		ASSERT_EQ(opalUnmapBuffer(device, source), OPAL_SUCCESS);
+
+		Opal_ReadbackDesc readback_desc = {};
+		readback_desc.ring_size = ring_size;
+
+		ASSERT_EQ(opalCreateReadback(device, &readback_desc, &readback), OPAL_SUCCESS);
+
+		for (uint32_t i = 0; i < max_tags; ++i)
+			tags[i] = {this, i};
+	}
+
+	void TearDown() override
+	{
+		if (readback != OPAL_NULL_HANDLE)
+			opalDestroyReadback(readback);
+
+		opalDestroyBuffer(device, source);
+		opalDestroySemaphore(device, other_semaphore);
+		opalDestroySemaphore(device, semaphore);
+		opalDestroyCommandBuffer(device, command_buffer);
+		opalDestroyCommandAllocator(device, command_allocator);
+		opalDestroyDevice(device);
+		opalDestroyInstance(instance);
+	}
+
+	static void callback(void *user_data, const void *data, uint64_t size)
+	{
+		Tag *tag = (Tag *)user_data;
+		ReadbackTest *test = tag->test;
+
+		const uint8_t *bytes = (const uint8_t *)data;
+
+		std::lock_guard<std::mutex> lock(test->mutex);
+		test->results.push_back({tag->id, std::vector<uint8_t>(bytes, bytes + size)});
+		test->condition.notify_all();
+	}
+
+	Opal_Result read(uint32_t id, uint64_t offset, uint64_t size)
+	{
+		return opalReadbackAsync(readback, command_buffer, source, offset, size, callback, &tags[id]);
+	}
+
+	void submit(Opal_Semaphore signal_semaphore, uint64_t value)
+	{
+		ASSERT_EQ(opalFlushReadbacks(readback, signal_semaphore, value), OPAL_SUCCESS);
+
+		Opal_SubmitDesc submit_desc = {};
+		submit_desc.num_command_buffers = 1;
+		submit_desc.command_buffers = &command_buffer;
+		submit_desc.num_signal_semaphores = 1;
+		submit_desc.signal_semaphores = &signal_semaphore;
+		submit_desc.signal_values = &value;
+
+		ASSERT_EQ(opalSubmit(device, queue, &submit_desc), OPAL_SUCCESS);
+	}
+
+	bool waitResults(size_t count)
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		return condition.wait_for(lock, std::chrono::seconds(5), [&] { return results.size() >= count; });
+	}
+
+	size_t numResults()
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		return results.size();
+	}
+
+	void expectSource(const ReadbackResult &result, uint64_t offset)
+	{
+		for (size_t i = 0; i < result.data.size(); ++i)
+			ASSERT_EQ(result.data[i], (uint8_t)((offset + i) * 7));
+	}
+
+	Opal_Instance instance {OPAL_NULL_HANDLE};
+	Opal_Device device {OPAL_NULL_HANDLE};
+	Opal_Queue queue {OPAL_NULL_HANDLE};
+	Opal_CommandAllocator command_allocator {OPAL_NULL_HANDLE};
+	Opal_CommandBuffer command_buffer {OPAL_NULL_HANDLE};
+	Opal_Semaphore semaphore {OPAL_NULL_HANDLE};
+	Opal_Semaphore other_semaphore {OPAL_NULL_HANDLE};
+	Opal_Buffer source {OPAL_NULL_HANDLE};
+	Opal_Readback readback {OPAL_NULL_HANDLE};
+
+	Tag tags[max_tags];
+
+	std::mutex mutex;
+	std::condition_variable condition;
+	std::vector<ReadbackResult> results;
+};
+
+TEST_F(ReadbackTest, CallbacksRunWithoutPolling)
+{
+	ASSERT_EQ(read(0, 0, 64), OPAL_SUCCESS);
+	ASSERT_EQ(read(1, 1000, 100), OPAL_SUCCESS);
+	ASSERT_EQ(read(2, 4000, 96), OPAL_SUCCESS);
+	submit(semaphore, 1);
+
+	ASSERT_TRUE(waitResults(3));
+
+	std::lock_guard<std::mutex> lock(mutex);
+	ASSERT_EQ(results.size(), 3);
+
+	EXPECT_EQ(results[0].id, 0);
+	EXPECT_EQ(results[0].data.size(), 64);
+	expectSource(results[0], 0);
+
+	EXPECT_EQ(results[1].id, 1);
+	EXPECT_EQ(results[1].data.size(), 100);
+	expectSource(results[1], 1000);
+
+	EXPECT_EQ(results[2].id, 2);
+	EXPECT_EQ(results[2].data.size(), 96);
+	expectSource(results[2], 4000);
+}
+
+TEST_F(ReadbackTest, WaitsForSemaphore)
+{
+	ASSERT_EQ(read(0, 0, 64), OPAL_SUCCESS);
+	ASSERT_EQ(opalFlushReadbacks(readback, semaphore, 1), OPAL_SUCCESS);
+
+	EXPECT_EQ(opalPollReadbacks(readback), OPAL_SUCCESS);
+	EXPECT_EQ(numResults(), 0);
+
+	ASSERT_EQ(opalSignalSemaphore(device, semaphore, 1), OPAL_SUCCESS);
+	ASSERT_TRUE(waitResults(1));
+}
+
+TEST_F(ReadbackTest, SubmissionOrderAcrossSemaphores)
+{
+	ASSERT_EQ(read(0, 0, 16), OPAL_SUCCESS);
+	ASSERT_EQ(opalFlushReadbacks(readback, semaphore, 1), OPAL_SUCCESS);
+
+	ASSERT_EQ(read(1, 16, 16), OPAL_SUCCESS);
+	ASSERT_EQ(opalFlushReadbacks(readback, other_semaphore, 1), OPAL_SUCCESS);
+
+	// note: the later flush completes first, but its callback must not overtake the earlier one
+	ASSERT_EQ(opalSignalSemaphore(device, other_semaphore, 1), OPAL_SUCCESS);
+	EXPECT_EQ(numResults(), 0);
+
+	ASSERT_EQ(opalSignalSemaphore(device, semaphore, 1), OPAL_SUCCESS);
+	ASSERT_TRUE(waitResults(2));
+
+	std::lock_guard<std::mutex> lock(mutex);
+	EXPECT_EQ(results[0].id, 0);
+	EXPECT_EQ(results[1].id, 1);
+}
+
+TEST_F(ReadbackTest, RingFullUntilCallbacksRun)
+{
+	ASSERT_EQ(read(0, 0, ring_size), OPAL_SUCCESS);
+	EXPECT_EQ(read(1, 0, 16), OPAL_NO_MEMORY);
+
+	submit(semaphore, 1);
+	ASSERT_TRUE(waitResults(1));
+
+	// note: ring space is released by the completion thread right after the callback returns
+	Opal_Result result = OPAL_NO_MEMORY;
+	for (uint32_t i = 0; i < 1000 && result == OPAL_NO_MEMORY; ++i)
+	{
+		result = read(1, 0, ring_size);
+		if (result == OPAL_NO_MEMORY)
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	EXPECT_EQ(result, OPAL_SUCCESS);
+}
+
+TEST_F(ReadbackTest, FailedRecordReleasesRingSpace)
+{
+	ASSERT_EQ(read(0, 0, ring_size / 2), OPAL_SUCCESS);
+
+	for (uint32_t i = 0; i < 4; ++i)
+		EXPECT_EQ(read(1, source_size - 16, ring_size / 2), OPAL_INVALID_ARGUMENT);
+
+	EXPECT_EQ(read(2, 0, ring_size / 2), OPAL_SUCCESS);
+
+	submit(semaphore, 1);
+	ASSERT_TRUE(waitResults(2));
+
+	std::lock_guard<std::mutex> lock(mutex);
+	EXPECT_EQ(results[0].id, 0);
+	EXPECT_EQ(results[1].id, 2);
+}
+
+TEST_F(ReadbackTest, DestroyRunsFlushedCallbacks)
+{
+	ASSERT_EQ(read(0, 0, 32), OPAL_SUCCESS);
+	submit(semaphore, 1);
+
+	ASSERT_EQ(read(1, 0, 32), OPAL_SUCCESS);
+
+	ASSERT_EQ(opalDestroyReadback(readback), OPAL_SUCCESS);
+	readback = OPAL_NULL_HANDLE;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	ASSERT_EQ(results.size(), 1);
+	EXPECT_EQ(results[0].id, 0);
+	expectSource(results[0], 0);
+}
+
+TEST_F(ReadbackTest, NullSemaphore)
+{
+	EXPECT_EQ(opalFlushReadbacks(readback, OPAL_NULL_HANDLE, 1), OPAL_INVALID_SEMAPHORE);
+}
+
+int main(int argc, char **argv)
+{
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
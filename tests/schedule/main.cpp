@@ -0,0 +1,299 @@
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+#include <opal.h>
+
+// note: mirrors Opal_DeviceInternal, every backend device starts with its table
+struct DeviceHeader
+{
+	Opal_DeviceTable *vtbl;
+};
+
+typedef std::pair<Opal_Semaphore, uint64_t> SemaphoreValue;
+
+struct RecordedSubmit
+{
+	Opal_Queue queue;
+	std::vector<SemaphoreValue> waits;
+	std::vector<SemaphoreValue> signals;
+};
+
+class ScheduleTest : public testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		Opal_InstanceDesc instance_desc = {};
+		instance_desc.application_name = "test_schedule";
+		instance_desc.engine_name = "opal";
+
+		ASSERT_EQ(opalCreateInstance(OPAL_API_NULL, &instance_desc, &instance), OPAL_SUCCESS);
+		ASSERT_EQ(opalCreateDefaultDevice(instance, OPAL_DEVICE_HINT_DEFAULT, &device), OPAL_SUCCESS);
+
+		Opal_SemaphoreDesc semaphore_desc = {};
+		semaphore_desc.flags = OPAL_SEMAPHORE_CREATION_FLAGS_HOST_OPERATIONS;
+		ASSERT_EQ(opalCreateSemaphore(device, &semaphore_desc, &external), OPAL_SUCCESS);
+
+		// note: submits are intercepted to check the waits and signals the scheduler puts on them
+		DeviceHeader *device_ptr = (DeviceHeader *)device;
+		ASSERT_EQ(opalGetDeviceTable(device, &table), OPAL_SUCCESS);
+
+		original_table = device_ptr->vtbl;
+		next_submit = table.submit;
+		table.submit = recordSubmit;
+		device_ptr->vtbl = &table;
+
+		current = this;
+
+		ASSERT_EQ(opalCreateScheduler(device, &scheduler), OPAL_SUCCESS);
+	}
+
+	void TearDown() override
+	{
+		if (scheduler != OPAL_NULL_HANDLE)
+			opalDestroyScheduler(scheduler);
+
+		if (original_table != nullptr)
+			((DeviceHeader *)device)->vtbl = original_table;
+
+		current = nullptr;
+
+		opalDestroySemaphore(device, external);
+		opalDestroyDevice(device);
+		opalDestroyInstance(instance);
+	}
+
+	static Opal_Result recordSubmit(Opal_Device device, Opal_Queue queue, const Opal_SubmitDesc *desc)
+	{
+		RecordedSubmit submit = {};
+		submit.queue = queue;
+
+		for (uint32_t i = 0; i < desc->num_wait_semaphores; ++i)
+			submit.waits.push_back({desc->wait_semaphores[i], desc->wait_values[i]});
+
+		for (uint32_t i = 0; i < desc->num_signal_semaphores; ++i)
+			submit.signals.push_back({desc->signal_semaphores[i], desc->signal_values[i]});
+
+		current->submits.push_back(submit);
+		return current->next_submit(device, queue, desc);
+	}
+
+	Opal_Result trySchedule(Opal_DeviceEngineType engine_type, const std::vector<SemaphoreValue> &dependencies, SemaphoreValue *result)
+	{
+		std::vector<Opal_Semaphore> semaphores;
+		std::vector<uint64_t> values;
+
+		for (const SemaphoreValue &dependency : dependencies)
+		{
+			semaphores.push_back(dependency.first);
+			values.push_back(dependency.second);
+		}
+
+		Opal_ScheduleDesc desc = {};
+		desc.engine_type = engine_type;
+		desc.num_dependencies = (uint32_t)dependencies.size();
+		desc.dependency_semaphores = semaphores.data();
+		desc.dependency_values = values.data();
+
+		return opalSchedule(scheduler, &desc, &result->first, &result->second);
+	}
+
+	SemaphoreValue schedule(Opal_DeviceEngineType engine_type, const std::vector<SemaphoreValue> &dependencies = {})
+	{
+		SemaphoreValue result = {OPAL_NULL_HANDLE, 0};
+		EXPECT_EQ(trySchedule(engine_type, dependencies, &result), OPAL_SUCCESS);
+
+		return result;
+	}
+
+	Opal_Queue queue(Opal_DeviceEngineType engine_type)
+	{
+		Opal_Queue result = OPAL_NULL_HANDLE;
+		EXPECT_EQ(opalGetSchedulerQueue(scheduler, engine_type, &result), OPAL_SUCCESS);
+
+		return result;
+	}
+
+	static ScheduleTest *current;
+
+	Opal_Instance instance {OPAL_NULL_HANDLE};
+	Opal_Device device {OPAL_NULL_HANDLE};
+	Opal_Semaphore external {OPAL_NULL_HANDLE};
+	Opal_Scheduler scheduler {OPAL_NULL_HANDLE};
+
+	Opal_DeviceTable table {};
+	Opal_DeviceTable *original_table {nullptr};
+	PFN_opalSubmit next_submit {nullptr};
+
+	std::vector<RecordedSubmit> submits;
+};
+
+ScheduleTest *ScheduleTest::current = nullptr;
+
+TEST_F(ScheduleTest, EngineQueues)
+{
+	const Opal_DeviceEngineType engine_types[3] = {OPAL_DEVICE_ENGINE_TYPE_MAIN, OPAL_DEVICE_ENGINE_TYPE_COMPUTE, OPAL_DEVICE_ENGINE_TYPE_COPY};
+
+	// note: null devices have a queue for every engine type, so none of them fall back to main
+	for (Opal_DeviceEngineType engine_type : engine_types)
+	{
+		Opal_Queue expected = OPAL_NULL_HANDLE;
+		ASSERT_EQ(opalGetDeviceQueue(device, engine_type, 0, &expected), OPAL_SUCCESS);
+		EXPECT_EQ(queue(engine_type), expected);
+	}
+
+	EXPECT_NE(queue(OPAL_DEVICE_ENGINE_TYPE_MAIN), queue(OPAL_DEVICE_ENGINE_TYPE_COMPUTE));
+	EXPECT_NE(queue(OPAL_DEVICE_ENGINE_TYPE_MAIN), queue(OPAL_DEVICE_ENGINE_TYPE_COPY));
+	EXPECT_NE(queue(OPAL_DEVICE_ENGINE_TYPE_COMPUTE), queue(OPAL_DEVICE_ENGINE_TYPE_COPY));
+}
+
+TEST_F(ScheduleTest, ValuesIncreasePerQueue)
+{
+	SemaphoreValue first = schedule(OPAL_DEVICE_ENGINE_TYPE_COMPUTE);
+	SemaphoreValue second = schedule(OPAL_DEVICE_ENGINE_TYPE_COMPUTE);
+	SemaphoreValue main = schedule(OPAL_DEVICE_ENGINE_TYPE_MAIN);
+
+	EXPECT_EQ(first.first, second.first);
+	EXPECT_EQ(first.second, 1u);
+	EXPECT_EQ(second.second, 2u);
+
+	EXPECT_NE(main.first, first.first);
+	EXPECT_EQ(main.second, 1u);
+
+	// note: null submits signal right away, so every scheduled value is reached
+	uint64_t value = 0;
+	ASSERT_EQ(opalQuerySemaphore(device, second.first, &value), OPAL_SUCCESS);
+	EXPECT_EQ(value, 2u);
+	ASSERT_EQ(opalQuerySemaphore(device, main.first, &value), OPAL_SUCCESS);
+	EXPECT_EQ(value, 1u);
+}
+
+TEST_F(ScheduleTest, CrossQueueDependencyWaits)
+{
+	SemaphoreValue compute = schedule(OPAL_DEVICE_ENGINE_TYPE_COMPUTE);
+	SemaphoreValue main = schedule(OPAL_DEVICE_ENGINE_TYPE_MAIN, {compute});
+
+	if (submits.empty())
+		GTEST_SKIP() << "single backend builds don't dispatch through the device table";
+
+	ASSERT_EQ(submits.size(), 2u);
+
+	EXPECT_EQ(submits[0].queue, queue(OPAL_DEVICE_ENGINE_TYPE_COMPUTE));
+	EXPECT_TRUE(submits[0].waits.empty());
+	ASSERT_EQ(submits[0].signals.size(), 1u);
+	EXPECT_EQ(submits[0].signals[0], compute);
+
+	EXPECT_EQ(submits[1].queue, queue(OPAL_DEVICE_ENGINE_TYPE_MAIN));
+	ASSERT_EQ(submits[1].waits.size(), 1u);
+	EXPECT_EQ(submits[1].waits[0], compute);
+	ASSERT_EQ(submits[1].signals.size(), 1u);
+	EXPECT_EQ(submits[1].signals[0], main);
+}
+
+TEST_F(ScheduleTest, SameQueueDependencyIsOrdered)
+{
+	SemaphoreValue first = schedule(OPAL_DEVICE_ENGINE_TYPE_COPY);
+	schedule(OPAL_DEVICE_ENGINE_TYPE_COPY, {first});
+
+	if (submits.empty())
+		GTEST_SKIP() << "single backend builds don't dispatch through the device table";
+
+	// note: submission order already covers work on the same queue
+	ASSERT_EQ(submits.size(), 2u);
+	EXPECT_TRUE(submits[1].waits.empty());
+}
+
+TEST_F(ScheduleTest, DependenciesMergePerQueue)
+{
+	SemaphoreValue first = schedule(OPAL_DEVICE_ENGINE_TYPE_COMPUTE);
+	SemaphoreValue second = schedule(OPAL_DEVICE_ENGINE_TYPE_COMPUTE);
+	SemaphoreValue copy = schedule(OPAL_DEVICE_ENGINE_TYPE_COPY);
+
+	schedule(OPAL_DEVICE_ENGINE_TYPE_MAIN, {second, copy, first});
+
+	if (submits.empty())
+		GTEST_SKIP() << "single backend builds don't dispatch through the device table";
+
+	// note: only the latest value of each source queue is waited for
+	ASSERT_EQ(submits.size(), 4u);
+	ASSERT_EQ(submits[3].waits.size(), 2u);
+	EXPECT_EQ(submits[3].waits[0], second);
+	EXPECT_EQ(submits[3].waits[1], copy);
+}
+
+TEST_F(ScheduleTest, WaitedValuesAreNotRepeated)
+{
+	SemaphoreValue first = schedule(OPAL_DEVICE_ENGINE_TYPE_COMPUTE);
+	schedule(OPAL_DEVICE_ENGINE_TYPE_MAIN, {first});
+	schedule(OPAL_DEVICE_ENGINE_TYPE_MAIN, {first});
+
+	SemaphoreValue second = schedule(OPAL_DEVICE_ENGINE_TYPE_COMPUTE);
+	schedule(OPAL_DEVICE_ENGINE_TYPE_MAIN, {first, second});
+
+	if (submits.empty())
+		GTEST_SKIP() << "single backend builds don't dispatch through the device table";
+
+	ASSERT_EQ(submits.size(), 5u);
+	EXPECT_EQ(submits[1].waits.size(), 1u);
+
+	// note: main already waited for the first value, so only newer compute work adds a wait
+	EXPECT_TRUE(submits[2].waits.empty());
+	ASSERT_EQ(submits[4].waits.size(), 1u);
+	EXPECT_EQ(submits[4].waits[0], second);
+}
+
+TEST_F(ScheduleTest, ChainAcrossThreeQueues)
+{
+	SemaphoreValue copy = schedule(OPAL_DEVICE_ENGINE_TYPE_COPY);
+	SemaphoreValue compute = schedule(OPAL_DEVICE_ENGINE_TYPE_COMPUTE, {copy});
+	SemaphoreValue main = schedule(OPAL_DEVICE_ENGINE_TYPE_MAIN, {compute});
+
+	if (submits.empty())
+		GTEST_SKIP() << "single backend builds don't dispatch through the device table";
+
+	// note: each link waits only on its direct dependency, copy work is ordered before main through compute
+	ASSERT_EQ(submits.size(), 3u);
+	EXPECT_TRUE(submits[0].waits.empty());
+
+	ASSERT_EQ(submits[1].waits.size(), 1u);
+	EXPECT_EQ(submits[1].waits[0], copy);
+
+	ASSERT_EQ(submits[2].waits.size(), 1u);
+	EXPECT_EQ(submits[2].waits[0], compute);
+	EXPECT_EQ(submits[2].signals[0], main);
+}
+
+TEST_F(ScheduleTest, ExternalDependencies)
+{
+	schedule(OPAL_DEVICE_ENGINE_TYPE_COMPUTE, {{external, 3}, {external, 5}, {external, 4}});
+
+	if (submits.empty())
+		GTEST_SKIP() << "single backend builds don't dispatch through the device table";
+
+	// note: semaphores the scheduler doesn't own are passed through, merged to the largest value
+	ASSERT_EQ(submits.size(), 1u);
+	ASSERT_EQ(submits[0].waits.size(), 1u);
+	EXPECT_EQ(submits[0].waits[0], SemaphoreValue(external, 5));
+}
+
+TEST_F(ScheduleTest, UnscheduledValueRejected)
+{
+	SemaphoreValue compute = schedule(OPAL_DEVICE_ENGINE_TYPE_COMPUTE);
+	size_t num_submits = submits.size();
+
+	SemaphoreValue result = {OPAL_NULL_HANDLE, 0};
+	EXPECT_EQ(trySchedule(OPAL_DEVICE_ENGINE_TYPE_MAIN, {{compute.first, compute.second + 1}}, &result), OPAL_INVALID_SCHEDULER);
+	EXPECT_EQ(submits.size(), num_submits);
+
+	// note: a rejected call doesn't consume a value on its queue
+	SemaphoreValue main = schedule(OPAL_DEVICE_ENGINE_TYPE_MAIN, {compute});
+	EXPECT_EQ(main.second, 1u);
+}
+
+int main(int argc, char **argv)
+{
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+
+#include <opal.h>
+
+class SemaphoresTest : public testing::Test
+{
+protected:
+	static const uint32_t num_semaphores = 3;
+
+	void SetUp() override
+	{
+		Opal_InstanceDesc instance_desc = {};
+		instance_desc.application_name = "test_semaphores";
+		instance_desc.engine_name = "opal";
+
+		ASSERT_EQ(opalCreateInstance(OPAL_API_NULL, &instance_desc, &instance), OPAL_SUCCESS);
+		ASSERT_EQ(opalCreateDefaultDevice(instance, OPAL_DEVICE_HINT_DEFAULT, &device), OPAL_SUCCESS);
+		ASSERT_EQ(opalGetDeviceQueue(device, OPAL_DEVICE_ENGINE_TYPE_MAIN, 0, &queue), OPAL_SUCCESS);
+
+		Opal_SemaphoreDesc semaphore_desc = {};
+		semaphore_desc.flags = OPAL_SEMAPHORE_CREATION_FLAGS_HOST_OPERATIONS;
+
+		for (uint32_t i = 0; i < num_semaphores; ++i)
+			ASSERT_EQ(opalCreateSemaphore(device, &semaphore_desc, &semaphores[i]), OPAL_SUCCESS);
+	}
+
+	void TearDown() override
+	{
+		for (uint32_t i = 0; i < num_semaphores; ++i)
+			opalDestroySemaphore(device, semaphores[i]);
+
+		opalDestroyDevice(device);
+		opalDestroyInstance(instance);
+	}
+
+	void signal(uint64_t first, uint64_t second, uint64_t third)
+	{
+		ASSERT_EQ(opalSignalSemaphore(device, semaphores[0], first), OPAL_SUCCESS);
+		ASSERT_EQ(opalSignalSemaphore(device, semaphores[1], second), OPAL_SUCCESS);
+		ASSERT_EQ(opalSignalSemaphore(device, semaphores[2], third), OPAL_SUCCESS);
+	}
+
+	Opal_Result waitAll(const uint64_t *values)
+	{
+		return opalWaitSemaphores(device, num_semaphores, semaphores, values, 0, 0);
+	}
+
+	Opal_Result waitAny(const uint64_t *values)
+	{
+		return opalWaitSemaphores(device, num_semaphores, semaphores, values, 1, 0);
+	}
+
+	Opal_Instance instance {OPAL_NULL_HANDLE};
+	Opal_Device device {OPAL_NULL_HANDLE};
+	Opal_Queue queue {OPAL_NULL_HANDLE};
+	Opal_Semaphore semaphores[num_semaphores] {};
+};
+
+TEST_F(SemaphoresTest, NoneSignaled)
+{
+	const uint64_t values[num_semaphores] = {1, 1, 1};
+
+	EXPECT_EQ(waitAll(values), OPAL_WAIT_TIMEOUT);
+	EXPECT_EQ(waitAny(values), OPAL_WAIT_TIMEOUT);
+}
+
+TEST_F(SemaphoresTest, MixedValues)
+{
+	signal(5, 2, 0);
+
+	// note: the first one is reached, the second one is one value short, the third one wasn't signaled at all
+	const uint64_t values[num_semaphores] = {5, 3, 1};
+
+	EXPECT_EQ(waitAll(values), OPAL_WAIT_TIMEOUT);
+	EXPECT_EQ(waitAny(values), OPAL_SUCCESS);
+}
+
+TEST_F(SemaphoresTest, OnlyLastReached)
+{
+	signal(1, 1, 9);
+
+	const uint64_t values[num_semaphores] = {2, 2, 9};
+
+	EXPECT_EQ(waitAll(values), OPAL_WAIT_TIMEOUT);
+	EXPECT_EQ(waitAny(values), OPAL_SUCCESS);
+}
+
+TEST_F(SemaphoresTest, AllReached)
+{
+	signal(3, 7, 2);
+
+	// note: values past the requested ones count as reached, so do values of zero
+	const uint64_t values[num_semaphores] = {3, 4, 0};
+
+	EXPECT_EQ(waitAll(values), OPAL_SUCCESS);
+	EXPECT_EQ(waitAny(values), OPAL_SUCCESS);
+}
+
+TEST_F(SemaphoresTest, SameSemaphoreTwice)
+{
+	ASSERT_EQ(opalSignalSemaphore(device, semaphores[0], 3), OPAL_SUCCESS);
+
+	const Opal_Semaphore pair[2] = {semaphores[0], semaphores[0]};
+	const uint64_t values[2] = {2, 4};
+
+	EXPECT_EQ(opalWaitSemaphores(device, 2, pair, values, 0, 0), OPAL_WAIT_TIMEOUT);
+	EXPECT_EQ(opalWaitSemaphores(device, 2, pair, values, 1, 0), OPAL_SUCCESS);
+}
+
+TEST_F(SemaphoresTest, SignaledBySubmit)
+{
+	signal(1, 1, 1);
+
+	const uint64_t signal_values[2] = {4, 6};
+
+	Opal_SubmitDesc submit_desc = {};
+	submit_desc.num_signal_semaphores = 2;
+	submit_desc.signal_semaphores = semaphores;
+	submit_desc.signal_values = signal_values;
+
+	ASSERT_EQ(opalSubmit(device, queue, &submit_desc), OPAL_SUCCESS);
+
+	const uint64_t values[num_semaphores] = {4, 6, 2};
+
+	EXPECT_EQ(waitAll(values), OPAL_WAIT_TIMEOUT);
+	EXPECT_EQ(waitAny(values), OPAL_SUCCESS);
+	EXPECT_EQ(opalWaitSemaphores(device, 2, semaphores, values, 0, 0), OPAL_SUCCESS);
+}
+
+TEST_F(SemaphoresTest, InvalidArguments)
+{
+	const uint64_t values[num_semaphores] = {1, 1, 1};
+
+	EXPECT_EQ(opalWaitSemaphores(OPAL_NULL_HANDLE, num_semaphores, semaphores, values, 0, 0), OPAL_INVALID_DEVICE);
+	EXPECT_EQ(opalWaitSemaphores(device, 0, nullptr, nullptr, 0, 0), OPAL_SUCCESS);
+	EXPECT_EQ(opalWaitSemaphores(device, 0, nullptr, nullptr, 1, 0), OPAL_SUCCESS);
+}
+
+int main(int argc, char **argv)
+{
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,361 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+extern "C"
+{
+#include "state_internal.h"
+}
+
+struct ForwardedBarrier
+{
+	Opal_FenceOp fence_op;
+	Opal_Fence fence;
+	std::vector<Opal_BufferTransitionDesc> buffer_transitions;
+	std::vector<Opal_TextureTransitionDesc> texture_transitions;
+};
+
+class StateTest : public testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		Opal_LayerDesc layer = {};
+		ASSERT_EQ(opalGetStateTrackingLayer(&layer), OPAL_SUCCESS);
+
+		Opal_InstanceDesc instance_desc = {};
+		instance_desc.application_name = "test_state";
+		instance_desc.engine_name = "opal";
+		instance_desc.num_layers = 1;
+		instance_desc.layers = &layer;
+
+		// note: single backend builds call the backend directly, so there is no chain to put the layer into
+		Opal_Result result = opalCreateInstance(OPAL_API_NULL, &instance_desc, &instance);
+		if (result == OPAL_NOT_SUPPORTED)
+			GTEST_SKIP() << "layers are not supported in single backend builds";
+
+		ASSERT_EQ(result, OPAL_SUCCESS);
+		ASSERT_EQ(opalCreateDefaultDevice(instance, OPAL_DEVICE_HINT_DEFAULT, &device), OPAL_SUCCESS);
+		ASSERT_EQ(opalGetDeviceQueue(device, OPAL_DEVICE_ENGINE_TYPE_MAIN, 0, &queue), OPAL_SUCCESS);
+		ASSERT_EQ(opalCreateCommandAllocator(device, queue, &command_allocator), OPAL_SUCCESS);
+		ASSERT_EQ(opalCreateCommandBuffer(device, command_allocator, &command_buffer), OPAL_SUCCESS);
+		ASSERT_EQ(opalCreateCommandBuffer(device, command_allocator, &other_command_buffer), OPAL_SUCCESS);
+		ASSERT_EQ(opalCreateFence(device, &fence), OPAL_SUCCESS);
+
+		// note: passes are intercepted right below the layer to see what it forwards to the backend
+		State_Device *device_ptr = (State_Device *)device;
+		next_begin_compute_pass = device_ptr->next.cmdBeginComputePass;
+		next_end_compute_pass = device_ptr->next.cmdEndComputePass;
+		device_ptr->next.cmdBeginComputePass = recordBeginComputePass;
+		device_ptr->next.cmdEndComputePass = recordEndComputePass;
+
+		current = this;
+	}
+
+	void TearDown() override
+	{
+		current = nullptr;
+
+		for (Opal_TextureView texture_view : texture_views)
+			opalDestroyTextureView(device, texture_view);
+
+		for (Opal_Texture texture : textures)
+			opalDestroyTexture(device, texture);
+
+		for (Opal_Buffer buffer : buffers)
+			opalDestroyBuffer(device, buffer);
+
+		opalDestroyFence(device, fence);
+		opalDestroyCommandBuffer(device, other_command_buffer);
+		opalDestroyCommandBuffer(device, command_buffer);
+		opalDestroyCommandAllocator(device, command_allocator);
+		opalDestroyDevice(device);
+		opalDestroyInstance(instance);
+	}
+
+	static void record(const Opal_PassBarriersDesc *barriers)
+	{
+		if (barriers == nullptr)
+			return;
+
+		for (uint32_t i = 0; i < barriers->num_barriers; ++i)
+		{
+			const Opal_BarrierDesc *barrier = &barriers->barriers[i];
+			ForwardedBarrier result = {barrier->fence_op, barrier->fence, {}, {}};
+
+			for (uint32_t j = 0; j < barrier->num_buffer_transitions; ++j)
+				result.buffer_transitions.push_back(barrier->buffer_transitions[j]);
+
+			for (uint32_t j = 0; j < barrier->num_texture_transitions; ++j)
+				result.texture_transitions.push_back(barrier->texture_transitions[j]);
+
+			current->forwarded.push_back(result);
+		}
+	}
+
+	static Opal_Result recordBeginComputePass(Opal_Device device, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+	{
+		record(barriers);
+		return current->next_begin_compute_pass(device, command_buffer, barriers);
+	}
+
+	static Opal_Result recordEndComputePass(Opal_Device device, Opal_CommandBuffer command_buffer, const Opal_PassBarriersDesc *barriers)
+	{
+		record(barriers);
+		return current->next_end_compute_pass(device, command_buffer, barriers);
+	}
+
+	Opal_Buffer createBuffer(Opal_BufferState initial_state)
+	{
+		Opal_BufferDesc desc = {};
+		desc.size = 256;
+		desc.memory_type = OPAL_ALLOCATION_MEMORY_TYPE_DEVICE_LOCAL;
+		desc.usage = (Opal_BufferUsageFlags)(OPAL_BUFFER_USAGE_UNORDERED_ACCESS | OPAL_BUFFER_USAGE_COPY_DST);
+		desc.initial_state = initial_state;
+
+		Opal_Buffer buffer = OPAL_NULL_HANDLE;
+		EXPECT_EQ(opalCreateBuffer(device, &desc, &buffer), OPAL_SUCCESS);
+
+		buffers.push_back(buffer);
+		return buffer;
+	}
+
+	Opal_Texture createTexture(uint32_t mip_count)
+	{
+		Opal_TextureDesc desc = {};
+		desc.type = OPAL_TEXTURE_TYPE_2D;
+		desc.format = OPAL_TEXTURE_FORMAT_RGBA8_UNORM;
+		desc.width = 64;
+		desc.height = 64;
+		desc.depth = 1;
+		desc.mip_count = mip_count;
+		desc.layer_count = 1;
+		desc.samples = OPAL_SAMPLES_1;
+		desc.usage = (Opal_TextureUsageFlags)(OPAL_TEXTURE_USAGE_FRAGMENT_SHADER_SAMPLED | OPAL_TEXTURE_USAGE_COPY_DST);
+
+		Opal_Texture texture = OPAL_NULL_HANDLE;
+		EXPECT_EQ(opalCreateTexture(device, &desc, &texture), OPAL_SUCCESS);
+
+		textures.push_back(texture);
+		return texture;
+	}
+
+	Opal_TextureView createTextureView(Opal_Texture texture, uint32_t base_mip, uint32_t mip_count)
+	{
+		Opal_TextureViewDesc desc = {};
+		desc.texture = texture;
+		desc.type = OPAL_TEXTURE_VIEW_TYPE_2D;
+		desc.base_mip = base_mip;
+		desc.mip_count = mip_count;
+		desc.layer_count = 1;
+
+		Opal_TextureView texture_view = OPAL_NULL_HANDLE;
+		EXPECT_EQ(opalCreateTextureView(device, &desc, &texture_view), OPAL_SUCCESS);
+
+		texture_views.push_back(texture_view);
+		return texture_view;
+	}
+
+	// note: state_before is deliberately wrong everywhere, the layer has to ignore it
+	void transition(Opal_CommandBuffer target, Opal_Buffer buffer, Opal_BufferState state_after)
+	{
+		Opal_BufferTransitionDesc transition = {buffer, OPAL_BUFFER_STATE_COPY_DST, state_after};
+
+		Opal_BarrierDesc barrier = {};
+		barrier.wait_stages = OPAL_BARRIER_STAGE_COMPUTE;
+		barrier.block_stages = OPAL_BARRIER_STAGE_COMPUTE;
+		barrier.num_buffer_transitions = 1;
+		barrier.buffer_transitions = &transition;
+
+		Opal_PassBarriersDesc barriers = {1, &barrier};
+
+		ASSERT_EQ(opalCmdBeginComputePass(device, target, &barriers), OPAL_SUCCESS);
+		ASSERT_EQ(opalCmdEndComputePass(device, target, nullptr), OPAL_SUCCESS);
+	}
+
+	void transition(Opal_TextureView texture_view, Opal_TextureState state_after)
+	{
+		Opal_TextureTransitionDesc transition = {texture_view, OPAL_TEXTURE_STATE_PRESENT, state_after};
+
+		Opal_BarrierDesc barrier = {};
+		barrier.wait_stages = OPAL_BARRIER_STAGE_COMPUTE;
+		barrier.block_stages = OPAL_BARRIER_STAGE_COMPUTE;
+		barrier.num_texture_transitions = 1;
+		barrier.texture_transitions = &transition;
+
+		Opal_PassBarriersDesc barriers = {1, &barrier};
+
+		ASSERT_EQ(opalCmdBeginComputePass(device, command_buffer, &barriers), OPAL_SUCCESS);
+		ASSERT_EQ(opalCmdEndComputePass(device, command_buffer, nullptr), OPAL_SUCCESS);
+	}
+
+	static StateTest *current;
+
+	Opal_Instance instance {OPAL_NULL_HANDLE};
+	Opal_Device device {OPAL_NULL_HANDLE};
+	Opal_Queue queue {OPAL_NULL_HANDLE};
+	Opal_CommandAllocator command_allocator {OPAL_NULL_HANDLE};
+	Opal_CommandBuffer command_buffer {OPAL_NULL_HANDLE};
+	Opal_CommandBuffer other_command_buffer {OPAL_NULL_HANDLE};
+	Opal_Fence fence {OPAL_NULL_HANDLE};
+
+	PFN_opalCmdBeginComputePass next_begin_compute_pass {nullptr};
+	PFN_opalCmdEndComputePass next_end_compute_pass {nullptr};
+
+	std::vector<Opal_Buffer> buffers;
+	std::vector<Opal_Texture> textures;
+	std::vector<Opal_TextureView> texture_views;
+	std::vector<ForwardedBarrier> forwarded;
+};
+
+StateTest *StateTest::current = nullptr;
+
+TEST_F(StateTest, ResolvesBufferStateBefore)
+{
+	Opal_Buffer buffer = createBuffer(OPAL_BUFFER_STATE_GENERIC_READ);
+
+	transition(command_buffer, buffer, OPAL_BUFFER_STATE_UNORDERED_ACCESS);
+	transition(command_buffer, buffer, OPAL_BUFFER_STATE_GENERIC_READ);
+
+	ASSERT_EQ(forwarded.size(), 2);
+
+	ASSERT_EQ(forwarded[0].buffer_transitions.size(), 1);
+	EXPECT_EQ(forwarded[0].buffer_transitions[0].buffer, buffer);
+	EXPECT_EQ(forwarded[0].buffer_transitions[0].state_before, OPAL_BUFFER_STATE_GENERIC_READ);
+	EXPECT_EQ(forwarded[0].buffer_transitions[0].state_after, OPAL_BUFFER_STATE_UNORDERED_ACCESS);
+
+	ASSERT_EQ(forwarded[1].buffer_transitions.size(), 1);
+	EXPECT_EQ(forwarded[1].buffer_transitions[0].state_before, OPAL_BUFFER_STATE_UNORDERED_ACCESS);
+	EXPECT_EQ(forwarded[1].buffer_transitions[0].state_after, OPAL_BUFFER_STATE_GENERIC_READ);
+}
+
+TEST_F(StateTest, DropsRedundantTransitions)
+{
+	Opal_Buffer buffer = createBuffer(OPAL_BUFFER_STATE_UNORDERED_ACCESS);
+
+	transition(command_buffer, buffer, OPAL_BUFFER_STATE_UNORDERED_ACCESS);
+
+	// note: the barrier itself is kept so its stages still apply
+	ASSERT_EQ(forwarded.size(), 1);
+	EXPECT_TRUE(forwarded[0].buffer_transitions.empty());
+}
+
+TEST_F(StateTest, SplitsMixedTextureTransitions)
+{
+	Opal_Texture texture = createTexture(3);
+	Opal_TextureView whole = createTextureView(texture, 0, 3);
+	Opal_TextureView middle = createTextureView(texture, 1, 1);
+
+	transition(middle, OPAL_TEXTURE_STATE_COPY_DST);
+	ASSERT_EQ(forwarded.size(), 1);
+	ASSERT_EQ(forwarded[0].texture_transitions.size(), 1);
+	EXPECT_EQ(forwarded[0].texture_transitions[0].texture_view, middle);
+	EXPECT_EQ(forwarded[0].texture_transitions[0].state_before, OPAL_TEXTURE_STATE_UNDEFINED);
+
+	transition(whole, OPAL_TEXTURE_STATE_SHADER_SAMPLED);
+	ASSERT_EQ(forwarded.size(), 2);
+
+	// note: mips are in different states, so each one is transitioned through a view owned by the layer
+	const std::vector<Opal_TextureTransitionDesc> &transitions = forwarded[1].texture_transitions;
+	ASSERT_EQ(transitions.size(), 3);
+
+	EXPECT_EQ(transitions[0].state_before, OPAL_TEXTURE_STATE_UNDEFINED);
+	EXPECT_EQ(transitions[1].state_before, OPAL_TEXTURE_STATE_COPY_DST);
+	EXPECT_EQ(transitions[2].state_before, OPAL_TEXTURE_STATE_UNDEFINED);
+
+	for (const Opal_TextureTransitionDesc &transition : transitions)
+	{
+		EXPECT_NE(transition.texture_view, whole);
+		EXPECT_NE(transition.texture_view, middle);
+		EXPECT_EQ(transition.state_after, OPAL_TEXTURE_STATE_SHADER_SAMPLED);
+	}
+
+	EXPECT_NE(transitions[0].texture_view, transitions[1].texture_view);
+	EXPECT_NE(transitions[1].texture_view, transitions[2].texture_view);
+
+	// note: uniform again, back to a single transition on the view itself
+	transition(whole, OPAL_TEXTURE_STATE_COPY_SRC);
+	ASSERT_EQ(forwarded.size(), 3);
+	ASSERT_EQ(forwarded[2].texture_transitions.size(), 1);
+	EXPECT_EQ(forwarded[2].texture_transitions[0].texture_view, whole);
+	EXPECT_EQ(forwarded[2].texture_transitions[0].state_before, OPAL_TEXTURE_STATE_SHADER_SAMPLED);
+}
+
+TEST_F(StateTest, GenerateMipsLeavesCopySrc)
+{
+	Opal_Texture texture = createTexture(3);
+	Opal_TextureView whole = createTextureView(texture, 0, 3);
+
+	transition(whole, OPAL_TEXTURE_STATE_COPY_DST);
+
+	ASSERT_EQ(opalCmdBeginCopyPass(device, command_buffer, nullptr), OPAL_SUCCESS);
+	ASSERT_EQ(opalCmdGenerateMips(device, command_buffer, whole), OPAL_SUCCESS);
+	ASSERT_EQ(opalCmdEndCopyPass(device, command_buffer, nullptr), OPAL_SUCCESS);
+
+	// note: every mip is in the copy src state now, so the whole view gets a single transition
+	transition(whole, OPAL_TEXTURE_STATE_SHADER_SAMPLED);
+	ASSERT_EQ(forwarded.size(), 2);
+	ASSERT_EQ(forwarded[1].texture_transitions.size(), 1);
+	EXPECT_EQ(forwarded[1].texture_transitions[0].texture_view, whole);
+	EXPECT_EQ(forwarded[1].texture_transitions[0].state_before, OPAL_TEXTURE_STATE_COPY_SRC);
+	EXPECT_EQ(forwarded[1].texture_transitions[0].state_after, OPAL_TEXTURE_STATE_SHADER_SAMPLED);
+}
+
+TEST_F(StateTest, SplitBarrierReplaysBeginHalf)
+{
+	Opal_Buffer buffer = createBuffer(OPAL_BUFFER_STATE_GENERIC_READ);
+
+	Opal_BufferTransitionDesc transition = {buffer, OPAL_BUFFER_STATE_COPY_DST, OPAL_BUFFER_STATE_UNORDERED_ACCESS};
+
+	Opal_BarrierDesc barrier = {};
+	barrier.wait_stages = OPAL_BARRIER_STAGE_COMPUTE;
+	barrier.block_stages = OPAL_BARRIER_STAGE_COMPUTE;
+	barrier.num_buffer_transitions = 1;
+	barrier.buffer_transitions = &transition;
+	barrier.fence = fence;
+	barrier.fence_op = OPAL_FENCE_OP_BEGIN;
+
+	Opal_PassBarriersDesc barriers = {1, &barrier};
+
+	ASSERT_EQ(opalCmdBeginComputePass(device, command_buffer, nullptr), OPAL_SUCCESS);
+	ASSERT_EQ(opalCmdEndComputePass(device, command_buffer, &barriers), OPAL_SUCCESS);
+
+	// note: the tracked state is already the new one, the end half must not see a redundant transition
+	barrier.fence_op = OPAL_FENCE_OP_END;
+
+	ASSERT_EQ(opalCmdBeginComputePass(device, command_buffer, &barriers), OPAL_SUCCESS);
+	ASSERT_EQ(opalCmdEndComputePass(device, command_buffer, nullptr), OPAL_SUCCESS);
+
+	ASSERT_EQ(forwarded.size(), 2);
+
+	for (const ForwardedBarrier &half : forwarded)
+	{
+		EXPECT_EQ(half.fence, fence);
+		ASSERT_EQ(half.buffer_transitions.size(), 1);
+		EXPECT_EQ(half.buffer_transitions[0].state_before, OPAL_BUFFER_STATE_GENERIC_READ);
+		EXPECT_EQ(half.buffer_transitions[0].state_after, OPAL_BUFFER_STATE_UNORDERED_ACCESS);
+	}
+
+	EXPECT_EQ(forwarded[0].fence_op, OPAL_FENCE_OP_BEGIN);
+	EXPECT_EQ(forwarded[1].fence_op, OPAL_FENCE_OP_END);
+}
+
+TEST_F(StateTest, TracksRecordingOrder)
+{
+	Opal_Buffer buffer = createBuffer(OPAL_BUFFER_STATE_GENERIC_READ);
+
+	transition(command_buffer, buffer, OPAL_BUFFER_STATE_UNORDERED_ACCESS);
+	transition(other_command_buffer, buffer, OPAL_BUFFER_STATE_COPY_DST);
+
+	// note: the second command buffer assumes the first one runs before it, whatever the submission order is
+	ASSERT_EQ(forwarded.size(), 2);
+	ASSERT_EQ(forwarded[1].buffer_transitions.size(), 1);
+	EXPECT_EQ(forwarded[1].buffer_transitions[0].state_before, OPAL_BUFFER_STATE_UNORDERED_ACCESS);
+	EXPECT_EQ(forwarded[1].buffer_transitions[0].state_after, OPAL_BUFFER_STATE_COPY_DST);
+}
+
+int main(int argc, char **argv)
+{
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <set>
+
+#include <opal.h>
+
+class SwapchainTest : public testing::Test
+{
+protected:
+	static const uint32_t max_frames_in_flight = 2;
+
+	void SetUp() override
+	{
+		Opal_InstanceDesc instance_desc = {};
+		instance_desc.application_name = "test_swapchain";
+		instance_desc.engine_name = "opal";
+
+		ASSERT_EQ(opalCreateInstance(OPAL_API_NULL, &instance_desc, &instance), OPAL_SUCCESS);
+		ASSERT_EQ(opalCreateDefaultDevice(instance, OPAL_DEVICE_HINT_DEFAULT, &device), OPAL_SUCCESS);
+		ASSERT_EQ(opalGetDeviceQueue(device, OPAL_DEVICE_ENGINE_TYPE_MAIN, 0, &queue), OPAL_SUCCESS);
+		ASSERT_EQ(opalCreateHeadlessSurface(instance, 64, 64, &surface), OPAL_SUCCESS);
+
+		Opal_SwapchainDesc swapchain_desc = {};
+		swapchain_desc.mode = OPAL_PRESENT_MODE_FIFO;
+		swapchain_desc.usage = OPAL_TEXTURE_USAGE_FRAMEBUFFER_ATTACHMENT;
+		swapchain_desc.surface = surface;
+		swapchain_desc.queue = queue;
+		swapchain_desc.max_frames_in_flight = max_frames_in_flight;
+
+		ASSERT_EQ(opalGetPreferredSurfaceFormat(device, surface, &swapchain_desc.format), OPAL_SUCCESS);
+		ASSERT_EQ(opalCreateSwapchain(device, &swapchain_desc, &swapchain), OPAL_SUCCESS);
+	}
+
+	void TearDown() override
+	{
+		opalDestroySwapchain(device, swapchain);
+		opalDestroySurface(instance, surface);
+		opalDestroyDevice(device);
+		opalDestroyInstance(instance);
+	}
+
+	Opal_TextureView frame()
+	{
+		Opal_TextureView texture_view = OPAL_NULL_HANDLE;
+		EXPECT_EQ(opalAcquire(device, swapchain, &texture_view), OPAL_SUCCESS);
+
+		Opal_SubmitDesc submit_desc = {};
+		submit_desc.num_wait_swapchains = 1;
+		submit_desc.wait_swapchains = &swapchain;
+		submit_desc.num_signal_swapchains = 1;
+		submit_desc.signal_swapchains = &swapchain;
+
+		EXPECT_EQ(opalSubmit(device, queue, &submit_desc), OPAL_SUCCESS);
+		EXPECT_EQ(opalPresent(device, swapchain), OPAL_SUCCESS);
+
+		return texture_view;
+	}
+
+	Opal_Instance instance {OPAL_NULL_HANDLE};
+	Opal_Device device {OPAL_NULL_HANDLE};
+	Opal_Queue queue {OPAL_NULL_HANDLE};
+	Opal_Surface surface {OPAL_NULL_HANDLE};
+	Opal_Swapchain swapchain {OPAL_NULL_HANDLE};
+};
+
+TEST_F(SwapchainTest, AcquireCyclesImages)
+{
+	// note: the ring holds one image more than the frames in flight
+	const uint32_t num_images = max_frames_in_flight + 1;
+
+	Opal_TextureView views[num_images * 2] = {};
+	for (uint32_t i = 0; i < num_images * 2; ++i)
+		views[i] = frame();
+
+	std::set<Opal_TextureView> unique(views, views + num_images);
+	EXPECT_EQ(unique.size(), num_images);
+
+	for (uint32_t i = 0; i < num_images; ++i)
+	{
+		EXPECT_NE(views[i], OPAL_NULL_HANDLE);
+		EXPECT_EQ(views[i], views[i + num_images]);
+	}
+}
+
+TEST_F(SwapchainTest, PresentsAreDisplayed)
+{
+	Opal_FrameTiming timing = {};
+	ASSERT_EQ(opalGetSwapchainFrameTiming(device, swapchain, &timing), OPAL_SUCCESS);
+	EXPECT_EQ(timing.frame_id, 0);
+
+	for (uint64_t i = 1; i <= 5; ++i)
+	{
+		frame();
+
+		ASSERT_EQ(opalGetSwapchainFrameTiming(device, swapchain, &timing), OPAL_SUCCESS);
+		EXPECT_EQ(timing.frame_id, i);
+		EXPECT_LE(timing.acquire_time, timing.submit_time);
+		EXPECT_LE(timing.submit_time, timing.present_time);
+		EXPECT_LE(timing.present_time, timing.display_time);
+	}
+}
+
+TEST_F(SwapchainTest, WaitPresent)
+{
+	EXPECT_EQ(opalWaitPresent(device, swapchain, 1, 0), OPAL_INVALID_SWAPCHAIN);
+
+	frame();
+	frame();
+
+	EXPECT_EQ(opalWaitPresent(device, swapchain, 1, 0), OPAL_SUCCESS);
+	EXPECT_EQ(opalWaitPresent(device, swapchain, 2, 1000), OPAL_SUCCESS);
+	EXPECT_EQ(opalWaitPresent(device, swapchain, 3, 1000), OPAL_INVALID_SWAPCHAIN);
+}
+
+TEST_F(SwapchainTest, WaitPresentInvalidArguments)
+{
+	EXPECT_EQ(opalWaitPresent(OPAL_NULL_HANDLE, swapchain, 0, 0), OPAL_INVALID_DEVICE);
+	EXPECT_EQ(opalWaitPresent(device, OPAL_NULL_HANDLE, 0, 0), OPAL_INVALID_SWAPCHAIN);
+}
+
+int main(int argc, char **argv)
+{
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
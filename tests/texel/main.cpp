@@ -0,0 +1,362 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+extern "C"
+{
+#include "texel.h"
+}
+
+static float srgbToLinear(float value)
+{
+	if (value <= 0.04045f)
+		return value / 12.92f;
+
+	return std::pow((value + 0.055f) / 1.055f, 2.4f);
+}
+
+static uint32_t floatBits(float value)
+{
+	uint32_t bits = 0;
+	memcpy(&bits, &value, sizeof(float));
+	return bits;
+}
+
+TEST(Texel, SwizzleRB)
+{
+	std::vector<uint32_t> src(37);
+	std::vector<uint32_t> dst(37);
+
+	for (uint32_t i = 0; i < 37; ++i)
+		src[i] = 0x04030201u + i * 0x01010101u;
+
+	opal_texelSwizzleRB(dst.data(), src.data(), 37);
+
+	for (uint32_t i = 0; i < 37; ++i)
+	{
+		uint32_t expected = (src[i] & 0xFF00FF00u) | ((src[i] & 0xFFu) << 16) | ((src[i] >> 16) & 0xFFu);
+		EXPECT_EQ(dst[i], expected);
+	}
+
+	opal_texelSwizzleRB(src.data(), src.data(), 37);
+	EXPECT_EQ(src, dst);
+}
+
+TEST(Texel, SrgbRoundTrip)
+{
+	std::vector<uint8_t> codes(256);
+	for (uint32_t i = 0; i < 256; ++i)
+		codes[i] = (uint8_t)i;
+
+	std::vector<float> linear(256);
+	opal_texelSrgbToLinear(linear.data(), codes.data(), 256);
+
+	for (uint32_t i = 0; i < 256; ++i)
+		EXPECT_NEAR(linear[i], srgbToLinear(i / 255.0f), 1e-6f);
+
+	std::vector<uint8_t> encoded(256);
+	opal_texelLinearToSrgb(encoded.data(), linear.data(), 256);
+	EXPECT_EQ(encoded, codes);
+}
+
+TEST(Texel, LinearToSrgbSweep)
+{
+	const uint32_t count = 100000;
+
+	std::vector<float> values(count);
+	for (uint32_t i = 0; i < count; ++i)
+		values[i] = std::pow((float)i / (float)(count - 1), 2.0f);
+
+	std::vector<uint8_t> codes(count);
+	opal_texelLinearToSrgb(codes.data(), values.data(), count);
+
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		double value = values[i];
+		double encoded = (value <= 0.0031308) ? value * 12.92 : 1.055 * std::pow(value, 1.0 / 2.4) - 0.055;
+		EXPECT_EQ(codes[i], (uint8_t)(encoded * 255.0 + 0.5)) << "value " << value;
+	}
+}
+
+TEST(Texel, LinearToSrgbClamps)
+{
+	float values[9] = {-1.0f, 0.0f, 1.0f, 2.0f, std::numeric_limits<float>::quiet_NaN(), 0.5f, 0.2158605f, 0.0031308f, 1e-8f};
+	uint8_t codes[9] = {};
+
+	opal_texelLinearToSrgb(codes, values, 9);
+
+	EXPECT_EQ(codes[0], 0);
+	EXPECT_EQ(codes[1], 0);
+	EXPECT_EQ(codes[2], 255);
+	EXPECT_EQ(codes[3], 255);
+	EXPECT_EQ(codes[4], 0);
+	EXPECT_EQ(codes[5], 188);
+	EXPECT_EQ(codes[6], 128);
+	EXPECT_EQ(codes[7], 10);
+	EXPECT_EQ(codes[8], 0);
+}
+
+TEST(Texel, HalfValues)
+{
+	float values[12] = {0.0f, -0.0f, 1.0f, -2.0f, 65504.0f, 65520.0f, 1e10f, 5.9604645e-8f, 6.1035156e-5f, 1.0009766f, std::numeric_limits<float>::infinity(), 1.00048828125f};
+	uint16_t expected[12] = {0x0000, 0x8000, 0x3C00, 0xC000, 0x7BFF, 0x7C00, 0x7C00, 0x0001, 0x0400, 0x3C01, 0x7C00, 0x3C00};
+	uint16_t halfs[12] = {};
+
+	opal_texelFloatToHalf(halfs, values, 12);
+
+	for (uint32_t i = 0; i < 12; ++i)
+		EXPECT_EQ(halfs[i], expected[i]) << "value " << i;
+
+	float nan = std::numeric_limits<float>::quiet_NaN();
+	uint16_t nan_half = 0;
+	opal_texelFloatToHalf(&nan_half, &nan, 1);
+	EXPECT_EQ(nan_half & 0x7C00, 0x7C00);
+	EXPECT_NE(nan_half & 0x03FF, 0);
+}
+
+TEST(Texel, HalfRoundTrip)
+{
+	// note: every finite half survives a round trip through float
+	std::vector<uint16_t> halfs;
+	for (uint32_t i = 0; i < 0x10000; ++i)
+		if ((i & 0x7C00) != 0x7C00)
+			halfs.push_back((uint16_t)i);
+
+	uint32_t count = (uint32_t)halfs.size();
+
+	std::vector<float> floats(count);
+	opal_texelHalfToFloat(floats.data(), halfs.data(), count);
+
+	for (uint32_t i = 0; i < count; i += 997)
+	{
+		uint16_t half = halfs[i];
+		float sign = (half & 0x8000) ? -1.0f : 1.0f;
+		uint32_t exponent = (half >> 10) & 0x1F;
+		uint32_t mantissa = half & 0x3FF;
+
+		float expected = (exponent == 0) ? std::ldexp((float)mantissa, -24) : std::ldexp((float)(mantissa | 0x400), (int)exponent - 25);
+		EXPECT_EQ(floatBits(floats[i]), floatBits(sign * expected));
+	}
+
+	std::vector<uint16_t> round_trip(count);
+	opal_texelFloatToHalf(round_trip.data(), floats.data(), count);
+	EXPECT_EQ(round_trip, halfs);
+}
+
+TEST(Texel, HalfSpecials)
+{
+	uint16_t halfs[3] = {0x7C00, 0xFC00, 0x7E00};
+	float floats[3] = {};
+
+	opal_texelHalfToFloat(floats, halfs, 3);
+
+	EXPECT_EQ(floats[0], std::numeric_limits<float>::infinity());
+	EXPECT_EQ(floats[1], -std::numeric_limits<float>::infinity());
+	EXPECT_TRUE(std::isnan(floats[2]));
+}
+
+TEST(Texel, RG11B10RoundTrip)
+{
+	float texels[4 * 4] =
+	{
+		1.0f, 0.5f, 0.25f, 0.0f,
+		0.0f, 65024.0f, 64512.0f, 0.0f,
+		-1.0f, 2.0f, 3.0f, 0.0f,
+		0.125f, 1024.0f, 6.1035156e-5f, 0.0f,
+	};
+
+	uint32_t packed[4] = {};
+	opal_texelPackRG11B10(packed, texels, 4);
+
+	EXPECT_EQ(packed[0] & 0x7FF, 0x3C0u);
+	EXPECT_EQ((packed[0] >> 11) & 0x7FF, 0x380u);
+	EXPECT_EQ(packed[0] >> 22, 0x1A0u);
+
+	float unpacked[4 * 4] = {};
+	opal_texelUnpackRG11B10(unpacked, packed, 4);
+
+	for (uint32_t i = 0; i < 4; ++i)
+	{
+		for (uint32_t c = 0; c < 3; ++c)
+			EXPECT_EQ(unpacked[i * 4 + c], std::max(texels[i * 4 + c], 0.0f)) << "texel " << i << " channel " << c;
+
+		EXPECT_EQ(unpacked[i * 4 + 3], 1.0f);
+	}
+}
+
+TEST(Texel, RGB9E5RoundTrip)
+{
+	float texels[4 * 3] =
+	{
+		1.0f, 0.5f, 0.25f, 0.0f,
+		65408.0f, 0.0f, 1.0f, 0.0f,
+		100000.0f, -3.0f, 0.0f, 0.0f,
+	};
+
+	uint32_t packed[3] = {};
+	opal_texelPackRGB9E5(packed, texels, 3);
+
+	float unpacked[4 * 3] = {};
+	opal_texelUnpackRGB9E5(unpacked, packed, 3);
+
+	EXPECT_EQ(unpacked[0], 1.0f);
+	EXPECT_EQ(unpacked[1], 0.5f);
+	EXPECT_EQ(unpacked[2], 0.25f);
+	EXPECT_EQ(unpacked[3], 1.0f);
+
+	EXPECT_EQ(unpacked[4], 65408.0f);
+	EXPECT_EQ(unpacked[5], 0.0f);
+
+	EXPECT_EQ(unpacked[8], 65408.0f);
+	EXPECT_EQ(unpacked[9], 0.0f);
+	EXPECT_EQ(unpacked[10], 0.0f);
+
+	// note: channels much smaller than the largest one lose precision to the shared exponent
+	float small[4] = {1000.0f, 0.001f, 3.0f, 0.0f};
+	uint32_t small_packed = 0;
+	opal_texelPackRGB9E5(&small_packed, small, 1);
+	opal_texelUnpackRGB9E5(unpacked, &small_packed, 1);
+
+	EXPECT_NEAR(unpacked[0], 1000.0f, 2.0f);
+	EXPECT_EQ(unpacked[1], 0.0f);
+	EXPECT_NEAR(unpacked[2], 3.0f, 2.0f);
+}
+
+TEST(Texel, DownsampleBoxRGBA8)
+{
+	const uint32_t width = 37 * 2;
+	const uint32_t height = 6;
+
+	std::vector<uint8_t> src(width * height * 4);
+	for (size_t i = 0; i < src.size(); ++i)
+		src[i] = (uint8_t)(i * 37 + (i >> 7));
+
+	std::vector<uint8_t> dst(width / 2 * height / 2 * 4);
+	ASSERT_EQ(opal_texelDownsample(OPAL_TEXTURE_FORMAT_RGBA8_UNORM, OPAL_TEXEL_FILTER_BOX, width, height, width * 4, src.data(), width / 2 * 4, dst.data()), OPAL_SUCCESS);
+
+	for (uint32_t y = 0; y < height / 2; ++y)
+	{
+		for (uint32_t x = 0; x < width / 2; ++x)
+		{
+			for (uint32_t c = 0; c < 4; ++c)
+			{
+				uint32_t sum = 0;
+				sum += src[((y * 2 + 0) * width + x * 2 + 0) * 4 + c];
+				sum += src[((y * 2 + 0) * width + x * 2 + 1) * 4 + c];
+				sum += src[((y * 2 + 1) * width + x * 2 + 0) * 4 + c];
+				sum += src[((y * 2 + 1) * width + x * 2 + 1) * 4 + c];
+
+				EXPECT_EQ(dst[(y * width / 2 + x) * 4 + c], (sum + 2) / 4);
+			}
+		}
+	}
+}
+
+TEST(Texel, DownsampleBoxFloat)
+{
+	const uint32_t width = 4;
+	const uint32_t height = 2;
+
+	float src[width * height] =
+	{
+		1.0f, 3.0f, 5.0f, 7.0f,
+		3.0f, 5.0f, 7.0f, 9.0f,
+	};
+
+	float dst[2] = {};
+	ASSERT_EQ(opal_texelDownsample(OPAL_TEXTURE_FORMAT_R32_SFLOAT, OPAL_TEXEL_FILTER_BOX, width, height, width * sizeof(float), src, sizeof(dst), dst), OPAL_SUCCESS);
+
+	EXPECT_FLOAT_EQ(dst[0], 3.0f);
+	EXPECT_FLOAT_EQ(dst[1], 7.0f);
+}
+
+TEST(Texel, DownsampleBoxOddSize)
+{
+	// note: odd source sizes weight the middle texel by half on both sides
+	float src[3] = {0.0f, 4.0f, 8.0f};
+	float dst[1] = {};
+
+	ASSERT_EQ(opal_texelDownsample(OPAL_TEXTURE_FORMAT_R32_SFLOAT, OPAL_TEXEL_FILTER_BOX, 3, 1, sizeof(src), src, sizeof(dst), dst), OPAL_SUCCESS);
+	EXPECT_FLOAT_EQ(dst[0], 4.0f);
+}
+
+TEST(Texel, DownsampleSrgbIsLinear)
+{
+	uint8_t src[2 * 2 * 4] =
+	{
+		0, 0, 0, 255,   255, 255, 255, 255,
+		0, 0, 0, 255,   255, 255, 255, 255,
+	};
+
+	// note: 2x2 goes through the table path, 3x2 through the generic filter and covers all three columns
+	uint8_t dst[4] = {};
+	ASSERT_EQ(opal_texelDownsample(OPAL_TEXTURE_FORMAT_RGBA8_UNORM_SRGB, OPAL_TEXEL_FILTER_BOX, 2, 2, 8, src, 4, dst), OPAL_SUCCESS);
+
+	EXPECT_EQ(dst[0], 188);
+	EXPECT_EQ(dst[1], 188);
+	EXPECT_EQ(dst[2], 188);
+	EXPECT_EQ(dst[3], 255);
+
+	uint8_t wide_src[3 * 2 * 4] =
+	{
+		0, 0, 0, 255,   255, 255, 255, 255,   0, 0, 0, 255,
+		0, 0, 0, 255,   255, 255, 255, 255,   0, 0, 0, 255,
+	};
+
+	ASSERT_EQ(opal_texelDownsample(OPAL_TEXTURE_FORMAT_BGRA8_UNORM_SRGB, OPAL_TEXEL_FILTER_BOX, 3, 2, 12, wide_src, 4, dst), OPAL_SUCCESS);
+
+	EXPECT_EQ(dst[0], 156);
+	EXPECT_EQ(dst[1], 156);
+	EXPECT_EQ(dst[2], 156);
+	EXPECT_EQ(dst[3], 255);
+}
+
+TEST(Texel, DownsampleKaiserConstant)
+{
+	const uint32_t width = 32;
+	const uint32_t height = 16;
+
+	std::vector<uint16_t> src(width * height * 4);
+	float color[4] = {0.25f, 0.5f, 2.0f, 1.0f};
+
+	for (uint32_t i = 0; i < width * height; ++i)
+		opal_texelFloatToHalf(src.data() + i * 4, color, 4);
+
+	std::vector<uint16_t> dst(width / 2 * height / 2 * 4);
+	ASSERT_EQ(opal_texelDownsample(OPAL_TEXTURE_FORMAT_RGBA16_SFLOAT, OPAL_TEXEL_FILTER_KAISER, width, height, width * 8, src.data(), width / 2 * 8, dst.data()), OPAL_SUCCESS);
+
+	std::vector<float> result(dst.size());
+	opal_texelHalfToFloat(result.data(), dst.data(), (uint32_t)dst.size());
+
+	for (size_t i = 0; i < result.size(); ++i)
+		EXPECT_NEAR(result[i], color[i % 4], 1e-3f);
+}
+
+TEST(Texel, DownsampleOneTexel)
+{
+	uint8_t src[4] = {10, 20, 30, 40};
+	uint8_t dst[4] = {};
+
+	ASSERT_EQ(opal_texelDownsample(OPAL_TEXTURE_FORMAT_BGRA8_UNORM, OPAL_TEXEL_FILTER_KAISER, 1, 1, 4, src, 4, dst), OPAL_SUCCESS);
+
+	for (uint32_t c = 0; c < 4; ++c)
+		EXPECT_EQ(dst[c], src[c]);
+}
+
+TEST(Texel, DownsampleUnsupportedFormat)
+{
+	uint8_t src[64] = {};
+	uint8_t dst[64] = {};
+
+	EXPECT_EQ(opal_texelDownsample(OPAL_TEXTURE_FORMAT_BC1_R5G6B5_UNORM, OPAL_TEXEL_FILTER_BOX, 8, 8, 16, src, 8, dst), OPAL_TEXTURE_FORMAT_NOT_SUPPORTED);
+	EXPECT_EQ(opal_texelDownsample(OPAL_TEXTURE_FORMAT_R16_UINT, OPAL_TEXEL_FILTER_BOX, 4, 4, 8, src, 4, dst), OPAL_TEXTURE_FORMAT_NOT_SUPPORTED);
+}
+
+int main(int argc, char **argv)
+{
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include <opal.h>
+
+class TransientTest : public testing::Test
+{
+protected:
+	static const uint32_t frame_size = 1024;
+	static const uint32_t num_frames = 2;
+
+	void SetUp() override
+	{
+		Opal_InstanceDesc instance_desc = {};
+		instance_desc.application_name = "test_transient";
+		instance_desc.engine_name = "opal";
+
+		ASSERT_EQ(opalCreateInstance(OPAL_API_NULL, &instance_desc, &instance), OPAL_SUCCESS);
+		ASSERT_EQ(opalCreateDefaultDevice(instance, OPAL_DEVICE_HINT_DEFAULT, &device), OPAL_SUCCESS);
+
+		Opal_DeviceInfo info = {};
+		ASSERT_EQ(opalGetDeviceInfo(device, &info), OPAL_SUCCESS);
+		min_alignment = info.limits.min_uniform_buffer_offset_alignment;
+
+		Opal_SemaphoreDesc semaphore_desc = {};
+		semaphore_desc.flags = OPAL_SEMAPHORE_CREATION_FLAGS_HOST_OPERATIONS;
+		ASSERT_EQ(opalCreateSemaphore(device, &semaphore_desc, &semaphore), OPAL_SUCCESS);
+
+		Opal_TransientAllocatorDesc allocator_desc = {};
+		allocator_desc.frame_size = frame_size;
+		allocator_desc.num_frames = num_frames;
+		allocator_desc.usage = OPAL_BUFFER_USAGE_UNIFORM;
+
+		ASSERT_EQ(opalCreateTransientAllocator(device, &allocator_desc, &allocator), OPAL_SUCCESS);
+	}
+
+	void TearDown() override
+	{
+		// note: the allocator waits for every closed frame on destroy
+		if (semaphore != OPAL_NULL_HANDLE)
+			opalSignalSemaphore(device, semaphore, UINT64_MAX);
+
+		if (allocator != OPAL_NULL_HANDLE)
+			opalDestroyTransientAllocator(allocator);
+
+		opalDestroySemaphore(device, semaphore);
+		opalDestroyDevice(device);
+		opalDestroyInstance(instance);
+	}
+
+	Opal_Instance instance {OPAL_NULL_HANDLE};
+	Opal_Device device {OPAL_NULL_HANDLE};
+	Opal_Semaphore semaphore {OPAL_NULL_HANDLE};
+	Opal_TransientAllocator allocator {OPAL_NULL_HANDLE};
+	uint64_t min_alignment {0};
+};
+
+TEST_F(TransientTest, AllocationsAreAligned)
+{
+	Opal_Buffer buffer = OPAL_NULL_HANDLE;
+	ASSERT_EQ(opalGetTransientBuffer(allocator, &buffer), OPAL_SUCCESS);
+
+	Opal_TransientAllocation first = {};
+	Opal_TransientAllocation second = {};
+	Opal_TransientAllocation third = {};
+
+	ASSERT_EQ(opalAllocateTransient(allocator, 3, 1, &first), OPAL_SUCCESS);
+	ASSERT_EQ(opalAllocateTransient(allocator, 5, 1, &second), OPAL_SUCCESS);
+	ASSERT_EQ(opalAllocateTransient(allocator, 8, min_alignment * 4, &third), OPAL_SUCCESS);
+
+	EXPECT_EQ(first.buffer, buffer);
+	EXPECT_EQ(first.offset, 0u);
+
+	// note: requested alignments below the uniform offset alignment are raised to it
+	EXPECT_EQ(second.offset, min_alignment);
+	EXPECT_EQ(third.offset, min_alignment * 4);
+
+	EXPECT_EQ((uint8_t *)second.ptr - (uint8_t *)first.ptr, (ptrdiff_t)second.offset);
+	EXPECT_EQ((uint8_t *)third.ptr - (uint8_t *)first.ptr, (ptrdiff_t)third.offset);
+}
+
+TEST_F(TransientTest, FullFrameFails)
+{
+	Opal_TransientAllocation allocation = {};
+
+	ASSERT_EQ(opalAllocateTransient(allocator, frame_size - min_alignment, 1, &allocation), OPAL_SUCCESS);
+	EXPECT_EQ(opalAllocateTransient(allocator, min_alignment * 2, 1, &allocation), OPAL_NO_MEMORY);
+
+	// note: a failed allocation doesn't use up the rest of the region
+	ASSERT_EQ(opalAllocateTransient(allocator, min_alignment, 1, &allocation), OPAL_SUCCESS);
+	EXPECT_EQ(allocation.offset, frame_size - min_alignment);
+
+	EXPECT_EQ(opalAllocateTransient(allocator, 1, 1, &allocation), OPAL_NO_MEMORY);
+}
+
+TEST_F(TransientTest, FramesUseSeparateRegions)
+{
+	Opal_TransientAllocation allocations[num_frames] = {};
+
+	for (uint32_t i = 0; i < num_frames; ++i)
+	{
+		ASSERT_EQ(opalAllocateTransient(allocator, 64, 1, &allocations[i]), OPAL_SUCCESS);
+		EXPECT_EQ(allocations[i].offset, (uint64_t)frame_size * i);
+
+		memset(allocations[i].ptr, 0xA0 + i, 64);
+		ASSERT_EQ(opalEndTransientFrame(allocator, semaphore, i + 1), OPAL_SUCCESS);
+	}
+
+	// note: writes of one frame never land in the region of another one
+	for (uint32_t i = 0; i < num_frames; ++i)
+		EXPECT_EQ(((const uint8_t *)allocations[i].ptr)[63], 0xA0 + i);
+}
+
+TEST_F(TransientTest, ResetWaitsForSemaphore)
+{
+	Opal_TransientAllocation first = {};
+	ASSERT_EQ(opalAllocateTransient(allocator, 256, 1, &first), OPAL_SUCCESS);
+	ASSERT_EQ(opalEndTransientFrame(allocator, semaphore, 1), OPAL_SUCCESS);
+
+	Opal_TransientAllocation second = {};
+	ASSERT_EQ(opalAllocateTransient(allocator, 256, 1, &second), OPAL_SUCCESS);
+	ASSERT_EQ(opalEndTransientFrame(allocator, semaphore, 2), OPAL_SUCCESS);
+
+	// note: the first region is still in use by the GPU, waits on the null backend time out instead of blocking
+	Opal_TransientAllocation allocation = {};
+	EXPECT_EQ(opalAllocateTransient(allocator, 16, 1, &allocation), OPAL_WAIT_TIMEOUT);
+
+	ASSERT_EQ(opalSignalSemaphore(device, semaphore, 1), OPAL_SUCCESS);
+
+	// note: the region starts over from its beginning once its frame completed
+	ASSERT_EQ(opalAllocateTransient(allocator, 16, 1, &allocation), OPAL_SUCCESS);
+	EXPECT_EQ(allocation.offset, first.offset);
+	EXPECT_EQ(allocation.ptr, first.ptr);
+
+	ASSERT_EQ(opalAllocateTransient(allocator, 16, 1, &allocation), OPAL_SUCCESS);
+	EXPECT_EQ(allocation.offset, first.offset + min_alignment);
+
+	ASSERT_EQ(opalEndTransientFrame(allocator, semaphore, 3), OPAL_SUCCESS);
+
+	ASSERT_EQ(opalSignalSemaphore(device, semaphore, 2), OPAL_SUCCESS);
+	ASSERT_EQ(opalAllocateTransient(allocator, 16, 1, &allocation), OPAL_SUCCESS);
+	EXPECT_EQ(allocation.offset, second.offset);
+}
+
+TEST_F(TransientTest, EmptyFramesCycle)
+{
+	for (uint32_t i = 0; i < num_frames * 3; ++i)
+	{
+		ASSERT_EQ(opalSignalSemaphore(device, semaphore, i), OPAL_SUCCESS);
+		ASSERT_EQ(opalEndTransientFrame(allocator, semaphore, i + 1), OPAL_SUCCESS);
+	}
+
+	ASSERT_EQ(opalSignalSemaphore(device, semaphore, num_frames * 3), OPAL_SUCCESS);
+
+	Opal_TransientAllocation allocation = {};
+	ASSERT_EQ(opalAllocateTransient(allocator, 16, 1, &allocation), OPAL_SUCCESS);
+	EXPECT_EQ(allocation.offset, 0u);
+}
+
+int main(int argc, char **argv)
+{
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
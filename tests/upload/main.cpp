@@ -0,0 +1,296 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+extern "C"
+{
+#include "upload_internal.h"
+}
+
+// note: mirrors Opal_DeviceInternal, every backend device starts with its table
+struct DeviceHeader
+{
+	Opal_DeviceTable *vtbl;
+};
+
+class UploadTest : public testing::Test
+{
+protected:
+	static const uint32_t ring_size = 1024;
+	static const uint32_t destination_size = 4096;
+
+	void SetUp() override
+	{
+		Opal_InstanceDesc instance_desc = {};
+		instance_desc.application_name = "test_upload";
+		instance_desc.engine_name = "opal";
+
+		ASSERT_EQ(opalCreateInstance(OPAL_API_NULL, &instance_desc, &instance), OPAL_SUCCESS);
+		ASSERT_EQ(opalCreateDefaultDevice(instance, OPAL_DEVICE_HINT_DEFAULT, &device), OPAL_SUCCESS);
+
+		// note: null buffers outside of device local memory have host storage, so copies can be checked
+		Opal_BufferDesc buffer_desc = {};
+		buffer_desc.size = destination_size;
+		buffer_desc.memory_type = OPAL_ALLOCATION_MEMORY_TYPE_READBACK;
+		buffer_desc.usage = OPAL_BUFFER_USAGE_COPY_DST;
+
+		ASSERT_EQ(opalCreateBuffer(device, &buffer_desc, &destination), OPAL_SUCCESS);
+		ASSERT_EQ(opalMapBuffer(device, destination, (void **)&destination_data), OPAL_SUCCESS);
+
+		Opal_UploaderDesc uploader_desc = {};
+		uploader_desc.ring_size = ring_size;
+		uploader_desc.num_batches = 2;
+
+		ASSERT_EQ(opalCreateUploader(device, &uploader_desc, &uploader), OPAL_SUCCESS);
+
+		// note: null submits complete right away, so submits are intercepted to keep batches in flight
+		DeviceHeader *device_ptr = (DeviceHeader *)device;
+		ASSERT_EQ(opalGetDeviceTable(device, &table), OPAL_SUCCESS);
+
+		original_table = device_ptr->vtbl;
+		next_submit = table.submit;
+		next_signal_semaphore = table.signalSemaphore;
+		table.submit = holdSubmit;
+		device_ptr->vtbl = &table;
+
+		current = this;
+	}
+
+	void TearDown() override
+	{
+		hold = false;
+
+		if (uploader != OPAL_NULL_HANDLE)
+			opalDestroyUploader(uploader);
+
+		if (destination_data != nullptr)
+			opalUnmapBuffer(device, destination);
+
+		opalDestroyBuffer(device, destination);
+
+		if (original_table != nullptr)
+			((DeviceHeader *)device)->vtbl = original_table;
+
+		current = nullptr;
+
+		opalDestroyDevice(device);
+		opalDestroyInstance(instance);
+	}
+
+	// note: the signalled values are rewound to what the test completed so far, waits on them time out
+	static Opal_Result holdSubmit(Opal_Device device, Opal_Queue queue, const Opal_SubmitDesc *desc)
+	{
+		Opal_Result result = current->next_submit(device, queue, desc);
+		if (result != OPAL_SUCCESS || !current->hold)
+			return result;
+
+		current->num_held_submits++;
+
+		for (uint32_t i = 0; i < desc->num_signal_semaphores; ++i)
+			current->next_signal_semaphore(device, desc->signal_semaphores[i], current->completed_value);
+
+		return result;
+	}
+
+	void complete(Opal_Semaphore semaphore, uint64_t value)
+	{
+		completed_value = value;
+		ASSERT_EQ(next_signal_semaphore(device, semaphore, value), OPAL_SUCCESS);
+	}
+
+	std::vector<uint8_t> makeData(uint32_t size, uint8_t seed)
+	{
+		std::vector<uint8_t> data(size);
+		for (uint32_t i = 0; i < size; ++i)
+			data[i] = (uint8_t)(i * 13 + seed);
+
+		return data;
+	}
+
+	const Upload_Uploader *state() const
+	{
+		return (const Upload_Uploader *)uploader;
+	}
+
+	Opal_Instance instance {OPAL_NULL_HANDLE};
+	Opal_Device device {OPAL_NULL_HANDLE};
+	Opal_Buffer destination {OPAL_NULL_HANDLE};
+	uint8_t *destination_data {nullptr};
+	Opal_Uploader uploader {OPAL_NULL_HANDLE};
+
+	static UploadTest *current;
+
+	Opal_DeviceTable table {};
+	Opal_DeviceTable *original_table {nullptr};
+	PFN_opalSubmit next_submit {nullptr};
+	PFN_opalSignalSemaphore next_signal_semaphore {nullptr};
+	bool hold {false};
+	uint64_t completed_value {0};
+	uint32_t num_held_submits {0};
+};
+
+UploadTest *UploadTest::current = nullptr;
+
+TEST_F(UploadTest, AlignmentsFollowDeviceLimits)
+{
+	Opal_DeviceInfo info = {};
+	ASSERT_EQ(opalGetDeviceInfo(device, &info), OPAL_SUCCESS);
+
+	EXPECT_EQ(state()->row_alignment, info.limits.min_texture_copy_row_alignment);
+	EXPECT_GE(state()->offset_alignment, info.limits.min_texture_copy_offset_alignment);
+	EXPECT_EQ(state()->offset_alignment % 16, 0u);
+}
+
+TEST_F(UploadTest, TextureRowsUseDeviceRowAlignment)
+{
+	Opal_TextureDesc texture_desc = {};
+	texture_desc.type = OPAL_TEXTURE_TYPE_2D;
+	texture_desc.format = OPAL_TEXTURE_FORMAT_RGBA8_UNORM;
+	texture_desc.width = 5;
+	texture_desc.height = 4;
+	texture_desc.depth = 1;
+	texture_desc.mip_count = 1;
+	texture_desc.layer_count = 1;
+	texture_desc.samples = OPAL_SAMPLES_1;
+	texture_desc.usage = OPAL_TEXTURE_USAGE_COPY_DST;
+
+	Opal_Texture texture = OPAL_NULL_HANDLE;
+	ASSERT_EQ(opalCreateTexture(device, &texture_desc, &texture), OPAL_SUCCESS);
+
+	Opal_TextureViewDesc view_desc = {};
+	view_desc.texture = texture;
+	view_desc.type = OPAL_TEXTURE_VIEW_TYPE_2D;
+	view_desc.mip_count = 1;
+	view_desc.layer_count = 1;
+
+	Opal_TextureView texture_view = OPAL_NULL_HANDLE;
+	ASSERT_EQ(opalCreateTextureView(device, &view_desc, &texture_view), OPAL_SUCCESS);
+
+	std::vector<uint8_t> data = makeData(5 * 4 * 4, 4);
+
+	Opal_TextureRegion region = {};
+	region.texture_view = texture_view;
+
+	ASSERT_EQ(opalUploadTexture(uploader, region, {5, 4, 1}, data.data(), 5 * 4, 4), OPAL_SUCCESS);
+
+	// note: rows are only padded as much as the device needs, 256 byte rows would take 1024 bytes here
+	uint64_t row_pitch = (20 + state()->row_alignment - 1) / state()->row_alignment * state()->row_alignment;
+	EXPECT_EQ(state()->ring_head, row_pitch * 4);
+
+	for (uint32_t row = 0; row < 4; ++row)
+		EXPECT_EQ(memcmp(state()->ring_data + row * row_pitch, data.data() + row * 20, 20), 0);
+
+	Opal_Semaphore semaphore = OPAL_NULL_HANDLE;
+	uint64_t value = 0;
+	ASSERT_EQ(opalFlushUploads(uploader, &semaphore, &value), OPAL_SUCCESS);
+	ASSERT_EQ(opalWaitSemaphore(device, semaphore, value, UINT64_MAX), OPAL_SUCCESS);
+
+	opalDestroyTextureView(device, texture_view);
+	opalDestroyTexture(device, texture);
+}
+
+TEST_F(UploadTest, WrapsRing)
+{
+	std::vector<std::vector<uint8_t>> chunks;
+
+	// note: six chunks of 384 bytes go around a 1024 byte ring twice, the tail of each lap is skipped
+	for (uint32_t i = 0; i < 6; ++i)
+	{
+		chunks.push_back(makeData(384, (uint8_t)(i * 31)));
+		ASSERT_EQ(opalUploadBuffer(uploader, destination, i * 384, chunks[i].data(), 384), OPAL_SUCCESS);
+
+		EXPECT_LE(state()->ring_head - state()->ring_tail, (uint64_t)ring_size);
+	}
+
+	EXPECT_GT(state()->ring_head, 2ull * ring_size);
+
+	Opal_Semaphore semaphore = OPAL_NULL_HANDLE;
+	uint64_t value = 0;
+	ASSERT_EQ(opalFlushUploads(uploader, &semaphore, &value), OPAL_SUCCESS);
+	ASSERT_EQ(opalWaitSemaphore(device, semaphore, value, UINT64_MAX), OPAL_SUCCESS);
+
+	for (uint32_t i = 0; i < 6; ++i)
+		EXPECT_EQ(memcmp(destination_data + i * 384, chunks[i].data(), 384), 0) << "chunk " << i;
+}
+
+TEST_F(UploadTest, ReusesRingAfterSemaphore)
+{
+	hold = true;
+
+	std::vector<uint8_t> first = makeData(ring_size, 1);
+	ASSERT_EQ(opalUploadBuffer(uploader, destination, 0, first.data(), ring_size / 2), OPAL_SUCCESS);
+	ASSERT_EQ(opalUploadBuffer(uploader, destination, ring_size / 2, first.data() + ring_size / 2, ring_size / 2), OPAL_SUCCESS);
+
+	Opal_Semaphore semaphore = OPAL_NULL_HANDLE;
+	uint64_t value = 0;
+	ASSERT_EQ(opalFlushUploads(uploader, &semaphore, &value), OPAL_SUCCESS);
+
+	if (num_held_submits == 0)
+		GTEST_SKIP() << "single backend builds don't dispatch through the device table";
+
+	EXPECT_EQ(state()->num_pending_batches, 1u);
+
+	// note: the ring is full until the batch completes
+	std::vector<uint8_t> second = makeData(64, 2);
+	EXPECT_EQ(opalUploadBuffer(uploader, destination, ring_size, second.data(), 64), OPAL_WAIT_TIMEOUT);
+	EXPECT_EQ(state()->ring_tail, 0u);
+	EXPECT_EQ(state()->num_pending_batches, 1u);
+
+	complete(semaphore, value);
+
+	ASSERT_EQ(opalUploadBuffer(uploader, destination, ring_size, second.data(), 64), OPAL_SUCCESS);
+	EXPECT_EQ(state()->ring_tail, (uint64_t)ring_size);
+	EXPECT_EQ(state()->num_pending_batches, 0u);
+
+	hold = false;
+	ASSERT_EQ(opalFlushUploads(uploader, &semaphore, &value), OPAL_SUCCESS);
+	ASSERT_EQ(opalWaitSemaphore(device, semaphore, value, UINT64_MAX), OPAL_SUCCESS);
+
+	EXPECT_EQ(memcmp(destination_data, first.data(), ring_size), 0);
+	EXPECT_EQ(memcmp(destination_data + ring_size, second.data(), 64), 0);
+}
+
+TEST_F(UploadTest, BatchesWaitForSemaphore)
+{
+	hold = true;
+
+	std::vector<uint8_t> data = makeData(16, 3);
+	Opal_Semaphore semaphore = OPAL_NULL_HANDLE;
+	uint64_t values[2] = {};
+
+	// note: both command buffers are in flight, the third batch has to wait for the first one
+	for (uint32_t i = 0; i < 2; ++i)
+	{
+		ASSERT_EQ(opalUploadBuffer(uploader, destination, i * 16, data.data(), 16), OPAL_SUCCESS);
+		ASSERT_EQ(opalFlushUploads(uploader, &semaphore, &values[i]), OPAL_SUCCESS);
+	}
+
+	if (num_held_submits == 0)
+		GTEST_SKIP() << "single backend builds don't dispatch through the device table";
+
+	EXPECT_EQ(state()->num_pending_batches, 2u);
+	EXPECT_EQ(opalUploadBuffer(uploader, destination, 32, data.data(), 16), OPAL_WAIT_TIMEOUT);
+	EXPECT_EQ(state()->num_pending_batches, 2u);
+
+	complete(semaphore, values[0]);
+
+	ASSERT_EQ(opalUploadBuffer(uploader, destination, 32, data.data(), 16), OPAL_SUCCESS);
+	EXPECT_EQ(state()->num_pending_batches, 1u);
+
+	complete(semaphore, values[1]);
+
+	hold = false;
+	uint64_t value = 0;
+	ASSERT_EQ(opalFlushUploads(uploader, &semaphore, &value), OPAL_SUCCESS);
+	ASSERT_EQ(opalWaitSemaphore(device, semaphore, value, UINT64_MAX), OPAL_SUCCESS);
+	EXPECT_EQ(state()->num_pending_batches, 0u);
+
+	for (uint32_t i = 0; i < 3; ++i)
+		EXPECT_EQ(memcmp(destination_data + i * 16, data.data(), 16), 0);
+}
+
+int main(int argc, char **argv)
+{
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
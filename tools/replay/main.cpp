@@ -0,0 +1,1303 @@
+#include <opal.h>
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+extern "C"
+{
+#include "capture/capture_codec.h"
+}
+
+using Clock = std::chrono::steady_clock;
+
+static constexpr uint64_t OFFSCREEN_SWAPCHAIN_BIT = 0x8000000000000000ULL;
+
+struct CallStats
+{
+	uint64_t count {0};
+	uint64_t total_ns {0};
+	uint64_t max_ns {0};
+};
+
+struct OffscreenSwapchain
+{
+	Opal_Device device {OPAL_NULL_HANDLE};
+	Opal_Texture texture {OPAL_NULL_HANDLE};
+	Opal_TextureView texture_view {OPAL_NULL_HANDLE};
+};
+
+struct Replayer
+{
+	Capture_Stream stream {};
+	Opal_Api api {OPAL_API_NULL};
+	uint32_t width {1920};
+	uint32_t height {1080};
+
+	std::unordered_map<uint64_t, uint64_t> handles[CAPTURE_HANDLE_TYPE_ENUM_MAX];
+	std::unordered_map<Opal_Buffer, uint8_t *> mapped_buffers;
+	std::unordered_map<Opal_Swapchain, OffscreenSwapchain> offscreen_swapchains;
+	uint64_t num_offscreen_swapchains {0};
+
+	CallStats stats[CAPTURE_CALL_ENUM_MAX];
+	std::vector<uint64_t> frame_times;
+	uint64_t frame_ns {0};
+
+	uint64_t num_records {0};
+	uint64_t num_skipped {0};
+	uint64_t num_failed {0};
+	uint64_t num_missing_handles {0};
+};
+
+/*
+ */
+static uint64_t remapHandle(void *user_data, Capture_HandleType type, uint64_t handle)
+{
+	Replayer *replayer = reinterpret_cast<Replayer *>(user_data);
+	assert(replayer);
+
+	auto it = replayer->handles[type].find(handle);
+	if (it != replayer->handles[type].end())
+		return it->second;
+
+	// note: surfaces are never recreated on replay, everything presented goes to offscreen swapchains
+	if (type != CAPTURE_HANDLE_TYPE_SURFACE)
+		replayer->num_missing_handles++;
+
+	return OPAL_NULL_HANDLE;
+}
+
+template<typename Func>
+static Opal_Result timed(Replayer &replayer, Capture_Call call, Func &&func)
+{
+	Clock::time_point begin = Clock::now();
+	Opal_Result result = func();
+	Clock::time_point end = Clock::now();
+
+	uint64_t ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+
+	CallStats &stats = replayer.stats[call];
+	stats.count++;
+	stats.total_ns += ns;
+	stats.max_ns = std::max(stats.max_ns, ns);
+
+	replayer.frame_ns += ns;
+
+	if (result != OPAL_SUCCESS)
+		replayer.num_failed++;
+
+	return result;
+}
+
+static void bind(Replayer &replayer, Capture_HandleType type, uint64_t captured, uint64_t replayed, Opal_Result result)
+{
+	if (result != OPAL_SUCCESS || captured == OPAL_NULL_HANDLE)
+		return;
+
+	replayer.handles[type][captured] = replayed;
+}
+
+static std::vector<Opal_Swapchain> filterSwapchains(const Replayer &replayer, uint32_t count, const Opal_Swapchain *swapchains)
+{
+	std::vector<Opal_Swapchain> result;
+
+	for (uint32_t i = 0; swapchains && i < count; ++i)
+	{
+		if (swapchains[i] == OPAL_NULL_HANDLE || replayer.offscreen_swapchains.count(swapchains[i]) > 0)
+			continue;
+
+		result.push_back(swapchains[i]);
+	}
+
+	return result;
+}
+
+/*
+ */
+static Opal_Result createOffscreenSwapchain(Replayer &replayer, Opal_Device device, const Opal_SwapchainDesc *desc, Opal_Swapchain *swapchain)
+{
+	OffscreenSwapchain offscreen {};
+	offscreen.device = device;
+
+	Opal_TextureDesc texture_desc {};
+	texture_desc.type = OPAL_TEXTURE_TYPE_2D;
+	texture_desc.format = desc->format.texture_format;
+	texture_desc.width = replayer.width;
+	texture_desc.height = replayer.height;
+	texture_desc.depth = 1;
+	texture_desc.mip_count = 1;
+	texture_desc.layer_count = 1;
+	texture_desc.samples = OPAL_SAMPLES_1;
+	texture_desc.usage = desc->usage;
+	texture_desc.hint = OPAL_ALLOCATION_HINT_AUTO;
+
+	Opal_Result result = opalCreateTexture(device, &texture_desc, &offscreen.texture);
+	if (result != OPAL_SUCCESS)
+		return result;
+
+	Opal_TextureViewDesc texture_view_desc {};
+	texture_view_desc.texture = offscreen.texture;
+	texture_view_desc.type = OPAL_TEXTURE_VIEW_TYPE_2D;
+	texture_view_desc.mip_count = 1;
+	texture_view_desc.layer_count = 1;
+
+	result = opalCreateTextureView(device, &texture_view_desc, &offscreen.texture_view);
+	if (result != OPAL_SUCCESS)
+	{
+		opalDestroyTexture(device, offscreen.texture);
+		return result;
+	}
+
+	*swapchain = OFFSCREEN_SWAPCHAIN_BIT | ++replayer.num_offscreen_swapchains;
+	replayer.offscreen_swapchains[*swapchain] = offscreen;
+
+	return OPAL_SUCCESS;
+}
+
+static void destroyOffscreenSwapchain(Replayer &replayer, Opal_Swapchain swapchain)
+{
+	auto it = replayer.offscreen_swapchains.find(swapchain);
+	if (it == replayer.offscreen_swapchains.end())
+		return;
+
+	opalDestroyTextureView(it->second.device, it->second.texture_view);
+	opalDestroyTexture(it->second.device, it->second.texture);
+
+	replayer.offscreen_swapchains.erase(it);
+}
+
+static void endFrame(Replayer &replayer)
+{
+	replayer.frame_times.push_back(replayer.frame_ns);
+	replayer.frame_ns = 0;
+}
+
+/*
+ */
+static void replayRecord(Replayer &replayer, Capture_Call call)
+{
+	Capture_Stream *stream = &replayer.stream;
+	Opal_Result result = OPAL_SUCCESS;
+
+	Opal_Instance instance = OPAL_NULL_HANDLE;
+	Opal_Device device = OPAL_NULL_HANDLE;
+	Opal_Surface surface = OPAL_NULL_HANDLE;
+	Opal_CommandBuffer command_buffer = OPAL_NULL_HANDLE;
+
+	switch (call)
+	{
+		case CAPTURE_CALL_CREATE_INSTANCE:
+		{
+			Opal_Api api = OPAL_API_AUTO;
+			const Opal_InstanceDesc *desc = nullptr;
+			Opal_Instance captured = OPAL_NULL_HANDLE;
+			capture_callCreateInstance(stream, &api, &desc, &captured);
+
+			Opal_InstanceDesc instance_desc {};
+			if (desc)
+				instance_desc = *desc;
+
+			if (instance_desc.application_name == nullptr)
+				instance_desc.application_name = "opal-replay";
+
+			if (instance_desc.engine_name == nullptr)
+				instance_desc.engine_name = "opal-replay";
+
+			result = timed(replayer, call, [&]() { return opalCreateInstance(replayer.api, &instance_desc, &instance); });
+			bind(replayer, CAPTURE_HANDLE_TYPE_INSTANCE, captured, instance, result);
+		}
+		break;
+
+		case CAPTURE_CALL_ENUMERATE_DEVICES:
+		{
+			capture_callEnumerateDevices(stream, &instance);
+
+			uint32_t device_count = 0;
+			timed(replayer, call, [&]() { return opalEnumerateDevices(instance, &device_count, nullptr); });
+		}
+		break;
+
+		case CAPTURE_CALL_CREATE_SURFACE:
+		{
+			// note: native window handles are not part of the trace, swapchains created for this surface go offscreen
+			Opal_Surface captured = OPAL_NULL_HANDLE;
+			capture_callCreateSurface(stream, &instance, &captured);
+		}
+		break;
+
+		case CAPTURE_CALL_CREATE_HEADLESS_SURFACE:
+		{
+			// note: replay already renders every swapchain offscreen, headless surfaces need no special care
+			uint32_t width = 0;
+			uint32_t height = 0;
+			Opal_Surface captured = OPAL_NULL_HANDLE;
+			capture_callCreateHeadlessSurface(stream, &instance, &width, &height, &captured);
+		}
+		break;
+
+		case CAPTURE_CALL_CREATE_DEVICE:
+		{
+			uint32_t index = 0;
+			Opal_Device captured = OPAL_NULL_HANDLE;
+			capture_callCreateDevice(stream, &instance, &index, &captured);
+
+			result = timed(replayer, call, [&]() { return opalCreateDevice(instance, index, &device); });
+			bind(replayer, CAPTURE_HANDLE_TYPE_DEVICE, captured, device, result);
+		}
+		break;
+
+		case CAPTURE_CALL_CREATE_DEFAULT_DEVICE:
+		{
+			Opal_DeviceHint hint = OPAL_DEVICE_HINT_DEFAULT;
+			Opal_Device captured = OPAL_NULL_HANDLE;
+			capture_callCreateDefaultDevice(stream, &instance, &hint, &captured);
+
+			result = timed(replayer, call, [&]() { return opalCreateDefaultDevice(instance, hint, &device); });
+			bind(replayer, CAPTURE_HANDLE_TYPE_DEVICE, captured, device, result);
+		}
+		break;
+
+		case CAPTURE_CALL_DESTROY_SURFACE:
+		{
+			capture_callDestroySurface(stream, &instance, &surface);
+		}
+		break;
+
+		case CAPTURE_CALL_DESTROY_INSTANCE:
+		{
+			capture_callDestroyInstance(stream, &instance);
+			timed(replayer, call, [&]() { return opalDestroyInstance(instance); });
+		}
+		break;
+
+		case CAPTURE_CALL_GET_DEVICE_INFO:
+		{
+			capture_callGetDeviceInfo(stream, &device);
+
+			Opal_DeviceInfo info {};
+			timed(replayer, call, [&]() { return opalGetDeviceInfo(device, &info); });
+		}
+		break;
+
+		case CAPTURE_CALL_GET_DEVICE_QUEUE:
+		{
+			Opal_DeviceEngineType engine_type = OPAL_DEVICE_ENGINE_TYPE_MAIN;
+			uint32_t index = 0;
+			Opal_Queue captured = OPAL_NULL_HANDLE;
+			capture_callGetDeviceQueue(stream, &device, &engine_type, &index, &captured);
+
+			Opal_Queue queue = OPAL_NULL_HANDLE;
+			result = timed(replayer, call, [&]() { return opalGetDeviceQueue(device, engine_type, index, &queue); });
+			bind(replayer, CAPTURE_HANDLE_TYPE_QUEUE, captured, queue, result);
+		}
+		break;
+
+		case CAPTURE_CALL_GET_ACCELERATION_STRUCTURE_PREBUILD_INFO:
+		{
+			const Opal_AccelerationStructureBuildDesc *desc = nullptr;
+			capture_callGetAccelerationStructurePrebuildInfo(stream, &device, &desc);
+
+			Opal_AccelerationStructurePrebuildInfo info {};
+			timed(replayer, call, [&]() { return opalGetAccelerationStructurePrebuildInfo(device, desc, &info); });
+		}
+		break;
+
+		case CAPTURE_CALL_GET_ACCELERATION_STRUCTURE_ADDRESS:
+		{
+			Opal_AccelerationStructure acceleration_structure {};
+			capture_callGetAccelerationStructureAddress(stream, &device, &acceleration_structure);
+
+			uint64_t address = 0;
+			timed(replayer, call, [&]() { return opalGetAccelerationStructureAddress(device, acceleration_structure, &address); });
+		}
+		break;
+
+		case CAPTURE_CALL_GET_SUPPORTED_SURFACE_FORMATS:
+		case CAPTURE_CALL_GET_SUPPORTED_PRESENT_MODES:
+		case CAPTURE_CALL_GET_PREFERRED_SURFACE_FORMAT:
+		case CAPTURE_CALL_GET_PREFERRED_SURFACE_PRESENT_MODE:
+		{
+			capture_callGetSurfaceQuery(stream, &device, &surface);
+		}
+		break;
+
+#define REPLAY_CREATE(CALL, CODEC, DESC_TYPE, HANDLE_TYPE, FUNC) \
+		case CALL: \
+		{ \
+			const DESC_TYPE *desc = nullptr; \
+			uint64_t captured = OPAL_NULL_HANDLE; \
+			CODEC(stream, &device, &desc, &captured); \
+			\
+			uint64_t handle = OPAL_NULL_HANDLE; \
+			result = timed(replayer, call, [&]() { return FUNC(device, desc, &handle); }); \
+			bind(replayer, HANDLE_TYPE, captured, handle, result); \
+		} \
+		break;
+
+		REPLAY_CREATE(CAPTURE_CALL_CREATE_SEMAPHORE, capture_callCreateSemaphore, Opal_SemaphoreDesc, CAPTURE_HANDLE_TYPE_SEMAPHORE, opalCreateSemaphore)
+		REPLAY_CREATE(CAPTURE_CALL_CREATE_BUFFER, capture_callCreateBuffer, Opal_BufferDesc, CAPTURE_HANDLE_TYPE_BUFFER, opalCreateBuffer)
+		REPLAY_CREATE(CAPTURE_CALL_CREATE_TEXTURE, capture_callCreateTexture, Opal_TextureDesc, CAPTURE_HANDLE_TYPE_TEXTURE, opalCreateTexture)
+		REPLAY_CREATE(CAPTURE_CALL_CREATE_TEXTURE_VIEW, capture_callCreateTextureView, Opal_TextureViewDesc, CAPTURE_HANDLE_TYPE_TEXTURE_VIEW, opalCreateTextureView)
+		REPLAY_CREATE(CAPTURE_CALL_CREATE_SAMPLER, capture_callCreateSampler, Opal_SamplerDesc, CAPTURE_HANDLE_TYPE_SAMPLER, opalCreateSampler)
+		REPLAY_CREATE(CAPTURE_CALL_CREATE_ACCELERATION_STRUCTURE, capture_callCreateAccelerationStructure, Opal_AccelerationStructureDesc, CAPTURE_HANDLE_TYPE_ACCELERATION_STRUCTURE, opalCreateAccelerationStructure)
+		REPLAY_CREATE(CAPTURE_CALL_CREATE_SHADER, capture_callCreateShader, Opal_ShaderDesc, CAPTURE_HANDLE_TYPE_SHADER, opalCreateShader)
+		REPLAY_CREATE(CAPTURE_CALL_CREATE_DESCRIPTOR_HEAP, capture_callCreateDescriptorHeap, Opal_DescriptorHeapDesc, CAPTURE_HANDLE_TYPE_DESCRIPTOR_HEAP, opalCreateDescriptorHeap)
+		REPLAY_CREATE(CAPTURE_CALL_CREATE_GRAPHICS_PIPELINE, capture_callCreateGraphicsPipeline, Opal_GraphicsPipelineDesc, CAPTURE_HANDLE_TYPE_GRAPHICS_PIPELINE, opalCreateGraphicsPipeline)
+		REPLAY_CREATE(CAPTURE_CALL_CREATE_MESHLET_PIPELINE, capture_callCreateMeshletPipeline, Opal_MeshletPipelineDesc, CAPTURE_HANDLE_TYPE_GRAPHICS_PIPELINE, opalCreateMeshletPipeline)
+		REPLAY_CREATE(CAPTURE_CALL_CREATE_COMPUTE_PIPELINE, capture_callCreateComputePipeline, Opal_ComputePipelineDesc, CAPTURE_HANDLE_TYPE_COMPUTE_PIPELINE, opalCreateComputePipeline)
+		REPLAY_CREATE(CAPTURE_CALL_CREATE_RAYTRACE_PIPELINE, capture_callCreateRaytracePipeline, Opal_RaytracePipelineDesc, CAPTURE_HANDLE_TYPE_RAYTRACE_PIPELINE, opalCreateRaytracePipeline)
+
+#undef REPLAY_CREATE
+
+		case CAPTURE_CALL_CREATE_FENCE:
+		{
+			Opal_Fence captured = OPAL_NULL_HANDLE;
+			capture_callCreateFence(stream, &device, &captured);
+
+			Opal_Fence fence = OPAL_NULL_HANDLE;
+			result = timed(replayer, call, [&]() { return opalCreateFence(device, &fence); });
+			bind(replayer, CAPTURE_HANDLE_TYPE_FENCE, captured, fence, result);
+		}
+		break;
+
+		case CAPTURE_CALL_CREATE_SHADER_BINDING_TABLE:
+		{
+			Opal_RaytracePipeline pipeline = OPAL_NULL_HANDLE;
+			Opal_ShaderBindingTable captured = OPAL_NULL_HANDLE;
+			capture_callCreateShaderBindingTable(stream, &device, &pipeline, &captured);
+
+			Opal_ShaderBindingTable shader_binding_table = OPAL_NULL_HANDLE;
+			result = timed(replayer, call, [&]() { return opalCreateShaderBindingTable(device, pipeline, &shader_binding_table); });
+			bind(replayer, CAPTURE_HANDLE_TYPE_SHADER_BINDING_TABLE, captured, shader_binding_table, result);
+		}
+		break;
+
+		case CAPTURE_CALL_CREATE_COMMAND_ALLOCATOR:
+		{
+			Opal_Queue queue = OPAL_NULL_HANDLE;
+			Opal_CommandAllocator captured = OPAL_NULL_HANDLE;
+			capture_callCreateCommandAllocator(stream, &device, &queue, &captured);
+
+			Opal_CommandAllocator command_allocator = OPAL_NULL_HANDLE;
+			result = timed(replayer, call, [&]() { return opalCreateCommandAllocator(device, queue, &command_allocator); });
+			bind(replayer, CAPTURE_HANDLE_TYPE_COMMAND_ALLOCATOR, captured, command_allocator, result);
+		}
+		break;
+
+		case CAPTURE_CALL_CREATE_COMMAND_BUFFER:
+		{
+			Opal_CommandAllocator command_allocator = OPAL_NULL_HANDLE;
+			Opal_CommandBuffer captured = OPAL_NULL_HANDLE;
+			capture_callCreateCommandBuffer(stream, &device, &command_allocator, &captured);
+
+			result = timed(replayer, call, [&]() { return opalCreateCommandBuffer(device, command_allocator, &command_buffer); });
+			bind(replayer, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, captured, command_buffer, result);
+		}
+		break;
+
+		case CAPTURE_CALL_CREATE_DESCRIPTOR_SET_LAYOUT:
+		{
+			uint32_t num_entries = 0;
+			const Opal_DescriptorSetLayoutEntry *entries = nullptr;
+			Opal_DescriptorSetLayout captured = OPAL_NULL_HANDLE;
+			capture_callCreateDescriptorSetLayout(stream, &device, &num_entries, &entries, &captured);
+
+			Opal_DescriptorSetLayout descriptor_set_layout = OPAL_NULL_HANDLE;
+			result = timed(replayer, call, [&]() { return opalCreateDescriptorSetLayout(device, num_entries, entries, &descriptor_set_layout); });
+			bind(replayer, CAPTURE_HANDLE_TYPE_DESCRIPTOR_SET_LAYOUT, captured, descriptor_set_layout, result);
+		}
+		break;
+
+		case CAPTURE_CALL_CREATE_PIPELINE_LAYOUT:
+		{
+			uint32_t num_descriptor_set_layouts = 0;
+			const Opal_DescriptorSetLayout *descriptor_set_layouts = nullptr;
+			Opal_PipelineLayout captured = OPAL_NULL_HANDLE;
+			capture_callCreatePipelineLayout(stream, &device, &num_descriptor_set_layouts, &descriptor_set_layouts, &captured);
+
+			Opal_PipelineLayout pipeline_layout = OPAL_NULL_HANDLE;
+			result = timed(replayer, call, [&]() { return opalCreatePipelineLayout(device, num_descriptor_set_layouts, descriptor_set_layouts, &pipeline_layout); });
+			bind(replayer, CAPTURE_HANDLE_TYPE_PIPELINE_LAYOUT, captured, pipeline_layout, result);
+		}
+		break;
+
+		case CAPTURE_CALL_CREATE_SWAPCHAIN:
+		{
+			const Opal_SwapchainDesc *desc = nullptr;
+			Opal_Swapchain captured = OPAL_NULL_HANDLE;
+			capture_callCreateSwapchain(stream, &device, &desc, &captured);
+
+			Opal_Swapchain swapchain = OPAL_NULL_HANDLE;
+			result = timed(replayer, call, [&]() { return createOffscreenSwapchain(replayer, device, desc, &swapchain); });
+			bind(replayer, CAPTURE_HANDLE_TYPE_SWAPCHAIN, captured, swapchain, result);
+		}
+		break;
+
+#define REPLAY_DESTROY(CALL, HANDLE_TYPE, FUNC) \
+		case CALL: \
+		{ \
+			uint64_t handle = OPAL_NULL_HANDLE; \
+			capture_callDestroyObject(stream, &device, HANDLE_TYPE, &handle); \
+			timed(replayer, call, [&]() { return FUNC(device, handle); }); \
+		} \
+		break;
+
+		REPLAY_DESTROY(CAPTURE_CALL_DESTROY_SEMAPHORE, CAPTURE_HANDLE_TYPE_SEMAPHORE, opalDestroySemaphore)
+		REPLAY_DESTROY(CAPTURE_CALL_DESTROY_FENCE, CAPTURE_HANDLE_TYPE_FENCE, opalDestroyFence)
+		REPLAY_DESTROY(CAPTURE_CALL_DESTROY_TEXTURE, CAPTURE_HANDLE_TYPE_TEXTURE, opalDestroyTexture)
+		REPLAY_DESTROY(CAPTURE_CALL_DESTROY_TEXTURE_VIEW, CAPTURE_HANDLE_TYPE_TEXTURE_VIEW, opalDestroyTextureView)
+		REPLAY_DESTROY(CAPTURE_CALL_DESTROY_SAMPLER, CAPTURE_HANDLE_TYPE_SAMPLER, opalDestroySampler)
+		REPLAY_DESTROY(CAPTURE_CALL_DESTROY_ACCELERATION_STRUCTURE, CAPTURE_HANDLE_TYPE_ACCELERATION_STRUCTURE, opalDestroyAccelerationStructure)
+		REPLAY_DESTROY(CAPTURE_CALL_DESTROY_SHADER_BINDING_TABLE, CAPTURE_HANDLE_TYPE_SHADER_BINDING_TABLE, opalDestroyShaderBindingTable)
+		REPLAY_DESTROY(CAPTURE_CALL_DESTROY_COMMAND_ALLOCATOR, CAPTURE_HANDLE_TYPE_COMMAND_ALLOCATOR, opalDestroyCommandAllocator)
+		REPLAY_DESTROY(CAPTURE_CALL_DESTROY_COMMAND_BUFFER, CAPTURE_HANDLE_TYPE_COMMAND_BUFFER, opalDestroyCommandBuffer)
+		REPLAY_DESTROY(CAPTURE_CALL_DESTROY_SHADER, CAPTURE_HANDLE_TYPE_SHADER, opalDestroyShader)
+		REPLAY_DESTROY(CAPTURE_CALL_DESTROY_DESCRIPTOR_HEAP, CAPTURE_HANDLE_TYPE_DESCRIPTOR_HEAP, opalDestroyDescriptorHeap)
+		REPLAY_DESTROY(CAPTURE_CALL_DESTROY_DESCRIPTOR_SET_LAYOUT, CAPTURE_HANDLE_TYPE_DESCRIPTOR_SET_LAYOUT, opalDestroyDescriptorSetLayout)
+		REPLAY_DESTROY(CAPTURE_CALL_DESTROY_PIPELINE_LAYOUT, CAPTURE_HANDLE_TYPE_PIPELINE_LAYOUT, opalDestroyPipelineLayout)
+		REPLAY_DESTROY(CAPTURE_CALL_DESTROY_GRAPHICS_PIPELINE, CAPTURE_HANDLE_TYPE_GRAPHICS_PIPELINE, opalDestroyGraphicsPipeline)
+		REPLAY_DESTROY(CAPTURE_CALL_DESTROY_COMPUTE_PIPELINE, CAPTURE_HANDLE_TYPE_COMPUTE_PIPELINE, opalDestroyComputePipeline)
+		REPLAY_DESTROY(CAPTURE_CALL_DESTROY_RAYTRACE_PIPELINE, CAPTURE_HANDLE_TYPE_RAYTRACE_PIPELINE, opalDestroyRaytracePipeline)
+
+#undef REPLAY_DESTROY
+
+		case CAPTURE_CALL_DESTROY_BUFFER:
+		{
+			Opal_Buffer buffer = OPAL_NULL_HANDLE;
+			capture_callDestroyObject(stream, &device, CAPTURE_HANDLE_TYPE_BUFFER, &buffer);
+
+			replayer.mapped_buffers.erase(buffer);
+			timed(replayer, call, [&]() { return opalDestroyBuffer(device, buffer); });
+		}
+		break;
+
+		case CAPTURE_CALL_DESTROY_SWAPCHAIN:
+		{
+			Opal_Swapchain swapchain = OPAL_NULL_HANDLE;
+			capture_callDestroyObject(stream, &device, CAPTURE_HANDLE_TYPE_SWAPCHAIN, &swapchain);
+
+			timed(replayer, call, [&]() { destroyOffscreenSwapchain(replayer, swapchain); return OPAL_SUCCESS; });
+		}
+		break;
+
+		case CAPTURE_CALL_DESTROY_DEVICE:
+		{
+			capture_callDestroyDevice(stream, &device);
+
+			for (auto it = replayer.offscreen_swapchains.begin(); it != replayer.offscreen_swapchains.end();)
+			{
+				if (it->second.device != device)
+				{
+					++it;
+					continue;
+				}
+
+				opalDestroyTextureView(device, it->second.texture_view);
+				opalDestroyTexture(device, it->second.texture);
+				it = replayer.offscreen_swapchains.erase(it);
+			}
+
+			replayer.mapped_buffers.clear();
+			timed(replayer, call, [&]() { return opalDestroyDevice(device); });
+		}
+		break;
+
+		case CAPTURE_CALL_BUILD_SHADER_BINDING_TABLE:
+		{
+			Opal_ShaderBindingTable shader_binding_table = OPAL_NULL_HANDLE;
+			const Opal_ShaderBindingTableBuildDesc *desc = nullptr;
+			capture_callBuildShaderBindingTable(stream, &device, &shader_binding_table, &desc);
+
+			timed(replayer, call, [&]() { return opalBuildShaderBindingTable(device, shader_binding_table, desc); });
+		}
+		break;
+
+		case CAPTURE_CALL_BUILD_ACCELERATION_STRUCTURE_INSTANCE_BUFFER:
+		{
+			const Opal_AccelerationStructureInstanceBufferBuildDesc *desc = nullptr;
+			capture_callBuildAccelerationStructureInstanceBuffer(stream, &device, &desc);
+
+			timed(replayer, call, [&]() { return opalBuildAccelerationStructureInstanceBuffer(device, desc); });
+		}
+		break;
+
+		case CAPTURE_CALL_RESET_COMMAND_ALLOCATOR:
+		{
+			Opal_CommandAllocator command_allocator = OPAL_NULL_HANDLE;
+			capture_callResetCommandAllocator(stream, &device, &command_allocator);
+
+			timed(replayer, call, [&]() { return opalResetCommandAllocator(device, command_allocator); });
+		}
+		break;
+
+		case CAPTURE_CALL_ALLOCATE_DESCRIPTOR_SET:
+		{
+			const Opal_DescriptorSetAllocationDesc *desc = nullptr;
+			Opal_DescriptorSet captured = OPAL_NULL_HANDLE;
+			capture_callAllocateDescriptorSet(stream, &device, &desc, nullptr, &captured);
+
+			Opal_DescriptorSet descriptor_set = OPAL_NULL_HANDLE;
+			result = timed(replayer, call, [&]() { return opalAllocateDescriptorSet(device, desc, &descriptor_set); });
+			bind(replayer, CAPTURE_HANDLE_TYPE_DESCRIPTOR_SET, captured, descriptor_set, result);
+		}
+		break;
+
+		case CAPTURE_CALL_FREE_DESCRIPTOR_SET:
+		{
+			Opal_DescriptorSet descriptor_set = OPAL_NULL_HANDLE;
+			capture_callFreeDescriptorSet(stream, &device, &descriptor_set);
+
+			timed(replayer, call, [&]() { return opalFreeDescriptorSet(device, descriptor_set); });
+		}
+		break;
+
+		case CAPTURE_CALL_MAP_BUFFER:
+		{
+			Opal_Buffer buffer = OPAL_NULL_HANDLE;
+			capture_callMapBuffer(stream, &device, &buffer);
+
+			void *ptr = nullptr;
+			result = timed(replayer, call, [&]() { return opalMapBuffer(device, buffer, &ptr); });
+
+			if (result == OPAL_SUCCESS)
+				replayer.mapped_buffers[buffer] = reinterpret_cast<uint8_t *>(ptr);
+		}
+		break;
+
+		case CAPTURE_CALL_UNMAP_BUFFER:
+		{
+			Opal_Buffer buffer = OPAL_NULL_HANDLE;
+			capture_callUnmapBuffer(stream, &device, &buffer);
+
+			replayer.mapped_buffers.erase(buffer);
+			timed(replayer, call, [&]() { return opalUnmapBuffer(device, buffer); });
+		}
+		break;
+
+		case CAPTURE_CALL_WRITE_BUFFER:
+		{
+			Opal_Buffer buffer = OPAL_NULL_HANDLE;
+			uint64_t offset = 0;
+			const void *data = nullptr;
+			uint64_t size = 0;
+			capture_callWriteBuffer(stream, &device, &buffer, &offset, &data, &size);
+
+			timed(replayer, call, [&]() { return opalWriteBuffer(device, buffer, offset, data, size); });
+		}
+		break;
+
+		case CAPTURE_CALL_UPDATE_DESCRIPTOR_SET:
+		{
+			Opal_DescriptorSet descriptor_set = OPAL_NULL_HANDLE;
+			uint32_t num_entries = 0;
+			const Opal_DescriptorSetEntry *entries = nullptr;
+			capture_callUpdateDescriptorSet(stream, &device, &descriptor_set, &num_entries, &entries, nullptr);
+
+			timed(replayer, call, [&]() { return opalUpdateDescriptorSet(device, descriptor_set, num_entries, entries); });
+		}
+		break;
+
+		case CAPTURE_CALL_BEGIN_COMMAND_BUFFER:
+		{
+			capture_callBeginCommandBuffer(stream, &device, &command_buffer);
+			timed(replayer, call, [&]() { return opalBeginCommandBuffer(device, command_buffer); });
+		}
+		break;
+
+		case CAPTURE_CALL_END_COMMAND_BUFFER:
+		{
+			capture_callEndCommandBuffer(stream, &device, &command_buffer);
+			timed(replayer, call, [&]() { return opalEndCommandBuffer(device, command_buffer); });
+		}
+		break;
+
+		case CAPTURE_CALL_QUERY_SEMAPHORE:
+		{
+			Opal_Semaphore semaphore = OPAL_NULL_HANDLE;
+			capture_callQuerySemaphore(stream, &device, &semaphore);
+
+			uint64_t value = 0;
+			timed(replayer, call, [&]() { return opalQuerySemaphore(device, semaphore, &value); });
+		}
+		break;
+
+		case CAPTURE_CALL_SIGNAL_SEMAPHORE:
+		{
+			Opal_Semaphore semaphore = OPAL_NULL_HANDLE;
+			uint64_t value = 0;
+			capture_callSignalSemaphore(stream, &device, &semaphore, &value);
+
+			timed(replayer, call, [&]() { return opalSignalSemaphore(device, semaphore, value); });
+		}
+		break;
+
+		case CAPTURE_CALL_WAIT_SEMAPHORE:
+		{
+			Opal_Semaphore semaphore = OPAL_NULL_HANDLE;
+			uint64_t value = 0;
+			uint64_t timeout_milliseconds = 0;
+			capture_callWaitSemaphore(stream, &device, &semaphore, &value, &timeout_milliseconds);
+
+			timed(replayer, call, [&]() { return opalWaitSemaphore(device, semaphore, value, timeout_milliseconds); });
+		}
+		break;
+
+		case CAPTURE_CALL_WAIT_SEMAPHORES:
+		{
+			uint32_t num_semaphores = 0;
+			const Opal_Semaphore *semaphores = nullptr;
+			const uint64_t *values = nullptr;
+			uint32_t wait_any = 0;
+			uint64_t timeout_milliseconds = 0;
+			capture_callWaitSemaphores(stream, &device, &num_semaphores, &semaphores, &values, &wait_any, &timeout_milliseconds);
+
+			timed(replayer, call, [&]() { return opalWaitSemaphores(device, num_semaphores, semaphores, values, wait_any, timeout_milliseconds); });
+		}
+		break;
+
+		case CAPTURE_CALL_WAIT_QUEUE:
+		{
+			Opal_Queue queue = OPAL_NULL_HANDLE;
+			capture_callWaitQueue(stream, &device, &queue);
+
+			timed(replayer, call, [&]() { return opalWaitQueue(device, queue); });
+		}
+		break;
+
+		case CAPTURE_CALL_WAIT_IDLE:
+		{
+			capture_callWaitIdle(stream, &device);
+			timed(replayer, call, [&]() { return opalWaitIdle(device); });
+		}
+		break;
+
+		case CAPTURE_CALL_SUBMIT:
+		{
+			Opal_Queue queue = OPAL_NULL_HANDLE;
+			const Opal_SubmitDesc *desc = nullptr;
+			capture_callSubmit(stream, &device, &queue, &desc);
+
+			if (desc == nullptr)
+				break;
+
+			// note: offscreen swapchains have no acquire / present semaphores
+			std::vector<Opal_Swapchain> wait_swapchains = filterSwapchains(replayer, desc->num_wait_swapchains, desc->wait_swapchains);
+			std::vector<Opal_Swapchain> signal_swapchains = filterSwapchains(replayer, desc->num_signal_swapchains, desc->signal_swapchains);
+
+			Opal_SubmitDesc submit_desc = *desc;
+			submit_desc.num_wait_swapchains = static_cast<uint32_t>(wait_swapchains.size());
+			submit_desc.wait_swapchains = wait_swapchains.data();
+			submit_desc.num_signal_swapchains = static_cast<uint32_t>(signal_swapchains.size());
+			submit_desc.signal_swapchains = signal_swapchains.data();
+
+			timed(replayer, call, [&]() { return opalSubmit(device, queue, &submit_desc); });
+		}
+		break;
+
+		case CAPTURE_CALL_ACQUIRE:
+		{
+			Opal_Swapchain swapchain = OPAL_NULL_HANDLE;
+			Opal_TextureView captured = OPAL_NULL_HANDLE;
+			capture_callAcquire(stream, &device, &swapchain, &captured);
+
+			Opal_TextureView texture_view = OPAL_NULL_HANDLE;
+			result = timed(replayer, call, [&]()
+			{
+				auto it = replayer.offscreen_swapchains.find(swapchain);
+				if (it != replayer.offscreen_swapchains.end())
+				{
+					texture_view = it->second.texture_view;
+					return OPAL_SUCCESS;
+				}
+
+				return opalAcquire(device, swapchain, &texture_view);
+			});
+
+			bind(replayer, CAPTURE_HANDLE_TYPE_TEXTURE_VIEW, captured, texture_view, result);
+		}
+		break;
+
+		case CAPTURE_CALL_PRESENT:
+		{
+			Opal_Swapchain swapchain = OPAL_NULL_HANDLE;
+			capture_callPresent(stream, &device, &swapchain);
+
+			timed(replayer, call, [&]()
+			{
+				if (replayer.offscreen_swapchains.count(swapchain) > 0)
+					return OPAL_SUCCESS;
+
+				return opalPresent(device, swapchain);
+			});
+
+			endFrame(replayer);
+		}
+		break;
+
+		case CAPTURE_CALL_WAIT_PRESENT:
+		{
+			Opal_Swapchain swapchain = OPAL_NULL_HANDLE;
+			uint64_t frame_id = 0;
+			uint64_t timeout_milliseconds = 0;
+			capture_callWaitPresent(stream, &device, &swapchain, &frame_id, &timeout_milliseconds);
+
+			timed(replayer, call, [&]()
+			{
+				if (replayer.offscreen_swapchains.count(swapchain) > 0)
+					return OPAL_SUCCESS;
+
+				return opalWaitPresent(device, swapchain, frame_id, timeout_milliseconds);
+			});
+		}
+		break;
+
+		case CAPTURE_CALL_GET_SWAPCHAIN_FRAME_TIMING:
+		{
+			Opal_Swapchain swapchain = OPAL_NULL_HANDLE;
+			capture_callGetSwapchainFrameTiming(stream, &device, &swapchain);
+
+			Opal_FrameTiming timing {};
+			timed(replayer, call, [&]()
+			{
+				if (replayer.offscreen_swapchains.count(swapchain) > 0)
+					return OPAL_SUCCESS;
+
+				return opalGetSwapchainFrameTiming(device, swapchain, &timing);
+			});
+		}
+		break;
+
+		case CAPTURE_CALL_CMD_SET_DESCRIPTOR_HEAP:
+		{
+			Opal_DescriptorHeap descriptor_heap = OPAL_NULL_HANDLE;
+			capture_callCmdSetDescriptorHeap(stream, &device, &command_buffer, &descriptor_heap);
+
+			timed(replayer, call, [&]() { return opalCmdSetDescriptorHeap(device, command_buffer, descriptor_heap); });
+		}
+		break;
+
+		case CAPTURE_CALL_CMD_BEGIN_GRAPHICS_PASS:
+		{
+			const Opal_FramebufferDesc *desc = nullptr;
+			const Opal_PassBarriersDesc *barriers = nullptr;
+			capture_callCmdBeginGraphicsPass(stream, &device, &command_buffer, &desc, &barriers);
+
+			timed(replayer, call, [&]() { return opalCmdBeginGraphicsPass(device, command_buffer, desc, barriers); });
+		}
+		break;
+
+#define REPLAY_PASS(CALL, FUNC) \
+		case CALL: \
+		{ \
+			const Opal_PassBarriersDesc *barriers = nullptr; \
+			capture_callCmdBeginPass(stream, &device, &command_buffer, &barriers); \
+			timed(replayer, call, [&]() { return FUNC(device, command_buffer, barriers); }); \
+		} \
+		break;
+
+		REPLAY_PASS(CAPTURE_CALL_CMD_END_GRAPHICS_PASS, opalCmdEndGraphicsPass)
+		REPLAY_PASS(CAPTURE_CALL_CMD_BEGIN_COMPUTE_PASS, opalCmdBeginComputePass)
+		REPLAY_PASS(CAPTURE_CALL_CMD_END_COMPUTE_PASS, opalCmdEndComputePass)
+		REPLAY_PASS(CAPTURE_CALL_CMD_BEGIN_RAYTRACE_PASS, opalCmdBeginRaytracePass)
+		REPLAY_PASS(CAPTURE_CALL_CMD_END_RAYTRACE_PASS, opalCmdEndRaytracePass)
+		REPLAY_PASS(CAPTURE_CALL_CMD_BEGIN_COPY_PASS, opalCmdBeginCopyPass)
+		REPLAY_PASS(CAPTURE_CALL_CMD_END_COPY_PASS, opalCmdEndCopyPass)
+		REPLAY_PASS(CAPTURE_CALL_CMD_BEGIN_ACCELERATION_STRUCTURE_PASS, opalCmdBeginAccelerationStructurePass)
+		REPLAY_PASS(CAPTURE_CALL_CMD_END_ACCELERATION_STRUCTURE_PASS, opalCmdEndAccelerationStructurePass)
+
+#undef REPLAY_PASS
+
+#define REPLAY_SET_OBJECT(CALL, HANDLE_TYPE, FUNC) \
+		case CALL: \
+		{ \
+			uint64_t handle = OPAL_NULL_HANDLE; \
+			capture_callCmdSetObject(stream, &device, &command_buffer, HANDLE_TYPE, &handle); \
+			timed(replayer, call, [&]() { return FUNC(device, command_buffer, handle); }); \
+		} \
+		break;
+
+		REPLAY_SET_OBJECT(CAPTURE_CALL_CMD_GRAPHICS_SET_PIPELINE_LAYOUT, CAPTURE_HANDLE_TYPE_PIPELINE_LAYOUT, opalCmdGraphicsSetPipelineLayout)
+		REPLAY_SET_OBJECT(CAPTURE_CALL_CMD_GRAPHICS_SET_PIPELINE, CAPTURE_HANDLE_TYPE_GRAPHICS_PIPELINE, opalCmdGraphicsSetPipeline)
+		REPLAY_SET_OBJECT(CAPTURE_CALL_CMD_COMPUTE_SET_PIPELINE_LAYOUT, CAPTURE_HANDLE_TYPE_PIPELINE_LAYOUT, opalCmdComputeSetPipelineLayout)
+		REPLAY_SET_OBJECT(CAPTURE_CALL_CMD_COMPUTE_SET_PIPELINE, CAPTURE_HANDLE_TYPE_COMPUTE_PIPELINE, opalCmdComputeSetPipeline)
+		REPLAY_SET_OBJECT(CAPTURE_CALL_CMD_RAYTRACE_SET_PIPELINE_LAYOUT, CAPTURE_HANDLE_TYPE_PIPELINE_LAYOUT, opalCmdRaytraceSetPipelineLayout)
+		REPLAY_SET_OBJECT(CAPTURE_CALL_CMD_RAYTRACE_SET_PIPELINE, CAPTURE_HANDLE_TYPE_RAYTRACE_PIPELINE, opalCmdRaytraceSetPipeline)
+		REPLAY_SET_OBJECT(CAPTURE_CALL_CMD_RAYTRACE_SET_SHADER_BINDING_TABLE, CAPTURE_HANDLE_TYPE_SHADER_BINDING_TABLE, opalCmdRaytraceSetShaderBindingTable)
+
+#undef REPLAY_SET_OBJECT
+
+#define REPLAY_SET_DESCRIPTOR_SET(CALL, FUNC) \
+		case CALL: \
+		{ \
+			uint32_t index = 0; \
+			Opal_DescriptorSet descriptor_set = OPAL_NULL_HANDLE; \
+			uint32_t num_dynamic_offsets = 0; \
+			const uint32_t *dynamic_offsets = nullptr; \
+			capture_callCmdSetDescriptorSet(stream, &device, &command_buffer, &index, &descriptor_set, &num_dynamic_offsets, &dynamic_offsets); \
+			timed(replayer, call, [&]() { return FUNC(device, command_buffer, index, descriptor_set, num_dynamic_offsets, dynamic_offsets); }); \
+		} \
+		break;
+
+		REPLAY_SET_DESCRIPTOR_SET(CAPTURE_CALL_CMD_GRAPHICS_SET_DESCRIPTOR_SET, opalCmdGraphicsSetDescriptorSet)
+		REPLAY_SET_DESCRIPTOR_SET(CAPTURE_CALL_CMD_COMPUTE_SET_DESCRIPTOR_SET, opalCmdComputeSetDescriptorSet)
+		REPLAY_SET_DESCRIPTOR_SET(CAPTURE_CALL_CMD_RAYTRACE_SET_DESCRIPTOR_SET, opalCmdRaytraceSetDescriptorSet)
+
+#undef REPLAY_SET_DESCRIPTOR_SET
+
+		case CAPTURE_CALL_CMD_GRAPHICS_SET_VERTEX_BUFFERS:
+		{
+			uint32_t first_index = 0;
+			uint32_t num_vertex_buffers = 0;
+			const Opal_VertexBufferView *vertex_buffers = nullptr;
+			capture_callCmdGraphicsSetVertexBuffers(stream, &device, &command_buffer, &first_index, &num_vertex_buffers, &vertex_buffers);
+
+			timed(replayer, call, [&]() { return opalCmdGraphicsSetVertexBuffers(device, command_buffer, first_index, num_vertex_buffers, vertex_buffers); });
+		}
+		break;
+
+		case CAPTURE_CALL_CMD_GRAPHICS_SET_INDEX_BUFFER:
+		{
+			Opal_IndexBufferView index_buffer {};
+			capture_callCmdGraphicsSetIndexBuffer(stream, &device, &command_buffer, &index_buffer);
+
+			timed(replayer, call, [&]() { return opalCmdGraphicsSetIndexBuffer(device, command_buffer, index_buffer); });
+		}
+		break;
+
+		case CAPTURE_CALL_CMD_GRAPHICS_SET_VIEWPORT:
+		{
+			Opal_Viewport viewport {};
+			capture_callCmdGraphicsSetViewport(stream, &device, &command_buffer, &viewport);
+
+			timed(replayer, call, [&]() { return opalCmdGraphicsSetViewport(device, command_buffer, viewport); });
+		}
+		break;
+
+		case CAPTURE_CALL_CMD_GRAPHICS_SET_SCISSOR:
+		{
+			uint32_t x = 0, y = 0, width = 0, height = 0;
+			capture_callCmdGraphicsSetScissor(stream, &device, &command_buffer, &x, &y, &width, &height);
+
+			timed(replayer, call, [&]() { return opalCmdGraphicsSetScissor(device, command_buffer, x, y, width, height); });
+		}
+		break;
+
+		case CAPTURE_CALL_CMD_GRAPHICS_DRAW:
+		{
+			uint32_t num_vertices = 0, num_instances = 0, base_vertex = 0, base_instance = 0;
+			capture_callCmdGraphicsDraw(stream, &device, &command_buffer, &num_vertices, &num_instances, &base_vertex, &base_instance);
+
+			timed(replayer, call, [&]() { return opalCmdGraphicsDraw(device, command_buffer, num_vertices, num_instances, base_vertex, base_instance); });
+		}
+		break;
+
+		case CAPTURE_CALL_CMD_GRAPHICS_DRAW_INDEXED:
+		{
+			uint32_t num_indices = 0, num_instances = 0, base_index = 0, base_instance = 0;
+			int32_t vertex_offset = 0;
+			capture_callCmdGraphicsDrawIndexed(stream, &device, &command_buffer, &num_indices, &num_instances, &base_index, &vertex_offset, &base_instance);
+
+			timed(replayer, call, [&]() { return opalCmdGraphicsDrawIndexed(device, command_buffer, num_indices, num_instances, base_index, vertex_offset, base_instance); });
+		}
+		break;
+
+#define REPLAY_DISPATCH(CALL, FUNC) \
+		case CALL: \
+		{ \
+			uint32_t x = 0, y = 0, z = 0; \
+			capture_callCmdDispatch(stream, &device, &command_buffer, &x, &y, &z); \
+			timed(replayer, call, [&]() { return FUNC(device, command_buffer, x, y, z); }); \
+		} \
+		break;
+
+		REPLAY_DISPATCH(CAPTURE_CALL_CMD_GRAPHICS_MESHLET_DISPATCH, opalCmdGraphicsMeshletDispatch)
+		REPLAY_DISPATCH(CAPTURE_CALL_CMD_COMPUTE_DISPATCH, opalCmdComputeDispatch)
+		REPLAY_DISPATCH(CAPTURE_CALL_CMD_RAYTRACE_DISPATCH, opalCmdRaytraceDispatch)
+
+#undef REPLAY_DISPATCH
+
+		case CAPTURE_CALL_CMD_COMPUTE_MEMORY_BARRIER:
+		case CAPTURE_CALL_CMD_RAYTRACE_MEMORY_BARRIER:
+		{
+			const Opal_MemoryBarrierDesc *barriers = nullptr;
+			capture_callCmdMemoryBarrier(stream, &device, &command_buffer, &barriers);
+
+			if (call == CAPTURE_CALL_CMD_COMPUTE_MEMORY_BARRIER)
+				timed(replayer, call, [&]() { return opalCmdComputeMemoryBarrier(device, command_buffer, barriers); });
+			else
+				timed(replayer, call, [&]() { return opalCmdRaytraceMemoryBarrier(device, command_buffer, barriers); });
+		}
+		break;
+
+		case CAPTURE_CALL_CMD_COPY_BUFFER_TO_BUFFER:
+		{
+			Opal_Buffer src_buffer = OPAL_NULL_HANDLE, dst_buffer = OPAL_NULL_HANDLE;
+			uint64_t src_offset = 0, dst_offset = 0, size = 0;
+			capture_callCmdCopyBufferToBuffer(stream, &device, &command_buffer, &src_buffer, &src_offset, &dst_buffer, &dst_offset, &size);
+
+			timed(replayer, call, [&]() { return opalCmdCopyBufferToBuffer(device, command_buffer, src_buffer, src_offset, dst_buffer, dst_offset, size); });
+		}
+		break;
+
+		case CAPTURE_CALL_CMD_COPY_BUFFER_TO_TEXTURE:
+		{
+			Opal_BufferTextureRegion src {};
+			Opal_TextureRegion dst {};
+			Opal_Extent3D size {};
+			capture_callCmdCopyBufferToTexture(stream, &device, &command_buffer, &src, &dst, &size);
+
+			timed(replayer, call, [&]() { return opalCmdCopyBufferToTexture(device, command_buffer, src, dst, size); });
+		}
+		break;
+
+		case CAPTURE_CALL_CMD_COPY_TEXTURE_TO_BUFFER:
+		{
+			Opal_TextureRegion src {};
+			Opal_BufferTextureRegion dst {};
+			Opal_Extent3D size {};
+			capture_callCmdCopyTextureToBuffer(stream, &device, &command_buffer, &src, &dst, &size);
+
+			timed(replayer, call, [&]() { return opalCmdCopyTextureToBuffer(device, command_buffer, src, dst, size); });
+		}
+		break;
+
+		case CAPTURE_CALL_CMD_COPY_BUFFER_TO_TEXTURE_REGIONS:
+		{
+			Opal_Buffer src_buffer = OPAL_NULL_HANDLE;
+			Opal_Texture dst_texture = OPAL_NULL_HANDLE;
+			uint32_t num_regions = 0;
+			const Opal_BufferTextureCopyRegion *regions = nullptr;
+			capture_callCmdCopyBufferToTextureRegions(stream, &device, &command_buffer, &src_buffer, &dst_texture, &num_regions, &regions);
+
+			timed(replayer, call, [&]() { return opalCmdCopyBufferToTextureRegions(device, command_buffer, src_buffer, dst_texture, num_regions, regions); });
+		}
+		break;
+
+		case CAPTURE_CALL_CMD_COPY_TEXTURE_TO_BUFFER_REGIONS:
+		{
+			Opal_Texture src_texture = OPAL_NULL_HANDLE;
+			Opal_Buffer dst_buffer = OPAL_NULL_HANDLE;
+			uint32_t num_regions = 0;
+			const Opal_BufferTextureCopyRegion *regions = nullptr;
+			capture_callCmdCopyTextureToBufferRegions(stream, &device, &command_buffer, &src_texture, &dst_buffer, &num_regions, &regions);
+
+			timed(replayer, call, [&]() { return opalCmdCopyTextureToBufferRegions(device, command_buffer, src_texture, dst_buffer, num_regions, regions); });
+		}
+		break;
+
+		case CAPTURE_CALL_CMD_COPY_TEXTURE_TO_TEXTURE:
+		{
+			Opal_TextureRegion src {};
+			Opal_TextureRegion dst {};
+			Opal_Extent3D size {};
+			capture_callCmdCopyTextureToTexture(stream, &device, &command_buffer, &src, &dst, &size);
+
+			timed(replayer, call, [&]() { return opalCmdCopyTextureToTexture(device, command_buffer, src, dst, size); });
+		}
+		break;
+
+		case CAPTURE_CALL_CMD_FILL_BUFFER:
+		{
+			Opal_Buffer buffer = OPAL_NULL_HANDLE;
+			uint64_t offset = 0;
+			uint64_t size = 0;
+			uint32_t value = 0;
+			capture_callCmdFillBuffer(stream, &device, &command_buffer, &buffer, &offset, &size, &value);
+
+			timed(replayer, call, [&]() { return opalCmdFillBuffer(device, command_buffer, buffer, offset, size, value); });
+		}
+		break;
+
+		case CAPTURE_CALL_CMD_UPDATE_BUFFER:
+		{
+			Opal_Buffer buffer = OPAL_NULL_HANDLE;
+			uint64_t offset = 0;
+			uint64_t size = 0;
+			const void *data = nullptr;
+			capture_callCmdUpdateBuffer(stream, &device, &command_buffer, &buffer, &offset, &size, &data);
+
+			timed(replayer, call, [&]() { return opalCmdUpdateBuffer(device, command_buffer, buffer, offset, size, data); });
+		}
+		break;
+
+		case CAPTURE_CALL_CMD_CLEAR_TEXTURE:
+		{
+			Opal_TextureView texture_view = OPAL_NULL_HANDLE;
+			Opal_ClearValue clear_value {};
+			capture_callCmdClearTexture(stream, &device, &command_buffer, &texture_view, &clear_value);
+
+			timed(replayer, call, [&]() { return opalCmdClearTexture(device, command_buffer, texture_view, clear_value); });
+		}
+		break;
+
+		case CAPTURE_CALL_CMD_BLIT_TEXTURE:
+		{
+			Opal_TextureRegion src {};
+			Opal_Extent3D src_size {};
+			Opal_TextureRegion dst {};
+			Opal_Extent3D dst_size {};
+			Opal_SamplerFilterMode filter = OPAL_SAMPLER_FILTER_MODE_NEAREST;
+			capture_callCmdBlitTexture(stream, &device, &command_buffer, &src, &src_size, &dst, &dst_size, &filter);
+
+			timed(replayer, call, [&]() { return opalCmdBlitTexture(device, command_buffer, src, src_size, dst, dst_size, filter); });
+		}
+		break;
+
+		case CAPTURE_CALL_CMD_GENERATE_MIPS:
+		{
+			Opal_TextureView texture_view = OPAL_NULL_HANDLE;
+			capture_callCmdGenerateMips(stream, &device, &command_buffer, &texture_view);
+
+			timed(replayer, call, [&]() { return opalCmdGenerateMips(device, command_buffer, texture_view); });
+		}
+		break;
+
+		case CAPTURE_CALL_CMD_ACCELERATION_STRUCTURE_BUILD:
+		{
+			const Opal_AccelerationStructureBuildDesc *desc = nullptr;
+			capture_callCmdAccelerationStructureBuild(stream, &device, &command_buffer, &desc);
+
+			timed(replayer, call, [&]() { return opalCmdAccelerationStructureBuild(device, command_buffer, desc); });
+		}
+		break;
+
+		case CAPTURE_CALL_CMD_ACCELERATION_STRUCTURE_BUILD_BATCH:
+		{
+			uint32_t num_descs = 0;
+			const Opal_AccelerationStructureBuildDesc *descs = nullptr;
+			capture_callCmdAccelerationStructureBuildBatch(stream, &device, &command_buffer, &num_descs, &descs);
+
+			timed(replayer, call, [&]() { return opalCmdAccelerationStructureBuildBatch(device, command_buffer, num_descs, descs); });
+		}
+		break;
+
+		case CAPTURE_CALL_CMD_ACCELERATION_STRUCTURE_COPY:
+		{
+			const Opal_AccelerationStructureCopyDesc *desc = nullptr;
+			capture_callCmdAccelerationStructureCopy(stream, &device, &command_buffer, &desc);
+
+			timed(replayer, call, [&]() { return opalCmdAccelerationStructureCopy(device, command_buffer, desc); });
+		}
+		break;
+
+		case CAPTURE_CALL_CMD_ACCELERATION_STRUCTURE_WRITE_COMPACTED_SIZES:
+		{
+			uint32_t num_acceleration_structures = 0;
+			const Opal_AccelerationStructure *acceleration_structures = nullptr;
+			Opal_BufferView dst {};
+			capture_callCmdAccelerationStructureWriteCompactedSizes(stream, &device, &command_buffer, &num_acceleration_structures, &acceleration_structures, &dst);
+
+			timed(replayer, call, [&]() { return opalCmdAccelerationStructureWriteCompactedSizes(device, command_buffer, num_acceleration_structures, acceleration_structures, dst); });
+		}
+		break;
+
+		case CAPTURE_CALL_BUFFER_DATA:
+		{
+			Opal_Buffer buffer = OPAL_NULL_HANDLE;
+			uint64_t offset = 0;
+			uint64_t size = 0;
+			const void *data = nullptr;
+			capture_callBufferData(stream, &device, &buffer, &offset, &size, &data);
+
+			if (data == nullptr)
+				break;
+
+			timed(replayer, call, [&]()
+			{
+				auto it = replayer.mapped_buffers.find(buffer);
+				if (it != replayer.mapped_buffers.end())
+				{
+					memcpy(it->second + offset, data, size);
+					return OPAL_SUCCESS;
+				}
+
+				return opalWriteBuffer(device, buffer, offset, data, size);
+			});
+		}
+		break;
+
+		default:
+		{
+			replayer.num_skipped++;
+		}
+		break;
+	}
+
+	if (stream->overflow)
+		std::cerr << "Warning: truncated record for " << capture_getCallName(call) << "\n";
+}
+
+/*
+ */
+static bool parseApi(const char *name, Opal_Api *api)
+{
+	static const struct { const char *name; Opal_Api api; } apis[] =
+	{
+		{"vulkan", OPAL_API_VULKAN},
+		{"directx12", OPAL_API_DIRECTX12},
+		{"metal", OPAL_API_METAL},
+		{"webgpu", OPAL_API_WEBGPU},
+		{"null", OPAL_API_NULL},
+		{"auto", OPAL_API_AUTO},
+	};
+
+	for (const auto &entry : apis)
+	{
+		if (strcmp(entry.name, name) != 0)
+			continue;
+
+		*api = entry.api;
+		return true;
+	}
+
+	return false;
+}
+
+static void printUsage()
+{
+	std::cout << "Usage: opal-replay <trace> [--api vulkan|directx12|metal|webgpu|null|auto] [--extent <width>x<height>]\n";
+	std::cout << "\n";
+	std::cout << "Replays a trace recorded with OPAL_CAPTURE_FILE and reports per-call and per-frame CPU timings.\n";
+}
+
+static void printReport(const Replayer &replayer, uint64_t wall_ns)
+{
+	std::vector<uint32_t> calls;
+	for (uint32_t i = 0; i < CAPTURE_CALL_ENUM_MAX; ++i)
+		if (replayer.stats[i].count > 0)
+			calls.push_back(i);
+
+	std::sort(calls.begin(), calls.end(), [&](uint32_t a, uint32_t b) { return replayer.stats[a].total_ns > replayer.stats[b].total_ns; });
+
+	printf("%-48s %10s %12s %10s %10s\n", "call", "count", "total (ms)", "avg (us)", "max (us)");
+	for (uint32_t call : calls)
+	{
+		const CallStats &stats = replayer.stats[call];
+		printf("%-48s %10llu %12.3f %10.3f %10.3f\n",
+			capture_getCallName(static_cast<Capture_Call>(call)),
+			static_cast<unsigned long long>(stats.count),
+			stats.total_ns / 1e6,
+			stats.total_ns / 1e3 / stats.count,
+			stats.max_ns / 1e3
+		);
+	}
+
+	printf("\n");
+	printf("records: %llu, skipped: %llu, failed calls: %llu, unresolved handles: %llu\n",
+		static_cast<unsigned long long>(replayer.num_records),
+		static_cast<unsigned long long>(replayer.num_skipped),
+		static_cast<unsigned long long>(replayer.num_failed),
+		static_cast<unsigned long long>(replayer.num_missing_handles)
+	);
+	printf("wall time: %.3f ms\n", wall_ns / 1e6);
+
+	if (replayer.frame_times.empty())
+		return;
+
+	std::vector<uint64_t> frame_times = replayer.frame_times;
+	std::sort(frame_times.begin(), frame_times.end());
+
+	uint64_t total_ns = 0;
+	for (uint64_t ns : frame_times)
+		total_ns += ns;
+
+	size_t count = frame_times.size();
+	auto percentile = [&](double p) { return frame_times[std::min(count - 1, static_cast<size_t>(p * (count - 1) + 0.5))]; };
+
+	printf("\n");
+	printf("frames: %zu, cpu time per frame (us): avg %.3f, min %.3f, p50 %.3f, p99 %.3f, max %.3f\n",
+		count,
+		total_ns / 1e3 / count,
+		frame_times.front() / 1e3,
+		percentile(0.5) / 1e3,
+		percentile(0.99) / 1e3,
+		frame_times.back() / 1e3
+	);
+}
+
+/*
+ */
+int main(int argc, char **argv)
+{
+	const char *path = nullptr;
+	const char *api_name = nullptr;
+	Replayer *replayer = new Replayer();
+
+	for (int i = 1; i < argc; ++i)
+	{
+		if (strcmp(argv[i], "--api") == 0 && i + 1 < argc)
+			api_name = argv[++i];
+		else if (strcmp(argv[i], "--extent") == 0 && i + 1 < argc)
+			sscanf(argv[++i], "%ux%u", &replayer->width, &replayer->height);
+		else if (path == nullptr && argv[i][0] != '-')
+			path = argv[i];
+		else
+		{
+			printUsage();
+			delete replayer;
+			return 1;
+		}
+	}
+
+	if (path == nullptr)
+	{
+		printUsage();
+		delete replayer;
+		return 1;
+	}
+
+	Capture_FileHeader header {};
+	Opal_Result result = capture_streamOpenRead(&replayer->stream, path, &header, remapHandle, replayer);
+	if (result != OPAL_SUCCESS)
+	{
+		std::cerr << "Can't open trace \"" << path << "\"\n";
+		delete replayer;
+		return 1;
+	}
+
+	replayer->api = static_cast<Opal_Api>(header.api);
+	if (api_name && !parseApi(api_name, &replayer->api))
+	{
+		std::cerr << "Unknown api \"" << api_name << "\"\n";
+		capture_streamClose(&replayer->stream);
+		delete replayer;
+		return 1;
+	}
+
+	Clock::time_point begin = Clock::now();
+
+	Capture_Call call = CAPTURE_CALL_ENUM_MAX;
+	Opal_Result captured_result = OPAL_SUCCESS;
+
+	while ((result = capture_readRecord(&replayer->stream, &call, &captured_result)) == OPAL_SUCCESS)
+	{
+		replayer->num_records++;
+
+		// note: calls that failed at capture time are not replayed, their outputs were never used by the application
+		if (captured_result != OPAL_SUCCESS)
+		{
+			replayer->num_skipped++;
+			continue;
+		}
+
+		replayRecord(*replayer, call);
+	}
+
+	Clock::time_point end = Clock::now();
+
+	if (result == OPAL_INTERNAL_ERROR)
+		std::cerr << "Warning: trace is truncated or corrupted after " << replayer->num_records << " records\n";
+
+	capture_streamClose(&replayer->stream);
+
+	uint64_t wall_ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+	printReport(*replayer, wall_ns);
+
+	delete replayer;
+	return 0;
+}